@@ -26,6 +26,7 @@ class CustomSpaceBase {
   virtual ~CustomSpaceBase() = default;
   virtual CustomSpaceIndex GetCustomSpaceIndex() const = 0;
   virtual bool IsCompactable() const = 0;
+  virtual bool IsSweepingPrioritized() const = 0;
 };
 
 /**
@@ -54,12 +55,22 @@ class CustomSpace : public CustomSpaceBase {
    */
   static constexpr bool kSupportsCompaction = false;
 
+  /**
+   * Pages of prioritized spaces are swept and finalized before pages of all
+   * other spaces, so that memory of these spaces becomes available for
+   * allocation first.
+   */
+  static constexpr bool kPrioritizeSweeping = false;
+
   CustomSpaceIndex GetCustomSpaceIndex() const final {
     return ConcreteCustomSpace::kSpaceIndex;
   }
   bool IsCompactable() const final {
     return ConcreteCustomSpace::kSupportsCompaction;
   }
+  bool IsSweepingPrioritized() const final {
+    return ConcreteCustomSpace::kPrioritizeSweeping;
+  }
 };
 
 /**
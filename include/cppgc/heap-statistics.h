@@ -94,8 +94,23 @@ struct HeapStatistics final {
     std::vector<PageStatistics> page_stats;
     /** Statistics for the freelist of the space. */
     FreeListStatistics free_list_stats;
+    /** Whether objects on the space may be moved by heap compaction. */
+    bool is_compactable = false;
+    /**
+     * Fraction of the committed memory of the space that is held by the
+     * freelist. Compactable spaces are considered for compaction when their
+     * combined fragmentation exceeds
+     * `HeapStatistics::kCompactionFragmentationThreshold`.
+     */
+    double fragmentation = 0;
   };
 
+  /**
+   * Fragmentation of compactable spaces above which a memory-reducing garbage
+   * collection compacts these spaces.
+   */
+  static constexpr double kCompactionFragmentationThreshold = 0.3;
+
   /** Overall committed amount of memory for the heap. */
   size_t committed_size_bytes = 0;
   /** Resident amount of memory help by the heap. */
@@ -22,6 +22,7 @@ namespace v8 {
 
 template <typename T>
 class FunctionCallbackInfo;
+class Function;
 class Isolate;
 class Message;
 class Module;
@@ -235,6 +236,27 @@ enum class CrashKeyId {
 
 using AddCrashKeyCallback = void (*)(CrashKeyId id, const std::string& value);
 
+// --- Deoptimization Callback ---
+enum class DeoptimizationKind { kEager, kSoft, kLazy };
+
+struct DeoptimizationInfo {
+  // The function whose optimized code was left.
+  Local<Function> function;
+  // A static string describing why the optimized code bailed out, e.g.
+  // "wrong map".
+  const char* reason;
+  DeoptimizationKind kind;
+  // The number of eager and soft deoptimizations of the function so far. The
+  // count saturates and is shared by all closures of the function.
+  int deopt_count;
+  // True if this deoptimization made V8 give up optimizing the function
+  // because it keeps deoptimizing (see --deopt-loop-detection).
+  bool optimization_disabled;
+};
+
+using DeoptimizationCallback = void (*)(Isolate* isolate,
+                                        const DeoptimizationInfo& info);
+
 // --- Enter/Leave Script Callback ---
 using BeforeCallEnteredCallback = void (*)(Isolate*);
 using CallCompletedCallback = void (*)(Isolate*);
@@ -157,6 +157,7 @@
  * Currently supported argument types:
  *  - pointer to an embedder type
  *  - JavaScript array of primitive types
+ *  - sequential one-byte string (FastOneByteString)
  *  - bool
  *  - int32_t
  *  - uint32_t
@@ -201,8 +202,12 @@
  * \endcode
  *
  * In this example a single FunctionTemplate is associated to multiple C++
- * functions. The overload resolution is currently only based on the number of
- * arguments passed in a call. For example, if this method_template is
+ * functions. The overload resolution is mostly based on the number of
+ * arguments passed in a call. Overloads with the same number of arguments are
+ * resolved at runtime if they differ in a single argument, which has to be a
+ * JavaScript array, a TypedArray or a FastOneByteString in each of them. The
+ * first overload whose type matches the argument is called, and the
+ * SlowCallback if none does. For example, if this method_template is
  * registered with a wrapper JS object as described above, a call with two
  * arguments:
  *    obj.method(42, true);
@@ -247,6 +252,7 @@ class CTypeInfo {
     kFloat32,
     kFloat64,
     kV8Value,
+    kSeqOneByteString,
     kApiObject,  // This will be deprecated once all users have
                  // migrated from v8::ApiObject to v8::Local<v8::Value>.
   };
@@ -306,6 +312,15 @@ class CTypeInfo {
            type == Type::kBool;
   }
 
+  // Whether an argument of this type can be told apart from the other
+  // distinguishable types at runtime, for overload resolution.
+  constexpr bool IsDistinguishable() const {
+    return sequence_type_ == SequenceType::kIsSequence ||
+           sequence_type_ == SequenceType::kIsTypedArray ||
+           (sequence_type_ == SequenceType::kScalar &&
+            type_ == Type::kSeqOneByteString);
+  }
+
  private:
   Type type_;
   SequenceType sequence_type_;
@@ -323,6 +338,19 @@ struct FastApiTypedArrayBase {
   size_t length_ = 0;
 };
 
+template <typename T>
+struct FastApiTypedArray;
+
+/**
+ * Makes view refer to the elements of this JavaScript array without copying
+ * them, if the array has packed double elements. Otherwise, or if the array
+ * has a custom iterator, the operation fails and returns false. The view is
+ * only valid until the fast call returns, since the elements may be changed
+ * or moved afterwards.
+ */
+bool V8_EXPORT V8_WARN_UNUSED_RESULT TryToGetPackedDoubleArrayView(
+    Local<Array> src, FastApiTypedArray<double>* view);
+
 template <typename T>
 struct FastApiTypedArray : public FastApiTypedArrayBase {
  public:
@@ -344,6 +372,9 @@ struct FastApiTypedArray : public FastApiTypedArrayBase {
   }
 
  private:
+  friend bool TryToGetPackedDoubleArrayView(Local<Array> src,
+                                            FastApiTypedArray<double>* view);
+
   // This pointer should include the typed array offset applied.
   // It's not guaranteed that it's aligned to sizeof(T), it's only
   // guaranteed that it's 4-byte aligned, so for 8-byte types we need to
@@ -368,6 +399,14 @@ struct FastApiArrayBuffer {
   size_t byte_length;
 };
 
+// The characters of a sequential one-byte string, which are Latin-1 encoded
+// and not null-terminated. The data is only valid during the fast call. Other
+// strings, e.g. two-byte, sliced or cons strings, take the slow callback.
+struct FastOneByteString {
+  const char* data;
+  uint32_t length;
+};
+
 class V8_EXPORT CFunctionInfo {
  public:
   // Construct a struct to hold a CFunction's type information.
@@ -436,17 +475,19 @@ class V8_EXPORT CFunction {
     int diff_index = -1;
     for (unsigned int i = 0; i < ArgumentCount(); ++i) {
       if (ArgumentInfo(i).GetSequenceType() !=
-          other->ArgumentInfo(i).GetSequenceType()) {
+              other->ArgumentInfo(i).GetSequenceType() ||
+          ArgumentInfo(i).GetType() != other->ArgumentInfo(i).GetType()) {
         if (diff_index >= 0) {
           return OverloadResolution::kImpossible;
         }
         diff_index = i;
 
-        // We only support overload resolution between sequence types.
-        if (ArgumentInfo(i).GetSequenceType() ==
-                CTypeInfo::SequenceType::kScalar ||
-            other->ArgumentInfo(i).GetSequenceType() ==
-                CTypeInfo::SequenceType::kScalar) {
+        // We only support overload resolution between types that can be
+        // told apart by their instance type.
+        if (!ArgumentInfo(i).IsDistinguishable() ||
+            !other->ArgumentInfo(i).IsDistinguishable() ||
+            ArgumentInfo(i).GetSequenceType() ==
+                other->ArgumentInfo(i).GetSequenceType()) {
           return OverloadResolution::kImpossible;
         }
       }
@@ -649,6 +690,18 @@ TYPED_ARRAY_C_TYPES(SPECIALIZE_GET_TYPE_INFO_HELPER_FOR_TA)
 
 #undef TYPED_ARRAY_C_TYPES
 
+template <>
+struct TypeInfoHelper<const FastOneByteString&> {
+  static constexpr CTypeInfo::Flags Flags() { return CTypeInfo::Flags::kNone; }
+
+  static constexpr CTypeInfo::Type Type() {
+    return CTypeInfo::Type::kSeqOneByteString;
+  }
+  static constexpr CTypeInfo::SequenceType SequenceType() {
+    return CTypeInfo::SequenceType::kScalar;
+  }
+};
+
 template <>
 struct TypeInfoHelper<v8::Local<v8::Array>> {
   static constexpr CTypeInfo::Flags Flags() { return CTypeInfo::Flags::kNone; }
@@ -38,6 +38,7 @@ class ScriptOrModule;
 class SharedArrayBuffer;
 
 namespace internal {
+class IsolatePool;
 class MicrotaskQueue;
 class ThreadLocalTop;
 }  // namespace internal
@@ -786,6 +787,38 @@ class V8_EXPORT Isolate {
       std::unique_ptr<MeasureMemoryDelegate> delegate,
       MeasureMemoryExecution execution = MeasureMemoryExecution::kDefault);
 
+  /**
+   * Callback for SetContextAllocationLimit. It is invoked from an interrupt
+   * once the bytes allocated while |context| was the current context exceed
+   * the limit.
+   */
+  using ContextAllocationLimitCallback = void (*)(Isolate* isolate,
+                                                  Local<Context> context,
+                                                  size_t allocated_bytes,
+                                                  void* data);
+
+  /**
+   * This API is experimental and may change significantly.
+   *
+   * Sets a soft limit for the bytes allocated while |context| is the current
+   * context. The first call enables sampling of allocations per context.
+   * Allocations are attributed with a granularity that is a heuristic, so the
+   * callback may be invoked after the limit was exceeded by a few KB. A limit
+   * of 0 removes the limit.
+   */
+  void SetContextAllocationLimit(Local<Context> context, size_t limit_in_bytes,
+                                 ContextAllocationLimitCallback callback,
+                                 void* data);
+
+  /**
+   * This API is experimental and may change significantly.
+   *
+   * Returns the sampled bytes allocated while |context| was the current
+   * context since the first call to SetContextAllocationLimit, or 0 if
+   * allocations are not sampled.
+   */
+  size_t GetContextAllocatedBytes(Local<Context> context);
+
   /**
    * Get a call stack sample from the isolate.
    * \param state Execution state.
@@ -1259,6 +1292,14 @@ class V8_EXPORT Isolate {
    */
   void SetAddCrashKeyCallback(AddCrashKeyCallback);
 
+  /**
+   * Registers a callback that is invoked on the main thread each time
+   * execution leaves optimized code of a function. The callback must not
+   * call into JavaScript or allocate on the V8 heap. Pass nullptr to remove
+   * the callback.
+   */
+  void SetDeoptimizationCallback(DeoptimizationCallback callback);
+
   /**
    * Optional notification that the embedder is idle.
    * V8 uses the notification to perform garbage collection.
@@ -1583,6 +1624,14 @@ class V8_EXPORT Isolate {
    */
   void SetAllowAtomicsWait(bool allow);
 
+  /**
+   * Set whether baseline code is compiled on background threads in this
+   * isolate, leaving only its installation to the main thread. This has no
+   * effect unless V8 runs with --concurrent-sparkplug, which enables it for
+   * all isolates by default.
+   */
+  void SetConcurrentBaselineCompilation(bool enabled);
+
   /**
    * Time zone redetection indicator for
    * DateTimeConfigurationChangeNotification.
@@ -1663,6 +1712,57 @@ MaybeLocal<T> Isolate::GetDataFromSnapshotOnce(size_t index) {
   return Local<T>(data);
 }
 
+/**
+ * A pool of isolates that are created ahead of time on worker threads of the
+ * platform, for embedders that need a fresh isolate per unit of work. Each
+ * isolate handed out by Acquire() is replaced by creating a new one in the
+ * background, and isolates given back with Release() are disposed of in the
+ * background, so that neither cost is paid on the calling thread.
+ *
+ * The pool never reuses an isolate. All methods are thread-safe.
+ */
+class V8_EXPORT IsolatePool final {
+ public:
+  /**
+   * Creates a pool that keeps up to |size| isolates ready, all created with
+   * |params|. The pool starts filling right away.
+   */
+  static std::unique_ptr<IsolatePool> New(const Isolate::CreateParams& params,
+                                          size_t size);
+
+  /**
+   * Waits for the isolates that are being created or disposed of and
+   * disposes of the ready ones. Isolates that were acquired and not
+   * released must be disposed of by the embedder.
+   */
+  ~IsolatePool();
+
+  IsolatePool(const IsolatePool&) = delete;
+  IsolatePool& operator=(const IsolatePool&) = delete;
+
+  /**
+   * Returns a new isolate that has not been entered by any thread. If no
+   * isolate is ready, one is created on the calling thread.
+   */
+  Isolate* Acquire();
+
+  /**
+   * Disposes of |isolate|, which must not be entered by any thread, in the
+   * background. |isolate| need not come from this pool.
+   */
+  void Release(Isolate* isolate);
+
+  /**
+   * Returns the number of isolates that are ready to be acquired.
+   */
+  size_t ReadyCount() const;
+
+ private:
+  explicit IsolatePool(std::unique_ptr<internal::IsolatePool> impl);
+
+  std::unique_ptr<internal::IsolatePool> impl_;
+};
+
 }  // namespace v8
 
 #endif  // INCLUDE_V8_ISOLATE_H_
@@ -5,6 +5,10 @@
 #ifndef INCLUDE_V8_JSON_H_
 #define INCLUDE_V8_JSON_H_
 
+#include <stddef.h>
+
+#include <memory>
+
 #include "v8-local-handle.h"  // NOLINT(build/include_directory)
 #include "v8config.h"         // NOLINT(build/include_directory)
 
@@ -14,11 +18,42 @@ class Context;
 class Value;
 class String;
 
+namespace internal {
+class JsonUtf8Buffer;
+}  // namespace internal
+
 /**
  * A JSON Parser and Stringifier.
  */
 class V8_EXPORT JSON {
  public:
+  /**
+   * UTF-8 encoded JSON text that the embedder provides in chunks, e.g. as
+   * they arrive from the network. The chunks are decoded as they are appended
+   * and kept outside of the V8 heap, so parsing does not need the whole text
+   * as a heap string.
+   */
+  class V8_EXPORT Utf8Source {
+   public:
+    Utf8Source();
+    ~Utf8Source();
+
+    /**
+     * Appends the next |length| bytes of the text. Chunks may split multi-byte
+     * characters.
+     */
+    void Append(const char* data, size_t length);
+
+    internal::JsonUtf8Buffer* impl() const { return impl_.get(); }
+
+    // Prevent copying.
+    Utf8Source(const Utf8Source&) = delete;
+    Utf8Source& operator=(const Utf8Source&) = delete;
+
+   private:
+    std::unique_ptr<internal::JsonUtf8Buffer> impl_;
+  };
+
   /**
    * Tries to parse the string |json_string| and returns it as value if
    * successful.
@@ -30,6 +65,18 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<Value> Parse(
       Local<Context> context, Local<String> json_string);
 
+  /**
+   * Tries to parse the text appended to |source| and returns it as value if
+   * successful. The text is handed over to the resulting value's heap, so
+   * |source| is empty afterwards.
+   *
+   * \param the context in which to parse and create the value.
+   * \param source The complete text to parse.
+   * \return The corresponding value if successfully parsed.
+   */
+  static V8_WARN_UNUSED_RESULT MaybeLocal<Value> Parse(Local<Context> context,
+                                                       Utf8Source* source);
+
   /**
    * Tries to stringify the JSON-serializable object |json_object| and returns
    * it as string if successful.
@@ -121,6 +121,19 @@ struct WasmModulesPerIsolate {
   size_t count = 0;
 };
 
+struct OptimizedFunctionCompiled {
+  bool concurrent = false;
+  bool osr = false;
+  bool success = false;
+  size_t bytecode_size_in_bytes = 0;
+  size_t inlined_bytecode_size_in_bytes = 0;
+  size_t graph_node_count = 0;
+  size_t peak_zone_size_in_bytes = 0;
+  int64_t prepare_duration_in_us = -1;
+  int64_t execute_duration_in_us = -1;
+  int64_t finalize_duration_in_us = -1;
+};
+
 #define V8_MAIN_THREAD_METRICS_EVENTS(V)                    \
   V(GarbageCollectionFullCycle)                             \
   V(GarbageCollectionFullMainThreadIncrementalMark)         \
@@ -131,9 +144,30 @@ struct WasmModulesPerIsolate {
   V(WasmModuleDecoded)                                      \
   V(WasmModuleCompiled)                                     \
   V(WasmModuleInstantiated)                                 \
-  V(WasmModuleTieredUp)
+  V(WasmModuleTieredUp)                                     \
+  V(OptimizedFunctionCompiled)
+
+struct RuntimeCallStatsEntry {
+  const char* name = nullptr;
+  int64_t count = 0;
+  int64_t time_in_us = 0;
+};
+
+/**
+ * The runtime call stats of an isolate's main thread, reported periodically
+ * and at isolate teardown with --rcs-metrics. The counts and times are
+ * cumulative since the isolate was created, or since the last call to
+ * Isolate::DumpAndResetStats(). With --rcs-sampling-rate, they are estimated
+ * from the sampled calls.
+ */
+struct RuntimeCallStatsSummary {
+  std::vector<RuntimeCallStatsEntry> entries;
+  int sampling_rate = 1;
+};
 
-#define V8_THREAD_SAFE_METRICS_EVENTS(V) V(WasmModulesPerIsolate)
+#define V8_THREAD_SAFE_METRICS_EVENTS(V) \
+  V(WasmModulesPerIsolate)               \
+  V(RuntimeCallStatsSummary)
 
 /**
  * This class serves as a base class for recording event-based metrics in V8.
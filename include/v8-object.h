@@ -247,6 +247,19 @@ class V8_EXPORT Object : public Value {
   V8_WARN_UNUSED_RESULT Maybe<bool> Set(Local<Context> context, uint32_t index,
                                         Local<Value> value);
 
+  /**
+   * Sets the properties named by |keys| to the corresponding |values|, as if
+   * by calling Set() for each of them in order. Stops at the first exception
+   * and returns Nothing then. Writes to existing fields of objects of the
+   * same shape are resolved once per shape rather than per call, so keys
+   * should be internalized strings that are created once, e.g. with
+   * NewStringType::kInternalized, and kept in a v8::Eternal.
+   */
+  V8_WARN_UNUSED_RESULT Maybe<bool> SetMultiple(Local<Context> context,
+                                                const Local<Name> keys[],
+                                                const Local<Value> values[],
+                                                size_t count);
+
   // Implements CreateDataProperty (ECMA-262, 7.3.4).
   //
   // Defines a configurable, writable, enumerable property with the given value
@@ -293,6 +306,19 @@ class V8_EXPORT Object : public Value {
   V8_WARN_UNUSED_RESULT MaybeLocal<Value> Get(Local<Context> context,
                                               uint32_t index);
 
+  /**
+   * Gets the values of the properties named by |keys| into |values|, which
+   * must have room for |count| values, as if by calling Get() for each of
+   * them in order. Stops at the first exception and returns Nothing then, in
+   * which case the remaining values are undefined. Like SetMultiple(), this
+   * is meant for reading many fields of objects of the same shape, with
+   * internalized keys that are created once.
+   */
+  V8_WARN_UNUSED_RESULT Maybe<bool> GetMultiple(Local<Context> context,
+                                                const Local<Name> keys[],
+                                                size_t count,
+                                                Local<Value> values[]);
+
   /**
    * Gets the property attributes of a property which can be None or
    * any combination of ReadOnly, DontEnum and DontDelete. Returns
@@ -8,6 +8,7 @@
 #include <limits.h>
 
 #include <memory>
+#include <string>
 #include <unordered_set>
 #include <vector>
 
@@ -217,6 +218,12 @@ class V8_EXPORT CpuProfile {
    */
   int64_t GetEndTime() const;
 
+  /**
+   * Returns the number of samples the sampler could not record while this
+   * profile was recording, because the profiler thread fell behind.
+   */
+  unsigned GetDroppedSamplesCount() const;
+
   /**
    * Deletes the profile and removes it from CpuProfiler's list.
    * All pointers to nodes previously returned become invalid.
@@ -316,6 +323,27 @@ class V8_EXPORT CpuProfilingOptions {
   CopyablePersistentTraits<Context>::CopyablePersistent filter_context_;
 };
 
+/**
+ * A function referenced by samples of a streaming CPU profile.
+ */
+struct CpuProfileStreamFunction {
+  std::string name;
+  std::string resource_name;
+  int script_id;
+  int line_number;
+  int column_number;
+};
+
+/**
+ * A distinct stack of a streaming CPU profile and the number of samples that
+ * hit it. |frames| holds indices into the function table, innermost frame
+ * first.
+ */
+struct CpuProfileStreamStack {
+  std::vector<int> frames;
+  unsigned count;
+};
+
 /**
  * Interface for controlling CPU profiling. Instance of the
  * profiler can be created using v8::CpuProfiler::New method.
@@ -396,6 +424,30 @@ class V8_EXPORT CpuProfiler {
    */
   CpuProfile* StopProfiling(Local<String> title);
 
+  /**
+   * Starts streaming samples at the profiler's sampling interval. Instead of
+   * a CpuProfile tree, samples are aggregated into distinct stacks with
+   * counts, which are symbolized in batches and collected with
+   * DrainStreamedSamples(). This is meant for continuous profiling at low
+   * overhead and can run alongside regular profiles.
+   */
+  CpuProfilingStatus StartStreaming();
+
+  /**
+   * Stops streaming. Samples that were not drained yet are discarded.
+   */
+  void StopStreaming();
+
+  /**
+   * Moves the stacks counted since the last call into |stacks| and appends
+   * the functions they reference for the first time to |functions|. Function
+   * indices are stable for the lifetime of the profiler, so the caller keeps
+   * the function table across calls. Samples reach the stacks with a delay of
+   * up to 100ms. May be called from any thread.
+   */
+  void DrainStreamedSamples(std::vector<CpuProfileStreamFunction>* functions,
+                            std::vector<CpuProfileStreamStack>* stacks);
+
   /**
    * Generate more detailed source positions to code objects. This results in
    * better results when mapping profiling samples to script source.
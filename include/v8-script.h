@@ -345,6 +345,14 @@ class V8_EXPORT Script {
    * Returns the corresponding context-unbound script.
    */
   Local<UnboundScript> GetUnboundScript();
+
+  /**
+   * Returns the source positions of the functions of this script that have
+   * been compiled so far. The embedder can store them, e.g. next to the code
+   * cache, and return them from a ScriptCompiler::CompileHintCallback when
+   * the script is loaded again.
+   */
+  std::vector<int> GetProducedCompileHints() const;
 };
 
 enum class ScriptType { kClassic, kModule };
@@ -356,6 +364,15 @@ class V8_EXPORT ScriptCompiler {
  public:
   class ConsumeCodeCacheTask;
 
+  /**
+   * Called for lazy functions while a script is parsed, with the function's
+   * source position as produced by Script::GetProducedCompileHints. Returning
+   * true marks the function as likely to be called, so V8 may compile it on a
+   * background thread before its first call (see --parallel-compile-tasks).
+   * May be called on any thread.
+   */
+  using CompileHintCallback = bool (*)(int position, void* data);
+
   /**
    * Compilation data that the embedder can cache and pass back to speed up
    * future compilations. The data is produced if the CompilerOptions passed to
@@ -404,6 +421,8 @@ class V8_EXPORT ScriptCompiler {
     V8_INLINE explicit Source(
         Local<String> source_string, CachedData* cached_data = nullptr,
         ConsumeCodeCacheTask* consume_cache_task = nullptr);
+    V8_INLINE Source(Local<String> source_string, const ScriptOrigin& origin,
+                     CompileHintCallback callback, void* callback_data);
     V8_INLINE ~Source() = default;
 
     // Ownership of the CachedData or its buffers is *not* transferred to the
@@ -431,6 +450,10 @@ class V8_EXPORT ScriptCompiler {
     // set when calling a compile method.
     std::unique_ptr<CachedData> cached_data;
     std::unique_ptr<ConsumeCodeCacheTask> consume_cache_task;
+
+    // Hints for the functions to compile early.
+    CompileHintCallback compile_hint_callback = nullptr;
+    void* compile_hint_callback_data = nullptr;
   };
 
   /**
@@ -613,7 +636,9 @@ class V8_EXPORT ScriptCompiler {
    */
   static ScriptStreamingTask* StartStreaming(
       Isolate* isolate, StreamedSource* source,
-      ScriptType type = ScriptType::kClassic);
+      ScriptType type = ScriptType::kClassic,
+      CompileHintCallback compile_hint_callback = nullptr,
+      void* compile_hint_callback_data = nullptr);
 
   static ConsumeCodeCacheTask* StartConsumingCodeCache(
       Isolate* isolate, std::unique_ptr<CachedData> source);
@@ -713,6 +738,59 @@ class V8_EXPORT ScriptCompiler {
    */
   static CachedData* CreateCodeCacheForFunction(Local<Function> function);
 
+  /**
+   * Creates and returns a cache of the preparse data of the lazy functions of
+   * the specified unbound_script. Unlike the code cache, it does not depend on
+   * the V8 version or flags, so it is still usable when the code cache gets
+   * rejected. The CachedData returned by this function should be owned by the
+   * caller.
+   */
+  static CachedData* CreatePreparseDataCache(
+      Local<UnboundScript> unbound_script);
+
+  /**
+   * Attaches the preparse data in cached_data, which was produced by
+   * CreatePreparseDataCache for the same source, to the lazy functions of the
+   * specified unbound_script that have none, so that compiling them later does
+   * not need to preparse their inner functions again. Returns false and sets
+   * cached_data->rejected if the cache does not match the script.
+   */
+  static bool ConsumePreparseDataCache(Local<UnboundScript> unbound_script,
+                                       CachedData* cached_data);
+
+  /**
+   * Compiles the functions of the specified unbound_script that are compiled
+   * in cached_data, a code cache produced by CreateCodeCache for the same
+   * source, e.g. in another run. A code cache created afterwards covers the
+   * functions compiled in either, so that caches from several runs can be
+   * merged. Returns false and sets cached_data->rejected if the code cache is
+   * rejected.
+   */
+  static bool MergeCodeCache(Local<UnboundScript> unbound_script,
+                             CachedData* cached_data);
+
+  /**
+   * Creates and returns a delta that lists the compiled functions of the
+   * specified unbound_script, leaving out those that are compiled in
+   * base_cache, if given. base_cache is a code cache for the same source,
+   * usually the one the script was compiled with. A delta contains no code,
+   * so it is much smaller than a code cache and does not depend on the V8
+   * version or flags. The CachedData returned by this function should be
+   * owned by the caller.
+   */
+  static CachedData* CreateCodeCacheDelta(Local<UnboundScript> unbound_script,
+                                          CachedData* base_cache = nullptr);
+
+  /**
+   * Compiles the functions of the specified unbound_script listed in delta,
+   * which was produced by CreateCodeCacheDelta for the same source. Calling
+   * CreateCodeCache afterwards updates a code cache with the functions that
+   * were compiled in the runs the deltas came from. Returns false and sets
+   * delta->rejected if the delta does not match the script.
+   */
+  static bool ConsumeCodeCacheDelta(Local<UnboundScript> unbound_script,
+                                    CachedData* delta);
+
  private:
   static V8_WARN_UNUSED_RESULT MaybeLocal<UnboundScript> CompileUnboundInternal(
       Isolate* isolate, Source* source, CompileOptions options,
@@ -738,6 +816,19 @@ ScriptCompiler::Source::Source(Local<String> string, CachedData* data,
       cached_data(data),
       consume_cache_task(consume_cache_task) {}
 
+ScriptCompiler::Source::Source(Local<String> string, const ScriptOrigin& origin,
+                               CompileHintCallback callback,
+                               void* callback_data)
+    : source_string(string),
+      resource_name(origin.ResourceName()),
+      resource_line_offset(origin.LineOffset()),
+      resource_column_offset(origin.ColumnOffset()),
+      resource_options(origin.Options()),
+      source_map_url(origin.SourceMapUrl()),
+      host_defined_options(origin.HostDefinedOptions()),
+      compile_hint_callback(callback),
+      compile_hint_callback_data(callback_data) {}
+
 const ScriptCompiler::CachedData* ScriptCompiler::Source::GetCachedData()
     const {
   return cached_data.get();
@@ -133,6 +133,13 @@ class V8_EXPORT HeapStatistics {
   size_t number_of_native_contexts() { return number_of_native_contexts_; }
   size_t number_of_detached_contexts() { return number_of_detached_contexts_; }
 
+  /**
+   * Returns the number of hidden classes (maps) on the heap, excluding the
+   * read-only ones. Maps that died since the last garbage collection are
+   * included until they are swept.
+   */
+  size_t number_of_maps() { return number_of_maps_; }
+
   /**
    * Returns a 0/1 boolean, which signifies whether the V8 overwrite heap
    * garbage with a bit pattern.
@@ -152,6 +159,7 @@ class V8_EXPORT HeapStatistics {
   bool does_zap_garbage_;
   size_t number_of_native_contexts_;
   size_t number_of_detached_contexts_;
+  size_t number_of_maps_;
   size_t total_global_handles_size_;
   size_t used_global_handles_size_;
 
@@ -167,6 +175,14 @@ class V8_EXPORT HeapSpaceStatistics {
   size_t space_used_size() { return space_used_size_; }
   size_t space_available_size() { return space_available_size_; }
   size_t physical_space_size() { return physical_space_size_; }
+  /**
+   * The size of the largest free block of the space. Compared to
+   * space_available_size() it tells how fragmented the free memory is. It is
+   * zero for spaces that do not allocate from a free list.
+   */
+  size_t space_largest_free_block_size() {
+    return space_largest_free_block_size_;
+  }
 
  private:
   const char* space_name_;
@@ -174,6 +190,7 @@ class V8_EXPORT HeapSpaceStatistics {
   size_t space_used_size_;
   size_t space_available_size_;
   size_t physical_space_size_;
+  size_t space_largest_free_block_size_;
 
   friend class Isolate;
 };
@@ -201,11 +218,25 @@ class V8_EXPORT HeapCodeStatistics {
   size_t code_and_metadata_size() { return code_and_metadata_size_; }
   size_t bytecode_and_metadata_size() { return bytecode_and_metadata_size_; }
   size_t external_script_source_size() { return external_script_source_size_; }
+  /**
+   * The number of bytes of the code range, including the remapped embedded
+   * builtins, that are backed by huge pages (see --huge-code-pages).
+   */
+  size_t huge_page_code_range_size() { return huge_page_code_range_size_; }
+  /**
+   * The number of functions whose bytecode has been flushed, and the number
+   * of those that had to be compiled again afterwards.
+   */
+  size_t flushed_bytecode_count() { return flushed_bytecode_count_; }
+  size_t recompiled_bytecode_count() { return recompiled_bytecode_count_; }
 
  private:
   size_t code_and_metadata_size_;
   size_t bytecode_and_metadata_size_;
   size_t external_script_source_size_;
+  size_t huge_page_code_range_size_;
+  size_t flushed_bytecode_count_;
+  size_t recompiled_bytecode_count_;
 
   friend class Isolate;
 };
@@ -784,6 +784,15 @@ class V8_EXPORT ObjectTemplate : public Template {
   /** Creates a new instance of this template.*/
   V8_WARN_UNUSED_RESULT MaybeLocal<Object> NewInstance(Local<Context> context);
 
+  /**
+   * Creates a new instance of this template and sets its internal fields
+   * 0 to |count| - 1 to the aligned pointers in |values|. This is equivalent
+   * to calling NewInstance() followed by SetAlignedPointerInInternalFields()
+   * but saves the second API call when creating many wrapper objects.
+   */
+  V8_WARN_UNUSED_RESULT MaybeLocal<Object> NewInstanceWithInternalFields(
+      Local<Context> context, int count, void* const values[]);
+
   /**
    * Sets an accessor on the object template.
    *
@@ -67,6 +67,23 @@ class V8_EXPORT ValueSerializer {
 
     virtual Maybe<uint32_t> GetWasmModuleTransferId(
         Isolate* isolate, Local<WasmModuleObject> module);
+
+    /**
+     * Called when the ValueSerializer is going to serialize an external string
+     * (see String::IsExternal). The embedder may write an ID for the string to
+     * |id| and return Just(true), in which case the characters are not copied
+     * into the buffer. When deserializing, this ID will be passed to
+     * ValueDeserializer::Delegate::GetExternalStringFromId, which is expected
+     * to return a string with the same contents, e.g. an external string
+     * sharing the same resource. Keeping the characters alive until then is
+     * up to the embedder.
+     *
+     * The default implementation returns Just(false), i.e. the characters are
+     * copied. If an exception is thrown, Nothing<bool>() should be returned.
+     */
+    virtual Maybe<bool> GetExternalStringId(Isolate* isolate,
+                                            Local<String> string,
+                                            uint32_t* id);
     /**
      * Allocates memory for the buffer of at least the size provided. The actual
      * size (which may be greater or equal) is written to |actual_size|. If no
@@ -177,6 +194,13 @@ class V8_EXPORT ValueDeserializer {
      */
     virtual MaybeLocal<SharedArrayBuffer> GetSharedArrayBufferFromId(
         Isolate* isolate, uint32_t clone_id);
+
+    /**
+     * Get a string given an id previously provided by
+     * ValueSerializer::Delegate::GetExternalStringId.
+     */
+    virtual MaybeLocal<String> GetExternalStringFromId(Isolate* isolate,
+                                                       uint32_t id);
   };
 
   ValueDeserializer(Isolate* isolate, const uint8_t* data, size_t size);
@@ -182,6 +182,14 @@ class V8_EXPORT WasmStreaming final {
    */
   void SetUrl(const char* url, size_t length);
 
+  /**
+   * Announces the total size of the module bytes, e.g. from a Content-Length
+   * header. This must be called before {OnBytesReceived}. If the module turns
+   * out to have exactly that size, the received bytes are assembled in place
+   * and are not copied again when streaming finishes.
+   */
+  void SetExpectedSize(size_t size);
+
   /**
    * Unpacks a {WasmStreaming} object wrapped in a  {Managed} for the embedder.
    * Since the embedder is on the other side of the API, it cannot unpack the
@@ -256,10 +256,15 @@ void CopySmiElementsToTypedBuffer(T* dst, uint32_t length,
 template <typename T>
 void CopyDoubleElementsToTypedBuffer(T* dst, uint32_t length,
                                      i::FixedDoubleArray elements) {
+  if (std::is_same<T, double>::value) {
+    // Packed double elements have no holes, so they can be copied as is.
+    i::Address data =
+        elements.address() + i::FixedDoubleArray::OffsetOfElementAt(0);
+    i::MemCopy(dst, reinterpret_cast<void*>(data), length * sizeof(double));
+    return;
+  }
   for (uint32_t i = 0; i < length; ++i) {
     double value = elements.get_scalar(static_cast<int>(i));
-    // TODO(mslekova): There are certain cases, e.g. double->double, in which
-    // we could do a memcpy directly.
     dst[i] = i::ConvertDouble<T>(value);
   }
 }
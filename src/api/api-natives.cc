@@ -389,13 +389,35 @@ bool IsSimpleInstantiation(Isolate* isolate, ObjectTemplateInfo info,
   return fun.context().native_context() == isolate->raw_native_context();
 }
 
+// Whether instances of |info| get neither properties nor accessors, so that
+// they are plain objects of the constructor's initial map.
+bool HasNoInstanceProperties(Isolate* isolate, ObjectTemplateInfo info) {
+  DisallowGarbageCollection no_gc;
+  Object property_list = info.property_list();
+  if (!property_list.IsUndefined(isolate) &&
+      TemplateList::cast(property_list).length() > 0) {
+    return false;
+  }
+  for (; !info.is_null(); info = info.GetParent(isolate)) {
+    Object accessors = info.property_accessors();
+    if (!accessors.IsUndefined(isolate) &&
+        TemplateList::cast(accessors).length() > 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
 MaybeHandle<JSObject> InstantiateObject(Isolate* isolate,
                                         Handle<ObjectTemplateInfo> info,
                                         Handle<JSReceiver> new_target,
                                         bool is_prototype) {
   RCS_SCOPE(isolate, RuntimeCallCounterId::kInstantiateObject);
   Handle<JSFunction> constructor;
-  bool should_cache = info->should_cache();
+  // Allocating an instance of an empty template from the initial map is
+  // cheaper than probing the cache and copying the cached instance.
+  bool should_cache =
+      info->should_cache() && !HasNoInstanceProperties(isolate, *info);
   if (!new_target.is_null()) {
     if (IsSimpleInstantiation(isolate, *info, *new_target)) {
       constructor = Handle<JSFunction>::cast(new_target);
@@ -57,14 +57,19 @@
 #include "src/execution/vm-state-inl.h"
 #include "src/handles/global-handles.h"
 #include "src/handles/persistent-handles.h"
+#include "src/heap/bytecode-flushing-policy.h"
+#include "src/heap/code-range.h"
+#include "src/heap/context-allocation-tracker.h"
 #include "src/heap/embedder-tracing.h"
 #include "src/heap/heap-inl.h"
 #include "src/init/bootstrapper.h"
 #include "src/init/icu_util.h"
+#include "src/init/isolate-pool.h"
 #include "src/init/startup-data-util.h"
 #include "src/init/v8.h"
 #include "src/json/json-parser.h"
 #include "src/json/json-stringifier.h"
+#include "src/json/json-utf8-buffer.h"
 #include "src/logging/counters-scopes.h"
 #include "src/logging/metrics.h"
 #include "src/logging/runtime-call-stats-scope.h"
@@ -72,8 +77,10 @@
 #include "src/numbers/conversions-inl.h"
 #include "src/objects/api-callbacks.h"
 #include "src/objects/contexts.h"
+#include "src/objects/descriptor-array-inl.h"
 #include "src/objects/embedder-data-array-inl.h"
 #include "src/objects/embedder-data-slot-inl.h"
+#include "src/objects/field-type.h"
 #include "src/objects/hash-table-inl.h"
 #include "src/objects/heap-object.h"
 #include "src/objects/js-array-buffer-inl.h"
@@ -112,10 +119,13 @@
 #include "src/security/vm-cage.h"
 #include "src/snapshot/code-serializer.h"
 #include "src/snapshot/embedded/embedded-data.h"
+#include "src/snapshot/code-cache-delta.h"
+#include "src/snapshot/preparse-data-cache.h"
 #include "src/snapshot/snapshot.h"
 #include "src/snapshot/startup-serializer.h"  // For SerializedHandleChecker.
 #include "src/strings/char-predicates-inl.h"
 #include "src/strings/string-hasher.h"
+#include "src/strings/unicode-decoder.h"
 #include "src/strings/unicode-inl.h"
 #include "src/tracing/trace-event.h"
 #include "src/utils/detachable-vector.h"
@@ -2133,6 +2143,23 @@ Local<UnboundScript> Script::GetUnboundScript() {
   return ToApiHandle<UnboundScript>(i::handle(sfi, isolate));
 }
 
+std::vector<int> Script::GetProducedCompileHints() const {
+  i::DisallowGarbageCollection no_gc;
+  i::Handle<i::Object> obj = Utils::OpenHandle(this);
+  i::SharedFunctionInfo toplevel = i::JSFunction::cast(*obj).shared();
+  i::Isolate* isolate = toplevel.GetIsolate();
+  i::HandleScope scope(isolate);
+  std::vector<int> result;
+  if (!toplevel.script().IsScript()) return result;
+  i::SharedFunctionInfo::ScriptIterator it(isolate,
+                                           i::Script::cast(toplevel.script()));
+  for (i::SharedFunctionInfo sfi = it.Next(); !sfi.is_null(); sfi = it.Next()) {
+    if (sfi.is_toplevel() || !sfi.is_compiled()) continue;
+    result.push_back(sfi.StartPosition());
+  }
+  return result;
+}
+
 // static
 Local<PrimitiveArray> PrimitiveArray::New(Isolate* v8_isolate, int length) {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
@@ -2492,6 +2519,9 @@ MaybeLocal<UnboundScript> ScriptCompiler::CompileUnboundInternal(
       isolate, source->resource_name, source->resource_line_offset,
       source->resource_column_offset, source->source_map_url,
       source->host_defined_options, source->resource_options);
+  script_details.compile_hint_callback = source->compile_hint_callback;
+  script_details.compile_hint_callback_data =
+      source->compile_hint_callback_data;
 
   i::MaybeHandle<i::SharedFunctionInfo> maybe_function_info;
   if (options == kConsumeCodeCache) {
@@ -2690,13 +2720,17 @@ MaybeLocal<Function> ScriptCompiler::CompileFunctionInContext(
 void ScriptCompiler::ScriptStreamingTask::Run() { data_->task->Run(); }
 
 ScriptCompiler::ScriptStreamingTask* ScriptCompiler::StartStreaming(
-    Isolate* v8_isolate, StreamedSource* source, v8::ScriptType type) {
+    Isolate* v8_isolate, StreamedSource* source, v8::ScriptType type,
+    CompileHintCallback compile_hint_callback,
+    void* compile_hint_callback_data) {
   if (!i::FLAG_script_streaming) return nullptr;
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
   ASSERT_NO_SCRIPT_NO_EXCEPTION(isolate);
   i::ScriptStreamingData* data = source->impl();
   std::unique_ptr<i::BackgroundCompileTask> task =
-      std::make_unique<i::BackgroundCompileTask>(data, isolate, type);
+      std::make_unique<i::BackgroundCompileTask>(data, isolate, type,
+                                                 compile_hint_callback,
+                                                 compile_hint_callback_data);
   data->task = std::move(task);
   return new ScriptCompiler::ScriptStreamingTask(data);
 }
@@ -2801,6 +2835,130 @@ ScriptCompiler::CachedData* ScriptCompiler::CreateCodeCache(
   return i::CodeSerializer::Serialize(shared);
 }
 
+// static
+ScriptCompiler::CachedData* ScriptCompiler::CreatePreparseDataCache(
+    Local<UnboundScript> unbound_script) {
+  i::Handle<i::SharedFunctionInfo> shared =
+      i::Handle<i::SharedFunctionInfo>::cast(
+          Utils::OpenHandle(*unbound_script));
+  i::Isolate* isolate = shared->GetIsolate();
+  ASSERT_NO_SCRIPT_NO_EXCEPTION(isolate);
+  DCHECK(shared->is_toplevel());
+  i::Handle<i::Script> script(i::Script::cast(shared->script()), isolate);
+  std::vector<uint8_t> data = i::PreparseDataCache::Serialize(isolate, script);
+  uint8_t* buffer = i::NewArray<uint8_t>(data.size());
+  i::MemCopy(buffer, data.data(), data.size());
+  return new CachedData(buffer, static_cast<int>(data.size()),
+                        CachedData::BufferOwned);
+}
+
+// static
+bool ScriptCompiler::ConsumePreparseDataCache(
+    Local<UnboundScript> unbound_script, CachedData* cached_data) {
+  i::Handle<i::SharedFunctionInfo> shared =
+      i::Handle<i::SharedFunctionInfo>::cast(
+          Utils::OpenHandle(*unbound_script));
+  i::Isolate* isolate = shared->GetIsolate();
+  ASSERT_NO_SCRIPT_NO_EXCEPTION(isolate);
+  DCHECK(shared->is_toplevel());
+  i::Handle<i::Script> script(i::Script::cast(shared->script()), isolate);
+  int restored = i::PreparseDataCache::Deserialize(
+      isolate, script,
+      base::Vector<const uint8_t>(cached_data->data, cached_data->length));
+  if (restored < 0) {
+    cached_data->rejected = true;
+    return false;
+  }
+  return true;
+}
+
+namespace {
+
+// Deserializes |cached_data| for the source of |script| without adding it to
+// the compilation cache. Returns the script of the deserialized code.
+i::MaybeHandle<i::Script> DeserializeCodeCacheForScript(
+    i::Isolate* isolate, i::Handle<i::Script> script,
+    ScriptCompiler::CachedData* cached_data) {
+  // AlignedCachedData takes care of pointer-aligning the data.
+  i::AlignedCachedData aligned_data(cached_data->data, cached_data->length);
+  i::Handle<i::String> source(i::String::cast(script->source()), isolate);
+  i::Handle<i::SharedFunctionInfo> result;
+  if (!i::CodeSerializer::Deserialize(isolate, &aligned_data, source,
+                                      script->origin_options())
+           .ToHandle(&result)) {
+    cached_data->rejected = true;
+    return i::MaybeHandle<i::Script>();
+  }
+  return i::handle(i::Script::cast(result->script()), isolate);
+}
+
+}  // namespace
+
+// static
+bool ScriptCompiler::MergeCodeCache(Local<UnboundScript> unbound_script,
+                                    CachedData* cached_data) {
+  i::Handle<i::SharedFunctionInfo> shared =
+      i::Handle<i::SharedFunctionInfo>::cast(
+          Utils::OpenHandle(*unbound_script));
+  i::Isolate* isolate = shared->GetIsolate();
+  // Compiling may throw a stack overflow, which is cleared again.
+  i::VMState<v8::OTHER> state(isolate);
+  i::HandleScope scope(isolate);
+  DCHECK(shared->is_toplevel());
+  i::Handle<i::Script> script(i::Script::cast(shared->script()), isolate);
+  i::Handle<i::Script> other;
+  if (!DeserializeCodeCacheForScript(isolate, script, cached_data)
+           .ToHandle(&other)) {
+    return false;
+  }
+  i::CodeCacheDelta::Merge(isolate, script, other);
+  return true;
+}
+
+// static
+ScriptCompiler::CachedData* ScriptCompiler::CreateCodeCacheDelta(
+    Local<UnboundScript> unbound_script, CachedData* base_cache) {
+  i::Handle<i::SharedFunctionInfo> shared =
+      i::Handle<i::SharedFunctionInfo>::cast(
+          Utils::OpenHandle(*unbound_script));
+  i::Isolate* isolate = shared->GetIsolate();
+  ASSERT_NO_SCRIPT_NO_EXCEPTION(isolate);
+  DCHECK(shared->is_toplevel());
+  i::HandleScope scope(isolate);
+  i::Handle<i::Script> script(i::Script::cast(shared->script()), isolate);
+  i::MaybeHandle<i::Script> base;
+  if (base_cache != nullptr) {
+    base = DeserializeCodeCacheForScript(isolate, script, base_cache);
+    if (base.is_null()) return nullptr;
+  }
+  std::vector<uint8_t> data =
+      i::CodeCacheDelta::Serialize(isolate, script, base);
+  uint8_t* buffer = i::NewArray<uint8_t>(data.size());
+  i::MemCopy(buffer, data.data(), data.size());
+  return new CachedData(buffer, static_cast<int>(data.size()),
+                        CachedData::BufferOwned);
+}
+
+// static
+bool ScriptCompiler::ConsumeCodeCacheDelta(Local<UnboundScript> unbound_script,
+                                           CachedData* delta) {
+  i::Handle<i::SharedFunctionInfo> shared =
+      i::Handle<i::SharedFunctionInfo>::cast(
+          Utils::OpenHandle(*unbound_script));
+  i::Isolate* isolate = shared->GetIsolate();
+  i::VMState<v8::OTHER> state(isolate);
+  i::HandleScope scope(isolate);
+  DCHECK(shared->is_toplevel());
+  i::Handle<i::Script> script(i::Script::cast(shared->script()), isolate);
+  int compiled = i::CodeCacheDelta::Apply(
+      isolate, script, base::Vector<const uint8_t>(delta->data, delta->length));
+  if (compiled < 0) {
+    delta->rejected = true;
+    return false;
+  }
+  return true;
+}
+
 ScriptCompiler::CachedData* ScriptCompiler::CreateCodeCacheForFunction(
     Local<Function> function) {
   auto js_function =
@@ -3243,6 +3401,23 @@ MaybeLocal<Value> JSON::Parse(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+JSON::Utf8Source::Utf8Source() : impl_(new i::JsonUtf8Buffer()) {}
+
+JSON::Utf8Source::~Utf8Source() = default;
+
+void JSON::Utf8Source::Append(const char* data, size_t length) {
+  impl_->Append(reinterpret_cast<const uint8_t*>(data), length);
+}
+
+MaybeLocal<Value> JSON::Parse(Local<Context> context, Utf8Source* source) {
+  PREPARE_FOR_EXECUTION(context, JSON, Parse, Value);
+  Local<Value> result;
+  has_pending_exception =
+      !ToLocal<Value>(source->impl()->Parse(isolate), &result);
+  RETURN_ON_FAILED_EXECUTION(Value);
+  RETURN_ESCAPED(result);
+}
+
 MaybeLocal<String> JSON::Stringify(Local<Context> context,
                                    Local<Value> json_object,
                                    Local<String> gap) {
@@ -3288,6 +3463,11 @@ Maybe<uint32_t> ValueSerializer::Delegate::GetWasmModuleTransferId(
   return Nothing<uint32_t>();
 }
 
+Maybe<bool> ValueSerializer::Delegate::GetExternalStringId(
+    Isolate* v8_isolate, Local<String> string, uint32_t* id) {
+  return Just(false);
+}
+
 void* ValueSerializer::Delegate::ReallocateBufferMemory(void* old_buffer,
                                                         size_t size,
                                                         size_t* actual_size) {
@@ -3387,6 +3567,15 @@ ValueDeserializer::Delegate::GetSharedArrayBufferFromId(Isolate* v8_isolate,
   return MaybeLocal<SharedArrayBuffer>();
 }
 
+MaybeLocal<String> ValueDeserializer::Delegate::GetExternalStringFromId(
+    Isolate* v8_isolate, uint32_t id) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  isolate->ScheduleThrow(*isolate->factory()->NewError(
+      isolate->error_function(),
+      i::MessageTemplate::kDataCloneDeserializationError));
+  return MaybeLocal<String>();
+}
+
 struct ValueDeserializer::PrivateData {
   PrivateData(i::Isolate* i, base::Vector<const uint8_t> data,
               Delegate* delegate)
@@ -4232,6 +4421,73 @@ Maybe<bool> v8::Object::Set(v8::Local<v8::Context> context, uint32_t index,
   return Just(true);
 }
 
+namespace {
+
+// Finds the own data field |name| of |receiver| if it is a fast-mode object
+// without interceptors or access checks. The descriptor is looked up through
+// the isolate's DescriptorLookupCache, so accessing the same names on many
+// objects of the same map searches each descriptor array only once.
+bool LookupOwnDataField(i::Isolate* isolate, i::JSReceiver receiver,
+                        i::Name name, i::InternalIndex* descriptor,
+                        i::PropertyDetails* details) {
+  if (!receiver.IsJSObject()) return false;
+  i::Map map = receiver.map();
+  if (map.IsSpecialReceiverMap() || map.is_dictionary_map() ||
+      map.is_deprecated()) {
+    return false;
+  }
+  i::DescriptorArray descriptors = map.instance_descriptors(isolate);
+  i::InternalIndex index = descriptors.SearchWithCache(isolate, name, map);
+  if (index.is_not_found()) return false;
+  i::PropertyDetails result = descriptors.GetDetails(index);
+  if (result.location() != i::PropertyLocation::kField ||
+      result.kind() != i::kData) {
+    return false;
+  }
+  *descriptor = index;
+  *details = result;
+  return true;
+}
+
+}  // namespace
+
+Maybe<bool> v8::Object::SetMultiple(v8::Local<v8::Context> context,
+                                    const Local<Name> keys[],
+                                    const Local<Value> values[],
+                                    size_t count) {
+  auto isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  ENTER_V8(isolate, context, Object, SetMultiple, Nothing<bool>(),
+           i::HandleScope);
+  auto self = Utils::OpenHandle(this);
+  for (size_t i = 0; i < count; ++i) {
+    i::Handle<i::Name> key =
+        isolate->factory()->InternalizeName(Utils::OpenHandle(*keys[i]));
+    i::Handle<i::Object> value = Utils::OpenHandle(*values[i]);
+    i::InternalIndex descriptor = i::InternalIndex::NotFound();
+    i::PropertyDetails details = i::PropertyDetails::Empty();
+    // Mutable fields whose representation and field type already admit the
+    // value are written directly; everything else may need a map transition.
+    if (LookupOwnDataField(isolate, *self, *key, &descriptor, &details) &&
+        !details.IsReadOnly() &&
+        details.constness() == i::PropertyConstness::kMutable &&
+        value->FitsRepresentation(details.representation()) &&
+        self->map()
+            .instance_descriptors(isolate)
+            .GetFieldType(descriptor)
+            .NowContains(*value)) {
+      i::JSObject::cast(*self).WriteToField(descriptor, details, *value);
+      continue;
+    }
+    has_pending_exception =
+        i::Runtime::SetObjectProperty(isolate, self, key, value,
+                                      i::StoreOrigin::kNamed,
+                                      Just(i::ShouldThrow::kDontThrow))
+            .is_null();
+    RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+  }
+  return Just(true);
+}
+
 Maybe<bool> v8::Object::CreateDataProperty(v8::Local<v8::Context> context,
                                            v8::Local<Name> key,
                                            v8::Local<Value> value) {
@@ -4481,6 +4737,44 @@ MaybeLocal<Value> v8::Object::Get(Local<Context> context, uint32_t index) {
   RETURN_ESCAPED(Utils::ToLocal(result));
 }
 
+Maybe<bool> v8::Object::GetMultiple(Local<Context> context,
+                                    const Local<Name> keys[], size_t count,
+                                    Local<Value> values[]) {
+  auto isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  // The results live in the caller's HandleScope. Their handles are created
+  // upfront and patched below, so that the lookups can use a scope of their
+  // own.
+  std::vector<i::Handle<i::Object>> results;
+  results.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    results.push_back(
+        i::handle(i::ReadOnlyRoots(isolate).undefined_value(), isolate));
+    values[i] = Utils::ToLocal(results.back());
+  }
+  ENTER_V8(isolate, context, Object, GetMultiple, Nothing<bool>(),
+           i::HandleScope);
+  auto self = Utils::OpenHandle(this);
+  for (size_t i = 0; i < count; ++i) {
+    i::Handle<i::Name> key =
+        isolate->factory()->InternalizeName(Utils::OpenHandle(*keys[i]));
+    i::InternalIndex descriptor = i::InternalIndex::NotFound();
+    i::PropertyDetails details = i::PropertyDetails::Empty();
+    i::Handle<i::Object> result;
+    if (LookupOwnDataField(isolate, *self, *key, &descriptor, &details)) {
+      i::Handle<i::JSObject> object = i::Handle<i::JSObject>::cast(self);
+      result = i::JSObject::FastPropertyAt(
+          object, details.representation(),
+          i::FieldIndex::ForDescriptor(object->map(), descriptor));
+    } else {
+      has_pending_exception =
+          !i::Runtime::GetObjectProperty(isolate, self, key).ToHandle(&result);
+      RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+    }
+    results[i].PatchValue(*result);
+  }
+  return Just(true);
+}
+
 MaybeLocal<Value> v8::Object::GetPrivate(Local<Context> context,
                                          Local<Private> key) {
   return Get(context, Local<Value>(reinterpret_cast<Value*>(*key)));
@@ -5506,21 +5800,20 @@ static int WriteUtf8Impl(base::Vector<const Char> string, char* write_start,
     }
     // Write the characters to the stream.
     if (sizeof(Char) == 1) {
-      // Simply memcpy if we only have ASCII characters.
-      uint8_t char_mask = 0;
-      for (int i = read_index; i < up_to; i++) char_mask |= read_start[i];
-      if ((char_mask & 0x80) == 0) {
-        int copy_length = up_to - read_index;
+      // Simply memcpy runs of ASCII characters, and encode the characters in
+      // between them one at a time.
+      while (read_index < up_to) {
+        int copy_length = i::NonAsciiStart(
+            reinterpret_cast<const uint8_t*>(read_start + read_index),
+            up_to - read_index);
         memcpy(current_write, read_start + read_index, copy_length);
         current_write += copy_length;
-        read_index = up_to;
-      } else {
-        for (; read_index < up_to; read_index++) {
-          current_write += unibrow::Utf8::EncodeOneByte(
-              current_write, static_cast<uint8_t>(read_start[read_index]));
-          DCHECK(write_capacity == -1 ||
-                 (current_write - write_start) <= write_capacity);
-        }
+        read_index += copy_length;
+        if (read_index == up_to) break;
+        current_write += unibrow::Utf8::EncodeOneByte(
+            current_write, static_cast<uint8_t>(read_start[read_index++]));
+        DCHECK(write_capacity == -1 ||
+               (current_write - write_start) <= write_capacity);
       }
     } else {
       for (; read_index < up_to; read_index++) {
@@ -6071,14 +6364,16 @@ HeapStatistics::HeapStatistics()
       peak_malloced_memory_(0),
       does_zap_garbage_(false),
       number_of_native_contexts_(0),
-      number_of_detached_contexts_(0) {}
+      number_of_detached_contexts_(0),
+      number_of_maps_(0) {}
 
 HeapSpaceStatistics::HeapSpaceStatistics()
     : space_name_(nullptr),
       space_size_(0),
       space_used_size_(0),
       space_available_size_(0),
-      physical_space_size_(0) {}
+      physical_space_size_(0),
+      space_largest_free_block_size_(0) {}
 
 HeapObjectStatistics::HeapObjectStatistics()
     : object_type_(nullptr),
@@ -6089,7 +6384,10 @@ HeapObjectStatistics::HeapObjectStatistics()
 HeapCodeStatistics::HeapCodeStatistics()
     : code_and_metadata_size_(0),
       bytecode_and_metadata_size_(0),
-      external_script_source_size_(0) {}
+      external_script_source_size_(0),
+      huge_page_code_range_size_(0),
+      flushed_bytecode_count_(0),
+      recompiled_bytecode_count_(0) {}
 
 bool v8::V8::InitializeICU(const char* icu_data_file) {
   return i::InitializeICU(icu_data_file);
@@ -6566,6 +6864,32 @@ MaybeLocal<v8::Object> ObjectTemplate::NewInstance(Local<Context> context) {
   RETURN_ESCAPED(result);
 }
 
+MaybeLocal<v8::Object> ObjectTemplate::NewInstanceWithInternalFields(
+    Local<Context> context, int count, void* const values[]) {
+  PREPARE_FOR_EXECUTION(context, ObjectTemplate,
+                        NewInstanceWithInternalFields, Object);
+  auto self = Utils::OpenHandle(this);
+  i::Handle<i::JSObject> result;
+  has_pending_exception =
+      !i::ApiNatives::InstantiateObject(isolate, self).ToHandle(&result);
+  RETURN_ON_FAILED_EXECUTION(Object);
+  const char* location = "v8::ObjectTemplate::NewInstanceWithInternalFields()";
+  if (!Utils::ApiCheck(count <= result->GetEmbedderFieldCount(), location,
+                       "Internal field out of bounds")) {
+    return MaybeLocal<Object>();
+  }
+  {
+    i::DisallowGarbageCollection no_gc;
+    i::JSObject raw_result = *result;
+    for (int i = 0; i < count; i++) {
+      Utils::ApiCheck(i::EmbedderDataSlot(raw_result, i)
+                          .store_aligned_pointer(isolate, values[i]),
+                      location, "Unaligned pointer");
+    }
+  }
+  RETURN_ESCAPED(Utils::ToLocal(result));
+}
+
 void v8::ObjectTemplate::CheckCast(Data* that) {
   i::Handle<i::Object> obj = Utils::OpenHandle(that);
   Utils::ApiCheck(obj->IsObjectTemplateInfo(), "v8::ObjectTemplate::Cast",
@@ -8555,6 +8879,24 @@ void Isolate::Dispose() {
   i::Isolate::Delete(isolate);
 }
 
+// static
+std::unique_ptr<IsolatePool> IsolatePool::New(
+    const Isolate::CreateParams& params, size_t size) {
+  return std::unique_ptr<IsolatePool>(
+      new IsolatePool(std::make_unique<i::IsolatePool>(params, size)));
+}
+
+IsolatePool::IsolatePool(std::unique_ptr<i::IsolatePool> impl)
+    : impl_(std::move(impl)) {}
+
+IsolatePool::~IsolatePool() = default;
+
+Isolate* IsolatePool::Acquire() { return impl_->Acquire(); }
+
+void IsolatePool::Release(Isolate* isolate) { impl_->Release(isolate); }
+
+size_t IsolatePool::ReadyCount() const { return impl_->ReadyCount(); }
+
 void Isolate::DumpAndResetStats() {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
   isolate->DumpAndResetStats();
@@ -8742,6 +9084,7 @@ void Isolate::GetHeapStatistics(HeapStatistics* heap_statistics) {
   heap_statistics->number_of_native_contexts_ = heap->NumberOfNativeContexts();
   heap_statistics->number_of_detached_contexts_ =
       heap->NumberOfDetachedContexts();
+  heap_statistics->number_of_maps_ = heap->NumberOfMaps();
   heap_statistics->does_zap_garbage_ = heap->ShouldZapGarbage();
 
 #if V8_ENABLE_WEBASSEMBLY
@@ -8775,12 +9118,14 @@ bool Isolate::GetHeapSpaceStatistics(HeapSpaceStatistics* space_statistics,
       space_statistics->space_used_size_ = 0;
       space_statistics->space_available_size_ = 0;
       space_statistics->physical_space_size_ = 0;
+      space_statistics->space_largest_free_block_size_ = 0;
     } else {
       i::ReadOnlySpace* space = heap->read_only_space();
       space_statistics->space_size_ = space->CommittedMemory();
       space_statistics->space_used_size_ = space->Size();
       space_statistics->space_available_size_ = 0;
       space_statistics->physical_space_size_ = space->CommittedPhysicalMemory();
+      space_statistics->space_largest_free_block_size_ = 0;
     }
   } else {
     i::Space* space = heap->space(static_cast<int>(index));
@@ -8789,6 +9134,13 @@ bool Isolate::GetHeapSpaceStatistics(HeapSpaceStatistics* space_statistics,
     space_statistics->space_available_size_ = space ? space->Available() : 0;
     space_statistics->physical_space_size_ =
         space ? space->CommittedPhysicalMemory() : 0;
+    space_statistics->space_largest_free_block_size_ = 0;
+    if (space && (allocation_space == i::OLD_SPACE ||
+                  allocation_space == i::CODE_SPACE ||
+                  allocation_space == i::MAP_SPACE)) {
+      space_statistics->space_largest_free_block_size_ =
+          heap->paged_space(allocation_space)->LargestFreeBlock();
+    }
   }
   return true;
 }
@@ -8838,6 +9190,14 @@ bool Isolate::GetHeapCodeAndMetadataStatistics(
       isolate->bytecode_and_metadata_size();
   code_statistics->external_script_source_size_ =
       isolate->external_script_source_size();
+  i::CodeRange* code_range = isolate->heap()->code_range();
+  code_statistics->huge_page_code_range_size_ =
+      code_range ? code_range->huge_page_size() : 0;
+  i::BytecodeFlushingPolicy* flushing_policy =
+      isolate->heap()->bytecode_flushing_policy();
+  code_statistics->flushed_bytecode_count_ = flushing_policy->flushed_count();
+  code_statistics->recompiled_bytecode_count_ =
+      flushing_policy->recompiled_count();
   return true;
 }
 
@@ -8847,6 +9207,27 @@ bool Isolate::MeasureMemory(std::unique_ptr<MeasureMemoryDelegate> delegate,
   return isolate->heap()->MeasureMemory(std::move(delegate), execution);
 }
 
+void Isolate::SetContextAllocationLimit(Local<Context> context,
+                                        size_t limit_in_bytes,
+                                        ContextAllocationLimitCallback callback,
+                                        void* data) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  i::Handle<i::NativeContext> native_context =
+      handle(Utils::OpenHandle(*context)->native_context(), isolate);
+  isolate->heap()->EnsureContextAllocationTracker()->SetLimit(
+      native_context, limit_in_bytes, callback, data);
+}
+
+size_t Isolate::GetContextAllocatedBytes(Local<Context> context) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  i::ContextAllocationTracker* tracker =
+      isolate->heap()->context_allocation_tracker();
+  if (tracker == nullptr) return 0;
+  i::Handle<i::NativeContext> native_context =
+      handle(Utils::OpenHandle(*context)->native_context(), isolate);
+  return tracker->AllocatedBytes(native_context);
+}
+
 std::unique_ptr<MeasureMemoryDelegate> MeasureMemoryDelegate::Default(
     Isolate* isolate, Local<Context> context,
     Local<Promise::Resolver> promise_resolver, MeasureMemoryMode mode) {
@@ -9029,6 +9410,11 @@ void Isolate::SetAddCrashKeyCallback(AddCrashKeyCallback callback) {
   isolate->SetAddCrashKeyCallback(callback);
 }
 
+void Isolate::SetDeoptimizationCallback(DeoptimizationCallback callback) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->set_deoptimization_callback(callback);
+}
+
 bool Isolate::IdleNotificationDeadline(double deadline_in_seconds) {
   // Returning true tells the caller that it need not
   // continue to call IdleNotification.
@@ -9344,6 +9730,11 @@ void Isolate::SetAllowAtomicsWait(bool allow) {
   isolate->set_allow_atomics_wait(allow);
 }
 
+void Isolate::SetConcurrentBaselineCompilation(bool enabled) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->baseline_batch_compiler()->set_concurrent(enabled);
+}
+
 void v8::Isolate::DateTimeConfigurationChangeNotification(
     TimeZoneDetection time_zone_detection) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
@@ -9703,6 +10094,10 @@ int64_t CpuProfile::GetEndTime() const {
   return profile->end_time().since_origin().InMicroseconds();
 }
 
+unsigned CpuProfile::GetDroppedSamplesCount() const {
+  return reinterpret_cast<const i::CpuProfile*>(this)->dropped_samples_count();
+}
+
 int CpuProfile::GetSamplesCount() const {
   return reinterpret_cast<const i::CpuProfile*>(this)->samples_count();
 }
@@ -9785,6 +10180,21 @@ CpuProfile* CpuProfiler::StopProfiling(Local<String> title) {
           *Utils::OpenHandle(*title)));
 }
 
+CpuProfilingStatus CpuProfiler::StartStreaming() {
+  return reinterpret_cast<i::CpuProfiler*>(this)->StartStreaming();
+}
+
+void CpuProfiler::StopStreaming() {
+  reinterpret_cast<i::CpuProfiler*>(this)->StopStreaming();
+}
+
+void CpuProfiler::DrainStreamedSamples(
+    std::vector<CpuProfileStreamFunction>* functions,
+    std::vector<CpuProfileStreamStack>* stacks) {
+  reinterpret_cast<i::CpuProfiler*>(this)->DrainStreamedSamples(functions,
+                                                                stacks);
+}
+
 void CpuProfiler::UseDetailedSourcePositionsForProfiling(Isolate* isolate) {
   reinterpret_cast<i::Isolate*>(isolate)
       ->SetDetailedSourcePositionsForProfiling(true);
@@ -10247,6 +10657,8 @@ void WasmStreaming::SetClient(std::shared_ptr<Client> client) { UNREACHABLE(); }
 
 void WasmStreaming::SetUrl(const char* url, size_t length) { UNREACHABLE(); }
 
+void WasmStreaming::SetExpectedSize(size_t size) { UNREACHABLE(); }
+
 // static
 std::shared_ptr<WasmStreaming> WasmStreaming::Unpack(Isolate* isolate,
                                                      Local<Value> value) {
@@ -10521,6 +10933,24 @@ bool V8_EXPORT V8_WARN_UNUSED_RESULT TryToCopyAndConvertArrayToCppBuffer<
       double>(src, dst, max_length);
 }
 
+bool V8_EXPORT V8_WARN_UNUSED_RESULT TryToGetPackedDoubleArrayView(
+    Local<Array> src, FastApiTypedArray<double>* view) {
+  i::DisallowGarbageCollection no_gc;
+  i::JSArray obj = *reinterpret_cast<i::JSArray*>(*src);
+  if (obj.GetElementsKind() != i::PACKED_DOUBLE_ELEMENTS ||
+      obj.IterationHasObservableEffects()) {
+    return false;
+  }
+  uint32_t length = src->Length();
+  view->length_ = length;
+  // An empty array may not have a FixedDoubleArray backing store.
+  view->data_ = length == 0 ? nullptr
+                            : reinterpret_cast<void*>(
+                                  obj.elements().address() +
+                                  i::FixedDoubleArray::OffsetOfElementAt(0));
+  return true;
+}
+
 }  // namespace v8
 
 #undef TRACE_BS
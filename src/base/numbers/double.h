@@ -130,16 +130,9 @@ class Double {
   void NormalizedBoundaries(DiyFp* out_m_minus, DiyFp* out_m_plus) const {
     DCHECK_GT(value(), 0.0);
     DiyFp v = this->AsDiyFp();
-    bool significand_is_zero = (v.f() == kHiddenBit);
     DiyFp m_plus = DiyFp::Normalize(DiyFp((v.f() << 1) + 1, v.e() - 1));
     DiyFp m_minus;
-    if (significand_is_zero && v.e() != kDenormalExponent) {
-      // The boundary is closer. Think of v = 1000e10 and v- = 9999e9.
-      // Then the boundary (== (v - v-)/2) is not just at a distance of 1e9 but
-      // at a distance of 1e8.
-      // The only exception is for the smallest normal: the largest denormal is
-      // at the same distance as its successor.
-      // Note: denormals have the same exponent as the smallest normals.
+    if (LowerBoundaryIsCloser()) {
       m_minus = DiyFp((v.f() << 2) - 1, v.e() - 2);
     } else {
       m_minus = DiyFp((v.f() << 1) - 1, v.e() - 1);
@@ -150,6 +143,18 @@ class Double {
     *out_m_minus = m_minus;
   }
 
+  // Returns true if the lower boundary is closer than the upper one.
+  // Think of v = 1000e10 and v- = 9999e9: the lower boundary (== (v - v-)/2)
+  // is not just at a distance of 1e9 but at a distance of 1e8.
+  // The only exception is the smallest normal: the largest denormal is at
+  // the same distance as its successor.
+  // Note: denormals have the same exponent as the smallest normals.
+  // Precondition: the value encoded by this Double must be greater than 0.
+  bool LowerBoundaryIsCloser() const {
+    bool physical_significand_is_zero = ((AsUint64() & kSignificandMask) == 0);
+    return physical_significand_is_zero && (Exponent() != kDenormalExponent);
+  }
+
   double value() const { return uint64_to_double(d64_); }
 
   // Returns the significand size for a given order of magnitude.
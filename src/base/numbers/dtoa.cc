@@ -11,6 +11,7 @@
 #include "src/base/numbers/double.h"
 #include "src/base/numbers/fast-dtoa.h"
 #include "src/base/numbers/fixed-dtoa.h"
+#include "src/base/numbers/schubfach-dtoa.h"
 
 namespace v8 {
 namespace base {
@@ -54,11 +55,15 @@ void DoubleToAscii(double v, DtoaMode mode, int requested_digits,
     return;
   }
 
+  if (mode == DTOA_SHORTEST) {
+    // Schubfach always produces the shortest representation, without the
+    // bignum fallback that FastDtoa needs in about 0.5% of all cases.
+    SchubfachDtoa(v, buffer, length, point);
+    return;
+  }
+
   bool fast_worked;
   switch (mode) {
-    case DTOA_SHORTEST:
-      fast_worked = FastDtoa(v, FAST_DTOA_SHORTEST, 0, buffer, length, point);
-      break;
     case DTOA_FIXED:
       fast_worked = FastFixedDtoa(v, requested_digits, buffer, length, point);
       break;
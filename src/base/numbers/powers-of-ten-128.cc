@@ -0,0 +1,691 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/base/numbers/powers-of-ten-128.h"
+
+#include "src/base/logging.h"
+
+namespace v8 {
+namespace base {
+
+// clang-format off
+static const PowerOfTen128 kPowersOfTen128[] = {
+    {0xEEF4'53D6'923B'D65A, 0x113F'AA29'06A1'3B3F},  // 10^-342
+    {0x9558'B466'1B65'65F8, 0x4AC7'CA59'A424'C507},  // 10^-341
+    {0xBAAE'E17F'A23E'BF76, 0x5D79'BCF0'0D2D'F649},  // 10^-340
+    {0xE95A'99DF'8ACE'6F53, 0xF4D8'2C2C'1079'73DC},  // 10^-339
+    {0x91D8'A02B'B6C1'0594, 0x7907'1B9B'8A4B'E869},  // 10^-338
+    {0xB64E'C836'A471'46F9, 0x9748'E282'6CDE'E284},  // 10^-337
+    {0xE3E2'7A44'4D8D'98B7, 0xFD1B'1B23'0816'9B25},  // 10^-336
+    {0x8E6D'8C6A'B078'7F72, 0xFE30'F0F5'E50E'20F7},  // 10^-335
+    {0xB208'EF85'5C96'9F4F, 0xBDBD'2D33'5E51'A935},  // 10^-334
+    {0xDE8B'2B66'B3BC'4723, 0xAD2C'7880'35E6'1382},  // 10^-333
+    {0x8B16'FB20'3055'AC76, 0x4C3B'CB50'21AF'CC31},  // 10^-332
+    {0xADDC'B9E8'3C6B'1793, 0xDF4A'BE24'2A1B'BF3D},  // 10^-331
+    {0xD953'E862'4B85'DD78, 0xD71D'6DAD'34A2'AF0D},  // 10^-330
+    {0x87D4'713D'6F33'AA6B, 0x8672'648C'40E5'AD68},  // 10^-329
+    {0xA9C9'8D8C'CB00'9506, 0x680E'FDAF'511F'18C2},  // 10^-328
+    {0xD43B'F0EF'FDC0'BA48, 0x0212'BD1B'2566'DEF2},  // 10^-327
+    {0x84A5'7695'FE98'746D, 0x014B'B630'F760'4B57},  // 10^-326
+    {0xA5CE'D43B'7E3E'9188, 0x419E'A3BD'3538'5E2D},  // 10^-325
+    {0xCF42'894A'5DCE'35EA, 0x5206'4CAC'8286'75B9},  // 10^-324
+    {0x8189'95CE'7AA0'E1B2, 0x7343'EFEB'D194'0993},  // 10^-323
+    {0xA1EB'FB42'1949'1A1F, 0x1014'EBE6'C5F9'0BF8},  // 10^-322
+    {0xCA66'FA12'9F9B'60A6, 0xD41A'26E0'7777'4EF6},  // 10^-321
+    {0xFD00'B897'4782'38D0, 0x8920'B098'9555'22B4},  // 10^-320
+    {0x9E20'735E'8CB1'6382, 0x55B4'6E5F'5D55'35B0},  // 10^-319
+    {0xC5A8'9036'2FDD'BC62, 0xEB21'89F7'34AA'831D},  // 10^-318
+    {0xF712'B443'BBD5'2B7B, 0xA5E9'EC75'01D5'23E4},  // 10^-317
+    {0x9A6B'B0AA'5565'3B2D, 0x47B2'33C9'2125'366E},  // 10^-316
+    {0xC106'9CD4'EABE'89F8, 0x999E'C0BB'696E'840A},  // 10^-315
+    {0xF148'440A'256E'2C76, 0xC006'70EA'43CA'250D},  // 10^-314
+    {0x96CD'2A86'5764'DBCA, 0x3804'0692'6A5E'5728},  // 10^-313
+    {0xBC80'7527'ED3E'12BC, 0xC605'0837'04F5'ECF2},  // 10^-312
+    {0xEBA0'9271'E88D'976B, 0xF786'4A44'C633'682E},  // 10^-311
+    {0x9344'5B87'3158'7EA3, 0x7AB3'EE6A'FBE0'211D},  // 10^-310
+    {0xB815'7268'FDAE'9E4C, 0x5960'EA05'BAD8'2964},  // 10^-309
+    {0xE61A'CF03'3D1A'45DF, 0x6FB9'2487'298E'33BD},  // 10^-308
+    {0x8FD0'C162'0630'6BAB, 0xA5D3'B6D4'79F8'E056},  // 10^-307
+    {0xB3C4'F1BA'87BC'8696, 0x8F48'A489'9877'186C},  // 10^-306
+    {0xE0B6'2E29'29AB'A83C, 0x331A'CDAB'FE94'DE87},  // 10^-305
+    {0x8C71'DCD9'BA0B'4925, 0x9FF0'C08B'7F1D'0B14},  // 10^-304
+    {0xAF8E'5410'288E'1B6F, 0x07EC'F0AE'5EE4'4DD9},  // 10^-303
+    {0xDB71'E914'32B1'A24A, 0xC9E8'2CD9'F69D'6150},  // 10^-302
+    {0x8927'31AC'9FAF'056E, 0xBE31'1C08'3A22'5CD2},  // 10^-301
+    {0xAB70'FE17'C79A'C6CA, 0x6DBD'630A'48AA'F406},  // 10^-300
+    {0xD64D'3D9D'B981'787D, 0x092C'BBCC'DAD5'B108},  // 10^-299
+    {0x85F0'4682'93F0'EB4E, 0x25BB'F560'08C5'8EA5},  // 10^-298
+    {0xA76C'5823'38ED'2621, 0xAF2A'F2B8'0AF6'F24E},  // 10^-297
+    {0xD147'6E2C'0728'6FAA, 0x1AF5'AF66'0DB4'AEE1},  // 10^-296
+    {0x82CC'A4DB'8479'45CA, 0x50D9'8D9F'C890'ED4D},  // 10^-295
+    {0xA37F'CE12'6597'973C, 0xE50F'F107'BAB5'28A0},  // 10^-294
+    {0xCC5F'C196'FEFD'7D0C, 0x1E53'ED49'A962'72C8},  // 10^-293
+    {0xFF77'B1FC'BEBC'DC4F, 0x25E8'E89C'13BB'0F7A},  // 10^-292
+    {0x9FAA'CF3D'F736'09B1, 0x77B1'9161'8C54'E9AC},  // 10^-291
+    {0xC795'830D'7503'8C1D, 0xD59D'F5B9'EF6A'2417},  // 10^-290
+    {0xF97A'E3D0'D244'6F25, 0x4B05'7328'6B44'AD1D},  // 10^-289
+    {0x9BEC'CE62'836A'C577, 0x4EE3'67F9'430A'EC32},  // 10^-288
+    {0xC2E8'01FB'2445'76D5, 0x229C'41F7'93CD'A73F},  // 10^-287
+    {0xF3A2'0279'ED56'D48A, 0x6B43'5275'78C1'110F},  // 10^-286
+    {0x9845'418C'3456'44D6, 0x830A'1389'6B78'AAA9},  // 10^-285
+    {0xBE56'91EF'416B'D60C, 0x23CC'986B'C656'D553},  // 10^-284
+    {0xEDEC'366B'11C6'CB8F, 0x2CBF'BE86'B7EC'8AA8},  // 10^-283
+    {0x94B3'A202'EB1C'3F39, 0x7BF7'D714'32F3'D6A9},  // 10^-282
+    {0xB9E0'8A83'A5E3'4F07, 0xDAF5'CCD9'3FB0'CC53},  // 10^-281
+    {0xE858'AD24'8F5C'22C9, 0xD1B3'400F'8F9C'FF68},  // 10^-280
+    {0x9137'6C36'D999'95BE, 0x2310'0809'B9C2'1FA1},  // 10^-279
+    {0xB585'4744'8FFF'FB2D, 0xABD4'0A0C'2832'A78A},  // 10^-278
+    {0xE2E6'9915'B3FF'F9F9, 0x16C9'0C8F'323F'516C},  // 10^-277
+    {0x8DD0'1FAD'907F'FC3B, 0xAE3D'A7D9'7F67'92E3},  // 10^-276
+    {0xB144'2798'F49F'FB4A, 0x99CD'11CF'DF41'779C},  // 10^-275
+    {0xDD95'317F'31C7'FA1D, 0x4040'5643'D711'D583},  // 10^-274
+    {0x8A7D'3EEF'7F1C'FC52, 0x4828'35EA'666B'2572},  // 10^-273
+    {0xAD1C'8EAB'5EE4'3B66, 0xDA32'4365'0005'EECF},  // 10^-272
+    {0xD863'B256'369D'4A40, 0x90BE'D43E'4007'6A82},  // 10^-271
+    {0x873E'4F75'E222'4E68, 0x5A77'44A6'E804'A291},  // 10^-270
+    {0xA90D'E353'5AAA'E202, 0x7115'15D0'A205'CB36},  // 10^-269
+    {0xD351'5C28'3155'9A83, 0x0D5A'5B44'CA87'3E03},  // 10^-268
+    {0x8412'D999'1ED5'8091, 0xE858'790A'FE94'86C2},  // 10^-267
+    {0xA517'8FFF'668A'E0B6, 0x626E'974D'BE39'A872},  // 10^-266
+    {0xCE5D'73FF'402D'98E3, 0xFB0A'3D21'2DC8'128F},  // 10^-265
+    {0x80FA'687F'881C'7F8E, 0x7CE6'6634'BC9D'0B99},  // 10^-264
+    {0xA139'029F'6A23'9F72, 0x1C1F'FFC1'EBC4'4E80},  // 10^-263
+    {0xC987'4347'44AC'874E, 0xA327'FFB2'66B5'6220},  // 10^-262
+    {0xFBE9'1419'15D7'A922, 0x4BF1'FF9F'0062'BAA8},  // 10^-261
+    {0x9D71'AC8F'ADA6'C9B5, 0x6F77'3FC3'603D'B4A9},  // 10^-260
+    {0xC4CE'17B3'9910'7C22, 0xCB55'0FB4'384D'21D3},  // 10^-259
+    {0xF601'9DA0'7F54'9B2B, 0x7E2A'53A1'4660'6A48},  // 10^-258
+    {0x99C1'0284'4F94'E0FB, 0x2EDA'7444'CBFC'426D},  // 10^-257
+    {0xC031'4325'637A'1939, 0xFA91'1155'FEFB'5308},  // 10^-256
+    {0xF03D'93EE'BC58'9F88, 0x7935'55AB'7EBA'27CA},  // 10^-255
+    {0x9626'7C75'35B7'63B5, 0x4BC1'558B'2F34'58DE},  // 10^-254
+    {0xBBB0'1B92'8325'3CA2, 0x9EB1'AAED'FB01'6F16},  // 10^-253
+    {0xEA9C'2277'23EE'8BCB, 0x465E'15A9'79C1'CADC},  // 10^-252
+    {0x92A1'958A'7675'175F, 0x0BFA'CD89'EC19'1EC9},  // 10^-251
+    {0xB749'FAED'1412'5D36, 0xCEF9'80EC'671F'667B},  // 10^-250
+    {0xE51C'79A8'5916'F484, 0x82B7'E127'80E7'401A},  // 10^-249
+    {0x8F31'CC09'37AE'58D2, 0xD1B2'ECB8'B090'8810},  // 10^-248
+    {0xB2FE'3F0B'8599'EF07, 0x861F'A7E6'DCB4'AA15},  // 10^-247
+    {0xDFBD'CECE'6700'6AC9, 0x67A7'91E0'93E1'D49A},  // 10^-246
+    {0x8BD6'A141'0060'42BD, 0xE0C8'BB2C'5C6D'24E0},  // 10^-245
+    {0xAECC'4991'4078'536D, 0x58FA'E9F7'7388'6E18},  // 10^-244
+    {0xDA7F'5BF5'9096'6848, 0xAF39'A475'506A'899E},  // 10^-243
+    {0x888F'9979'7A5E'012D, 0x6D84'06C9'5242'9603},  // 10^-242
+    {0xAAB3'7FD7'D8F5'8178, 0xC8E5'087B'A6D3'3B83},  // 10^-241
+    {0xD560'5FCD'CF32'E1D6, 0xFB1E'4A9A'9088'0A64},  // 10^-240
+    {0x855C'3BE0'A17F'CD26, 0x5CF2'EEA0'9A55'067F},  // 10^-239
+    {0xA6B3'4AD8'C9DF'C06F, 0xF42F'AA48'C0EA'481E},  // 10^-238
+    {0xD060'1D8E'FC57'B08B, 0xF13B'94DA'F124'DA26},  // 10^-237
+    {0x823C'1279'5DB6'CE57, 0x76C5'3D08'D6B7'0858},  // 10^-236
+    {0xA2CB'1717'B524'81ED, 0x5476'8C4B'0C64'CA6E},  // 10^-235
+    {0xCB7D'DCDD'A26D'A268, 0xA994'2F5D'CF7D'FD09},  // 10^-234
+    {0xFE5D'5415'0B09'0B02, 0xD3F9'3B35'435D'7C4C},  // 10^-233
+    {0x9EFA'548D'26E5'A6E1, 0xC47B'C501'4A1A'6DAF},  // 10^-232
+    {0xC6B8'E9B0'709F'109A, 0x359A'B641'9CA1'091B},  // 10^-231
+    {0xF867'241C'8CC6'D4C0, 0xC301'63D2'03C9'4B62},  // 10^-230
+    {0x9B40'7691'D7FC'44F8, 0x79E0'DE63'425D'CF1D},  // 10^-229
+    {0xC210'9436'4DFB'5636, 0x9859'15FC'12F5'42E4},  // 10^-228
+    {0xF294'B943'E17A'2BC4, 0x3E6F'5B7B'17B2'939D},  // 10^-227
+    {0x979C'F3CA'6CEC'5B5A, 0xA705'992C'EECF'9C42},  // 10^-226
+    {0xBD84'30BD'0827'7231, 0x50C6'FF78'2A83'8353},  // 10^-225
+    {0xECE5'3CEC'4A31'4EBD, 0xA4F8'BF56'3524'6428},  // 10^-224
+    {0x940F'4613'AE5E'D136, 0x871B'7795'E136'BE99},  // 10^-223
+    {0xB913'1798'99F6'8584, 0x28E2'557B'5984'6E3F},  // 10^-222
+    {0xE757'DD7E'C074'26E5, 0x331A'EADA'2FE5'89CF},  // 10^-221
+    {0x9096'EA6F'3848'984F, 0x3FF0'D2C8'5DEF'7621},  // 10^-220
+    {0xB4BC'A50B'065A'BE63, 0x0FED'077A'756B'53A9},  // 10^-219
+    {0xE1EB'CE4D'C7F1'6DFB, 0xD3E8'4959'12C6'2894},  // 10^-218
+    {0x8D33'60F0'9CF6'E4BD, 0x6471'2DD7'ABBB'D95C},  // 10^-217
+    {0xB080'392C'C434'9DEC, 0xBD8D'794D'96AA'CFB3},  // 10^-216
+    {0xDCA0'4777'F541'C567, 0xECF0'D7A0'FC55'83A0},  // 10^-215
+    {0x89E4'2CAA'F949'1B60, 0xF416'86C4'9DB5'7244},  // 10^-214
+    {0xAC5D'37D5'B79B'6239, 0x311C'2875'C522'CED5},  // 10^-213
+    {0xD774'85CB'2582'3AC7, 0x7D63'3293'366B'828B},  // 10^-212
+    {0x86A8'D39E'F771'64BC, 0xAE5D'FF9C'0203'3197},  // 10^-211
+    {0xA853'0886'B54D'BDEB, 0xD9F5'7F83'0283'FDFC},  // 10^-210
+    {0xD267'CAA8'62A1'2D66, 0xD072'DF63'C324'FD7B},  // 10^-209
+    {0x8380'DEA9'3DA4'BC60, 0x4247'CB9E'59F7'1E6D},  // 10^-208
+    {0xA461'1653'8D0D'EB78, 0x52D9'BE85'F074'E608},  // 10^-207
+    {0xCD79'5BE8'7051'6656, 0x6790'2E27'6C92'1F8B},  // 10^-206
+    {0x806B'D971'4632'DFF6, 0x00BA'1CD8'A3DB'53B6},  // 10^-205
+    {0xA086'CFCD'97BF'97F3, 0x80E8'A40E'CCD2'28A4},  // 10^-204
+    {0xC8A8'83C0'FDAF'7DF0, 0x6122'CD12'8006'B2CD},  // 10^-203
+    {0xFAD2'A4B1'3D1B'5D6C, 0x796B'8057'2008'5F81},  // 10^-202
+    {0x9CC3'A6EE'C631'1A63, 0xCBE3'3036'7405'3BB0},  // 10^-201
+    {0xC3F4'90AA'77BD'60FC, 0xBEDB'FC44'1106'8A9C},  // 10^-200
+    {0xF4F1'B4D5'15AC'B93B, 0xEE92'FB55'1548'2D44},  // 10^-199
+    {0x9917'1105'2D8B'F3C5, 0x751B'DD15'2D4D'1C4A},  // 10^-198
+    {0xBF5C'D546'78EE'F0B6, 0xD262'D45A'78A0'635D},  // 10^-197
+    {0xEF34'0A98'172A'ACE4, 0x86FB'8971'16C8'7C34},  // 10^-196
+    {0x9580'869F'0E7A'AC0E, 0xD45D'35E6'AE3D'4DA0},  // 10^-195
+    {0xBAE0'A846'D219'5712, 0x8974'8360'59CC'A109},  // 10^-194
+    {0xE998'D258'869F'ACD7, 0x2BD1'A438'703F'C94B},  // 10^-193
+    {0x91FF'8377'5423'CC06, 0x7B63'06A3'4627'DDCF},  // 10^-192
+    {0xB67F'6455'292C'BF08, 0x1A3B'C84C'17B1'D542},  // 10^-191
+    {0xE41F'3D6A'7377'EECA, 0x20CA'BA5F'1D9E'4A93},  // 10^-190
+    {0x8E93'8662'882A'F53E, 0x547E'B47B'7282'EE9C},  // 10^-189
+    {0xB238'67FB'2A35'B28D, 0xE99E'619A'4F23'AA43},  // 10^-188
+    {0xDEC6'81F9'F4C3'1F31, 0x6405'FA00'E2EC'94D4},  // 10^-187
+    {0x8B3C'113C'38F9'F37E, 0xDE83'BC40'8DD3'DD04},  // 10^-186
+    {0xAE0B'158B'4738'705E, 0x9624'AB50'B148'D445},  // 10^-185
+    {0xD98D'DAEE'1906'8C76, 0x3BAD'D624'DD9B'0957},  // 10^-184
+    {0x87F8'A8D4'CFA4'17C9, 0xE54C'A5D7'0A80'E5D6},  // 10^-183
+    {0xA9F6'D30A'038D'1DBC, 0x5E9F'CF4C'CD21'1F4C},  // 10^-182
+    {0xD474'87CC'8470'652B, 0x7647'C320'0069'671F},  // 10^-181
+    {0x84C8'D4DF'D2C6'3F3B, 0x29EC'D9F4'0041'E073},  // 10^-180
+    {0xA5FB'0A17'C777'CF09, 0xF468'1071'0052'5890},  // 10^-179
+    {0xCF79'CC9D'B955'C2CC, 0x7182'148D'4066'EEB4},  // 10^-178
+    {0x81AC'1FE2'93D5'99BF, 0xC6F1'4CD8'4840'5530},  // 10^-177
+    {0xA217'27DB'38CB'002F, 0xB8AD'A00E'5A50'6A7C},  // 10^-176
+    {0xCA9C'F1D2'06FD'C03B, 0xA6D9'0811'F0E4'851C},  // 10^-175
+    {0xFD44'2E46'88BD'304A, 0x908F'4A16'6D1D'A663},  // 10^-174
+    {0x9E4A'9CEC'1576'3E2E, 0x9A59'8E4E'0432'87FE},  // 10^-173
+    {0xC5DD'4427'1AD3'CDBA, 0x40EF'F1E1'853F'29FD},  // 10^-172
+    {0xF754'9530'E188'C128, 0xD12B'EE59'E68E'F47C},  // 10^-171
+    {0x9A94'DD3E'8CF5'78B9, 0x82BB'74F8'3019'58CE},  // 10^-170
+    {0xC13A'148E'3032'D6E7, 0xE36A'5236'3C1F'AF01},  // 10^-169
+    {0xF188'99B1'BC3F'8CA1, 0xDC44'E6C3'CB27'9AC1},  // 10^-168
+    {0x96F5'600F'15A7'B7E5, 0x29AB'103A'5EF8'C0B9},  // 10^-167
+    {0xBCB2'B812'DB11'A5DE, 0x7415'D448'F6B6'F0E7},  // 10^-166
+    {0xEBDF'6617'91D6'0F56, 0x111B'495B'3464'AD21},  // 10^-165
+    {0x936B'9FCE'BB25'C995, 0xCAB1'0DD9'00BE'EC34},  // 10^-164
+    {0xB846'87C2'69EF'3BFB, 0x3D5D'514F'40EE'A742},  // 10^-163
+    {0xE658'29B3'046B'0AFA, 0x0CB4'A5A3'112A'5112},  // 10^-162
+    {0x8FF7'1A0F'E2C2'E6DC, 0x47F0'E785'EABA'72AB},  // 10^-161
+    {0xB3F4'E093'DB73'A093, 0x59ED'2167'6569'0F56},  // 10^-160
+    {0xE0F2'18B8'D250'88B8, 0x3068'69C1'3EC3'532C},  // 10^-159
+    {0x8C97'4F73'8372'5573, 0x1E41'4218'C73A'13FB},  // 10^-158
+    {0xAFBD'2350'644E'EACF, 0xE5D1'929E'F908'98FA},  // 10^-157
+    {0xDBAC'6C24'7D62'A583, 0xDF45'F746'B74A'BF39},  // 10^-156
+    {0x894B'C396'CE5D'A772, 0x6B8B'BA8C'328E'B783},  // 10^-155
+    {0xAB9E'B47C'81F5'114F, 0x066E'A92F'3F32'6564},  // 10^-154
+    {0xD686'619B'A272'55A2, 0xC80A'537B'0EFE'FEBD},  // 10^-153
+    {0x8613'FD01'4587'7585, 0xBD06'742C'E95F'5F36},  // 10^-152
+    {0xA798'FC41'96E9'52E7, 0x2C48'1138'23B7'3704},  // 10^-151
+    {0xD17F'3B51'FCA3'A7A0, 0xF75A'1586'2CA5'04C5},  // 10^-150
+    {0x82EF'8513'3DE6'48C4, 0x9A98'4D73'DBE7'22FB},  // 10^-149
+    {0xA3AB'6658'0D5F'DAF5, 0xC13E'60D0'D2E0'EBBA},  // 10^-148
+    {0xCC96'3FEE'10B7'D1B3, 0x318D'F905'0799'26A8},  // 10^-147
+    {0xFFBB'CFE9'94E5'C61F, 0xFDF1'7746'497F'7052},  // 10^-146
+    {0x9FD5'61F1'FD0F'9BD3, 0xFEB6'EA8B'EDEF'A633},  // 10^-145
+    {0xC7CA'BA6E'7C53'82C8, 0xFE64'A52E'E96B'8FC0},  // 10^-144
+    {0xF9BD'690A'1B68'637B, 0x3DFD'CE7A'A3C6'73B0},  // 10^-143
+    {0x9C16'61A6'5121'3E2D, 0x06BE'A10C'A65C'084E},  // 10^-142
+    {0xC31B'FA0F'E569'8DB8, 0x486E'494F'CFF3'0A62},  // 10^-141
+    {0xF3E2'F893'DEC3'F126, 0x5A89'DBA3'C3EF'CCFA},  // 10^-140
+    {0x986D'DB5C'6B3A'76B7, 0xF896'2946'5A75'E01C},  // 10^-139
+    {0xBE89'5233'8609'1465, 0xF6BB'B397'F113'5823},  // 10^-138
+    {0xEE2B'A6C0'678B'597F, 0x746A'A07D'ED58'2E2C},  // 10^-137
+    {0x94DB'4838'40B7'17EF, 0xA8C2'A44E'B457'1CDC},  // 10^-136
+    {0xBA12'1A46'50E4'DDEB, 0x92F3'4D62'616C'E413},  // 10^-135
+    {0xE896'A0D7'E51E'1566, 0x77B0'20BA'F9C8'1D17},  // 10^-134
+    {0x915E'2486'EF32'CD60, 0x0ACE'1474'DC1D'122E},  // 10^-133
+    {0xB5B5'ADA8'AAFF'80B8, 0x0D81'9992'1324'56BA},  // 10^-132
+    {0xE323'1912'D5BF'60E6, 0x10E1'FFF6'97ED'6C69},  // 10^-131
+    {0x8DF5'EFAB'C597'9C8F, 0xCA8D'3FFA'1EF4'63C1},  // 10^-130
+    {0xB173'6B96'B6FD'83B3, 0xBD30'8FF8'A6B1'7CB2},  // 10^-129
+    {0xDDD0'467C'64BC'E4A0, 0xAC7C'B3F6'D05D'DBDE},  // 10^-128
+    {0x8AA2'2C0D'BEF6'0EE4, 0x6BCD'F07A'423A'A96B},  // 10^-127
+    {0xAD4A'B711'2EB3'929D, 0x86C1'6C98'D2C9'53C6},  // 10^-126
+    {0xD89D'64D5'7A60'7744, 0xE871'C7BF'077B'A8B7},  // 10^-125
+    {0x8762'5F05'6C7C'4A8B, 0x1147'1CD7'64AD'4972},  // 10^-124
+    {0xA93A'F6C6'C79B'5D2D, 0xD598'E40D'3DD8'9BCF},  // 10^-123
+    {0xD389'B478'7982'3479, 0x4AFF'1D10'8D4E'C2C3},  // 10^-122
+    {0x8436'10CB'4BF1'60CB, 0xCEDF'722A'5851'39BA},  // 10^-121
+    {0xA543'94FE'1EED'B8FE, 0xC297'4EB4'EE65'8828},  // 10^-120
+    {0xCE94'7A3D'A6A9'273E, 0x733D'2262'29FE'EA32},  // 10^-119
+    {0x811C'CC66'8829'B887, 0x0806'357D'5A3F'525F},  // 10^-118
+    {0xA163'FF80'2A34'26A8, 0xCA07'C2DC'B0CF'26F7},  // 10^-117
+    {0xC9BC'FF60'34C1'3052, 0xFC89'B393'DD02'F0B5},  // 10^-116
+    {0xFC2C'3F38'41F1'7C67, 0xBBAC'2078'D443'ACE2},  // 10^-115
+    {0x9D9B'A783'2936'EDC0, 0xD54B'944B'84AA'4C0D},  // 10^-114
+    {0xC502'9163'F384'A931, 0x0A9E'795E'65D4'DF11},  // 10^-113
+    {0xF643'35BC'F065'D37D, 0x4D46'17B5'FF4A'16D5},  // 10^-112
+    {0x99EA'0196'163F'A42E, 0x504B'CED1'BF8E'4E45},  // 10^-111
+    {0xC064'81FB'9BCF'8D39, 0xE45E'C286'2F71'E1D6},  // 10^-110
+    {0xF07D'A27A'82C3'7088, 0x5D76'7327'BB4E'5A4C},  // 10^-109
+    {0x964E'858C'91BA'2655, 0x3A6A'07F8'D510'F86F},  // 10^-108
+    {0xBBE2'26EF'B628'AFEA, 0x8904'89F7'0A55'368B},  // 10^-107
+    {0xEADA'B0AB'A3B2'DBE5, 0x2B45'AC74'CCEA'842E},  // 10^-106
+    {0x92C8'AE6B'464F'C96F, 0x3B0B'8BC9'0012'929D},  // 10^-105
+    {0xB77A'DA06'17E3'BBCB, 0x09CE'6EBB'4017'3744},  // 10^-104
+    {0xE559'9087'9DDC'AABD, 0xCC42'0A6A'101D'0515},  // 10^-103
+    {0x8F57'FA54'C2A9'EAB6, 0x9FA9'4682'4A12'232D},  // 10^-102
+    {0xB32D'F8E9'F354'6564, 0x4793'9822'DC96'ABF9},  // 10^-101
+    {0xDFF9'7724'7029'7EBD, 0x5978'7E2B'93BC'56F7},  // 10^-100
+    {0x8BFB'EA76'C619'EF36, 0x57EB'4EDB'3C55'B65A},  // 10^-99
+    {0xAEFA'E514'77A0'6B03, 0xEDE6'2292'0B6B'23F1},  // 10^-98
+    {0xDAB9'9E59'9588'85C4, 0xE95F'AB36'8E45'ECED},  // 10^-97
+    {0x88B4'02F7'FD75'539B, 0x11DB'CB02'18EB'B414},  // 10^-96
+    {0xAAE1'03B5'FCD2'A881, 0xD652'BDC2'9F26'A119},  // 10^-95
+    {0xD599'44A3'7C07'52A2, 0x4BE7'6D33'46F0'495F},  // 10^-94
+    {0x857F'CAE6'2D84'93A5, 0x6F70'A440'0C56'2DDB},  // 10^-93
+    {0xA6DF'BD9F'B8E5'B88E, 0xCB4C'CD50'0F6B'B952},  // 10^-92
+    {0xD097'AD07'A71F'26B2, 0x7E20'00A4'1346'A7A7},  // 10^-91
+    {0x825E'CC24'C873'782F, 0x8ED4'0066'8C0C'28C8},  // 10^-90
+    {0xA2F6'7F2D'FA90'563B, 0x7289'0080'2F0F'32FA},  // 10^-89
+    {0xCBB4'1EF9'7934'6BCA, 0x4F2B'40A0'3AD2'FFB9},  // 10^-88
+    {0xFEA1'26B7'D781'86BC, 0xE2F6'10C8'4987'BFA8},  // 10^-87
+    {0x9F24'B832'E6B0'F436, 0x0DD9'CA7D'2DF4'D7C9},  // 10^-86
+    {0xC6ED'E63F'A05D'3143, 0x9150'3D1C'7972'0DBB},  // 10^-85
+    {0xF8A9'5FCF'8874'7D94, 0x75A4'4C63'97CE'912A},  // 10^-84
+    {0x9B69'DBE1'B548'CE7C, 0xC986'AFBE'3EE1'1ABA},  // 10^-83
+    {0xC244'52DA'229B'021B, 0xFBE8'5BAD'CE99'6168},  // 10^-82
+    {0xF2D5'6790'AB41'C2A2, 0xFAE2'7299'423F'B9C3},  // 10^-81
+    {0x97C5'60BA'6B09'19A5, 0xDCCD'879F'C967'D41A},  // 10^-80
+    {0xBDB6'B8E9'05CB'600F, 0x5400'E987'BBC1'C920},  // 10^-79
+    {0xED24'6723'473E'3813, 0x2901'23E9'AAB2'3B68},  // 10^-78
+    {0x9436'C076'0C86'E30B, 0xF9A0'B672'0AAF'6521},  // 10^-77
+    {0xB944'7093'8FA8'9BCE, 0xF808'E40E'8D5B'3E69},  // 10^-76
+    {0xE795'8CB8'7392'C2C2, 0xB60B'1D12'30B2'0E04},  // 10^-75
+    {0x90BD'77F3'483B'B9B9, 0xB1C6'F22B'5E6F'48C2},  // 10^-74
+    {0xB4EC'D5F0'1A4A'A828, 0x1E38'AEB6'360B'1AF3},  // 10^-73
+    {0xE228'0B6C'20DD'5232, 0x25C6'DA63'C38D'E1B0},  // 10^-72
+    {0x8D59'0723'948A'535F, 0x579C'487E'5A38'AD0E},  // 10^-71
+    {0xB0AF'48EC'79AC'E837, 0x2D83'5A9D'F0C6'D851},  // 10^-70
+    {0xDCDB'1B27'9818'2244, 0xF8E4'3145'6CF8'8E65},  // 10^-69
+    {0x8A08'F0F8'BF0F'156B, 0x1B8E'9ECB'641B'58FF},  // 10^-68
+    {0xAC8B'2D36'EED2'DAC5, 0xE272'467E'3D22'2F3F},  // 10^-67
+    {0xD7AD'F884'AA87'9177, 0x5B0E'D81D'CC6A'BB0F},  // 10^-66
+    {0x86CC'BB52'EA94'BAEA, 0x98E9'4712'9FC2'B4E9},  // 10^-65
+    {0xA87F'EA27'A539'E9A5, 0x3F23'98D7'47B3'6224},  // 10^-64
+    {0xD29F'E4B1'8E88'640E, 0x8EEC'7F0D'19A0'3AAD},  // 10^-63
+    {0x83A3'EEEE'F915'3E89, 0x1953'CF68'3004'24AC},  // 10^-62
+    {0xA48C'EAAA'B75A'8E2B, 0x5FA8'C342'3C05'2DD7},  // 10^-61
+    {0xCDB0'2555'6531'31B6, 0x3792'F412'CB06'794D},  // 10^-60
+    {0x808E'1755'5F3E'BF11, 0xE2BB'D88B'BEE4'0BD0},  // 10^-59
+    {0xA0B1'9D2A'B70E'6ED6, 0x5B6A'CEAE'AE9D'0EC4},  // 10^-58
+    {0xC8DE'0475'64D2'0A8B, 0xF245'825A'5A44'5275},  // 10^-57
+    {0xFB15'8592'BE06'8D2E, 0xEED6'E2F0'F0D5'6712},  // 10^-56
+    {0x9CED'737B'B6C4'183D, 0x5546'4DD6'9685'606B},  // 10^-55
+    {0xC428'D05A'A475'1E4C, 0xAA97'E14C'3C26'B886},  // 10^-54
+    {0xF533'0471'4D92'65DF, 0xD53D'D99F'4B30'66A8},  // 10^-53
+    {0x993F'E2C6'D07B'7FAB, 0xE546'A803'8EFE'4029},  // 10^-52
+    {0xBF8F'DB78'849A'5F96, 0xDE98'5204'72BD'D033},  // 10^-51
+    {0xEF73'D256'A5C0'F77C, 0x963E'6685'8F6D'4440},  // 10^-50
+    {0x95A8'6376'2798'9AAD, 0xDDE7'0013'79A4'4AA8},  // 10^-49
+    {0xBB12'7C53'B17E'C159, 0x5560'C018'580D'5D52},  // 10^-48
+    {0xE9D7'1B68'9DDE'71AF, 0xAAB8'F01E'6E10'B4A6},  // 10^-47
+    {0x9226'7121'62AB'070D, 0xCAB3'9613'04CA'70E8},  // 10^-46
+    {0xB6B0'0D69'BB55'C8D1, 0x3D60'7B97'C5FD'0D22},  // 10^-45
+    {0xE45C'10C4'2A2B'3B05, 0x8CB8'9A7D'B77C'506A},  // 10^-44
+    {0x8EB9'8A7A'9A5B'04E3, 0x77F3'608E'92AD'B242},  // 10^-43
+    {0xB267'ED19'40F1'C61C, 0x55F0'38B2'3759'1ED3},  // 10^-42
+    {0xDF01'E85F'912E'37A3, 0x6B6C'46DE'C52F'6688},  // 10^-41
+    {0x8B61'313B'BABC'E2C6, 0x2323'AC4B'3B3D'A015},  // 10^-40
+    {0xAE39'7D8A'A96C'1B77, 0xABEC'975E'0A0D'081A},  // 10^-39
+    {0xD9C7'DCED'53C7'2255, 0x96E7'BD35'8C90'4A21},  // 10^-38
+    {0x881C'EA14'545C'7575, 0x7E50'D641'77DA'2E54},  // 10^-37
+    {0xAA24'2499'6973'92D2, 0xDDE5'0BD1'D5D0'B9E9},  // 10^-36
+    {0xD4AD'2DBF'C3D0'7787, 0x955E'4EC6'4B44'E864},  // 10^-35
+    {0x84EC'3C97'DA62'4AB4, 0xBD5A'F13B'EF0B'113E},  // 10^-34
+    {0xA627'4BBD'D0FA'DD61, 0xECB1'AD8A'EACD'D58E},  // 10^-33
+    {0xCFB1'1EAD'4539'94BA, 0x67DE'18ED'A581'4AF2},  // 10^-32
+    {0x81CE'B32C'4B43'FCF4, 0x80EA'CF94'8770'CED7},  // 10^-31
+    {0xA242'5FF7'5E14'FC31, 0xA125'8379'A94D'028D},  // 10^-30
+    {0xCAD2'F7F5'359A'3B3E, 0x096E'E458'13A0'4330},  // 10^-29
+    {0xFD87'B5F2'8300'CA0D, 0x8BCA'9D6E'1888'53FC},  // 10^-28
+    {0x9E74'D1B7'91E0'7E48, 0x775E'A264'CF55'347D},  // 10^-27
+    {0xC612'0625'7658'9DDA, 0x9536'4AFE'032A'819D},  // 10^-26
+    {0xF796'87AE'D3EE'C551, 0x3A83'DDBD'83F5'2204},  // 10^-25
+    {0x9ABE'14CD'4475'3B52, 0xC492'6A96'7279'3542},  // 10^-24
+    {0xC16D'9A00'9592'8A27, 0x75B7'053C'0F17'8293},  // 10^-23
+    {0xF1C9'0080'BAF7'2CB1, 0x5324'C68B'12DD'6338},  // 10^-22
+    {0x971D'A050'74DA'7BEE, 0xD3F6'FC16'EBCA'5E03},  // 10^-21
+    {0xBCE5'0864'9211'1AEA, 0x88F4'BB1C'A6BC'F584},  // 10^-20
+    {0xEC1E'4A7D'B695'61A5, 0x2B31'E9E3'D06C'32E5},  // 10^-19
+    {0x9392'EE8E'921D'5D07, 0x3AFF'322E'6243'9FCF},  // 10^-18
+    {0xB877'AA32'36A4'B449, 0x09BE'FEB9'FAD4'87C2},  // 10^-17
+    {0xE695'94BE'C44D'E15B, 0x4C2E'BE68'7989'A9B3},  // 10^-16
+    {0x901D'7CF7'3AB0'ACD9, 0x0F9D'3701'4BF6'0A10},  // 10^-15
+    {0xB424'DC35'095C'D80F, 0x5384'84C1'9EF3'8C94},  // 10^-14
+    {0xE12E'1342'4BB4'0E13, 0x2865'A5F2'06B0'6FB9},  // 10^-13
+    {0x8CBC'CC09'6F50'88CB, 0xF93F'87B7'442E'45D3},  // 10^-12
+    {0xAFEB'FF0B'CB24'AAFE, 0xF78F'69A5'1539'D748},  // 10^-11
+    {0xDBE6'FECE'BDED'D5BE, 0xB573'440E'5A88'4D1B},  // 10^-10
+    {0x8970'5F41'36B4'A597, 0x3168'0A88'F895'3030},  // 10^-9
+    {0xABCC'7711'8461'CEFC, 0xFDC2'0D2B'36BA'7C3D},  // 10^-8
+    {0xD6BF'94D5'E57A'42BC, 0x3D32'9076'0469'1B4C},  // 10^-7
+    {0x8637'BD05'AF6C'69B5, 0xA63F'9A49'C2C1'B10F},  // 10^-6
+    {0xA7C5'AC47'1B47'8423, 0x0FCF'80DC'3372'1D53},  // 10^-5
+    {0xD1B7'1758'E219'652B, 0xD3C3'6113'404E'A4A8},  // 10^-4
+    {0x8312'6E97'8D4F'DF3B, 0x645A'1CAC'0831'26E9},  // 10^-3
+    {0xA3D7'0A3D'70A3'D70A, 0x3D70'A3D7'0A3D'70A3},  // 10^-2
+    {0xCCCC'CCCC'CCCC'CCCC, 0xCCCC'CCCC'CCCC'CCCC},  // 10^-1
+    {0x8000'0000'0000'0000, 0x0000'0000'0000'0000},  // 10^0
+    {0xA000'0000'0000'0000, 0x0000'0000'0000'0000},  // 10^1
+    {0xC800'0000'0000'0000, 0x0000'0000'0000'0000},  // 10^2
+    {0xFA00'0000'0000'0000, 0x0000'0000'0000'0000},  // 10^3
+    {0x9C40'0000'0000'0000, 0x0000'0000'0000'0000},  // 10^4
+    {0xC350'0000'0000'0000, 0x0000'0000'0000'0000},  // 10^5
+    {0xF424'0000'0000'0000, 0x0000'0000'0000'0000},  // 10^6
+    {0x9896'8000'0000'0000, 0x0000'0000'0000'0000},  // 10^7
+    {0xBEBC'2000'0000'0000, 0x0000'0000'0000'0000},  // 10^8
+    {0xEE6B'2800'0000'0000, 0x0000'0000'0000'0000},  // 10^9
+    {0x9502'F900'0000'0000, 0x0000'0000'0000'0000},  // 10^10
+    {0xBA43'B740'0000'0000, 0x0000'0000'0000'0000},  // 10^11
+    {0xE8D4'A510'0000'0000, 0x0000'0000'0000'0000},  // 10^12
+    {0x9184'E72A'0000'0000, 0x0000'0000'0000'0000},  // 10^13
+    {0xB5E6'20F4'8000'0000, 0x0000'0000'0000'0000},  // 10^14
+    {0xE35F'A931'A000'0000, 0x0000'0000'0000'0000},  // 10^15
+    {0x8E1B'C9BF'0400'0000, 0x0000'0000'0000'0000},  // 10^16
+    {0xB1A2'BC2E'C500'0000, 0x0000'0000'0000'0000},  // 10^17
+    {0xDE0B'6B3A'7640'0000, 0x0000'0000'0000'0000},  // 10^18
+    {0x8AC7'2304'89E8'0000, 0x0000'0000'0000'0000},  // 10^19
+    {0xAD78'EBC5'AC62'0000, 0x0000'0000'0000'0000},  // 10^20
+    {0xD8D7'26B7'177A'8000, 0x0000'0000'0000'0000},  // 10^21
+    {0x8786'7832'6EAC'9000, 0x0000'0000'0000'0000},  // 10^22
+    {0xA968'163F'0A57'B400, 0x0000'0000'0000'0000},  // 10^23
+    {0xD3C2'1BCE'CCED'A100, 0x0000'0000'0000'0000},  // 10^24
+    {0x8459'5161'4014'84A0, 0x0000'0000'0000'0000},  // 10^25
+    {0xA56F'A5B9'9019'A5C8, 0x0000'0000'0000'0000},  // 10^26
+    {0xCECB'8F27'F420'0F3A, 0x0000'0000'0000'0000},  // 10^27
+    {0x813F'3978'F894'0984, 0x4000'0000'0000'0000},  // 10^28
+    {0xA18F'07D7'36B9'0BE5, 0x5000'0000'0000'0000},  // 10^29
+    {0xC9F2'C9CD'0467'4EDE, 0xA400'0000'0000'0000},  // 10^30
+    {0xFC6F'7C40'4581'2296, 0x4D00'0000'0000'0000},  // 10^31
+    {0x9DC5'ADA8'2B70'B59D, 0xF020'0000'0000'0000},  // 10^32
+    {0xC537'1912'364C'E305, 0x6C28'0000'0000'0000},  // 10^33
+    {0xF684'DF56'C3E0'1BC6, 0xC732'0000'0000'0000},  // 10^34
+    {0x9A13'0B96'3A6C'115C, 0x3C7F'4000'0000'0000},  // 10^35
+    {0xC097'CE7B'C907'15B3, 0x4B9F'1000'0000'0000},  // 10^36
+    {0xF0BD'C21A'BB48'DB20, 0x1E86'D400'0000'0000},  // 10^37
+    {0x9676'9950'B50D'88F4, 0x1314'4480'0000'0000},  // 10^38
+    {0xBC14'3FA4'E250'EB31, 0x17D9'55A0'0000'0000},  // 10^39
+    {0xEB19'4F8E'1AE5'25FD, 0x5DCF'AB08'0000'0000},  // 10^40
+    {0x92EF'D1B8'D0CF'37BE, 0x5AA1'CAE5'0000'0000},  // 10^41
+    {0xB7AB'C627'0503'05AD, 0xF14A'3D9E'4000'0000},  // 10^42
+    {0xE596'B7B0'C643'C719, 0x6D9C'CD05'D000'0000},  // 10^43
+    {0x8F7E'32CE'7BEA'5C6F, 0xE482'0023'A200'0000},  // 10^44
+    {0xB35D'BF82'1AE4'F38B, 0xDDA2'802C'8A80'0000},  // 10^45
+    {0xE035'2F62'A19E'306E, 0xD50B'2037'AD20'0000},  // 10^46
+    {0x8C21'3D9D'A502'DE45, 0x4526'F422'CC34'0000},  // 10^47
+    {0xAF29'8D05'0E43'95D6, 0x9670'B12B'7F41'0000},  // 10^48
+    {0xDAF3'F046'51D4'7B4C, 0x3C0C'DD76'5F11'4000},  // 10^49
+    {0x88D8'762B'F324'CD0F, 0xA588'0A69'FB6A'C800},  // 10^50
+    {0xAB0E'93B6'EFEE'0053, 0x8EEA'0D04'7A45'7A00},  // 10^51
+    {0xD5D2'38A4'ABE9'8068, 0x72A4'9045'98D6'D880},  // 10^52
+    {0x85A3'6366'EB71'F041, 0x47A6'DA2B'7F86'4750},  // 10^53
+    {0xA70C'3C40'A64E'6C51, 0x9990'90B6'5F67'D924},  // 10^54
+    {0xD0CF'4B50'CFE2'0765, 0xFFF4'B4E3'F741'CF6D},  // 10^55
+    {0x8281'8F12'81ED'449F, 0xBFF8'F10E'7A89'21A4},  // 10^56
+    {0xA321'F2D7'2268'95C7, 0xAFF7'2D52'192B'6A0D},  // 10^57
+    {0xCBEA'6F8C'EB02'BB39, 0x9BF4'F8A6'9F76'4490},  // 10^58
+    {0xFEE5'0B70'25C3'6A08, 0x02F2'36D0'4753'D5B4},  // 10^59
+    {0x9F4F'2726'179A'2245, 0x01D7'6242'2C94'6590},  // 10^60
+    {0xC722'F0EF'9D80'AAD6, 0x424D'3AD2'B7B9'7EF5},  // 10^61
+    {0xF8EB'AD2B'84E0'D58B, 0xD2E0'8987'65A7'DEB2},  // 10^62
+    {0x9B93'4C3B'330C'8577, 0x63CC'55F4'9F88'EB2F},  // 10^63
+    {0xC278'1F49'FFCF'A6D5, 0x3CBF'6B71'C76B'25FB},  // 10^64
+    {0xF316'271C'7FC3'908A, 0x8BEF'464E'3945'EF7A},  // 10^65
+    {0x97ED'D871'CFDA'3A56, 0x9775'8BF0'E3CB'B5AC},  // 10^66
+    {0xBDE9'4E8E'43D0'C8EC, 0x3D52'EEED'1CBE'A317},  // 10^67
+    {0xED63'A231'D4C4'FB27, 0x4CA7'AAA8'63EE'4BDD},  // 10^68
+    {0x945E'455F'24FB'1CF8, 0x8FE8'CAA9'3E74'EF6A},  // 10^69
+    {0xB975'D6B6'EE39'E436, 0xB3E2'FD53'8E12'2B44},  // 10^70
+    {0xE7D3'4C64'A9C8'5D44, 0x60DB'BCA8'7196'B616},  // 10^71
+    {0x90E4'0FBE'EA1D'3A4A, 0xBC89'55E9'46FE'31CD},  // 10^72
+    {0xB51D'13AE'A4A4'88DD, 0x6BAB'AB63'98BD'BE41},  // 10^73
+    {0xE264'589A'4DCD'AB14, 0xC696'963C'7EED'2DD1},  // 10^74
+    {0x8D7E'B760'70A0'8AEC, 0xFC1E'1DE5'CF54'3CA2},  // 10^75
+    {0xB0DE'6538'8CC8'ADA8, 0x3B25'A55F'4329'4BCB},  // 10^76
+    {0xDD15'FE86'AFFA'D912, 0x49EF'0EB7'13F3'9EBE},  // 10^77
+    {0x8A2D'BF14'2DFC'C7AB, 0x6E35'6932'6C78'4337},  // 10^78
+    {0xACB9'2ED9'397B'F996, 0x49C2'C37F'0796'5404},  // 10^79
+    {0xD7E7'7A8F'87DA'F7FB, 0xDC33'745E'C97B'E906},  // 10^80
+    {0x86F0'AC99'B4E8'DAFD, 0x69A0'28BB'3DED'71A3},  // 10^81
+    {0xA8AC'D7C0'2223'11BC, 0xC408'32EA'0D68'CE0C},  // 10^82
+    {0xD2D8'0DB0'2AAB'D62B, 0xF50A'3FA4'90C3'0190},  // 10^83
+    {0x83C7'088E'1AAB'65DB, 0x7926'67C6'DA79'E0FA},  // 10^84
+    {0xA4B8'CAB1'A156'3F52, 0x5770'01B8'9118'5938},  // 10^85
+    {0xCDE6'FD5E'09AB'CF26, 0xED4C'0226'B55E'6F86},  // 10^86
+    {0x80B0'5E5A'C60B'6178, 0x544F'8158'315B'05B4},  // 10^87
+    {0xA0DC'75F1'778E'39D6, 0x6963'61AE'3DB1'C721},  // 10^88
+    {0xC913'936D'D571'C84C, 0x03BC'3A19'CD1E'38E9},  // 10^89
+    {0xFB58'7849'4ACE'3A5F, 0x04AB'48A0'4065'C723},  // 10^90
+    {0x9D17'4B2D'CEC0'E47B, 0x62EB'0D64'283F'9C76},  // 10^91
+    {0xC45D'1DF9'4271'1D9A, 0x3BA5'D0BD'324F'8394},  // 10^92
+    {0xF574'6577'930D'6500, 0xCA8F'44EC'7EE3'6479},  // 10^93
+    {0x9968'BF6A'BBE8'5F20, 0x7E99'8B13'CF4E'1ECB},  // 10^94
+    {0xBFC2'EF45'6AE2'76E8, 0x9E3F'EDD8'C321'A67E},  // 10^95
+    {0xEFB3'AB16'C59B'14A2, 0xC5CF'E94E'F3EA'101E},  // 10^96
+    {0x95D0'4AEE'3B80'ECE5, 0xBBA1'F1D1'5872'4A12},  // 10^97
+    {0xBB44'5DA9'CA61'281F, 0x2A8A'6E45'AE8E'DC97},  // 10^98
+    {0xEA15'7514'3CF9'7226, 0xF52D'09D7'1A32'93BD},  // 10^99
+    {0x924D'692C'A61B'E758, 0x593C'2626'705F'9C56},  // 10^100
+    {0xB6E0'C377'CFA2'E12E, 0x6F8B'2FB0'0C77'836C},  // 10^101
+    {0xE498'F455'C38B'997A, 0x0B6D'FB9C'0F95'6447},  // 10^102
+    {0x8EDF'98B5'9A37'3FEC, 0x4724'BD41'89BD'5EAC},  // 10^103
+    {0xB297'7EE3'00C5'0FE7, 0x58ED'EC91'EC2C'B657},  // 10^104
+    {0xDF3D'5E9B'C0F6'53E1, 0x2F29'67B6'6737'E3ED},  // 10^105
+    {0x8B86'5B21'5899'F46C, 0xBD79'E0D2'0082'EE74},  // 10^106
+    {0xAE67'F1E9'AEC0'7187, 0xECD8'5906'80A3'AA11},  // 10^107
+    {0xDA01'EE64'1A70'8DE9, 0xE80E'6F48'20CC'9495},  // 10^108
+    {0x8841'34FE'9086'58B2, 0x3109'058D'147F'DCDD},  // 10^109
+    {0xAA51'823E'34A7'EEDE, 0xBD4B'46F0'599F'D415},  // 10^110
+    {0xD4E5'E2CD'C1D1'EA96, 0x6C9E'18AC'7007'C91A},  // 10^111
+    {0x850F'ADC0'9923'329E, 0x03E2'CF6B'C604'DDB0},  // 10^112
+    {0xA653'9930'BF6B'FF45, 0x84DB'8346'B786'151C},  // 10^113
+    {0xCFE8'7F7C'EF46'FF16, 0xE612'6418'6567'9A63},  // 10^114
+    {0x81F1'4FAE'158C'5F6E, 0x4FCB'7E8F'3F60'C07E},  // 10^115
+    {0xA26D'A399'9AEF'7749, 0xE3BE'5E33'0F38'F09D},  // 10^116
+    {0xCB09'0C80'01AB'551C, 0x5CAD'F5BF'D307'2CC5},  // 10^117
+    {0xFDCB'4FA0'0216'2A63, 0x73D9'732F'C7C8'F7F6},  // 10^118
+    {0x9E9F'11C4'014D'DA7E, 0x2867'E7FD'DCDD'9AFA},  // 10^119
+    {0xC646'D635'01A1'511D, 0xB281'E1FD'5415'01B8},  // 10^120
+    {0xF7D8'8BC2'4209'A565, 0x1F22'5A7C'A91A'4226},  // 10^121
+    {0x9AE7'5759'6946'075F, 0x3375'788D'E9B0'6958},  // 10^122
+    {0xC1A1'2D2F'C397'8937, 0x0052'D6B1'641C'83AE},  // 10^123
+    {0xF209'787B'B47D'6B84, 0xC067'8C5D'BD23'A49A},  // 10^124
+    {0x9745'EB4D'50CE'6332, 0xF840'B7BA'9636'46E0},  // 10^125
+    {0xBD17'6620'A501'FBFF, 0xB650'E5A9'3BC3'D898},  // 10^126
+    {0xEC5D'3FA8'CE42'7AFF, 0xA3E5'1F13'8AB4'CEBE},  // 10^127
+    {0x93BA'47C9'80E9'8CDF, 0xC66F'336C'36B1'0137},  // 10^128
+    {0xB8A8'D9BB'E123'F017, 0xB80B'0047'445D'4184},  // 10^129
+    {0xE6D3'102A'D96C'EC1D, 0xA60D'C059'1574'91E5},  // 10^130
+    {0x9043'EA1A'C7E4'1392, 0x87C8'9837'AD68'DB2F},  // 10^131
+    {0xB454'E4A1'79DD'1877, 0x29BA'BE45'98C3'11FB},  // 10^132
+    {0xE16A'1DC9'D854'5E94, 0xF429'6DD6'FEF3'D67A},  // 10^133
+    {0x8CE2'529E'2734'BB1D, 0x1899'E4A6'5F58'660C},  // 10^134
+    {0xB01A'E745'B101'E9E4, 0x5EC0'5DCF'F72E'7F8F},  // 10^135
+    {0xDC21'A117'1D42'645D, 0x7670'7543'F4FA'1F73},  // 10^136
+    {0x8995'04AE'7249'7EBA, 0x6A06'494A'791C'53A8},  // 10^137
+    {0xABFA'45DA'0EDB'DE69, 0x0487'DB9D'1763'6892},  // 10^138
+    {0xD6F8'D750'9292'D603, 0x45A9'D284'5D3C'42B6},  // 10^139
+    {0x865B'8692'5B9B'C5C2, 0x0B8A'2392'BA45'A9B2},  // 10^140
+    {0xA7F2'6836'F282'B732, 0x8E6C'AC77'68D7'141E},  // 10^141
+    {0xD1EF'0244'AF23'64FF, 0x3207'D795'430C'D926},  // 10^142
+    {0x8335'616A'ED76'1F1F, 0x7F44'E6BD'49E8'07B8},  // 10^143
+    {0xA402'B9C5'A8D3'A6E7, 0x5F16'206C'9C62'09A6},  // 10^144
+    {0xCD03'6837'1308'90A1, 0x36DB'A887'C37A'8C0F},  // 10^145
+    {0x8022'2122'6BE5'5A64, 0xC249'4954'DA2C'9789},  // 10^146
+    {0xA02A'A96B'06DE'B0FD, 0xF2DB'9BAA'10B7'BD6C},  // 10^147
+    {0xC835'53C5'C896'5D3D, 0x6F92'8294'94E5'ACC7},  // 10^148
+    {0xFA42'A8B7'3ABB'F48C, 0xCB77'2339'BA1F'17F9},  // 10^149
+    {0x9C69'A972'84B5'78D7, 0xFF2A'7604'1453'6EFB},  // 10^150
+    {0xC384'13CF'25E2'D70D, 0xFEF5'1385'1968'4ABA},  // 10^151
+    {0xF465'18C2'EF5B'8CD1, 0x7EB2'5866'5FC2'5D69},  // 10^152
+    {0x98BF'2F79'D599'3802, 0xEF2F'773F'FBD9'7A61},  // 10^153
+    {0xBEEE'FB58'4AFF'8603, 0xAAFB'550F'FACF'D8FA},  // 10^154
+    {0xEEAA'BA2E'5DBF'6784, 0x95BA'2A53'F983'CF38},  // 10^155
+    {0x952A'B45C'FA97'A0B2, 0xDD94'5A74'7BF2'6183},  // 10^156
+    {0xBA75'6174'393D'88DF, 0x94F9'7111'9AEE'F9E4},  // 10^157
+    {0xE912'B9D1'478C'EB17, 0x7A37'CD56'01AA'B85D},  // 10^158
+    {0x91AB'B422'CCB8'12EE, 0xAC62'E055'C10A'B33A},  // 10^159
+    {0xB616'A12B'7FE6'17AA, 0x577B'986B'314D'6009},  // 10^160
+    {0xE39C'4976'5FDF'9D94, 0xED5A'7E85'FDA0'B80B},  // 10^161
+    {0x8E41'ADE9'FBEB'C27D, 0x1458'8F13'BE84'7307},  // 10^162
+    {0xB1D2'1964'7AE6'B31C, 0x596E'B2D8'AE25'8FC8},  // 10^163
+    {0xDE46'9FBD'99A0'5FE3, 0x6FCA'5F8E'D9AE'F3BB},  // 10^164
+    {0x8AEC'23D6'8004'3BEE, 0x25DE'7BB9'480D'5854},  // 10^165
+    {0xADA7'2CCC'2005'4AE9, 0xAF56'1AA7'9A10'AE6A},  // 10^166
+    {0xD910'F7FF'2806'9DA4, 0x1B2B'A151'8094'DA04},  // 10^167
+    {0x87AA'9AFF'7904'2286, 0x90FB'44D2'F05D'0842},  // 10^168
+    {0xA995'41BF'5745'2B28, 0x353A'1607'AC74'4A53},  // 10^169
+    {0xD3FA'922F'2D16'75F2, 0x4288'9B89'9791'5CE8},  // 10^170
+    {0x847C'9B5D'7C2E'09B7, 0x6995'6135'FEBA'DA11},  // 10^171
+    {0xA59B'C234'DB39'8C25, 0x43FA'B983'7E69'9095},  // 10^172
+    {0xCF02'B2C2'1207'EF2E, 0x94F9'67E4'5E03'F4BB},  // 10^173
+    {0x8161'AFB9'4B44'F57D, 0x1D1B'E0EE'BAC2'78F5},  // 10^174
+    {0xA1BA'1BA7'9E16'32DC, 0x6462'D92A'6973'1732},  // 10^175
+    {0xCA28'A291'859B'BF93, 0x7D7B'8F75'03CF'DCFE},  // 10^176
+    {0xFCB2'CB35'E702'AF78, 0x5CDA'7352'44C3'D43E},  // 10^177
+    {0x9DEF'BF01'B061'ADAB, 0x3A08'8813'6AFA'64A7},  // 10^178
+    {0xC56B'AEC2'1C7A'1916, 0x088A'AA18'45B8'FDD0},  // 10^179
+    {0xF6C6'9A72'A398'9F5B, 0x8AAD'549E'5727'3D45},  // 10^180
+    {0x9A3C'2087'A63F'6399, 0x36AC'54E2'F678'864B},  // 10^181
+    {0xC0CB'28A9'8FCF'3C7F, 0x8457'6A1B'B416'A7DD},  // 10^182
+    {0xF0FD'F2D3'F3C3'0B9F, 0x656D'44A2'A11C'51D5},  // 10^183
+    {0x969E'B7C4'7859'E743, 0x9F64'4AE5'A4B1'B325},  // 10^184
+    {0xBC46'65B5'9670'6114, 0x873D'5D9F'0DDE'1FEE},  // 10^185
+    {0xEB57'FF22'FC0C'7959, 0xA90C'B506'D155'A7EA},  // 10^186
+    {0x9316'FF75'DD87'CBD8, 0x09A7'F124'42D5'88F2},  // 10^187
+    {0xB7DC'BF53'54E9'BECE, 0x0C11'ED6D'538A'EB2F},  // 10^188
+    {0xE5D3'EF28'2A24'2E81, 0x8F16'68C8'A86D'A5FA},  // 10^189
+    {0x8FA4'7579'1A56'9D10, 0xF96E'017D'6944'87BC},  // 10^190
+    {0xB38D'92D7'60EC'4455, 0x37C9'81DC'C395'A9AC},  // 10^191
+    {0xE070'F78D'3927'556A, 0x85BB'E253'F47B'1417},  // 10^192
+    {0x8C46'9AB8'43B8'9562, 0x9395'6D74'78CC'EC8E},  // 10^193
+    {0xAF58'4166'54A6'BABB, 0x387A'C8D1'9700'27B2},  // 10^194
+    {0xDB2E'51BF'E9D0'696A, 0x0699'7B05'FCC0'319E},  // 10^195
+    {0x88FC'F317'F222'41E2, 0x441F'ECE3'BDF8'1F03},  // 10^196
+    {0xAB3C'2FDD'EEAA'D25A, 0xD527'E81C'AD76'26C3},  // 10^197
+    {0xD60B'3BD5'6A55'86F1, 0x8A71'E223'D8D3'B074},  // 10^198
+    {0x85C7'0565'6275'7456, 0xF687'2D56'6784'4E49},  // 10^199
+    {0xA738'C6BE'BB12'D16C, 0xB428'F8AC'0165'61DB},  // 10^200
+    {0xD106'F86E'69D7'85C7, 0xE133'36D7'01BE'BA52},  // 10^201
+    {0x82A4'5B45'0226'B39C, 0xECC0'0246'6117'3473},  // 10^202
+    {0xA34D'7216'42B0'6084, 0x27F0'02D7'F95D'0190},  // 10^203
+    {0xCC20'CE9B'D35C'78A5, 0x31EC'038D'F7B4'41F4},  // 10^204
+    {0xFF29'0242'C833'96CE, 0x7E67'0471'75A1'5271},  // 10^205
+    {0x9F79'A169'BD20'3E41, 0x0F00'62C6'E984'D386},  // 10^206
+    {0xC758'09C4'2C68'4DD1, 0x52C0'7B78'A3E6'0868},  // 10^207
+    {0xF92E'0C35'3782'6145, 0xA770'9A56'CCDF'8A82},  // 10^208
+    {0x9BBC'C7A1'42B1'7CCB, 0x88A6'6076'400B'B691},  // 10^209
+    {0xC2AB'F989'935D'DBFE, 0x6ACF'F893'D00E'A435},  // 10^210
+    {0xF356'F7EB'F835'52FE, 0x0583'F6B8'C412'4D43},  // 10^211
+    {0x9816'5AF3'7B21'53DE, 0xC372'7A33'7A8B'704A},  // 10^212
+    {0xBE1B'F1B0'59E9'A8D6, 0x744F'18C0'592E'4C5C},  // 10^213
+    {0xEDA2'EE1C'7064'130C, 0x1162'DEF0'6F79'DF73},  // 10^214
+    {0x9485'D4D1'C63E'8BE7, 0x8ADD'CB56'45AC'2BA8},  // 10^215
+    {0xB9A7'4A06'37CE'2EE1, 0x6D95'3E2B'D717'3692},  // 10^216
+    {0xE811'1C87'C5C1'BA99, 0xC8FA'8DB6'CCDD'0437},  // 10^217
+    {0x910A'B1D4'DB99'14A0, 0x1D9C'9892'400A'22A2},  // 10^218
+    {0xB54D'5E4A'127F'59C8, 0x2503'BEB6'D00C'AB4B},  // 10^219
+    {0xE2A0'B5DC'971F'303A, 0x2E44'AE64'840F'D61D},  // 10^220
+    {0x8DA4'71A9'DE73'7E24, 0x5CEA'ECFE'D289'E5D2},  // 10^221
+    {0xB10D'8E14'5610'5DAD, 0x7425'A83E'872C'5F47},  // 10^222
+    {0xDD50'F199'6B94'7518, 0xD12F'124E'28F7'7719},  // 10^223
+    {0x8A52'96FF'E33C'C92F, 0x82BD'6B70'D99A'AA6F},  // 10^224
+    {0xACE7'3CBF'DC0B'FB7B, 0x636C'C64D'1001'550B},  // 10^225
+    {0xD821'0BEF'D30E'FA5A, 0x3C47'F7E0'5401'AA4E},  // 10^226
+    {0x8714'A775'E3E9'5C78, 0x65AC'FAEC'3481'0A71},  // 10^227
+    {0xA8D9'D153'5CE3'B396, 0x7F18'39A7'41A1'4D0D},  // 10^228
+    {0xD310'45A8'341C'A07C, 0x1EDE'4811'1209'A050},  // 10^229
+    {0x83EA'2B89'2091'E44D, 0x934A'ED0A'AB46'0432},  // 10^230
+    {0xA4E4'B66B'68B6'5D60, 0xF81D'A84D'5617'853F},  // 10^231
+    {0xCE1D'E406'42E3'F4B9, 0x3625'1260'AB9D'668E},  // 10^232
+    {0x80D2'AE83'E9CE'78F3, 0xC1D7'2B7C'6B42'6019},  // 10^233
+    {0xA107'5A24'E442'1730, 0xB24C'F65B'8612'F81F},  // 10^234
+    {0xC949'30AE'1D52'9CFC, 0xDEE0'33F2'6797'B627},  // 10^235
+    {0xFB9B'7CD9'A4A7'443C, 0x1698'40EF'017D'A3B1},  // 10^236
+    {0x9D41'2E08'06E8'8AA5, 0x8E1F'2895'60EE'864E},  // 10^237
+    {0xC491'798A'08A2'AD4E, 0xF1A6'F2BA'B92A'27E2},  // 10^238
+    {0xF5B5'D7EC'8ACB'58A2, 0xAE10'AF69'6774'B1DB},  // 10^239
+    {0x9991'A6F3'D6BF'1765, 0xACCA'6DA1'E0A8'EF29},  // 10^240
+    {0xBFF6'10B0'CC6E'DD3F, 0x17FD'090A'58D3'2AF3},  // 10^241
+    {0xEFF3'94DC'FF8A'948E, 0xDDFC'4B4C'EF07'F5B0},  // 10^242
+    {0x95F8'3D0A'1FB6'9CD9, 0x4ABD'AF10'1564'F98E},  // 10^243
+    {0xBB76'4C4C'A7A4'440F, 0x9D6D'1AD4'1ABE'37F1},  // 10^244
+    {0xEA53'DF5F'D18D'5513, 0x84C8'6189'216D'C5ED},  // 10^245
+    {0x9274'6B9B'E2F8'552C, 0x32FD'3CF5'B4E4'9BB4},  // 10^246
+    {0xB711'8682'DBB6'6A77, 0x3FBC'8C33'221D'C2A1},  // 10^247
+    {0xE4D5'E823'92A4'0515, 0x0FAB'AF3F'EAA5'334A},  // 10^248
+    {0x8F05'B116'3BA6'832D, 0x29CB'4D87'F2A7'400E},  // 10^249
+    {0xB2C7'1D5B'CA90'23F8, 0x743E'20E9'EF51'1012},  // 10^250
+    {0xDF78'E4B2'BD34'2CF6, 0x914D'A924'6B25'5416},  // 10^251
+    {0x8BAB'8EEF'B640'9C1A, 0x1AD0'89B6'C2F7'548E},  // 10^252
+    {0xAE96'72AB'A3D0'C320, 0xA184'AC24'73B5'29B1},  // 10^253
+    {0xDA3C'0F56'8CC4'F3E8, 0xC9E5'D72D'90A2'741E},  // 10^254
+    {0x8865'8996'17FB'1871, 0x7E2F'A67C'7A65'8892},  // 10^255
+    {0xAA7E'EBFB'9DF9'DE8D, 0xDDBB'901B'98FE'EAB7},  // 10^256
+    {0xD51E'A6FA'8578'5631, 0x552A'7422'7F3E'A565},  // 10^257
+    {0x8533'285C'936B'35DE, 0xD53A'8895'8F87'275F},  // 10^258
+    {0xA67F'F273'B846'0356, 0x8A89'2ABA'F368'F137},  // 10^259
+    {0xD01F'EF10'A657'842C, 0x2D2B'7569'B043'2D85},  // 10^260
+    {0x8213'F56A'67F6'B29B, 0x9C3B'2962'0E29'FC73},  // 10^261
+    {0xA298'F2C5'01F4'5F42, 0x8349'F3BA'91B4'7B8F},  // 10^262
+    {0xCB3F'2F76'4271'7713, 0x241C'70A9'3621'9A73},  // 10^263
+    {0xFE0E'FB53'D30D'D4D7, 0xED23'8CD3'83AA'0110},  // 10^264
+    {0x9EC9'5D14'63E8'A506, 0xF436'3804'324A'40AA},  // 10^265
+    {0xC67B'B459'7CE2'CE48, 0xB143'C605'3EDC'D0D5},  // 10^266
+    {0xF81A'A16F'DC1B'81DA, 0xDD94'B786'8E94'050A},  // 10^267
+    {0x9B10'A4E5'E991'3128, 0xCA7C'F2B4'191C'8326},  // 10^268
+    {0xC1D4'CE1F'63F5'7D72, 0xFD1C'2F61'1F63'A3F0},  // 10^269
+    {0xF24A'01A7'3CF2'DCCF, 0xBC63'3B39'673C'8CEC},  // 10^270
+    {0x976E'4108'8617'CA01, 0xD5BE'0503'E085'D813},  // 10^271
+    {0xBD49'D14A'A79D'BC82, 0x4B2D'8644'D8A7'4E18},  // 10^272
+    {0xEC9C'459D'5185'2BA2, 0xDDF8'E7D6'0ED1'219E},  // 10^273
+    {0x93E1'AB82'52F3'3B45, 0xCABB'90E5'C942'B503},  // 10^274
+    {0xB8DA'1662'E7B0'0A17, 0x3D6A'751F'3B93'6243},  // 10^275
+    {0xE710'9BFB'A19C'0C9D, 0x0CC5'1267'0A78'3AD4},  // 10^276
+    {0x906A'617D'4501'87E2, 0x27FB'2B80'668B'24C5},  // 10^277
+    {0xB484'F9DC'9641'E9DA, 0xB1F9'F660'802D'EDF6},  // 10^278
+    {0xE1A6'3853'BBD2'6451, 0x5E78'73F8'A039'6973},  // 10^279
+    {0x8D07'E334'5563'7EB2, 0xDB0B'487B'6423'E1E8},  // 10^280
+    {0xB049'DC01'6ABC'5E5F, 0x91CE'1A9A'3D2C'DA62},  // 10^281
+    {0xDC5C'5301'C56B'75F7, 0x7641'A140'CC78'10FB},  // 10^282
+    {0x89B9'B3E1'1B63'29BA, 0xA9E9'04C8'7FCB'0A9D},  // 10^283
+    {0xAC28'20D9'623B'F429, 0x5463'45FA'9FBD'CD44},  // 10^284
+    {0xD732'290F'BACA'F133, 0xA97C'1779'47AD'4095},  // 10^285
+    {0x867F'59A9'D4BE'D6C0, 0x49ED'8EAB'CCCC'485D},  // 10^286
+    {0xA81F'3014'49EE'8C70, 0x5C68'F256'BFFF'5A74},  // 10^287
+    {0xD226'FC19'5C6A'2F8C, 0x7383'2EEC'6FFF'3111},  // 10^288
+    {0x8358'5D8F'D9C2'5DB7, 0xC831'FD53'C5FF'7EAB},  // 10^289
+    {0xA42E'74F3'D032'F525, 0xBA3E'7CA8'B77F'5E55},  // 10^290
+    {0xCD3A'1230'C43F'B26F, 0x28CE'1BD2'E55F'35EB},  // 10^291
+    {0x8044'4B5E'7AA7'CF85, 0x7980'D163'CF5B'81B3},  // 10^292
+    {0xA055'5E36'1951'C366, 0xD7E1'05BC'C332'621F},  // 10^293
+    {0xC86A'B5C3'9FA6'3440, 0x8DD9'472B'F3FE'FAA7},  // 10^294
+    {0xFA85'6334'878F'C150, 0xB14F'98F6'F0FE'B951},  // 10^295
+    {0x9C93'5E00'D4B9'D8D2, 0x6ED1'BF9A'569F'33D3},  // 10^296
+    {0xC3B8'3581'09E8'4F07, 0x0A86'2F80'EC47'00C8},  // 10^297
+    {0xF4A6'42E1'4C62'62C8, 0xCD27'BB61'2758'C0FA},  // 10^298
+    {0x98E7'E9CC'CFBD'7DBD, 0x8038'D51C'B897'789C},  // 10^299
+    {0xBF21'E440'03AC'DD2C, 0xE047'0A63'E6BD'56C3},  // 10^300
+    {0xEEEA'5D50'0498'1478, 0x1858'CCFC'E06C'AC74},  // 10^301
+    {0x9552'7A52'02DF'0CCB, 0x0F37'801E'0C43'EBC8},  // 10^302
+    {0xBAA7'18E6'8396'CFFD, 0xD305'6025'8F54'E6BA},  // 10^303
+    {0xE950'DF20'247C'83FD, 0x47C6'B82E'F32A'2069},  // 10^304
+    {0x91D2'8B74'16CD'D27E, 0x4CDC'331D'57FA'5441},  // 10^305
+    {0xB647'2E51'1C81'471D, 0xE013'3FE4'ADF8'E952},  // 10^306
+    {0xE3D8'F9E5'63A1'98E5, 0x5818'0FDD'D977'23A6},  // 10^307
+    {0x8E67'9C2F'5E44'FF8F, 0x570F'09EA'A7EA'7648},  // 10^308
+    {0xB201'833B'35D6'3F73, 0x2CD2'CC65'51E5'13DA},  // 10^309
+    {0xDE81'E40A'034B'CF4F, 0xF807'7F7E'A65E'58D1},  // 10^310
+    {0x8B11'2E86'420F'6191, 0xFB04'AFAF'27FA'F782},  // 10^311
+    {0xADD5'7A27'D293'39F6, 0x79C5'DB9A'F1F9'B563},  // 10^312
+    {0xD94A'D8B1'C738'0874, 0x1837'5281'AE78'22BC},  // 10^313
+    {0x87CE'C76F'1C83'0548, 0x8F22'9391'0D0B'15B5},  // 10^314
+    {0xA9C2'794A'E3A3'C69A, 0xB2EB'3875'504D'DB22},  // 10^315
+    {0xD433'179D'9C8C'B841, 0x5FA6'0692'A461'51EB},  // 10^316
+    {0x849F'EEC2'81D7'F328, 0xDBC7'C41B'A6BC'D333},  // 10^317
+    {0xA5C7'EA73'224D'EFF3, 0x12B9'B522'906C'0800},  // 10^318
+    {0xCF39'E50F'EAE1'6BEF, 0xD768'226B'3487'0A00},  // 10^319
+    {0x8184'2F29'F2CC'E375, 0xE6A1'1583'00D4'6640},  // 10^320
+    {0xA1E5'3AF4'6F80'1C53, 0x6049'5AE3'C109'7FD0},  // 10^321
+    {0xCA5E'89B1'8B60'2368, 0x385B'B19C'B14B'DFC4},  // 10^322
+    {0xFCF6'2C1D'EE38'2C42, 0x4672'9E03'DD9E'D7B5},  // 10^323
+    {0x9E19'DB92'B4E3'1BA9, 0x6C07'A2C2'6A83'46D1},  // 10^324
+};
+// clang-format on
+
+PowerOfTen128 GetPowerOfTen128(int exponent) {
+  DCHECK_LE(kMinPowerOfTen128, exponent);
+  DCHECK_LE(exponent, kMaxPowerOfTen128);
+  return kPowersOfTen128[exponent - kMinPowerOfTen128];
+}
+
+}  // namespace base
+}  // namespace v8
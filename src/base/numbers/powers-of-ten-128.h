@@ -0,0 +1,54 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_BASE_NUMBERS_POWERS_OF_TEN_128_H_
+#define V8_BASE_NUMBERS_POWERS_OF_TEN_128_H_
+
+#include <stdint.h>
+
+namespace v8 {
+namespace base {
+
+// A 128-bit significand of a power of ten, normalized such that its most
+// significant bit is set.
+struct PowerOfTen128 {
+  uint64_t high;
+  uint64_t low;
+};
+
+// The range of decimal exponents covered by GetPowerOfTen128.
+constexpr int kMinPowerOfTen128 = -342;
+constexpr int kMaxPowerOfTen128 = 324;
+
+// Returns the significand of 10^exponent, rounded towards zero. The result
+// is exact for 0 <= exponent <= 55.
+PowerOfTen128 GetPowerOfTen128(int exponent);
+
+// Returns the low 64 bits of the product {a} * {b} and stores the high 64
+// bits in {high}.
+inline uint64_t MultiplyFull64(uint64_t a, uint64_t b, uint64_t* high) {
+#if defined(__SIZEOF_INT128__)
+  unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+  *high = static_cast<uint64_t>(product >> 64);
+  return static_cast<uint64_t>(product);
+#else
+  const uint64_t kMask32 = 0xFFFF'FFFF;
+  uint64_t a_low = a & kMask32;
+  uint64_t a_high = a >> 32;
+  uint64_t b_low = b & kMask32;
+  uint64_t b_high = b >> 32;
+  uint64_t low_low = a_low * b_low;
+  uint64_t high_low = a_high * b_low;
+  uint64_t low_high = a_low * b_high;
+  uint64_t high_high = a_high * b_high;
+  uint64_t middle = (low_low >> 32) + (high_low & kMask32) + low_high;
+  *high = high_high + (high_low >> 32) + (middle >> 32);
+  return (middle << 32) | (low_low & kMask32);
+#endif
+}
+
+}  // namespace base
+}  // namespace v8
+
+#endif  // V8_BASE_NUMBERS_POWERS_OF_TEN_128_H_
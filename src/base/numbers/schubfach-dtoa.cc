@@ -0,0 +1,140 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/base/numbers/schubfach-dtoa.h"
+
+#include <stdint.h>
+
+#include "src/base/logging.h"
+#include "src/base/numbers/double.h"
+#include "src/base/numbers/powers-of-ten-128.h"
+
+namespace v8 {
+namespace base {
+
+// The algorithm is described in
+//   Raffaello Giulietti: "The Schubfach way to render doubles" (2020).
+// A double v = c * 2^q has the rounding interval
+//   R = [(4c - 2 + lower_is_closer) * 2^(q-2), (4c + 2) * 2^(q-2)],
+// where the boundaries belong to R iff c is even. We scale R by 10^-k, where
+// k is chosen such that R is shorter than 10^(k+1) but at least as long as
+// 10^k. In R, there can then be at most one multiple of 10^(k+1), and at
+// least one multiple of 10^k. If there is exactly one multiple of 10^(k+1),
+// it's the shortest representation. Otherwise, we pick the multiple of 10^k
+// closest to v.
+// The scaled values are computed with a 128-bit approximation of 10^-k. The
+// results are rounded to odd, which preserves enough information to compare
+// them exactly against the (even) multiples of 4 that we are interested in.
+
+// floor(log10(2^e)), exact for -1100 <= e <= 1000.
+static int FloorLog10Pow2(int e) { return (e * 315653) >> 20; }
+
+// floor(log10(3/4 * 2^e)), exact for -1100 <= e <= 1000.
+static int FloorLog10ThreeQuartersPow2(int e) {
+  return (e * 315653 - 131237) >> 20;
+}
+
+// floor(log2(10^e)), exact for -400 <= e <= 400.
+static int FloorLog2Pow10(int e) { return (e * 1741647) >> 19; }
+
+// Returns g * cp / 2^128, rounded to odd, where g is given by its 64-bit
+// halves.
+static uint64_t RoundToOdd(uint64_t g_high, uint64_t g_low, uint64_t cp) {
+  uint64_t x_high;
+  MultiplyFull64(g_low, cp, &x_high);
+  uint64_t y_high;
+  uint64_t y_low = MultiplyFull64(g_high, cp, &y_high);
+  uint64_t z = y_low + x_high;
+  uint64_t result = y_high + (z < y_low ? 1 : 0);
+  // Since g overestimates the scaling factor a little, a fraction of z <= 1
+  // corresponds to an exact result.
+  return result | (z > 1 ? 1 : 0);
+}
+
+static int CountDecimalDigits(uint64_t value) {
+  int digits = 1;
+  while (value >= 10) {
+    value /= 10;
+    digits++;
+  }
+  return digits;
+}
+
+void SchubfachDtoa(double v, Vector<char> buffer, int* length, int* point) {
+  DCHECK_GT(v, 0);
+  DCHECK(!Double(v).IsSpecial());
+  Double d(v);
+  const uint64_t c = d.Significand();
+  const int q = d.Exponent();
+  const bool is_even = (c & 1) == 0;
+  // The distance to the next lower double is only half as large as the
+  // distance to the next greater one if v is a power of two (and not the
+  // smallest normal double).
+  const bool lower_is_closer = d.LowerBoundaryIsCloser();
+
+  const uint64_t cbl = 4 * c - 2 + (lower_is_closer ? 1 : 0);
+  const uint64_t cb = 4 * c;
+  const uint64_t cbr = 4 * c + 2;
+
+  const int k =
+      lower_is_closer ? FloorLog10ThreeQuartersPow2(q) : FloorLog10Pow2(q);
+  // The shift makes cb * 2^h * g / 2^128 equal to cb * 2^q * 10^-k.
+  const int h = q + FloorLog2Pow10(-k) + 1;
+  DCHECK(1 <= h && h <= 4);
+  // Round up the truncated table entry, so that it overestimates 10^-k.
+  PowerOfTen128 power = GetPowerOfTen128(-k);
+  uint64_t g_low = power.low + 1;
+  uint64_t g_high = power.high + (g_low == 0 ? 1 : 0);
+
+  const uint64_t vbl = RoundToOdd(g_high, g_low, cbl << h);
+  const uint64_t vb = RoundToOdd(g_high, g_low, cb << h);
+  const uint64_t vbr = RoundToOdd(g_high, g_low, cbr << h);
+  const uint64_t lower = vbl + (is_even ? 0 : 1);
+  const uint64_t upper = vbr - (is_even ? 0 : 1);
+
+  uint64_t significand;
+  int exponent;
+  // vb is 4 * v * 10^-k, so s is the integral part of v in units of 10^k.
+  const uint64_t s = vb / 4;
+  // Try the shorter candidates first: u' and w' = u' + 10^(k+1) are the
+  // multiples of 10^(k+1) around v.
+  const uint64_t sp = s / 10;
+  const bool up_inside = lower <= 40 * sp;
+  const bool wp_inside = 40 * sp + 40 <= upper;
+  if (sp != 0 && up_inside != wp_inside) {
+    significand = sp + (wp_inside ? 1 : 0);
+    exponent = k + 1;
+  } else {
+    // Otherwise, pick the multiple of 10^k that's closest to v, breaking
+    // ties towards an even digit, unless only one of them is in R.
+    const bool u_inside = lower <= 4 * s;
+    const bool w_inside = 4 * s + 4 <= upper;
+    if (u_inside != w_inside) {
+      significand = s + (w_inside ? 1 : 0);
+    } else {
+      const uint64_t mid = 4 * s + 2;
+      const bool round_up = vb > mid || (vb == mid && (s & 1) != 0);
+      significand = s + (round_up ? 1 : 0);
+    }
+    exponent = k;
+  }
+
+  // Remove trailing zeros; the digits are the same.
+  while (significand % 10 == 0) {
+    significand /= 10;
+    exponent++;
+  }
+  const int digits = CountDecimalDigits(significand);
+  DCHECK_LT(digits, buffer.length());
+  for (int i = digits - 1; i >= 0; i--) {
+    buffer[i] = static_cast<char>('0' + significand % 10);
+    significand /= 10;
+  }
+  buffer[digits] = '\0';
+  *length = digits;
+  *point = exponent + digits;
+}
+
+}  // namespace base
+}  // namespace v8
@@ -0,0 +1,34 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_BASE_NUMBERS_SCHUBFACH_DTOA_H_
+#define V8_BASE_NUMBERS_SCHUBFACH_DTOA_H_
+
+#include "src/base/vector.h"
+
+namespace v8 {
+namespace base {
+
+// Computes the shortest decimal representation of v, using Raffaello
+// Giulietti's Schubfach algorithm. Unlike FastDtoa in shortest mode, this
+// never fails, so there is no need for a bignum fallback.
+// The result should be interpreted as buffer * 10^(point - length).
+//
+// Precondition:
+//   * v must be a strictly positive finite double.
+//
+// The result satisfies v == (double) (buffer * 10^(point - length)), and the
+// digits in the buffer are the shortest representation possible, without
+// trailing '0's. If several representations of that length exist, the buffer
+// contains the one closest to v; exact ties are broken towards an even last
+// digit. This matches BignumDtoa in BIGNUM_DTOA_SHORTEST mode.
+// The buffer must hold at least kBase10MaximalLength + 1 characters; the
+// digits are followed by a null terminator.
+V8_BASE_EXPORT void SchubfachDtoa(double v, Vector<char> buffer, int* length,
+                                  int* point);
+
+}  // namespace base
+}  // namespace v8
+
+#endif  // V8_BASE_NUMBERS_SCHUBFACH_DTOA_H_
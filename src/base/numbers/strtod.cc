@@ -9,9 +9,11 @@
 #include <cmath>
 #include <limits>
 
+#include "src/base/bits.h"
 #include "src/base/numbers/bignum.h"
 #include "src/base/numbers/cached-powers.h"
 #include "src/base/numbers/double.h"
+#include "src/base/numbers/powers-of-ten-128.h"
 
 namespace v8 {
 namespace base {
@@ -200,6 +202,74 @@ static bool DoubleStrtod(Vector<const char> trimmed, int exponent,
 #endif
 }
 
+// Computes significand * 10^exponent with the Eisel-Lemire algorithm, see
+//   Daniel Lemire: "Number Parsing at a Gigabyte per Second" (2021).
+// The product of the significand with a 128-bit approximation of 10^exponent
+// almost always determines the correctly rounded double. Returns false if it
+// doesn't, and also for results that are subnormal or out of range.
+static bool EiselLemire(uint64_t significand, int exponent, double* result) {
+  DCHECK_NE(significand, 0);
+  if (exponent < kMinPowerOfTen128 || exponent > kMaxPowerOfTen128) {
+    return false;
+  }
+  const int leading_zeros = bits::CountLeadingZeros64(significand);
+  significand <<= leading_zeros;
+  PowerOfTen128 power = GetPowerOfTen128(exponent);
+  uint64_t high;
+  uint64_t low = MultiplyFull64(significand, power.high, &high);
+  // The truncated low half of 10^exponent can only matter if the 9 bits below
+  // the 54 we keep are all ones, and adding it could carry into them.
+  if ((high & 0x1FF) == 0x1FF && low + significand < significand) {
+    uint64_t extra_high;
+    uint64_t extra_low = MultiplyFull64(significand, power.low, &extra_high);
+    uint64_t merged_low = low + extra_high;
+    uint64_t merged_high = high + (merged_low < low ? 1 : 0);
+    if ((merged_high & 0x1FF) == 0x1FF && merged_low + 1 == 0 &&
+        extra_low + significand < significand) {
+      return false;
+    }
+    high = merged_high;
+    low = merged_low;
+  }
+  // Keep 54 bits, so that we can round to 53 bits.
+  const int upper_bit = static_cast<int>(high >> 63);
+  uint64_t mantissa = high >> (upper_bit + 9);
+  // (exponent * 217706) >> 16 is floor(log2(10^exponent)) for the range of
+  // exponents we support.
+  int biased_exponent =
+      ((exponent * 217706) >> 16) + 63 + upper_bit + 0x3FF - leading_zeros;
+  // If we are exactly halfway between two doubles, the truncated bits of
+  // 10^exponent would have to decide.
+  if (low == 0 && (high & 0x1FF) == 0 && (mantissa & 3) == 1) return false;
+  mantissa += mantissa & 1;
+  mantissa >>= 1;
+  if (mantissa >> Double::kSignificandSize != 0) {
+    mantissa >>= 1;
+    biased_exponent++;
+  }
+  if (biased_exponent <= 0 || biased_exponent >= 0x7FF) return false;
+  *result = Double((static_cast<uint64_t>(biased_exponent)
+                    << Double::kPhysicalSignificandSize) |
+                   (mantissa & Double::kSignificandMask))
+                .value();
+  return true;
+}
+
+// Reads up to 19 digits of the input for Eisel-Lemire. If the input is
+// longer, its exact value lies strictly between the truncated significand and
+// the next larger one (the trailing digits aren't all zero). If both round to
+// the same double, then so does the input.
+static bool EiselLemireStrtod(Vector<const char> trimmed, int exponent,
+                              double* result) {
+  int read_digits;
+  uint64_t significand = ReadUint64(trimmed, &read_digits);
+  exponent += trimmed.length() - read_digits;
+  if (!EiselLemire(significand, exponent, result)) return false;
+  if (read_digits == trimmed.length()) return true;
+  double upper;
+  return EiselLemire(significand + 1, exponent, &upper) && upper == *result;
+}
+
 // Returns 10^exponent as an exact DiyFp.
 // The given exponent must be in the range [1; kDecimalExponentDistance[.
 static DiyFp AdjustmentPowerOfTen(int exponent) {
@@ -408,6 +478,7 @@ double Strtod(Vector<const char> buffer, int exponent) {
 
   double guess;
   if (DoubleStrtod(trimmed, exponent, &guess) ||
+      EiselLemireStrtod(trimmed, exponent, &guess) ||
       DiyFpStrtod(trimmed, exponent, &guess)) {
     return guess;
   }
@@ -199,6 +199,8 @@ bool OS::DiscardSystemPages(void* address, size_t size) {
   return ptr;
 }
 
+bool OS::AdviseHugePages(void* address, size_t size) { return false; }
+
 // static
 bool OS::HasLazyCommits() {
   // TODO(alph): implement for the platform.
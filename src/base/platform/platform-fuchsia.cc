@@ -155,6 +155,8 @@ bool OS::DecommitPages(void* address, size_t size) {
          DiscardSystemPages(address, size);
 }
 
+bool OS::AdviseHugePages(void* address, size_t size) { return false; }
+
 // static
 bool OS::HasLazyCommits() {
   // TODO(scottmg): Port, https://crbug.com/731217.
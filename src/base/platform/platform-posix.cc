@@ -40,6 +40,7 @@
 #include "src/base/macros.h"
 #include "src/base/platform/platform.h"
 #include "src/base/platform/time.h"
+#include "src/base/sys-info.h"
 #include "src/base/utils/random-number-generator.h"
 
 #ifdef V8_FAST_TLS_SUPPORTED
@@ -509,6 +510,14 @@ bool OS::DecommitPages(void* address, size_t size) {
   return ptr == address;
 }
 
+bool OS::AdviseHugePages(void* address, size_t size) {
+#if V8_OS_LINUX && defined(MADV_HUGEPAGE)
+  return madvise(address, size, MADV_HUGEPAGE) == 0;
+#else
+  return false;
+#endif
+}
+
 // static
 bool OS::HasLazyCommits() {
 #if V8_OS_AIX || V8_OS_LINUX || V8_OS_MACOSX
@@ -929,6 +938,68 @@ bool Thread::Start() {
 
 void Thread::Join() { pthread_join(data_->thread_, nullptr); }
 
+#if V8_OS_LINUX
+namespace {
+
+struct InitialAffinity {
+  InitialAffinity() {
+    CPU_ZERO(&cpu_set);
+    valid = sched_getaffinity(0, sizeof(cpu_set), &cpu_set) == 0;
+  }
+
+  cpu_set_t cpu_set;
+  bool valid;
+};
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(InitialAffinity, GetInitialAffinity)
+
+}  // namespace
+#endif  // V8_OS_LINUX
+
+// static
+bool Thread::SetCurrentThreadPriority(Priority priority) {
+#if V8_OS_MACOSX
+  qos_class_t qos_class = QOS_CLASS_DEFAULT;
+  switch (priority) {
+    case Priority::kBestEffort:
+      qos_class = QOS_CLASS_UTILITY;
+      break;
+    case Priority::kUserBlocking:
+      qos_class = QOS_CLASS_USER_INITIATED;
+      break;
+    case Priority::kUserVisible:
+    case Priority::kDefault:
+      break;
+  }
+  return pthread_set_qos_class_self_np(qos_class, 0) == 0;
+#elif V8_OS_LINUX
+  // Niceness is not used, since unprivileged threads cannot lower it again.
+  const InitialAffinity* initial = GetInitialAffinity();
+  if (!initial->valid) return false;
+  const std::vector<int>* cpus = nullptr;
+  if (priority == Priority::kUserBlocking) {
+    cpus = &SysInfo::PerformanceProcessors();
+  } else if (priority == Priority::kBestEffort) {
+    cpus = &SysInfo::EfficiencyProcessors();
+  }
+  cpu_set_t cpu_set = initial->cpu_set;
+  if (cpus != nullptr && !cpus->empty()) {
+    cpu_set_t restricted;
+    CPU_ZERO(&restricted);
+    for (int cpu : *cpus) {
+      if (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &initial->cpu_set)) {
+        CPU_SET(cpu, &restricted);
+      }
+    }
+    if (CPU_COUNT(&restricted) > 0) cpu_set = restricted;
+  }
+  return sched_setaffinity(0, sizeof(cpu_set), &cpu_set) == 0;
+#else
+  USE(priority);
+  return false;
+#endif
+}
+
 static Thread::LocalStorageKey PthreadKeyToLocalKey(pthread_key_t pthread_key) {
 #if V8_OS_CYGWIN
   // We need to cast pthread_key_t to Thread::LocalStorageKey in two steps
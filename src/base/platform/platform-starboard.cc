@@ -412,6 +412,12 @@ bool Thread::Start() {
 
 void Thread::Join() { SbThreadJoin(data_->thread_, nullptr); }
 
+// static
+bool Thread::SetCurrentThreadPriority(Priority priority) {
+  USE(priority);
+  return false;
+}
+
 Thread::LocalStorageKey Thread::CreateThreadLocalKey() {
   return SbThreadCreateLocalKey(nullptr);
 }
@@ -485,6 +491,11 @@ bool OS::DiscardSystemPages(void* address, size_t size) {
   return true;
 }
 
+bool OS::AdviseHugePages(void* address, size_t size) {
+  // Starboard API does not support this function yet.
+  return false;
+}
+
 // static
 Stack::StackSlot Stack::GetCurrentStackPosition() {
   void* addresses[kStackSize];
@@ -896,6 +896,12 @@ bool OS::Release(void* address, size_t size) {
   return VirtualFree(address, size, MEM_DECOMMIT) != 0;
 }
 
+bool OS::AdviseHugePages(void* address, size_t size) {
+  // Large pages on Windows have to be allocated up front with
+  // MEM_LARGE_PAGES and cannot be requested for an existing range.
+  return false;
+}
+
 // static
 bool OS::SetPermissions(void* address, size_t size, MemoryPermission access) {
   DCHECK_EQ(0, reinterpret_cast<uintptr_t>(address) % CommitPageSize());
@@ -1412,6 +1418,23 @@ void Thread::Join() {
   }
 }
 
+// static
+bool Thread::SetCurrentThreadPriority(Priority priority) {
+  int thread_priority = THREAD_PRIORITY_NORMAL;
+  switch (priority) {
+    case Priority::kBestEffort:
+      thread_priority = THREAD_PRIORITY_BELOW_NORMAL;
+      break;
+    case Priority::kUserBlocking:
+      thread_priority = THREAD_PRIORITY_ABOVE_NORMAL;
+      break;
+    case Priority::kUserVisible:
+    case Priority::kDefault:
+      break;
+  }
+  return ::SetThreadPriority(::GetCurrentThread(), thread_priority) != 0;
+}
+
 
 Thread::LocalStorageKey Thread::CreateThreadLocalKey() {
   DWORD result = TlsAlloc();
@@ -326,6 +326,11 @@ class V8_BASE_EXPORT OS {
 
   V8_WARN_UNUSED_RESULT static bool DecommitPages(void* address, size_t size);
 
+  // Asks the OS to back the given range with transparent huge pages. Returns
+  // false if huge pages are not supported or the request was rejected, in
+  // which case the range stays backed by regular pages.
+  static bool AdviseHugePages(void* address, size_t size);
+
   static const int msPerSecond = 1000;
 
 #if V8_OS_POSIX
@@ -400,6 +405,16 @@ class V8_BASE_EXPORT Thread {
   // Wait until thread terminates.
   void Join();
 
+  // Scheduling hints for the work a thread does, following v8::TaskPriority.
+  enum class Priority { kBestEffort, kUserVisible, kUserBlocking, kDefault };
+
+  // Applies |priority| to the calling thread. On Linux with different core
+  // types, kUserBlocking restricts the thread to the performance cores and
+  // kBestEffort to the efficiency cores (within the initial affinity mask).
+  // On macOS it selects the QoS class, which also steers the core type, and on
+  // Windows the thread priority. Returns false if nothing was applied.
+  static bool SetCurrentThreadPriority(Priority priority);
+
   inline const char* name() const {
     return name_;
   }
@@ -18,8 +18,16 @@
 #include <sys/sysctl.h>
 #endif
 
+#if V8_OS_LINUX
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#endif
+
+#include <algorithm>
 #include <limits>
 
+#include "src/base/lazy-instance.h"
 #include "src/base/logging.h"
 #include "src/base/macros.h"
 #if V8_OS_WIN
@@ -35,6 +43,107 @@
 namespace v8 {
 namespace base {
 
+namespace {
+
+#if V8_OS_LINUX
+// Reads the first line of a sysfs or cgroupfs file into |buffer|.
+bool ReadFirstLine(const char* path, char* buffer, int size) {
+  FILE* file = fopen(path, "r");
+  if (file == nullptr) return false;
+  bool result = fgets(buffer, size, file) != nullptr;
+  fclose(file);
+  return result;
+}
+
+// Parses a CPU list such as "0-3,8,10-11".
+std::vector<int> ReadProcessorList(const char* path) {
+  std::vector<int> result;
+  char buffer[1024];
+  if (!ReadFirstLine(path, buffer, sizeof(buffer))) return result;
+  const char* p = buffer;
+  while (*p != '\0' && *p != '\n') {
+    char* end;
+    long first = strtol(p, &end, 10);  // NOLINT(runtime/int)
+    if (end == p) return std::vector<int>();
+    long last = first;                 // NOLINT(runtime/int)
+    p = end;
+    if (*p == '-') {
+      last = strtol(p + 1, &end, 10);
+      if (end == p + 1 || last < first) return std::vector<int>();
+      p = end;
+    }
+    for (long cpu = first; cpu <= last; ++cpu) {  // NOLINT(runtime/int)
+      result.push_back(static_cast<int>(cpu));
+    }
+    if (*p == ',') ++p;
+  }
+  return result;
+}
+
+// Returns the number of processors allowed by the CPU bandwidth limit of the
+// cgroup (v2 or v1) mounted at /sys/fs/cgroup, or 0 if there is none.
+int CgroupProcessorQuota() {
+  char buffer[128];
+  long quota = -1;   // NOLINT(runtime/int)
+  long period = 0;   // NOLINT(runtime/int)
+  if (ReadFirstLine("/sys/fs/cgroup/cpu.max", buffer, sizeof(buffer))) {
+    // "max 100000" or "<quota> <period>".
+    if (sscanf(buffer, "%ld %ld", &quota, &period) != 2) return 0;
+  } else if (ReadFirstLine("/sys/fs/cgroup/cpu/cpu.cfs_quota_us", buffer,
+                           sizeof(buffer))) {
+    quota = strtol(buffer, nullptr, 10);
+    if (!ReadFirstLine("/sys/fs/cgroup/cpu/cpu.cfs_period_us", buffer,
+                       sizeof(buffer))) {
+      return 0;
+    }
+    period = strtol(buffer, nullptr, 10);
+  }
+  if (quota <= 0 || period <= 0) return 0;
+  return static_cast<int>((quota + period - 1) / period);
+}
+#endif  // V8_OS_LINUX
+
+struct CoreTypes {
+  CoreTypes() {
+#if V8_OS_LINUX
+    // Intel hybrid CPUs expose one perf PMU per core type.
+    performance = ReadProcessorList("/sys/devices/cpu_core/cpus");
+    efficiency = ReadProcessorList("/sys/devices/cpu_atom/cpus");
+    if (!performance.empty() && !efficiency.empty()) return;
+    performance.clear();
+    efficiency.clear();
+    // Arm kernels report the relative capacity of each processor.
+    long cpus = sysconf(_SC_NPROCESSORS_CONF);  // NOLINT(runtime/int)
+    std::vector<long> capacities;               // NOLINT(runtime/int)
+    for (long cpu = 0; cpu < cpus; ++cpu) {     // NOLINT(runtime/int)
+      char path[64];
+      char buffer[32];
+      snprintf(path, sizeof(path),
+               "/sys/devices/system/cpu/cpu%ld/cpu_capacity", cpu);
+      if (!ReadFirstLine(path, buffer, sizeof(buffer))) return;
+      capacities.push_back(strtol(buffer, nullptr, 10));
+    }
+    if (capacities.empty()) return;
+    auto minmax = std::minmax_element(capacities.begin(), capacities.end());
+    if (*minmax.first == *minmax.second) return;
+    for (size_t cpu = 0; cpu < capacities.size(); ++cpu) {
+      if (capacities[cpu] == *minmax.second) {
+        performance.push_back(static_cast<int>(cpu));
+      } else {
+        efficiency.push_back(static_cast<int>(cpu));
+      }
+    }
+#endif  // V8_OS_LINUX
+  }
+
+  std::vector<int> performance;
+  std::vector<int> efficiency;
+};
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(CoreTypes, GetCoreTypes)
+
+}  // namespace
+
 // static
 int SysInfo::NumberOfProcessors() {
 #if V8_OS_OPENBSD
@@ -60,6 +169,30 @@ int SysInfo::NumberOfProcessors() {
 #endif
 }
 
+// static
+int SysInfo::NumberOfAvailableProcessors() {
+  int result = NumberOfProcessors();
+#if V8_OS_LINUX
+  cpu_set_t cpu_set;
+  if (sched_getaffinity(0, sizeof(cpu_set), &cpu_set) == 0) {
+    result = std::min(result, CPU_COUNT(&cpu_set));
+  }
+  int quota = CgroupProcessorQuota();
+  if (quota > 0) result = std::min(result, quota);
+#endif
+  return std::max(result, 1);
+}
+
+// static
+const std::vector<int>& SysInfo::PerformanceProcessors() {
+  return GetCoreTypes()->performance;
+}
+
+// static
+const std::vector<int>& SysInfo::EfficiencyProcessors() {
+  return GetCoreTypes()->efficiency;
+}
+
 
 // static
 int64_t SysInfo::AmountOfPhysicalMemory() {
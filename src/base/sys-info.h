@@ -7,6 +7,8 @@
 
 #include <stdint.h>
 
+#include <vector>
+
 #include "src/base/base-export.h"
 #include "src/base/compiler-specific.h"
 
@@ -18,6 +20,17 @@ class V8_BASE_EXPORT SysInfo final {
   // Returns the number of logical processors/core on the current machine.
   static int NumberOfProcessors();
 
+  // Returns the number of processors the current process can use, taking into
+  // account its CPU affinity mask and, on Linux, the CPU quota of its cgroup.
+  // At least 1 and at most NumberOfProcessors().
+  static int NumberOfAvailableProcessors();
+
+  // On CPUs with different core types (e.g. Arm big.LITTLE or Intel hybrid
+  // CPUs), return the ids of the fastest and of all slower processors. Both
+  // are empty if all cores are of one type or the types are unknown.
+  static const std::vector<int>& PerformanceProcessors();
+  static const std::vector<int>& EfficiencyProcessors();
+
   // Returns the number of bytes of physical memory on the current machine.
   static int64_t AmountOfPhysicalMemory();
 
@@ -225,7 +225,8 @@ BaselineBatchCompiler::BaselineBatchCompiler(Isolate* isolate)
       compilation_queue_(Handle<WeakFixedArray>::null()),
       last_index_(0),
       estimated_instruction_size_(0),
-      enabled_(true) {
+      enabled_(true),
+      concurrent_(FLAG_concurrent_sparkplug) {
   if (FLAG_concurrent_sparkplug) {
     concurrent_compiler_ =
         std::make_unique<ConcurrentBaselineCompiler>(isolate_);
@@ -280,7 +281,7 @@ void BaselineBatchCompiler::EnqueueFunction(Handle<JSFunction> function) {
              "functions\n",
              (last_index_ + 1));
     }
-    if (FLAG_concurrent_sparkplug) {
+    if (is_concurrent()) {
       Enqueue(shared);
       concurrent_compiler_->CompileBatch(compilation_queue_, last_index_);
       ClearBatch();
@@ -298,7 +299,9 @@ void BaselineBatchCompiler::Enqueue(Handle<SharedFunctionInfo> shared) {
 }
 
 void BaselineBatchCompiler::InstallBatch() {
-  DCHECK(FLAG_concurrent_sparkplug);
+  // Batches that are still in flight are installed even if concurrent
+  // compilation has been disabled in the meantime.
+  DCHECK_NOT_NULL(concurrent_compiler_);
   concurrent_compiler_->InstallBatch();
 }
 
@@ -375,7 +378,8 @@ BaselineBatchCompiler::BaselineBatchCompiler(Isolate* isolate)
       compilation_queue_(Handle<WeakFixedArray>::null()),
       last_index_(0),
       estimated_instruction_size_(0),
-      enabled_(false) {}
+      enabled_(false),
+      concurrent_(false) {}
 
 BaselineBatchCompiler::~BaselineBatchCompiler() {
   if (!compilation_queue_.is_null()) {
@@ -29,6 +29,14 @@ class BaselineBatchCompiler {
   void set_enabled(bool enabled) { enabled_ = enabled; }
   bool is_enabled() { return enabled_; }
 
+  // Batches are compiled on background threads and only installed on the main
+  // thread if concurrent compilation is enabled for this isolate. It can only
+  // be enabled with --concurrent-sparkplug, which is also its default.
+  void set_concurrent(bool concurrent) {
+    concurrent_ = concurrent && concurrent_compiler_ != nullptr;
+  }
+  bool is_concurrent() const { return concurrent_; }
+
   void InstallBatch();
 
  private:
@@ -69,6 +77,9 @@ class BaselineBatchCompiler {
   // Batch compilation can be dynamically disabled e.g. when creating snapshots.
   bool enabled_;
 
+  // Flag indicating whether batches are compiled concurrently.
+  bool concurrent_;
+
   // Handle to the background compilation jobs.
   std::unique_ptr<ConcurrentBaselineCompiler> concurrent_compiler_;
 };
@@ -1334,6 +1334,11 @@ void BaselineCompiler::VisitIntrinsicCreateAsyncFromSyncIterator(
   CallBuiltin<Builtin::kCreateAsyncFromSyncIteratorBaseline>(args[0]);
 }
 
+void BaselineCompiler::VisitIntrinsicIsFastJSArrayForDestructuring(
+    interpreter::RegisterList args) {
+  CallBuiltin<Builtin::kIsFastJSArrayForDestructuring>(args[0]);
+}
+
 void BaselineCompiler::VisitIntrinsicCreateJSGeneratorObject(
     interpreter::RegisterList args) {
   CallBuiltin<Builtin::kCreateGeneratorObject>(args);
@@ -1898,6 +1903,17 @@ void BaselineCompiler::VisitCreateRestParameter() {
   CallBuiltin<Builtin::kFastNewRestArguments>(__ FunctionOperand());
 }
 
+void BaselineCompiler::VisitLdaArgumentsLength() {
+  CallBuiltin<Builtin::kLoadArgumentsLengthBaseline>(FlagAsSmi(0));  // type
+}
+
+void BaselineCompiler::VisitLdaKeyedArgument() {
+  CallBuiltin<Builtin::kLoadKeyedArgumentBaseline>(
+      kInterpreterAccumulatorRegister,  // key
+      FlagAsSmi(0),                     // type
+      IndexAsTagged(1));                // slot
+}
+
 void BaselineCompiler::VisitJumpLoop() {
   BaselineAssembler::ScratchRegisterScope scope(&basm_);
   Register scratch = scope.AcquireScratch();
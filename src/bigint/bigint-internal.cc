@@ -4,6 +4,8 @@
 
 #include "src/bigint/bigint-internal.h"
 
+#include <utility>
+
 namespace v8 {
 namespace bigint {
 
@@ -26,6 +28,57 @@ Status ProcessorImpl::get_and_clear_status() {
   return result;
 }
 
+// Returns {base}^(2^k), which needs 2^k digits of storage when {base} is
+// a digit. The powers for the most recently used {base} are cached.
+Digits ProcessorImpl::GetPowerOfTwoPower(digit_t base, int k) {
+  if (base != power_cache_base_) {
+    power_cache_.clear();
+    power_cache_base_ = base;
+  }
+  while (static_cast<int>(power_cache_.size()) <= k) {
+    int n = static_cast<int>(power_cache_.size());
+    int len = 1 << n;
+    CachedPower entry;
+    entry.power.reset(new digit_t[len]);
+    if (n == 0) {
+      entry.power[0] = base;
+    } else {
+      Digits previous(power_cache_.back().power.get(), len / 2);
+      Multiply(RWDigits(entry.power.get(), len), previous, previous);
+      // Don't cache incomplete results.
+      if (should_terminate()) return Digits(nullptr, 0);
+    }
+    power_cache_.push_back(std::move(entry));
+  }
+  return Digits(power_cache_[k].power.get(), 1 << k);
+}
+
+// Returns an empty {Digits} if the inverse hasn't been computed yet.
+Digits ProcessorImpl::GetCachedInverse(digit_t base, int k) {
+  if (base != power_cache_base_ || k >= static_cast<int>(power_cache_.size())) {
+    return Digits(nullptr, 0);
+  }
+  return power_cache_[k].inverse;
+}
+
+void ProcessorImpl::SetCachedInverse(digit_t base, int k,
+                                     std::unique_ptr<Storage> storage,
+                                     Digits inverse) {
+  if (base != power_cache_base_ || k >= static_cast<int>(power_cache_.size())) {
+    return;
+  }
+  power_cache_[k].inverse_storage = std::move(storage);
+  power_cache_[k].inverse = inverse;
+}
+
+// Drops the largest cached powers, so that a single huge conversion doesn't
+// tie up its memory for the rest of the processor's life time.
+void ProcessorImpl::TrimPowerCache() {
+  if (static_cast<int>(power_cache_.size()) > kMaxCachedPowers) {
+    power_cache_.resize(kMaxCachedPowers);
+  }
+}
+
 Processor* Processor::New(Platform* platform) {
   ProcessorImpl* impl = new ProcessorImpl(platform);
   return static_cast<Processor*>(impl);
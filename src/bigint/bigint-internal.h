@@ -6,6 +6,7 @@
 #define V8_BIGINT_BIGINT_INTERNAL_H_
 
 #include <memory>
+#include <vector>
 
 #include "src/bigint/bigint.h"
 
@@ -23,6 +24,12 @@ constexpr int kNewtonInversionThreshold = 50;
 
 constexpr int kToStringFastThreshold = 43;
 constexpr int kFromStringLargeThreshold = 300;
+// Powers up to base^(2^(kMaxCachedPowers - 1)) stay cached between
+// conversions; that's 2^kMaxCachedPowers digits of memory, plus about as
+// much again for their inverses.
+constexpr int kMaxCachedPowers = 15;
+
+class Storage;
 
 class ProcessorImpl : public Processor {
  public:
@@ -73,6 +80,15 @@ class ProcessorImpl : public Processor {
   void FromStringLarge(RWDigits Z, FromStringAccumulator* accumulator);
   void FromStringBasePowerOfTwo(RWDigits Z, FromStringAccumulator* accumulator);
 
+  // The power cache holds {base}^(2^k) for the most recently used {base},
+  // which both string conversion directions need for fast algorithms.
+  // {ToString} also stores the inverses it computes for Barrett division.
+  Digits GetPowerOfTwoPower(digit_t base, int k);
+  Digits GetCachedInverse(digit_t base, int k);
+  void SetCachedInverse(digit_t base, int k, std::unique_ptr<Storage> storage,
+                        Digits inverse);
+  void TrimPowerCache();
+
   bool should_terminate() { return status_ == Status::kInterrupted; }
 
   // Each unit is supposed to represent approximately one CPU {mul} instruction.
@@ -96,6 +112,14 @@ class ProcessorImpl : public Processor {
   uintptr_t work_estimate_{0};
   Status status_{Status::kOk};
   Platform* platform_;
+  struct CachedPower {
+    std::unique_ptr<digit_t[]> power;
+    std::unique_ptr<Storage> inverse_storage;
+    Digits inverse{nullptr, 0};
+  };
+
+  digit_t power_cache_base_{0};
+  std::vector<CachedPower> power_cache_;
 };
 
 // These constants are primarily needed for Barrett division in div-barrett.cc,
@@ -2,7 +2,10 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+
 #include "src/bigint/bigint-internal.h"
+#include "src/bigint/digit-arithmetic.h"
 #include "src/bigint/vector-arithmetic.h"
 
 namespace v8 {
@@ -51,165 +54,101 @@ void ProcessorImpl::FromStringClassic(RWDigits Z,
 // Multiply-and-add neighboring pairs of parts, then loop, until only one
 // part is left. The benefit is that the multiplications will have inputs of
 // similar sizes, which makes them amenable to fast multiplication algorithms.
-// We have to do more multiplications than the classic algorithm though,
-// because we also have to multiply the multipliers.
 // Optimizations:
-// - We can skip the multiplier for the first part, because we never need it.
-// - Most multipliers are the same; we can avoid repeated multiplications and
-//   just copy the previous result. (In theory we could even de-dupe them, but
-//   as the parts/multipliers grow, we'll need most of the memory anyway.)
-//   Copied results are marked with a * below.
-// - We can re-use memory using a system of three buffers whose usage rotates:
-//   - one is considered empty, and is overwritten with the new parts,
-//   - one holds the multipliers (and will be "empty" in the next round), and
-//   - one initially holds the parts and is overwritten with the new multipliers
-//   Parts and multipliers both grow in each iteration, and get fewer, so we
-//   use the space of two adjacent old chunks for one new chunk.
-//   Since the {heap_parts_} vectors has the right size, and so does the
-//   result {Z}, we can use that memory, and only need to allocate one scratch
-//   vector. If the final result ends up in the wrong bucket, we have to copy it
-//   to the correct one.
+// - All parts except the last have been accumulated with the same
+//   {max_multiplier_}. We combine those first and only fold in the last part
+//   at the very end, which is a single-digit multiply-and-add. Since we
+//   also group parts from the least significant end, every right-hand
+//   neighbor then spans exactly 2^k parts, so the only multipliers we ever
+//   need are the powers {max_multiplier_}^(2^k). Only the leftmost (most
+//   significant) chunk of each round can span fewer parts, and its
+//   multiplier is never needed.
+// - These powers depend only on the radix, so they are kept in the
+//   processor's power cache (see {GetPowerOfTwoPower}). Repeated
+//   conversions only pay for the parts' multiplications.
+// - We can re-use memory by alternating between two buffers: in each round,
+//   chunks are read from one and the combined chunks are written to the
+//   other, at the same offsets, since a chunk spanning N parts fits into N
+//   digits. The {heap_parts_} vector and the result {Z} both have the right
+//   size, so we don't need to allocate anything else. If the final result
+//   ends up in the wrong buffer, folding in the last part moves it to {Z}.
 // - We don't have to keep track of the positions and sizes of the chunks,
 //   because we can deduce their precise placement from the iteration index.
 //
 // Example, assuming digit_t is 4 bits, fitting one decimal digit:
 // Initial state:
 // parts_:        1  2  3  4  5  6  7  8  9  0  1  2  3  4  5
-// multipliers_: 10 10 10 10 10 10 10 10 10 10 10 10 10 10 10
-// After the first iteration of the outer loop:
-// parts:         12    34    56    78    90    12    34    5
-// multipliers:        100  *100  *100  *100  *100  *100   10
-// After the second iteration:
-// parts:         1234        5678        9012        345
-// multipliers:              10000      *10000       1000
-// After the third iteration:
-// parts:         12345678                9012345
-// multipliers:                          10000000
-// And then there's an obvious last iteration.
+// After the first iteration of the outer loop (multiplier 10):
+// parts:         12    34    56    78    90    12    34  | 5
+// After the second iteration (multiplier 100):
+// parts:         12    3456        7890        1234      | 5
+// After the third iteration (multiplier 10000):
+// parts:         123456            78901234              | 5
+// After the fourth iteration (multiplier 100000000):
+// parts:         12345678901234                        | 5
+// Finally, the last part is folded in: 12345678901234 * 10 + 5.
 void ProcessorImpl::FromStringLarge(RWDigits Z,
                                     FromStringAccumulator* accumulator) {
   int num_parts = static_cast<int>(accumulator->heap_parts_.size());
   DCHECK(num_parts >= 2);  // NOLINT(readability/check)
   DCHECK(Z.len() >= num_parts);
-  RWDigits parts(accumulator->heap_parts_.data(), num_parts);
-  Storage multipliers_storage(num_parts);
-  RWDigits multipliers(multipliers_storage.get(), num_parts);
-  RWDigits temp(Z, 0, num_parts);
-  // Unrolled and specialized first iteration: part_len == 1, so instead of
-  // Digits sub-vectors we have individual digit_t values, and the multipliers
-  // are known up front.
-  {
-    digit_t max_multiplier = accumulator->max_multiplier_;
-    digit_t last_multiplier = accumulator->last_multiplier_;
-    RWDigits new_parts = temp;
-    RWDigits new_multipliers = parts;
-    int i = 0;
-    for (; i + 1 < num_parts; i += 2) {
-      digit_t p_in = parts[i];
-      digit_t p_in2 = parts[i + 1];
-      digit_t m_in = max_multiplier;
-      digit_t m_in2 = i == num_parts - 2 ? last_multiplier : max_multiplier;
-      // p[j] = p[i] * m[i+1] + p[i+1]
-      digit_t p_high;
-      digit_t p_low = digit_mul(p_in, m_in2, &p_high);
+  // The last part is left untouched by the loops below.
+  const int num_full_parts = num_parts - 1;
+  const digit_t last_part = accumulator->heap_parts_[num_full_parts];
+  const digit_t max_multiplier = accumulator->max_multiplier_;
+  RWDigits parts(accumulator->heap_parts_.data(), num_full_parts);
+  RWDigits temp(Z, 0, num_full_parts);
+  // Unrolled and specialized first iteration: chunk_len == 1, so instead of
+  // Digits sub-vectors we have individual digit_t values, and the multiplier
+  // is known up front.
+  int chunk_len = 1;
+  if (num_full_parts > 1) {
+    int end = num_full_parts;
+    for (; end >= 2; end -= 2) {
+      // p[j] = p[i] * m + p[i+1]
+      digit_t high;
+      digit_t low = digit_mul(parts[end - 2], max_multiplier, &high);
       digit_t carry;
-      new_parts[i] = digit_add2(p_low, p_in2, &carry);
-      new_parts[i + 1] = p_high + carry;
-      // m[j] = m[i] * m[i+1]
-      if (i > 0) {
-        if (i > 2 && m_in2 != last_multiplier) {
-          new_multipliers[i] = new_multipliers[i - 2];
-          new_multipliers[i + 1] = new_multipliers[i - 1];
-        } else {
-          digit_t m_high;
-          new_multipliers[i] = digit_mul(m_in, m_in2, &m_high);
-          new_multipliers[i + 1] = m_high;
-        }
-      }
-    }
-    // Trailing last part (if {num_parts} was odd).
-    if (i < num_parts) {
-      new_parts[i] = parts[i];
-      new_multipliers[i] = last_multiplier;
-      i += 2;
+      temp[end - 2] = digit_add2(low, parts[end - 1], &carry);
+      temp[end - 1] = high + carry;
     }
-    num_parts = i >> 1;
-    RWDigits new_temp = multipliers;
-    parts = new_parts;
-    multipliers = new_multipliers;
-    temp = new_temp;
-    AddWorkEstimate(num_parts);
+    // Leading single part (if {num_full_parts} was odd).
+    if (end == 1) temp[0] = parts[0];
+    std::swap(parts, temp);
+    chunk_len = 2;
+    AddWorkEstimate(num_full_parts);
   }
-  int part_len = 2;
 
   // Remaining iterations.
-  while (num_parts > 1) {
-    RWDigits new_parts = temp;
-    RWDigits new_multipliers = parts;
-    int new_part_len = part_len * 2;
-    int i = 0;
-    for (; i + 1 < num_parts; i += 2) {
-      int start = i * part_len;
-      Digits p_in(parts, start, part_len);
-      Digits p_in2(parts, start + part_len, part_len);
-      Digits m_in(multipliers, start, part_len);
-      Digits m_in2(multipliers, start + part_len, part_len);
-      RWDigits p_out(new_parts, start, new_part_len);
-      RWDigits m_out(new_multipliers, start, new_part_len);
-      // p[j] = p[i] * m[i+1] + p[i+1]
-      Multiply(p_out, p_in, m_in2);
+  for (int k = 1; chunk_len < num_full_parts; k++) {
+    Digits multiplier = GetPowerOfTwoPower(max_multiplier, k);
+    if (should_terminate()) return;
+    DCHECK(multiplier.len() == chunk_len);
+    for (int end = num_full_parts; end > 0; end -= 2 * chunk_len) {
+      int middle = end - chunk_len;
+      int start = std::max(0, middle - chunk_len);
+      RWDigits p_out(temp, start, end - start);
+      if (middle <= 0) {
+        // Leading chunk without a left neighbor.
+        for (int i = 0; i < p_out.len(); i++) p_out[i] = parts[start + i];
+        break;
+      }
+      Digits p_left(parts, start, middle - start);
+      Digits p_right(parts, middle, chunk_len);
+      // p[j] = p[i] * m + p[i+1]
+      Multiply(p_out, p_left, multiplier);
       if (should_terminate()) return;
-      digit_t overflow = AddAndReturnOverflow(p_out, p_in2);
+      digit_t overflow = AddAndReturnOverflow(p_out, p_right);
       DCHECK(overflow == 0);  // NOLINT(readability/check)
       USE(overflow);
-      // m[j] = m[i] * m[i+1]
-      if (i > 0) {
-        bool copied = false;
-        if (i > 2) {
-          int prev_start = (i - 2) * part_len;
-          Digits m_in_prev(multipliers, prev_start, part_len);
-          Digits m_in2_prev(multipliers, prev_start + part_len, part_len);
-          if (Compare(m_in, m_in_prev) == 0 &&
-              Compare(m_in2, m_in2_prev) == 0) {
-            copied = true;
-            Digits m_out_prev(new_multipliers, prev_start, new_part_len);
-            for (int k = 0; k < new_part_len; k++) m_out[k] = m_out_prev[k];
-          }
-        }
-        if (!copied) {
-          Multiply(m_out, m_in, m_in2);
-          if (should_terminate()) return;
-        }
-      }
-    }
-    // Trailing last part (if {num_parts} was odd).
-    if (i < num_parts) {
-      Digits p_in(parts, i * part_len, part_len);
-      Digits m_in(multipliers, i * part_len, part_len);
-      RWDigits p_out(new_parts, i * part_len, new_part_len);
-      RWDigits m_out(new_multipliers, i * part_len, new_part_len);
-      int k = 0;
-      for (; k < p_in.len(); k++) p_out[k] = p_in[k];
-      for (; k < p_out.len(); k++) p_out[k] = 0;
-      k = 0;
-      for (; k < m_in.len(); k++) m_out[k] = m_in[k];
-      for (; k < m_out.len(); k++) m_out[k] = 0;
-      i += 2;
     }
-    num_parts = i >> 1;
-    part_len = new_part_len;
-    RWDigits new_temp = multipliers;
-    parts = new_parts;
-    multipliers = new_multipliers;
-    temp = new_temp;
-  }
-  // Copy the result to Z, if it doesn't happen to be there already.
-  if (parts.digits() != Z.digits()) {
-    int i = 0;
-    for (; i < parts.len(); i++) Z[i] = parts[i];
-    // Z might be bigger than we requested; be robust towards that.
-    for (; i < Z.len(); i++) Z[i] = 0;
+    std::swap(parts, temp);
+    chunk_len *= 2;
   }
+  // Fold in the last part. This also moves the result to Z, if it doesn't
+  // happen to be there already; both operations work in-place.
+  MultiplySingle(Z, parts, accumulator->last_multiplier_);
+  Add(Z, last_part);
 }
 
 // Specialized algorithms for power-of-two radixes. Designed to work with
@@ -318,6 +257,7 @@ void ProcessorImpl::FromString(RWDigits Z, FromStringAccumulator* accumulator) {
     FromStringClassic(Z, accumulator);
   } else {
     FromStringLarge(Z, accumulator);
+    TrimPowerCache();
   }
 }
 
@@ -4,6 +4,7 @@
 
 #include <cstring>
 #include <limits>
+#include <utility>
 
 #include "src/bigint/bigint-internal.h"
 #include "src/bigint/digit-arithmetic.h"
@@ -304,7 +305,10 @@ void ToStringFormatter::BasePowerOfTwo() {
 //       "1" "23" "45" "67" "89" "01" "23"
 //
 // We start building RecursionLevels in order 0 -> 1 -> 2, performing the
-// squarings 100² = 10000 and 10000² = 100000000 each only once. Execution
+// squarings 100² = 10000 and 10000² = 100000000 each only once. These
+// divisors only depend on the radix, so they are taken from the processor's
+// power cache, along with any inverses an earlier conversion has computed;
+// repeated conversions then only pay for the divisions. Execution
 // then happens in order (a) through (g); lower-level divisors are used
 // repeatedly. We build the string from right to left.
 // Note that we can skip the division at (g) and fall through directly.
@@ -329,21 +333,36 @@ class RecursionLevel {
  private:
   friend class ToStringFormatter;
   RecursionLevel(digit_t base_divisor, int base_char_count)
-      : char_count_(base_char_count), divisor_(1) {
+      : base_divisor_(base_divisor), char_count_(base_char_count), divisor_(1) {
     divisor_[0] = base_divisor;
   }
   explicit RecursionLevel(RecursionLevel* next)
-      : char_count_(next->char_count_ * 2),
+      : base_divisor_(next->base_divisor_),
+        power_index_(next->power_index_ + 1),
+        char_count_(next->char_count_ * 2),
         next_(next),
         divisor_(next->divisor_.len() * 2) {
     next->is_toplevel_ = false;
   }
 
+  // Sets the divisor to the given power of {base_divisor_}.
+  void SetDivisor(Digits power) {
+    power.Normalize();
+    DCHECK(power.len() <= divisor_.len());
+    int i = 0;
+    for (; i < power.len(); i++) divisor_[i] = power[i];
+    for (; i < divisor_.len(); i++) divisor_[i] = 0;
+    divisor_.Normalize();
+  }
+
   void LeftShiftDivisor() {
     leading_zero_shift_ = CountLeadingZeros(divisor_.msd());
     LeftShift(divisor_, divisor_, leading_zero_shift_);
   }
 
+  const digit_t base_divisor_;
+  // This level's divisor is {base_divisor_}^(2^power_index_).
+  int power_index_{0};
   int leading_zero_shift_{0};
   // The number of characters generated by *each half* of this level.
   int char_count_;
@@ -373,12 +392,13 @@ RecursionLevel* RecursionLevel::CreateLevels(digit_t base_divisor,
   while (BitLength(level->divisor_) * 2 - 1 <= target_bit_length) {
     RecursionLevel* prev = level;
     level = new RecursionLevel(prev);
-    processor->Multiply(level->divisor_, prev->divisor_, prev->divisor_);
+    Digits power =
+        processor->GetPowerOfTwoPower(base_divisor, level->power_index_);
     if (processor->should_terminate()) {
       delete level;
       return nullptr;
     }
-    level->divisor_.Normalize();
+    level->SetDivisor(power);
     // Left-shifting the divisor must only happen after it's been used to
     // compute the next divisor.
     prev->LeftShiftDivisor();
@@ -391,9 +411,12 @@ RecursionLevel* RecursionLevel::CreateLevels(digit_t base_divisor,
 }
 
 // The top level might get by with a smaller inverse than we could maximally
-// compute, so the caller should provide the dividend length.
+// compute, so the caller should provide the dividend length. Full-length
+// inverses are kept in the processor's power cache.
 void RecursionLevel::ComputeInverse(ProcessorImpl* processor,
                                     int dividend_length) {
+  inverse_ = processor->GetCachedInverse(base_divisor_, power_index_);
+  if (inverse_.len() != 0) return;
   int inverse_len = divisor_.len();
   if (dividend_length != 0) {
     inverse_len = dividend_length - divisor_.len();
@@ -408,6 +431,10 @@ void RecursionLevel::ComputeInverse(ProcessorImpl* processor,
   processor->Invert(inverse_initializer, input, scratch);
   inverse_initializer.TrimOne();
   inverse_ = inverse_initializer;
+  if (dividend_length == 0) {
+    processor->SetCachedInverse(base_divisor_, power_index_,
+                                std::move(inverse_storage_), inverse_);
+  }
 }
 
 Digits RecursionLevel::GetInverse(int dividend_length) {
@@ -564,6 +591,7 @@ void ProcessorImpl::ToStringImpl(char* out, int* out_length, Digits X,
   } else if (fast) {
     formatter.Start();
     formatter.Fast();
+    TrimPowerCache();
     if (should_terminate()) return;
 #else
     USE(fast);
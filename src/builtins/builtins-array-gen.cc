@@ -572,12 +572,20 @@ class ArrayIncludesIndexofAssembler : public CodeStubAssembler {
 
   enum SearchVariant { kIncludes, kIndexOf };
 
+  // Smi-only arrays contain nothing but Smis and holes, which lets the
+  // search skip the number, string and BigInt comparisons.
+  enum class SimpleElementKind { kSmiOrHole, kAny };
+
+  // Below this number of elements the CSA loops beat the C call overhead.
+  static const int kMinSimdSearchLength = 16;
+
   void Generate(SearchVariant variant, TNode<IntPtrT> argc,
                 TNode<Context> context);
   void GenerateSmiOrObject(SearchVariant variant, TNode<Context> context,
                            TNode<FixedArray> elements,
                            TNode<Object> search_element,
-                           TNode<Smi> array_length, TNode<Smi> from_index);
+                           TNode<Smi> array_length, TNode<Smi> from_index,
+                           SimpleElementKind array_kind);
   void GeneratePackedDoubles(SearchVariant variant,
                              TNode<FixedDoubleArray> elements,
                              TNode<Object> search_element,
@@ -587,6 +595,14 @@ class ArrayIncludesIndexofAssembler : public CodeStubAssembler {
                             TNode<Object> search_element,
                             TNode<Smi> array_length, TNode<Smi> from_index);
 
+  // Hands the search over to the vectorized |kernel| (see objects/simd.h)
+  // when enough elements are left, and falls through to the CSA loop
+  // otherwise.
+  void SimdSearch(ExternalReference kernel, TNode<FixedArrayBase> elements,
+                  TNode<IntPtrT> array_length, TVariable<IntPtrT>* index_var,
+                  TNode<Object> search_element, Label* return_found,
+                  Label* return_not_found);
+
   void ReturnIfEmpty(TNode<Smi> length, TNode<Object> value) {
     Label done(this);
     GotoIf(SmiGreaterThan(length, SmiConstant(0)), &done);
@@ -665,7 +681,8 @@ void ArrayIncludesIndexofAssembler::Generate(SearchVariant variant,
   GotoIf(IntPtrGreaterThanOrEqual(index_var.value(), array_length_untagged),
          &return_not_found);
 
-  Label if_smiorobjects(this), if_packed_doubles(this), if_holey_doubles(this);
+  Label if_smi(this), if_smiorobjects(this), if_packed_doubles(this),
+      if_holey_doubles(this);
 
   TNode<Int32T> elements_kind = LoadElementsKind(array);
   TNode<FixedArrayBase> elements = LoadElements(array);
@@ -673,6 +690,8 @@ void ArrayIncludesIndexofAssembler::Generate(SearchVariant variant,
   STATIC_ASSERT(HOLEY_SMI_ELEMENTS == 1);
   STATIC_ASSERT(PACKED_ELEMENTS == 2);
   STATIC_ASSERT(HOLEY_ELEMENTS == 3);
+  GotoIf(IsElementsKindLessThanOrEqual(elements_kind, HOLEY_SMI_ELEMENTS),
+         &if_smi);
   GotoIf(IsElementsKindLessThanOrEqual(elements_kind, HOLEY_ELEMENTS),
          &if_smiorobjects);
   GotoIf(
@@ -685,6 +704,17 @@ void ArrayIncludesIndexofAssembler::Generate(SearchVariant variant,
          &if_smiorobjects);
   Goto(&return_not_found);
 
+  BIND(&if_smi);
+  {
+    Callable callable =
+        (variant == kIncludes)
+            ? Builtins::CallableFor(isolate(), Builtin::kArrayIncludesSmi)
+            : Builtins::CallableFor(isolate(), Builtin::kArrayIndexOfSmi);
+    TNode<Object> result = CallStub(callable, context, elements, search_element,
+                                    array_length, SmiTag(index_var.value()));
+    args.PopAndReturn(result);
+  }
+
   BIND(&if_smiorobjects);
   {
     Callable callable = (variant == kIncludes)
@@ -741,10 +771,41 @@ void ArrayIncludesIndexofAssembler::Generate(SearchVariant variant,
   }
 }
 
+void ArrayIncludesIndexofAssembler::SimdSearch(
+    ExternalReference kernel, TNode<FixedArrayBase> elements,
+    TNode<IntPtrT> array_length, TVariable<IntPtrT>* index_var,
+    TNode<Object> search_element, Label* return_found,
+    Label* return_not_found) {
+  Label scalar_search(this);
+  GotoIf(IntPtrLessThan(IntPtrSub(array_length, index_var->value()),
+                        IntPtrConstant(kMinSimdSearchLength)),
+         &scalar_search);
+
+  STATIC_ASSERT(FixedArray::kHeaderSize == FixedArrayBase::kHeaderSize);
+  STATIC_ASSERT(FixedDoubleArray::kHeaderSize == FixedArrayBase::kHeaderSize);
+  // The kernel does not allocate, so the raw element pointer stays valid.
+  TNode<IntPtrT> array_start =
+      IntPtrAdd(BitcastTaggedToWord(elements),
+                IntPtrConstant(FixedArrayBase::kHeaderSize - kHeapObjectTag));
+  MachineType type_ptr = MachineType::Pointer();
+  MachineType type_uintptr = MachineType::UintPtr();
+  TNode<UintPtrT> result = UncheckedCast<UintPtrT>(CallCFunction(
+      ExternalConstant(kernel), type_uintptr,
+      std::make_pair(type_ptr, array_start),
+      std::make_pair(type_uintptr, array_length),
+      std::make_pair(type_uintptr, index_var->value()),
+      std::make_pair(type_ptr, BitcastTaggedToWord(search_element))));
+  GotoIf(WordEqual(result, IntPtrConstant(-1)), return_not_found);
+  *index_var = Signed(result);
+  Goto(return_found);
+
+  BIND(&scalar_search);
+}
+
 void ArrayIncludesIndexofAssembler::GenerateSmiOrObject(
     SearchVariant variant, TNode<Context> context, TNode<FixedArray> elements,
     TNode<Object> search_element, TNode<Smi> array_length,
-    TNode<Smi> from_index) {
+    TNode<Smi> from_index, SimpleElementKind array_kind) {
   TVARIABLE(IntPtrT, index_var, SmiUntag(from_index));
   TVARIABLE(Float64T, search_num);
   TNode<IntPtrT> array_length_untagged = SmiUntag(array_length);
@@ -752,11 +813,16 @@ void ArrayIncludesIndexofAssembler::GenerateSmiOrObject(
   Label ident_loop(this, &index_var), heap_num_loop(this, &search_num),
       string_loop(this), bigint_loop(this, &index_var),
       undef_loop(this, &index_var), not_smi(this), not_heap_num(this),
-      return_found(this), return_not_found(this);
+      ident_search(this), return_found(this), return_not_found(this);
 
   GotoIfNot(TaggedIsSmi(search_element), &not_smi);
-  search_num = SmiToFloat64(CAST(search_element));
-  Goto(&heap_num_loop);
+  if (array_kind == SimpleElementKind::kSmiOrHole) {
+    // Smis are only ever equal to identical Smis here.
+    Goto(&ident_search);
+  } else {
+    search_num = SmiToFloat64(CAST(search_element));
+    Goto(&heap_num_loop);
+  }
 
   BIND(&not_smi);
   if (variant == kIncludes) {
@@ -769,8 +835,18 @@ void ArrayIncludesIndexofAssembler::GenerateSmiOrObject(
 
   BIND(&not_heap_num);
   TNode<Uint16T> search_type = LoadMapInstanceType(map);
-  GotoIf(IsStringInstanceType(search_type), &string_loop);
-  GotoIf(IsBigIntInstanceType(search_type), &bigint_loop);
+  if (array_kind == SimpleElementKind::kSmiOrHole) {
+    Goto(&return_not_found);
+  } else {
+    GotoIf(IsStringInstanceType(search_type), &string_loop);
+    GotoIf(IsBigIntInstanceType(search_type), &bigint_loop);
+    Goto(&ident_search);
+  }
+
+  BIND(&ident_search);
+  SimdSearch(ExternalReference::array_indexof_includes_smi_or_object(),
+             elements, array_length_untagged, &index_var, search_element,
+             &return_found, &return_not_found);
   Goto(&ident_loop);
 
   BIND(&ident_loop);
@@ -846,59 +922,67 @@ void ArrayIncludesIndexofAssembler::GenerateSmiOrObject(
     }
   }
 
-  BIND(&string_loop);
-  {
-    TNode<String> search_element_string = CAST(search_element);
-    Label continue_loop(this), next_iteration(this, &index_var),
-        slow_compare(this), runtime(this, Label::kDeferred);
-    TNode<IntPtrT> search_length =
-        LoadStringLengthAsWord(search_element_string);
-    Goto(&next_iteration);
-    BIND(&next_iteration);
-    GotoIfNot(UintPtrLessThan(index_var.value(), array_length_untagged),
-              &return_not_found);
-    TNode<Object> element_k =
-        UnsafeLoadFixedArrayElement(elements, index_var.value());
-    GotoIf(TaggedIsSmi(element_k), &continue_loop);
-    GotoIf(TaggedEqual(search_element_string, element_k), &return_found);
-    TNode<Uint16T> element_k_type = LoadInstanceType(CAST(element_k));
-    GotoIfNot(IsStringInstanceType(element_k_type), &continue_loop);
-    Branch(IntPtrEqual(search_length, LoadStringLengthAsWord(CAST(element_k))),
-           &slow_compare, &continue_loop);
-
-    BIND(&slow_compare);
-    StringBuiltinsAssembler string_asm(state());
-    string_asm.StringEqual_Core(search_element_string, search_type,
-                                CAST(element_k), element_k_type, search_length,
-                                &return_found, &continue_loop, &runtime);
-    BIND(&runtime);
-    TNode<Object> result = CallRuntime(Runtime::kStringEqual, context,
-                                       search_element_string, element_k);
-    Branch(TaggedEqual(result, TrueConstant()), &return_found, &continue_loop);
+  // Strings and BigInts never make it into Smi-only arrays.
+  if (array_kind == SimpleElementKind::kAny) {
+    BIND(&string_loop);
+    {
+      TNode<String> search_element_string = CAST(search_element);
+      Label continue_loop(this), next_iteration(this, &index_var),
+          slow_compare(this), runtime(this, Label::kDeferred);
+      TNode<IntPtrT> search_length =
+          LoadStringLengthAsWord(search_element_string);
+      Goto(&next_iteration);
+      BIND(&next_iteration);
+      GotoIfNot(UintPtrLessThan(index_var.value(), array_length_untagged),
+                &return_not_found);
+      TNode<Object> element_k =
+          UnsafeLoadFixedArrayElement(elements, index_var.value());
+      GotoIf(TaggedIsSmi(element_k), &continue_loop);
+      GotoIf(TaggedEqual(search_element_string, element_k), &return_found);
+      TNode<Uint16T> element_k_type = LoadInstanceType(CAST(element_k));
+      GotoIfNot(IsStringInstanceType(element_k_type), &continue_loop);
+      Branch(
+          IntPtrEqual(search_length, LoadStringLengthAsWord(CAST(element_k))),
+          &slow_compare, &continue_loop);
+
+      BIND(&slow_compare);
+      StringBuiltinsAssembler string_asm(state());
+      string_asm.StringEqual_Core(search_element_string, search_type,
+                                  CAST(element_k), element_k_type,
+                                  search_length, &return_found, &continue_loop,
+                                  &runtime);
+      BIND(&runtime);
+      TNode<Object> result = CallRuntime(Runtime::kStringEqual, context,
+                                         search_element_string, element_k);
+      Branch(TaggedEqual(result, TrueConstant()), &return_found,
+             &continue_loop);
 
-    BIND(&continue_loop);
-    Increment(&index_var);
-    Goto(&next_iteration);
-  }
+      BIND(&continue_loop);
+      Increment(&index_var);
+      Goto(&next_iteration);
+    }
 
-  BIND(&bigint_loop);
-  {
-    GotoIfNot(UintPtrLessThan(index_var.value(), array_length_untagged),
-              &return_not_found);
+    BIND(&bigint_loop);
+    {
+      GotoIfNot(UintPtrLessThan(index_var.value(), array_length_untagged),
+                &return_not_found);
 
-    TNode<Object> element_k =
-        UnsafeLoadFixedArrayElement(elements, index_var.value());
-    Label continue_loop(this);
-    GotoIf(TaggedIsSmi(element_k), &continue_loop);
-    GotoIfNot(IsBigInt(CAST(element_k)), &continue_loop);
-    TNode<Object> result = CallRuntime(Runtime::kBigIntEqualToBigInt, context,
-                                       search_element, element_k);
-    Branch(TaggedEqual(result, TrueConstant()), &return_found, &continue_loop);
+      TNode<Object> element_k =
+          UnsafeLoadFixedArrayElement(elements, index_var.value());
+      Label continue_loop(this);
+      GotoIf(TaggedIsSmi(element_k), &continue_loop);
+      GotoIfNot(IsBigInt(CAST(element_k)), &continue_loop);
+      TNode<Object> result = CallRuntime(Runtime::kBigIntEqualToBigInt,
+                                         context, search_element, element_k);
+      Branch(TaggedEqual(result, TrueConstant()), &return_found,
+             &continue_loop);
 
-    BIND(&continue_loop);
-    Increment(&index_var);
-    Goto(&bigint_loop);
+      BIND(&continue_loop);
+      Increment(&index_var);
+      Goto(&bigint_loop);
+    }
   }
+
   BIND(&return_found);
   if (variant == kIncludes) {
     Return(TrueConstant());
@@ -922,14 +1006,14 @@ void ArrayIncludesIndexofAssembler::GeneratePackedDoubles(
   TNode<IntPtrT> array_length_untagged = SmiUntag(array_length);
 
   Label nan_loop(this, &index_var), not_nan_loop(this, &index_var),
-      hole_loop(this, &index_var), search_notnan(this), return_found(this),
-      return_not_found(this);
+      hole_loop(this, &index_var), search_notnan(this), not_nan_search(this),
+      return_found(this), return_not_found(this);
   TVARIABLE(Float64T, search_num);
   search_num = Float64Constant(0);
 
   GotoIfNot(TaggedIsSmi(search_element), &search_notnan);
   search_num = SmiToFloat64(CAST(search_element));
-  Goto(&not_nan_loop);
+  Goto(&not_nan_search);
 
   BIND(&search_notnan);
   GotoIfNot(IsHeapNumber(CAST(search_element)), &return_not_found);
@@ -937,7 +1021,13 @@ void ArrayIncludesIndexofAssembler::GeneratePackedDoubles(
   search_num = LoadHeapNumberValue(CAST(search_element));
 
   Label* nan_handling = variant == kIncludes ? &nan_loop : &return_not_found;
-  BranchIfFloat64IsNaN(search_num.value(), nan_handling, &not_nan_loop);
+  BranchIfFloat64IsNaN(search_num.value(), nan_handling, &not_nan_search);
+
+  BIND(&not_nan_search);
+  SimdSearch(ExternalReference::array_indexof_includes_double(), elements,
+             array_length_untagged, &index_var, search_element, &return_found,
+             &return_not_found);
+  Goto(&not_nan_loop);
 
   BIND(&not_nan_loop);
   {
@@ -990,14 +1080,14 @@ void ArrayIncludesIndexofAssembler::GenerateHoleyDoubles(
   TNode<IntPtrT> array_length_untagged = SmiUntag(array_length);
 
   Label nan_loop(this, &index_var), not_nan_loop(this, &index_var),
-      hole_loop(this, &index_var), search_notnan(this), return_found(this),
-      return_not_found(this);
+      hole_loop(this, &index_var), search_notnan(this), not_nan_search(this),
+      return_found(this), return_not_found(this);
   TVARIABLE(Float64T, search_num);
   search_num = Float64Constant(0);
 
   GotoIfNot(TaggedIsSmi(search_element), &search_notnan);
   search_num = SmiToFloat64(CAST(search_element));
-  Goto(&not_nan_loop);
+  Goto(&not_nan_search);
 
   BIND(&search_notnan);
   if (variant == kIncludes) {
@@ -1008,7 +1098,13 @@ void ArrayIncludesIndexofAssembler::GenerateHoleyDoubles(
   search_num = LoadHeapNumberValue(CAST(search_element));
 
   Label* nan_handling = variant == kIncludes ? &nan_loop : &return_not_found;
-  BranchIfFloat64IsNaN(search_num.value(), nan_handling, &not_nan_loop);
+  BranchIfFloat64IsNaN(search_num.value(), nan_handling, &not_nan_search);
+
+  BIND(&not_nan_search);
+  SimdSearch(ExternalReference::array_indexof_includes_double(), elements,
+             array_length_untagged, &index_var, search_element, &return_found,
+             &return_not_found);
+  Goto(&not_nan_loop);
 
   BIND(&not_nan_loop);
   {
@@ -1090,7 +1186,18 @@ TF_BUILTIN(ArrayIncludesSmiOrObject, ArrayIncludesIndexofAssembler) {
   auto from_index = Parameter<Smi>(Descriptor::kFromIndex);
 
   GenerateSmiOrObject(kIncludes, context, elements, search_element,
-                      array_length, from_index);
+                      array_length, from_index, SimpleElementKind::kAny);
+}
+
+TF_BUILTIN(ArrayIncludesSmi, ArrayIncludesIndexofAssembler) {
+  auto context = Parameter<Context>(Descriptor::kContext);
+  auto elements = Parameter<FixedArray>(Descriptor::kElements);
+  auto search_element = Parameter<Object>(Descriptor::kSearchElement);
+  auto array_length = Parameter<Smi>(Descriptor::kLength);
+  auto from_index = Parameter<Smi>(Descriptor::kFromIndex);
+
+  GenerateSmiOrObject(kIncludes, context, elements, search_element,
+                      array_length, from_index, SimpleElementKind::kSmiOrHole);
 }
 
 TF_BUILTIN(ArrayIncludesPackedDoubles, ArrayIncludesIndexofAssembler) {
@@ -1131,7 +1238,18 @@ TF_BUILTIN(ArrayIndexOfSmiOrObject, ArrayIncludesIndexofAssembler) {
   auto from_index = Parameter<Smi>(Descriptor::kFromIndex);
 
   GenerateSmiOrObject(kIndexOf, context, elements, search_element, array_length,
-                      from_index);
+                      from_index, SimpleElementKind::kAny);
+}
+
+TF_BUILTIN(ArrayIndexOfSmi, ArrayIncludesIndexofAssembler) {
+  auto context = Parameter<Context>(Descriptor::kContext);
+  auto elements = Parameter<FixedArray>(Descriptor::kElements);
+  auto search_element = Parameter<Object>(Descriptor::kSearchElement);
+  auto array_length = Parameter<Smi>(Descriptor::kLength);
+  auto from_index = Parameter<Smi>(Descriptor::kFromIndex);
+
+  GenerateSmiOrObject(kIndexOf, context, elements, search_element, array_length,
+                      from_index, SimpleElementKind::kSmiOrHole);
 }
 
 TF_BUILTIN(ArrayIndexOfPackedDoubles, ArrayIncludesIndexofAssembler) {
@@ -1895,9 +2013,12 @@ void ArrayBuiltinsAssembler::GenerateArrayNoArgumentConstructor(
           ? Parameter<AllocationSite>(Descriptor::kAllocationSite)
           : base::Optional<TNode<AllocationSite>>(base::nullopt);
   TNode<Map> array_map = LoadJSArrayElementsMap(kind, native_context);
-  TNode<JSArray> array = AllocateJSArray(
-      kind, array_map, IntPtrConstant(JSArray::kPreallocatedArrayElements),
-      SmiConstant(0), allocation_site);
+  TNode<IntPtrT> capacity = IntPtrConstant(JSArray::kPreallocatedArrayElements);
+  if (allocation_site) {
+    capacity = IntPtrMax(capacity, LoadCapacityHint(*allocation_site));
+  }
+  TNode<JSArray> array = AllocateJSArray(kind, array_map, capacity,
+                                         SmiConstant(0), allocation_site);
   Return(array);
 }
 
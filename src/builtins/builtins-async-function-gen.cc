@@ -151,6 +151,12 @@ TF_BUILTIN(AsyncFunctionEnter, AsyncFunctionBuiltinsAssembler) {
       parameters_and_registers);
   StoreObjectFieldNoWriteBarrier(
       async_function_object, JSAsyncFunctionObject::kPromiseOffset, promise);
+  StoreObjectFieldRoot(async_function_object,
+                       JSAsyncFunctionObject::kAwaitResolveClosureOffset,
+                       RootIndex::kUndefinedValue);
+  StoreObjectFieldRoot(async_function_object,
+                       JSAsyncFunctionObject::kAwaitRejectClosureOffset,
+                       RootIndex::kUndefinedValue);
 
   RunContextPromiseHookInit(context, promise, UndefinedConstant());
 
@@ -268,12 +274,57 @@ void AsyncFunctionBuiltinsAssembler::AsyncFunctionAwait(
   Goto(&after_debug_hook);
   BIND(&after_debug_hook);
 
-  TNode<SharedFunctionInfo> on_resolve_sfi =
-      AsyncFunctionAwaitResolveSharedFunConstant();
-  TNode<SharedFunctionInfo> on_reject_sfi =
-      AsyncFunctionAwaitRejectSharedFunConstant();
-  Await(context, async_function_object, value, outer_promise, on_resolve_sfi,
-        on_reject_sfi, is_predicted_as_caught);
+  // The await closures only refer to the {async_function_object}, which
+  // awaits one value at a time, so they are allocated on the first await and
+  // reused by later ones. The debugger can attach state to them, so they are
+  // neither cached nor reused while instrumentation is active.
+  TVARIABLE(JSFunction, var_on_resolve);
+  TVARIABLE(JSFunction, var_on_reject);
+  Label if_allocate(this), if_instrumentation(this, Label::kDeferred),
+      do_await(this);
+  GotoIf(IsIsolatePromiseHookEnabledOrDebugIsActiveOrHasAsyncEventDelegate(),
+         &if_instrumentation);
+  TNode<HeapObject> cached_on_resolve = LoadObjectField<HeapObject>(
+      async_function_object, JSAsyncFunctionObject::kAwaitResolveClosureOffset);
+  GotoIf(IsUndefined(cached_on_resolve), &if_allocate);
+  var_on_resolve = CAST(cached_on_resolve);
+  var_on_reject = LoadObjectField<JSFunction>(
+      async_function_object, JSAsyncFunctionObject::kAwaitRejectClosureOffset);
+  Goto(&do_await);
+
+  BIND(&if_allocate);
+  {
+    std::pair<TNode<JSFunction>, TNode<JSFunction>> closures =
+        AllocateAwaitClosures(LoadNativeContext(context),
+                              async_function_object,
+                              AsyncFunctionAwaitResolveSharedFunConstant(),
+                              AsyncFunctionAwaitRejectSharedFunConstant());
+    StoreObjectField(async_function_object,
+                     JSAsyncFunctionObject::kAwaitResolveClosureOffset,
+                     closures.first);
+    StoreObjectField(async_function_object,
+                     JSAsyncFunctionObject::kAwaitRejectClosureOffset,
+                     closures.second);
+    var_on_resolve = closures.first;
+    var_on_reject = closures.second;
+    Goto(&do_await);
+  }
+
+  BIND(&if_instrumentation);
+  {
+    std::pair<TNode<JSFunction>, TNode<JSFunction>> closures =
+        AllocateAwaitClosures(LoadNativeContext(context),
+                              async_function_object,
+                              AsyncFunctionAwaitResolveSharedFunConstant(),
+                              AsyncFunctionAwaitRejectSharedFunConstant());
+    var_on_resolve = closures.first;
+    var_on_reject = closures.second;
+    Goto(&do_await);
+  }
+
+  BIND(&do_await);
+  Await(context, value, outer_promise, var_on_resolve.value(),
+        var_on_reject.value(), BooleanConstant(is_predicted_as_caught));
 
   // Return outer promise to avoid adding an load of the outer promise before
   // suspending in BytecodeGenerator.
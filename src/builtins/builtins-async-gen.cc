@@ -22,14 +22,11 @@ class ValueUnwrapContext {
 
 }  // namespace
 
-TNode<Object> AsyncBuiltinsAssembler::AwaitOld(
-    TNode<Context> context, TNode<JSGeneratorObject> generator,
-    TNode<Object> value, TNode<JSPromise> outer_promise,
+std::pair<TNode<JSFunction>, TNode<JSFunction>>
+AsyncBuiltinsAssembler::AllocateAwaitClosures(
+    TNode<NativeContext> native_context, TNode<JSGeneratorObject> generator,
     TNode<SharedFunctionInfo> on_resolve_sfi,
-    TNode<SharedFunctionInfo> on_reject_sfi,
-    TNode<Oddball> is_predicted_as_caught) {
-  const TNode<NativeContext> native_context = LoadNativeContext(context);
-
+    TNode<SharedFunctionInfo> on_reject_sfi) {
   static const int kClosureContextSize =
       FixedArray::SizeFor(Context::MIN_CONTEXT_EXTENDED_SLOTS);
   TNode<Context> closure_context =
@@ -52,6 +49,27 @@ TNode<Object> AsyncBuiltinsAssembler::AwaitOld(
                                       generator);
   }
 
+  // Allocate and initialize resolve handler
+  TNode<HeapObject> on_resolve =
+      AllocateInNewSpace(JSFunction::kSizeWithoutPrototype);
+  InitializeNativeClosure(closure_context, native_context, on_resolve,
+                          on_resolve_sfi);
+
+  // Allocate and initialize reject handler
+  TNode<HeapObject> on_reject =
+      AllocateInNewSpace(JSFunction::kSizeWithoutPrototype);
+  InitializeNativeClosure(closure_context, native_context, on_reject,
+                          on_reject_sfi);
+
+  return std::make_pair(CAST(on_resolve), CAST(on_reject));
+}
+
+TNode<Object> AsyncBuiltinsAssembler::AwaitOld(
+    TNode<Context> context, TNode<Object> value, TNode<JSPromise> outer_promise,
+    TNode<JSFunction> on_resolve, TNode<JSFunction> on_reject,
+    TNode<Oddball> is_predicted_as_caught) {
+  const TNode<NativeContext> native_context = LoadNativeContext(context);
+
   // Let promiseCapability be ! NewPromiseCapability(%Promise%).
   const TNode<JSFunction> promise_fun =
       CAST(LoadContextElement(native_context, Context::PROMISE_FUNCTION_INDEX));
@@ -78,18 +96,6 @@ TNode<Object> AsyncBuiltinsAssembler::AwaitOld(
     PromiseInit(promise);
   }
 
-  // Allocate and initialize resolve handler
-  TNode<HeapObject> on_resolve =
-      AllocateInNewSpace(JSFunction::kSizeWithoutPrototype);
-  InitializeNativeClosure(closure_context, native_context, on_resolve,
-                          on_resolve_sfi);
-
-  // Allocate and initialize reject handler
-  TNode<HeapObject> on_reject =
-      AllocateInNewSpace(JSFunction::kSizeWithoutPrototype);
-  InitializeNativeClosure(closure_context, native_context, on_reject,
-                          on_reject_sfi);
-
   TVARIABLE(HeapObject, var_throwaway, UndefinedConstant());
 
   RunContextPromiseHookInit(context, promise, outer_promise);
@@ -106,51 +112,15 @@ TNode<Object> AsyncBuiltinsAssembler::AwaitOld(
 }
 
 TNode<Object> AsyncBuiltinsAssembler::AwaitOptimized(
-    TNode<Context> context, TNode<JSGeneratorObject> generator,
-    TNode<JSPromise> promise, TNode<JSPromise> outer_promise,
-    TNode<SharedFunctionInfo> on_resolve_sfi,
-    TNode<SharedFunctionInfo> on_reject_sfi,
-    TNode<Oddball> is_predicted_as_caught) {
+    TNode<Context> context, TNode<JSPromise> promise,
+    TNode<JSPromise> outer_promise, TNode<JSFunction> on_resolve,
+    TNode<JSFunction> on_reject, TNode<Oddball> is_predicted_as_caught) {
   const TNode<NativeContext> native_context = LoadNativeContext(context);
 
   // 2. Let promise be ? PromiseResolve(« promise »).
   // We skip this step, because promise is already guaranteed to be a
   // JSPRomise at this point.
 
-  static const int kClosureContextSize =
-      FixedArray::SizeFor(Context::MIN_CONTEXT_EXTENDED_SLOTS);
-  TNode<Context> closure_context =
-      UncheckedCast<Context>(AllocateInNewSpace(kClosureContextSize));
-  {
-    // Initialize the await context, storing the {generator} as extension.
-    TNode<Map> map = CAST(
-        LoadContextElement(native_context, Context::AWAIT_CONTEXT_MAP_INDEX));
-    StoreMapNoWriteBarrier(closure_context, map);
-    StoreObjectFieldNoWriteBarrier(
-        closure_context, Context::kLengthOffset,
-        SmiConstant(Context::MIN_CONTEXT_EXTENDED_SLOTS));
-    const TNode<Object> empty_scope_info =
-        LoadContextElement(native_context, Context::SCOPE_INFO_INDEX);
-    StoreContextElementNoWriteBarrier(
-        closure_context, Context::SCOPE_INFO_INDEX, empty_scope_info);
-    StoreContextElementNoWriteBarrier(closure_context, Context::PREVIOUS_INDEX,
-                                      native_context);
-    StoreContextElementNoWriteBarrier(closure_context, Context::EXTENSION_INDEX,
-                                      generator);
-  }
-
-  // Allocate and initialize resolve handler
-  TNode<HeapObject> on_resolve =
-      AllocateInNewSpace(JSFunction::kSizeWithoutPrototype);
-  InitializeNativeClosure(closure_context, native_context, on_resolve,
-                          on_resolve_sfi);
-
-  // Allocate and initialize reject handler
-  TNode<HeapObject> on_reject =
-      AllocateInNewSpace(JSFunction::kSizeWithoutPrototype);
-  InitializeNativeClosure(closure_context, native_context, on_reject,
-                          on_reject_sfi);
-
   TVARIABLE(HeapObject, var_throwaway, UndefinedConstant());
 
   InitAwaitPromise(Runtime::kAwaitPromisesInit, context, promise, promise,
@@ -201,6 +171,17 @@ TNode<Object> AsyncBuiltinsAssembler::Await(
     TNode<SharedFunctionInfo> on_resolve_sfi,
     TNode<SharedFunctionInfo> on_reject_sfi,
     TNode<Oddball> is_predicted_as_caught) {
+  std::pair<TNode<JSFunction>, TNode<JSFunction>> closures =
+      AllocateAwaitClosures(LoadNativeContext(context), generator,
+                            on_resolve_sfi, on_reject_sfi);
+  return Await(context, value, outer_promise, closures.first, closures.second,
+               is_predicted_as_caught);
+}
+
+TNode<Object> AsyncBuiltinsAssembler::Await(
+    TNode<Context> context, TNode<Object> value,
+    TNode<JSPromise> outer_promise, TNode<JSFunction> on_resolve,
+    TNode<JSFunction> on_reject, TNode<Oddball> is_predicted_as_caught) {
   TVARIABLE(Object, result);
   Label if_old(this), if_new(this), done(this),
       if_slow_constructor(this, Label::kDeferred);
@@ -238,14 +219,13 @@ TNode<Object> AsyncBuiltinsAssembler::Await(
   }
 
   BIND(&if_old);
-  result = AwaitOld(context, generator, value, outer_promise, on_resolve_sfi,
-                    on_reject_sfi, is_predicted_as_caught);
+  result = AwaitOld(context, value, outer_promise, on_resolve, on_reject,
+                    is_predicted_as_caught);
   Goto(&done);
 
   BIND(&if_new);
-  result =
-      AwaitOptimized(context, generator, CAST(value), outer_promise,
-                     on_resolve_sfi, on_reject_sfi, is_predicted_as_caught);
+  result = AwaitOptimized(context, CAST(value), outer_promise, on_resolve,
+                          on_reject, is_predicted_as_caught);
   Goto(&done);
 
   BIND(&done);
@@ -36,6 +36,20 @@ class AsyncBuiltinsAssembler : public PromiseBuiltinsAssembler {
                  on_reject_sfi, BooleanConstant(is_predicted_as_caught));
   }
 
+  // Like above, but with {on_resolve} and {on_reject} closures that were
+  // allocated with AllocateAwaitClosures.
+  TNode<Object> Await(TNode<Context> context, TNode<Object> value,
+                      TNode<JSPromise> outer_promise,
+                      TNode<JSFunction> on_resolve, TNode<JSFunction> on_reject,
+                      TNode<Oddball> is_predicted_as_caught);
+
+  // Allocates the resolve and reject closures for an await in {generator}.
+  // Both share a context that stores the {generator} as extension.
+  std::pair<TNode<JSFunction>, TNode<JSFunction>> AllocateAwaitClosures(
+      TNode<NativeContext> native_context, TNode<JSGeneratorObject> generator,
+      TNode<SharedFunctionInfo> on_resolve_sfi,
+      TNode<SharedFunctionInfo> on_reject_sfi);
+
   // Return a new built-in function object as defined in
   // Async Iterator Value Unwrap Functions
   TNode<JSFunction> CreateUnwrapClosure(TNode<NativeContext> native_context,
@@ -49,18 +63,16 @@ class AsyncBuiltinsAssembler : public PromiseBuiltinsAssembler {
   TNode<Context> AllocateAsyncIteratorValueUnwrapContext(
       TNode<NativeContext> native_context, TNode<Oddball> done);
 
-  TNode<Object> AwaitOld(TNode<Context> context,
-                         TNode<JSGeneratorObject> generator,
-                         TNode<Object> value, TNode<JSPromise> outer_promise,
-                         TNode<SharedFunctionInfo> on_resolve_sfi,
-                         TNode<SharedFunctionInfo> on_reject_sfi,
+  TNode<Object> AwaitOld(TNode<Context> context, TNode<Object> value,
+                         TNode<JSPromise> outer_promise,
+                         TNode<JSFunction> on_resolve,
+                         TNode<JSFunction> on_reject,
                          TNode<Oddball> is_predicted_as_caught);
   TNode<Object> AwaitOptimized(TNode<Context> context,
-                               TNode<JSGeneratorObject> generator,
                                TNode<JSPromise> promise,
                                TNode<JSPromise> outer_promise,
-                               TNode<SharedFunctionInfo> on_resolve_sfi,
-                               TNode<SharedFunctionInfo> on_reject_sfi,
+                               TNode<JSFunction> on_resolve,
+                               TNode<JSFunction> on_reject,
                                TNode<Oddball> is_predicted_as_caught);
 
   void InitAwaitPromise(
@@ -1369,9 +1369,23 @@ void CollectionsBuiltinsAssembler::SameValueZeroString(
   // If the candidate is not a string, the keys are not equal.
   GotoIf(TaggedIsSmi(candidate_key), if_not_same);
   GotoIfNot(IsString(CAST(candidate_key)), if_not_same);
-
+  TNode<String> candidate_string = CAST(candidate_key);
+
+  // Most candidates in a bucket chain differ from the key. Rule them out by
+  // identity, length and hash before calling out to compare the contents.
+  GotoIf(TaggedEqual(key_string, candidate_string), if_same);
+  GotoIfNot(Word32Equal(LoadStringLengthAsWord32(key_string),
+                        LoadStringLengthAsWord32(candidate_string)),
+            if_not_same);
+  Label compare_contents(this);
+  GotoIfNot(Word32Equal(LoadNameHash(key_string, &compare_contents),
+                        LoadNameHash(candidate_string, &compare_contents)),
+            if_not_same);
+  Goto(&compare_contents);
+
+  BIND(&compare_contents);
   Branch(TaggedEqual(CallBuiltin(Builtin::kStringEqual, NoContextConstant(),
-                                 key_string, candidate_key),
+                                 key_string, candidate_string),
                      TrueConstant()),
          if_same, if_not_same);
 }
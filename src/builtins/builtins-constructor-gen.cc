@@ -513,20 +513,34 @@ TNode<JSArray> ConstructorBuiltinsAssembler::CreateEmptyArrayLiteral(
   TNode<NativeContext> native_context = LoadNativeContext(context);
   Comment("LoadJSArrayElementsMap");
   TNode<Map> array_map = LoadJSArrayElementsMap(kind, native_context);
-  TNode<IntPtrT> zero_intptr = IntPtrConstant(0);
   TNode<Smi> zero = SmiConstant(0);
   Comment("Allocate JSArray");
   base::Optional<TNode<AllocationSite>> site =
       V8_ALLOCATION_SITE_TRACKING_BOOL
           ? base::make_optional(allocation_site.value())
           : base::nullopt;
-  TNode<JSArray> result = AllocateJSArray(GetInitialFastElementsKind(),
-                                          array_map, zero_intptr, zero, site);
+  TVARIABLE(JSArray, result);
+  Label with_capacity(this), with_double_capacity(this);
+  // Preallocate the capacity that earlier arrays from this site grew to. The
+  // hint is only ever recorded with --allocation-site-capacity-hints.
+  TNode<IntPtrT> capacity = LoadCapacityHint(allocation_site.value());
+  GotoIf(WordNotEqual(capacity, IntPtrConstant(0)), &with_capacity);
+  result = AllocateJSArray(GetInitialFastElementsKind(), array_map,
+                           IntPtrConstant(0), zero, site);
+  Goto(&done);
 
+  BIND(&with_capacity);
+  GotoIf(IsDoubleElementsKind(kind), &with_double_capacity);
+  result = AllocateJSArray(PACKED_ELEMENTS, array_map, capacity, zero, site);
   Goto(&done);
-  BIND(&done);
 
-  return result;
+  BIND(&with_double_capacity);
+  result =
+      AllocateJSArray(PACKED_DOUBLE_ELEMENTS, array_map, capacity, zero, site);
+  Goto(&done);
+
+  BIND(&done);
+  return result.value();
 }
 
 TNode<HeapObject> ConstructorBuiltinsAssembler::CreateShallowObjectLiteral(
@@ -1093,9 +1093,10 @@ BUILTIN(SegmentsPrototypeIterator) {
   HandleScope scope(isolate);
   CHECK_RECEIVER(JSSegments, segments, method_name);
   RETURN_RESULT_OR_FAILURE(
-      isolate,
-      JSSegmentIterator::Create(isolate, segments->icu_break_iterator().raw(),
-                                segments->granularity()));
+      isolate, JSSegmentIterator::Create(
+                   isolate, handle(segments->raw_string(), isolate),
+                   segments->icu_break_iterator().raw(),
+                   segments->granularity()));
 }
 
 BUILTIN(V8BreakIteratorConstructor) {
@@ -376,6 +376,71 @@ TNode<String> StringBuiltinsAssembler::StringAdd(
     GotoIf(Uint32LessThan(new_length, Uint32Constant(ConsString::kMinLength)),
            &non_cons);
 
+    Label allocate_cons(this);
+    GotoIf(Uint32GreaterThan(right_length,
+                             Uint32Constant(ConsString::kMaxChunkLength)),
+           &allocate_cons);
+    GotoIfNot(IsConsStringInstanceType(LoadInstanceType(left)),
+              &allocate_cons);
+    {
+      // Try to append {right} to the last chunk of {left}, which saves a level
+      // of ConsString nesting per append in `s += x` loops.
+      Comment("Merge into last chunk");
+      TNode<String> head =
+          LoadObjectField<String>(left, ConsString::kFirstOffset);
+      TNode<String> tail =
+          LoadObjectField<String>(left, ConsString::kSecondOffset);
+      TNode<Uint32T> tail_length = LoadStringLengthAsWord32(tail);
+      TNode<Uint32T> chunk_length = Uint32Add(tail_length, right_length);
+      GotoIf(Uint32GreaterThan(chunk_length,
+                               Uint32Constant(ConsString::kMaxChunkLength)),
+             &allocate_cons);
+
+      // Both parts must be sequential and have the same encoding.
+      TNode<Int32T> tail_type = LoadInstanceType(tail);
+      TNode<Int32T> right_type = LoadInstanceType(right);
+      GotoIf(IsSetWord32(Word32Xor(tail_type, right_type), kStringEncodingMask),
+             &allocate_cons);
+      GotoIf(IsSetWord32(Word32Or(tail_type, right_type),
+                         kStringRepresentationMask),
+             &allocate_cons);
+
+      TNode<IntPtrT> word_tail_length = Signed(ChangeUint32ToWord(tail_length));
+      TNode<IntPtrT> word_right_length =
+          Signed(ChangeUint32ToWord(right_length));
+      TVARIABLE(String, var_chunk);
+      Label two_byte_chunk(this), allocate_chunked_cons(this);
+      GotoIfNot(IsSetWord32(tail_type, kStringEncodingMask),
+                &two_byte_chunk);
+      var_chunk = AllocateSeqOneByteString(chunk_length);
+      CopyStringCharacters(tail, var_chunk.value(), IntPtrConstant(0),
+                           IntPtrConstant(0), word_tail_length,
+                           String::ONE_BYTE_ENCODING,
+                           String::ONE_BYTE_ENCODING);
+      CopyStringCharacters(right, var_chunk.value(), IntPtrConstant(0),
+                           word_tail_length, word_right_length,
+                           String::ONE_BYTE_ENCODING,
+                           String::ONE_BYTE_ENCODING);
+      Goto(&allocate_chunked_cons);
+
+      BIND(&two_byte_chunk);
+      var_chunk = AllocateSeqTwoByteString(chunk_length);
+      CopyStringCharacters(tail, var_chunk.value(), IntPtrConstant(0),
+                           IntPtrConstant(0), word_tail_length,
+                           String::TWO_BYTE_ENCODING,
+                           String::TWO_BYTE_ENCODING);
+      CopyStringCharacters(right, var_chunk.value(), IntPtrConstant(0),
+                           word_tail_length, word_right_length,
+                           String::TWO_BYTE_ENCODING,
+                           String::TWO_BYTE_ENCODING);
+      Goto(&allocate_chunked_cons);
+
+      BIND(&allocate_chunked_cons);
+      result = AllocateConsString(new_length, head, var_chunk.value());
+      Goto(&done_native);
+    }
+
+    BIND(&allocate_cons);
     result =
         AllocateConsString(new_length, var_left.value(), var_right.value());
     Goto(&done_native);
@@ -10367,6 +10367,7 @@ void CodeStubAssembler::CheckForAssociatedProtector(TNode<Name> name,
   GotoIf(TaggedEqual(name, IsConcatSpreadableSymbolConstant()), if_protector);
   GotoIf(TaggedEqual(name, ResolveStringConstant()), if_protector);
   GotoIf(TaggedEqual(name, ThenStringConstant()), if_protector);
+  GotoIf(TaggedEqual(name, ReturnStringConstant()), if_protector);
   // Fall through if no case matched.
 }
 
@@ -11431,6 +11432,14 @@ TNode<Int32T> CodeStubAssembler::LoadElementsKind(
   return elements_kind;
 }
 
+TNode<IntPtrT> CodeStubAssembler::LoadCapacityHint(
+    TNode<AllocationSite> allocation_site) {
+  TNode<Smi> transition_info = LoadTransitionInfo(allocation_site);
+  TNode<Uint32T> capacity = DecodeWord32<AllocationSite::CapacityHintBits>(
+      SmiToInt32(transition_info));
+  return Signed(ChangeUint32ToWord(capacity));
+}
+
 template <typename TIndex>
 TNode<TIndex> CodeStubAssembler::BuildFastLoop(const VariableList& vars,
                                                TNode<TIndex> start_index,
@@ -13747,9 +13756,17 @@ TNode<JSObject> CodeStubAssembler::AllocateJSIteratorResultForEntry(
     TNode<Context> context, TNode<Object> key, TNode<Object> value) {
   TNode<NativeContext> native_context = LoadNativeContext(context);
   TNode<Smi> length = SmiConstant(2);
-  int const elements_size = FixedArray::SizeFor(2);
-  TNode<FixedArray> elements =
-      UncheckedCast<FixedArray>(Allocate(elements_size));
+  // The result, the key-value array and its elements are allocated at once,
+  // which saves two allocation limit checks on every step of an entries
+  // iteration.
+  int const array_offset = JSIteratorResult::kSize;
+  int const elements_offset = array_offset + JSArray::kHeaderSize;
+  int const size = elements_offset + FixedArray::SizeFor(2);
+  TNode<HeapObject> result = Allocate(size);
+  TNode<HeapObject> array = UncheckedCast<HeapObject>(BitcastWordToTagged(
+      IntPtrAdd(BitcastTaggedToWord(result), IntPtrConstant(array_offset))));
+  TNode<FixedArray> elements = UncheckedCast<FixedArray>(BitcastWordToTagged(
+      IntPtrAdd(BitcastTaggedToWord(result), IntPtrConstant(elements_offset))));
   StoreObjectFieldRoot(elements, FixedArray::kMapOffset,
                        RootIndex::kFixedArrayMap);
   StoreObjectFieldNoWriteBarrier(elements, FixedArray::kLengthOffset, length);
@@ -13757,7 +13774,6 @@ TNode<JSObject> CodeStubAssembler::AllocateJSIteratorResultForEntry(
   StoreFixedArrayElement(elements, 1, value);
   TNode<Map> array_map = CAST(LoadContextElement(
       native_context, Context::JS_ARRAY_PACKED_ELEMENTS_MAP_INDEX));
-  TNode<HeapObject> array = Allocate(JSArray::kHeaderSize);
   StoreMapNoWriteBarrier(array, array_map);
   StoreObjectFieldRoot(array, JSArray::kPropertiesOrHashOffset,
                        RootIndex::kEmptyFixedArray);
@@ -13765,7 +13781,6 @@ TNode<JSObject> CodeStubAssembler::AllocateJSIteratorResultForEntry(
   StoreObjectFieldNoWriteBarrier(array, JSArray::kLengthOffset, length);
   TNode<Map> iterator_map = CAST(
       LoadContextElement(native_context, Context::ITERATOR_RESULT_MAP_INDEX));
-  TNode<HeapObject> result = Allocate(JSIteratorResult::kSize);
   StoreMapNoWriteBarrier(result, iterator_map);
   StoreObjectFieldRoot(result, JSIteratorResult::kPropertiesOrHashOffset,
                        RootIndex::kEmptyFixedArray);
@@ -2581,6 +2581,16 @@ class V8_EXPORT_PRIVATE CodeStubAssembler
         ExternalReference::address_of_builtin_subclassing_flag());
   }
 
+  // Whether any thread or async waiter waits in FutexEmulation.
+  TNode<BoolT> HasFutexWaiters() {
+    TNode<Uint32T> num_waiters = AtomicLoad<Uint32T>(
+        AtomicMemoryOrder::kSeqCst,
+        ReinterpretCast<RawPtrT>(ExternalConstant(
+            ExternalReference::address_of_futex_num_waiters())),
+        IntPtrConstant(0));
+    return Word32NotEqual(num_waiters, Int32Constant(0));
+  }
+
   // True iff |object| is a Smi or a HeapNumber or a BigInt.
   TNode<BoolT> IsNumeric(TNode<Object> object);
 
@@ -3364,6 +3374,7 @@ class V8_EXPORT_PRIVATE CodeStubAssembler
   TNode<Smi> LoadTransitionInfo(TNode<AllocationSite> allocation_site);
   TNode<JSObject> LoadBoilerplate(TNode<AllocationSite> allocation_site);
   TNode<Int32T> LoadElementsKind(TNode<AllocationSite> allocation_site);
+  TNode<IntPtrT> LoadCapacityHint(TNode<AllocationSite> allocation_site);
 
   enum class IndexAdvanceMode { kPre, kPost };
 
@@ -37,6 +37,7 @@
 #include "src/execution/runtime-profiler.h"
 #include "src/execution/vm-state-inl.h"
 #include "src/handles/maybe-handles.h"
+#include "src/heap/bytecode-flushing-policy.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/local-factory-inl.h"
 #include "src/heap/local-heap-inl.h"
@@ -46,6 +47,7 @@
 #include "src/interpreter/interpreter.h"
 #include "src/logging/counters-scopes.h"
 #include "src/logging/log-inl.h"
+#include "src/logging/metrics.h"
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/objects/feedback-cell-inl.h"
 #include "src/objects/js-function-inl.h"
@@ -191,6 +193,13 @@ class CompilerTracer : public AllStatic {
   }
 };
 
+// Whether Compiler::LogFunctionCompilation logs anything.
+bool IsLoggingFunctionCompilation(Isolate* isolate) {
+  return isolate->logger()->is_listening_to_code_events() ||
+         isolate->is_profiling() || FLAG_log_function_events ||
+         isolate->code_event_dispatcher()->IsListeningToCodeEvents();
+}
+
 }  // namespace
 
 // Helper that times a scoped region and records the elapsed time.
@@ -219,11 +228,7 @@ void Compiler::LogFunctionCompilation(Isolate* isolate,
   // Log the code generation. If source information is available include
   // script name and line number. Check explicitly whether logging is
   // enabled as finding the line number is not free.
-  if (!isolate->logger()->is_listening_to_code_events() &&
-      !isolate->is_profiling() && !FLAG_log_function_events &&
-      !isolate->code_event_dispatcher()->IsListeningToCodeEvents()) {
-    return;
-  }
+  if (!IsLoggingFunctionCompilation(isolate)) return;
 
   int line_num = Script::GetLineNumber(script, shared->StartPosition()) + 1;
   int column_num = Script::GetColumnNumber(script, shared->StartPosition()) + 1;
@@ -320,17 +325,20 @@ CompilationJob::Status UnoptimizedCompilationJob::FinalizeJob(
 
 namespace {
 
-void RecordUnoptimizedCompilationStats(Isolate* isolate,
-                                       Handle<SharedFunctionInfo> shared_info) {
+template <typename IsolateT>
+int UnoptimizedCodeSize(IsolateT* isolate, SharedFunctionInfo shared_info) {
 #if V8_ENABLE_WEBASSEMBLY
-  int code_size =
-      shared_info->HasBytecodeArray()
-          ? shared_info->GetBytecodeArray(isolate).SizeIncludingMetadata()
-          : shared_info->asm_wasm_data().Size();
+  return shared_info.HasBytecodeArray()
+             ? shared_info.GetBytecodeArray(isolate).SizeIncludingMetadata()
+             : shared_info.asm_wasm_data().Size();
 #else
-  int code_size =
-      shared_info->GetBytecodeArray(isolate).SizeIncludingMetadata();
+  return shared_info.GetBytecodeArray(isolate).SizeIncludingMetadata();
 #endif  // V8_ENABLE_WEBASSEMBLY
+}
+
+void RecordUnoptimizedCompilationStats(Isolate* isolate,
+                                       Handle<SharedFunctionInfo> shared_info) {
+  int code_size = UnoptimizedCodeSize(isolate, *shared_info);
 
   Counters* counters = isolate->counters();
   // TODO(4280): Rename counters from "baseline" to "unoptimized" eventually.
@@ -486,6 +494,30 @@ void OptimizedCompilationJob::RecordCompilationStats(CompilationMode mode,
     counters->turbofan_ticks()->AddSample(static_cast<int>(
         compilation_info()->tick_counter().CurrentTicks() / 1000));
   }
+  RecordCompilationMetrics(mode, true, isolate);
+}
+
+void OptimizedCompilationJob::RecordCompilationMetrics(CompilationMode mode,
+                                                       bool success,
+                                                       Isolate* isolate) const {
+  if (!isolate->metrics_recorder()->HasEmbedderRecorder()) return;
+  OptimizedCompilationInfo* info = compilation_info();
+  v8::metrics::OptimizedFunctionCompiled event;
+  event.concurrent = mode == kConcurrent;
+  event.osr = info->is_osr();
+  event.success = success;
+  if (info->has_bytecode_array()) {
+    event.bytecode_size_in_bytes = info->bytecode_array()->length();
+  }
+  event.inlined_bytecode_size_in_bytes = info->inlined_bytecode_size();
+  event.graph_node_count = info->graph_node_count();
+  event.peak_zone_size_in_bytes = info->peak_zone_size();
+  event.prepare_duration_in_us = time_taken_to_prepare_.InMicroseconds();
+  event.execute_duration_in_us = time_taken_to_execute_.InMicroseconds();
+  event.finalize_duration_in_us = time_taken_to_finalize_.InMicroseconds();
+  isolate->metrics_recorder()->AddMainThreadEvent(
+      event, isolate->GetOrRegisterRecorderContextId(
+                 handle(info->closure()->native_context(), isolate)));
 }
 
 void OptimizedCompilationJob::RecordFunctionCompilation(
@@ -930,6 +962,13 @@ void InsertCodeIntoOptimizedCodeCache(
   Handle<Code> code = compilation_info->code();
   Handle<JSFunction> function = compilation_info->closure();
   Handle<SharedFunctionInfo> shared(function->shared(), function->GetIsolate());
+  if ((FLAG_optimization_hints || FLAG_cross_context_optimization_hints) &&
+      kind == CodeKind::TURBOFAN) {
+    shared->set_has_optimization_hint(true);
+    for (const auto& inlined : compilation_info->inlined_functions()) {
+      inlined.shared_info->set_has_inlining_hint(true);
+    }
+  }
   Handle<NativeContext> native_context(function->context().native_context(),
                                        function->GetIsolate());
   if (compilation_info->osr_offset().IsNone()) {
@@ -974,12 +1013,16 @@ bool GetOptimizedCodeNow(OptimizedCompilationJob* job, Isolate* isolate,
                         isolate->main_thread_local_isolate())) {
       UnparkedScope unparked_scope(isolate->main_thread_local_isolate());
       CompilerTracer::TraceAbortedJob(isolate, compilation_info);
+      job->RecordCompilationMetrics(OptimizedCompilationJob::kSynchronous,
+                                    false, isolate);
       return false;
     }
   }
 
   if (job->FinalizeJob(isolate) != CompilationJob::SUCCEEDED) {
     CompilerTracer::TraceAbortedJob(isolate, compilation_info);
+    job->RecordCompilationMetrics(OptimizedCompilationJob::kSynchronous, false,
+                                  isolate);
     return false;
   }
 
@@ -1155,6 +1198,8 @@ MaybeHandle<Code> GetOptimizedCode(
   if (mode == ConcurrencyMode::kConcurrent) {
     if (GetOptimizedCodeLater(std::move(job), isolate, compilation_info,
                               code_kind, function)) {
+      // OSR continues in the unoptimized frame that requested it.
+      if (!osr_offset.IsNone()) return {};
       return ContinuationForConcurrentOptimization(isolate, function);
     }
   } else {
@@ -1228,12 +1273,17 @@ bool FailWithPendingException(Isolate* isolate, Handle<Script> script,
                                           parse_info->pending_error_handler());
 }
 
+// If |summary| is given, it covers the first functions of the list, which were
+// finalized off-thread. Their stats are recorded in bulk, and they are only
+// visited if they need source positions, coverage info, an interpreter
+// trampoline copy or are logged.
 void FinalizeUnoptimizedCompilation(
     Isolate* isolate, Handle<Script> script,
     const UnoptimizedCompileFlags& flags,
     const UnoptimizedCompileState* compile_state,
     const FinalizeUnoptimizedCompilationDataList&
-        finalize_unoptimized_compilation_data_list) {
+        finalize_unoptimized_compilation_data_list,
+    const OffThreadFinalizationSummary* summary = nullptr) {
   if (compile_state->pending_error_handler()->has_pending_warnings()) {
     compile_state->pending_error_handler()->ReportWarnings(isolate, script);
   }
@@ -1242,7 +1292,26 @@ void FinalizeUnoptimizedCompilation(
                                (!flags.collect_source_positions() &&
                                 isolate->NeedsSourcePositionsForProfiling());
 
-  for (const auto& finalize_data : finalize_unoptimized_compilation_data_list) {
+  size_t summarized_count = 0;
+  size_t first_visited = 0;
+  if (summary != nullptr) {
+    DCHECK_LE(summary->function_count,
+              finalize_unoptimized_compilation_data_list.size());
+    summarized_count = summary->function_count;
+    Counters* counters = isolate->counters();
+    counters->total_baseline_code_size()->Increment(summary->code_size);
+    counters->total_baseline_compile_count()->Increment(
+        static_cast<int>(summarized_count));
+    if (!need_source_positions && !FLAG_interpreted_frames_native_stack &&
+        !summary->has_coverage_info && !IsLoggingFunctionCompilation(isolate)) {
+      first_visited = summarized_count;
+    }
+  }
+
+  for (size_t i = first_visited;
+       i < finalize_unoptimized_compilation_data_list.size(); ++i) {
+    const FinalizeUnoptimizedCompilationData& finalize_data =
+        finalize_unoptimized_compilation_data_list[i];
     Handle<SharedFunctionInfo> shared_info = finalize_data.function_handle();
     // It's unlikely, but possible, that the bytecode was flushed between being
     // allocated and now, so guard against that case, and against it being
@@ -1270,9 +1339,15 @@ void FinalizeUnoptimizedCompilation(
       isolate->debug()->InstallCoverageInfo(shared_info, coverage_info);
     }
 
-    LogUnoptimizedCompilation(isolate, shared_info, log_tag,
-                              finalize_data.time_taken_to_execute(),
-                              finalize_data.time_taken_to_finalize());
+    if (i < summarized_count) {
+      RecordUnoptimizedFunctionCompilation(
+          isolate, log_tag, shared_info, finalize_data.time_taken_to_execute(),
+          finalize_data.time_taken_to_finalize());
+    } else {
+      LogUnoptimizedCompilation(isolate, shared_info, log_tag,
+                                finalize_data.time_taken_to_execute(),
+                                finalize_data.time_taken_to_finalize());
+    }
   }
 }
 
@@ -1281,9 +1356,11 @@ void FinalizeUnoptimizedScriptCompilation(
     const UnoptimizedCompileFlags& flags,
     const UnoptimizedCompileState* compile_state,
     const FinalizeUnoptimizedCompilationDataList&
-        finalize_unoptimized_compilation_data_list) {
+        finalize_unoptimized_compilation_data_list,
+    const OffThreadFinalizationSummary* summary = nullptr) {
   FinalizeUnoptimizedCompilation(isolate, script, flags, compile_state,
-                                 finalize_unoptimized_compilation_data_list);
+                                 finalize_unoptimized_compilation_data_list,
+                                 summary);
 
   script->set_compilation_state(Script::COMPILATION_STATE_COMPILED);
 
@@ -1486,8 +1563,10 @@ DeferredFinalizationJobData::DeferredFinalizationJobData(
     : function_handle_(isolate->heap()->NewPersistentHandle(function_handle)),
       job_(std::move(job)) {}
 
-BackgroundCompileTask::BackgroundCompileTask(ScriptStreamingData* streamed_data,
-                                             Isolate* isolate, ScriptType type)
+BackgroundCompileTask::BackgroundCompileTask(
+    ScriptStreamingData* streamed_data, Isolate* isolate, ScriptType type,
+    v8::ScriptCompiler::CompileHintCallback compile_hint_callback,
+    void* compile_hint_callback_data)
     : flags_(UnoptimizedCompileFlags::ForToplevelCompile(
           isolate, true, construct_language_mode(FLAG_use_strict),
           REPLMode::kNo, type, FLAG_lazy_streaming)),
@@ -1513,6 +1592,8 @@ BackgroundCompileTask::BackgroundCompileTask(ScriptStreamingData* streamed_data,
   std::unique_ptr<Utf16CharacterStream> stream(ScannerStream::For(
       streamed_data->source_stream.get(), streamed_data->encoding));
   info_->set_character_stream(std::move(stream));
+  info_->set_compile_hint_callback(compile_hint_callback,
+                                   compile_hint_callback_data);
 }
 
 BackgroundCompileTask::BackgroundCompileTask(
@@ -1651,6 +1732,18 @@ void BackgroundCompileTask::Run() {
         PreparePendingException(&isolate, info_.get());
       }
 
+      // Sum up what the main thread would otherwise collect per function.
+      for (const FinalizeUnoptimizedCompilationData& finalize_data :
+           finalize_unoptimized_compilation_data_) {
+        off_thread_finalization_summary_.code_size +=
+            UnoptimizedCodeSize(&isolate, *finalize_data.function_handle());
+        if (!finalize_data.coverage_info().is_null()) {
+          off_thread_finalization_summary_.has_coverage_info = true;
+        }
+      }
+      off_thread_finalization_summary_.function_count =
+          finalize_unoptimized_compilation_data_.size();
+
       outer_function_sfi_ =
           isolate.heap()->NewPersistentMaybeHandle(maybe_result);
       script_ = isolate.heap()->NewPersistentHandle(script);
@@ -1892,6 +1985,13 @@ bool Compiler::Compile(Isolate* isolate, Handle<SharedFunctionInfo> shared_info,
     CompileAllWithBaseline(isolate, finalize_unoptimized_compilation_data_list);
   }
 
+  if (shared_info->has_flushed_bytecode()) {
+    shared_info->set_has_flushed_bytecode(false);
+    isolate->heap()
+        ->bytecode_flushing_policy()
+        ->NotifyFlushedBytecodeRecompiled();
+  }
+
   DCHECK(!isolate->has_pending_exception());
   DCHECK(is_compiled_scope->is_compiled());
   return true;
@@ -2687,6 +2787,9 @@ MaybeHandle<SharedFunctionInfo> CompileScriptOnMainThread(
   UnoptimizedCompileState compile_state(isolate);
   ParseInfo parse_info(isolate, flags, &compile_state);
   parse_info.set_extension(extension);
+  parse_info.set_compile_hint_callback(
+      script_details.compile_hint_callback,
+      script_details.compile_hint_callback_data);
 
   Handle<Script> script =
       NewScript(isolate, &parse_info, source, script_details, natives);
@@ -3230,7 +3333,10 @@ Compiler::GetSharedFunctionInfoForStreamedScript(
     } else {
       FinalizeUnoptimizedScriptCompilation(
           isolate, script, task->flags(), task->compile_state(),
-          *task->finalize_unoptimized_compilation_data());
+          *task->finalize_unoptimized_compilation_data(),
+          FLAG_finalize_streaming_on_background
+              ? task->off_thread_finalization_summary()
+              : nullptr);
 
       // Add compiled code to the isolate cache.
       TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
@@ -3317,11 +3423,14 @@ template Handle<SharedFunctionInfo> Compiler::GetSharedFunctionInfo(
 MaybeHandle<Code> Compiler::GetOptimizedCodeForOSR(Isolate* isolate,
                                                    Handle<JSFunction> function,
                                                    BytecodeOffset osr_offset,
-                                                   JavaScriptFrame* osr_frame) {
+                                                   JavaScriptFrame* osr_frame,
+                                                   ConcurrencyMode mode) {
   DCHECK(!osr_offset.IsNone());
   DCHECK_NOT_NULL(osr_frame);
-  return GetOptimizedCode(isolate, function, ConcurrencyMode::kNotConcurrent,
-                          CodeKindForOSR(), osr_offset, osr_frame);
+  // The frame is gone by the time a concurrent job runs.
+  if (mode == ConcurrencyMode::kConcurrent) osr_frame = nullptr;
+  return GetOptimizedCode(isolate, function, mode, CodeKindForOSR(),
+                          osr_offset, osr_frame);
 }
 
 // static
@@ -3363,8 +3472,19 @@ bool Compiler::FinalizeOptimizedCompilationJob(OptimizedCompilationJob* job,
       if (V8_LIKELY(use_result)) {
         InsertCodeIntoOptimizedCodeCache(compilation_info);
         CompilerTracer::TraceCompletedJob(isolate, compilation_info);
-        compilation_info->closure()->set_code(*compilation_info->code(),
-                                              kReleaseStore);
+        if (compilation_info->is_osr()) {
+          // The code is in the OSR code cache now. Arm all back edges so
+          // that the next one the function executes enters it.
+          Handle<JSFunction> function = compilation_info->closure();
+          if (function->IsInOptimizationQueue()) {
+            function->ClearOptimizationMarker();
+          }
+          shared->GetBytecodeArray(isolate).set_osr_loop_nesting_level(
+              AbstractCode::kMaxLoopNestingMarker);
+        } else {
+          compilation_info->closure()->set_code(*compilation_info->code(),
+                                                kReleaseStore);
+        }
       }
       return CompilationJob::SUCCEEDED;
     }
@@ -3372,8 +3492,13 @@ bool Compiler::FinalizeOptimizedCompilationJob(OptimizedCompilationJob* job,
 
   DCHECK_EQ(job->state(), CompilationJob::State::kFailed);
   CompilerTracer::TraceAbortedJob(isolate, compilation_info);
+  job->RecordCompilationMetrics(OptimizedCompilationJob::kConcurrent, false,
+                                isolate);
   if (V8_LIKELY(use_result)) {
-    compilation_info->closure()->set_code(shared->GetCode(), kReleaseStore);
+    // A failed OSR job never replaced the code of the function.
+    if (!compilation_info->is_osr()) {
+      compilation_info->closure()->set_code(shared->GetCode(), kReleaseStore);
+    }
     // Clear the InOptimizationQueue marker, if it exists.
     if (compilation_info->closure()->IsInOptimizationQueue()) {
       compilation_info->closure()->ClearOptimizationMarker();
@@ -227,9 +227,14 @@ class V8_EXPORT_PRIVATE Compiler : public AllStatic {
   // instead of generating JIT code for a function at all.
 
   // Generate and return optimized code for OSR, or empty handle on failure.
+  // In concurrent mode, an empty handle is also returned once the job has
+  // been queued. The finished code is put into the OSR code cache and the
+  // back edges of the function are armed again, so that the next OSR request
+  // finds it.
   V8_WARN_UNUSED_RESULT static MaybeHandle<Code> GetOptimizedCodeForOSR(
       Isolate* isolate, Handle<JSFunction> function, BytecodeOffset osr_offset,
-      JavaScriptFrame* osr_frame);
+      JavaScriptFrame* osr_frame,
+      ConcurrencyMode mode = ConcurrencyMode::kNotConcurrent);
 };
 
 // A base class for compilation jobs intended to run concurrent to the main
@@ -386,6 +391,9 @@ class OptimizedCompilationJob : public CompilationJob {
 
   enum CompilationMode { kConcurrent, kSynchronous };
   void RecordCompilationStats(CompilationMode mode, Isolate* isolate) const;
+  // Reports a v8::metrics::OptimizedFunctionCompiled event for this job.
+  void RecordCompilationMetrics(CompilationMode mode, bool success,
+                                Isolate* isolate) const;
   void RecordFunctionCompilation(CodeEventListener::LogEventsAndTags tag,
                                  Isolate* isolate) const;
 
@@ -449,6 +457,14 @@ class FinalizeUnoptimizedCompilationData {
 using FinalizeUnoptimizedCompilationDataList =
     std::vector<FinalizeUnoptimizedCompilationData>;
 
+// Totals over the functions that a BackgroundCompileTask finalized, which let
+// the main thread record them without visiting every function.
+struct OffThreadFinalizationSummary {
+  size_t function_count = 0;
+  int code_size = 0;
+  bool has_coverage_info = false;
+};
+
 class DeferredFinalizationJobData {
  public:
   DeferredFinalizationJobData(Isolate* isolate,
@@ -495,8 +511,10 @@ class V8_EXPORT_PRIVATE BackgroundCompileTask {
   // script associated with |data| and can be finalized with
   // Compiler::GetSharedFunctionInfoForStreamedScript.
   // Note: does not take ownership of |data|.
-  BackgroundCompileTask(ScriptStreamingData* data, Isolate* isolate,
-                        v8::ScriptType type);
+  BackgroundCompileTask(
+      ScriptStreamingData* data, Isolate* isolate, v8::ScriptType type,
+      v8::ScriptCompiler::CompileHintCallback compile_hint_callback = nullptr,
+      void* compile_hint_callback_data = nullptr);
   BackgroundCompileTask(const BackgroundCompileTask&) = delete;
   BackgroundCompileTask& operator=(const BackgroundCompileTask&) = delete;
   ~BackgroundCompileTask();
@@ -532,6 +550,9 @@ class V8_EXPORT_PRIVATE BackgroundCompileTask {
     return use_counts_[static_cast<int>(feature)];
   }
   int total_preparse_skipped() const { return total_preparse_skipped_; }
+  const OffThreadFinalizationSummary* off_thread_finalization_summary() const {
+    return &off_thread_finalization_summary_;
+  }
 
   // Jobs which could not be finalized in the background task, and need to be
   // finalized on the main thread.
@@ -569,6 +590,7 @@ class V8_EXPORT_PRIVATE BackgroundCompileTask {
   DeferredFinalizationJobDataList jobs_to_retry_finalization_on_main_thread_;
   int use_counts_[v8::Isolate::kUseCounterFeatureCount] = {0};
   int total_preparse_skipped_ = 0;
+  OffThreadFinalizationSummary off_thread_finalization_summary_;
 
   // Single function data for top-level function compilation.
   int start_position_;
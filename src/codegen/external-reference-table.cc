@@ -272,6 +272,8 @@ void ExternalReferenceTable::AddStubCache(Isolate* isolate, int* index) {
   Add(load_stub_cache->key_reference(StubCache::kSecondary).address(), index);
   Add(load_stub_cache->value_reference(StubCache::kSecondary).address(), index);
   Add(load_stub_cache->map_reference(StubCache::kSecondary).address(), index);
+  Add(load_stub_cache->mask_reference(StubCache::kPrimary).address(), index);
+  Add(load_stub_cache->mask_reference(StubCache::kSecondary).address(), index);
 
   StubCache* store_stub_cache = isolate->store_stub_cache();
 
@@ -283,6 +285,9 @@ void ExternalReferenceTable::AddStubCache(Isolate* isolate, int* index) {
   Add(store_stub_cache->value_reference(StubCache::kSecondary).address(),
       index);
   Add(store_stub_cache->map_reference(StubCache::kSecondary).address(), index);
+  Add(store_stub_cache->mask_reference(StubCache::kPrimary).address(), index);
+  Add(store_stub_cache->mask_reference(StubCache::kSecondary).address(),
+      index);
 
   CHECK_EQ(kSizeIsolateIndependent + kExternalReferenceCountIsolateDependent +
                kIsolateAddressReferenceCount + kStubCacheReferenceCount,
@@ -98,6 +98,7 @@ class StatsCounter;
     "address_of_enable_experimental_regexp_engine")                            \
   V(address_of_float_abs_constant, "float_absolute_constant")                  \
   V(address_of_float_neg_constant, "float_negate_constant")                    \
+  V(address_of_futex_num_waiters, "FutexEmulation::num_waiters_address()")     \
   V(address_of_min_int, "LDoubleConstant::min_int")                            \
   V(address_of_mock_arraybuffer_allocator_flag,                                \
     "FLAG_mock_arraybuffer_allocator")                                         \
@@ -105,6 +106,9 @@ class StatsCounter;
   V(address_of_runtime_stats_flag, "TracingFlags::runtime_stats")              \
   V(address_of_the_hole_nan, "the_hole_nan")                                   \
   V(address_of_uint32_bias, "uint32_bias")                                     \
+  V(array_indexof_includes_double, "array_indexof_includes_double")            \
+  V(array_indexof_includes_smi_or_object,                                      \
+    "array_indexof_includes_smi_or_object")                                    \
   V(baseline_pc_for_bytecode_offset, "BaselinePCForBytecodeOffset")            \
   V(baseline_pc_for_next_executed_bytecode,                                    \
     "BaselinePCForNextExecutedBytecode")                                       \
@@ -290,6 +294,8 @@ class StatsCounter;
     "RegExpMacroAssembler::CaseInsensitiveCompareNonUnicode()")                \
   V(re_is_character_in_range_array,                                            \
     "RegExpMacroAssembler::IsCharacterInRangeArray()")                         \
+  V(re_skip_until_one_byte_character,                                          \
+    "RegExpMacroAssembler::SkipUntilOneByteCharacter()")                       \
   V(re_check_stack_guard_state,                                                \
     "RegExpMacroAssembler*::CheckStackGuardState()")                           \
   V(re_grow_stack, "NativeRegExpMacroAssembler::GrowStack()")                  \
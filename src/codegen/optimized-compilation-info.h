@@ -192,6 +192,12 @@ class V8_EXPORT_PRIVATE OptimizedCompilationInfo final {
     inlined_bytecode_size_ = size;
   }
 
+  // Statistics about the compilation, reported through v8::metrics.
+  size_t graph_node_count() const { return graph_node_count_; }
+  void set_graph_node_count(size_t count) { graph_node_count_ = count; }
+  size_t peak_zone_size() const { return peak_zone_size_; }
+  void set_peak_zone_size(size_t size) { peak_zone_size_ = size; }
+
   struct InlinedFunctionHolder {
     Handle<SharedFunctionInfo> shared_info;
     Handle<BytecodeArray> bytecode_array;  // Explicit to prevent flushing.
@@ -292,6 +298,8 @@ class V8_EXPORT_PRIVATE OptimizedCompilationInfo final {
   static constexpr int kNoOptimizationId = -1;
   const int optimization_id_;
   unsigned inlined_bytecode_size_ = 0;
+  size_t graph_node_count_ = 0;
+  size_t peak_zone_size_ = 0;
 
   base::Vector<const char> debug_name_;
   std::unique_ptr<char[]> trace_turbo_filename_;
@@ -32,6 +32,8 @@ struct ScriptDetails {
   MaybeHandle<FixedArray> host_defined_options;
   REPLMode repl_mode;
   const ScriptOriginOptions origin_options;
+  v8::ScriptCompiler::CompileHintCallback compile_hint_callback = nullptr;
+  void* compile_hint_callback_data = nullptr;
 };
 
 }  // namespace internal
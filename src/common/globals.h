@@ -1406,7 +1406,10 @@ inline uint32_t ObjectHash(Address address) {
 //
 //   kSignedSmall -> kSignedSmallInputs -> kNumber  -> kNumberOrOddball -> kAny
 //                                                     kString          -> kAny
-//                                                     kBigInt          -> kAny
+//                                        kBigInt64 -> kBigInt          -> kAny
+//
+// kBigInt64 means that the inputs and the result all fit into a signed
+// 64-bit integer, so TurboFan can compute the result in a register.
 //
 // Technically we wouldn't need the separation between the kNumber and the
 // kNumberOrOddball values here, since for binary operations, we always
@@ -1423,7 +1426,8 @@ class BinaryOperationFeedback {
     kNumber = 0x7,
     kNumberOrOddball = 0xF,
     kString = 0x10,
-    kBigInt = 0x20,
+    kBigInt64 = 0x20,
+    kBigInt = 0x60,
     kAny = 0x7F
   };
 };
@@ -1671,7 +1675,10 @@ inline std::ostream& operator<<(std::ostream& os,
 }
 
 enum class SpeculationMode { kAllowSpeculation, kDisallowSpeculation };
-enum class CallFeedbackContent { kTarget, kReceiver };
+// kBoundTargetFunction means that the feedback is a JSBoundFunction, and that
+// the call site has seen several bound functions that share its map,
+// [[BoundTargetFunction]] and number of [[BoundArguments]].
+enum class CallFeedbackContent { kTarget, kReceiver, kBoundTargetFunction };
 
 inline std::ostream& operator<<(std::ostream& os,
                                 SpeculationMode speculation_mode) {
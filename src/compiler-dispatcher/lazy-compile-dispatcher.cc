@@ -40,8 +40,8 @@ LazyCompileDispatcher::LazyCompileDispatcher(Isolate* isolate,
       max_stack_size_(max_stack_size),
       trace_compiler_dispatcher_(FLAG_trace_compiler_dispatcher),
       task_manager_(new CancelableTaskManager()),
-      next_job_id_(0),
       shared_to_unoptimized_job_id_(isolate->heap()),
+      next_job_id_(0),
       idle_task_scheduled_(false),
       num_worker_tasks_(0),
       main_thread_blocking_on_job_(nullptr),
@@ -62,7 +62,10 @@ base::Optional<LazyCompileDispatcher::JobId> LazyCompileDispatcher::Enqueue(
     const FunctionLiteral* function_literal) {
   TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
                "V8.LazyCompilerDispatcherEnqueue");
-  RCS_SCOPE(isolate_, RuntimeCallCounterId::kCompileEnqueueOnDispatcher);
+  // This can be called from a streaming compile on a background thread, so use
+  // the parse's own runtime call stats.
+  RCS_SCOPE(outer_parse_info->runtime_call_stats(),
+            RuntimeCallCounterId::kCompileEnqueueOnDispatcher);
 
   if (!IsEnabled()) return base::nullopt;
 
@@ -70,8 +73,16 @@ base::Optional<LazyCompileDispatcher::JobId> LazyCompileDispatcher::Enqueue(
       outer_parse_info, function_name, function_literal,
       worker_thread_runtime_call_stats_, background_compile_timer_,
       static_cast<int>(max_stack_size_)));
-  JobMap::const_iterator it = InsertJob(std::move(job));
-  JobId id = it->first;
+  Job* raw_job = job.get();
+  JobId id;
+  if (ThreadId::Current() == isolate_->thread_id()) {
+    id = InsertJob(std::move(job))->first;
+  } else {
+    // Only the main thread may touch jobs_, so hand the job over to it.
+    base::MutexGuard lock(&mutex_);
+    id = next_job_id_++;
+    jobs_from_background_.emplace_back(id, std::move(job));
+  }
   if (trace_compiler_dispatcher_) {
     PrintF(
         "LazyCompileDispatcher: enqueued job %zu for function literal id %d\n",
@@ -82,7 +93,7 @@ base::Optional<LazyCompileDispatcher::JobId> LazyCompileDispatcher::Enqueue(
   // thread.
   {
     base::MutexGuard lock(&mutex_);
-    pending_background_jobs_.insert(it->second.get());
+    pending_background_jobs_.insert(raw_job);
   }
   ScheduleMoreWorkerTasksIfNeeded();
   return base::make_optional(id);
@@ -99,11 +110,17 @@ bool LazyCompileDispatcher::IsEnqueued(
 }
 
 bool LazyCompileDispatcher::IsEnqueued(JobId job_id) const {
-  return jobs_.find(job_id) != jobs_.end();
+  if (jobs_.find(job_id) != jobs_.end()) return true;
+  base::MutexGuard lock(&mutex_);
+  for (auto& it : jobs_from_background_) {
+    if (it.first == job_id) return true;
+  }
+  return false;
 }
 
 void LazyCompileDispatcher::RegisterSharedFunctionInfo(
     JobId job_id, SharedFunctionInfo function) {
+  InsertJobsFromBackground();
   DCHECK_NE(jobs_.find(job_id), jobs_.end());
 
   if (trace_compiler_dispatcher_) {
@@ -164,6 +181,14 @@ bool LazyCompileDispatcher::FinishNow(Handle<SharedFunctionInfo> function) {
   JobMap::const_iterator it = GetJobFor(function);
   CHECK(it != jobs_.end());
   Job* job = it->second.get();
+  {
+    base::MutexGuard lock(&mutex_);
+    if (job->has_run) {
+      isolate_->counters()->lazy_dispatcher_hits()->Increment();
+    } else {
+      isolate_->counters()->lazy_dispatcher_misses()->Increment();
+    }
+  }
   WaitForJobIfRunningOnBackground(job);
 
   if (!job->has_run) {
@@ -185,11 +210,13 @@ void LazyCompileDispatcher::AbortJob(JobId job_id) {
   if (trace_compiler_dispatcher_) {
     PrintF("LazyCompileDispatcher: aborted job %zu\n", job_id);
   }
+  InsertJobsFromBackground();
   JobMap::const_iterator job_it = jobs_.find(job_id);
   Job* job = job_it->second.get();
 
   base::LockGuard<base::Mutex> lock(&mutex_);
   pending_background_jobs_.erase(job);
+  if (job->has_run) isolate_->counters()->lazy_dispatcher_wasted()->Increment();
   if (running_background_jobs_.find(job) == running_background_jobs_.end()) {
     RemoveJob(job_it);
   } else {
@@ -202,8 +229,12 @@ void LazyCompileDispatcher::AbortJob(JobId job_id) {
 void LazyCompileDispatcher::AbortAll() {
   task_manager_->TryAbortAll();
 
+  InsertJobsFromBackground();
   for (auto& it : jobs_) {
     WaitForJobIfRunningOnBackground(it.second.get());
+    if (it.second->has_run) {
+      isolate_->counters()->lazy_dispatcher_wasted()->Increment();
+    }
     if (trace_compiler_dispatcher_) {
       PrintF("LazyCompileDispatcher: aborted job %zu\n", it.first);
     }
@@ -360,12 +391,27 @@ LazyCompileDispatcher::JobMap::const_iterator LazyCompileDispatcher::InsertJob(
     std::unique_ptr<Job> job) {
   bool added;
   JobMap::const_iterator it;
-  std::tie(it, added) =
-      jobs_.insert(std::make_pair(next_job_id_++, std::move(job)));
+  JobId id;
+  {
+    base::MutexGuard lock(&mutex_);
+    id = next_job_id_++;
+  }
+  std::tie(it, added) = jobs_.insert(std::make_pair(id, std::move(job)));
   DCHECK(added);
   return it;
 }
 
+void LazyCompileDispatcher::InsertJobsFromBackground() {
+  DCHECK_EQ(ThreadId::Current(), isolate_->thread_id());
+  base::MutexGuard lock(&mutex_);
+  for (auto& it : jobs_from_background_) {
+    bool added = jobs_.insert(std::move(it)).second;
+    DCHECK(added);
+    USE(added);
+  }
+  jobs_from_background_.clear();
+}
+
 LazyCompileDispatcher::JobMap::const_iterator LazyCompileDispatcher::RemoveJob(
     LazyCompileDispatcher::JobMap::const_iterator it) {
   Job* job = it->second.get();
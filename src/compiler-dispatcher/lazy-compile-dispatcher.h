@@ -10,6 +10,7 @@
 #include <memory>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "src/base/atomic-utils.h"
 #include "src/base/macros.h"
@@ -84,6 +85,9 @@ class V8_EXPORT_PRIVATE LazyCompileDispatcher {
   // Returns true if the compiler dispatcher is enabled.
   bool IsEnabled() const;
 
+  // Can be called from any thread. Jobs enqueued from a background thread
+  // become visible to the main thread once their SharedFunctionInfo is
+  // registered.
   base::Optional<JobId> Enqueue(const ParseInfo* outer_parse_info,
                                 const AstRawString* function_name,
                                 const FunctionLiteral* function_literal);
@@ -147,6 +151,8 @@ class V8_EXPORT_PRIVATE LazyCompileDispatcher {
   void DoIdleWork(double deadline_in_seconds);
   // Returns iterator to the inserted job.
   JobMap::const_iterator InsertJob(std::unique_ptr<Job> job);
+  // Moves the jobs enqueued from background threads into jobs_.
+  void InsertJobsFromBackground();
   // Returns iterator following the removed job.
   JobMap::const_iterator RemoveJob(JobMap::const_iterator job);
 
@@ -162,9 +168,6 @@ class V8_EXPORT_PRIVATE LazyCompileDispatcher {
 
   std::unique_ptr<CancelableTaskManager> task_manager_;
 
-  // Id for next job to be added
-  JobId next_job_id_;
-
   // Mapping from job_id to job.
   JobMap jobs_;
 
@@ -174,7 +177,13 @@ class V8_EXPORT_PRIVATE LazyCompileDispatcher {
 
   // The following members can be accessed from any thread. Methods need to hold
   // the mutex |mutex_| while accessing them.
-  base::Mutex mutex_;
+  mutable base::Mutex mutex_;
+
+  // Id for next job to be added
+  JobId next_job_id_;
+
+  // Jobs enqueued from background threads that are not yet in jobs_.
+  std::vector<std::pair<JobId, std::unique_ptr<Job>>> jobs_from_background_;
 
   // True if an idle task is scheduled to be run.
   bool idle_task_scheduled_;
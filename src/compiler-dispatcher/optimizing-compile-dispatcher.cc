@@ -28,7 +28,10 @@ void DisposeCompilationJob(OptimizedCompilationJob* job,
                            bool restore_function_code) {
   if (restore_function_code) {
     Handle<JSFunction> function = job->compilation_info()->closure();
-    function->set_code(function->shared().GetCode(), kReleaseStore);
+    // OSR jobs never replaced the code of the function.
+    if (!job->compilation_info()->is_osr()) {
+      function->set_code(function->shared().GetCode(), kReleaseStore);
+    }
     if (function->IsInOptimizationQueue()) {
       function->ClearOptimizationMarker();
     }
@@ -103,25 +106,59 @@ OptimizingCompileDispatcher::~OptimizingCompileDispatcher() {
   DeleteArray(input_queue_);
 }
 
-OptimizedCompilationJob* OptimizingCompileDispatcher::NextInput(
+OptimizingCompileDispatcher::QueuedJob OptimizingCompileDispatcher::NextInput(
     LocalIsolate* local_isolate) {
   base::MutexGuard access_input_queue_(&input_queue_mutex_);
-  if (input_queue_length_ == 0) return nullptr;
-  OptimizedCompilationJob* job = input_queue_[InputQueueIndex(0)];
-  DCHECK_NOT_NULL(job);
+  if (input_queue_length_ == 0) return {nullptr, false, 0, {}};
+  // Take the job with the highest priority, oldest first among equals. A large
+  // job is passed over in favor of a small one while another large job is
+  // already running. Every task must take a job, so fall back to the head of
+  // the queue if only large jobs are left.
+  int index = -1;
+  for (int i = 0; i < input_queue_length_; i++) {
+    const QueuedJob& candidate = input_queue_[InputQueueIndex(i)];
+    if (candidate.is_large && large_jobs_in_flight_ > 0) continue;
+    if (index == -1 ||
+        candidate.priority > input_queue_[InputQueueIndex(index)].priority) {
+      index = i;
+    }
+  }
+  if (index == -1) index = 0;
+  QueuedJob entry = input_queue_[InputQueueIndex(index)];
+  DCHECK_NOT_NULL(entry.job);
+  // Close the gap left by the removed entry.
+  for (int i = index; i > 0; i--) {
+    input_queue_[InputQueueIndex(i)] = input_queue_[InputQueueIndex(i - 1)];
+  }
   input_queue_shift_ = InputQueueIndex(1);
   input_queue_length_--;
-  return job;
+  if (entry.is_large) large_jobs_in_flight_++;
+  isolate_->counters()->turbofan_optimize_queue_wait_time()->AddTimedSample(
+      base::TimeTicks::Now() - entry.queued_at);
+  return entry;
+}
+
+// static
+int OptimizingCompileDispatcher::ComputePriority(OptimizedCompilationJob* job) {
+  OptimizedCompilationInfo* info = job->compilation_info();
+  // OSR requests come from a hot loop that is running right now; they benefit
+  // the most from being compiled quickly.
+  if (info->is_osr()) return kMaxInt;
+  Handle<JSFunction> function = info->closure();
+  if (!function->has_feedback_vector()) return 0;
+  return function->feedback_vector().invocation_count();
 }
 
-void OptimizingCompileDispatcher::CompileNext(OptimizedCompilationJob* job,
+void OptimizingCompileDispatcher::CompileNext(QueuedJob entry,
                                               LocalIsolate* local_isolate) {
+  OptimizedCompilationJob* job = entry.job;
   if (!job) return;
 
   // The function may have already been optimized by OSR.  Simply continue.
   CompilationJob::Status status =
       job->ExecuteJob(local_isolate->runtime_call_stats(), local_isolate);
   USE(status);  // Prevent an unused-variable error.
+  if (entry.is_large) large_jobs_in_flight_--;
 
   {
     // The function may have already been optimized by OSR.  Simply continue.
@@ -151,7 +188,7 @@ void OptimizingCompileDispatcher::FlushOutputQueue(bool restore_function_code) {
 void OptimizingCompileDispatcher::FlushInputQueue() {
   base::MutexGuard access_input_queue_(&input_queue_mutex_);
   while (input_queue_length_ > 0) {
-    OptimizedCompilationJob* job = input_queue_[InputQueueIndex(0)];
+    OptimizedCompilationJob* job = input_queue_[InputQueueIndex(0)].job;
     DCHECK_NOT_NULL(job);
     input_queue_shift_ = InputQueueIndex(1);
     input_queue_length_--;
@@ -236,11 +273,18 @@ bool OptimizingCompileDispatcher::HasJobs() {
 void OptimizingCompileDispatcher::QueueForOptimization(
     OptimizedCompilationJob* job) {
   DCHECK(IsQueueAvailable());
+  OptimizedCompilationInfo* info = job->compilation_info();
+  bool is_large = large_function_size_ > 0 && info->has_bytecode_array() &&
+                  info->bytecode_array()->length() > large_function_size_;
+  QueuedJob entry = {job, is_large, ComputePriority(job),
+                     base::TimeTicks::Now()};
   {
     // Add job to the back of the input queue.
     base::MutexGuard access_input_queue(&input_queue_mutex_);
     DCHECK_LT(input_queue_length_, input_queue_capacity_);
-    input_queue_[InputQueueIndex(input_queue_length_)] = job;
+    isolate_->counters()->turbofan_optimize_queue_length()->AddSample(
+        input_queue_length_);
+    input_queue_[InputQueueIndex(input_queue_length_)] = entry;
     input_queue_length_++;
   }
   V8::GetCurrentPlatform()->CallOnWorkerThread(
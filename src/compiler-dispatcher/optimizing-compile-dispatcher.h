@@ -11,6 +11,7 @@
 #include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
 #include "src/base/platform/platform.h"
+#include "src/base/platform/time.h"
 #include "src/common/globals.h"
 #include "src/flags/flags.h"
 #include "src/utils/allocation.h"
@@ -31,8 +32,11 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
         input_queue_length_(0),
         input_queue_shift_(0),
         ref_count_(0),
-        recompilation_delay_(FLAG_concurrent_recompilation_delay) {
-    input_queue_ = NewArray<OptimizedCompilationJob*>(input_queue_capacity_);
+        large_jobs_in_flight_(0),
+        recompilation_delay_(FLAG_concurrent_recompilation_delay),
+        large_function_size_(
+            FLAG_concurrent_recompilation_large_function_size) {
+    input_queue_ = NewArray<QueuedJob>(input_queue_capacity_);
   }
 
   ~OptimizingCompileDispatcher();
@@ -49,6 +53,12 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
     return input_queue_length_ < input_queue_capacity_;
   }
 
+  // Number of jobs waiting to be picked up by a background task.
+  inline int InputQueueLength() {
+    base::MutexGuard access_input_queue(&input_queue_mutex_);
+    return input_queue_length_;
+  }
+
   static bool Enabled() { return FLAG_concurrent_recompilation; }
 
   // This method must be called on the main thread.
@@ -68,12 +78,24 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
 
   enum ModeFlag { COMPILE, FLUSH };
 
+  struct QueuedJob {
+    OptimizedCompilationJob* job;
+    // Whether the function's bytecode exceeds {large_function_size_}. Computed
+    // on the main thread when the job is queued.
+    bool is_large;
+    // Estimated benefit of compiling this job; higher values are taken first.
+    int priority;
+    base::TimeTicks queued_at;
+  };
+
+  static int ComputePriority(OptimizedCompilationJob* job);
+
   void FlushQueues(BlockingBehavior blocking_behavior,
                    bool restore_function_code);
   void FlushInputQueue();
   void FlushOutputQueue(bool restore_function_code);
-  void CompileNext(OptimizedCompilationJob* job, LocalIsolate* local_isolate);
-  OptimizedCompilationJob* NextInput(LocalIsolate* local_isolate);
+  void CompileNext(QueuedJob entry, LocalIsolate* local_isolate);
+  QueuedJob NextInput(LocalIsolate* local_isolate);
 
   inline int InputQueueIndex(int i) {
     int result = (i + input_queue_shift_) % input_queue_capacity_;
@@ -85,7 +107,7 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   Isolate* isolate_;
 
   // Circular queue of incoming recompilation tasks (including OSR).
-  OptimizedCompilationJob** input_queue_;
+  QueuedJob* input_queue_;
   int input_queue_capacity_;
   int input_queue_length_;
   int input_queue_shift_;
@@ -101,6 +123,11 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   base::Mutex ref_count_mutex_;
   base::ConditionVariable ref_count_zero_;
 
+  // Number of large jobs currently being executed by background tasks. While
+  // one is running, smaller queued jobs are picked first so that a single huge
+  // function does not hold up everything queued behind it.
+  std::atomic<int> large_jobs_in_flight_;
+
   // Copy of FLAG_concurrent_recompilation_delay that will be used from the
   // background thread.
   //
@@ -108,6 +135,9 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   // is not safe to access them directly.
   int recompilation_delay_;
 
+  // Copy of FLAG_concurrent_recompilation_large_function_size.
+  int large_function_size_;
+
   bool finalize_ = true;
 };
 }  // namespace internal
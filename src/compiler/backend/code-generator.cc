@@ -1188,7 +1188,7 @@ DeoptimizationExit* CodeGenerator::BuildTranslation(
   frame_state_offset++;
 
   const int update_feedback_count = entry.feedback().IsValid() ? 1 : 0;
-  const int translation_index = translations_.BeginTranslation(
+  int translation_index = translations_.BeginTranslation(
       static_cast<int>(descriptor->GetFrameCount()),
       static_cast<int>(descriptor->GetJSFrameCount()), update_feedback_count);
   if (entry.feedback().IsValid()) {
@@ -1199,6 +1199,7 @@ DeoptimizationExit* CodeGenerator::BuildTranslation(
   }
   InstructionOperandIterator iter(instr, frame_state_offset);
   BuildTranslationForFrameStateDescriptor(descriptor, &iter, state_combine);
+  translation_index = translations_.FinishTranslation(translation_index);
 
   DeoptimizationExit* const exit = zone()->New<DeoptimizationExit>(
       current_source_position_, descriptor->bailout_id(), translation_index,
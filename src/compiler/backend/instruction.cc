@@ -912,6 +912,15 @@ InstructionBlock* InstructionSequence::GetInstructionBlock(
   return instructions()[instruction_index]->block();
 }
 
+int InstructionSequence::GetLoopDepth(const InstructionBlock* block) const {
+  int depth = block->IsLoopHeader() ? 1 : 0;
+  for (RpoNumber header = block->loop_header(); header.IsValid();
+       header = InstructionBlockAt(header)->loop_header()) {
+    ++depth;
+  }
+  return depth;
+}
+
 static MachineRepresentation FilterRepresentation(MachineRepresentation rep) {
   switch (rep) {
     case MachineRepresentation::kBit:
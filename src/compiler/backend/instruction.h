@@ -1673,6 +1673,10 @@ class V8_EXPORT_PRIVATE InstructionSequence final
 
   InstructionBlock* GetInstructionBlock(int instruction_index) const;
 
+  // Returns the number of loops that contain {block}, including the loop it
+  // is the header of. This serves as a static estimate of block frequency.
+  int GetLoopDepth(const InstructionBlock* block) const;
+
   static MachineRepresentation DefaultRepresentation() {
     return MachineType::PointerRepresentation();
   }
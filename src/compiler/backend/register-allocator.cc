@@ -4229,7 +4229,12 @@ void LinearScanAllocator::AllocateBlockedReg(LiveRange* current,
       current->RegisterFromBundle(&hint_reg);
   int reg = PickRegisterThatIsAvailableLongest(current, hint_reg, use_pos);
 
-  if (use_pos[reg] < register_use->pos()) {
+  // Evicting the range that holds {reg} means reloading it at use_pos[reg].
+  // If that is in a hotter block than the next register use of {current},
+  // spilling {current} instead moves the reload out of the hot loop.
+  if (use_pos[reg] < register_use->pos() ||
+      (FLAG_turbo_frequency_aware_spilling &&
+       IsInColderBlock(register_use->pos(), use_pos[reg]))) {
     // If there is a gap position before the next register use, we can
     // spill until there. The gap position will then fit the fill move.
     if (LifetimePosition::ExistsGapPositionBetween(current->Start(),
@@ -4285,6 +4290,15 @@ void LinearScanAllocator::AllocateBlockedReg(LiveRange* current,
   SplitAndSpillIntersecting(current, spill_mode);
 }
 
+bool LinearScanAllocator::IsInColderBlock(LifetimePosition pos,
+                                          LifetimePosition other) const {
+  if (other.ToInstructionIndex() > code()->LastInstructionIndex()) {
+    return false;
+  }
+  return code()->GetLoopDepth(GetInstructionBlock(code(), pos)) <
+         code()->GetLoopDepth(GetInstructionBlock(code(), other));
+}
+
 void LinearScanAllocator::SplitAndSpillIntersecting(LiveRange* current,
                                                     SpillMode spill_mode) {
   DCHECK(current->HasRegisterAssigned());
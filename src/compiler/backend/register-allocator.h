@@ -1488,6 +1488,9 @@ class LinearScanAllocator final : public RegisterAllocator {
                                  base::Vector<LifetimePosition> free_until_pos);
   void ProcessCurrentRange(LiveRange* current, SpillMode spill_mode);
   void AllocateBlockedReg(LiveRange* range, SpillMode spill_mode);
+  // Returns whether {pos} is in a block that is nested in fewer loops than
+  // the block of {other}, i.e. is expected to execute less frequently.
+  bool IsInColderBlock(LifetimePosition pos, LifetimePosition other) const;
 
   // Spill the given life range after position pos.
   void SpillAfter(LiveRange* range, LifetimePosition pos, SpillMode spill_mode);
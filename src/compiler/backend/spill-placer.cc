@@ -42,10 +42,15 @@ void SpillPlacer::Add(TopLevelLiveRange* range) {
   // - We haven't seen any indication of performance improvements from seeking
   //   optimal spilling positions except on loop-top phi values, so spill
   //   any value that isn't a loop-top phi at the definition to avoid
-  //   increasing the code size for no benefit.
+  //   increasing the code size for no benefit. With
+  //   --turbo-frequency-aware-spilling, values defined inside of loops are
+  //   also placed optimally, since a spill at their definition executes on
+  //   every iteration even if only a rarely taken path needs it.
   if (range->GetSpillMoveInsertionLocations(data()) == nullptr ||
       range->spilled() || top_start_block->IsDeferred() ||
-      (!FLAG_stress_turbo_late_spilling && !range->is_loop_phi())) {
+      (!FLAG_stress_turbo_late_spilling && !range->is_loop_phi() &&
+       !(FLAG_turbo_frequency_aware_spilling &&
+         code->GetLoopDepth(top_start_block) > 0))) {
     range->CommitSpillMoves(data(), spill_operand);
     return;
   }
@@ -232,6 +232,8 @@ class BytecodeGraphBuilder {
   }
 
   void BuildCreateArguments(CreateArgumentsType type);
+  Node* BuildElidedArguments(CreateArgumentsType type);
+  void BuildKeyedLoad(Node* object, Node* key, FeedbackSource feedback);
   Node* BuildLoadGlobal(NameRef name, uint32_t feedback_slot_index,
                         TypeofMode typeof_mode);
 
@@ -2054,6 +2056,11 @@ void BytecodeGraphBuilder::VisitLdaKeyedProperty() {
       environment()->LookupRegister(bytecode_iterator().GetRegisterOperand(0));
   FeedbackSource feedback =
       CreateFeedbackSource(bytecode_iterator().GetIndexOperand(1));
+  BuildKeyedLoad(object, key, feedback);
+}
+
+void BytecodeGraphBuilder::BuildKeyedLoad(Node* object, Node* key,
+                                          FeedbackSource feedback) {
   const Operator* op = javascript()->LoadProperty(feedback);
 
   JSTypeHintLowering::LoweringResult lowering =
@@ -2297,6 +2304,37 @@ void BytecodeGraphBuilder::VisitCreateRestParameter() {
   BuildCreateArguments(CreateArgumentsType::kRestParameter);
 }
 
+Node* BytecodeGraphBuilder::BuildElidedArguments(CreateArgumentsType type) {
+  // The interpreter doesn't allocate the object for the loads from it, but it
+  // doesn't escape either, so escape analysis removes it again.
+  const Operator* op = javascript()->CreateArguments(type);
+  Node* object = NewNode(op, GetFunctionClosure());
+  PrepareFrameState(object, OutputFrameStateCombine::Ignore());
+  return object;
+}
+
+void BytecodeGraphBuilder::VisitLdaArgumentsLength() {
+  PrepareEagerCheckpoint();
+  CreateArgumentsType type =
+      static_cast<CreateArgumentsType>(bytecode_iterator().GetFlagOperand(0));
+  Node* object = BuildElidedArguments(type);
+  FieldAccess access = type == CreateArgumentsType::kRestParameter
+                           ? AccessBuilder::ForJSArrayLength(PACKED_ELEMENTS)
+                           : AccessBuilder::ForArgumentsLength();
+  Node* length = NewNode(simplified()->LoadField(access), object);
+  environment()->BindAccumulator(length);
+}
+
+void BytecodeGraphBuilder::VisitLdaKeyedArgument() {
+  PrepareEagerCheckpoint();
+  Node* key = environment()->LookupAccumulator();
+  Node* object = BuildElidedArguments(
+      static_cast<CreateArgumentsType>(bytecode_iterator().GetFlagOperand(0)));
+  FeedbackSource feedback =
+      CreateFeedbackSource(bytecode_iterator().GetIndexOperand(1));
+  BuildKeyedLoad(object, key, feedback);
+}
+
 void BytecodeGraphBuilder::VisitCreateRegExpLiteral() {
   StringRef constant_pattern = MakeRefForConstantForIndexOperand<String>(0);
   int const slot_id = bytecode_iterator().GetIndexOperand(1);
@@ -2998,9 +3036,9 @@ CallFeedbackRelation BytecodeGraphBuilder::ComputeCallFeedbackRelation(
   if (feedback.IsInsufficient()) return CallFeedbackRelation::kUnrelated;
   CallFeedbackContent call_feedback_content =
       feedback.AsCall().call_feedback_content();
-  return call_feedback_content == CallFeedbackContent::kTarget
-             ? CallFeedbackRelation::kTarget
-             : CallFeedbackRelation::kReceiver;
+  return call_feedback_content == CallFeedbackContent::kReceiver
+             ? CallFeedbackRelation::kReceiver
+             : CallFeedbackRelation::kTarget;
 }
 
 void BytecodeGraphBuilder::VisitBitwiseNot() {
@@ -3725,11 +3763,17 @@ void BytecodeGraphBuilder::VisitSuspendGenerator() {
   const BytecodeLivenessState* liveness = bytecode_analysis().GetInLivenessFor(
       bytecode_iterator().current_offset());
 
-  // Maybe overallocate the value list since we don't know how many registers
-  // are live.
-  // TODO(leszeks): We could get this count from liveness rather than the
-  // register list.
-  int value_input_count = 3 + parameter_count_without_receiver + register_count;
+  // Registers after the last live one are not stored, so don't allocate
+  // value inputs for them.
+  int stored_register_count = register_count;
+  if (liveness != nullptr) {
+    while (stored_register_count > 0 &&
+           !liveness->RegisterIsLive(stored_register_count - 1)) {
+      stored_register_count--;
+    }
+  }
+  int value_input_count =
+      3 + parameter_count_without_receiver + stored_register_count;
 
   Node** value_inputs = local_zone()->NewArray<Node*>(value_input_count);
   value_inputs[0] = generator;
@@ -3744,7 +3788,7 @@ void BytecodeGraphBuilder::VisitSuspendGenerator() {
   }
 
   // Store the registers.
-  for (int i = 0; i < register_count; ++i) {
+  for (int i = 0; i < stored_register_count; ++i) {
     if (liveness == nullptr || liveness->RegisterIsLive(i)) {
       int index_in_parameters_and_registers =
           parameter_count_without_receiver + i;
@@ -3762,10 +3806,14 @@ void BytecodeGraphBuilder::VisitSuspendGenerator() {
   MakeNode(javascript()->GeneratorStore(count_written), 3 + count_written,
            value_inputs, false);
 
-  // TODO(leszeks): This over-approximates the liveness at exit, only the
-  // accumulator should be live by this point.
-  BuildReturn(bytecode_analysis().GetInLivenessFor(
-      bytecode_iterator().current_offset()));
+  // The live registers were stored into the generator above, so like for a
+  // Return only the accumulator is live at the exit. This avoids renaming
+  // them at the exits of enclosing loops.
+  BytecodeLivenessState* exit_liveness =
+      local_zone()->New<BytecodeLivenessState>(environment()->register_count(),
+                                               local_zone());
+  exit_liveness->MarkAccumulatorLive();
+  BuildReturn(exit_liveness);
 }
 
 void BytecodeGraphBuilder::BuildSwitchOnGeneratorState(
@@ -96,6 +96,8 @@ class EffectControlLinearizer {
   Node* LowerCheckedUint32Div(Node* node, Node* frame_state);
   Node* LowerCheckedUint32Mod(Node* node, Node* frame_state);
   Node* LowerCheckedInt32Mul(Node* node, Node* frame_state);
+  Node* LowerCheckedInt64Add(Node* node, Node* frame_state);
+  Node* LowerCheckedInt64Sub(Node* node, Node* frame_state);
   Node* LowerCheckedInt32ToTaggedSigned(Node* node, Node* frame_state);
   Node* LowerCheckedInt64ToInt32(Node* node, Node* frame_state);
   Node* LowerCheckedInt64ToTaggedSigned(Node* node, Node* frame_state);
@@ -114,6 +116,7 @@ class EffectControlLinearizer {
   Node* LowerCheckedTaggedToFloat64(Node* node, Node* frame_state);
   Node* LowerCheckedTaggedToTaggedSigned(Node* node, Node* frame_state);
   Node* LowerCheckedTaggedToTaggedPointer(Node* node, Node* frame_state);
+  Node* LowerCheckedBigIntToBigInt64(Node* node, Node* frame_state);
   Node* LowerChangeInt64ToBigInt(Node* node);
   Node* LowerChangeUint64ToBigInt(Node* node);
   Node* LowerTruncateBigIntToWord64(Node* node);
@@ -197,6 +200,8 @@ class EffectControlLinearizer {
   Node* AdaptFastCallTypedArrayArgument(Node* node,
                                         ElementsKind expected_elements_kind,
                                         GraphAssemblerLabel<0>* bailout);
+  Node* AdaptFastCallOneByteStringArgument(Node* node,
+                                           GraphAssemblerLabel<0>* bailout);
   Node* AdaptFastCallArgument(Node* node, CTypeInfo arg_type,
                               GraphAssemblerLabel<0>* if_error);
 
@@ -225,6 +230,7 @@ class EffectControlLinearizer {
   void LowerStoreSignedSmallElement(Node* node);
   Node* LowerFindOrderedHashMapEntry(Node* node);
   Node* LowerFindOrderedHashMapEntryForInt32Key(Node* node);
+  Node* LowerFindOrderedHashMapEntryForNameKey(Node* node);
   void LowerTransitionAndStoreElement(Node* node);
   void LowerTransitionAndStoreNumberElement(Node* node);
   void LowerTransitionAndStoreNonNumberElement(Node* node);
@@ -1023,6 +1029,12 @@ bool EffectControlLinearizer::TryWireInStateEffect(Node* node,
     case IrOpcode::kCheckedInt32Mul:
       result = LowerCheckedInt32Mul(node, frame_state);
       break;
+    case IrOpcode::kCheckedInt64Add:
+      result = LowerCheckedInt64Add(node, frame_state);
+      break;
+    case IrOpcode::kCheckedInt64Sub:
+      result = LowerCheckedInt64Sub(node, frame_state);
+      break;
     case IrOpcode::kCheckedInt32ToTaggedSigned:
       result = LowerCheckedInt32ToTaggedSigned(node, frame_state);
       break;
@@ -1090,6 +1102,9 @@ bool EffectControlLinearizer::TryWireInStateEffect(Node* node,
     case IrOpcode::kTruncateBigIntToWord64:
       result = LowerTruncateBigIntToWord64(node);
       break;
+    case IrOpcode::kCheckedBigIntToBigInt64:
+      result = LowerCheckedBigIntToBigInt64(node, frame_state);
+      break;
     case IrOpcode::kTruncateTaggedToWord32:
       result = LowerTruncateTaggedToWord32(node);
       break;
@@ -1336,6 +1351,9 @@ bool EffectControlLinearizer::TryWireInStateEffect(Node* node,
     case IrOpcode::kFindOrderedHashMapEntryForInt32Key:
       result = LowerFindOrderedHashMapEntryForInt32Key(node);
       break;
+    case IrOpcode::kFindOrderedHashMapEntryForNameKey:
+      result = LowerFindOrderedHashMapEntryForNameKey(node);
+      break;
     case IrOpcode::kTransitionAndStoreNumberElement:
       LowerTransitionAndStoreNumberElement(node);
       break;
@@ -2163,6 +2181,32 @@ Node* EffectControlLinearizer::LowerCheckedInt32Sub(Node* node,
   return __ Projection(0, value);
 }
 
+Node* EffectControlLinearizer::LowerCheckedInt64Add(Node* node,
+                                                    Node* frame_state) {
+  DCHECK(machine()->Is64());
+  Node* lhs = node->InputAt(0);
+  Node* rhs = node->InputAt(1);
+
+  Node* value = __ Int64AddWithOverflow(lhs, rhs);
+  Node* check = __ Projection(1, value);
+  __ DeoptimizeIf(DeoptimizeReason::kOverflow, FeedbackSource(), check,
+                  frame_state);
+  return __ Projection(0, value);
+}
+
+Node* EffectControlLinearizer::LowerCheckedInt64Sub(Node* node,
+                                                    Node* frame_state) {
+  DCHECK(machine()->Is64());
+  Node* lhs = node->InputAt(0);
+  Node* rhs = node->InputAt(1);
+
+  Node* value = __ Int64SubWithOverflow(lhs, rhs);
+  Node* check = __ Projection(1, value);
+  __ DeoptimizeIf(DeoptimizeReason::kOverflow, FeedbackSource(), check,
+                  frame_state);
+  return __ Projection(0, value);
+}
+
 Node* EffectControlLinearizer::LowerCheckedInt32Div(Node* node,
                                                     Node* frame_state) {
   Node* lhs = node->InputAt(0);
@@ -3023,6 +3067,51 @@ Node* EffectControlLinearizer::LowerTruncateBigIntToWord64(Node* node) {
   return done.PhiAt(0);
 }
 
+Node* EffectControlLinearizer::LowerCheckedBigIntToBigInt64(Node* node,
+                                                            Node* frame_state) {
+  DCHECK(machine()->Is64());
+
+  auto done = __ MakeLabel(MachineRepresentation::kWord64);
+  auto if_not_zero = __ MakeLabel();
+
+  Node* value = node->InputAt(0);
+  const CheckParameters& params = CheckParametersOf(node->op());
+
+  Node* bitfield = __ LoadField(AccessBuilder::ForBigIntBitfield(), value);
+  __ GotoIfNot(__ Word32Equal(bitfield, __ Int32Constant(0)), &if_not_zero);
+  __ Goto(&done, __ Int64Constant(0));
+
+  __ Bind(&if_not_zero);
+  {
+    // Only BigInts with a single digit can fit into a signed 64-bit integer.
+    Node* length =
+        __ Word32And(bitfield, __ Int32Constant(BigInt::LengthBits::kMask));
+    __ DeoptimizeIfNot(
+        DeoptimizeReason::kNotABigInt64, params.feedback(),
+        __ Word32Equal(length, __ Int32Constant(BigInt::LengthBits::encode(1))),
+        frame_state);
+
+    // The magnitude of a negative value may be one larger than the maximum.
+    // {sign_mask} is all ones for negative values and zero otherwise.
+    Node* lsd =
+        __ LoadField(AccessBuilder::ForBigIntLeastSignificantDigit64(), value);
+    Node* sign = __ ChangeUint32ToUint64(
+        __ Word32And(bitfield, __ Int32Constant(BigInt::SignBits::kMask)));
+    Node* sign_mask = __ Int64Sub(__ Int64Constant(0), sign);
+    Node* max_magnitude = __ Int64Sub(
+        __ Int64Constant(std::numeric_limits<int64_t>::max()), sign_mask);
+    __ DeoptimizeIfNot(DeoptimizeReason::kNotABigInt64, params.feedback(),
+                       __ Uint64LessThanOrEqual(lsd, max_magnitude),
+                       frame_state);
+
+    // (lsd XOR sign_mask) - sign_mask negates {lsd} for negative values.
+    __ Goto(&done, __ Int64Sub(__ Word64Xor(lsd, sign_mask), sign_mask));
+  }
+
+  __ Bind(&done);
+  return done.PhiAt(0);
+}
+
 Node* EffectControlLinearizer::LowerTruncateTaggedToWord32(Node* node) {
   Node* value = node->InputAt(0);
 
@@ -4993,6 +5082,8 @@ MachineType MachineTypeFor(CTypeInfo::Type type) {
     case CTypeInfo::Type::kV8Value:
     case CTypeInfo::Type::kApiObject:
       return MachineType::AnyTagged();
+    case CTypeInfo::Type::kSeqOneByteString:
+      return MachineType::Pointer();
   }
 }
 }  // namespace
@@ -5084,6 +5175,39 @@ Node* EffectControlLinearizer::AdaptFastCallTypedArrayArgument(
   return stack_slot;
 }
 
+Node* EffectControlLinearizer::AdaptFastCallOneByteStringArgument(
+    Node* node, GraphAssemblerLabel<0>* bailout) {
+  // Check that the value is a sequential one-byte string; all other strings
+  // would have to be flattened or converted first.
+  Node* value_map = __ LoadField(AccessBuilder::ForMap(), node);
+  Node* value_instance_type =
+      __ LoadField(AccessBuilder::ForMapInstanceType(), value_map);
+  Node* value_is_seq_one_byte_string = __ Word32Equal(
+      __ Word32And(value_instance_type,
+                   __ Int32Constant(kIsNotStringMask |
+                                    kStringRepresentationMask |
+                                    kStringEncodingMask)),
+      __ Int32Constant(kStringTag | kSeqStringTag | kOneByteStringTag));
+  __ GotoIfNot(value_is_seq_one_byte_string, bailout);
+
+  // Store the characters and length to a struct FastOneByteString. The fast
+  // call does not allocate, so the characters do not move.
+  Node* data_ptr = __ IntPtrAdd(
+      __ BitcastTaggedToWord(node),
+      __ IntPtrConstant(SeqOneByteString::kHeaderSize - kHeapObjectTag));
+  Node* length = __ LoadField(AccessBuilder::ForStringLength(), node);
+
+  constexpr int kAlign = alignof(FastOneByteString);
+  constexpr int kSize = sizeof(FastOneByteString);
+  Node* stack_slot = __ StackSlot(kSize, kAlign);
+  __ Store(StoreRepresentation(MachineType::PointerRepresentation(),
+                               kNoWriteBarrier),
+           stack_slot, offsetof(FastOneByteString, data), data_ptr);
+  __ Store(StoreRepresentation(MachineRepresentation::kWord32, kNoWriteBarrier),
+           stack_slot, offsetof(FastOneByteString, length), length);
+  return stack_slot;
+}
+
 Node* EffectControlLinearizer::AdaptFastCallArgument(
     Node* node, CTypeInfo arg_type, GraphAssemblerLabel<0>* if_error) {
   int kAlign = alignof(uintptr_t);
@@ -5102,6 +5226,13 @@ Node* EffectControlLinearizer::AdaptFastCallArgument(
         case CTypeInfo::Type::kFloat32: {
           return __ TruncateFloat64ToFloat32(node);
         }
+        case CTypeInfo::Type::kSeqOneByteString: {
+          // Check that the value is a HeapObject.
+          Node* value_is_smi = ObjectIsSmi(node);
+          __ GotoIf(value_is_smi, if_error);
+
+          return AdaptFastCallOneByteStringArgument(node, if_error);
+        }
         default: {
           return node;
         }
@@ -5168,6 +5299,16 @@ EffectControlLinearizer::AdaptOverloadedFastCallArgument(
     ExternalReference::Type ref_type = ExternalReference::FAST_C_CALL;
 
     switch (arg_type.GetSequenceType()) {
+      case CTypeInfo::SequenceType::kScalar: {
+        CHECK_EQ(arg_type.GetType(), CTypeInfo::Type::kSeqOneByteString);
+
+        Node* stack_slot = AdaptFastCallOneByteStringArgument(node, &next);
+        Node* target_address = __ ExternalConstant(ExternalReference::Create(
+            c_functions[func_index].address, ref_type));
+        __ Goto(&merge, target_address, stack_slot);
+        break;
+      }
+
       case CTypeInfo::SequenceType::kIsSequence: {
         CHECK_EQ(arg_type.GetType(), CTypeInfo::Type::kVoid);
 
@@ -5197,9 +5338,7 @@ EffectControlLinearizer::AdaptOverloadedFastCallArgument(
         // Check that the value is a TypedArray with a type that matches the
         // type declared in the c-function.
         Node* stack_slot = AdaptFastCallTypedArrayArgument(
-            node,
-            fast_api_call::GetTypedArrayElementsKind(
-                overloads_resolution_result.element_type),
+            node, fast_api_call::GetTypedArrayElementsKind(arg_type.GetType()),
             &next);
         Node* target_address = __ ExternalConstant(ExternalReference::Create(
             c_functions[func_index].address, ref_type));
@@ -5463,6 +5602,7 @@ Node* EffectControlLinearizer::LowerFastApiCall(Node* node) {
           c_call_result, CheckForMinusZeroMode::kCheckForMinusZero);
       break;
     case CTypeInfo::Type::kV8Value:
+    case CTypeInfo::Type::kSeqOneByteString:
     case CTypeInfo::Type::kApiObject:
       UNREACHABLE();
   }
@@ -6730,6 +6870,99 @@ Node* EffectControlLinearizer::LowerFindOrderedHashMapEntryForInt32Key(
   return done.PhiAt(0);
 }
 
+Node* EffectControlLinearizer::LowerFindOrderedHashMapEntryForNameKey(
+    Node* node) {
+  Node* table = NodeProperties::GetValueInput(node, 0);
+  Node* key = NodeProperties::GetValueInput(node, 1);
+
+  // Unique names always have their hash computed.
+  Node* hash = ChangeUint32ToUintPtr(
+      __ Word32Shr(__ LoadField(AccessBuilder::ForNameRawHashField(), key),
+                   __ Int32Constant(Name::kHashShift)));
+
+  Node* number_of_buckets = ChangeSmiToIntPtr(__ LoadField(
+      AccessBuilder::ForOrderedHashMapOrSetNumberOfBuckets(), table));
+  hash = __ WordAnd(hash, __ IntSub(number_of_buckets, __ IntPtrConstant(1)));
+  Node* first_entry = ChangeSmiToIntPtr(__ Load(
+      MachineType::TaggedSigned(), table,
+      __ IntAdd(__ WordShl(hash, __ IntPtrConstant(kTaggedSizeLog2)),
+                __ IntPtrConstant(OrderedHashMap::HashTableStartOffset() -
+                                  kHeapObjectTag))));
+
+  auto loop = __ MakeLoopLabel(MachineType::PointerRepresentation());
+  auto done = __ MakeLabel(MachineType::PointerRepresentation());
+  auto if_slow = __ MakeDeferredLabel();
+  __ Goto(&loop, first_entry);
+  __ Bind(&loop);
+  {
+    Node* entry = loop.PhiAt(0);
+    Node* check =
+        __ IntPtrEqual(entry, __ IntPtrConstant(OrderedHashMap::kNotFound));
+    __ GotoIf(check, &done, entry);
+    entry = __ IntAdd(
+        __ IntMul(entry, __ IntPtrConstant(OrderedHashMap::kEntrySize)),
+        number_of_buckets);
+
+    Node* candidate_key = __ Load(
+        MachineType::AnyTagged(), table,
+        __ IntAdd(__ WordShl(entry, __ IntPtrConstant(kTaggedSizeLog2)),
+                  __ IntPtrConstant(OrderedHashMap::HashTableStartOffset() -
+                                    kHeapObjectTag)));
+
+    auto if_match = __ MakeLabel();
+    auto if_notmatch = __ MakeLabel();
+    __ GotoIf(__ TaggedEqual(candidate_key, key), &if_match);
+    __ GotoIf(ObjectIsSmi(candidate_key), &if_notmatch);
+
+    // A different unique name or any non-string never matches {key}, but a
+    // string that is not internalized might have the same contents.
+    Node* candidate_instance_type = __ LoadField(
+        AccessBuilder::ForMapInstanceType(),
+        __ LoadField(AccessBuilder::ForMap(), candidate_key));
+    __ GotoIfNot(__ Uint32LessThan(candidate_instance_type,
+                                   __ Uint32Constant(FIRST_NONSTRING_TYPE)),
+                 &if_notmatch);
+    Node* candidate_is_internalized = __ Word32Equal(
+        __ Word32And(candidate_instance_type,
+                     __ Int32Constant(kIsNotInternalizedMask)),
+        __ Int32Constant(kInternalizedTag));
+    __ GotoIf(candidate_is_internalized, &if_notmatch);
+    __ Goto(&if_slow);
+
+    __ Bind(&if_match);
+    __ Goto(&done, entry);
+
+    __ Bind(&if_notmatch);
+    {
+      Node* next_entry = ChangeSmiToIntPtr(__ Load(
+          MachineType::TaggedSigned(), table,
+          __ IntAdd(
+              __ WordShl(entry, __ IntPtrConstant(kTaggedSizeLog2)),
+              __ IntPtrConstant(OrderedHashMap::HashTableStartOffset() +
+                                OrderedHashMap::kChainOffset * kTaggedSize -
+                                kHeapObjectTag))));
+      __ Goto(&loop, next_entry);
+    }
+  }
+
+  __ Bind(&if_slow);
+  {
+    Callable const callable =
+        Builtins::CallableFor(isolate(), Builtin::kFindOrderedHashMapEntry);
+    Operator::Properties const properties = node->op()->properties();
+    CallDescriptor::Flags const flags = CallDescriptor::kNoFlags;
+    auto call_descriptor = Linkage::GetStubCallDescriptor(
+        graph()->zone(), callable.descriptor(),
+        callable.descriptor().GetStackParameterCount(), flags, properties);
+    Node* result = __ Call(call_descriptor, __ HeapConstant(callable.code()),
+                           table, key, __ NoContextConstant());
+    __ Goto(&done, ChangeSmiToIntPtr(result));
+  }
+
+  __ Bind(&done);
+  return done.PhiAt(0);
+}
+
 Node* EffectControlLinearizer::LowerDateNow(Node* node) {
   Operator::Properties properties = Operator::kNoDeopt | Operator::kNoThrow;
   Runtime::FunctionId id = Runtime::kDateCurrentTime;
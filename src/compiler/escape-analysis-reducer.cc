@@ -32,6 +32,7 @@ EscapeAnalysisReducer::EscapeAnalysisReducer(
       object_id_cache_(zone),
       node_cache_(jsgraph->graph(), zone),
       arguments_elements_(zone),
+      eliminated_allocations_(zone),
       zone_(zone) {}
 
 Reduction EscapeAnalysisReducer::ReplaceNode(Node* original,
@@ -94,6 +95,9 @@ Reduction EscapeAnalysisReducer::Reduce(Node* node) {
       const VirtualObject* vobject = analysis_result().GetVirtualObject(node);
       if (vobject && !vobject->HasEscaped()) {
         RelaxEffectsAndControls(node);
+        if (node->opcode() == IrOpcode::kAllocate) {
+          eliminated_allocations_.insert(node);
+        }
       }
       return NoChange();
     }
@@ -96,6 +96,12 @@ class V8_EXPORT_PRIVATE EscapeAnalysisReducer final
   // after this reducer has been applied.
   void VerifyReplacement() const;
 
+  // The number of allocations that were removed from the effect chain because
+  // their objects do not escape.
+  size_t eliminated_allocations() const {
+    return eliminated_allocations_.size();
+  }
+
  private:
   void ReduceFrameStateInputs(Node* node);
   Node* ReduceDeoptState(Node* node, Node* effect, Deduplicator* deduplicator);
@@ -112,6 +118,7 @@ class V8_EXPORT_PRIVATE EscapeAnalysisReducer final
   ZoneVector<Node*> object_id_cache_;
   NodeHashCache node_cache_;
   ZoneSet<Node*> arguments_elements_;
+  ZoneSet<Node*> eliminated_allocations_;
   Zone* const zone_;
 };
 
@@ -224,6 +224,28 @@ class EscapeAnalysisTracker : public ZoneObject {
       return tracker_->ResolveReplacement(
           NodeProperties::GetContextInput(current_node()));
     }
+    // Returns the value that all value inputs of the current Phi agree on,
+    // ignoring inputs that refer back to the Phi itself (as on the back edges
+    // of loops that do not reassign the value), or nullptr if there is none.
+    Node* RedundantPhiValue() {
+      DCHECK_EQ(IrOpcode::kPhi, current_node()->opcode());
+      Node* value = nullptr;
+      int value_input_count = current_node()->op()->ValueInputCount();
+      for (int i = 0; i < value_input_count; ++i) {
+        Node* input = ValueInput(i);
+        if (input == current_node()) continue;
+        if (value != nullptr && value != input) return nullptr;
+        value = input;
+      }
+      if (value == nullptr) return nullptr;
+      // The replacement must not widen the type of the Phi, since we cannot
+      // guard it with a TypeGuard like effectful nodes.
+      if (!NodeProperties::GetType(value).Is(
+              NodeProperties::GetType(current_node()))) {
+        return nullptr;
+      }
+      return value;
+    }
 
     void SetReplacement(Node* replacement) {
       replacement_ = replacement;
@@ -698,6 +720,23 @@ void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
       current->SetVirtualObject(current->ValueInput(0));
       break;
     }
+    case IrOpcode::kPhi: {
+      // A redundant Phi on a virtual object, e.g. a loop Phi for an iterator
+      // result or closure that is not reassigned in the loop, is replaced by
+      // the object itself instead of letting the object escape.
+      Node* value = current->RedundantPhiValue();
+      const VirtualObject* vobject =
+          value ? current->GetVirtualObject(value) : nullptr;
+      if (vobject && !vobject->HasEscaped()) {
+        current->SetReplacement(value);
+        break;
+      }
+      int value_input_count = op->ValueInputCount();
+      for (int i = 0; i < value_input_count; ++i) {
+        current->SetEscaped(current->ValueInput(i));
+      }
+      break;
+    }
     case IrOpcode::kReferenceEqual: {
       Node* left = current->ValueInput(0);
       Node* right = current->ValueInput(1);
@@ -26,6 +26,7 @@ ElementsKind GetTypedArrayElementsKind(CTypeInfo::Type type) {
     case CTypeInfo::Type::kVoid:
     case CTypeInfo::Type::kBool:
     case CTypeInfo::Type::kV8Value:
+    case CTypeInfo::Type::kSeqOneByteString:
     case CTypeInfo::Type::kApiObject:
       UNREACHABLE();
   }
@@ -38,43 +39,37 @@ OverloadsResolutionResult ResolveOverloads(
 
   static constexpr int kReceiver = 1;
 
-  // Only the case of the overload resolution of two functions, one with a
-  // JSArray param and the other with a typed array param is currently
-  // supported.
+  // Only the overload resolution of two functions that differ in a single
+  // argument is supported, see CTypeInfo::IsDistinguishable().
   DCHECK_EQ(candidates.size(), 2);
+  const CFunctionInfo* first = candidates[0].signature;
+  const CFunctionInfo* second = candidates[1].signature;
 
+  int distinguishable_arg_index = -1;
+  CTypeInfo::Type element_type = CTypeInfo::Type::kVoid;
   for (unsigned int arg_index = 0; arg_index < arg_count - kReceiver;
        arg_index++) {
-    int index_of_func_with_js_array_arg = -1;
-    int index_of_func_with_typed_array_arg = -1;
-    CTypeInfo::Type element_type = CTypeInfo::Type::kVoid;
+    const CTypeInfo& first_info = first->ArgumentInfo(arg_index + kReceiver);
+    const CTypeInfo& second_info = second->ArgumentInfo(arg_index + kReceiver);
+    if (first_info.GetId() == second_info.GetId()) continue;
 
-    for (size_t i = 0; i < candidates.size(); i++) {
-      const CTypeInfo& type_info =
-          candidates[i].signature->ArgumentInfo(arg_index + kReceiver);
-      CTypeInfo::SequenceType sequence_type = type_info.GetSequenceType();
-
-      if (sequence_type == CTypeInfo::SequenceType::kIsSequence) {
-        DCHECK_LT(index_of_func_with_js_array_arg, 0);
-        index_of_func_with_js_array_arg = static_cast<int>(i);
-      } else if (sequence_type == CTypeInfo::SequenceType::kIsTypedArray) {
-        DCHECK_LT(index_of_func_with_typed_array_arg, 0);
-        index_of_func_with_typed_array_arg = static_cast<int>(i);
-        element_type = type_info.GetType();
-      } else {
-        DCHECK_LT(index_of_func_with_js_array_arg, 0);
-        DCHECK_LT(index_of_func_with_typed_array_arg, 0);
-      }
+    if (distinguishable_arg_index >= 0 || !first_info.IsDistinguishable() ||
+        !second_info.IsDistinguishable() ||
+        first_info.GetSequenceType() == second_info.GetSequenceType()) {
+      return OverloadsResolutionResult::Invalid();
     }
-
-    if (index_of_func_with_js_array_arg >= 0 &&
-        index_of_func_with_typed_array_arg >= 0) {
-      return {static_cast<int>(arg_index), element_type};
+    distinguishable_arg_index = static_cast<int>(arg_index);
+    for (const CTypeInfo* info : {&first_info, &second_info}) {
+      if (info->GetSequenceType() == CTypeInfo::SequenceType::kIsTypedArray) {
+        element_type = info->GetType();
+      }
     }
   }
 
-  // No overload found with a JSArray and a typed array as i-th argument.
-  return OverloadsResolutionResult::Invalid();
+  if (distinguishable_arg_index < 0) {
+    return OverloadsResolutionResult::Invalid();
+  }
+  return {distinguishable_arg_index, element_type};
 }
 
 }  // namespace fast_api_call
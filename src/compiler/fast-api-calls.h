@@ -21,18 +21,17 @@ struct OverloadsResolutionResult {
   OverloadsResolutionResult(int distinguishable_arg_index_,
                             CTypeInfo::Type element_type_)
       : distinguishable_arg_index(distinguishable_arg_index_),
-        element_type(element_type_) {
-    DCHECK(distinguishable_arg_index_ < 0 ||
-           element_type_ != CTypeInfo::Type::kVoid);
-  }
+        element_type(element_type_) {}
 
   bool is_valid() const { return distinguishable_arg_index >= 0; }
 
-  // The index of the distinguishable overload argument. Only the case where the
-  // types of this argument is a JSArray vs a TypedArray is supported.
+  // The index of the distinguishable overload argument. Its type has to be a
+  // JSArray, a TypedArray or a one-byte string, and differ between the
+  // overloads.
   int distinguishable_arg_index;
 
-  // The element type in the typed array argument.
+  // The element type in the typed array argument, or kVoid if no overload
+  // takes a typed array.
   CTypeInfo::Type element_type;
 };
 
@@ -112,8 +112,10 @@ class Reducer;
   V(Int32Mod)                                \
   V(Int32MulWithOverflow)                    \
   V(Int32SubWithOverflow)                    \
+  V(Int64AddWithOverflow)                    \
   V(Int64Div)                                \
   V(Int64Mod)                                \
+  V(Int64SubWithOverflow)                    \
   V(Uint32Div)                               \
   V(Uint32Mod)                               \
   V(Uint64Div)                               \
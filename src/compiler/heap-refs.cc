@@ -619,12 +619,20 @@ class BigIntData : public HeapObjectData {
   BigIntData(JSHeapBroker* broker, ObjectData** storage, Handle<BigInt> object,
              ObjectDataKind kind)
       : HeapObjectData(broker, storage, object, kind),
-        as_uint64_(object->AsUint64(nullptr)) {}
+        as_uint64_(object->AsUint64(nullptr)) {
+    as_int64_ = object->AsInt64(&as_int64_lossless_);
+  }
 
   uint64_t AsUint64() const { return as_uint64_; }
+  int64_t AsInt64(bool* lossless) const {
+    if (lossless != nullptr) *lossless = as_int64_lossless_;
+    return as_int64_;
+  }
 
  private:
   const uint64_t as_uint64_;
+  int64_t as_int64_;
+  bool as_int64_lossless_;
 };
 
 struct PropertyDescriptor {
@@ -1949,6 +1957,13 @@ HEAP_ACCESSOR_C(AllocationSite, AllocationType, GetAllocationType)
 
 BIMODAL_ACCESSOR_C(BigInt, uint64_t, AsUint64)
 
+int64_t BigIntRef::AsInt64(bool* lossless) const {
+  if (data_->should_access_heap()) {
+    return object()->AsInt64(lossless);
+  }
+  return ObjectRef::data()->AsBigInt()->AsInt64(lossless);
+}
+
 int BytecodeArrayRef::register_count() const {
   return object()->register_count();
 }
@@ -1977,6 +1977,7 @@ Callable GetCallableForArrayIndexOfIncludes(ArrayIndexOfIncludesVariant variant,
     switch (elements_kind) {
       case PACKED_SMI_ELEMENTS:
       case HOLEY_SMI_ELEMENTS:
+        return Builtins::CallableFor(isolate, Builtin::kArrayIndexOfSmi);
       case PACKED_ELEMENTS:
       case HOLEY_ELEMENTS:
         return Builtins::CallableFor(isolate,
@@ -1994,6 +1995,7 @@ Callable GetCallableForArrayIndexOfIncludes(ArrayIndexOfIncludesVariant variant,
     switch (elements_kind) {
       case PACKED_SMI_ELEMENTS:
       case HOLEY_SMI_ELEMENTS:
+        return Builtins::CallableFor(isolate, Builtin::kArrayIncludesSmi);
       case PACKED_ELEMENTS:
       case HOLEY_ELEMENTS:
         return Builtins::CallableFor(isolate,
@@ -3450,8 +3452,10 @@ bool CanInlineJSToWasmCall(const wasm::FunctionSig* wasm_signature) {
 #if defined(V8_TARGET_ARCH_32_BIT)
     if (type == wasm::kWasmI64) return false;
 #endif
+    // Externref values are passed between JS and wasm without conversion.
     if (type != wasm::kWasmI32 && type != wasm::kWasmI64 &&
-        type != wasm::kWasmF32 && type != wasm::kWasmF64) {
+        type != wasm::kWasmF32 && type != wasm::kWasmF64 &&
+        type != wasm::kWasmExternRef) {
       return false;
     }
   }
@@ -4434,7 +4438,13 @@ Reduction JSCallReducer::ReduceJSCall(Node* node) {
     feedback_target = native_context().function_prototype_apply();
   }
 
-  if (feedback_target.has_value() && feedback_target->map().is_callable()) {
+  if (feedback_target.has_value() && feedback_target->IsJSBoundFunction() &&
+      feedback.AsCall().call_feedback_content() ==
+          CallFeedbackContent::kBoundTargetFunction) {
+    return ReduceJSCallWithBoundFunctionFeedback(
+        node, feedback_target->AsJSBoundFunction());
+  } else if (feedback_target.has_value() &&
+             feedback_target->map().is_callable()) {
     Node* target_function = jsgraph()->Constant(*feedback_target);
 
     // Check that the {target} is still the {target_function}.
@@ -4471,6 +4481,96 @@ Reduction JSCallReducer::ReduceJSCall(Node* node) {
   return NoChange();
 }
 
+// The call site has seen several bound functions with the same shape as
+// {function}. Check that {target} has that shape too, and call the common
+// [[BoundTargetFunction]] directly with the [[BoundThis]] and
+// [[BoundArguments]] loaded from {target}, so that it can be inlined.
+Reduction JSCallReducer::ReduceJSCallWithBoundFunctionFeedback(
+    Node* node, const JSBoundFunctionRef& function) {
+  JSCallNode n(node);
+  CallParameters const& p = n.Parameters();
+  Node* target = n.target();
+  Effect effect = n.effect();
+  Control control = n.control();
+  int arity = p.arity_without_implicit_args();
+
+  FixedArrayRef bound_arguments = function.bound_arguments();
+  const int bound_arguments_length = bound_arguments.length();
+
+  // Check that {target} is a bound function with the same map and
+  // [[BoundTargetFunction]] as {function}.
+  target = effect = graph()->NewNode(simplified()->CheckHeapObject(), target,
+                                     effect, control);
+  effect = graph()->NewNode(
+      simplified()->CheckMaps(CheckMapsFlag::kNone,
+                              ZoneHandleSet<Map>(function.map().object())),
+      target, effect, control);
+  Node* target_function = effect = graph()->NewNode(
+      simplified()->LoadField(
+          AccessBuilder::ForJSBoundFunctionBoundTargetFunction()),
+      target, effect, control);
+  Node* check = graph()->NewNode(
+      simplified()->ReferenceEqual(), target_function,
+      jsgraph()->Constant(function.bound_target_function()));
+  effect = graph()->NewNode(
+      simplified()->CheckIf(DeoptimizeReason::kWrongCallTarget), check, effect,
+      control);
+
+  // Check the number of [[BoundArguments]] and load them.
+  Node* arguments = effect = graph()->NewNode(
+      simplified()->LoadField(
+          AccessBuilder::ForJSBoundFunctionBoundArguments()),
+      target, effect, control);
+  static constexpr int kInlineSize = 16;  // Arbitrary.
+  base::SmallVector<Node*, kInlineSize> args;
+  if (bound_arguments_length == 0) {
+    check = graph()->NewNode(simplified()->ReferenceEqual(), arguments,
+                             jsgraph()->EmptyFixedArrayConstant());
+  } else {
+    Node* length = effect = graph()->NewNode(
+        simplified()->LoadField(AccessBuilder::ForFixedArrayLength()),
+        arguments, effect, control);
+    check = graph()->NewNode(simplified()->NumberEqual(), length,
+                             jsgraph()->Constant(bound_arguments_length));
+  }
+  effect = graph()->NewNode(
+      simplified()->CheckIf(DeoptimizeReason::kWrongCallTarget), check, effect,
+      control);
+  for (int i = 0; i < bound_arguments_length; ++i) {
+    Node* value = effect = graph()->NewNode(
+        simplified()->LoadElement(AccessBuilder::ForFixedArrayElement()),
+        arguments, jsgraph()->Constant(i), effect, control);
+    args.emplace_back(value);
+  }
+  Node* bound_this = effect = graph()->NewNode(
+      simplified()->LoadField(AccessBuilder::ForJSBoundFunctionBoundThis()),
+      target, effect, control);
+
+  // Patch {node} to use [[BoundTargetFunction]] and [[BoundThis]].
+  NodeProperties::ReplaceValueInput(
+      node, jsgraph()->Constant(function.bound_target_function()),
+      JSCallNode::TargetIndex());
+  NodeProperties::ReplaceValueInput(node, bound_this,
+                                    JSCallNode::ReceiverIndex());
+  NodeProperties::ReplaceEffectInput(node, effect);
+
+  // Insert the [[BoundArguments]] for {node}.
+  for (int i = 0; i < bound_arguments_length; ++i) {
+    node->InsertInput(graph()->zone(), i + 2, args[i]);
+    arity++;
+  }
+
+  NodeProperties::ChangeOp(
+      node,
+      javascript()->Call(JSCallNode::ArityForArgc(arity), p.frequency(),
+                         p.feedback(), ConvertReceiverMode::kAny,
+                         p.speculation_mode(),
+                         CallFeedbackRelation::kUnrelated));
+
+  // Try to further reduce the JSCall {node}.
+  return Changed(node).FollowedBy(ReduceJSCall(node));
+}
+
 Reduction JSCallReducer::ReduceJSCall(Node* node,
                                       const SharedFunctionInfoRef& shared) {
   JSCallNode n(node);
@@ -137,6 +137,8 @@ class V8_EXPORT_PRIVATE JSCallReducer final : public AdvancedReducer {
   Reduction ReduceJSConstructWithSpread(Node* node);
   Reduction ReduceJSCall(Node* node);
   Reduction ReduceJSCall(Node* node, const SharedFunctionInfoRef& shared);
+  Reduction ReduceJSCallWithBoundFunctionFeedback(
+      Node* node, const JSBoundFunctionRef& function);
   Reduction ReduceJSCallWithArrayLike(Node* node);
   Reduction ReduceJSCallWithSpread(Node* node);
   Reduction ReduceRegExpPrototypeTest(Node* node);
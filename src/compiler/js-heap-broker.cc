@@ -285,13 +285,15 @@ GlobalAccessFeedback::GlobalAccessFeedback(FeedbackSlotKind slot_kind)
   DCHECK(IsGlobalICKind(slot_kind));
 }
 
-GlobalAccessFeedback::GlobalAccessFeedback(ContextRef script_context,
-                                           int slot_index, bool immutable,
-                                           FeedbackSlotKind slot_kind)
+GlobalAccessFeedback::GlobalAccessFeedback(
+    ContextRef script_context, int slot_index, bool immutable,
+    base::Optional<PropertyCellRef> const_tracking_let_cell,
+    FeedbackSlotKind slot_kind)
     : ProcessedFeedback(kGlobalAccess, slot_kind),
       cell_or_context_(script_context),
       index_and_immutable_(FeedbackNexus::SlotIndexBits::encode(slot_index) |
-                           FeedbackNexus::ImmutabilityBit::encode(immutable)) {
+                           FeedbackNexus::ImmutabilityBit::encode(immutable)),
+      const_tracking_let_cell_(const_tracking_let_cell) {
   DCHECK_EQ(this->slot_index(), slot_index);
   DCHECK_EQ(this->immutable(), immutable);
   DCHECK(IsGlobalICKind(slot_kind));
@@ -322,6 +324,11 @@ bool GlobalAccessFeedback::immutable() const {
   DCHECK(IsScriptContextSlot());
   return FeedbackNexus::ImmutabilityBit::decode(index_and_immutable_);
 }
+base::Optional<PropertyCellRef> GlobalAccessFeedback::const_tracking_let_cell()
+    const {
+  DCHECK(IsScriptContextSlot());
+  return const_tracking_let_cell_;
+}
 
 base::Optional<ObjectRef> GlobalAccessFeedback::GetConstantHint() const {
   if (IsPropertyCell()) {
@@ -633,9 +640,20 @@ ProcessedFeedback const& JSHeapBroker::ReadFeedbackForGlobalAccess(
     base::Optional<ObjectRef> contents = context.get(context_slot_index);
     if (contents.has_value()) CHECK(!contents->IsTheHole());
 
+    base::Optional<PropertyCellRef> const_tracking_let_cell;
+    if (FLAG_const_tracking_let) {
+      Object cell = target_native_context().object()->ConstTrackingLetCell(
+          script_context_index, context_slot_index);
+      if (cell.IsPropertyCell()) {
+        const_tracking_let_cell = MakeRefAssumeMemoryFence(
+            this, CanonicalPersistentHandle(PropertyCell::cast(cell)));
+      }
+    }
+
     return *zone()->New<GlobalAccessFeedback>(
         context, context_slot_index,
-        FeedbackNexus::ImmutabilityBit::decode(number), nexus.kind());
+        FeedbackNexus::ImmutabilityBit::decode(number),
+        const_tracking_let_cell, nexus.kind());
   }
 
   CHECK(feedback_value->IsPropertyCell());
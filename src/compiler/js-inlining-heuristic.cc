@@ -226,6 +226,11 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
       }
       candidate_is_small = candidate_is_small &&
                            IsSmall(bytecode.length() + inlined_bytecode_size);
+      if ((FLAG_optimization_hints ||
+           FLAG_cross_context_optimization_hints) &&
+          shared.has_inlining_hint()) {
+        candidate.has_inlining_hint = true;
+      }
     }
   }
   if (!can_inline_candidate) return NoChange();
@@ -241,8 +246,9 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
 
   // Don't consider a {candidate} whose frequency is below the
   // threshold, i.e. a call site that is only hit once every N
-  // invocations of the caller.
-  if (candidate.frequency.IsKnown() &&
+  // invocations of the caller. Targets that were inlined in an earlier run
+  // are still considered, as the current feedback may not be warm yet.
+  if (!candidate.has_inlining_hint && candidate.frequency.IsKnown() &&
       candidate.frequency.value() < FLAG_min_inlining_frequency) {
     return NoChange();
   }
@@ -781,6 +787,10 @@ Reduction JSInliningHeuristic::InlineCandidate(Candidate const& candidate,
 
 bool JSInliningHeuristic::CandidateCompare::operator()(
     const Candidate& left, const Candidate& right) const {
+  // Candidates that were inlined in an earlier run come first.
+  if (left.has_inlining_hint != right.has_inlining_hint) {
+    return left.has_inlining_hint;
+  }
   if (right.frequency.IsUnknown()) {
     if (left.frequency.IsUnknown()) {
       // If left and right are both unknown then the ordering is indeterminate,
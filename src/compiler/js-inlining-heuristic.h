@@ -68,6 +68,9 @@ class JSInliningHeuristic final : public AdvancedReducer {
     Node* node = nullptr;     // The call site at which to inline.
     CallFrequency frequency;  // Relative frequency of this call site.
     int total_size = 0;
+    // Whether a target was inlined in an earlier run (see
+    // SharedFunctionInfo::has_inlining_hint).
+    bool has_inlining_hint = false;
   };
 
   // Comparator for candidates.
@@ -78,6 +78,8 @@ Reduction JSIntrinsicLowering::Reduce(Node* node) {
       return ReduceIncBlockCounter(node);
     case Runtime::kInlineGetImportMetaObject:
       return ReduceGetImportMetaObject(node);
+    case Runtime::kInlineIsFastJSArrayForDestructuring:
+      return ReduceIsFastJSArrayForDestructuring(node);
     default:
       break;
   }
@@ -344,6 +346,14 @@ Reduction JSIntrinsicLowering::ReduceGetImportMetaObject(Node* node) {
   return Changed(node);
 }
 
+Reduction JSIntrinsicLowering::ReduceIsFastJSArrayForDestructuring(
+    Node* node) {
+  return Change(node,
+                Builtins::CallableFor(
+                    isolate(), Builtin::kIsFastJSArrayForDestructuring),
+                0);
+}
+
 Reduction JSIntrinsicLowering::Change(Node* node, const Operator* op, Node* a,
                                       Node* b) {
   RelaxControls(node);
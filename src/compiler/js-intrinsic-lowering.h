@@ -66,6 +66,7 @@ class V8_EXPORT_PRIVATE JSIntrinsicLowering final
   Reduction ReduceCall(Node* node);
   Reduction ReduceIncBlockCounter(Node* node);
   Reduction ReduceGetImportMetaObject(Node* node);
+  Reduction ReduceIsFastJSArrayForDestructuring(Node* node);
 
   Reduction Change(Node* node, const Operator* op);
   Reduction Change(Node* node, const Operator* op, Node* a, Node* b);
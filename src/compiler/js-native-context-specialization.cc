@@ -7,6 +7,7 @@
 #include "src/api/api-inl.h"
 #include "src/base/optional.h"
 #include "src/builtins/accessors.h"
+#include "src/builtins/builtins.h"
 #include "src/codegen/code-factory.h"
 #include "src/codegen/string-constants.h"
 #include "src/compiler/access-builder.h"
@@ -989,6 +990,19 @@ Reduction JSNativeContextSpecialization::ReduceJSLoadGlobal(Node* node) {
 
   GlobalAccessFeedback const& feedback = processed.AsGlobalAccess();
   if (feedback.IsScriptContextSlot()) {
+    if (!feedback.immutable() && feedback.const_tracking_let_cell()) {
+      // The let binding has not been reassigned since its initialization, so
+      // fold its current value and deoptimize once it is reassigned.
+      base::Optional<ObjectRef> value =
+          feedback.script_context().get(feedback.slot_index());
+      if (value.has_value() && !value->IsTheHole() &&
+          dependencies()->DependOnProtector(
+              *feedback.const_tracking_let_cell())) {
+        Node* constant = jsgraph()->Constant(*value);
+        ReplaceWithValue(node, constant);
+        return Replace(constant);
+      }
+    }
     Effect effect = n.effect();
     Node* script_context = jsgraph()->Constant(feedback.script_context());
     Node* value = effect =
@@ -1158,6 +1172,18 @@ Reduction JSNativeContextSpecialization::ReduceNamedAccess(
     }
   }
 
+  // Named loads from proxies call the get trap through the same builtin that
+  // the LoadIC dispatches to.
+  if (node->opcode() == IrOpcode::kJSLoadNamed && feedback.name().IsString() &&
+      !lookup_start_object_maps.empty() &&
+      std::all_of(lookup_start_object_maps.begin(),
+                  lookup_start_object_maps.end(), [](const MapRef& map) {
+                    return map.instance_type() == JS_PROXY_TYPE;
+                  })) {
+    return ReduceJSLoadNamedFromProxy(node, feedback.name(),
+                                      lookup_start_object_maps);
+  }
+
   ZoneVector<PropertyAccessInfo> access_infos(zone());
   {
     ZoneVector<PropertyAccessInfo> access_infos_for_feedback(zone());
@@ -1435,6 +1461,39 @@ Reduction JSNativeContextSpecialization::ReduceNamedAccess(
   return Replace(value);
 }
 
+Reduction JSNativeContextSpecialization::ReduceJSLoadNamedFromProxy(
+    Node* node, NameRef const& name, ZoneVector<MapRef> const& proxy_maps) {
+  JSLoadNamedNode n(node);
+  Node* proxy = n.object();
+  Effect effect = n.effect();
+  Control control = n.control();
+
+  PropertyAccessBuilder access_builder(jsgraph(), broker(), dependencies());
+  access_builder.BuildCheckMaps(proxy, &effect, control, proxy_maps);
+
+  // Turn the {node} into a call to ProxyGetProperty(proxy, name, receiver,
+  // on_non_existent), keeping its exception projections.
+  Callable callable =
+      Builtins::CallableFor(isolate(), Builtin::kProxyGetProperty);
+  auto call_descriptor = Linkage::GetStubCallDescriptor(
+      graph()->zone(), callable.descriptor(),
+      callable.descriptor().GetStackParameterCount(),
+      CallDescriptor::kNeedsFrameState);
+  node->RemoveInput(n.FeedbackVectorIndex());
+  node->InsertInput(graph()->zone(), 0,
+                    jsgraph()->HeapConstant(callable.code()));
+  node->InsertInput(graph()->zone(), 2, jsgraph()->Constant(name));
+  node->InsertInput(graph()->zone(), 3, proxy);
+  node->InsertInput(
+      graph()->zone(), 4,
+      jsgraph()->SmiConstant(
+          static_cast<int>(OnNonExistent::kReturnUndefined)));
+  // The context and frame state inputs follow.
+  NodeProperties::ChangeOp(node, common()->Call(call_descriptor));
+  NodeProperties::ReplaceEffectInput(node, effect);
+  return Changed(node);
+}
+
 Reduction JSNativeContextSpecialization::ReduceJSLoadNamed(Node* node) {
   JSLoadNamedNode n(node);
   NamedAccess const& p = n.Parameters();
@@ -0,0 +1,144 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/loop-check-hoisting.h"
+
+#include "src/compiler/node-properties.h"
+#include "src/compiler/node.h"
+#include "src/compiler/simplified-operator.h"
+#include "src/objects/heap-object.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+#define TRACE(...)                                  \
+  do {                                              \
+    if (FLAG_trace_turbo_loop) PrintF(__VA_ARGS__); \
+  } while (false)
+
+void LoopCheckHoisting::Run() {
+  for (const LoopTree::Loop* loop : loop_tree_->outer_loops()) {
+    VisitLoop(loop);
+  }
+}
+
+void LoopCheckHoisting::VisitLoop(const LoopTree::Loop* loop) {
+  // Visit inner loops first, so that their checks land on their loop entry
+  // before the enclosing loop is inspected.
+  for (const LoopTree::Loop* child : loop->children()) VisitLoop(child);
+
+  Node* loop_header = loop_tree_->HeaderNode(loop);
+  Node* effect_phi = nullptr;
+  for (Node* use : loop_header->uses()) {
+    if (use->opcode() == IrOpcode::kEffectPhi) {
+      effect_phi = use;
+      break;
+    }
+  }
+  if (effect_phi == nullptr) return;
+
+  Node* entry_control = NodeProperties::GetControlInput(loop_header, 0);
+  if (!EntersAfterCheckpoint(NodeProperties::GetEffectInput(effect_phi, 0),
+                             entry_control)) {
+    return;
+  }
+  if (!LoopPreservesMaps(effect_phi)) return;
+
+  ZoneVector<Node*> checks(zone_);
+  for (Node* node : loop_tree_->BodyNodes(loop)) {
+    if (node->opcode() == IrOpcode::kCheckMaps &&
+        IsHoistable(loop, loop_header, effect_phi, node)) {
+      checks.push_back(node);
+    }
+  }
+
+  for (Node* check : checks) {
+    TRACE("Hoisting #%d:%s out of loop #%d\n", check->id(),
+          check->op()->mnemonic(), loop_header->id());
+    // Unlink the {check} from the loop header's effect chain and put it at
+    // the end of the effect chain entering the loop.
+    NodeProperties::ReplaceUses(check, nullptr,
+                                NodeProperties::GetEffectInput(check));
+    NodeProperties::ReplaceEffectInput(
+        check, NodeProperties::GetEffectInput(effect_phi, 0));
+    NodeProperties::ReplaceControlInput(check, entry_control);
+    NodeProperties::ReplaceEffectInput(effect_phi, check, 0);
+  }
+}
+
+// static
+bool LoopCheckHoisting::EntersAfterCheckpoint(Node* effect, Node* control) {
+  // The hoisted checks deoptimize to the frame state of the last Checkpoint
+  // before the loop, which is only sound if nothing observable happens in
+  // between and the Checkpoint is scheduled in the same block as the checks.
+  while (effect->opcode() != IrOpcode::kCheckpoint) {
+    if (effect->op()->EffectInputCount() != 1 ||
+        !effect->op()->HasProperty(Operator::kNoWrite)) {
+      return false;
+    }
+    if (effect->op()->ControlInputCount() > 0 &&
+        NodeProperties::GetControlInput(effect) != control) {
+      return false;
+    }
+    effect = NodeProperties::GetEffectInput(effect);
+  }
+  return NodeProperties::GetControlInput(effect) == control;
+}
+
+bool LoopCheckHoisting::LoopPreservesMaps(Node* effect_phi) {
+  // Walk all effect chains flowing into the back edges of the loop; this is
+  // the same walk that LoadElimination::ComputeLoopState performs.
+  ZoneQueue<Node*> queue(zone_);
+  ZoneSet<Node*> visited(zone_);
+  visited.insert(effect_phi);
+  for (int i = 1; i < effect_phi->op()->EffectInputCount(); ++i) {
+    queue.push(NodeProperties::GetEffectInput(effect_phi, i));
+  }
+  while (!queue.empty()) {
+    Node* const current = queue.front();
+    queue.pop();
+    if (!visited.insert(current).second) continue;
+    if (!current->op()->HasProperty(Operator::kNoWrite)) {
+      switch (current->opcode()) {
+        case IrOpcode::kEnsureWritableFastElements:
+        case IrOpcode::kMaybeGrowFastElements:
+        case IrOpcode::kStoreElement:
+        case IrOpcode::kStoreTypedElement:
+          break;
+        case IrOpcode::kStoreField:
+          if (FieldAccessOf(current->op()).offset == HeapObject::kMapOffset) {
+            return false;
+          }
+          break;
+        default:
+          return false;
+      }
+    }
+    for (int i = 0; i < current->op()->EffectInputCount(); ++i) {
+      queue.push(NodeProperties::GetEffectInput(current, i));
+    }
+  }
+  return true;
+}
+
+bool LoopCheckHoisting::IsHoistable(const LoopTree::Loop* loop,
+                                    Node* loop_header, Node* effect_phi,
+                                    Node* check) {
+  // The check has to execute on every iteration ...
+  if (NodeProperties::GetControlInput(check) != loop_header) return false;
+  if (!NodeProperties::NoObservableSideEffectBetween(
+          NodeProperties::GetEffectInput(check), effect_phi)) {
+    return false;
+  }
+  // ... and has to check the same value on every iteration.
+  Node* const object = NodeProperties::GetValueInput(check, 0);
+  return !loop_tree_->Contains(loop, object);
+}
+
+#undef TRACE
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,52 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_LOOP_CHECK_HOISTING_H_
+#define V8_COMPILER_LOOP_CHECK_HOISTING_H_
+
+#include "src/base/compiler-specific.h"
+#include "src/common/globals.h"
+#include "src/compiler/loop-analysis.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+// Moves CheckMaps nodes on loop-invariant values out of loops and onto the
+// loop entry, so that the maps are checked once instead of on every
+// iteration. A check is only hoisted if
+//
+//  - it is checked unconditionally in the loop header, i.e. only nodes
+//    without observable side effects precede it on the header's effect chain,
+//  - nothing inside the loop can change the map of any object, and
+//  - the loop is entered right after a Checkpoint, whose frame state is used
+//    for the eager deoptimization of the hoisted check.
+//
+// Redundant checks within loops are already removed by LoadElimination; this
+// handles the case where the first check of a value happens inside the loop.
+class V8_EXPORT_PRIVATE LoopCheckHoisting final {
+ public:
+  LoopCheckHoisting(LoopTree* loop_tree, Zone* zone)
+      : loop_tree_(loop_tree), zone_(zone) {}
+  LoopCheckHoisting(const LoopCheckHoisting&) = delete;
+  LoopCheckHoisting& operator=(const LoopCheckHoisting&) = delete;
+
+  void Run();
+
+ private:
+  void VisitLoop(const LoopTree::Loop* loop);
+  bool LoopPreservesMaps(Node* effect_phi);
+  bool IsHoistable(const LoopTree::Loop* loop, Node* loop_header,
+                   Node* effect_phi, Node* check);
+  static bool EntersAfterCheckpoint(Node* effect, Node* control);
+
+  LoopTree* const loop_tree_;
+  Zone* const zone_;
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_LOOP_CHECK_HOISTING_H_
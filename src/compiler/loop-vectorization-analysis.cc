@@ -0,0 +1,137 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/loop-vectorization-analysis.h"
+
+#include "src/compiler/node-matchers.h"
+#include "src/compiler/node-properties.h"
+#include "src/compiler/node.h"
+#include "src/compiler/simplified-operator.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+namespace {
+
+// Returns true if {phi} is incremented by exactly one on the back edge.
+bool IsUnitStrideInductionVariable(Node* phi) {
+  if (phi->op()->ValueInputCount() != 2) return false;
+  Node* increment = phi->InputAt(1);
+  switch (increment->opcode()) {
+    case IrOpcode::kNumberAdd:
+    case IrOpcode::kSpeculativeNumberAdd:
+    case IrOpcode::kSpeculativeSafeIntegerAdd:
+      break;
+    default:
+      return false;
+  }
+  Node* const left = increment->InputAt(0);
+  Node* const right = increment->InputAt(1);
+  return (left == phi && NumberMatcher(right).Is(1)) ||
+         (right == phi && NumberMatcher(left).Is(1));
+}
+
+// Looks through the bounds check guarding a typed array access.
+Node* SkipCheckBounds(Node* index) {
+  while (index->opcode() == IrOpcode::kCheckBounds) {
+    index = NodeProperties::GetValueInput(index, 0);
+  }
+  return index;
+}
+
+bool IsVectorizableElementType(ExternalArrayType type) {
+  return type != kExternalBigInt64Array && type != kExternalBigUint64Array;
+}
+
+}  // namespace
+
+bool LoopVectorizationAnalysis::IsCandidate(const LoopTree::Loop* loop,
+                                            Candidate* candidate) {
+  if (!loop->children().empty()) return false;
+  Node* const loop_header = loop_tree_->HeaderNode(loop);
+  if (loop_header->InputCount() != 2) return false;
+
+  Candidate result;
+  int branches = 0;
+  ZoneVector<Node*> accesses(loop_tree_->zone());
+  for (Node* node : loop_tree_->LoopNodes(loop)) {
+    switch (node->opcode()) {
+      case IrOpcode::kPhi:
+        // Anything but the induction variable (reductions, merges of
+        // diverging control flow) is out of reach for now.
+        if (result.induction_variable != nullptr ||
+            NodeProperties::GetControlInput(node) != loop_header ||
+            !IsUnitStrideInductionVariable(node)) {
+          return false;
+        }
+        result.induction_variable = node;
+        break;
+      case IrOpcode::kBranch:
+        // Only the loop condition may branch.
+        if (++branches > 1) return false;
+        break;
+      case IrOpcode::kLoadTypedElement:
+        if (!IsVectorizableElementType(ExternalArrayTypeOf(node->op()))) {
+          return false;
+        }
+        result.loads++;
+        accesses.push_back(node);
+        break;
+      case IrOpcode::kStoreTypedElement:
+        if (!IsVectorizableElementType(ExternalArrayTypeOf(node->op()))) {
+          return false;
+        }
+        result.stores++;
+        accesses.push_back(node);
+        break;
+      case IrOpcode::kMerge:
+        return false;
+      case IrOpcode::kEffectPhi:
+      case IrOpcode::kCheckpoint:
+      case IrOpcode::kCheckBounds:
+      case IrOpcode::kLoadField:
+      case IrOpcode::kJSStackCheck:
+      case IrOpcode::kLoopExitEffect:
+        break;
+      default:
+        // Pure computations are fine; any other side effect is not.
+        if (node->op()->EffectOutputCount() > 0) return false;
+        break;
+    }
+  }
+  if (result.induction_variable == nullptr || result.stores == 0) {
+    return false;
+  }
+  for (Node* access : accesses) {
+    if (SkipCheckBounds(NodeProperties::GetValueInput(access, 3)) !=
+        result.induction_variable) {
+      return false;
+    }
+  }
+  *candidate = result;
+  return true;
+}
+
+void LoopVectorizationAnalysis::TraceCandidates() {
+  for (const LoopTree::Loop* loop : loop_tree_->outer_loops()) {
+    TraceCandidates(loop);
+  }
+}
+
+void LoopVectorizationAnalysis::TraceCandidates(const LoopTree::Loop* loop) {
+  for (const LoopTree::Loop* child : loop->children()) TraceCandidates(child);
+  Candidate candidate;
+  if (IsCandidate(loop, &candidate)) {
+    PrintF(
+        "Loop #%d is a vectorization candidate (induction variable #%d, %d "
+        "loads, %d stores)\n",
+        loop_tree_->HeaderNode(loop)->id(), candidate.induction_variable->id(),
+        candidate.loads, candidate.stores);
+  }
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,52 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_LOOP_VECTORIZATION_ANALYSIS_H_
+#define V8_COMPILER_LOOP_VECTORIZATION_ANALYSIS_H_
+
+#include "src/base/compiler-specific.h"
+#include "src/common/globals.h"
+#include "src/compiler/loop-analysis.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+// Finds innermost loops that are candidates for SIMD vectorization: counted
+// loops with a unit stride induction variable whose only side effects are
+// loads and stores of non-BigInt typed array elements at that induction
+// variable. Such loops map directly onto the Simd128 machine operators; the
+// remaining obstacles are aliasing between the accessed typed arrays and the
+// handling of the tail iterations.
+class V8_EXPORT_PRIVATE LoopVectorizationAnalysis final {
+ public:
+  struct Candidate {
+    Node* induction_variable = nullptr;
+    int loads = 0;
+    int stores = 0;
+  };
+
+  explicit LoopVectorizationAnalysis(LoopTree* loop_tree)
+      : loop_tree_(loop_tree) {}
+  LoopVectorizationAnalysis(const LoopVectorizationAnalysis&) = delete;
+  LoopVectorizationAnalysis& operator=(const LoopVectorizationAnalysis&) =
+      delete;
+
+  // Returns true and fills in {candidate} if {loop} could be vectorized.
+  bool IsCandidate(const LoopTree::Loop* loop, Candidate* candidate);
+
+  // Prints all candidate loops of the graph.
+  void TraceCandidates();
+
+ private:
+  void TraceCandidates(const LoopTree::Loop* loop);
+
+  LoopTree* const loop_tree_;
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_LOOP_VECTORIZATION_ANALYSIS_H_
@@ -12,6 +12,7 @@
 #include "src/compiler/node-properties.h"
 #include "src/compiler/node.h"
 #include "src/compiler/simplified-operator.h"
+#include "src/numbers/conversions-inl.h"
 #include "src/roots/roots-inl.h"
 #include "src/security/external-pointer.h"
 
@@ -599,6 +600,12 @@ bool ValueNeedsWriteBarrier(Node* value, Isolate* isolate) {
     switch (value->opcode()) {
       case IrOpcode::kBitcastWordToTaggedSigned:
         return false;
+      case IrOpcode::kNumberConstant:
+        // Smi constants are encoded as immediates, others as HeapNumbers.
+        return !IsSmiDouble(OpParameter<double>(value->op()));
+      case IrOpcode::kTypeGuard:
+        value = NodeProperties::GetValueInput(value, 0);
+        continue;
       case IrOpcode::kHeapConstant: {
         RootIndex root_index;
         if (isolate->roots_table().IsRootHandle(HeapConstantOf(value->op()),
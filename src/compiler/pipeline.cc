@@ -55,9 +55,11 @@
 #include "src/compiler/js-typed-lowering.h"
 #include "src/compiler/load-elimination.h"
 #include "src/compiler/loop-analysis.h"
+#include "src/compiler/loop-check-hoisting.h"
 #include "src/compiler/loop-peeling.h"
 #include "src/compiler/loop-unrolling.h"
 #include "src/compiler/loop-variable-optimizer.h"
+#include "src/compiler/loop-vectorization-analysis.h"
 #include "src/compiler/machine-graph-verifier.h"
 #include "src/compiler/machine-operator-reducer.h"
 #include "src/compiler/memory-optimizer.h"
@@ -1235,6 +1237,8 @@ PipelineCompilationJob::Status PipelineCompilationJob::ExecuteJobImpl(
   if (!success) return FAILED;
 
   pipeline_.AssembleCode(linkage_);
+  compilation_info()->set_peak_zone_size(
+      data_.zone_stats()->GetMaxAllocatedBytes());
 
   return SUCCEEDED;
 }
@@ -1245,6 +1249,18 @@ PipelineCompilationJob::Status PipelineCompilationJob::FinalizeJobImpl(
   // phases happening during PrepareJob.
   PipelineJobScope scope(&data_, isolate->counters()->runtime_call_stats());
   RCS_SCOPE(isolate, RuntimeCallCounterId::kOptimizeFinalizePipelineJob);
+  // Break points may have been set while the job was running, see
+  // Debug::DeoptimizeFunction. The function is retried without inlining the
+  // functions that have break points now.
+  if (compilation_info()->shared_info()->HasBreakInfo()) {
+    return RetryOptimization(BailoutReason::kFunctionBeingDebugged);
+  }
+  for (const OptimizedCompilationInfo::InlinedFunctionHolder& inlined :
+       compilation_info()->inlined_functions()) {
+    if (inlined.shared_info->HasBreakInfo()) {
+      return RetryOptimization(BailoutReason::kFunctionBeingDebugged);
+    }
+  }
   MaybeHandle<Code> maybe_code = pipeline_.FinalizeCode();
   Handle<Code> code;
   if (!maybe_code.ToHandle(&code)) {
@@ -1595,6 +1611,10 @@ struct EscapeAnalysisPhase {
     // TODO(turbofan): Turn this into a debug mode check once we have
     // confidence.
     escape_reducer.VerifyReplacement();
+    data->isolate()
+        ->counters()
+        ->turbofan_escape_analysis_eliminated_allocations()
+        ->Increment(static_cast<int>(escape_reducer.eliminated_allocations()));
   }
 };
 
@@ -1870,6 +1890,41 @@ struct LoadEliminationPhase {
   }
 };
 
+namespace {
+
+// Trims the graph so that the loop finder only sees live nodes, then builds
+// the loop tree.
+LoopTree* BuildTrimmedLoopTree(PipelineData* data, Zone* temp_zone) {
+  GraphTrimmer trimmer(temp_zone, data->graph());
+  NodeVector roots(temp_zone);
+  data->jsgraph()->GetCachedNodes(&roots);
+  {
+    UnparkedScopeIfNeeded scope(data->broker(), FLAG_trace_turbo_trimming);
+    trimmer.TrimGraph(roots.begin(), roots.end());
+  }
+  return LoopFinder::BuildLoopTree(
+      data->jsgraph()->graph(), &data->info()->tick_counter(), temp_zone);
+}
+
+}  // namespace
+
+struct LoopCheckHoistingPhase {
+  DECL_PIPELINE_PHASE_CONSTANTS(LoopCheckHoisting)
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    LoopCheckHoisting(BuildTrimmedLoopTree(data, temp_zone), temp_zone).Run();
+  }
+};
+
+struct LoopVectorizationAnalysisPhase {
+  DECL_PIPELINE_PHASE_CONSTANTS(LoopVectorizationAnalysis)
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    LoopVectorizationAnalysis(BuildTrimmedLoopTree(data, temp_zone))
+        .TraceCandidates();
+  }
+};
+
 struct MemoryOptimizationPhase {
   DECL_PIPELINE_PHASE_CONSTANTS(MemoryOptimization)
 
@@ -2723,6 +2778,13 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
     Run<LoadEliminationPhase>();
     RunPrintAndVerify(LoadEliminationPhase::phase_name());
   }
+  if (FLAG_turbo_loop_check_hoisting) {
+    Run<LoopCheckHoistingPhase>();
+    RunPrintAndVerify(LoopCheckHoistingPhase::phase_name(), true);
+  }
+  if (FLAG_trace_turbo_vectorization_candidates) {
+    Run<LoopVectorizationAnalysisPhase>();
+  }
   data->DeleteTyper();
 
   if (FLAG_turbo_escape) {
@@ -3549,6 +3611,7 @@ bool PipelineImpl::SelectInstructions(Linkage* linkage) {
     data_->set_source_position_output(source_position_output.str());
   }
 
+  data->info()->set_graph_node_count(data->graph()->NodeCount());
   data->DeleteGraphZone();
 
   data->BeginPhaseKind("V8.TFRegisterAllocation");
@@ -3791,6 +3854,50 @@ void TraceSequence(OptimizedCompilationInfo* info, PipelineData* data,
   }
 }
 
+// Counts the spill (register to stack) and reload (stack to register) moves in
+// the gaps of the allocated sequence. The weighted counts scale every move by
+// 10 per enclosing loop, as a static estimate of how often it executes.
+void TraceSpillMoves(OptimizedCompilationInfo* info, PipelineData* data) {
+  static constexpr int kMaxLoopDepth = 6;
+  InstructionSequence* code = data->sequence();
+  int spills = 0;
+  int reloads = 0;
+  uint64_t weighted_spills = 0;
+  uint64_t weighted_reloads = 0;
+  for (const InstructionBlock* block : code->instruction_blocks()) {
+    uint64_t weight = 1;
+    for (int depth = std::min(code->GetLoopDepth(block), kMaxLoopDepth);
+         depth > 0; --depth) {
+      weight *= 10;
+    }
+    for (int index = block->code_start(); index < block->code_end(); ++index) {
+      const Instruction* instr = code->InstructionAt(index);
+      for (int i = Instruction::FIRST_GAP_POSITION;
+           i <= Instruction::LAST_GAP_POSITION; ++i) {
+        const ParallelMove* moves = instr->parallel_moves()[i];
+        if (moves == nullptr) continue;
+        for (const MoveOperands* move : *moves) {
+          if (move->IsRedundant()) continue;
+          if (move->source().IsAnyRegister() &&
+              move->destination().IsAnyStackSlot()) {
+            ++spills;
+            weighted_spills += weight;
+          } else if (move->source().IsAnyStackSlot() &&
+                     move->destination().IsAnyRegister()) {
+            ++reloads;
+            weighted_reloads += weight;
+          }
+        }
+      }
+    }
+  }
+  CodeTracer::StreamScope tracing_scope(data->GetCodeTracer());
+  tracing_scope.stream() << "[spill moves for " << info->GetDebugName().get()
+                         << ": " << spills << " spills, " << reloads
+                         << " reloads, weighted " << weighted_spills
+                         << " spills, " << weighted_reloads << " reloads]\n";
+}
+
 }  // namespace
 
 void PipelineImpl::AllocateRegistersForTopTier(
@@ -3867,6 +3974,7 @@ void PipelineImpl::AllocateRegistersForTopTier(
   }
 
   TraceSequence(info(), data, "after register allocation");
+  if (FLAG_trace_turbo_spill_moves) TraceSpillMoves(info(), data);
 
   if (verifier != nullptr) {
     verifier->VerifyAssignment("End of regalloc pipeline.");
@@ -78,7 +78,9 @@ class GlobalAccessFeedback : public ProcessedFeedback {
  public:
   GlobalAccessFeedback(PropertyCellRef cell, FeedbackSlotKind slot_kind);
   GlobalAccessFeedback(ContextRef script_context, int slot_index,
-                       bool immutable, FeedbackSlotKind slot_kind);
+                       bool immutable,
+                       base::Optional<PropertyCellRef> const_tracking_let_cell,
+                       FeedbackSlotKind slot_kind);
   explicit GlobalAccessFeedback(FeedbackSlotKind slot_kind);  // Megamorphic
 
   bool IsMegamorphic() const;
@@ -90,12 +92,16 @@ class GlobalAccessFeedback : public ProcessedFeedback {
   ContextRef script_context() const;
   int slot_index() const;
   bool immutable() const;
+  // For mutable script context slots of script-scope lets tracked with
+  // --const-tracking-let, the protector cell that guards their constness.
+  base::Optional<PropertyCellRef> const_tracking_let_cell() const;
 
   base::Optional<ObjectRef> GetConstantHint() const;
 
  private:
   base::Optional<ObjectRef> const cell_or_context_;
   int const index_and_immutable_;
+  base::Optional<PropertyCellRef> const const_tracking_let_cell_;
 };
 
 class KeyedAccessMode {
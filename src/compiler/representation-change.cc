@@ -163,7 +163,8 @@ Node* RepresentationChanger::GetRepresentationFor(
   // Rematerialize any truncated BigInt if user is not expecting a BigInt.
   if (output_type.Is(Type::BigInt()) &&
       output_rep == MachineRepresentation::kWord64 &&
-      use_info.type_check() != TypeCheckKind::kBigInt) {
+      use_info.type_check() != TypeCheckKind::kBigInt &&
+      use_info.type_check() != TypeCheckKind::kBigInt64) {
     if (output_type.Is(Type::UnsignedBigInt64())) {
       node = InsertConversion(node, simplified()->ChangeUint64ToBigInt(),
                               use_node);
@@ -181,7 +182,8 @@ Node* RepresentationChanger::GetRepresentationFor(
       // this behavior is disabled only for TypeCheckKind::kBigInt, but should
       // be fixed for all other type checks.
       (output_rep != MachineRepresentation::kWord32 &&
-       use_info.type_check() != TypeCheckKind::kBigInt)) {
+       use_info.type_check() != TypeCheckKind::kBigInt &&
+       use_info.type_check() != TypeCheckKind::kBigInt64)) {
     if (use_info.representation() == output_rep) {
       // Representations are the same. That's a no-op.
       return node;
@@ -234,6 +236,7 @@ Node* RepresentationChanger::GetRepresentationFor(
       DCHECK(use_info.type_check() == TypeCheckKind::kNone ||
              use_info.type_check() == TypeCheckKind::kSigned64 ||
              use_info.type_check() == TypeCheckKind::kBigInt ||
+             use_info.type_check() == TypeCheckKind::kBigInt64 ||
              use_info.type_check() == TypeCheckKind::kArrayIndex);
       return GetWord64RepresentationFor(node, output_rep, output_type, use_node,
                                         use_info);
@@ -1099,7 +1102,8 @@ Node* RepresentationChanger::GetWord64RepresentationFor(
     case IrOpcode::kFloat64Constant:
       UNREACHABLE();
     case IrOpcode::kNumberConstant: {
-      if (use_info.type_check() != TypeCheckKind::kBigInt) {
+      if (use_info.type_check() != TypeCheckKind::kBigInt &&
+          use_info.type_check() != TypeCheckKind::kBigInt64) {
         double const fv = OpParameter<double>(node->op());
         if (base::IsValueInRangeForNumericType<int64_t>(fv)) {
           int64_t const iv = static_cast<int64_t>(fv);
@@ -1118,13 +1122,20 @@ Node* RepresentationChanger::GetWord64RepresentationFor(
         return jsgraph()->Int64Constant(
             static_cast<int64_t>(bigint.AsUint64()));
       }
+      if (m.HasResolvedValue() && m.Ref(broker_).IsBigInt() &&
+          use_info.type_check() == TypeCheckKind::kBigInt64) {
+        bool lossless;
+        int64_t value = m.Ref(broker_).AsBigInt().AsInt64(&lossless);
+        if (lossless) return jsgraph()->Int64Constant(value);
+      }
       break;
     }
     default:
       break;
   }
 
-  if (use_info.type_check() == TypeCheckKind::kBigInt) {
+  if (use_info.type_check() == TypeCheckKind::kBigInt ||
+      use_info.type_check() == TypeCheckKind::kBigInt64) {
     // BigInts are only represented as tagged pointer and word64.
     if (!CanBeTaggedPointer(output_rep) &&
         output_rep != MachineRepresentation::kWord64) {
@@ -1143,6 +1154,16 @@ Node* RepresentationChanger::GetWord64RepresentationFor(
     // This is an impossible value; it should not be used at runtime.
     return jsgraph()->graph()->NewNode(
         jsgraph()->common()->DeadValue(MachineRepresentation::kWord64), node);
+  } else if (use_info.type_check() == TypeCheckKind::kBigInt64) {
+    if (output_rep == MachineRepresentation::kWord64 &&
+        output_type.Is(Type::SignedBigInt64())) {
+      return node;
+    }
+    // Any other BigInt is checked in its tagged representation.
+    node = GetTaggedPointerRepresentationFor(
+        node, output_rep, output_type, use_node,
+        UseInfo::CheckedBigIntAsTaggedPointer(use_info.feedback()));
+    op = simplified()->CheckedBigIntToBigInt64(use_info.feedback());
   } else if (output_rep == MachineRepresentation::kBit) {
     CHECK(output_type.Is(Type::Boolean()));
     CHECK_NE(use_info.type_check(), TypeCheckKind::kNone);
@@ -123,6 +123,7 @@ enum class TypeCheckKind : uint8_t {
   kNumberOrOddball,
   kHeapObject,
   kBigInt,
+  kBigInt64,
   kArrayIndex
 };
 
@@ -146,6 +147,8 @@ inline std::ostream& operator<<(std::ostream& os, TypeCheckKind type_check) {
       return os << "HeapObject";
     case TypeCheckKind::kBigInt:
       return os << "BigInt";
+    case TypeCheckKind::kBigInt64:
+      return os << "BigInt64";
     case TypeCheckKind::kArrayIndex:
       return os << "ArrayIndex";
   }
@@ -187,6 +190,12 @@ class UseInfo {
     return UseInfo(MachineRepresentation::kWord64, Truncation::Word64(),
                    TypeCheckKind::kBigInt, feedback);
   }
+  static UseInfo CheckedBigInt64AsWord64(const FeedbackSource& feedback) {
+    // Unlike the truncating use above, this deopts for BigInts that do not
+    // fit into a signed 64-bit integer.
+    return UseInfo(MachineRepresentation::kWord64, Truncation::Any(),
+                   TypeCheckKind::kBigInt64, feedback);
+  }
   static UseInfo Word64() {
     return UseInfo(MachineRepresentation::kWord64, Truncation::Any());
   }
@@ -1824,6 +1824,7 @@ class RepresentationSelector {
           case CTypeInfo::Type::kFloat64:
             return UseInfo::CheckedNumberAsFloat64(kDistinguishZeros, feedback);
           case CTypeInfo::Type::kV8Value:
+          case CTypeInfo::Type::kSeqOneByteString:
           case CTypeInfo::Type::kApiObject:
             return UseInfo::AnyTagged();
         }
@@ -1892,6 +1893,9 @@ class RepresentationSelector {
         return MachineType::Float32();
       case wasm::kF64:
         return MachineType::Float64();
+      case wasm::kOptRef:
+        DCHECK_EQ(type, wasm::kWasmExternRef);
+        return MachineType::AnyTagged();
       case wasm::kI64:
         // Not used for i64, see VisitJSWasmCall().
       default:
@@ -1909,6 +1913,7 @@ class RepresentationSelector {
       case wasm::kI32:
         return UseInfo::CheckedNumberOrOddballAsWord32(feedback);
       case wasm::kI64:
+      case wasm::kOptRef:
         return UseInfo::AnyTagged();
       case wasm::kF32:
       case wasm::kF64:
@@ -3108,6 +3113,15 @@ class RepresentationSelector {
           if (lower<T>()) {
             ChangeToPureOp(node, lowering->machine()->Int64Add());
           }
+        } else if (BigIntOperationHintOf(node->op()) ==
+                   BigIntOperationHint::kBigInt64) {
+          // Keep the result in a register and deopt when it overflows.
+          VisitBinop<T>(node,
+                        UseInfo::CheckedBigInt64AsWord64(FeedbackSource{}),
+                        MachineRepresentation::kWord64, Type::SignedBigInt64());
+          if (lower<T>()) {
+            ChangeOp(node, lowering->simplified()->CheckedInt64Add());
+          }
         } else {
           VisitBinop<T>(node,
                         UseInfo::CheckedBigIntAsTaggedPointer(FeedbackSource{}),
@@ -3126,6 +3140,14 @@ class RepresentationSelector {
           if (lower<T>()) {
             ChangeToPureOp(node, lowering->machine()->Int64Sub());
           }
+        } else if (BigIntOperationHintOf(node->op()) ==
+                   BigIntOperationHint::kBigInt64) {
+          VisitBinop<T>(node,
+                        UseInfo::CheckedBigInt64AsWord64(FeedbackSource{}),
+                        MachineRepresentation::kWord64, Type::SignedBigInt64());
+          if (lower<T>()) {
+            ChangeOp(node, lowering->simplified()->CheckedInt64Sub());
+          }
         } else {
           VisitBinop<T>(node,
                         UseInfo::CheckedBigIntAsTaggedPointer(FeedbackSource{}),
@@ -3931,6 +3953,14 @@ class RepresentationSelector {
                 node,
                 lowering->simplified()->FindOrderedHashMapEntryForInt32Key());
           }
+        } else if (key_type.Is(Type::UniqueName())) {
+          VisitBinop<T>(node, UseInfo::AnyTagged(), UseInfo::AnyTagged(),
+                        MachineType::PointerRepresentation());
+          if (lower<T>()) {
+            ChangeOp(
+                node,
+                lowering->simplified()->FindOrderedHashMapEntryForNameKey());
+          }
         } else {
           VisitBinop<T>(node, UseInfo::AnyTagged(),
                         MachineRepresentation::kTaggedSigned);
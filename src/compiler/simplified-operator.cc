@@ -523,6 +523,8 @@ std::ostream& operator<<(std::ostream& os, BigIntOperationHint hint) {
   switch (hint) {
     case BigIntOperationHint::kBigInt:
       return os << "BigInt";
+    case BigIntOperationHint::kBigInt64:
+      return os << "BigInt64";
   }
   UNREACHABLE();
 }
@@ -572,6 +574,13 @@ NumberOperationHint NumberOperationHintOf(const Operator* op) {
   return OpParameter<NumberOperationHint>(op);
 }
 
+BigIntOperationHint BigIntOperationHintOf(const Operator* op) {
+  DCHECK(op->opcode() == IrOpcode::kSpeculativeBigIntAdd ||
+         op->opcode() == IrOpcode::kSpeculativeBigIntSubtract ||
+         op->opcode() == IrOpcode::kSpeculativeBigIntNegate);
+  return OpParameter<BigIntOperationHint>(op);
+}
+
 bool operator==(NumberOperationParameters const& lhs,
                 NumberOperationParameters const& rhs) {
   return lhs.hint() == rhs.hint() && lhs.feedback() == rhs.feedback();
@@ -850,6 +859,8 @@ bool operator==(CheckMinusZeroParameters const& lhs,
   V(CheckedInt32Div, 2, 1)                \
   V(CheckedInt32Mod, 2, 1)                \
   V(CheckedInt32Sub, 2, 1)                \
+  V(CheckedInt64Add, 2, 1)                \
+  V(CheckedInt64Sub, 2, 1)                \
   V(CheckedUint32Div, 2, 1)               \
   V(CheckedUint32Mod, 2, 1)
 
@@ -858,6 +869,7 @@ bool operator==(CheckMinusZeroParameters const& lhs,
   V(CheckSmi, 1, 1)                         \
   V(CheckString, 1, 1)                      \
   V(CheckBigInt, 1, 1)                      \
+  V(CheckedBigIntToBigInt64, 1, 1)          \
   V(CheckedInt32ToTaggedSigned, 1, 1)       \
   V(CheckedInt64ToInt32, 1, 1)              \
   V(CheckedInt64ToTaggedSigned, 1, 1)       \
@@ -971,6 +983,14 @@ struct SimplifiedOperatorGlobalCache final {
   FindOrderedHashMapEntryForInt32KeyOperator
       kFindOrderedHashMapEntryForInt32Key;
 
+  struct FindOrderedHashMapEntryForNameKeyOperator final : public Operator {
+    FindOrderedHashMapEntryForNameKeyOperator()
+        : Operator(IrOpcode::kFindOrderedHashMapEntryForNameKey,
+                   Operator::kEliminatable,
+                   "FindOrderedHashMapEntryForNameKey", 2, 1, 1, 1, 1, 0) {}
+  };
+  FindOrderedHashMapEntryForNameKeyOperator kFindOrderedHashMapEntryForNameKey;
+
   template <CheckForMinusZeroMode kMode>
   struct ChangeFloat64ToTaggedOperator final
       : public Operator1<CheckForMinusZeroMode> {
@@ -1219,6 +1239,7 @@ EFFECT_DEPENDENT_OP_LIST(GET_FROM_CACHE)
 CHECKED_OP_LIST(GET_FROM_CACHE)
 GET_FROM_CACHE(FindOrderedHashMapEntry)
 GET_FROM_CACHE(FindOrderedHashMapEntryForInt32Key)
+GET_FROM_CACHE(FindOrderedHashMapEntryForNameKey)
 GET_FROM_CACHE(LoadFieldByIndex)
 #undef GET_FROM_CACHE
 
@@ -622,6 +622,32 @@ Node* WasmGraphBuilder::EffectPhi(unsigned count, Node** effects_and_control) {
 
 Node* WasmGraphBuilder::RefNull() { return LOAD_ROOT(NullValue, null_value); }
 
+Node* WasmGraphBuilder::DefaultValue(wasm::ValueType type) {
+  DCHECK(type.is_defaultable());
+  switch (type.kind()) {
+    case wasm::kI8:
+    case wasm::kI16:
+    case wasm::kI32:
+      return Int32Constant(0);
+    case wasm::kI64:
+      return Int64Constant(0);
+    case wasm::kF32:
+      return Float32Constant(0);
+    case wasm::kF64:
+      return Float64Constant(0);
+    case wasm::kS128:
+      return S128Zero();
+    case wasm::kOptRef:
+      return RefNull();
+    case wasm::kRtt:
+    case wasm::kRttWithDepth:
+    case wasm::kVoid:
+    case wasm::kBottom:
+    case wasm::kRef:
+      UNREACHABLE();
+  }
+}
+
 Node* WasmGraphBuilder::RefFunc(uint32_t function_index) {
   return gasm_->CallRuntimeStub(wasm::WasmCode::kWasmRefFunc,
                                 gasm_->Uint32Constant(function_index));
@@ -3265,6 +3291,41 @@ void WasmGraphBuilder::CompareToExternalFunctionAtIndex(
                 failure_control, BranchHint::kTrue);
 }
 
+void WasmGraphBuilder::CompareToInternalFunctionAtIndex(
+    Node* key, uint32_t function_index, Node** success_control,
+    Node** failure_control, wasm::WasmCodePosition position) {
+  Node* ift_size;
+  Node* ift_sig_ids;
+  Node* ift_targets;
+  Node* ift_instances;
+  LoadIndirectFunctionTable(0, &ift_size, &ift_sig_ids, &ift_targets,
+                            &ift_instances);
+
+  TrapIfFalse(wasm::kTrapTableOutOfBounds, gasm_->Uint32LessThan(key, ift_size),
+              position);
+
+  // Instances of the same module share the jump table, so the entry has to
+  // hold both the jump table slot of the function and this instance.
+  Node* key_intptr = BuildChangeUint32ToUintPtr(key);
+  Node* target_instance = gasm_->LoadFixedArrayElement(
+      ift_instances, key_intptr, MachineType::TaggedPointer());
+  Node* target = gasm_->LoadFromObject(
+      MachineType::Pointer(), ift_targets,
+      gasm_->IntMul(key_intptr, gasm_->IntPtrConstant(kSystemPointerSize)));
+  Node* jump_table_start =
+      LOAD_INSTANCE_FIELD(JumpTableStart, MachineType::Pointer());
+  Node* expected_target = gasm_->IntAdd(
+      jump_table_start,
+      gasm_->IntPtrConstant(wasm::JumpTableAssembler::JumpSlotIndexToOffset(
+          wasm::declared_function_index(env_->module, function_index))));
+
+  Node* is_function = gasm_->Word32And(
+      gasm_->WordEqual(target, expected_target),
+      gasm_->TaggedEqual(target_instance, GetInstance()));
+  gasm_->Branch(is_function, success_control, failure_control,
+                BranchHint::kTrue);
+}
+
 Node* WasmGraphBuilder::CallRef(const wasm::FunctionSig* sig,
                                 base::Vector<Node*> args,
                                 base::Vector<Node*> rets,
@@ -3811,6 +3872,13 @@ WasmGraphBuilder::BoundsCheckMem(uint8_t access_size, Node* index,
 
   if (env_->bounds_checks == wasm::kTrapHandler &&
       enforce_check == kCanOmitBoundsCheck) {
+    if (env_->module->is_memory64) {
+      // The guard regions only cover 32-bit indexes, so check that the upper
+      // half of the index is zero.
+      Node* high_word = gasm_->Word64Shr(index, Int32Constant(32));
+      TrapIfTrue(wasm::kTrapMemOutOfBounds,
+                 gasm_->TruncateInt64ToInt32(high_word), position);
+    }
     return {index, kTrapHandler};
   }
 
@@ -5619,16 +5687,53 @@ Builtin ChooseArrayAllocationBuiltin(wasm::ValueType element_type,
   return Builtin::kWasmAllocateArray_InitZero;
 }
 
+// Arrays of at most this many elements with a constant length are allocated
+// inline by {ArrayNewWithRtt}.
+constexpr uint32_t kMaxInlineAllocatedArrayLength = 16;
+
 Node* WasmGraphBuilder::ArrayNewWithRtt(uint32_t array_index,
                                         const wasm::ArrayType* type,
                                         Node* length, Node* initial_value,
                                         Node* rtt,
                                         wasm::WasmCodePosition position) {
+  wasm::ValueType element_type = type->element_type();
+  Uint32Matcher length_matcher(length);
+  if (length_matcher.HasResolvedValue() &&
+      length_matcher.ResolvedValue() <= kMaxInlineAllocatedArrayLength) {
+    // Allocate small arrays like structs, initializing every element with its
+    // own store. Unlike the builtin call, this is visible to load elimination
+    // and escape analysis.
+    DCHECK_LE(static_cast<int>(kMaxInlineAllocatedArrayLength),
+              WasmArray::MaxLength(type));
+    int length_value = static_cast<int>(length_matcher.ResolvedValue());
+    int element_size = element_type.element_size_bytes();
+    int size = WasmArray::kHeaderSize +
+               RoundUp(length_value * element_size, kTaggedSize);
+    Node* a = gasm_->Allocate(size);
+    gasm_->StoreMap(a, rtt);
+    gasm_->StoreToObject(
+        ObjectAccess(MachineType::TaggedPointer(), kNoWriteBarrier), a,
+        wasm::ObjectAccess::ToTagged(JSReceiver::kPropertiesOrHashOffset),
+        LOAD_ROOT(EmptyFixedArray, empty_fixed_array));
+    gasm_->StoreToObject(
+        ObjectAccess(MachineType::Uint32(), kNoWriteBarrier), a,
+        wasm::ObjectAccess::ToTagged(WasmArray::kLengthOffset), length);
+    Node* value =
+        initial_value != nullptr ? initial_value : DefaultValue(element_type);
+    for (int i = 0; i < length_value; i++) {
+      gasm_->StoreToObject(
+          ObjectAccessForGCStores(element_type), a,
+          wasm::ObjectAccess::ToTagged(WasmArray::kHeaderSize) +
+              i * element_size,
+          value);
+    }
+    return a;
+  }
+
   TrapIfFalse(wasm::kTrapArrayTooLarge,
               gasm_->Uint32LessThanOrEqual(
                   length, gasm_->Uint32Constant(WasmArray::MaxLength(type))),
               position);
-  wasm::ValueType element_type = type->element_type();
   // TODO(7748): Consider using gasm_->Allocate().
   Builtin stub = ChooseArrayAllocationBuiltin(element_type, initial_value);
   // Do NOT mark this as Operator::kEliminatable, because that would cause the
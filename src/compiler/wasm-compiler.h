@@ -251,6 +251,8 @@ class WasmGraphBuilder {
   Node* CreateOrMergeIntoEffectPhi(Node* merge, Node* tnode, Node* fnode);
   Node* EffectPhi(unsigned count, Node** effects_and_control);
   Node* RefNull();
+  // The default value of a defaultable type, i.e. zero or null.
+  Node* DefaultValue(wasm::ValueType type);
   Node* RefFunc(uint32_t function_index);
   Node* RefAsNonNull(Node* arg, wasm::WasmCodePosition position);
   Node* Int32Constant(int32_t value);
@@ -331,6 +333,12 @@ class WasmGraphBuilder {
   void CompareToExternalFunctionAtIndex(Node* func_ref, uint32_t function_index,
                                         Node** success_control,
                                         Node** failure_control);
+  // Checks whether entry {key} of table 0 holds the function at
+  // {function_index} of this instance. Traps if {key} is out of bounds.
+  void CompareToInternalFunctionAtIndex(Node* key, uint32_t function_index,
+                                        Node** success_control,
+                                        Node** failure_control,
+                                        wasm::WasmCodePosition position);
 
   Node* ReturnCall(uint32_t index, base::Vector<Node*> args,
                    wasm::WasmCodePosition position);
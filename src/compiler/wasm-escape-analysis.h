@@ -18,8 +18,9 @@ namespace compiler {
 class MachineGraph;
 
 // Eliminate allocated objects which are only assigned to.
-// Current restrictions: Does not work for arrays (until they are also allocated
-// with AllocateRaw). Does not work if the allocated object is passed to a phi.
+// Current restrictions: Only works for structs and for arrays of small constant
+// length, which are the only objects allocated with AllocateRaw. Does not work
+// if the allocated object is passed to a phi.
 class WasmEscapeAnalysis final : public AdvancedReducer {
  public:
   WasmEscapeAnalysis(Editor* editor, MachineGraph* mcgraph)
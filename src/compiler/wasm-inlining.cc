@@ -151,8 +151,7 @@ void WasmInliner::Finalize() {
     }
 
     size_t additional_nodes = graph()->NodeCount() - subgraph_min_node_id;
-    if (current_graph_size_ + additional_nodes >
-        size_limit(initial_graph_size_)) {
+    if (current_graph_size_ + additional_nodes > InliningBudget(candidate)) {
       // This is not based on the accurate graph size, as it may have been
       // shrunk by other optimizations. We could recompute the accurate size
       // with a traversal, but it is most probably not worth the time.
@@ -172,6 +171,21 @@ void WasmInliner::Finalize() {
   }
 }
 
+size_t WasmInliner::InliningBudget(const CandidateInfo& candidate) const {
+  size_t limit = size_limit(initial_graph_size_);
+  int hot_call_count = std::max(FLAG_wasm_inlining_hot_call_count, 1);
+  if (!candidate.is_speculative_call_ref ||
+      candidate.call_count < hot_call_count) {
+    return limit;
+  }
+  // The budget grows linearly with the call count: a call site that was
+  // executed n times {hot_call_count} times gets n times the regular budget.
+  size_t factor =
+      std::min(kMaxHotBudgetFactor,
+               static_cast<size_t>(candidate.call_count / hot_call_count));
+  return initial_graph_size_ + (limit - initial_graph_size_) * factor;
+}
+
 /* Rewire callee formal parameters to the call-site real parameters. Rewire
  * effect and control dependencies of callee's start node with the respective
  * inputs of the call node.
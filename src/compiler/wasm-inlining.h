@@ -130,6 +130,13 @@ class WasmInliner final : public AdvancedReducer {
   // (start, instance parameter, end).
   static constexpr size_t kMinimumFunctionNodeCount = 3;
 
+  // Hot speculative call sites may use up to this many times the regular
+  // inlining budget, see {InliningBudget}.
+  static constexpr size_t kMaxHotBudgetFactor = 4;
+
+  // The limit to the size of the inlined graph when inlining {candidate}.
+  size_t InliningBudget(const CandidateInfo& candidate) const;
+
   Reduction ReduceCall(Node* call);
   void InlineCall(Node* call, Node* callee_start, Node* callee_end,
                   const wasm::FunctionSig* inlinee_sig,
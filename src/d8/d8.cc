@@ -442,7 +442,7 @@ class ExternalOwningOneByteStringResource
  public:
   ExternalOwningOneByteStringResource() = default;
   ExternalOwningOneByteStringResource(
-      std::unique_ptr<base::OS::MemoryMappedFile> file)
+      std::shared_ptr<base::OS::MemoryMappedFile> file)
       : file_(std::move(file)) {}
   const char* data() const override {
     return static_cast<char*>(file_->memory());
@@ -450,9 +450,38 @@ class ExternalOwningOneByteStringResource
   size_t length() const override { return file_->size(); }
 
  private:
-  std::unique_ptr<base::OS::MemoryMappedFile> file_;
+  std::shared_ptr<base::OS::MemoryMappedFile> file_;
 };
 
+namespace {
+
+// Read-only mappings of source files that back external strings. Isolates
+// (e.g. workers) loading the same file share a single mapping for as long as
+// any external string refers to it.
+base::LazyMutex mapped_files_mutex = LAZY_MUTEX_INITIALIZER;
+std::unordered_map<std::string, std::weak_ptr<base::OS::MemoryMappedFile>>*
+    mapped_files = nullptr;
+
+std::shared_ptr<base::OS::MemoryMappedFile> OpenSharedMappedFile(
+    const char* name) {
+  base::MutexGuard lock_guard(mapped_files_mutex.Pointer());
+  if (mapped_files == nullptr) {
+    mapped_files = new std::unordered_map<
+        std::string, std::weak_ptr<base::OS::MemoryMappedFile>>();
+  }
+  std::weak_ptr<base::OS::MemoryMappedFile>& entry = (*mapped_files)[name];
+  if (std::shared_ptr<base::OS::MemoryMappedFile> file = entry.lock()) {
+    return file;
+  }
+  std::shared_ptr<base::OS::MemoryMappedFile> file(
+      base::OS::MemoryMappedFile::open(
+          name, base::OS::MemoryMappedFile::FileMode::kReadOnly));
+  entry = file;
+  return file;
+}
+
+}  // namespace
+
 CounterMap* Shell::counter_map_;
 base::OS::MemoryMappedFile* Shell::counters_file_ = nullptr;
 CounterCollection Shell::local_counters_;
@@ -3532,9 +3561,12 @@ void Shell::ReadBuffer(const v8::FunctionCallbackInfo<v8::Value>& args) {
 // Reads a file into a v8 string.
 Local<String> Shell::ReadFile(Isolate* isolate, const char* name,
                               bool should_throw) {
-  std::unique_ptr<base::OS::MemoryMappedFile> file(
-      base::OS::MemoryMappedFile::open(
-          name, base::OS::MemoryMappedFile::FileMode::kReadOnly));
+  std::shared_ptr<base::OS::MemoryMappedFile> file =
+      i::FLAG_use_external_strings
+          ? OpenSharedMappedFile(name)
+          : std::shared_ptr<base::OS::MemoryMappedFile>(
+                base::OS::MemoryMappedFile::open(
+                    name, base::OS::MemoryMappedFile::FileMode::kReadOnly));
   if (!file) {
     if (should_throw) {
       std::ostringstream oss;
@@ -3914,6 +3946,173 @@ void SourceGroup::JoinThread() {
   thread_->Join();
 }
 
+namespace {
+
+// Measurements of one isolate in --throughput-isolates mode.
+struct ThroughputStats {
+  std::vector<double> latencies_ms;
+  std::vector<double> gc_pauses_ms;
+  base::TimeTicks gc_start;
+  double wall_ms = 0;
+  double cpu_ms = 0;
+  bool success = true;
+};
+
+void ThroughputGCPrologue(Isolate* isolate, GCType type, GCCallbackFlags flags,
+                          void* data) {
+  static_cast<ThroughputStats*>(data)->gc_start = base::TimeTicks::Now();
+}
+
+void ThroughputGCEpilogue(Isolate* isolate, GCType type, GCCallbackFlags flags,
+                          void* data) {
+  ThroughputStats* stats = static_cast<ThroughputStats*>(data);
+  stats->gc_pauses_ms.push_back(
+      (base::TimeTicks::Now() - stats->gc_start).InMillisecondsF());
+}
+
+// Runs the main source group --throughput-iterations times in a fresh
+// isolate, with a new context for every iteration. All threads create their
+// isolates first and then start iterating at the same time.
+class ThroughputThread : public base::Thread {
+ public:
+  ThroughputThread(ThroughputStats* stats, base::Semaphore* ready,
+                   base::Semaphore* start)
+      : base::Thread(GetThreadOptions("ThroughputThread")),
+        stats_(stats),
+        ready_(ready),
+        start_(start) {}
+
+  void Run() override {
+    Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator = Shell::array_buffer_allocator;
+    create_params.experimental_attach_to_shared_isolate =
+        Shell::shared_isolate;
+    Isolate* isolate = Isolate::New(create_params);
+    Shell::SetWaitUntilDone(isolate, false);
+    D8Console console(isolate);
+    Shell::Initialize(isolate, &console, false);
+    isolate->AddGCPrologueCallback(ThroughputGCPrologue, stats_);
+    isolate->AddGCEpilogueCallback(ThroughputGCEpilogue, stats_);
+    {
+      Isolate::Scope iscope(isolate);
+      PerIsolateData data(isolate);
+      ready_->Signal();
+      start_->Wait();
+
+      base::TimeTicks wall_start = base::TimeTicks::Now();
+      bool measure_cpu = base::ThreadTicks::IsSupported();
+      base::ThreadTicks cpu_start;
+      if (measure_cpu) cpu_start = base::ThreadTicks::Now();
+      for (int i = 0; i < Shell::options.throughput_iterations; ++i) {
+        base::TimeTicks start = base::TimeTicks::Now();
+        {
+          HandleScope scope(isolate);
+          Local<Context> context = Shell::CreateEvaluationContext(isolate);
+          {
+            Context::Scope cscope(context);
+            PerIsolateData::RealmScope realm_scope(
+                PerIsolateData::Get(isolate));
+            if (!Shell::options.isolate_sources[0].Execute(isolate)) {
+              stats_->success = false;
+            }
+            if (!Shell::CompleteMessageLoop(isolate)) stats_->success = false;
+          }
+          DisposeModuleEmbedderData(context);
+        }
+        stats_->latencies_ms.push_back(
+            (base::TimeTicks::Now() - start).InMillisecondsF());
+      }
+      stats_->wall_ms = (base::TimeTicks::Now() - wall_start).InMillisecondsF();
+      if (measure_cpu) {
+        stats_->cpu_ms =
+            (base::ThreadTicks::Now() - cpu_start).InMillisecondsF();
+      }
+    }
+    isolate->Dispose();
+  }
+
+ private:
+  ThroughputStats* stats_;
+  base::Semaphore* ready_;
+  base::Semaphore* start_;
+};
+
+// Returns the |percentile| of the sorted |values|.
+double Percentile(const std::vector<double>& values, double percentile) {
+  if (values.empty()) return 0;
+  size_t index = static_cast<size_t>(percentile / 100 * (values.size() - 1));
+  return values[index];
+}
+
+void PrintLatencies(const char* name, std::vector<double> latencies_ms) {
+  std::sort(latencies_ms.begin(), latencies_ms.end());
+  printf("%s: latency ms min %.3f p50 %.3f p90 %.3f p99 %.3f max %.3f\n",
+         name, Percentile(latencies_ms, 0), Percentile(latencies_ms, 50),
+         Percentile(latencies_ms, 90), Percentile(latencies_ms, 99),
+         Percentile(latencies_ms, 100));
+}
+
+}  // namespace
+
+int Shell::RunThroughputBenchmark() {
+  int num_threads = options.throughput_isolates;
+  std::vector<ThroughputStats> stats(num_threads);
+  std::vector<std::unique_ptr<ThroughputThread>> threads;
+  base::Semaphore ready(0);
+  base::Semaphore start(0);
+  for (int i = 0; i < num_threads; ++i) {
+    threads.push_back(
+        std::make_unique<ThroughputThread>(&stats[i], &ready, &start));
+    CHECK(threads.back()->Start());
+  }
+  for (int i = 0; i < num_threads; ++i) ready.Wait();
+  base::TimeTicks wall_start = base::TimeTicks::Now();
+  for (int i = 0; i < num_threads; ++i) start.Signal();
+  for (auto& thread : threads) thread->Join();
+  double wall_ms = (base::TimeTicks::Now() - wall_start).InMillisecondsF();
+
+  bool success = true;
+  std::vector<double> all_latencies_ms;
+  for (int i = 0; i < num_threads; ++i) {
+    const ThroughputStats& s = stats[i];
+    success &= s.success;
+    all_latencies_ms.insert(all_latencies_ms.end(), s.latencies_ms.begin(),
+                            s.latencies_ms.end());
+    std::string name = "isolate " + std::to_string(i);
+    PrintLatencies(name.c_str(), s.latencies_ms);
+    double gc_total_ms = 0;
+    double gc_max_ms = 0;
+    for (double pause : s.gc_pauses_ms) {
+      gc_total_ms += pause;
+      gc_max_ms = std::max(gc_max_ms, pause);
+    }
+    printf("%s: %zu gc pauses total %.3f ms max %.3f ms\n", name.c_str(),
+           s.gc_pauses_ms.size(), gc_total_ms, gc_max_ms);
+    // Time spent off the CPU, e.g. waiting for locks shared with the other
+    // isolates, shows as a utilization below 100%.
+    if (base::ThreadTicks::IsSupported() && s.wall_ms > 0) {
+      printf("%s: cpu %.3f ms of %.3f ms wall (%.1f%%)\n", name.c_str(),
+             s.cpu_ms, s.wall_ms, 100 * s.cpu_ms / s.wall_ms);
+    }
+  }
+
+  PrintLatencies("all", all_latencies_ms);
+  // Histogram of all latencies in power-of-two buckets of milliseconds.
+  std::map<int, int> histogram;
+  for (double latency : all_latencies_ms) {
+    int bucket = 0;
+    while ((1 << bucket) < latency && bucket < 30) bucket++;
+    histogram[bucket]++;
+  }
+  for (auto& entry : histogram) {
+    printf("all: latency <= %d ms: %d\n", 1 << entry.first, entry.second);
+  }
+  printf("all: %zu iterations on %d isolates in %.3f ms (%.1f iterations/s)\n",
+         all_latencies_ms.size(), num_threads, wall_ms,
+         wall_ms > 0 ? 1000 * all_latencies_ms.size() / wall_ms : 0);
+  return success ? 0 : 1;
+}
+
 void SerializationDataQueue::Enqueue(std::unique_ptr<SerializationData> data) {
   base::MutexGuard lock_guard(&mutex_);
   data_.push_back(std::move(data));
@@ -4382,6 +4581,12 @@ bool Shell::SetOptions(int argc, char* argv[]) {
     } else if (strncmp(argv[i], "--repeat-compile=", 17) == 0) {
       options.repeat_compile = atoi(argv[i] + 17);
       argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--throughput-isolates=", 22) == 0) {
+      options.throughput_isolates = atoi(argv[i] + 22);
+      argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--throughput-iterations=", 24) == 0) {
+      options.throughput_iterations = atoi(argv[i] + 24);
+      argv[i] = nullptr;
 #ifdef V8_FUZZILLI
     } else if (strcmp(argv[i], "--no-fuzzilli-enable-builtins-coverage") == 0) {
       options.fuzzilli_enable_builtins_coverage = false;
@@ -5223,6 +5428,8 @@ int Shell::Main(int argc, char* argv[]) {
           bool last_run = i == options.stress_runs - 1;
           result = RunMain(isolate, last_run);
         }
+      } else if (options.throughput_isolates > 0) {
+        result = RunThroughputBenchmark();
       } else if (options.code_cache_options !=
                  ShellOptions::CodeCacheOptions::kNoProduceCache) {
         printf("============ Run: Produce code cache ============\n");
@@ -442,6 +442,10 @@ class ShellOptions {
       "experimental-d8-web-snapshot-api", false};
   DisallowReassignment<bool> compile_only = {"compile-only", false};
   DisallowReassignment<int> repeat_compile = {"repeat-compile", 1};
+  // Runs the main scripts in this many new isolates concurrently instead.
+  DisallowReassignment<int> throughput_isolates = {"throughput-isolates", 0};
+  DisallowReassignment<int> throughput_iterations = {"throughput-iterations",
+                                                     10};
 #if V8_ENABLE_WEBASSEMBLY
   DisallowReassignment<bool> wasm_trap_handler = {"wasm-trap-handler", true};
 #endif  // V8_ENABLE_WEBASSEMBLY
@@ -476,6 +480,7 @@ class Shell : public i::AllStatic {
                                                  const char* name);
   static Local<Context> CreateEvaluationContext(Isolate* isolate);
   static int RunMain(Isolate* isolate, bool last_run);
+  static int RunThroughputBenchmark();
   static int Main(int argc, char* argv[]);
   static void Exit(int exit_code);
   static void OnExit(Isolate* isolate);
@@ -394,6 +394,7 @@ bool IsBlockMode(debug::CoverageMode mode) {
   switch (mode) {
     case debug::CoverageMode::kBlockBinary:
     case debug::CoverageMode::kBlockCount:
+    case debug::CoverageMode::kSampledBlockCount:
       return true;
     default:
       return false;
@@ -522,6 +523,10 @@ void CollectAndMaybeResetCounts(Isolate* isolate,
       }
       break;
     }
+    case v8::debug::CoverageMode::kSampledBlockCount:
+      // Function counts come from the function-scope block counters.
+      if (coverage_mode == v8::debug::CoverageMode::kSampledBlockCount) break;
+      V8_FALLTHROUGH;
     case v8::debug::CoverageMode::kBestEffort: {
       DCHECK(!isolate->factory()
                   ->feedback_vectors_for_profiling_tools()
@@ -692,6 +697,7 @@ std::unique_ptr<Coverage> Coverage::Collect(
         switch (collectionMode) {
           case v8::debug::CoverageMode::kBlockCount:
           case v8::debug::CoverageMode::kPreciseCount:
+          case v8::debug::CoverageMode::kSampledBlockCount:
             break;
           case v8::debug::CoverageMode::kBlockBinary:
           case v8::debug::CoverageMode::kPreciseBinary:
@@ -712,7 +718,11 @@ std::unique_ptr<Coverage> Coverage::Collect(
       }
 
       // Only include a function range if itself or its parent function is
-      // covered, or if it contains non-trivial block coverage.
+      // covered, or if it contains non-trivial block coverage. Sampled block
+      // coverage has no invocation counts, only the function-scope counter.
+      if (collectionMode == v8::debug::CoverageMode::kSampledBlockCount) {
+        count = function.count;
+      }
       bool is_covered = (count != 0);
       bool parent_is_covered =
           (!nesting.empty() && functions->at(nesting.back()).count != 0);
@@ -765,6 +775,15 @@ void Coverage::SelectMode(Isolate* isolate, debug::CoverageMode mode) {
             ReadOnlyRoots(isolate).undefined_value());
       }
       break;
+    case debug::CoverageMode::kSampledBlockCount:
+      // Optimized code and inlining stay enabled: the block counters are
+      // incremented by all tiers, and no invocation counts are needed. Only
+      // functions compiled from now on get counters.
+      if (!isolate->is_collecting_type_profile()) {
+        isolate->SetFeedbackVectorsForProfilingTools(
+            ReadOnlyRoots(isolate).undefined_value());
+      }
+      break;
     case debug::CoverageMode::kBlockBinary:
     case debug::CoverageMode::kBlockCount:
     case debug::CoverageMode::kPreciseBinary:
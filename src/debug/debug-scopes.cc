@@ -783,6 +783,13 @@ bool ScopeIterator::VisitContextLocals(const Visitor& visitor,
   return false;
 }
 
+bool ScopeIterator::IsElidedArguments(Variable* var,
+                                      Handle<Object> value) const {
+  // The bytecode generator doesn't allocate an arguments object that is only
+  // loaded from, so its register stays undefined.
+  return var->maybe_assigned() == kNotAssigned && value->IsUndefined(isolate_);
+}
+
 bool ScopeIterator::VisitLocals(const Visitor& visitor, Mode mode,
                                 ScopeType scope_type) const {
   if (mode == Mode::STACK && current_scope_->is_declaration_scope() &&
@@ -861,7 +868,8 @@ bool ScopeIterator::VisitLocals(const Visitor& visitor, Mode mode,
           value = handle(parameters_and_registers.get(index), isolate_);
         } else {
           value = frame_inspector_->GetExpression(index);
-          if (value->IsOptimizedOut(isolate_)) {
+          if (value->IsOptimizedOut(isolate_) ||
+              IsElidedArguments(var, value)) {
             // We'll rematerialize this later.
             if (current_scope_->is_declaration_scope() &&
                 current_scope_->AsDeclarationScope()->arguments() == var) {
@@ -925,6 +933,9 @@ void ScopeIterator::VisitLocalScope(const Visitor& visitor, Mode mode,
       // FunctionGetArguments does.
       if (frame_inspector_ != nullptr && !closure_scope_->is_arrow_scope() &&
           (closure_scope_->arguments() == nullptr ||
+           IsElidedArguments(closure_scope_->arguments(),
+                             frame_inspector_->GetExpression(
+                                 closure_scope_->arguments()->index())) ||
            frame_inspector_->GetExpression(closure_scope_->arguments()->index())
                ->IsOptimizedOut(isolate_))) {
         JavaScriptFrame* frame = GetFrame();
@@ -1095,6 +1106,10 @@ bool ScopeIterator::SetScriptVariableValue(Handle<String> variable_name,
                                  &lookup_result)) {
     Handle<Context> script_context = ScriptContextTable::GetContext(
         isolate_, script_contexts, lookup_result.context_index);
+    if (FLAG_const_tracking_let) {
+      context_->native_context().InvalidateConstTrackingLet(
+          lookup_result.context_index, lookup_result.slot_index);
+    }
     script_context->set(lookup_result.slot_index, *new_value);
     return true;
   }
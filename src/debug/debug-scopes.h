@@ -14,6 +14,7 @@ namespace internal {
 
 class JavaScriptFrame;
 class ParseInfo;
+class Variable;
 
 // Iterate over the actual scopes visible from a stack frame or from a closure.
 // The iteration proceeds from the innermost visible nested scope outwards.
@@ -165,6 +166,7 @@ class ScopeIterator {
   void VisitModuleScope(const Visitor& visitor) const;
   bool VisitLocals(const Visitor& visitor, Mode mode,
                    ScopeType scope_type) const;
+  bool IsElidedArguments(Variable* var, Handle<Object> value) const;
   bool VisitContextLocals(const Visitor& visitor, Handle<ScopeInfo> scope_info,
                           Handle<Context> context, ScopeType scope_type) const;
 
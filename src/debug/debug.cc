@@ -1371,9 +1371,9 @@ void Debug::DiscardAllBaselineCode() {
 void Debug::DeoptimizeFunction(Handle<SharedFunctionInfo> shared) {
   RCS_SCOPE(isolate_, RuntimeCallCounterId::kDebugger);
   // Deoptimize all code compiled from this shared function info including
-  // inlining.
-  isolate_->AbortConcurrentOptimization(BlockingBehavior::kBlock);
-
+  // inlining. Concurrent jobs are not aborted: a job that compiled or inlined
+  // this function is discarded when it is finalized, see
+  // PipelineCompilationJob::FinalizeJobImpl, and all others may finish.
   if (shared->HasBaselineCode()) {
     DiscardBaselineCode(*shared);
   }
@@ -79,6 +79,11 @@ enum class CoverageMode {
   // lower granularity. Design doc: goo.gl/lA2swZ.
   kBlockCount,
   kBlockBinary,
+  // Block counts for always-on coverage sampling. Unlike kBlockCount, this
+  // neither deoptimizes nor keeps feedback vectors alive: function counts are
+  // taken from the function-scope block counter, which is also incremented by
+  // optimized and inlined code. Collecting resets the counters.
+  kSampledBlockCount,
 };
 
 enum class TypeProfileMode {
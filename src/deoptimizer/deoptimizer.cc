@@ -16,6 +16,7 @@
 #include "src/execution/v8threads.h"
 #include "src/handles/handles-inl.h"
 #include "src/heap/heap-inl.h"
+#include "src/logging/counters-scopes.h"
 #include "src/logging/counters.h"
 #include "src/logging/log.h"
 #include "src/logging/runtime-call-stats-scope.h"
@@ -372,9 +373,16 @@ void Deoptimizer::DeoptimizeMarkedCodeForContext(NativeContext native_context) {
 
   // If there's no activation of a code in any stack then we can remove its
   // deoptimization data. We do this to ensure that code objects that are
-  // unlinked don't transitively keep objects alive unnecessarily.
-  for (Code code : codes) {
-    isolate->heap()->InvalidateCodeDeoptimizationData(code);
+  // unlinked don't transitively keep objects alive unnecessarily. Each code
+  // page is made writable once for all of its code objects.
+  {
+    CodePageCollectionMemoryModificationScope modification_scope(
+        isolate->heap());
+    for (Code code : codes) {
+      isolate->heap()->UnprotectAndRegisterMemoryChunk(
+          code, UnprotectMemoryOrigin::kMainThread);
+      isolate->heap()->InvalidateCodeDeoptimizationData(code);
+    }
   }
 
   native_context.GetOSROptimizedCodeCache().EvictMarkedCode(
@@ -477,6 +485,10 @@ const char* Deoptimizer::MessageFor(DeoptimizeKind kind, bool reuse_code) {
   }
 }
 
+DeoptimizeReason Deoptimizer::deopt_reason() const {
+  return GetDeoptInfo(compiled_code_, from_).deopt_reason;
+}
+
 Deoptimizer::Deoptimizer(Isolate* isolate, JSFunction function,
                          DeoptimizeKind kind, unsigned deopt_exit_index,
                          Address from, int fp_to_sp_delta)
@@ -524,6 +536,11 @@ Deoptimizer::Deoptimizer(Isolate* isolate, JSFunction function,
     isolate->counters()->soft_deopts_executed()->Increment();
   }
   compiled_code_.set_deopt_already_counted(true);
+  if (deopt_kind_ != DeoptimizeKind::kLazy) {
+    // The optimized code made assumptions that no longer hold; do not let a
+    // stale hint drive the function back into TurboFan early.
+    function.shared().set_has_optimization_hint(false);
+  }
   {
     HandleScope scope(isolate_);
     PROFILE(isolate_,
@@ -844,6 +861,9 @@ void Deoptimizer::DoComputeOutputFrames() {
   DCHECK_EQ(0, isolate()->isolate_data()->stack_is_iterable());
 #endif
   base::ElapsedTimer timer;
+  // No isolate is passed, the stack is not iterable for logging callbacks.
+  TimedHistogramScope histogram_timer(
+      isolate()->counters()->deoptimize_compute_output_frames());
 
   // Determine basic deoptimization information.  The optimized frame is
   // described by the input data.
@@ -1618,6 +1638,10 @@ TranslatedValue Deoptimizer::TranslatedValueForWasmReturnKind(
         return TranslatedValue::NewDouble(
             &translated_state_,
             input_->GetDoubleRegister(wasm::kFpReturnRegisters[0].code()));
+      case wasm::kOptRef:
+        return TranslatedValue::NewTagged(
+            &translated_state_,
+            Object(input_->GetRegister(kReturnRegister0.code())));
       default:
         UNREACHABLE();
     }
@@ -1988,6 +2012,8 @@ void Deoptimizer::DoComputeBuiltinContinuation(
 }
 
 void Deoptimizer::MaterializeHeapObjects() {
+  TimedHistogramScope histogram_timer(
+      isolate()->counters()->deoptimize_materialize_objects(), isolate());
   translated_state_.Prepare(static_cast<Address>(stack_fp_));
   if (FLAG_deopt_every_n_times > 0) {
     // Doing a GC here will find problems with the deoptimized frames.
@@ -54,6 +54,7 @@ class Deoptimizer : public Malloced {
   Handle<JSFunction> function() const;
   Handle<Code> compiled_code() const;
   DeoptimizeKind deopt_kind() const { return deopt_kind_; }
+  DeoptimizeReason deopt_reason() const;
 
   bool should_reuse_code() const;
 
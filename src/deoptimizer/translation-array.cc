@@ -4,6 +4,9 @@
 
 #include "src/deoptimizer/translation-array.h"
 
+#include <algorithm>
+
+#include "src/base/functional.h"
 #include "src/base/vlq.h"
 #include "src/deoptimizer/translated-state.h"
 #include "src/objects/fixed-array-inl.h"
@@ -72,6 +75,37 @@ void TranslationArrayBuilder::Add(int32_t value) {
   }
 }
 
+int TranslationArrayBuilder::FinishTranslation(int start_index) {
+  if (!FLAG_turbo_share_translations) return start_index;
+  if (V8_UNLIKELY(FLAG_turbo_compress_translation_arrays)) {
+    return ShareTranslation(&contents_for_compression_, start_index);
+  }
+  return ShareTranslation(&contents_, start_index);
+}
+
+template <typename T>
+int TranslationArrayBuilder::ShareTranslation(ZoneVector<T>* contents,
+                                              int start_index) {
+  auto begin = contents->begin() + start_index;
+  size_t hash = base::hash_range(begin, contents->end());
+  auto it = translations_by_hash_.find(hash);
+  if (it == translations_by_hash_.end()) {
+    translations_by_hash_.emplace(hash, start_index);
+    return start_index;
+  }
+  // Translations are self-delimiting, so an equal sequence of values
+  // describes the same frames. The existing translation must end before the
+  // new one begins, since the latter is removed again.
+  int existing_index = it->second;
+  int length = static_cast<int>(contents->size()) - start_index;
+  if (existing_index + length <= start_index &&
+      std::equal(begin, contents->end(), contents->begin() + existing_index)) {
+    contents->resize(start_index);
+    return existing_index;
+  }
+  return start_index;
+}
+
 Handle<TranslationArray> TranslationArrayBuilder::ToTranslationArray(
     Factory* factory) {
   if (V8_UNLIKELY(FLAG_turbo_compress_translation_arrays)) {
@@ -47,7 +47,10 @@ class TranslationArrayIterator {
 class TranslationArrayBuilder {
  public:
   explicit TranslationArrayBuilder(Zone* zone)
-      : contents_(zone), contents_for_compression_(zone), zone_(zone) {}
+      : contents_(zone),
+        contents_for_compression_(zone),
+        translations_by_hash_(zone),
+        zone_(zone) {}
 
   Handle<TranslationArray> ToTranslationArray(Factory* factory);
 
@@ -63,6 +66,11 @@ class TranslationArrayBuilder {
     return start_index;
   }
 
+  // Ends the translation that begins at {start_index}. If an identical
+  // translation was added before, the new one is dropped again and the index
+  // of the existing one is returned instead.
+  int FinishTranslation(int start_index);
+
   void BeginInterpretedFrame(BytecodeOffset bytecode_offset, int literal_id,
                              unsigned height, int return_value_offset,
                              int return_value_count);
@@ -106,6 +114,9 @@ class TranslationArrayBuilder {
   void Add(int32_t value);
   void Add(TranslationOpcode opcode) { Add(static_cast<int32_t>(opcode)); }
 
+  template <typename T>
+  int ShareTranslation(ZoneVector<T>* contents, int start_index);
+
   int Size() const {
     return V8_UNLIKELY(FLAG_turbo_compress_translation_arrays)
                ? static_cast<int>(contents_for_compression_.size())
@@ -121,6 +132,8 @@ class TranslationArrayBuilder {
 
   ZoneVector<uint8_t> contents_;
   ZoneVector<int32_t> contents_for_compression_;
+  // The start index of the first translation with a given hash.
+  ZoneUnorderedMap<size_t, int> translations_by_hash_;
   Zone* const zone_;
 };
 
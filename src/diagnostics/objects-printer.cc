@@ -2261,6 +2261,7 @@ void JSRelativeTimeFormat::JSRelativeTimeFormatPrint(std::ostream& os) {
 void JSSegmentIterator::JSSegmentIteratorPrint(std::ostream& os) {
   JSObjectPrintHeader(os, *this, "JSSegmentIterator");
   os << "\n - icu break iterator: " << Brief(icu_break_iterator());
+  os << "\n - raw string: " << Brief(raw_string());
   os << "\n - granularity: " << GranularityAsString(GetIsolate());
   os << "\n";
 }
@@ -2277,6 +2278,7 @@ void JSSegments::JSSegmentsPrint(std::ostream& os) {
   JSObjectPrintHeader(os, *this, "JSSegments");
   os << "\n - icu break iterator: " << Brief(icu_break_iterator());
   os << "\n - unicode string: " << Brief(unicode_string());
+  os << "\n - raw string: " << Brief(raw_string());
   os << "\n - granularity: " << GranularityAsString(GetIsolate());
   JSObjectPrintBody(os, *this);
 }
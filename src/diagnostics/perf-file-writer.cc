@@ -0,0 +1,92 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/diagnostics/perf-file-writer.h"
+
+#if V8_OS_LINUX
+
+#include "src/base/platform/platform.h"
+#include "src/base/platform/time.h"
+
+namespace v8 {
+namespace internal {
+
+class PerfFileWriter::WriterThread : public base::Thread {
+ public:
+  static const int kWriterThreadStackSize = 64 * KB;
+
+  explicit WriterThread(PerfFileWriter* writer)
+      : base::Thread(
+            base::Thread::Options("PerfFileWriter", kWriterThreadStackSize)),
+        writer_(writer) {}
+
+  void Run() override { writer_->RunWriter(); }
+
+ private:
+  PerfFileWriter* const writer_;
+};
+
+PerfFileWriter::PerfFileWriter(FILE* file, bool async) : file_(file) {
+  if (!async) return;
+  thread_ = std::make_unique<WriterThread>(this);
+  if (!thread_->Start()) thread_.reset();
+}
+
+PerfFileWriter::~PerfFileWriter() {
+  if (thread_) {
+    {
+      base::MutexGuard guard(&mutex_);
+      stopping_ = true;
+      cv_.NotifyAll();
+    }
+    // The background thread writes the remaining records before it exits.
+    thread_->Join();
+  }
+  fflush(file_);
+}
+
+void PerfFileWriter::Write(const char* bytes, size_t size) {
+  if (!thread_) {
+    WriteToFile(bytes, size);
+    return;
+  }
+  base::MutexGuard guard(&mutex_);
+  while (buffer_.size() >= kMaxPendingSize) cv_.Wait(&mutex_);
+  buffer_.insert(buffer_.end(), bytes, bytes + size);
+  if (buffer_.size() >= kFlushSize) cv_.NotifyAll();
+}
+
+void PerfFileWriter::RunWriter() {
+  std::vector<char> batch;
+  while (true) {
+    {
+      base::MutexGuard guard(&mutex_);
+      while (!stopping_ && buffer_.size() < kFlushSize) {
+        if (!cv_.WaitFor(&mutex_, base::TimeDelta::FromMilliseconds(
+                                      kFlushIntervalMs))) {
+          break;
+        }
+      }
+      if (stopping_ && buffer_.empty()) return;
+      batch.swap(buffer_);
+      // Wake up writers that wait for the pending records to shrink.
+      cv_.NotifyAll();
+    }
+    if (batch.empty()) continue;
+    WriteToFile(batch.data(), batch.size());
+    fflush(file_);
+    batch.clear();
+  }
+}
+
+void PerfFileWriter::WriteToFile(const char* bytes, size_t size) {
+  size_t rv = fwrite(bytes, 1, size, file_);
+  DCHECK_EQ(size, rv);
+  USE(rv);
+}
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_OS_LINUX
@@ -0,0 +1,66 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_DIAGNOSTICS_PERF_FILE_WRITER_H_
+#define V8_DIAGNOSTICS_PERF_FILE_WRITER_H_
+
+#include "include/v8config.h"
+
+// {PerfFileWriter} is only used by the Linux perf loggers.
+#if V8_OS_LINUX
+
+#include <stdio.h>
+
+#include <memory>
+#include <vector>
+
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
+#include "src/common/globals.h"
+
+namespace v8 {
+namespace internal {
+
+// Writes the perf map and jitdump files. With |async|, the records are
+// buffered and written by a background thread, so that code creation on the
+// main thread does not block on file I/O. The file is flushed whenever a
+// batch is written, at least every kFlushIntervalMs.
+class PerfFileWriter {
+ public:
+  // The caller keeps ownership of |file|, which must outlive the writer.
+  PerfFileWriter(FILE* file, bool async);
+  ~PerfFileWriter();
+  PerfFileWriter(const PerfFileWriter&) = delete;
+  PerfFileWriter& operator=(const PerfFileWriter&) = delete;
+
+  void Write(const char* bytes, size_t size);
+
+ private:
+  class WriterThread;
+
+  // A batch is handed to the background thread once it reaches kFlushSize.
+  // Writers block while kMaxPendingSize bytes are waiting to be written.
+  static const size_t kFlushSize = 1 * MB;
+  static const size_t kMaxPendingSize = 64 * MB;
+  static constexpr int kFlushIntervalMs = 100;
+
+  void RunWriter();
+  void WriteToFile(const char* bytes, size_t size);
+
+  FILE* const file_;
+  std::unique_ptr<WriterThread> thread_;
+
+  // Guards the state shared with the background thread.
+  base::Mutex mutex_;
+  base::ConditionVariable cv_;
+  std::vector<char> buffer_;
+  bool stopping_ = false;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_OS_LINUX
+
+#endif  // V8_DIAGNOSTICS_PERF_FILE_WRITER_H_
@@ -37,15 +37,18 @@
 #include <unistd.h>
 
 #include <memory>
+#include <sstream>
 
+#include "src/base/optional.h"
 #include "src/base/platform/wrappers.h"
+#include "src/baseline/bytecode-offset-iterator.h"
 #include "src/codegen/assembler.h"
 #include "src/codegen/source-position-table.h"
 #include "src/diagnostics/eh-frame.h"
+#include "src/diagnostics/perf-file-writer.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/shared-function-info.h"
 #include "src/snapshot/embedded/embedded-data.h"
-#include "src/utils/ostreams.h"
 
 #if V8_ENABLE_WEBASSEMBLY
 #include "src/wasm/wasm-code-manager.h"
@@ -91,6 +94,16 @@ struct PerfJitCodeLoad : PerfJitBase {
   uint64_t code_id_;
 };
 
+struct PerfJitCodeMove : PerfJitBase {
+  uint32_t process_id_;
+  uint32_t thread_id_;
+  uint64_t vma_;
+  uint64_t old_code_address_;
+  uint64_t new_code_address_;
+  uint64_t code_size_;
+  uint64_t code_id_;
+};
+
 struct PerfJitDebugEntry {
   uint64_t address_;
   int line_number_;
@@ -124,6 +137,8 @@ uint64_t PerfJitLogger::reference_count_ = 0;
 void* PerfJitLogger::marker_address_ = nullptr;
 uint64_t PerfJitLogger::code_index_ = 0;
 FILE* PerfJitLogger::perf_output_handle_ = nullptr;
+PerfFileWriter* PerfJitLogger::perf_output_writer_ = nullptr;
+std::unordered_map<Address, uint64_t>* PerfJitLogger::code_ids_ = nullptr;
 
 void PerfJitLogger::OpenJitDumpFile() {
   // Open the perf JIT dump file.
@@ -150,10 +165,17 @@ void PerfJitLogger::OpenJitDumpFile() {
   if (perf_output_handle_ == nullptr) return;
 
   setvbuf(perf_output_handle_, nullptr, _IOFBF, kLogBufferSize);
+  perf_output_writer_ =
+      new PerfFileWriter(perf_output_handle_, FLAG_perf_prof_async_writer);
+  code_ids_ = new std::unordered_map<Address, uint64_t>();
 }
 
 void PerfJitLogger::CloseJitDumpFile() {
   if (perf_output_handle_ == nullptr) return;
+  delete perf_output_writer_;
+  perf_output_writer_ = nullptr;
+  delete code_ids_;
+  code_ids_ = nullptr;
   base::Fclose(perf_output_handle_);
   perf_output_handle_ = nullptr;
 }
@@ -245,8 +267,9 @@ void PerfJitLogger::LogRecordedBuffer(
   // Unwinding info comes right after debug info.
   if (FLAG_perf_prof_unwinding_info) LogWriteUnwindingInfo(*code);
 
-  WriteJitCodeLoadEntry(code_pointer, code->InstructionSize(), code_name,
-                        length);
+  uint64_t code_id = WriteJitCodeLoadEntry(
+      code_pointer, code->InstructionSize(), code_name, length);
+  (*code_ids_)[code->InstructionStart()] = code_id;
 }
 
 #if V8_ENABLE_WEBASSEMBLY
@@ -265,9 +288,10 @@ void PerfJitLogger::LogRecordedBuffer(const wasm::WasmCode* code,
 }
 #endif  // V8_ENABLE_WEBASSEMBLY
 
-void PerfJitLogger::WriteJitCodeLoadEntry(const uint8_t* code_pointer,
-                                          uint32_t code_size, const char* name,
-                                          int name_length) {
+uint64_t PerfJitLogger::WriteJitCodeLoadEntry(const uint8_t* code_pointer,
+                                              uint32_t code_size,
+                                              const char* name,
+                                              int name_length) {
   PerfJitCodeLoad code_load;
   code_load.event_ = PerfJitCodeLoad::kLoad;
   code_load.size_ = sizeof(code_load) + name_length + 1 + code_size;
@@ -286,6 +310,25 @@ void PerfJitLogger::WriteJitCodeLoadEntry(const uint8_t* code_pointer,
   LogWriteBytes(name, name_length);
   LogWriteBytes(kStringTerminator, 1);
   LogWriteBytes(reinterpret_cast<const char*>(code_pointer), code_size);
+  return code_load.code_id_;
+}
+
+void PerfJitLogger::WriteJitCodeMoveEntry(Address from, Address to,
+                                          uint32_t code_size,
+                                          uint64_t code_id) {
+  PerfJitCodeMove code_move;
+  code_move.event_ = PerfJitCodeMove::kMove;
+  code_move.size_ = sizeof(code_move);
+  code_move.time_stamp_ = GetTimestamp();
+  code_move.process_id_ =
+      static_cast<uint32_t>(base::OS::GetCurrentProcessId());
+  code_move.thread_id_ = static_cast<uint32_t>(base::OS::GetCurrentThreadId());
+  code_move.vma_ = to;
+  code_move.old_code_address_ = from;
+  code_move.new_code_address_ = to;
+  code_move.code_size_ = code_size;
+  code_move.code_id_ = code_id;
+  LogWriteBytes(reinterpret_cast<const char*>(&code_move), sizeof(code_move));
 }
 
 namespace {
@@ -380,16 +423,28 @@ void PerfJitLogger::LogWriteDebugInfo(Handle<Code> code,
   LogWriteBytes(reinterpret_cast<const char*>(&debug_info), sizeof(debug_info));
 
   Address code_start = code->InstructionStart();
+  // Baseline code uses the source positions of its bytecode, whose offsets
+  // are mapped to pc offsets through the bytecode offset table.
+  base::Optional<baseline::BytecodeOffsetIterator> baseline_iterator;
+  if (code->kind() == CodeKind::BASELINE) {
+    baseline_iterator.emplace(ByteArray::cast(code->bytecode_offset_table()),
+                              shared->GetBytecodeArray(isolate_));
+  }
 
   for (SourcePositionTableIterator iterator(source_position_table);
        !iterator.done(); iterator.Advance()) {
     SourcePositionInfo info(
         GetSourcePositionInfo(code, shared, iterator.source_position()));
+    Address code_offset = iterator.code_offset();
+    if (baseline_iterator) {
+      baseline_iterator->AdvanceToBytecodeOffset(iterator.code_offset());
+      code_offset = baseline_iterator->current_pc_start_offset();
+    }
     PerfJitDebugEntry entry;
     // The entry point of the function will be placed straight after the ELF
     // header when processed by "perf inject". Adjust the position addresses
     // accordingly.
-    entry.address_ = code_start + iterator.code_offset() + kElfHeaderSize;
+    entry.address_ = code_start + code_offset + kElfHeaderSize;
     entry.line_number_ = info.line + 1;
     entry.column_ = info.column + 1;
     LogWriteBytes(reinterpret_cast<const char*>(&entry), sizeof(entry));
@@ -501,8 +556,10 @@ void PerfJitLogger::LogWriteUnwindingInfo(Code code) {
     LogWriteBytes(reinterpret_cast<const char*>(code.unwinding_info_start()),
                   code.unwinding_info_size());
   } else {
-    OFStream perf_output_stream(perf_output_handle_);
-    EhFrameWriter::WriteEmptyEhFrame(perf_output_stream);
+    std::ostringstream eh_frame;
+    EhFrameWriter::WriteEmptyEhFrame(eh_frame);
+    std::string bytes = eh_frame.str();
+    LogWriteBytes(bytes.data(), static_cast<int>(bytes.size()));
   }
 
   char padding_bytes[] = "\0\0\0\0\0\0\0\0";
@@ -511,15 +568,27 @@ void PerfJitLogger::LogWriteUnwindingInfo(Code code) {
 }
 
 void PerfJitLogger::CodeMoveEvent(AbstractCode from, AbstractCode to) {
-  // We may receive a CodeMove event if a BytecodeArray object moves. Otherwise
-  // code relocation is not supported.
-  CHECK(from.IsBytecodeArray());
+  // BytecodeArray objects are not logged to the jitdump file. This may be
+  // called from the GC's evacuation tasks.
+  if (!to.IsCode()) return;
+  Address from_start = from.InstructionStart();
+  Address to_start = to.InstructionStart();
+  // The instructions of off-heap trampolines do not move.
+  if (from_start == to_start) return;
+
+  base::LockGuard<base::RecursiveMutex> guard_file(file_mutex_.Pointer());
+
+  if (perf_output_handle_ == nullptr) return;
+  auto it = code_ids_->find(from_start);
+  if (it == code_ids_->end()) return;
+  uint64_t code_id = it->second;
+  code_ids_->erase(it);
+  (*code_ids_)[to_start] = code_id;
+  WriteJitCodeMoveEntry(from_start, to_start, to.InstructionSize(), code_id);
 }
 
 void PerfJitLogger::LogWriteBytes(const char* bytes, int size) {
-  size_t rv = fwrite(bytes, 1, size, perf_output_handle_);
-  DCHECK(static_cast<size_t>(size) == rv);
-  USE(rv);
+  perf_output_writer_->Write(bytes, static_cast<size_t>(size));
 }
 
 void PerfJitLogger::LogWriteHeader() {
@@ -33,11 +33,15 @@
 // {PerfJitLogger} is only implemented on Linux.
 #if V8_OS_LINUX
 
+#include <unordered_map>
+
 #include "src/logging/log.h"
 
 namespace v8 {
 namespace internal {
 
+class PerfFileWriter;
+
 // Linux perf tool logging support.
 class PerfJitLogger : public CodeEventLogger {
  public:
@@ -71,8 +75,12 @@ class PerfJitLogger : public CodeEventLogger {
   // minimize the associated overhead.
   static const int kLogBufferSize = 2 * MB;
 
-  void WriteJitCodeLoadEntry(const uint8_t* code_pointer, uint32_t code_size,
-                             const char* name, int name_length);
+  // Returns the code id of the new entry.
+  uint64_t WriteJitCodeLoadEntry(const uint8_t* code_pointer,
+                                 uint32_t code_size, const char* name,
+                                 int name_length);
+  void WriteJitCodeMoveEntry(Address from, Address to, uint32_t code_size,
+                             uint64_t code_id);
 
   void LogWriteBytes(const char* bytes, int size);
   void LogWriteHeader();
@@ -132,6 +140,10 @@ class PerfJitLogger : public CodeEventLogger {
   // to determine when it goes away, we keep reference count.
   static base::LazyRecursiveMutex file_mutex_;
   static FILE* perf_output_handle_;
+  static PerfFileWriter* perf_output_writer_;
+  // Code ids of the logged code objects by their instruction start, needed
+  // for the records of code moved by the GC.
+  static std::unordered_map<Address, uint64_t>* code_ids_;
   static uint64_t reference_count_;
   static void* marker_address_;
   static uint64_t code_index_;
@@ -259,6 +259,11 @@ MaybeHandle<Context> NewScriptContext(Isolate* isolate,
       ScriptContextTable::Extend(script_context, result);
   native_context->synchronized_set_script_context_table(
       *new_script_context_table);
+  if (FLAG_const_tracking_let) {
+    int context_index = new_script_context_table->used(kAcquireLoad) - 1;
+    NativeContext::AddConstTrackingLetCells(isolate, native_context,
+                                            context_index, result);
+  }
   return result;
 }
 
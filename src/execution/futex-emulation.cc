@@ -4,7 +4,10 @@
 
 #include "src/execution/futex-emulation.h"
 
+#include <atomic>
 #include <limits>
+#include <map>
+#include <unordered_map>
 
 #include "src/api/api-inl.h"
 #include "src/base/logging.h"
@@ -62,6 +65,8 @@ class FutexWaitList {
       if (node->isolate_for_async_waiters_ == isolate) {
         node->timeout_task_id_ = CancelableTaskManager::kInvalidTaskId;
         node = DeleteAsyncWaiterNode(node);
+        // This is only used for location lists.
+        g_num_waiters.fetch_sub(1);
       } else {
         if (new_head == nullptr) {
           new_head = node;
@@ -91,8 +96,9 @@ class FutexWaitList {
     FutexWaitListNode* tail;
   };
   // Location inside a shared buffer -> linked list of Nodes waiting on that
-  // location.
-  std::map<int8_t*, HeadAndTail> location_lists_;
+  // location. Lookups by location are on the path of every wait and notify;
+  // no operation depends on the order of the locations.
+  std::unordered_map<int8_t*, HeadAndTail> location_lists_;
 
   // Isolate* -> linked list of Nodes which are waiting for their Promises to
   // be resolved.
@@ -107,6 +113,24 @@ namespace {
 // condition variable of such nodes.
 base::LazyMutex g_mutex = LAZY_MUTEX_INITIALIZER;
 base::LazyInstance<FutexWaitList>::type g_wait_list = LAZY_INSTANCE_INITIALIZER;
+
+// The number of nodes on the location lists of `g_wait_list`, plus the number
+// of waiters which are about to compare the value at their wait location.
+// `FutexEmulation::Wake` returns without taking `g_mutex` if this is zero.
+// Waiters increment it before loading the value, so a thread which stores a
+// new value and then reads zero here cannot miss any of them (both sides use
+// sequentially consistent accesses).
+std::atomic<uint32_t> g_num_waiters{0};
+static_assert(sizeof(g_num_waiters) == sizeof(uint32_t),
+              "generated code loads g_num_waiters as a plain uint32");
+
+// Keeps `g_num_waiters` non-zero while a waiter checks its wait location and
+// adds itself to `g_wait_list`.
+class V8_NODISCARD PendingWaiterScope {
+ public:
+  PendingWaiterScope() { g_num_waiters.fetch_add(1); }
+  ~PendingWaiterScope() { g_num_waiters.fetch_sub(1); }
+};
 }  // namespace
 
 FutexWaitListNode::~FutexWaitListNode() {
@@ -208,6 +232,7 @@ void FutexWaitList::AddNode(FutexWaitListNode* node) {
     node->prev_ = it->second.tail;
     it->second.tail = node;
   }
+  g_num_waiters.fetch_add(1);
 
   Verify();
 }
@@ -237,6 +262,7 @@ void FutexWaitList::RemoveNode(FutexWaitListNode* node) {
   }
 
   node->prev_ = node->next_ = nullptr;
+  g_num_waiters.fetch_sub(1);
 
   Verify();
 }
@@ -397,6 +423,7 @@ Object FutexEmulation::WaitSync(Isolate* isolate,
     // still holding the lock).
     FutexWaitListNode::ResetWaitingOnScopeExit reset_waiting(node);
 
+    PendingWaiterScope pending_waiter;
     std::atomic<T>* p = reinterpret_cast<std::atomic<T>*>(wait_location);
     if (p->load() != value) {
       result = handle(Smi::FromInt(WaitReturnValue::kNotEqual), isolate);
@@ -541,6 +568,7 @@ Object FutexEmulation::WaitAsync(Isolate* isolate,
         array_buffer->GetBackingStore();
 
     // 17. Let w be ! AtomicLoad(typedArray, i).
+    PendingWaiterScope pending_waiter;
     std::atomic<T>* p = reinterpret_cast<std::atomic<T>*>(
         static_cast<int8_t*>(backing_store->buffer_start()) + addr);
     if (p->load() != value) {
@@ -638,6 +666,9 @@ Object FutexEmulation::Wake(Handle<JSArrayBuffer> array_buffer, size_t addr,
                             uint32_t num_waiters_to_wake) {
   DCHECK_LT(addr, array_buffer->byte_length());
 
+  // Fast path: Nobody is waiting on any location.
+  if (g_num_waiters.load() == 0) return Smi::zero();
+
   int waiters_woken = 0;
   std::shared_ptr<BackingStore> backing_store = array_buffer->GetBackingStore();
   auto wait_location = FutexWaitList::ToWaitLocation(backing_store.get(), addr);
@@ -652,13 +683,13 @@ Object FutexEmulation::Wake(Handle<JSArrayBuffer> array_buffer, size_t addr,
   FutexWaitListNode* node = it->second.head;
   while (node && num_waiters_to_wake > 0) {
     bool delete_this_node = false;
-    std::shared_ptr<BackingStore> node_backing_store =
-        node->backing_store_.lock();
-
     if (!node->waiting_) {
       node = node->next_;
       continue;
     }
+
+    std::shared_ptr<BackingStore> node_backing_store =
+        node->backing_store_.lock();
     // Relying on wait_location_ here is not enough, since we need to guard
     // against the case where the BackingStore of the node has been deleted and
     // a new BackingStore recreated in the same memory area.
@@ -856,6 +887,11 @@ void FutexEmulation::HandleAsyncWaiterTimeout(FutexWaitListNode* node) {
   delete node;
 }
 
+// static
+Address FutexEmulation::num_waiters_address() {
+  return reinterpret_cast<Address>(&g_num_waiters);
+}
+
 void FutexEmulation::IsolateDeinit(Isolate* isolate) {
   NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
 
@@ -182,6 +182,10 @@ class FutexEmulation : public AllStatic {
                                        size_t addr,
                                        uint32_t num_waiters_to_wake);
 
+  // Address of a uint32 which is zero if no thread or async waiter is waiting
+  // on any location. Generated code checks it to skip calls to |Wake|.
+  static Address num_waiters_address();
+
   // Called before |isolate| dies. Removes async waiters owned by |isolate|.
   static void IsolateDeinit(Isolate* isolate);
 
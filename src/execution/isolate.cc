@@ -55,6 +55,7 @@
 #include "src/handles/global-handles-inl.h"
 #include "src/handles/persistent-handles.h"
 #include "src/heap/heap-inl.h"
+#include "src/heap/pretenuring-hints.h"
 #include "src/heap/read-only-heap.h"
 #include "src/ic/stub-cache.h"
 #include "src/init/bootstrapper.h"
@@ -632,20 +633,46 @@ class StackTraceBuilder {
  public:
   enum FrameFilterMode { ALL, CURRENT_SECURITY_CONTEXT };
 
+  // Layout of a raw stack trace: the number of frames, followed by
+  // kRawFrameSize slots for each frame. Raw stack traces are captured for
+  // Error objects and only turned into StackFrameInfo objects once the
+  // stack is formatted, see Isolate::ExpandSimpleStackTrace().
+  enum RawFrameField {
+    kRawReceiverOrInstance,
+    kRawFunction,
+    kRawCode,
+    kRawOffset,
+    kRawFlags,
+    kRawParameters,
+    kRawFrameSize
+  };
+  static const int kRawFrameCountIndex = 0;
+  static const int kFirstRawFrameIndex = 1;
+
+  static bool IsRawStackTrace(FixedArray stack_trace) {
+    return stack_trace.length() > 0 &&
+           stack_trace.get(kRawFrameCountIndex).IsSmi();
+  }
+
   StackTraceBuilder(Isolate* isolate, FrameSkipMode mode, int limit,
-                    Handle<Object> caller, FrameFilterMode filter_mode)
+                    Handle<Object> caller, FrameFilterMode filter_mode,
+                    bool raw_frames = false)
       : isolate_(isolate),
         mode_(mode),
         limit_(limit),
         caller_(caller),
         skip_next_frame_(mode != SKIP_NONE),
-        check_security_context_(filter_mode == CURRENT_SECURITY_CONTEXT) {
+        check_security_context_(filter_mode == CURRENT_SECURITY_CONTEXT),
+        raw_frames_(raw_frames) {
     DCHECK_IMPLIES(mode_ == SKIP_UNTIL_SEEN, caller_->IsJSFunction());
     // Modern web applications are usually built with multiple layers of
     // framework and library code, and stack depth tends to be more than
     // a dozen frames, so we over-allocate a bit here to avoid growing
-    // the elements array in the common case.
-    elements_ = isolate->factory()->NewFixedArray(std::min(64, limit));
+    // the elements array in the common case. Raw frames take several slots
+    // each, so they start out smaller.
+    elements_ = isolate->factory()->NewFixedArray(
+        raw_frames_ ? kFirstRawFrameIndex + std::min(16, limit) * kRawFrameSize
+                    : std::min(64, limit));
   }
 
   void AppendAsyncFrame(Handle<JSGeneratorObject> generator_object) {
@@ -765,7 +792,13 @@ class StackTraceBuilder {
   bool Full() { return index_ >= limit_; }
 
   Handle<FixedArray> Build() {
-    return FixedArray::ShrinkOrEmpty(isolate_, elements_, index_);
+    if (!raw_frames_) {
+      return FixedArray::ShrinkOrEmpty(isolate_, elements_, index_);
+    }
+    if (index_ == 0) return isolate_->factory()->empty_fixed_array();
+    elements_->set(kRawFrameCountIndex, Smi::FromInt(index_));
+    return FixedArray::ShrinkOrEmpty(
+        isolate_, elements_, kFirstRawFrameIndex + index_ * kRawFrameSize);
   }
 
  private:
@@ -830,22 +863,41 @@ class StackTraceBuilder {
   void AppendFrame(Handle<Object> receiver_or_instance, Handle<Object> function,
                    Handle<HeapObject> code, int offset, int flags,
                    Handle<FixedArray> parameters) {
-    DCHECK_LE(index_, elements_->length());
-    DCHECK_LE(elements_->length(), limit_);
-    if (index_ == elements_->length()) {
-      elements_ = isolate_->factory()->CopyFixedArrayAndGrow(
-          elements_, std::min(16, limit_ - elements_->length()));
+    int capacity = Capacity();
+    DCHECK_LE(index_, capacity);
+    DCHECK_LE(capacity, limit_);
+    if (index_ == capacity) {
+      int grow_by = std::min(16, limit_ - capacity);
+      if (raw_frames_) grow_by *= kRawFrameSize;
+      elements_ =
+          isolate_->factory()->CopyFixedArrayAndGrow(elements_, grow_by);
     }
     if (receiver_or_instance->IsTheHole(isolate_)) {
       // TODO(jgruber): Fix all cases in which frames give us a hole value
       // (e.g. the receiver in RegExp constructor frames).
       receiver_or_instance = isolate_->factory()->undefined_value();
     }
+    if (raw_frames_) {
+      int base = kFirstRawFrameIndex + index_++ * kRawFrameSize;
+      elements_->set(base + kRawReceiverOrInstance, *receiver_or_instance);
+      elements_->set(base + kRawFunction, *function);
+      elements_->set(base + kRawCode, *code);
+      elements_->set(base + kRawOffset, Smi::FromInt(offset));
+      elements_->set(base + kRawFlags, Smi::FromInt(flags));
+      elements_->set(base + kRawParameters, *parameters);
+      return;
+    }
     auto info = isolate_->factory()->NewStackFrameInfo(
         receiver_or_instance, function, code, offset, flags, parameters);
     elements_->set(index_++, *info);
   }
 
+  // The number of frames that fit into {elements_}.
+  int Capacity() const {
+    if (!raw_frames_) return elements_->length();
+    return (elements_->length() - kFirstRawFrameIndex) / kRawFrameSize;
+  }
+
   Isolate* isolate_;
   const FrameSkipMode mode_;
   int index_ = 0;
@@ -854,6 +906,7 @@ class StackTraceBuilder {
   bool skip_next_frame_;
   bool encountered_strict_function_ = false;
   const bool check_security_context_;
+  const bool raw_frames_;
   Handle<FixedArray> elements_;
 };
 
@@ -1007,6 +1060,8 @@ struct CaptureStackTraceOptions {
   bool capture_builtin_exit_frames;
   bool capture_only_frames_subject_to_debugging;
   bool async_stack_trace;
+  // Whether to capture a raw stack trace instead of StackFrameInfo objects.
+  bool raw_frames = false;
 };
 
 Handle<FixedArray> CaptureStackTrace(Isolate* isolate, Handle<Object> caller,
@@ -1021,7 +1076,7 @@ Handle<FixedArray> CaptureStackTrace(Isolate* isolate, Handle<Object> caller,
 #endif  // V8_ENABLE_WEBASSEMBLY
 
   StackTraceBuilder builder(isolate, options.skip_mode, options.limit, caller,
-                            options.filter_mode);
+                            options.filter_mode, options.raw_frames);
 
   // Build the regular stack trace, and remember the last relevant
   // frame ID and inlined index (for the async stack trace handling
@@ -1162,6 +1217,7 @@ Handle<Object> Isolate::CaptureSimpleStackTrace(Handle<JSReceiver> error_object,
       !GetStackTraceLimit(this, &limit)) {
     return factory()->undefined_value();
   }
+  if (limit == 0) return factory()->empty_fixed_array();
 
   CaptureStackTraceOptions options;
   options.limit = limit;
@@ -1170,10 +1226,43 @@ Handle<Object> Isolate::CaptureSimpleStackTrace(Handle<JSReceiver> error_object,
   options.async_stack_trace = FLAG_async_stack_traces;
   options.filter_mode = StackTraceBuilder::CURRENT_SECURITY_CONTEXT;
   options.capture_only_frames_subject_to_debugging = false;
+  options.raw_frames = true;
 
   return CaptureStackTrace(this, caller, options);
 }
 
+Handle<FixedArray> Isolate::ExpandSimpleStackTrace(
+    Handle<FixedArray> stack_trace) {
+  if (!StackTraceBuilder::IsRawStackTrace(*stack_trace)) return stack_trace;
+  int frame_count =
+      Smi::ToInt(stack_trace->get(StackTraceBuilder::kRawFrameCountIndex));
+  Handle<FixedArray> frames = factory()->NewFixedArray(frame_count);
+  for (int i = 0; i < frame_count; ++i) {
+    int base = StackTraceBuilder::kFirstRawFrameIndex +
+               i * StackTraceBuilder::kRawFrameSize;
+    Handle<Object> receiver_or_instance(
+        stack_trace->get(base + StackTraceBuilder::kRawReceiverOrInstance),
+        this);
+    Handle<Object> function(
+        stack_trace->get(base + StackTraceBuilder::kRawFunction), this);
+    Handle<HeapObject> code(
+        HeapObject::cast(stack_trace->get(base + StackTraceBuilder::kRawCode)),
+        this);
+    int offset =
+        Smi::ToInt(stack_trace->get(base + StackTraceBuilder::kRawOffset));
+    int flags =
+        Smi::ToInt(stack_trace->get(base + StackTraceBuilder::kRawFlags));
+    Handle<FixedArray> parameters(
+        FixedArray::cast(
+            stack_trace->get(base + StackTraceBuilder::kRawParameters)),
+        this);
+    auto info = factory()->NewStackFrameInfo(receiver_or_instance, function,
+                                             code, offset, flags, parameters);
+    frames->set(i, *info);
+  }
+  return frames;
+}
+
 MaybeHandle<JSReceiver> Isolate::CaptureAndSetDetailedStackTrace(
     Handle<JSReceiver> error_object) {
   if (capture_stack_trace_for_uncaught_exceptions_) {
@@ -1657,6 +1746,8 @@ Object Isolate::ThrowInternal(Object raw_exception, MessageLocation* location) {
   //    captures messages or is verbose (which reports despite the catch).
   // 3) ReThrow from v8::TryCatch: The message from a previous throw still
   //    exists and we preserve it instead of creating a new message.
+  // 4) JavaScript handler catches: No message is created if nothing observes
+  //    it, see IsCaughtByJavaScriptWithoutObservers().
   bool requires_message = try_catch_handler() == nullptr ||
                           try_catch_handler()->is_verbose_ ||
                           try_catch_handler()->capture_message_;
@@ -1673,7 +1764,8 @@ Object Isolate::ThrowInternal(Object raw_exception, MessageLocation* location) {
   }
 
   // Generate the message if required.
-  if (requires_message && !rethrowing_message) {
+  if (requires_message && !rethrowing_message &&
+      !IsCaughtByJavaScriptWithoutObservers(*exception)) {
     MessageLocation computed_location;
     // If no location was specified we try to use a computed one instead.
     if (location == nullptr && ComputeLocation(&computed_location)) {
@@ -2103,6 +2195,48 @@ Isolate::CatchType Isolate::PredictExceptionCatcher() {
   return NOT_CAUGHT;
 }
 
+bool Isolate::IsCaughtByJavaScriptWithoutObservers(Object exception) {
+  // A JavaScript catch block drops the pending message, so the message of an
+  // exception that will be caught that way is never used, unless the
+  // debugger or a message listener may observe it.
+  if (!IsJavaScriptHandlerOnTop(exception)) return false;
+  if (debug()->is_active()) return false;
+  if (factory()->message_listeners()->length() > 0) return false;
+
+  // Only the frames up to the top-most entry frame are searched, so the
+  // prediction never crosses an external v8::TryCatch or embedder code.
+  for (StackFrameIterator iter(this); !iter.done(); iter.Advance()) {
+    StackFrame* frame = iter.frame();
+    switch (frame->type()) {
+      case StackFrame::ENTRY:
+      case StackFrame::CONSTRUCT_ENTRY:
+        return false;
+
+      case StackFrame::OPTIMIZED:
+      case StackFrame::INTERPRETED:
+      case StackFrame::BASELINE:
+      case StackFrame::BUILTIN: {
+        CatchType prediction =
+            ToCatchType(PredictException(JavaScriptFrame::cast(frame)));
+        if (prediction == NOT_CAUGHT) break;
+        return prediction == CAUGHT_BY_JAVASCRIPT;
+      }
+
+      case StackFrame::STUB:
+      case StackFrame::JAVA_SCRIPT_BUILTIN_CONTINUATION_WITH_CATCH: {
+        // Builtins with handlers are involved, e.g. promise reactions.
+        Code code = frame->LookupCode();
+        if (code.IsCode() && code.has_handler_table()) return false;
+        break;
+      }
+
+      default:
+        break;
+    }
+  }
+  return false;
+}
+
 Object Isolate::ThrowIllegalOperation() {
   if (FLAG_stack_trace_on_illegal) PrintStack(stdout);
   return Throw(ReadOnlyRoots(heap()).illegal_access_string());
@@ -2244,7 +2378,8 @@ bool Isolate::ComputeLocationFromStackTrace(MessageLocation* target,
   Handle<Object> property =
       JSReceiver::GetDataProperty(Handle<JSObject>::cast(exception), key);
   if (!property->IsFixedArray()) return false;
-  Handle<FixedArray> stack = Handle<FixedArray>::cast(property);
+  Handle<FixedArray> stack =
+      ExpandSimpleStackTrace(Handle<FixedArray>::cast(property));
   for (int i = 0; i < stack->length(); i++) {
     Handle<StackFrameInfo> frame(StackFrameInfo::cast(stack->get(i)), this);
     if (StackFrameInfo::ComputeLocation(frame, target)) return true;
@@ -3135,6 +3270,9 @@ void Isolate::Deinit() {
     heap_profiler()->StopSamplingHeapProfiler();
   }
 
+#ifdef V8_RUNTIME_CALL_STATS
+  if (FLAG_rcs_metrics) ReportRuntimeCallStats();
+#endif  // V8_RUNTIME_CALL_STATS
   metrics_recorder_->NotifyIsolateDisposal();
   recorder_context_id_map_.clear();
 
@@ -3171,6 +3309,10 @@ void Isolate::Deinit() {
     PrintF(stdout, "=== Stress deopt counter: %u\n", stress_deopt_count_);
   }
 
+  if (FLAG_share_pretenuring_decisions) {
+    PretenuringHints::RecordTenuredSites(this);
+  }
+
   // We must stop the logger before we tear down other components.
   sampler::Sampler* sampler = logger_->sampler();
   if (sampler && sampler->IsActive()) sampler->Stop();
@@ -3922,6 +4064,10 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
 
   initialized_ = true;
 
+#ifdef V8_RUNTIME_CALL_STATS
+  if (FLAG_rcs_metrics) ScheduleRuntimeCallStatsReport();
+#endif  // V8_RUNTIME_CALL_STATS
+
   return true;
 }
 
@@ -3985,6 +4131,45 @@ std::unique_ptr<PersistentHandles> Isolate::NewPersistentHandles() {
   return std::make_unique<PersistentHandles>(this);
 }
 
+#ifdef V8_RUNTIME_CALL_STATS
+namespace {
+
+// Reports the runtime call stats and schedules the next report.
+class RuntimeCallStatsReportTask : public CancelableTask {
+ public:
+  explicit RuntimeCallStatsReportTask(Isolate* isolate)
+      : CancelableTask(isolate), isolate_(isolate) {}
+
+  void RunInternal() override {
+    isolate_->ReportRuntimeCallStats();
+    isolate_->ScheduleRuntimeCallStatsReport();
+  }
+
+ private:
+  Isolate* const isolate_;
+};
+
+}  // namespace
+
+void Isolate::ScheduleRuntimeCallStatsReport() {
+  V8::GetCurrentPlatform()
+      ->GetForegroundTaskRunner(reinterpret_cast<v8::Isolate*>(this))
+      ->PostDelayedTask(std::make_unique<RuntimeCallStatsReportTask>(this),
+                        FLAG_rcs_metrics_interval);
+}
+#endif  // V8_RUNTIME_CALL_STATS
+
+void Isolate::ReportRuntimeCallStats() {
+#ifdef V8_RUNTIME_CALL_STATS
+  if (!metrics_recorder()->HasEmbedderRecorder()) return;
+  RuntimeCallStats* stats = counters()->runtime_call_stats();
+  v8::metrics::RuntimeCallStatsSummary summary;
+  summary.sampling_rate = stats->sampling_rate();
+  stats->GetEntries(&summary.entries);
+  metrics_recorder()->AddThreadSafeEvent(summary);
+#endif  // V8_RUNTIME_CALL_STATS
+}
+
 void Isolate::DumpAndResetStats() {
   if (FLAG_trace_turbo_stack_accesses) {
     StdoutStream os;
@@ -4037,7 +4222,10 @@ void Isolate::DumpAndResetStats() {
                   v8::tracing::TracingCategoryObserver::ENABLED_BY_NATIVE)) {
     counters()->worker_thread_runtime_call_stats()->AddToMainTable(
         counters()->runtime_call_stats());
-    counters()->runtime_call_stats()->Print();
+    // --rcs-metrics reports to the embedder instead.
+    if (FLAG_runtime_call_stats || !FLAG_rcs_metrics) {
+      counters()->runtime_call_stats()->Print();
+    }
     counters()->runtime_call_stats()->Reset();
   }
 #endif  // V8_RUNTIME_CALL_STATS
@@ -4848,10 +5036,16 @@ void Isolate::SetRAILMode(RAILMode rail_mode) {
     load_start_time_ms_ = heap()->MonotonicallyIncreasingTimeInMs();
   }
   rail_mode_.store(rail_mode);
-  if (old_rail_mode == PERFORMANCE_LOAD && rail_mode != PERFORMANCE_LOAD) {
+  if ((old_rail_mode == PERFORMANCE_LOAD && rail_mode != PERFORMANCE_LOAD) ||
+      (old_rail_mode == PERFORMANCE_RESPONSE &&
+       rail_mode != PERFORMANCE_RESPONSE)) {
     heap()->incremental_marking()->incremental_marking_job()->ScheduleTask(
         heap());
   }
+  if (old_rail_mode != PERFORMANCE_IDLE && rail_mode == PERFORMANCE_IDLE) {
+    // The embedder is idle, which is a good time for deferred GC work.
+    heap()->NotifyEmbedderIdle();
+  }
   if (FLAG_trace_rail) {
     PrintIsolate(this, "RAIL mode: %s\n", RAILModeName(rail_mode));
   }
@@ -449,6 +449,7 @@ using DebugObjectCache = std::vector<Handle<HeapObject>>;
   V(WasmExceptionsEnabledCallback, wasm_exceptions_enabled_callback, nullptr) \
   V(WasmDynamicTieringEnabledCallback, wasm_dynamic_tiering_enabled_callback, \
     nullptr)                                                                  \
+  V(DeoptimizationCallback, deoptimization_callback, nullptr)                 \
   /* State for Relocatable. */                                                \
   V(Relocatable*, relocatable_top, nullptr)                                   \
   V(DebugObjectCache*, string_stream_debug_object_cache, nullptr)             \
@@ -756,6 +757,10 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 
   bool IsJavaScriptHandlerOnTop(Object exception);
   bool IsExternalHandlerOnTop(Object exception);
+  // Returns true if the exception will be caught by a JavaScript catch block
+  // before leaving the current JavaScript activation, and neither the
+  // debugger nor a message listener could observe its message.
+  bool IsCaughtByJavaScriptWithoutObservers(Object exception);
 
   inline bool is_catchable_by_javascript(Object exception);
   inline bool is_catchable_by_wasm(Object exception);
@@ -871,9 +876,15 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
                                         void* ptr4 = nullptr);
   Handle<FixedArray> CaptureCurrentStackTrace(
       int frame_limit, StackTrace::StackTraceOptions options);
+  // Captures the stack trace for an Error object in a raw form that is
+  // cheap to create. Use ExpandSimpleStackTrace() to get the frames.
   Handle<Object> CaptureSimpleStackTrace(Handle<JSReceiver> error_object,
                                          FrameSkipMode mode,
                                          Handle<Object> caller);
+  // Returns the StackFrameInfo objects for a stack trace captured by
+  // CaptureSimpleStackTrace(). Already expanded stack traces are returned
+  // as is.
+  Handle<FixedArray> ExpandSimpleStackTrace(Handle<FixedArray> stack_trace);
   MaybeHandle<JSReceiver> CaptureAndSetDetailedStackTrace(
       Handle<JSReceiver> error_object);
   MaybeHandle<JSReceiver> CaptureAndSetSimpleStackTrace(
@@ -1323,8 +1334,13 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
     return code_coverage_mode() == debug::CoverageMode::kBlockBinary;
   }
 
+  bool is_sampled_block_code_coverage() const {
+    return code_coverage_mode() == debug::CoverageMode::kSampledBlockCount;
+  }
+
   bool is_block_code_coverage() const {
-    return is_block_count_code_coverage() || is_block_binary_code_coverage();
+    return is_block_count_code_coverage() || is_block_binary_code_coverage() ||
+           is_sampled_block_code_coverage();
   }
 
   bool is_binary_code_coverage() const {
@@ -1441,6 +1457,11 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 
   void DumpAndResetStats();
 
+  // Reports the main thread's runtime call stats to the metrics recorder,
+  // see --rcs-metrics. Reports are scheduled every --rcs-metrics-interval.
+  void ReportRuntimeCallStats();
+  void ScheduleRuntimeCallStatsReport();
+
   void* stress_deopt_count_address() { return &stress_deopt_count_; }
 
   void set_force_slow_path(bool v) { force_slow_path_ = v; }
@@ -215,8 +215,8 @@ std::unique_ptr<char[]> MessageHandler::GetLocalizedMessage(
 
 namespace {
 
-// Convert the raw frames as written by Isolate::CaptureSimpleStackTrace into
-// a JSArray of JSCallSite objects.
+// Convert the frames as expanded by Isolate::ExpandSimpleStackTrace into a
+// JSArray of JSCallSite objects.
 MaybeHandle<JSArray> GetStackFrames(Isolate* isolate,
                                     Handle<FixedArray> frames) {
   int frame_count = frames->length();
@@ -301,7 +301,8 @@ MaybeHandle<Object> ErrorUtils::FormatStackTrace(Isolate* isolate,
     return isolate->factory()->empty_string();
   }
   DCHECK(raw_stack->IsFixedArray());
-  Handle<FixedArray> elems = Handle<FixedArray>::cast(raw_stack);
+  Handle<FixedArray> elems =
+      isolate->ExpandSimpleStackTrace(Handle<FixedArray>::cast(raw_stack));
 
   const bool in_recursion = isolate->formatting_stack_trace();
   const bool has_overflowed = i::StackLimitCheck{isolate}.HasOverflowed();
@@ -19,6 +19,12 @@ class Protectors : public AllStatic {
   V(ArrayBufferDetaching, ArrayBufferDetachingProtector,                      \
     array_buffer_detaching_protector)                                         \
   V(ArrayConstructor, ArrayConstructorProtector, array_constructor_protector) \
+  /* The ArrayIterator protector protects the original iteration behavior */ \
+  /* of JSArrays. Besides 'next' and 'Symbol.iterator', it guarantees     */ \
+  /* that array iterators have no 'return' method, so it is invalidated   */ \
+  /* when 'return' is set on an array iterator, %ArrayIteratorPrototype%, */ \
+  /* %IteratorPrototype% or %ObjectPrototype%, and when the prototype of  */ \
+  /* %ArrayIteratorPrototype% or %IteratorPrototype% changes.             */ \
   V(ArrayIteratorLookupChain, ArrayIteratorProtector,                         \
     array_iterator_protector)                                                 \
   V(ArraySpeciesLookupChain, ArraySpeciesProtector, array_species_protector)  \
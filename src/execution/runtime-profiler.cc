@@ -25,10 +25,11 @@ static const int kOSRBytecodeSizeAllowanceBase = 119;
 
 static const int kOSRBytecodeSizeAllowancePerTick = 44;
 
-#define OPTIMIZATION_REASON_LIST(V)   \
-  V(DoNotOptimize, "do not optimize") \
-  V(HotAndStable, "hot and stable")   \
-  V(SmallFunction, "small function")
+#define OPTIMIZATION_REASON_LIST(V)        \
+  V(DoNotOptimize, "do not optimize")      \
+  V(HotAndStable, "hot and stable")        \
+  V(SmallFunction, "small function")       \
+  V(OptimizationHint, "optimization hint")
 
 enum class OptimizationReason : uint8_t {
 #define OPTIMIZATION_REASON_CONSTANTS(Constant, message) k##Constant,
@@ -194,13 +195,36 @@ OptimizationReason RuntimeProfiler::ShouldOptimize(JSFunction function,
     return OptimizationReason::kDoNotOptimize;
   }
   int ticks = function.feedback_vector().profiler_ticks();
+  if (V8_UNLIKELY(FLAG_optimization_hints ||
+                  FLAG_cross_context_optimization_hints) &&
+      !FLAG_turboprop && ticks > 0 &&
+      function.shared().has_optimization_hint()) {
+    // The function was optimized by TurboFan in an earlier run (the hint
+    // survives in the code cache) or in another native context that shares
+    // its SharedFunctionInfo; skip the usual warm-up once some feedback has
+    // been collected here.
+    return OptimizationReason::kOptimizationHint;
+  }
   bool active_tier_is_turboprop = function.ActiveTierIsMidtierTurboprop();
+  // Compiling with Turboprop is considerably cheaper than with TurboFan, so
+  // warm functions are promoted to the midtier before they become hot.
+  int ticks_before_optimization =
+      V8_UNLIKELY(FLAG_turboprop) && !active_tier_is_turboprop
+          ? FLAG_ticks_before_midtier_optimization
+          : FLAG_ticks_before_optimization;
   int ticks_for_optimization =
-      FLAG_ticks_before_optimization +
+      ticks_before_optimization +
       (bytecode.length() / FLAG_bytecode_size_allowance_per_tick);
+  int deopt_count = function.shared().deopt_count();
+  if (V8_UNLIKELY(FLAG_deopt_loop_detection) && deopt_count > 0) {
+    // Each deopt doubles the warm-up, so a function that keeps failing its
+    // assumptions collects more feedback before the next attempt.
+    ticks_for_optimization <<= deopt_count;
+  }
   if (ticks >= ticks_for_optimization) {
     return OptimizationReason::kHotAndStable;
-  } else if (ShouldOptimizeAsSmallFunction(bytecode.length(), ticks,
+  } else if ((!FLAG_deopt_loop_detection || deopt_count == 0) &&
+             ShouldOptimizeAsSmallFunction(bytecode.length(), ticks,
                                            any_ic_changed_,
                                            active_tier_is_turboprop)) {
     // If no IC was patched since the last tick and this function is very
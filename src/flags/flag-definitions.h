@@ -500,6 +500,15 @@ DEFINE_BOOL_READONLY(conservative_stack_scanning,
                      V8_ENABLE_CONSERVATIVE_STACK_SCANNING_BOOL,
                      "use conservative stack scanning")
 
+#ifdef V8_ENABLE_DIRECT_HANDLE
+#define V8_ENABLE_DIRECT_HANDLE_BOOL true
+#else
+#define V8_ENABLE_DIRECT_HANDLE_BOOL false
+#endif
+DEFINE_BOOL_READONLY(direct_handle, V8_ENABLE_DIRECT_HANDLE_BOOL,
+                     "hold DirectHandles on the stack instead of in "
+                     "HandleScopes")
+
 #ifdef V8_ENABLE_FUTURE
 #define FUTURE_BOOL true
 #else
@@ -568,6 +577,16 @@ DEFINE_NEG_NEG_IMPLICATION(allocation_site_tracking,
 // Flags for experimental implementation features.
 DEFINE_BOOL(allocation_site_pretenuring, true,
             "pretenure with allocation sites")
+DEFINE_BOOL(share_pretenuring_decisions, false,
+            "remember literal allocation sites that were pretenured when an "
+            "isolate is disposed and pretenure the same sites in isolates "
+            "created later in the process")
+DEFINE_IMPLICATION(share_pretenuring_decisions, allocation_site_pretenuring)
+DEFINE_BOOL(allocation_site_capacity_hints, false,
+            "remember the capacity that arrays from an allocation site grew "
+            "to and preallocate it for later arrays from the same site")
+DEFINE_NEG_NEG_IMPLICATION(allocation_site_tracking,
+                           allocation_site_capacity_hints)
 DEFINE_BOOL(page_promotion, true, "promote pages based on utilization")
 DEFINE_BOOL_READONLY(always_promote_young_mc, true,
                      "always promote young objects during mark-compact")
@@ -577,6 +596,9 @@ DEFINE_BOOL(trace_pretenuring, false,
             "trace pretenuring decisions of HAllocate instructions")
 DEFINE_BOOL(trace_pretenuring_statistics, false,
             "trace allocation site pretenuring statistics")
+DEFINE_BOOL(const_tracking_let, false,
+            "treat script-scope let bindings as constants in optimized code "
+            "until they are assigned after their initialization")
 DEFINE_BOOL(track_field_types, true, "track field types")
 DEFINE_BOOL(trace_block_coverage, false,
             "trace collected block coverage information")
@@ -596,6 +618,9 @@ DEFINE_BOOL_READONLY(enable_sealed_frozen_elements_kind, true,
 
 // Flags for data representation optimizations
 DEFINE_BOOL(unbox_double_arrays, true, "automatically unbox arrays of doubles")
+DEFINE_BOOL(native_numeric_sort, true,
+            "sort packed Smi and double arrays in C++ when the comparison "
+            "function is the default or only subtracts its arguments")
 DEFINE_BOOL_READONLY(string_slices, true, "use string slices")
 
 DEFINE_INT(ticks_before_optimization, 3,
@@ -612,6 +637,12 @@ DEFINE_INT(
 
 // Flags for inline caching and feedback vectors.
 DEFINE_BOOL(use_ic, true, "use inline caching")
+DEFINE_INT(stub_cache_primary_table_bits, 11,
+           "log2 of the number of entries in the primary megamorphic stub "
+           "cache tables (clamped to [4, 16])")
+DEFINE_INT(stub_cache_secondary_table_bits, 9,
+           "log2 of the number of entries in the secondary megamorphic stub "
+           "cache tables (clamped to [4, 16])")
 DEFINE_INT(budget_for_feedback_vector_allocation, 940,
            "The budget in amount of bytecode executed by a function before we "
            "decide to allocate feedback vectors")
@@ -622,6 +653,9 @@ DEFINE_BOOL(feedback_allocation_on_bytecode_size, true,
             "scale it based in the bytecode size.")
 DEFINE_IMPLICATION(sparkplug, feedback_allocation_on_bytecode_size)
 DEFINE_BOOL(lazy_feedback_allocation, true, "Allocate feedback vectors lazily")
+DEFINE_BOOL(share_feedback_cells, false,
+            "share one feedback cell between all closures of a function "
+            "within a native context")
 
 // Flags for Ignition.
 DEFINE_BOOL(ignition_elide_noneffectful_bytecodes, true,
@@ -629,9 +663,15 @@ DEFINE_BOOL(ignition_elide_noneffectful_bytecodes, true,
 DEFINE_BOOL(ignition_reo, true, "use ignition register equivalence optimizer")
 DEFINE_BOOL(ignition_filter_expression_positions, true,
             "filter expression positions before the bytecode pipeline")
+DEFINE_BOOL(fast_array_destructuring, true,
+            "read fast arrays directly in array destructuring instead of "
+            "iterating them")
 DEFINE_BOOL(ignition_share_named_property_feedback, true,
             "share feedback slots when loading the same named property from "
             "the same object")
+DEFINE_BOOL(ignition_elide_arguments, true,
+            "don't allocate arguments objects and rest parameters that are "
+            "only loaded from")
 DEFINE_BOOL(print_bytecode, false,
             "print bytecode generated by ignition interpreter")
 DEFINE_BOOL(enable_lazy_source_positions, V8_LAZY_SOURCE_POSITIONS_BOOL,
@@ -686,6 +726,22 @@ DEFINE_INT(turboprop_inline_scaling_factor, 4,
 // Turboprop to TurboFan.
 DEFINE_INT(interrupt_budget_scale_factor_for_top_tier, 20,
            "scale factor for profiler ticks when tiering up from midtier")
+DEFINE_INT(ticks_before_midtier_optimization, 1,
+           "the number of times we have to go through the interrupt budget "
+           "before considering a function for midtier optimization")
+DEFINE_BOOL(optimization_hints, false,
+            "record which functions were optimized or inlined by TurboFan "
+            "and use that when they are deserialized from the code cache")
+DEFINE_BOOL(cross_context_optimization_hints, false,
+            "record which functions were optimized or inlined by TurboFan "
+            "and use that to tier up the same functions in the isolate's "
+            "other native contexts after less warm-up")
+DEFINE_BOOL(deopt_loop_detection, false,
+            "back off exponentially from re-optimizing functions that keep "
+            "deoptimizing, and stop optimizing them at --max-deopt-count")
+DEFINE_INT(max_deopt_count, 8,
+           "the number of eager or soft deopts after which a function is no "
+           "longer optimized (at most 15)")
 
 // Flags for Sparkplug
 #undef FLAG
@@ -719,6 +775,9 @@ DEFINE_BOOL_READONLY(concurrent_sparkplug, false,
                      "compile Sparkplug code in a background thread")
 #endif
 DEFINE_STRING(sparkplug_filter, "*", "filter for Sparkplug baseline compiler")
+DEFINE_BOOL(sparkplug_code_cache_hints, false,
+            "record functions with Sparkplug code in the code cache and "
+            "compile them with Sparkplug when the cache is consumed")
 DEFINE_BOOL(sparkplug_needs_short_builtins, false,
             "only enable Sparkplug baseline compiler when "
             "--short-builtin-calls are also enabled")
@@ -753,6 +812,9 @@ DEFINE_INT(concurrent_recompilation_queue_length, 8,
            "the length of the concurrent compilation queue")
 DEFINE_INT(concurrent_recompilation_delay, 0,
            "artificial compilation delay in ms")
+DEFINE_INT(concurrent_recompilation_large_function_size, 16 * KB,
+           "bytecode size above which a concurrent job is compiled only when "
+           "no other large job is running (0 to disable)")
 DEFINE_BOOL(concurrent_inlining, true,
             "run optimizing compiler's inlining phase on a separate thread")
 DEFINE_BOOL(
@@ -791,6 +853,9 @@ DEFINE_BOOL(turbo_sp_frame_access, false,
 DEFINE_BOOL(
     stress_turbo_late_spilling, false,
     "optimize placement of all spill instructions, not just loop-top phis")
+DEFINE_BOOL(turbo_frequency_aware_spilling, false,
+            "use loop depth as a block frequency estimate when placing spills "
+            "and choosing which live range to split")
 
 DEFINE_STRING(turbo_filter, "*", "optimization filter for TurboFan compiler")
 DEFINE_BOOL(trace_turbo, false, "trace generated TurboFan IR")
@@ -810,7 +875,12 @@ DEFINE_BOOL(trace_turbo_trimming, false, "trace TurboFan's graph trimmer")
 DEFINE_BOOL(trace_turbo_jt, false, "trace TurboFan's jump threading")
 DEFINE_BOOL(trace_turbo_ceq, false, "trace TurboFan's control equivalence")
 DEFINE_BOOL(trace_turbo_loop, false, "trace TurboFan's loop optimizations")
+DEFINE_BOOL(trace_turbo_vectorization_candidates, false,
+            "trace typed array loops that TurboFan could vectorize")
 DEFINE_BOOL(trace_turbo_alloc, false, "trace TurboFan's register allocator")
+DEFINE_BOOL(trace_turbo_spill_moves, false,
+            "trace the number of spill and reload moves after register "
+            "allocation, also weighted by loop depth")
 DEFINE_BOOL(trace_all_uses, false, "trace all use positions")
 DEFINE_BOOL(trace_representation, false, "trace representation types")
 DEFINE_BOOL(
@@ -873,6 +943,9 @@ DEFINE_BOOL(trace_turbo_inlining, false, "trace TurboFan inlining")
 DEFINE_BOOL(turbo_inline_array_builtins, true,
             "inline array builtins in TurboFan code")
 DEFINE_BOOL(use_osr, true, "use on-stack replacement")
+DEFINE_BOOL(concurrent_osr, false,
+            "compile for on-stack replacement on a background thread and "
+            "enter the code at a later loop back edge")
 DEFINE_BOOL(trace_osr, false, "trace on-stack replacement")
 DEFINE_BOOL(analyze_environment_liveness, true,
             "analyze liveness of environment slots and zap dead values")
@@ -894,6 +967,8 @@ DEFINE_BOOL(turbo_verify_allocation, DEBUG_BOOL,
 DEFINE_BOOL(turbo_move_optimization, true, "optimize gap moves in TurboFan")
 DEFINE_BOOL(turbo_jt, true, "enable jump threading in TurboFan")
 DEFINE_BOOL(turbo_loop_peeling, true, "TurboFan loop peeling")
+DEFINE_BOOL(turbo_loop_check_hoisting, false,
+            "hoist map checks on loop-invariant values out of loops")
 DEFINE_BOOL(turbo_loop_variable, true, "TurboFan loop variable optimization")
 DEFINE_BOOL(turbo_loop_rotation, true, "TurboFan loop rotation")
 DEFINE_BOOL(turbo_cf_optimization, true, "optimize control flow in TurboFan")
@@ -921,6 +996,9 @@ DEFINE_BOOL(turbo_dynamic_map_checks, false,
             "if all handlers in an IC are the same for turboprop")
 DEFINE_BOOL(turbo_compress_translation_arrays, false,
             "compress translation arrays (experimental)")
+DEFINE_BOOL(turbo_share_translations, true,
+            "share identical translations between the deoptimization exits "
+            "of a code object")
 DEFINE_BOOL(turbo_inline_js_wasm_calls, true, "inline JS->Wasm calls")
 DEFINE_BOOL(turbo_use_mid_tier_regalloc_for_huge_functions, false,
             "fall back to the mid-tier register allocator for huge functions "
@@ -962,11 +1040,10 @@ DEFINE_DEBUG_BOOL(trace_wasm_native_heap, false,
 DEFINE_BOOL(wasm_write_protect_code_memory, false,
             "write protect code memory on the wasm native heap with mprotect")
 DEFINE_WEAK_IMPLICATION(future, wasm_write_protect_code_memory)
-DEFINE_BOOL(wasm_memory_protection_keys, false,
+DEFINE_BOOL(wasm_memory_protection_keys, true,
             "protect wasm code memory with PKU if available, no protection "
             "without support; fallback to mprotect by adding "
             "--wasm-write-protect-code-memory")
-DEFINE_WEAK_IMPLICATION(future, wasm_memory_protection_keys)
 DEFINE_DEBUG_BOOL(trace_wasm_serialization, false,
                   "trace serialization/deserialization")
 DEFINE_BOOL(wasm_async_compilation, true,
@@ -974,6 +1051,9 @@ DEFINE_BOOL(wasm_async_compilation, true,
 DEFINE_NEG_IMPLICATION(single_threaded, wasm_async_compilation)
 DEFINE_BOOL(wasm_test_streaming, false,
             "use streaming compilation instead of async compilation for tests")
+DEFINE_BOOL(wasm_pipelined_async_compilation, false,
+            "use the streaming decoder for WebAssembly.compile of buffers, "
+            "to overlap module decoding with function compilation")
 DEFINE_UINT(wasm_max_mem_pages, v8::internal::wasm::kV8MaxWasmMemoryPages,
             "maximum number of 64KiB memory pages per wasm memory")
 DEFINE_UINT(wasm_max_table_size, v8::internal::wasm::kV8MaxWasmTableSize,
@@ -985,6 +1065,9 @@ DEFINE_BOOL(wasm_tier_up, true,
             "have an effect)")
 DEFINE_BOOL(wasm_dynamic_tiering, false,
             "enable dynamic tier up to the optimizing compiler")
+DEFINE_UINT(wasm_tiering_call_threshold, 60,
+            "number of calls of a Liftoff function before dynamic tiering "
+            "compiles it with the optimizing compiler")
 DEFINE_INT(
     wasm_caching_threshold, 1000000,
     "the amount of wasm top tier code that triggers the next caching event")
@@ -1004,6 +1087,9 @@ DEFINE_BOOL(liftoff_only, false,
 DEFINE_IMPLICATION(liftoff_only, liftoff)
 DEFINE_NEG_IMPLICATION(liftoff_only, wasm_tier_up)
 DEFINE_NEG_IMPLICATION(fuzzing, liftoff_only)
+DEFINE_BOOL(liftoff_loop_invariant_locals_in_registers, true,
+            "keep locals which are not assigned in a loop in registers when "
+            "entering the loop in Liftoff")
 DEFINE_DEBUG_BOOL(
     enable_testing_opcode_in_wasm, false,
     "enables a testing opcode in wasm that is only implemented in TurboFan")
@@ -1073,6 +1159,9 @@ DEFINE_BOOL(
     "enforce explicit bounds check even if the trap handler is available")
 // "no bounds checks" implies "no enforced bounds checks".
 DEFINE_NEG_NEG_IMPLICATION(wasm_bounds_checks, wasm_enforce_bounds_checks)
+DEFINE_BOOL(wasm_memory64_trap_handling, true,
+            "use the trap handler for memory64 bounds checks, after checking "
+            "that the index fits into the guard region")
 DEFINE_BOOL(wasm_math_intrinsics, true,
             "intrinsify some Math imports into wasm")
 
@@ -1084,8 +1173,12 @@ DEFINE_SIZE_T(
     "maximum allowed size to inline a function is given by {n / caller size}")
 DEFINE_SIZE_T(wasm_inlining_max_size, 1250,
               "maximum size of a function that can be inlined, in TF nodes")
+DEFINE_INT(wasm_inlining_hot_call_count, 1000,
+           "call count from which the inlining budget of a speculatively "
+           "inlined call site grows with its call count")
 DEFINE_BOOL(wasm_speculative_inlining, false,
-            "enable speculative inlining of call_ref targets (experimental)")
+            "enable speculative inlining of call_ref and call_indirect targets "
+            "(experimental)")
 DEFINE_BOOL(trace_wasm_inlining, false, "trace wasm inlining")
 DEFINE_BOOL(trace_wasm_speculative_inlining, false,
             "trace wasm speculative inlining")
@@ -1111,9 +1204,17 @@ DEFINE_DEBUG_BOOL(trace_wasm_lazy_compilation, false,
                   "trace lazy compilation of wasm functions")
 DEFINE_BOOL(wasm_lazy_validation, false,
             "enable lazy validation for lazily compiled wasm functions")
+DEFINE_BOOL(wasm_lazy_compile_callees, false,
+            "when lazily compiling a wasm function, compile the functions it "
+            "calls directly on background threads")
+DEFINE_BOOL(wasm_share_export_wrappers, true,
+            "let module objects of the same native module in one isolate "
+            "share their JS-to-wasm wrappers")
 DEFINE_BOOL(wasm_simd_ssse3_codegen, false, "allow wasm SIMD SSSE3 codegen")
 
 DEFINE_BOOL(wasm_code_gc, true, "enable garbage collection of wasm code")
+DEFINE_BOOL(wasm_reuse_freed_code_space, true,
+            "allocate new wasm code in code space freed by the wasm code GC")
 DEFINE_BOOL(trace_wasm_code_gc, false, "trace garbage collection of wasm code")
 DEFINE_BOOL(stress_wasm_code_gc, false,
             "stress test garbage collection of wasm code")
@@ -1165,6 +1266,10 @@ DEFINE_SIZE_T(
     "both max_semi_space_size and max_old_space_size take precedence. "
     "All three flags cannot be specified at the same time.")
 DEFINE_SIZE_T(initial_heap_size, 0, "initial size of the heap (in Mbytes)")
+DEFINE_SIZE_T(process_heap_budget, 0,
+              "max combined size of the old spaces of all isolates in the "
+              "process (in Mbytes), split across isolates by allocation "
+              "throughput (0 means unlimited)")
 DEFINE_BOOL(huge_max_old_generation_size, true,
             "Increase max size of the old space to 4 GB for x64 systems with"
             "the physical memory bigger than 16 GB")
@@ -1218,6 +1323,12 @@ DEFINE_BOOL(trace_fragmentation_verbose, false,
             "report fragmentation for old space (detailed)")
 DEFINE_BOOL(minor_mc_trace_fragmentation, false,
             "trace fragmentation after marking")
+DEFINE_BOOL(trace_long_lived_pages, false,
+            "report how much of the marked bytes are on old space pages that "
+            "survived many full GCs")
+DEFINE_UINT(long_lived_page_min_survivals, 3,
+            "number of full GCs a page has to survive to be considered "
+            "long-lived by --trace-long-lived-pages")
 DEFINE_BOOL(trace_evacuation, false, "report evacuation statistics")
 DEFINE_BOOL(trace_mutator_utilization, false,
             "print mutator utilization, allocation speed, gc speed")
@@ -1225,6 +1336,12 @@ DEFINE_BOOL(incremental_marking, true, "use incremental marking")
 DEFINE_BOOL(incremental_marking_wrappers, true,
             "use incremental marking for marking wrappers")
 DEFINE_BOOL(incremental_marking_task, true, "use tasks for incremental marking")
+DEFINE_BOOL(skip_marking_steps_when_ahead, true,
+            "skip main-thread marking steps on allocation while concurrent "
+            "marking keeps the marker ahead of schedule")
+DEFINE_BOOL(rail_response_defers_marking_tasks, true,
+            "postpone task-based incremental marking steps while the embedder "
+            "is in RAIL response mode and run them once it leaves that mode")
 DEFINE_INT(incremental_marking_soft_trigger, 0,
            "threshold for starting incremental marking via a task in percent "
            "of available space: limit - size")
@@ -1233,12 +1350,22 @@ DEFINE_INT(incremental_marking_hard_trigger, 0,
            "of available space: limit - size")
 DEFINE_BOOL(trace_unmapper, false, "Trace the unmapping")
 DEFINE_BOOL(parallel_scavenge, true, "parallel scavenge")
+DEFINE_BOOL(parallel_scavenge_weak_processing, true,
+            "clear young ephemeron tables in parallel during scavenge")
 DEFINE_BOOL(scavenge_task, true, "schedule scavenge tasks")
+DEFINE_BOOL(scavenge_copy_small_slices, true,
+            "copy short string slices of much longer parents during "
+            "scavenges, so that they do not keep the parent alive")
 DEFINE_INT(scavenge_task_trigger, 80,
            "scavenge task trigger in percent of the current heap limit")
 DEFINE_BOOL(scavenge_separate_stack_scanning, false,
             "use a separate phase for stack scanning in scavenge")
 DEFINE_BOOL(trace_parallel_scavenge, false, "trace parallel scavenge")
+DEFINE_BOOL(string_deduplication, false,
+            "make equal old-space strings share their characters after full "
+            "garbage collections")
+DEFINE_INT(string_deduplication_min_length, 16,
+           "minimum length of the strings to deduplicate")
 #if MUST_WRITE_PROTECT_CODE_MEMORY
 DEFINE_BOOL_READONLY(write_protect_code_memory, true,
                      "write protect code memory")
@@ -1254,6 +1381,10 @@ DEFINE_BOOL(concurrent_marking, V8_CONCURRENT_MARKING_BOOL,
             "use concurrent marking")
 DEFINE_BOOL(concurrent_array_buffer_sweeping, true,
             "concurrently sweep array buffers")
+DEFINE_SIZE_T(background_large_object_slack, 1024,
+              "max size of large objects (in KBytes) a background thread may "
+              "allocate beyond the old generation limit between GCs instead "
+              "of waiting for the main thread to perform a GC")
 DEFINE_BOOL(stress_concurrent_allocation, false,
             "start background threads that allocate memory")
 DEFINE_BOOL(parallel_marking, V8_CONCURRENT_MARKING_BOOL,
@@ -1263,7 +1394,17 @@ DEFINE_INT(ephemeron_fixpoint_iterations, 10,
            "ephemeron algorithm")
 DEFINE_BOOL(trace_concurrent_marking, false, "trace concurrent marking")
 DEFINE_BOOL(concurrent_sweeping, true, "use concurrent sweeping")
+DEFINE_UINT(max_pooled_paged_space_pages, 16,
+            "max number of released old generation pages that are kept "
+            "uncommitted for reuse instead of being unmapped")
+DEFINE_INT(context_allocation_sample_interval, 16 * KB,
+           "bytes allocated between samples that attribute allocations to "
+           "the current context once per-context limits are used")
 DEFINE_BOOL(parallel_compaction, true, "use parallel compaction")
+DEFINE_FLOAT(compaction_pause_budget_ms, 0,
+             "if positive, bounds the bytes selected for compaction in "
+             "latency-critical GCs such that evacuating them on a single "
+             "thread is expected to take at most the given time")
 DEFINE_BOOL(parallel_pointer_update, true,
             "use parallel pointer update during compaction")
 DEFINE_BOOL(detect_ineffective_gcs_near_heap_limit, true,
@@ -1289,6 +1430,9 @@ DEFINE_GENERIC_IMPLICATION(
     trace_zone_type_stats,
     TracingFlags::zone_stats.store(
         v8::tracing::TracingCategoryObserver::ENABLED_BY_NATIVE))
+DEFINE_SIZE_T(zone_segment_pool_size, 8 * MB,
+              "maximum size in bytes of the free zone segments kept for reuse "
+              "by all threads (0 disables the pool)")
 DEFINE_BOOL(track_retaining_path, false,
             "enable support for tracking retaining path")
 DEFINE_DEBUG_BOOL(trace_backing_store, false, "trace backing store events")
@@ -1319,20 +1463,36 @@ DEFINE_BOOL(move_object_start, true, "enable moving of object starts")
 DEFINE_BOOL(memory_reducer, true, "use memory reducer")
 DEFINE_BOOL(memory_reducer_for_small_heaps, true,
             "use memory reducer for small heaps")
+DEFINE_BOOL(migrate_deprecated_instances, false,
+            "after a full GC, migrate objects off deprecated maps in a "
+            "foreground task so that the next full GC can free those maps")
 DEFINE_INT(heap_growing_percent, 0,
            "specifies heap growing factor as (1 + heap_growing_percent/100)")
 DEFINE_INT(v8_os_page_size, 0, "override OS page size (in KBytes)")
+DEFINE_BOOL(retain_read_only_heap, false,
+            "keep the shared read-only heap alive after the last isolate is "
+            "disposed, so that later isolates, including those of forked "
+            "child processes, reuse it instead of deserializing it again")
 DEFINE_BOOL(allocation_buffer_parking, true, "allocation buffer parking")
 DEFINE_BOOL(always_compact, false, "Perform compaction on every full GC")
 DEFINE_BOOL(never_compact, false,
             "Never perform compaction on full GC - testing only")
 DEFINE_BOOL(compact_code_space, true, "Compact code space on full collections")
+DEFINE_BOOL(pack_code_pages, false,
+            "allocate code pages downwards from the embedded builtins in the "
+            "code range, to keep executed code close together")
+DEFINE_BOOL(huge_code_pages, false,
+            "back the code range, including the remapped embedded builtins, "
+            "with transparent huge pages where the OS supports it")
 DEFINE_BOOL(flush_baseline_code, false,
             "flush of baseline code when it has not been executed recently")
 DEFINE_BOOL(flush_bytecode, true,
             "flush of bytecode when it has not been executed recently")
 DEFINE_BOOL(stress_flush_code, false, "stress code flushing")
 DEFINE_BOOL(trace_flush_bytecode, false, "trace bytecode flushing")
+DEFINE_SIZE_T(bytecode_flush_budget, 0,
+              "size in MB of live bytecode below which bytecode stops aging "
+              "and is not flushed (0 means bytecode always ages)")
 DEFINE_BOOL(use_marking_progress_bar, true,
             "Use a progress bar to scan large objects in increments when "
             "incremental marking is active.")
@@ -1564,6 +1724,9 @@ DEFINE_BOOL(cache_prototype_transitions, true, "cache prototype transitions")
 
 // lazy-compile-dispatcher.cc
 DEFINE_BOOL(parallel_compile_tasks, false, "enable parallel compile tasks")
+DEFINE_INT(parallel_compile_lazy_function_size, 0,
+           "also compile lazy top level functions with at least this many "
+           "characters in parallel compile tasks (0 means never)")
 DEFINE_BOOL(lazy_compile_dispatcher, false, "enable compiler dispatcher")
 DEFINE_IMPLICATION(parallel_compile_tasks, lazy_compile_dispatcher)
 DEFINE_BOOL(trace_compiler_dispatcher, false,
@@ -1572,6 +1735,12 @@ DEFINE_BOOL(trace_compiler_dispatcher, false,
 // cpu-profiler.cc
 DEFINE_INT(cpu_profiler_sampling_interval, 1000,
            "CPU profiler sampling interval in microseconds")
+DEFINE_BOOL(cpu_profiler_shared_sampler, false,
+            "trigger the samples of all CPU profilers from one shared thread")
+DEFINE_BOOL(cpu_profiler_cpu_time_sampling, false,
+            "sample each profiled thread from a timer on its own CPU time "
+            "where supported (Linux), rather than signalling it from the "
+            "profiler thread")
 
 // debugger
 DEFINE_BOOL(
@@ -1756,14 +1925,43 @@ DEFINE_IMPLICATION(rcs, runtime_call_stats)
 DEFINE_BOOL(rcs_cpu_time, false,
             "report runtime times in cpu time (the default is wall time)")
 DEFINE_IMPLICATION(rcs_cpu_time, rcs)
+DEFINE_INT(rcs_sampling_rate, 1,
+           "only time one in every N outermost runtime call stats scopes and "
+           "scale the counters accordingly")
+DEFINE_BOOL(rcs_metrics, false,
+            "report the main thread's runtime call stats to the embedder's "
+            "metrics recorder")
+DEFINE_GENERIC_IMPLICATION(
+    rcs_metrics,
+    TracingFlags::runtime_stats.store(
+        v8::tracing::TracingCategoryObserver::ENABLED_BY_NATIVE))
+DEFINE_INT(rcs_metrics_interval, 10,
+           "interval in seconds between the --rcs-metrics reports")
 
 // snapshot-common.cc
 DEFINE_BOOL(skip_snapshot_checksum, false,
             "Skip snapshot checksum calculation when deserializing an Isolate.")
+DEFINE_BOOL(cache_snapshot_blobs, false,
+            "verify the checksum of each snapshot blob and decompress its "
+            "sections only once per process, and reuse the results for all "
+            "further isolates and contexts created from it; the blobs must "
+            "stay alive and unmodified for the lifetime of the process")
+DEFINE_BOOL(parallel_snapshot_decompression, false,
+            "when creating an isolate from a compressed snapshot, decompress "
+            "the startup section on a worker thread while the main thread "
+            "decompresses the other sections")
 DEFINE_BOOL(profile_deserialization, false,
             "Print the time it takes to deserialize the snapshot.")
 DEFINE_BOOL(serialization_statistics, false,
             "Collect statistics on serialized objects.")
+DEFINE_INT(snapshot_compression_level, -1,
+           "zlib compression level used for snapshot sections in builds with "
+           "snapshot compression, from 0 (store only) to 9 (smallest), or -1 "
+           "for the zlib default")
+DEFINE_BOOL(snapshot_keep_only_warm_code, false,
+            "when creating a snapshot that keeps function code, discard the "
+            "code of functions that never allocated a feedback vector; they "
+            "are compiled from source on their first call instead")
 // Regexp
 DEFINE_BOOL(regexp_optimization, true, "generate optimized regexp code")
 DEFINE_BOOL(regexp_interpret_all, false, "interpret all regexp code")
@@ -1779,6 +1977,16 @@ DEFINE_NEG_IMPLICATION(regexp_interpret_all, regexp_tier_up)
 DEFINE_INT(regexp_tier_up_ticks, 1,
            "set the number of executions for the regexp interpreter before "
            "tiering-up to the compiler")
+DEFINE_INT(regexp_tier_up_chars_per_tick, 100,
+           "count an additional tier up tick for each this many characters of "
+           "the subject string of an interpreted execution (0 to disable)")
+DEFINE_BOOL(regexp_shared_bytecode_cache, false,
+            "share regexp bytecode between isolates in a process-wide cache")
+DEFINE_INT(regexp_shared_bytecode_cache_size, 1024,
+           "maximum number of entries of the shared regexp bytecode cache")
+DEFINE_BOOL(regexp_skip_with_memchr, true,
+            "skip to the next occurrence of a required character with memchr "
+            "in native one-byte regexp code")
 DEFINE_BOOL(regexp_peephole_optimization, REGEXP_PEEPHOLE_OPTIMIZATION_BOOL,
             "enable peephole optimization for regexp bytecode")
 DEFINE_BOOL(trace_regexp_peephole_optimization, false,
@@ -1846,6 +2054,10 @@ DEFINE_BOOL(target_is_simulator, false,
 DEFINE_STRING(turbo_profiling_log_file, nullptr,
               "Path of the input file containing basic block counters for "
               "builtins. (mksnapshot only)")
+DEFINE_BOOL(reorder_builtins, false,
+            "Lay out the embedded builtins by their call counts in "
+            "--turbo-profiling-log-file, most frequently called first. "
+            "(mksnapshot only)")
 
 // On some platforms, the .text section only has execute permissions.
 DEFINE_BOOL(text_is_readable, true,
@@ -1859,6 +2071,9 @@ DEFINE_NEG_NEG_IMPLICATION(text_is_readable, partial_constant_pool)
 DEFINE_BOOL(trace_minor_mc_parallel_marking, false,
             "trace parallel marking for the young generation")
 DEFINE_BOOL(minor_mc, false, "perform young generation mark compact GCs")
+DEFINE_BOOL(minor_mc_concurrent_sweeping, true,
+            "sweep pages promoted to old space by the minor mark-compactor "
+            "on the concurrent sweeper")
 #else
 DEFINE_BOOL_READONLY(minor_mc, false,
                      "perform young generation mark compact GCs")
@@ -2050,7 +2265,10 @@ DEFINE_PERF_PROF_BOOL(
 DEFINE_PERF_PROF_BOOL(
     perf_prof_delete_file,
     "Remove the perf file right after creating it (for testing only).")
-DEFINE_NEG_IMPLICATION(perf_prof, compact_code_space)
+DEFINE_PERF_PROF_BOOL(
+    perf_prof_async_writer,
+    "Write the --perf-prof and --perf-basic-prof files from a background "
+    "thread.")
 // TODO(v8:8462) Remove implication once perf supports remapping.
 #if !MUST_WRITE_PROTECT_CODE_MEMORY
 DEFINE_NEG_IMPLICATION(perf_prof, write_protect_code_memory)
@@ -2184,6 +2402,7 @@ DEFINE_BOOL(single_threaded, false, "disable the use of background tasks")
 DEFINE_IMPLICATION(single_threaded, single_threaded_gc)
 DEFINE_NEG_IMPLICATION(single_threaded, concurrent_recompilation)
 DEFINE_NEG_IMPLICATION(single_threaded, lazy_compile_dispatcher)
+DEFINE_NEG_IMPLICATION(single_threaded, parallel_snapshot_decompression)
 DEFINE_NEG_IMPLICATION(single_threaded, stress_concurrent_inlining)
 
 //
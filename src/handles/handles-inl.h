@@ -79,6 +79,61 @@ inline std::ostream& operator<<(std::ostream& os, Handle<T> handle) {
   return os << Brief(*handle);
 }
 
+#ifdef V8_ENABLE_DIRECT_HANDLE
+
+template <typename T>
+DirectHandle<T>::DirectHandle(T object, Isolate* isolate)
+    : object_(object.ptr()) {}
+
+template <typename T>
+template <typename S, typename>
+DirectHandle<T>::DirectHandle(Handle<S> handle)
+    : object_(handle.is_null() ? kNullAddress : handle->ptr()) {}
+
+template <typename T>
+bool DirectHandle<T>::is_null() const {
+  return object_ == kNullAddress;
+}
+
+template <typename T>
+T DirectHandle<T>::operator*() const {
+  DCHECK(!is_null());
+  return T::unchecked_cast(Object(object_));
+}
+
+template <typename T>
+Handle<T> DirectHandle<T>::ToHandle(Isolate* isolate) const {
+  if (is_null()) return Handle<T>();
+  return Handle<T>(**this, isolate);
+}
+
+#else
+
+template <typename T>
+DirectHandle<T>::DirectHandle(T object, Isolate* isolate)
+    : handle_(object, isolate) {}
+
+template <typename T>
+template <typename S, typename>
+DirectHandle<T>::DirectHandle(Handle<S> handle) : handle_(handle) {}
+
+template <typename T>
+bool DirectHandle<T>::is_null() const {
+  return handle_.is_null();
+}
+
+template <typename T>
+T DirectHandle<T>::operator*() const {
+  return *handle_;
+}
+
+template <typename T>
+Handle<T> DirectHandle<T>::ToHandle(Isolate* isolate) const {
+  return handle_;
+}
+
+#endif  // V8_ENABLE_DIRECT_HANDLE
+
 HandleScope::HandleScope(Isolate* isolate) {
   HandleScopeData* data = isolate->handle_scope_data();
   isolate_ = isolate;
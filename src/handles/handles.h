@@ -13,6 +13,11 @@
 #include "src/common/globals.h"
 #include "src/zone/zone.h"
 
+#if defined(V8_ENABLE_DIRECT_HANDLE) && \
+    !defined(V8_ENABLE_CONSERVATIVE_STACK_SCANNING)
+#error "Direct handles require conservative stack scanning"
+#endif
+
 namespace v8 {
 
 class HandleScope;
@@ -184,6 +189,57 @@ class Handle final : public HandleBase {
 template <typename T>
 inline std::ostream& operator<<(std::ostream& os, Handle<T> handle);
 
+// ----------------------------------------------------------------------------
+// A DirectHandle refers to an object like a Handle, but in builds with
+// V8_ENABLE_DIRECT_HANDLE it holds the object itself instead of a slot in the
+// current HandleScope. Creating one then costs no handle block allocation.
+// Such builds scan the stack conservatively, which keeps the objects that
+// DirectHandles refer to alive and pins them in place. DirectHandles must
+// therefore only ever live on the stack. In other builds they are backed by
+// a regular Handle, so code using them works in all configurations.
+template <typename T>
+class DirectHandle final {
+ public:
+  // See Handle::ObjectRef.
+  class ObjectRef {
+   public:
+    T* operator->() { return &object_; }
+
+   private:
+    friend class DirectHandle<T>;
+    explicit ObjectRef(T object) : object_(object) {}
+
+    T object_;
+  };
+
+  V8_INLINE DirectHandle() = default;
+  V8_INLINE DirectHandle(T object, Isolate* isolate);
+
+  template <typename S, typename = typename std::enable_if<
+                            std::is_convertible<S*, T*>::value>::type>
+  V8_INLINE DirectHandle(Handle<S> handle);
+
+  V8_INLINE bool is_null() const;
+
+  V8_INLINE ObjectRef operator->() const { return ObjectRef{**this}; }
+  V8_INLINE T operator*() const;
+
+  // Returns a Handle in the current HandleScope, for passing the object to
+  // code that takes Handles.
+  V8_INLINE Handle<T> ToHandle(Isolate* isolate) const;
+
+ private:
+#ifdef V8_ENABLE_DIRECT_HANDLE
+  Address object_ = kNullAddress;
+#else
+  Handle<T> handle_;
+#endif  // V8_ENABLE_DIRECT_HANDLE
+
+  // Prevent heap allocation, which conservative stack scanning would miss.
+  void* operator new(size_t size) = delete;
+  void operator delete(void* size_t) = delete;
+};
+
 // ----------------------------------------------------------------------------
 // A stack-allocated class that governs a number of local handles.
 // After a handle scope has been created, all local handles will be
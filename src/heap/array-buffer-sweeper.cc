@@ -85,6 +85,10 @@ struct ArrayBufferSweeper::SweepingJob final {
   void SweepFull();
   ArrayBufferList SweepListFull(ArrayBufferList* list);
 
+  // Frees the extension right away or queues it on |dead_| when freeing is
+  // deferred.
+  void Free(ArrayBufferExtension* extension);
+
  private:
   CancelableTaskManager::Id id_ = CancelableTaskManager::kInvalidTaskId;
   std::atomic<SweepingState> state_;
@@ -92,6 +96,10 @@ struct ArrayBufferSweeper::SweepingJob final {
   ArrayBufferList old_;
   const SweepingType type_;
   std::atomic<size_t> freed_bytes_{0};
+  // Set when the job is run on the main thread and dead extensions should be
+  // released concurrently after finalization.
+  bool defer_free_ = false;
+  ArrayBufferExtension* dead_ = nullptr;
 
   friend class ArrayBufferSweeper;
 };
@@ -100,6 +108,7 @@ ArrayBufferSweeper::ArrayBufferSweeper(Heap* heap) : heap_(heap) {}
 
 ArrayBufferSweeper::~ArrayBufferSweeper() {
   EnsureFinished();
+  EnsureReleaseFinished();
   ReleaseAll(&old_);
   ReleaseAll(&young_);
 }
@@ -113,7 +122,11 @@ void ArrayBufferSweeper::EnsureFinished() {
 
   switch (abort_result) {
     case TryAbortResult::kTaskAborted:
-      // Task has not run, so we need to run it synchronously here.
+      // Task has not run, so we need to run it synchronously here. Releasing
+      // the dead extensions is not needed to finish sweeping, so it is left
+      // to a background thread unless memory should be reduced right away.
+      job_->defer_free_ =
+          !heap_->IsTearingDown() && !heap_->ShouldReduceMemory();
       job_->Sweep();
       break;
     case TryAbortResult::kTaskRemoved:
@@ -198,8 +211,67 @@ void ArrayBufferSweeper::Finalize() {
   const size_t freed_bytes =
       job_->freed_bytes_.exchange(0, std::memory_order_relaxed);
   DecrementExternalMemoryCounters(freed_bytes);
+  ArrayBufferExtension* dead = job_->dead_;
   job_.reset();
   DCHECK(!sweeping_in_progress());
+  ReleaseDeadConcurrently(dead);
+}
+
+void ArrayBufferSweeper::ReleaseDeadConcurrently(ArrayBufferExtension* dead) {
+  if (!dead) return;
+  // At most one release task is in flight at any time.
+  EnsureReleaseFinished();
+  if (heap_->IsTearingDown() || !FLAG_concurrent_array_buffer_sweeping) {
+    ReleaseDead(dead);
+    return;
+  }
+  pending_release_ = dead;
+  release_done_ = false;
+  auto task = MakeCancelableTask(heap_->isolate(), [this] {
+    TRACE_GC_EPOCH(heap_->tracer(),
+                   GCTracer::Scope::BACKGROUND_ARRAY_BUFFER_RELEASE,
+                   ThreadKind::kBackground);
+    base::MutexGuard guard(&sweeping_mutex_);
+    ReleaseDead(pending_release_);
+    pending_release_ = nullptr;
+    release_done_ = true;
+    release_finished_.NotifyAll();
+  });
+  release_task_id_ = task->id();
+  V8::GetCurrentPlatform()->CallOnWorkerThread(std::move(task));
+}
+
+void ArrayBufferSweeper::EnsureReleaseFinished() {
+  if (release_task_id_ == CancelableTaskManager::kInvalidTaskId) return;
+  TryAbortResult abort_result =
+      heap_->isolate()->cancelable_task_manager()->TryAbort(release_task_id_);
+  switch (abort_result) {
+    case TryAbortResult::kTaskAborted:
+      ReleaseDead(pending_release_);
+      pending_release_ = nullptr;
+      break;
+    case TryAbortResult::kTaskRemoved:
+      break;
+    case TryAbortResult::kTaskRunning: {
+      base::MutexGuard guard(&sweeping_mutex_);
+      while (!release_done_) {
+        release_finished_.Wait(&sweeping_mutex_);
+      }
+      break;
+    }
+  }
+  DCHECK_NULL(pending_release_);
+  release_done_ = true;
+  release_task_id_ = CancelableTaskManager::kInvalidTaskId;
+}
+
+// static
+void ArrayBufferSweeper::ReleaseDead(ArrayBufferExtension* dead) {
+  while (dead) {
+    ArrayBufferExtension* next = dead->next();
+    delete dead;
+    dead = next;
+  }
 }
 
 void ArrayBufferSweeper::ReleaseAll(ArrayBufferList* list) {
@@ -282,6 +354,15 @@ void ArrayBufferSweeper::SweepingJob::Sweep() {
   state_ = SweepingState::kDone;
 }
 
+void ArrayBufferSweeper::SweepingJob::Free(ArrayBufferExtension* extension) {
+  if (defer_free_) {
+    extension->set_next(dead_);
+    dead_ = extension;
+  } else {
+    delete extension;
+  }
+}
+
 void ArrayBufferSweeper::SweepingJob::SweepFull() {
   DCHECK_EQ(SweepingType::kFull, type_);
   ArrayBufferList promoted = SweepListFull(&young_);
@@ -301,7 +382,7 @@ ArrayBufferList ArrayBufferSweeper::SweepingJob::SweepListFull(
 
     if (!current->IsMarked()) {
       const size_t bytes = current->accounting_length();
-      delete current;
+      Free(current);
       if (bytes) freed_bytes_.fetch_add(bytes, std::memory_order_relaxed);
     } else {
       current->Unmark();
@@ -327,7 +408,7 @@ void ArrayBufferSweeper::SweepingJob::SweepYoung() {
 
     if (!current->IsYoungMarked()) {
       size_t bytes = current->accounting_length();
-      delete current;
+      Free(current);
       if (bytes) freed_bytes_.fetch_add(bytes, std::memory_order_relaxed);
     } else if (current->IsYoungPromoted()) {
       current->YoungUnmark();
@@ -87,10 +87,22 @@ class ArrayBufferSweeper final {
 
   void ReleaseAll(ArrayBufferList* extension);
 
+  // Deletes the given chain of dead extensions, which releases their backing
+  // stores, on a background thread so that the main thread does not pay for
+  // the frees after sweeping synchronously.
+  void ReleaseDeadConcurrently(ArrayBufferExtension* dead);
+  void EnsureReleaseFinished();
+  static void ReleaseDead(ArrayBufferExtension* dead);
+
   Heap* const heap_;
   std::unique_ptr<SweepingJob> job_;
   base::Mutex sweeping_mutex_;
   base::ConditionVariable job_finished_;
+  CancelableTaskManager::Id release_task_id_ =
+      CancelableTaskManager::kInvalidTaskId;
+  ArrayBufferExtension* pending_release_ = nullptr;
+  bool release_done_ = true;
+  base::ConditionVariable release_finished_;
   ArrayBufferList young_;
   ArrayBufferList old_;
 };
@@ -0,0 +1,47 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/bytecode-flushing-policy.h"
+
+#include "src/execution/isolate.h"
+#include "src/flags/flags.h"
+#include "src/utils/utils.h"
+
+namespace v8 {
+namespace internal {
+
+BytecodeFlushingPolicy::BytecodeFlushingPolicy() { StartMarking(); }
+
+void BytecodeFlushingPolicy::StartMarking() {
+  for (std::atomic<size_t>& bytes : live_bytes_by_age_) {
+    bytes.store(0, std::memory_order_relaxed);
+  }
+}
+
+void BytecodeFlushingPolicy::UpdateAfterMarking(Isolate* isolate) {
+  size_t live_bytes = 0;
+  for (const std::atomic<size_t>& bytes : live_bytes_by_age_) {
+    live_bytes += bytes.load(std::memory_order_relaxed);
+  }
+  live_bytecode_size_ = live_bytes;
+
+  const size_t budget = FLAG_bytecode_flush_budget * MB;
+  pause_aging_ = budget > 0 && live_bytes <= budget;
+
+  if (FLAG_trace_flush_bytecode && budget > 0) {
+    PrintIsolate(isolate,
+                 "bytecode flushing: live %zuKB, budget %zuKB, aging %s, "
+                 "by age [",
+                 live_bytes / KB, budget / KB,
+                 pause_aging_ ? "paused" : "active");
+    for (int age = 0; age < kAgeCount; age++) {
+      PrintF("%s%zuKB", age > 0 ? ", " : "",
+             live_bytes_by_age_[age].load(std::memory_order_relaxed) / KB);
+    }
+    PrintF("]\n");
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,70 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_BYTECODE_FLUSHING_POLICY_H_
+#define V8_HEAP_BYTECODE_FLUSHING_POLICY_H_
+
+#include <atomic>
+
+#include "src/common/globals.h"
+#include "src/objects/code.h"
+
+namespace v8 {
+namespace internal {
+
+class Isolate;
+
+// Adapts bytecode aging to a budget for live bytecode (see
+// --bytecode-flush-budget). Every full marking records a histogram of the
+// marked BytecodeArrays by age. If the live bytecode fits into the budget,
+// the next marking leaves bytecode ages unchanged, so nothing becomes old
+// enough to be flushed; otherwise bytecode ages as usual and the oldest
+// arrays are flushed first. Without a budget, bytecode always ages.
+class V8_EXPORT_PRIVATE BytecodeFlushingPolicy final {
+ public:
+  static constexpr int kAgeCount = BytecodeArray::kAfterLastBytecodeAge;
+
+  BytecodeFlushingPolicy();
+  BytecodeFlushingPolicy(const BytecodeFlushingPolicy&) = delete;
+  BytecodeFlushingPolicy& operator=(const BytecodeFlushingPolicy&) = delete;
+
+  // Clears the age histogram. Called when full marking starts.
+  void StartMarking();
+
+  // Records a marked BytecodeArray. May be called by concurrent markers.
+  void RecordLiveBytecode(int age, size_t size) {
+    DCHECK_LE(0, age);
+    DCHECK_LT(age, kAgeCount);
+    live_bytes_by_age_[age].fetch_add(size, std::memory_order_relaxed);
+  }
+
+  // Decides from the histogram of the finished marking whether the next one
+  // ages bytecode. Called in the atomic pause after bytecode was flushed.
+  void UpdateAfterMarking(Isolate* isolate);
+
+  bool ShouldPauseAging() const { return pause_aging_; }
+
+  void NotifyBytecodeFlushed() { flushed_count_++; }
+  void NotifyFlushedBytecodeRecompiled() { recompiled_count_++; }
+
+  // Bytes of bytecode marked live by the last full marking. Only recorded
+  // when a budget is set.
+  size_t live_bytecode_size() const { return live_bytecode_size_; }
+  // Number of functions whose bytecode was flushed.
+  size_t flushed_count() const { return flushed_count_; }
+  // Number of functions compiled again after their bytecode was flushed.
+  size_t recompiled_count() const { return recompiled_count_; }
+
+ private:
+  std::atomic<size_t> live_bytes_by_age_[kAgeCount];
+  size_t live_bytecode_size_ = 0;
+  size_t flushed_count_ = 0;
+  size_t recompiled_count_ = 0;
+  bool pause_aging_ = false;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_BYTECODE_FLUSHING_POLICY_H_
@@ -6,6 +6,7 @@
 
 #include "src/base/bits.h"
 #include "src/base/lazy-instance.h"
+#include "src/base/platform/platform.h"
 #include "src/common/globals.h"
 #include "src/flags/flags.h"
 #include "src/heap/heap-inl.h"
@@ -146,9 +147,23 @@ bool CodeRange::InitReservation(v8::PageAllocator* page_allocator,
     }
   }
 
+  if (FLAG_huge_code_pages) {
+    AdviseHugePages(page_allocator_->begin(), page_allocator_->size());
+  }
+
   return true;
 }
 
+void CodeRange::AdviseHugePages(Address start, size_t size) {
+  Address huge_start = RoundUp(start, kHugePageSizeForCode);
+  Address huge_end = RoundDown(start + size, kHugePageSizeForCode);
+  if (huge_end <= huge_start) return;
+  if (base::OS::AdviseHugePages(reinterpret_cast<void*>(huge_start),
+                                huge_end - huge_start)) {
+    huge_page_size_ += huge_end - huge_start;
+  }
+}
+
 void CodeRange::Free() {
   if (IsReserved()) {
     GetCodeRangeAddressHint()->NotifyFreedCodeRange(
@@ -178,16 +193,20 @@ uint8_t* CodeRange::RemapEmbeddedBuiltins(Isolate* isolate,
   }
 
   const size_t kAllocatePageSize = page_allocator()->AllocatePageSize();
-  size_t allocate_code_size =
-      RoundUp(embedded_blob_code_size, kAllocatePageSize);
+  // With huge pages, give the builtins whole huge pages of their own so that
+  // they are not split between huge and regular pages.
+  const size_t alignment =
+      FLAG_huge_code_pages ? std::max(kAllocatePageSize, kHugePageSizeForCode)
+                           : kAllocatePageSize;
+  size_t allocate_code_size = RoundUp(embedded_blob_code_size, alignment);
 
   // Allocate the re-embedded code blob in the end.
-  void* hint = reinterpret_cast<void*>(code_region.end() - allocate_code_size);
+  void* hint = reinterpret_cast<void*>(
+      RoundDown(code_region.end() - allocate_code_size, alignment));
 
   embedded_blob_code_copy =
       reinterpret_cast<uint8_t*>(page_allocator()->AllocatePages(
-          hint, allocate_code_size, kAllocatePageSize,
-          PageAllocator::kNoAccess));
+          hint, allocate_code_size, alignment, PageAllocator::kNoAccess));
 
   if (!embedded_blob_code_copy) {
     V8::FatalProcessOutOfMemory(
@@ -215,6 +234,27 @@ uint8_t* CodeRange::RemapEmbeddedBuiltins(Isolate* isolate,
   return embedded_blob_code_copy;
 }
 
+Address CodeRange::GetPackedPageHint(size_t size, size_t alignment) {
+  Address start = packed_pages_start_.load(std::memory_order_relaxed);
+  if (start == kNullAddress) {
+    uint8_t* embedded_blob_code_copy = this->embedded_blob_code_copy();
+    start = embedded_blob_code_copy
+                ? reinterpret_cast<Address>(embedded_blob_code_copy)
+                : page_allocator()->begin() + page_allocator()->size();
+  }
+  if (start - page_allocator()->begin() < size) return kNullAddress;
+  return RoundDown(start - size, alignment);
+}
+
+void CodeRange::NotifyPackedPageAllocated(Address hint, Address base) {
+  if (hint == kNullAddress || base != hint) return;
+  Address start = packed_pages_start_.load(std::memory_order_relaxed);
+  while ((start == kNullAddress || base < start) &&
+         !packed_pages_start_.compare_exchange_weak(
+             start, base, std::memory_order_relaxed)) {
+  }
+}
+
 // static
 std::shared_ptr<CodeRange> CodeRange::EnsureProcessWideCodeRange(
     v8::PageAllocator* page_allocator, size_t requested_size) {
@@ -110,6 +110,10 @@ class CodeRange final : public VirtualMemoryCage {
 
   bool InitReservation(v8::PageAllocator* page_allocator, size_t requested);
 
+  // The number of bytes of this CodeRange that the OS agreed to back with
+  // transparent huge pages with --huge-code-pages.
+  size_t huge_page_size() const { return huge_page_size_; }
+
   void Free();
 
   // Remap and copy the embedded builtins into this CodeRange. This method is
@@ -125,6 +129,18 @@ class CodeRange final : public VirtualMemoryCage {
                                  const uint8_t* embedded_blob_code,
                                  size_t embedded_blob_code_size);
 
+  // Returns an address hint for allocating a code page of {size} bytes with
+  // --pack-code-pages. Code pages are then allocated downwards, starting
+  // right below the remapped embedded builtins (or the end of the code range
+  // if they are not remapped), so that code sits together with the builtins
+  // it calls instead of at the far end of the range. Returns kNullAddress if
+  // the packed area is exhausted.
+  Address GetPackedPageHint(size_t size, size_t alignment);
+
+  // Moves the packed area down if the page at {base} was allocated at the
+  // {hint} returned by GetPackedPageHint.
+  void NotifyPackedPageAllocated(Address hint, Address base);
+
   static std::shared_ptr<CodeRange> EnsureProcessWideCodeRange(
       v8::PageAllocator* page_allocator, size_t requested_size);
 
@@ -133,6 +149,14 @@ class CodeRange final : public VirtualMemoryCage {
   V8_EXPORT_PRIVATE static std::shared_ptr<CodeRange> GetProcessWideCodeRange();
 
  private:
+  // The size of the huge pages requested with --huge-code-pages.
+  static constexpr size_t kHugePageSizeForCode = 2 * MB;
+
+  // Advises the OS to back the part of [start, start + size) that consists of
+  // whole huge pages with huge pages. Without OS support, the range keeps its
+  // regular pages.
+  void AdviseHugePages(Address start, size_t size);
+
   // Used when short builtin calls are enabled, where embedded builtins are
   // copied into the CodeRange so calls can be nearer.
   std::atomic<uint8_t*> embedded_blob_code_copy_{nullptr};
@@ -141,6 +165,13 @@ class CodeRange final : public VirtualMemoryCage {
   // race during Isolate::Init.
   base::Mutex remap_embedded_builtins_mutex_;
 
+  // The lowest address of the code pages allocated with --pack-code-pages.
+  // Races between Isolates sharing the CodeRange can only cause a hint to
+  // miss, which makes the allocation fall back to the regular placement.
+  std::atomic<Address> packed_pages_start_{kNullAddress};
+
+  size_t huge_page_size_ = 0;
+
 #ifdef V8_OS_WIN64
   std::atomic<uint32_t> unwindinfo_use_count_{0};
 #endif
@@ -394,11 +394,13 @@ class ConcurrentMarking::JobTask : public v8::JobTask {
       concurrent_marking_->Run(delegate, code_flush_mode_, mark_compact_epoch_,
                                should_keep_ages_unchanged_);
     } else {
-      TRACE_GC_EPOCH(concurrent_marking_->heap_->tracer(),
-                     GCTracer::Scope::MC_BACKGROUND_MARKING,
-                     ThreadKind::kBackground);
-      concurrent_marking_->Run(delegate, code_flush_mode_, mark_compact_epoch_,
-                               should_keep_ages_unchanged_);
+      size_t marked_bytes = 0;
+      TRACE_GC_EPOCH_WITH_BYTES(concurrent_marking_->heap_->tracer(),
+                                GCTracer::Scope::MC_BACKGROUND_MARKING,
+                                ThreadKind::kBackground, marked_bytes);
+      marked_bytes = concurrent_marking_->Run(delegate, code_flush_mode_,
+                                              mark_compact_epoch_,
+                                              should_keep_ages_unchanged_);
     }
   }
 
@@ -429,10 +431,10 @@ ConcurrentMarking::ConcurrentMarking(Heap* heap,
 #endif
 }
 
-void ConcurrentMarking::Run(JobDelegate* delegate,
-                            base::EnumSet<CodeFlushMode> code_flush_mode,
-                            unsigned mark_compact_epoch,
-                            bool should_keep_ages_unchanged) {
+size_t ConcurrentMarking::Run(JobDelegate* delegate,
+                              base::EnumSet<CodeFlushMode> code_flush_mode,
+                              unsigned mark_compact_epoch,
+                              bool should_keep_ages_unchanged) {
   size_t kBytesUntilInterruptCheck = 64 * KB;
   int kObjectsUntilInterrupCheck = 1000;
   uint8_t task_id = delegate->GetTaskId() + 1;
@@ -562,6 +564,7 @@ void ConcurrentMarking::Run(JobDelegate* delegate,
         "Task %d concurrently marked %dKB in %.2fms\n", task_id,
         static_cast<int>(marked_bytes / KB), time_ms);
   }
+  return marked_bytes;
 }
 
 size_t ConcurrentMarking::GetMaxConcurrency(size_t worker_count) {
@@ -107,8 +107,10 @@ class V8_EXPORT_PRIVATE ConcurrentMarking {
     char cache_line_padding[64];
   };
   class JobTask;
-  void Run(JobDelegate* delegate, base::EnumSet<CodeFlushMode> code_flush_mode,
-           unsigned mark_compact_epoch, bool should_keep_ages_unchanged);
+  // Returns the number of bytes marked by this invocation.
+  size_t Run(JobDelegate* delegate,
+             base::EnumSet<CodeFlushMode> code_flush_mode,
+             unsigned mark_compact_epoch, bool should_keep_ages_unchanged);
   size_t GetMaxConcurrency(size_t worker_count);
 
   std::unique_ptr<JobHandle> job_handle_;
@@ -22,20 +22,23 @@ void ConservativeStackVisitor::VisitPointer(const void* pointer) {
 bool ConservativeStackVisitor::CheckPage(Address address, MemoryChunk* page) {
   if (address < page->area_start() || address >= page->area_end()) return false;
 
-  auto base_ptr = page->object_start_bitmap()->FindBasePtr(address);
-  if (base_ptr == kNullAddress) {
-    return false;
-  }
-
-  // At this point, base_ptr *must* refer to the valid object. We check if
-  // |address| resides inside the object or beyond it in unused memory.
-  HeapObject obj = HeapObject::FromAddress(base_ptr);
-  Address obj_end = obj.address() + obj.Size();
-
-  if (address >= obj_end) {
-    // |address| points to unused memory.
-    return false;
+  // The object start bitmap is rebuilt by the sweeper, so it misses objects
+  // allocated since. Walk forward from the closest recorded object instead,
+  // skipping the unused part of the space's linear allocation area.
+  Address base_ptr = page->object_start_bitmap()->FindBasePtr(address);
+  if (base_ptr == kNullAddress) base_ptr = page->area_start();
+  PagedSpace* space = static_cast<PagedSpace*>(page->owner());
+  for (;;) {
+    if (base_ptr == space->top()) base_ptr = space->limit();
+    if (base_ptr > address || base_ptr >= page->area_end()) {
+      // |address| points to unused memory.
+      return false;
+    }
+    Address obj_end = base_ptr + HeapObject::FromAddress(base_ptr).Size();
+    if (address < obj_end) break;
+    base_ptr = obj_end;
   }
+  if (HeapObject::FromAddress(base_ptr).IsFreeSpaceOrFiller()) return false;
 
   // TODO(jakehughes) Pinning is only required for the marking visitor. Other
   // visitors (such as verify visitor) could work without pining. This should
@@ -49,27 +52,34 @@ bool ConservativeStackVisitor::CheckPage(Address address, MemoryChunk* page) {
   return true;
 }
 
+bool ConservativeStackVisitor::CheckLargePage(Address address,
+                                              LargePage* page) {
+  if (address < page->area_start() || address >= page->area_end()) return false;
+  Object ptr = page->GetObject();
+  FullObjectSlot root = FullObjectSlot(&ptr);
+  delegate_->VisitRootPointer(Root::kHandleScope, nullptr, root);
+  DCHECK(root == FullObjectSlot(&ptr));
+  return true;
+}
+
 void ConservativeStackVisitor::VisitConservativelyIfPointer(
     const void* pointer) {
   auto address = reinterpret_cast<Address>(pointer);
-  if (address > isolate_->heap()->old_space()->top() ||
-      address < isolate_->heap()->old_space()->limit()) {
-    return;
-  }
-
-  for (Page* page : *isolate_->heap()->old_space()) {
-    if (CheckPage(address, page)) {
-      return;
+  Heap* heap = isolate_->heap();
+  // Besides on-stack Handle slots, stack words may be DirectHandles to
+  // objects in any of the spaces that single generation builds allocate in.
+  PagedSpace* paged_spaces[] = {heap->old_space(), heap->code_space(),
+                                heap->map_space()};
+  for (PagedSpace* space : paged_spaces) {
+    if (space == nullptr) continue;
+    for (Page* page : *space) {
+      if (CheckPage(address, page)) return;
     }
   }
-
-  for (LargePage* page : *isolate_->heap()->lo_space()) {
-    if (address >= page->area_start() && address < page->area_end()) {
-      Object ptr = page->GetObject();
-      FullObjectSlot root = FullObjectSlot(&ptr);
-      delegate_->VisitRootPointer(Root::kHandleScope, nullptr, root);
-      DCHECK(root == FullObjectSlot(&ptr));
-      return;
+  LargeObjectSpace* large_spaces[] = {heap->lo_space(), heap->code_lo_space()};
+  for (LargeObjectSpace* space : large_spaces) {
+    for (LargePage* page : *space) {
+      if (CheckLargePage(address, page)) return;
     }
   }
 }
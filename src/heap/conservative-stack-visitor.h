@@ -11,6 +11,8 @@
 namespace v8 {
 namespace internal {
 
+class LargePage;
+
 class ConservativeStackVisitor : public ::heap::base::StackVisitor {
  public:
   ConservativeStackVisitor(Isolate* isolate, RootVisitor* delegate);
@@ -19,6 +21,7 @@ class ConservativeStackVisitor : public ::heap::base::StackVisitor {
 
  private:
   bool CheckPage(Address address, MemoryChunk* page);
+  bool CheckLargePage(Address address, LargePage* page);
 
   void VisitConservativelyIfPointer(const void* pointer);
 
@@ -0,0 +1,100 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/context-allocation-tracker.h"
+
+#include "src/api/api-inl.h"
+#include "src/execution/isolate-inl.h"
+#include "src/heap/heap-inl.h"
+#include "src/init/bootstrapper.h"
+#include "src/objects/contexts-inl.h"
+
+namespace v8 {
+namespace internal {
+
+ContextAllocationTracker::ContextAllocationTracker(Heap* heap)
+    : AllocationObserver(FLAG_context_allocation_sample_interval),
+      heap_(heap) {}
+
+ContextAllocationTracker::~ContextAllocationTracker() = default;
+
+ContextAllocationTracker::Entry* ContextAllocationTracker::EntryFor(
+    Handle<NativeContext> context) {
+  v8::metrics::Recorder::ContextId context_id =
+      heap_->isolate()->GetOrRegisterRecorderContextId(context);
+  if (context_id.IsEmpty()) return nullptr;
+  const uintptr_t key =
+      static_cast<uintptr_t>(Smi::ToInt(context->recorder_context_id()));
+  Entry& entry = entries_[key];
+  entry.context_id = context_id;
+  return &entry;
+}
+
+void ContextAllocationTracker::SetLimit(
+    Handle<NativeContext> context, size_t limit,
+    v8::Isolate::ContextAllocationLimitCallback callback, void* data) {
+  Entry* entry = EntryFor(context);
+  if (entry == nullptr) return;
+  entry->limit = limit;
+  entry->callback = limit > 0 ? callback : nullptr;
+  entry->data = limit > 0 ? data : nullptr;
+  entry->notified = limit > 0 && entry->allocated_bytes > limit;
+}
+
+size_t ContextAllocationTracker::AllocatedBytes(Handle<NativeContext> context) {
+  Entry* entry = EntryFor(context);
+  return entry ? entry->allocated_bytes : 0;
+}
+
+void ContextAllocationTracker::Step(int bytes_allocated, Address, size_t) {
+  Isolate* isolate = heap_->isolate();
+  if (isolate->context().is_null() || isolate->bootstrapper()->IsActive()) {
+    return;
+  }
+  HandleScope scope(isolate);
+  Entry* entry =
+      EntryFor(handle(isolate->context().native_context(), isolate));
+  if (entry == nullptr) return;
+  entry->allocated_bytes += static_cast<size_t>(bytes_allocated);
+  if (entry->limit == 0 || entry->notified ||
+      entry->allocated_bytes <= entry->limit) {
+    return;
+  }
+  // Calling into the embedder is not possible in the middle of an allocation.
+  entry->notified = true;
+  const uintptr_t key = static_cast<uintptr_t>(
+      Smi::ToInt(isolate->context().native_context().recorder_context_id()));
+  if (pending_callbacks_.empty()) {
+    isolate->RequestInterrupt(&InvokeCallbacks, this);
+  }
+  pending_callbacks_.push_back(key);
+}
+
+// static
+void ContextAllocationTracker::InvokeCallbacks(v8::Isolate* v8_isolate,
+                                               void* data) {
+  ContextAllocationTracker* tracker =
+      static_cast<ContextAllocationTracker*>(data);
+  Isolate* isolate = reinterpret_cast<Isolate*>(v8_isolate);
+  std::vector<uintptr_t> pending;
+  pending.swap(tracker->pending_callbacks_);
+  for (uintptr_t key : pending) {
+    auto it = tracker->entries_.find(key);
+    if (it == tracker->entries_.end() || it->second.callback == nullptr) {
+      continue;
+    }
+    Entry entry = it->second;
+    v8::HandleScope scope(v8_isolate);
+    v8::Local<v8::Context> context;
+    if (!isolate->GetContextFromRecorderContextId(entry.context_id)
+             .ToLocal(&context)) {
+      tracker->entries_.erase(it);
+      continue;
+    }
+    entry.callback(v8_isolate, context, entry.allocated_bytes, entry.data);
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,67 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_CONTEXT_ALLOCATION_TRACKER_H_
+#define V8_HEAP_CONTEXT_ALLOCATION_TRACKER_H_
+
+#include <unordered_map>
+#include <vector>
+
+#include "include/v8-isolate.h"
+#include "include/v8-metrics.h"
+#include "src/common/globals.h"
+#include "src/handles/handles.h"
+#include "src/heap/allocation-observer.h"
+
+namespace v8 {
+namespace internal {
+
+class Heap;
+class NativeContext;
+
+// Attributes allocations to the native context that is current when an
+// allocation observer step is reached. The counters are sampled with a
+// granularity of --context-allocation-sample-interval bytes and are cheap
+// enough to stay enabled. Once the bytes of a context exceed its soft limit,
+// the embedder callback is invoked from an interrupt.
+class ContextAllocationTracker final : public AllocationObserver {
+ public:
+  explicit ContextAllocationTracker(Heap* heap);
+  ~ContextAllocationTracker() override;
+  ContextAllocationTracker(const ContextAllocationTracker&) = delete;
+  ContextAllocationTracker& operator=(const ContextAllocationTracker&) = delete;
+
+  // A limit of 0 removes the limit of the context.
+  void SetLimit(Handle<NativeContext> context, size_t limit,
+                v8::Isolate::ContextAllocationLimitCallback callback,
+                void* data);
+
+  size_t AllocatedBytes(Handle<NativeContext> context);
+
+  // AllocationObserver overrides.
+  void Step(int bytes_allocated, Address soon_object, size_t size) override;
+
+ private:
+  struct Entry {
+    v8::metrics::Recorder::ContextId context_id;
+    size_t allocated_bytes = 0;
+    size_t limit = 0;
+    v8::Isolate::ContextAllocationLimitCallback callback = nullptr;
+    void* data = nullptr;
+    bool notified = false;
+  };
+
+  Entry* EntryFor(Handle<NativeContext> context);
+  static void InvokeCallbacks(v8::Isolate* isolate, void* data);
+
+  Heap* const heap_;
+  // Keyed by the recorder context id of the native context.
+  std::unordered_map<uintptr_t, Entry> entries_;
+  std::vector<uintptr_t> pending_callbacks_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_CONTEXT_ALLOCATION_TRACKER_H_
@@ -9,6 +9,7 @@
 #include <unordered_map>
 #include <unordered_set>
 
+#include "include/cppgc/heap-statistics.h"
 #include "include/cppgc/macros.h"
 #include "src/heap/cppgc/compaction-worklists.h"
 #include "src/heap/cppgc/globals.h"
@@ -27,6 +28,9 @@ namespace {
 // Freelist size threshold that must be exceeded before compaction
 // should be considered.
 static constexpr size_t kFreeListSizeThreshold = 512 * kKB;
+// Smaller heaps are compacted if at least a page could be freed and the
+// freelist holds a large fraction of their memory.
+static constexpr size_t kMinFreeListSizeForFragmentation = kPageSize;
 
 // The real worker behind heap compaction, recording references to movable
 // objects ("slots".) When the objects end up being compacted and moved,
@@ -432,6 +436,13 @@ size_t UpdateHeapResidency(const std::vector<NormalPageSpace*>& spaces) {
                          });
 }
 
+size_t CommittedSize(const std::vector<NormalPageSpace*>& spaces) {
+  return std::accumulate(spaces.cbegin(), spaces.cend(), size_t{0},
+                         [](size_t acc, const NormalPageSpace* space) {
+                           return acc + space->size() * kPageSize;
+                         });
+}
+
 }  // namespace
 
 Compactor::Compactor(RawHeap& heap) : heap_(heap) {
@@ -460,8 +471,11 @@ bool Compactor::ShouldCompact(
   }
 
   size_t free_list_size = UpdateHeapResidency(compactable_spaces_);
+  if (free_list_size > kFreeListSizeThreshold) return true;
 
-  return free_list_size > kFreeListSizeThreshold;
+  return free_list_size > kMinFreeListSizeForFragmentation &&
+         free_list_size > CommittedSize(compactable_spaces_) *
+                              HeapStatistics::kCompactionFragmentationThreshold;
 }
 
 void Compactor::InitializeIfShouldCompact(
@@ -25,6 +25,11 @@ constexpr double kMaximumLimitRatioForIncrementalGC = 0.9;
 // Minimum ratio between limit for incremental GC and limit for atomic GC
 // (to guarantee that limit is not too close to current allocated size).
 constexpr double kMinimumLimitRatioForIncrementalGC = 0.5;
+#if defined(CPPGC_YOUNG_GENERATION)
+// Ratio between the distance to the limit for incremental GC and the budget
+// for young allocations until a minor GC is triggered.
+constexpr double kLimitRatioForMinorGC = 0.5;
+#endif  // defined(CPPGC_YOUNG_GENERATION)
 }  // namespace
 
 class HeapGrowing::HeapGrowingImpl final
@@ -45,6 +50,9 @@ class HeapGrowing::HeapGrowingImpl final
 
   size_t limit_for_atomic_gc() const { return limit_for_atomic_gc_; }
   size_t limit_for_incremental_gc() const { return limit_for_incremental_gc_; }
+#if defined(CPPGC_YOUNG_GENERATION)
+  size_t limit_for_minor_gc() const { return limit_for_minor_gc_; }
+#endif  // defined(CPPGC_YOUNG_GENERATION)
 
   void DisableForTesting();
 
@@ -57,6 +65,9 @@ class HeapGrowing::HeapGrowingImpl final
   size_t initial_heap_size_ = 1 * kMB;
   size_t limit_for_atomic_gc_ = 0;       // See ConfigureLimit().
   size_t limit_for_incremental_gc_ = 0;  // See ConfigureLimit().
+#if defined(CPPGC_YOUNG_GENERATION)
+  size_t limit_for_minor_gc_ = 0;  // See ConfigureLimit().
+#endif  // defined(CPPGC_YOUNG_GENERATION)
 
   SingleThreadedHandle gc_task_handle_;
 
@@ -102,6 +113,15 @@ void HeapGrowing::HeapGrowingImpl::AllocatedObjectSizeIncreased(size_t) {
         {GarbageCollector::Config::CollectionType::kMajor,
          GarbageCollector::Config::StackState::kMayContainHeapPointers,
          marking_support_, sweeping_support_});
+#if defined(CPPGC_YOUNG_GENERATION)
+  } else if (allocated_object_size > limit_for_minor_gc_) {
+    // Minor GCs require a precise stack. The collector is responsible for
+    // deferring the GC to a point where no heap pointers are on the stack.
+    collector_->CollectGarbage(
+        {GarbageCollector::Config::CollectionType::kMinor,
+         GarbageCollector::Config::StackState::kMayContainHeapPointers,
+         GarbageCollector::Config::MarkingType::kAtomic, sweeping_support_});
+#endif  // defined(CPPGC_YOUNG_GENERATION)
   }
 }
 
@@ -138,6 +158,12 @@ void HeapGrowing::HeapGrowingImpl::ConfigureLimit(
       std::max(minimum_limit_incremental_gc,
                std::min(maximum_limit_incremental_gc,
                         limit_incremental_gc_based_on_allocation_rate));
+#if defined(CPPGC_YOUNG_GENERATION)
+  // Objects allocated since the last GC are young. Collect them with a minor
+  // GC well before a major GC is due.
+  limit_for_minor_gc_ =
+      size + (limit_for_incremental_gc_ - size) * kLimitRatioForMinorGC;
+#endif  // defined(CPPGC_YOUNG_GENERATION)
 }
 
 void HeapGrowing::HeapGrowingImpl::DisableForTesting() {
@@ -161,6 +187,11 @@ size_t HeapGrowing::limit_for_atomic_gc() const {
 size_t HeapGrowing::limit_for_incremental_gc() const {
   return impl_->limit_for_incremental_gc();
 }
+#if defined(CPPGC_YOUNG_GENERATION)
+size_t HeapGrowing::limit_for_minor_gc() const {
+  return impl_->limit_for_minor_gc();
+}
+#endif  // defined(CPPGC_YOUNG_GENERATION)
 
 void HeapGrowing::DisableForTesting() { impl_->DisableForTesting(); }
 
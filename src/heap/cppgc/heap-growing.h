@@ -43,6 +43,9 @@ class V8_EXPORT_PRIVATE HeapGrowing final {
 
   size_t limit_for_atomic_gc() const;
   size_t limit_for_incremental_gc() const;
+#if defined(CPPGC_YOUNG_GENERATION)
+  size_t limit_for_minor_gc() const;
+#endif  // defined(CPPGC_YOUNG_GENERATION)
 
   void DisableForTesting();
 
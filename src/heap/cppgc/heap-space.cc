@@ -15,8 +15,12 @@ namespace cppgc {
 namespace internal {
 
 BaseSpace::BaseSpace(RawHeap* heap, size_t index, PageType type,
-                     bool is_compactable)
-    : heap_(heap), index_(index), type_(type), is_compactable_(is_compactable) {
+                     bool is_compactable, bool is_sweeping_prioritized)
+    : heap_(heap),
+      index_(index),
+      type_(type),
+      is_compactable_(is_compactable),
+      is_sweeping_prioritized_(is_sweeping_prioritized) {
   USE(is_compactable_);
 }
 
@@ -40,11 +44,14 @@ BaseSpace::Pages BaseSpace::RemoveAllPages() {
 }
 
 NormalPageSpace::NormalPageSpace(RawHeap* heap, size_t index,
-                                 bool is_compactable)
-    : BaseSpace(heap, index, PageType::kNormal, is_compactable) {}
+                                 bool is_compactable,
+                                 bool is_sweeping_prioritized)
+    : BaseSpace(heap, index, PageType::kNormal, is_compactable,
+                is_sweeping_prioritized) {}
 
 LargePageSpace::LargePageSpace(RawHeap* heap, size_t index)
-    : BaseSpace(heap, index, PageType::kLarge, false /* is_compactable */) {}
+    : BaseSpace(heap, index, PageType::kLarge, false /* is_compactable */,
+                false /* is_sweeping_prioritized */) {}
 
 }  // namespace internal
 }  // namespace cppgc
@@ -48,11 +48,12 @@ class V8_EXPORT_PRIVATE BaseSpace {
   Pages RemoveAllPages();
 
   bool is_compactable() const { return is_compactable_; }
+  bool is_sweeping_prioritized() const { return is_sweeping_prioritized_; }
 
  protected:
   enum class PageType { kNormal, kLarge };
   explicit BaseSpace(RawHeap* heap, size_t index, PageType type,
-                     bool is_compactable);
+                     bool is_compactable, bool is_sweeping_prioritized);
 
  private:
   RawHeap* heap_;
@@ -61,6 +62,7 @@ class V8_EXPORT_PRIVATE BaseSpace {
   const size_t index_;
   const PageType type_;
   const bool is_compactable_;
+  const bool is_sweeping_prioritized_;
 };
 
 class V8_EXPORT_PRIVATE NormalPageSpace final : public BaseSpace {
@@ -96,7 +98,8 @@ class V8_EXPORT_PRIVATE NormalPageSpace final : public BaseSpace {
     return From(const_cast<BaseSpace&>(space));
   }
 
-  NormalPageSpace(RawHeap* heap, size_t index, bool is_compactable);
+  NormalPageSpace(RawHeap* heap, size_t index, bool is_compactable,
+                  bool is_sweeping_prioritized = false);
 
   LinearAllocationBuffer& linear_allocation_buffer() { return current_lab_; }
   const LinearAllocationBuffer& linear_allocation_buffer() const {
@@ -4,8 +4,10 @@
 
 #include "src/heap/cppgc/heap-statistics-collector.h"
 
+#include <numeric>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "include/cppgc/heap-statistics.h"
 #include "include/cppgc/name-provider.h"
@@ -68,6 +70,15 @@ void FinalizeSpace(HeapStatistics* stats,
     stats->committed_size_bytes += (*space_stats)->committed_size_bytes;
     stats->resident_size_bytes += (*space_stats)->resident_size_bytes;
     stats->used_size_bytes += (*space_stats)->used_size_bytes;
+    if ((*space_stats)->committed_size_bytes) {
+      const std::vector<size_t>& free_size =
+          (*space_stats)->free_list_stats.free_size;
+      const size_t free_list_size =
+          std::accumulate(free_size.begin(), free_size.end(), size_t{0});
+      (*space_stats)->fragmentation =
+          static_cast<double>(free_list_size) /
+          (*space_stats)->committed_size_bytes;
+    }
   }
   *space_stats = nullptr;
 }
@@ -127,6 +138,7 @@ bool HeapStatisticsCollector::VisitNormalPageSpace(NormalPageSpace& space) {
       InitializeSpace(current_stats_, GetNormalPageSpaceName(space.index()));
 
   space.free_list().CollectStatistics(current_space_stats_->free_list_stats);
+  current_space_stats_->is_compactable = space.is_compactable();
 
   return false;
 }
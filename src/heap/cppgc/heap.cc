@@ -103,6 +103,11 @@ void Heap::CollectGarbage(Config config) {
 
   if (in_no_gc_scope()) return;
 
+  // A minor GC cannot finalize an already running major GC.
+  if ((config.collection_type == Config::CollectionType::kMinor) &&
+      IsMarking())
+    return;
+
   config_ = config;
 
   if (!IsMarking()) {
@@ -178,9 +183,10 @@ void Heap::FinalizeGarbageCollection(Config::StackState stack_state) {
   const size_t bytes_allocated_in_prefinalizers = ExecutePreFinalizers();
 #if CPPGC_VERIFY_HEAP
   MarkingVerifier verifier(*this, config_.collection_type);
-  verifier.Run(
-      config_.stack_state, stack_end_of_current_gc(),
-      stats_collector()->marked_bytes() + bytes_allocated_in_prefinalizers);
+  verifier.Run(config_.stack_state, stack_end_of_current_gc(),
+               stats_collector()->marked_bytes() -
+                   stats_collector()->retained_old_bytes() +
+                   bytes_allocated_in_prefinalizers);
 #endif  // CPPGC_VERIFY_HEAP
 #ifndef CPPGC_ALLOW_ALLOCATIONS_IN_PREFINALIZERS
   DCHECK_EQ(0u, bytes_allocated_in_prefinalizers);
@@ -192,8 +192,14 @@ void ObjectAllocator::RefillLinearAllocationBuffer(NormalPageSpace& space,
     if (RefillLinearAllocationBufferFromFreeList(space, size)) return;
   }
 
-  sweeper.FinishIfRunning();
-  // TODO(chromium:1056170): Make use of the synchronously freed memory.
+  if (sweeper.IsSweepingInProgress()) {
+    sweeper.FinishIfRunning();
+    // Pages of this space that were still being swept concurrently have now
+    // been finalized and their free memory is available for reuse. Avoid
+    // allocating a new page (which requires taking the page backend lock) if
+    // that memory fits the request.
+    if (RefillLinearAllocationBufferFromFreeList(space, size)) return;
+  }
 
   auto* new_page = NormalPage::Create(page_backend_, space);
   space.AddPage(new_page);
@@ -119,6 +119,14 @@ void StatsCollector::NotifyMarkingCompleted(size_t marked_bytes) {
   DCHECK_EQ(GarbageCollectionState::kMarking, gc_state_);
   gc_state_ = GarbageCollectionState::kSweeping;
   current_.marked_bytes = marked_bytes;
+#if defined(CPPGC_YOUNG_GENERATION)
+  if (current_.collection_type == CollectionType::kMinor) {
+    // Minor GCs only mark young objects. Everything that survived the previous
+    // cycle is old and retained, so it is accounted as live here as well.
+    current_.retained_old_bytes = previous_.marked_bytes;
+    current_.marked_bytes += current_.retained_old_bytes;
+  }
+#endif  // defined(CPPGC_YOUNG_GENERATION)
   current_.object_size_before_sweep_bytes =
       previous_.marked_bytes + allocated_bytes_since_end_of_marking_ +
       allocated_bytes_since_safepoint_ -
@@ -126,7 +134,7 @@ void StatsCollector::NotifyMarkingCompleted(size_t marked_bytes) {
   allocated_bytes_since_safepoint_ = 0;
   explicitly_freed_bytes_since_safepoint_ = 0;
 #ifdef CPPGC_VERIFY_HEAP
-  tracked_live_bytes_ = marked_bytes;
+  tracked_live_bytes_ = current_.marked_bytes;
 #endif  // CPPGC_VERIFY_HEAP
 
   DCHECK_LE(memory_freed_bytes_since_end_of_marking_, memory_allocated_bytes_);
@@ -134,8 +142,8 @@ void StatsCollector::NotifyMarkingCompleted(size_t marked_bytes) {
   current_.memory_size_before_sweep_bytes = memory_allocated_bytes_;
   memory_freed_bytes_since_end_of_marking_ = 0;
 
-  ForAllAllocationObservers([marked_bytes](AllocationObserver* observer) {
-    observer->ResetAllocatedObjectSize(marked_bytes);
+  ForAllAllocationObservers([this](AllocationObserver* observer) {
+    observer->ResetAllocatedObjectSize(current_.marked_bytes);
   });
 
   // HeapGrowing would use the below fields to estimate allocation rate during
@@ -271,6 +279,13 @@ size_t StatsCollector::marked_bytes() const {
   return event.marked_bytes;
 }
 
+size_t StatsCollector::retained_old_bytes() const {
+  DCHECK_NE(GarbageCollectionState::kMarking, gc_state_);
+  const Event& event =
+      gc_state_ == GarbageCollectionState::kSweeping ? current_ : previous_;
+  return event.retained_old_bytes;
+}
+
 v8::base::TimeDelta StatsCollector::marking_time() const {
   DCHECK_NE(GarbageCollectionState::kMarking, gc_state_);
   // During sweeping we refer to the current Event as that already holds the
@@ -178,6 +178,21 @@ struct SpaceState {
 };
 
 using SpaceStates = std::vector<SpaceState>;
+// Order in which spaces are processed. Spaces that are prioritized for
+// sweeping come first.
+using SweepingOrder = std::vector<size_t>;
+
+SweepingOrder ComputeSweepingOrder(const RawHeap& heap) {
+  SweepingOrder order;
+  order.reserve(heap.size());
+  for (const auto& space : heap) {
+    if (space->is_sweeping_prioritized()) order.push_back(space->index());
+  }
+  for (const auto& space : heap) {
+    if (!space->is_sweeping_prioritized()) order.push_back(space->index());
+  }
+  return order;
+}
 
 void StickyUnmark(HeapObjectHeader* header) {
   // Young generation in Oilpan uses sticky mark bits.
@@ -331,9 +346,9 @@ class SweepFinalizer final {
                  FreeMemoryHandling free_memory_handling)
       : platform_(platform), free_memory_handling_(free_memory_handling) {}
 
-  void FinalizeHeap(SpaceStates* space_states) {
-    for (SpaceState& space_state : *space_states) {
-      FinalizeSpace(&space_state);
+  void FinalizeHeap(SpaceStates* space_states, const SweepingOrder& order) {
+    for (size_t index : order) {
+      FinalizeSpace(&(*space_states)[index]);
     }
   }
 
@@ -419,14 +434,17 @@ class MutatorThreadSweeper final : private HeapVisitor<MutatorThreadSweeper> {
   using FreeMemoryHandling = Sweeper::SweepingConfig::FreeMemoryHandling;
 
  public:
-  MutatorThreadSweeper(SpaceStates* states, cppgc::Platform* platform,
+  MutatorThreadSweeper(SpaceStates* states, const SweepingOrder& order,
+                       cppgc::Platform* platform,
                        FreeMemoryHandling free_memory_handling)
       : states_(states),
+        order_(order),
         platform_(platform),
         free_memory_handling_(free_memory_handling) {}
 
   void Sweep() {
-    for (SpaceState& state : *states_) {
+    for (size_t index : order_) {
+      SpaceState& state = (*states_)[index];
       while (auto page = state.unswept_pages.Pop()) {
         SweepPage(**page);
       }
@@ -438,7 +456,8 @@ class MutatorThreadSweeper final : private HeapVisitor<MutatorThreadSweeper> {
   bool SweepWithDeadline(double deadline_in_seconds) {
     DCHECK(platform_);
     static constexpr double kSlackInSeconds = 0.001;
-    for (SpaceState& state : *states_) {
+    for (size_t index : order_) {
+      SpaceState& state = (*states_)[index];
       // FinalizeSpaceWithDeadline() and SweepSpaceWithDeadline() won't check
       // the deadline until it sweeps 10 pages. So we give a small slack for
       // safety.
@@ -514,6 +533,7 @@ class MutatorThreadSweeper final : private HeapVisitor<MutatorThreadSweeper> {
   }
 
   SpaceStates* states_;
+  const SweepingOrder& order_;
   cppgc::Platform* platform_;
   size_t largest_new_free_list_entry_ = 0;
   const FreeMemoryHandling free_memory_handling_;
@@ -526,10 +546,12 @@ class ConcurrentSweepTask final : public cppgc::JobTask,
   using FreeMemoryHandling = Sweeper::SweepingConfig::FreeMemoryHandling;
 
  public:
-  ConcurrentSweepTask(HeapBase& heap, SpaceStates* states, Platform* platform,
+  ConcurrentSweepTask(HeapBase& heap, SpaceStates* states,
+                      const SweepingOrder& order, Platform* platform,
                       FreeMemoryHandling free_memory_handling)
       : heap_(heap),
         states_(states),
+        order_(order),
         platform_(platform),
         free_memory_handling_(free_memory_handling) {}
 
@@ -537,7 +559,8 @@ class ConcurrentSweepTask final : public cppgc::JobTask,
     StatsCollector::EnabledConcurrentScope stats_scope(
         heap_.stats_collector(), StatsCollector::kConcurrentSweep);
 
-    for (SpaceState& state : *states_) {
+    for (size_t index : order_) {
+      SpaceState& state = (*states_)[index];
       while (auto page = state.unswept_pages.Pop()) {
         Traverse(**page);
         if (delegate->ShouldYield()) return;
@@ -592,6 +615,7 @@ class ConcurrentSweepTask final : public cppgc::JobTask,
 
   HeapBase& heap_;
   SpaceStates* states_;
+  const SweepingOrder& order_;
   Platform* platform_;
   std::atomic_bool is_completed_{false};
   const FreeMemoryHandling free_memory_handling_;
@@ -657,7 +681,8 @@ class Sweeper::SweeperImpl final {
   SweeperImpl(RawHeap& heap, StatsCollector* stats_collector)
       : heap_(heap),
         stats_collector_(stats_collector),
-        space_states_(heap.size()) {}
+        space_states_(heap.size()),
+        sweeping_order_(ComputeSweepingOrder(heap)) {}
 
   ~SweeperImpl() { CancelSweepers(); }
 
@@ -724,7 +749,7 @@ class Sweeper::SweeperImpl final {
     {
       // Then, if no matching slot is found in the unfinalized pages, search the
       // unswept page. This also helps out the concurrent sweeper.
-      MutatorThreadSweeper sweeper(&space_states_, platform_,
+      MutatorThreadSweeper sweeper(&space_states_, sweeping_order_, platform_,
                                    config_.free_memory_handling);
       while (auto page = space_state.unswept_pages.Pop()) {
         sweeper.SweepPage(**page);
@@ -764,10 +789,10 @@ class Sweeper::SweeperImpl final {
 
     // First, call finalizers on the mutator thread.
     SweepFinalizer finalizer(platform_, config_.free_memory_handling);
-    finalizer.FinalizeHeap(&space_states_);
+    finalizer.FinalizeHeap(&space_states_, sweeping_order_);
 
     // Then, help out the concurrent thread.
-    MutatorThreadSweeper sweeper(&space_states_, platform_,
+    MutatorThreadSweeper sweeper(&space_states_, sweeping_order_, platform_,
                                  config_.free_memory_handling);
     sweeper.Sweep();
 
@@ -815,7 +840,7 @@ class Sweeper::SweeperImpl final {
       StatsCollector::EnabledScope stats_scope(
           stats_collector_, StatsCollector::kIncrementalSweep);
 
-      MutatorThreadSweeper sweeper(&space_states_, platform_,
+      MutatorThreadSweeper sweeper(&space_states_, sweeping_order_, platform_,
                                    config_.free_memory_handling);
       {
         StatsCollector::EnabledScope inner_stats_scope(
@@ -898,8 +923,8 @@ class Sweeper::SweeperImpl final {
     concurrent_sweeper_handle_ =
         platform_->PostJob(cppgc::TaskPriority::kUserVisible,
                            std::make_unique<ConcurrentSweepTask>(
-                               *heap_.heap(), &space_states_, platform_,
-                               config_.free_memory_handling));
+                               *heap_.heap(), &space_states_, sweeping_order_,
+                               platform_, config_.free_memory_handling));
   }
 
   void CancelSweepers() {
@@ -912,12 +937,13 @@ class Sweeper::SweeperImpl final {
     CancelSweepers();
 
     SweepFinalizer finalizer(platform_, config_.free_memory_handling);
-    finalizer.FinalizeHeap(&space_states_);
+    finalizer.FinalizeHeap(&space_states_, sweeping_order_);
   }
 
   RawHeap& heap_;
   StatsCollector* const stats_collector_;
   SpaceStates space_states_;
+  const SweepingOrder sweeping_order_;
   cppgc::Platform* platform_;
   SweepingConfig config_;
   IncrementalSweepTask::Handle incremental_sweeper_handle_;
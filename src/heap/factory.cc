@@ -884,6 +884,11 @@ StringInternalizationStrategy Factory::ComputeInternalizationStrategyForString(
   if (Heap::InYoungGeneration(*string)) {
     return StringInternalizationStrategy::kCopy;
   }
+  // Entries of the shared string table must be in the shared heap. Strings in
+  // an isolate's own old generation (e.g. external strings) are copied.
+  if (FLAG_shared_string_table && !string->InSharedHeap()) {
+    return StringInternalizationStrategy::kCopy;
+  }
   DCHECK_NOT_NULL(internalized_map);
   DisallowGarbageCollection no_gc;
   // This method may be called concurrently, so snapshot the map from the input
@@ -1158,6 +1163,7 @@ Handle<NativeContext> Factory::NewNativeContext() {
   context.set_errors_thrown(Smi::zero());
   context.set_math_random_index(Smi::zero());
   context.set_serialized_objects(*empty_fixed_array());
+  context.set_const_tracking_let_cells(*empty_fixed_array());
   context.set_microtask_queue(isolate(), nullptr);
   context.set_osr_code_cache(*empty_weak_fixed_array());
   context.set_retained_maps(*empty_weak_array_list());
@@ -4,6 +4,8 @@
 
 #include "src/heap/free-list.h"
 
+#include <algorithm>
+
 #include "src/base/macros.h"
 #include "src/common/globals.h"
 #include "src/heap/free-list-inl.h"
@@ -526,6 +528,29 @@ int FreeListCategory::FreeListLength() {
   return length;
 }
 
+size_t FreeListCategory::LargestFreeBlock() {
+  size_t largest = 0;
+  for (FreeSpace cur = top(); !cur.is_null(); cur = cur.next()) {
+    largest = std::max(largest, static_cast<size_t>(cur.size(kRelaxedLoad)));
+  }
+  return largest;
+}
+
+size_t FreeList::LargestFreeBlock() {
+  // Categories hold disjoint size ranges, so the largest block is in the
+  // highest category that has any.
+  for (int i = last_category_; i >= kFirstCategory; i--) {
+    size_t largest = 0;
+    ForAllFreeListCategories(static_cast<FreeListCategoryType>(i),
+                             [&largest](FreeListCategory* category) {
+                               largest = std::max(largest,
+                                                  category->LargestFreeBlock());
+                             });
+    if (largest > 0) return largest;
+  }
+  return 0;
+}
+
 #ifdef DEBUG
 bool FreeList::IsVeryLong() {
   int len = 0;
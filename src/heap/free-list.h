@@ -76,6 +76,7 @@ class FreeListCategory {
 
   size_t SumFreeList();
   int FreeListLength();
+  size_t LargestFreeBlock();
 
  private:
   // For debug builds we accurately compute free lists lengths up until
@@ -161,6 +162,10 @@ class FreeList {
   void IncreaseAvailableBytes(size_t bytes) { available_ += bytes; }
   void DecreaseAvailableBytes(size_t bytes) { available_ -= bytes; }
 
+  // Returns the size of the largest free block. Walks the blocks of the
+  // highest non-empty category.
+  size_t LargestFreeBlock();
+
   bool IsEmpty() {
     bool empty = true;
     ForAllFreeListCategories([&empty](FreeListCategory* category) {
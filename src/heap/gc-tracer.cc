@@ -110,6 +110,19 @@ GCTracer::Scope::~Scope() {
 #endif  // defined(V8_RUNTIME_CALL_STATS)
 }
 
+GCTracer::BytesTraceEvent::BytesTraceEvent(GCTracer* tracer,
+                                           Scope::ScopeId scope,
+                                           const size_t* bytes)
+    : name_(Scope::Name(scope)), bytes_(bytes) {
+  TRACE_EVENT_BEGIN1(TRACE_GC_CATEGORIES, name_, "epoch",
+                     tracer->CurrentEpoch(scope));
+}
+
+GCTracer::BytesTraceEvent::~BytesTraceEvent() {
+  TRACE_EVENT_END1(TRACE_GC_CATEGORIES, name_, "bytes",
+                   static_cast<uint64_t>(*bytes_));
+}
+
 const char* GCTracer::Scope::Name(ScopeId id) {
 #define CASE(scope)  \
   case Scope::scope: \
@@ -154,7 +167,9 @@ GCTracer::Event::Event(Type type, GarbageCollectionReason gc_reason,
       young_object_size(0),
       survived_young_object_size(0),
       incremental_marking_bytes(0),
-      incremental_marking_duration(0.0) {
+      incremental_marking_duration(0.0),
+      incremental_embedder_wrappers(0),
+      incremental_embedder_max_worklist_size(0) {
   for (int i = 0; i < Scope::NUMBER_OF_SCOPES; i++) {
     scopes[i] = 0;
   }
@@ -181,6 +196,8 @@ GCTracer::GCTracer(Heap* heap)
       previous_(current_),
       incremental_marking_bytes_(0),
       incremental_marking_duration_(0.0),
+      incremental_embedder_wrappers_(0),
+      incremental_embedder_max_worklist_size_(0),
       incremental_marking_start_time_(0.0),
       recorded_incremental_marking_speed_(0.0),
       allocation_time_ms_(0.0),
@@ -196,7 +213,10 @@ GCTracer::GCTracer(Heap* heap)
       average_mutator_duration_(0),
       average_mark_compact_duration_(0),
       current_mark_compact_mutator_utilization_(1.0),
-      previous_mark_compact_end_time_(0) {
+      previous_mark_compact_end_time_(0),
+      current_mutator_utilization_(1.0),
+      previous_gc_end_time_(0),
+      incremental_marking_steps_duration_since_gc_(0) {
   // All accesses to incremental_marking_scope assume that incremental marking
   // scopes come first.
   STATIC_ASSERT(0 == Scope::FIRST_INCREMENTAL_SCOPE);
@@ -235,6 +255,11 @@ void GCTracer::ResetForTesting() {
   average_mark_compact_duration_ = 0;
   current_mark_compact_mutator_utilization_ = 1.0;
   previous_mark_compact_end_time_ = 0;
+  current_mutator_utilization_ = 1.0;
+  previous_gc_end_time_ = 0;
+  incremental_marking_steps_duration_since_gc_ = 0;
+  deduplicated_strings_ = 0;
+  deduplicated_string_bytes_ = 0;
   base::MutexGuard guard(&background_counter_mutex_);
   for (int i = 0; i < Scope::NUMBER_OF_SCOPES; i++) {
     background_counter_[i].total_duration_ms = 0;
@@ -320,6 +345,8 @@ void GCTracer::StartInSafepoint() {
 void GCTracer::ResetIncrementalMarkingCounters() {
   incremental_marking_bytes_ = 0;
   incremental_marking_duration_ = 0;
+  incremental_embedder_wrappers_ = 0;
+  incremental_embedder_max_worklist_size_ = 0;
   for (int i = 0; i < Scope::NUMBER_OF_INCREMENTAL_SCOPES; i++) {
     incremental_marking_scopes_[i].ResetCurrentCycle();
   }
@@ -374,6 +401,9 @@ void GCTracer::Stop(GarbageCollector collector) {
     case Event::INCREMENTAL_MARK_COMPACTOR:
       current_.incremental_marking_bytes = incremental_marking_bytes_;
       current_.incremental_marking_duration = incremental_marking_duration_;
+      current_.incremental_embedder_wrappers = incremental_embedder_wrappers_;
+      current_.incremental_embedder_max_worklist_size =
+          incremental_embedder_max_worklist_size_;
       for (int i = 0; i < Scope::NUMBER_OF_INCREMENTAL_SCOPES; i++) {
         current_.incremental_marking_scopes[i] = incremental_marking_scopes_[i];
         current_.scopes[i] = incremental_marking_scopes_[i].duration;
@@ -408,6 +438,7 @@ void GCTracer::Stop(GarbageCollector collector) {
       UNREACHABLE();
   }
   FetchBackgroundGeneralCounters();
+  RecordMainThreadMutatorUtilization(current_.end_time, duration);
 
   heap_->UpdateTotalGCTime(duration);
 
@@ -514,7 +545,24 @@ void GCTracer::AddSurvivalRatio(double promotion_ratio) {
   recorded_survival_ratios_.Push(promotion_ratio);
 }
 
+void GCTracer::AddStringDeduplication(double duration, size_t strings,
+                                      size_t freed_bytes) {
+  deduplicated_strings_ += strings;
+  deduplicated_string_bytes_ += freed_bytes;
+  Output(
+      "[%d:%p] "
+      "%8.0f ms: "
+      "String deduplication %zu strings, %.1f KB freed, %.1f ms "
+      "(total %zu strings, %.1f KB)\n",
+      base::OS::GetCurrentProcessId(),
+      reinterpret_cast<void*>(heap_->isolate()),
+      heap_->isolate()->time_millis_since_init(), strings,
+      static_cast<double>(freed_bytes) / KB, duration, deduplicated_strings_,
+      static_cast<double>(deduplicated_string_bytes_) / KB);
+}
+
 void GCTracer::AddIncrementalMarkingStep(double duration, size_t bytes) {
+  incremental_marking_steps_duration_since_gc_ += duration;
   if (bytes > 0) {
     incremental_marking_bytes_ += bytes;
     incremental_marking_duration_ += duration;
@@ -522,6 +570,13 @@ void GCTracer::AddIncrementalMarkingStep(double duration, size_t bytes) {
   ReportIncrementalMarkingStepToRecorder();
 }
 
+void GCTracer::AddIncrementalEmbedderTracingStep(size_t wrappers,
+                                                 size_t worklist_size) {
+  incremental_embedder_wrappers_ += wrappers;
+  incremental_embedder_max_worklist_size_ =
+      std::max(incremental_embedder_max_worklist_size_, worklist_size);
+}
+
 void GCTracer::Output(const char* format, ...) const {
   if (FLAG_trace_gc) {
     va_list arguments;
@@ -613,12 +668,14 @@ void GCTracer::PrintNVP() const {
           "scavenge.free_remembered_set=%.2f "
           "scavenge.roots=%.2f "
           "scavenge.weak=%.2f "
+          "scavenge.weak.ephemerons=%.2f "
           "scavenge.weak_global_handles.identify=%.2f "
           "scavenge.weak_global_handles.process=%.2f "
           "scavenge.parallel=%.2f "
           "scavenge.update_refs=%.2f "
           "scavenge.sweep_array_buffers=%.2f "
           "background.scavenge.parallel=%.2f "
+          "background.scavenge.weak.ephemerons=%.2f "
           "background.unmapper=%.2f "
           "unmapper=%.2f "
           "incremental.steps_count=%d "
@@ -654,6 +711,7 @@ void GCTracer::PrintNVP() const {
           current_.scopes[Scope::SCAVENGER_FREE_REMEMBERED_SET],
           current_.scopes[Scope::SCAVENGER_SCAVENGE_ROOTS],
           current_.scopes[Scope::SCAVENGER_SCAVENGE_WEAK],
+          current_.scopes[Scope::SCAVENGER_SCAVENGE_WEAK_EPHEMERONS],
           current_
               .scopes[Scope::SCAVENGER_SCAVENGE_WEAK_GLOBAL_HANDLES_IDENTIFY],
           current_
@@ -662,6 +720,8 @@ void GCTracer::PrintNVP() const {
           current_.scopes[Scope::SCAVENGER_SCAVENGE_UPDATE_REFS],
           current_.scopes[Scope::SCAVENGER_SWEEP_ARRAY_BUFFERS],
           current_.scopes[Scope::SCAVENGER_BACKGROUND_SCAVENGE_PARALLEL],
+          current_
+              .scopes[Scope::SCAVENGER_BACKGROUND_SCAVENGE_WEAK_EPHEMERONS],
           current_.scopes[Scope::BACKGROUND_UNMAPPER],
           current_.scopes[Scope::UNMAPPER],
           current_.incremental_marking_scopes[GCTracer::Scope::MC_INCREMENTAL]
@@ -801,6 +861,10 @@ void GCTracer::PrintNVP() const {
           "incremental.embedder_prologue=%.1f "
           "incremental.embedder_tracing=%.1f "
           "incremental_wrapper_tracing_longest_step=%.1f "
+          "incremental_wrapper_tracing_steps_count=%d "
+          "incremental_wrapper_tracing_wrappers=%zu "
+          "incremental_wrapper_tracing_max_worklist_size=%zu "
+          "embedder_marking_throughput=%.f "
           "incremental_finalize_longest_step=%.1f "
           "incremental_finalize_steps_count=%d "
           "incremental_longest_step=%.1f "
@@ -893,6 +957,13 @@ void GCTracer::PrintNVP() const {
               .incremental_marking_scopes
                   [Scope::MC_INCREMENTAL_EMBEDDER_TRACING]
               .longest_step,
+          current_
+              .incremental_marking_scopes
+                  [Scope::MC_INCREMENTAL_EMBEDDER_TRACING]
+              .steps,
+          current_.incremental_embedder_wrappers,
+          current_.incremental_embedder_max_worklist_size,
+          EmbedderSpeedInBytesPerMillisecond(),
           current_
               .incremental_marking_scopes[Scope::MC_INCREMENTAL_FINALIZE_BODY]
               .longest_step,
@@ -1013,6 +1084,25 @@ void GCTracer::RecordMutatorUtilization(double mark_compact_end_time,
   }
 }
 
+void GCTracer::RecordMainThreadMutatorUtilization(double gc_end_time,
+                                                  double gc_duration) {
+  double gc_time = gc_duration + incremental_marking_steps_duration_since_gc_;
+  incremental_marking_steps_duration_since_gc_ = 0;
+  if (previous_gc_end_time_ == 0) {
+    // As for mark-compacts, the first GC only starts the measurement.
+    previous_gc_end_time_ = gc_end_time;
+    return;
+  }
+  double total_duration = gc_end_time - previous_gc_end_time_;
+  previous_gc_end_time_ = gc_end_time;
+  if (total_duration <= 0) return;
+  current_mutator_utilization_ =
+      std::max(0.0, (total_duration - gc_time) / total_duration);
+  TRACE_COUNTER1(TRACE_DISABLED_BY_DEFAULT("v8.gc"),
+                 "V8.GC_MutatorUtilizationPercent",
+                 static_cast<int>(current_mutator_utilization_ * 100));
+}
+
 double GCTracer::AverageMarkCompactMutatorUtilization() const {
   double average_total_duration =
       average_mark_compact_duration_ + average_mutator_duration_;
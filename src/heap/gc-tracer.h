@@ -51,6 +51,15 @@ enum ScavengeSpeedMode { kForAllObjects, kForSurvivedObjects };
                GCTracer::Scope::Name(GCTracer::Scope::ScopeId(scope_id)), \
                "epoch", tracer->CurrentEpoch(scope_id))
 
+// Like TRACE_GC_EPOCH, but the trace event also records the number of bytes
+// the job processed. |bytes| names a size_t that the job updates before the
+// scope ends.
+#define TRACE_GC_EPOCH_WITH_BYTES(tracer, scope_id, thread_kind, bytes)  \
+  GCTracer::Scope UNIQUE_IDENTIFIER(gc_tracer_scope)(                    \
+      tracer, GCTracer::Scope::ScopeId(scope_id), thread_kind);          \
+  GCTracer::BytesTraceEvent UNIQUE_IDENTIFIER(gc_bytes_trace_event)(     \
+      tracer, GCTracer::Scope::ScopeId(scope_id), &bytes)
+
 // GCTracer collects and prints ONE line after each garbage collector
 // invocation IFF --trace_gc is used.
 class V8_EXPORT_PRIVATE GCTracer {
@@ -100,7 +109,8 @@ class V8_EXPORT_PRIVATE GCTracer {
       FIRST_TOP_MC_SCOPE = MC_CLEAR,
       LAST_TOP_MC_SCOPE = MC_SWEEP,
       FIRST_MINOR_GC_BACKGROUND_SCOPE = MINOR_MC_BACKGROUND_EVACUATE_COPY,
-      LAST_MINOR_GC_BACKGROUND_SCOPE = SCAVENGER_BACKGROUND_SCAVENGE_PARALLEL,
+      LAST_MINOR_GC_BACKGROUND_SCOPE =
+          SCAVENGER_BACKGROUND_SCAVENGE_WEAK_EPHEMERONS,
       FIRST_BACKGROUND_SCOPE = FIRST_GENERAL_BACKGROUND_SCOPE
     };
 
@@ -123,6 +133,21 @@ class V8_EXPORT_PRIVATE GCTracer {
 #endif  // defined(V8_RUNTIME_CALL_STATS)
   };
 
+  // The trace event of TRACE_GC_EPOCH_WITH_BYTES. It is split into a begin
+  // and an end event, so that the end can carry the processed bytes.
+  class V8_EXPORT_PRIVATE V8_NODISCARD BytesTraceEvent {
+   public:
+    BytesTraceEvent(GCTracer* tracer, Scope::ScopeId scope,
+                    const size_t* bytes);
+    ~BytesTraceEvent();
+    BytesTraceEvent(const BytesTraceEvent&) = delete;
+    BytesTraceEvent& operator=(const BytesTraceEvent&) = delete;
+
+   private:
+    const char* name_;
+    const size_t* bytes_;
+  };
+
   class Event {
    public:
     enum Type {
@@ -186,6 +211,14 @@ class V8_EXPORT_PRIVATE GCTracer {
     // Duration of incremental marking steps for INCREMENTAL_MARK_COMPACTOR.
     double incremental_marking_duration;
 
+    // Wrappers handed to the embedder during incremental marking steps for
+    // INCREMENTAL_MARK_COMPACTOR.
+    size_t incremental_embedder_wrappers;
+
+    // Largest number of wrappers left in the embedder worklist at the end of
+    // an incremental embedder tracing step.
+    size_t incremental_embedder_max_worklist_size;
+
     // Amounts of time spent in different scopes during GC.
     double scopes[Scope::NUMBER_OF_SCOPES];
 
@@ -234,9 +267,24 @@ class V8_EXPORT_PRIVATE GCTracer {
 
   void AddSurvivalRatio(double survival_ratio);
 
+  // Log a string deduplication pass that made |strings| strings thin and
+  // freed |freed_bytes| bytes.
+  void AddStringDeduplication(double duration, size_t strings,
+                              size_t freed_bytes);
+
+  // Total bytes freed by string deduplication.
+  size_t deduplicated_string_bytes() const {
+    return deduplicated_string_bytes_;
+  }
+
   // Log an incremental marking step.
   void AddIncrementalMarkingStep(double duration, size_t bytes);
 
+  // Log an incremental embedder tracing step that processed |wrappers| and
+  // left |worklist_size| wrappers behind.
+  void AddIncrementalEmbedderTracingStep(size_t wrappers,
+                                         size_t worklist_size);
+
   // Compute the average incremental marking speed in bytes/millisecond.
   // Returns a conservative value if no events have been recorded.
   double IncrementalMarkingSpeedInBytesPerMillisecond() const;
@@ -322,6 +370,12 @@ class V8_EXPORT_PRIVATE GCTracer {
   double AverageMarkCompactMutatorUtilization() const;
   double CurrentMarkCompactMutatorUtilization() const;
 
+  // Returns the share of main thread time that was not spent in GC pauses or
+  // incremental marking steps between the last two GCs of any kind.
+  double CurrentMutatorUtilization() const {
+    return current_mutator_utilization_;
+  }
+
   V8_INLINE void AddScopeSample(Scope::ScopeId scope, double duration) {
     DCHECK(scope < Scope::NUMBER_OF_SCOPES);
     if (scope >= Scope::FIRST_INCREMENTAL_SCOPE &&
@@ -362,10 +416,12 @@ class V8_EXPORT_PRIVATE GCTracer {
   FRIEND_TEST(GCTracerTest, PerGenerationAllocationThroughput);
   FRIEND_TEST(GCTracerTest, PerGenerationAllocationThroughputWithProvidedTime);
   FRIEND_TEST(GCTracerTest, RegularScope);
+  FRIEND_TEST(GCTracerTest, IncrementalEmbedderTracingDetails);
   FRIEND_TEST(GCTracerTest, IncrementalMarkingDetails);
   FRIEND_TEST(GCTracerTest, IncrementalScope);
   FRIEND_TEST(GCTracerTest, IncrementalMarkingSpeed);
   FRIEND_TEST(GCTracerTest, MutatorUtilization);
+  FRIEND_TEST(GCTracerTest, MainThreadMutatorUtilization);
   FRIEND_TEST(GCTracerTest, RecordGCSumHistograms);
   FRIEND_TEST(GCTracerTest, RecordMarkCompactHistograms);
   FRIEND_TEST(GCTracerTest, RecordScavengerHistograms);
@@ -386,6 +442,10 @@ class V8_EXPORT_PRIVATE GCTracer {
   void RecordIncrementalMarkingSpeed(size_t bytes, double duration);
   void RecordMutatorUtilization(double mark_compactor_end_time,
                                 double mark_compactor_duration);
+  // Updates CurrentMutatorUtilization() at the end of a GC and emits it as a
+  // trace counter.
+  void RecordMainThreadMutatorUtilization(double gc_end_time,
+                                          double gc_duration);
 
   // Overall time spent in mark compact within a given GC cycle. Exact
   // accounting of events within a GC is not necessary which is why the
@@ -440,6 +500,11 @@ class V8_EXPORT_PRIVATE GCTracer {
   // compact event.
   double incremental_marking_duration_;
 
+  // Embedder tracing step statistics since the end of the last mark-compact
+  // event.
+  size_t incremental_embedder_wrappers_;
+  size_t incremental_embedder_max_worklist_size_;
+
   double incremental_marking_start_time_;
 
   double recorded_incremental_marking_speed_;
@@ -448,6 +513,10 @@ class V8_EXPORT_PRIVATE GCTracer {
 
   double recorded_embedder_speed_ = 0.0;
 
+  // Totals over all string deduplication passes.
+  size_t deduplicated_strings_ = 0;
+  size_t deduplicated_string_bytes_ = 0;
+
   // Incremental scopes carry more information than just the duration. The infos
   // here are merged back upon starting/stopping the GC tracer.
   IncrementalMarkingInfos
@@ -477,6 +546,11 @@ class V8_EXPORT_PRIVATE GCTracer {
   double current_mark_compact_mutator_utilization_;
   double previous_mark_compact_end_time_;
 
+  // Used for computing the mutator utilization with respect to all GCs.
+  double current_mutator_utilization_;
+  double previous_gc_end_time_;
+  double incremental_marking_steps_duration_since_gc_;
+
   base::RingBuffer<BytesAndDuration> recorded_minor_gcs_total_;
   base::RingBuffer<BytesAndDuration> recorded_minor_gcs_survived_;
   base::RingBuffer<BytesAndDuration> recorded_compactions_;
@@ -169,6 +169,46 @@ size_t MemoryController<Trait>::CalculateAllocationLimit(
   return result;
 }
 
+std::atomic<size_t> ProcessHeapBudget::total_live_bytes_{0};
+std::atomic<size_t> ProcessHeapBudget::total_throughput_{0};
+
+void ProcessHeapBudget::UpdateContribution(size_t old_live_bytes,
+                                           size_t old_throughput,
+                                           size_t new_live_bytes,
+                                           size_t new_throughput) {
+  // Wrap-around arithmetic keeps the totals consistent for concurrent updates
+  // from different isolates as all contributions are added and removed in
+  // pairs.
+  total_live_bytes_.fetch_add(new_live_bytes - old_live_bytes,
+                              std::memory_order_relaxed);
+  total_throughput_.fetch_add(new_throughput - old_throughput,
+                              std::memory_order_relaxed);
+}
+
+size_t ProcessHeapBudget::AllocationLimit(size_t budget, size_t live_bytes,
+                                          size_t throughput) {
+  return ComputeAllocationLimit(budget, live_bytes, throughput,
+                                total_live_bytes(), total_throughput());
+}
+
+size_t ProcessHeapBudget::ComputeAllocationLimit(size_t budget,
+                                                 size_t live_bytes,
+                                                 size_t throughput,
+                                                 size_t total_live_bytes,
+                                                 size_t total_throughput) {
+  total_live_bytes = std::max(total_live_bytes, live_bytes);
+  total_throughput = std::max(total_throughput, throughput);
+  if (budget <= total_live_bytes) return live_bytes;
+  const double headroom = static_cast<double>(budget - total_live_bytes);
+  double share = 1.0;
+  if (total_throughput > 0) {
+    share = static_cast<double>(throughput) / total_throughput;
+  } else if (total_live_bytes > 0) {
+    share = static_cast<double>(live_bytes) / total_live_bytes;
+  }
+  return live_bytes + static_cast<size_t>(headroom * share);
+}
+
 template class V8_EXPORT_PRIVATE MemoryController<V8HeapTrait>;
 template class V8_EXPORT_PRIVATE MemoryController<GlobalMemoryTrait>;
 
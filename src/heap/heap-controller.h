@@ -5,7 +5,9 @@
 #ifndef V8_HEAP_HEAP_CONTROLLER_H_
 #define V8_HEAP_HEAP_CONTROLLER_H_
 
+#include <atomic>
 #include <cstddef>
+
 #include "src/heap/heap.h"
 #include "src/utils/allocation.h"
 #include "testing/gtest/include/gtest/gtest_prod.h"  // nogncheck
@@ -56,6 +58,41 @@ class V8_EXPORT_PRIVATE MemoryController : public AllStatic {
   FRIEND_TEST(MemoryControllerTest, MaxHeapGrowingFactor);
 };
 
+// Splits a process-wide budget for the old generations of all isolates
+// (--process-heap-budget). After each full GC a heap reports its live size
+// and old generation allocation throughput. The budget not covered by live
+// objects is handed out in proportion to the throughput of the heaps, or in
+// proportion to their live size if no throughput has been observed yet.
+class V8_EXPORT_PRIVATE ProcessHeapBudget : public AllStatic {
+ public:
+  // Replaces a heap's previously reported contribution with a new one.
+  static void UpdateContribution(size_t old_live_bytes, size_t old_throughput,
+                                 size_t new_live_bytes, size_t new_throughput);
+
+  // Returns the old generation limit that a heap with the given live size and
+  // throughput may grow to within |budget|.
+  static size_t AllocationLimit(size_t budget, size_t live_bytes,
+                                size_t throughput);
+
+  static size_t total_live_bytes() {
+    return total_live_bytes_.load(std::memory_order_relaxed);
+  }
+  static size_t total_throughput() {
+    return total_throughput_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  static size_t ComputeAllocationLimit(size_t budget, size_t live_bytes,
+                                       size_t throughput,
+                                       size_t total_live_bytes,
+                                       size_t total_throughput);
+
+  static std::atomic<size_t> total_live_bytes_;
+  static std::atomic<size_t> total_throughput_;
+
+  FRIEND_TEST(MemoryControllerTest, ProcessHeapBudgetSplit);
+};
+
 }  // namespace internal
 }  // namespace v8
 
@@ -36,6 +36,7 @@
 #include "src/heap/barrier.h"
 #include "src/heap/base/stack.h"
 #include "src/heap/basic-memory-chunk.h"
+#include "src/heap/bytecode-flushing-policy.h"
 #include "src/heap/code-object-registry.h"
 #include "src/heap/code-range.h"
 #include "src/heap/code-stats.h"
@@ -43,6 +44,7 @@
 #include "src/heap/combined-heap.h"
 #include "src/heap/concurrent-allocator.h"
 #include "src/heap/concurrent-marking.h"
+#include "src/heap/context-allocation-tracker.h"
 #include "src/heap/cppgc-js/cpp-heap.h"
 #include "src/heap/embedder-tracing.h"
 #include "src/heap/finalization-registry-cleanup-task.h"
@@ -73,6 +75,7 @@
 #include "src/heap/scavenger-inl.h"
 #include "src/heap/stress-marking-observer.h"
 #include "src/heap/stress-scavenge-observer.h"
+#include "src/heap/string-deduplication-job.h"
 #include "src/heap/sweeper.h"
 #include "src/init/bootstrapper.h"
 #include "src/init/v8.h"
@@ -88,6 +91,8 @@
 #include "src/objects/shared-function-info.h"
 #include "src/objects/slots-atomic-inl.h"
 #include "src/objects/slots-inl.h"
+#include "src/profiler/heap-profiler.h"
+#include "src/profiler/sampling-heap-profiler.h"
 #include "src/regexp/regexp.h"
 #include "src/snapshot/embedded/embedded-data.h"
 #include "src/snapshot/serializer-deserializer.h"
@@ -98,6 +103,7 @@
 #include "src/tracing/trace-event.h"
 #include "src/utils/utils-inl.h"
 #include "src/utils/utils.h"
+#include "src/zone/accounting-allocator.h"
 
 #ifdef V8_ENABLE_CONSERVATIVE_STACK_SCANNING
 #include "src/heap/conservative-stack-visitor.h"
@@ -2258,20 +2264,37 @@ void Heap::PerformSharedGarbageCollection(Isolate* initiator,
 
   tracer()->Start(collector, gc_reason, collector_reason);
 
-  isolate()->IterateClientIsolates([initiator](Isolate* client) {
-    DCHECK_NOT_NULL(client->shared_isolate());
-    Heap* client_heap = client->heap();
-
-    IsolateSafepoint::StopMainThread stop_main_thread =
-        initiator == client ? IsolateSafepoint::StopMainThread::kNo
-                            : IsolateSafepoint::StopMainThread::kYes;
-
-    client_heap->safepoint()->EnterSafepointScope(stop_main_thread);
-    DCHECK(client_heap->deserialization_complete());
-
-    client_heap->shared_old_allocator_->FreeLinearAllocationArea();
-    client_heap->shared_map_allocator_->FreeLinearAllocationArea();
-  });
+  {
+    TRACE_GC(tracer(), GCTracer::Scope::TIME_TO_SAFEPOINT);
+
+    // Ask all clients to stop before waiting for any of them, so that the
+    // time to the global safepoint is that of the slowest client rather than
+    // the sum over all clients.
+    std::vector<int> running_threads;
+    isolate()->IterateClientIsolates(
+        [initiator, &running_threads](Isolate* client) {
+          DCHECK_NOT_NULL(client->shared_isolate());
+          IsolateSafepoint::StopMainThread stop_main_thread =
+              initiator == client ? IsolateSafepoint::StopMainThread::kNo
+                                  : IsolateSafepoint::StopMainThread::kYes;
+          running_threads.push_back(
+              client->heap()->safepoint()->InitiateSafepointScope(
+                  stop_main_thread));
+        });
+
+    size_t client_index = 0;
+    isolate()->IterateClientIsolates(
+        [&running_threads, &client_index](Isolate* client) {
+          Heap* client_heap = client->heap();
+          client_heap->safepoint()->WaitUntilRunningThreadsInSafepoint(
+              running_threads[client_index++]);
+          DCHECK(client_heap->deserialization_complete());
+
+          client_heap->shared_old_allocator_->FreeLinearAllocationArea();
+          client_heap->shared_map_allocator_->FreeLinearAllocationArea();
+        });
+    DCHECK_EQ(client_index, running_threads.size());
+  }
 
   PerformGarbageCollection(GarbageCollector::MARK_COMPACTOR);
 
@@ -2365,11 +2388,37 @@ void Heap::RecomputeLimits(GarbageCollector collector) {
   if (collector == GarbageCollector::MARK_COMPACTOR) {
     external_memory_.ResetAfterGC();
 
-    set_old_generation_allocation_limit(
+    size_t new_old_generation_limit =
         MemoryController<V8HeapTrait>::CalculateAllocationLimit(
             this, old_gen_size, min_old_generation_size_,
             max_old_generation_size(), new_space_capacity, v8_growing_factor,
-            mode));
+            mode);
+    if (FLAG_process_heap_budget > 0) {
+      const size_t throughput = static_cast<size_t>(v8_mutator_speed);
+      ProcessHeapBudget::UpdateContribution(process_budget_live_bytes_,
+                                            process_budget_throughput_,
+                                            old_gen_size, throughput);
+      process_budget_live_bytes_ = old_gen_size;
+      process_budget_throughput_ = throughput;
+      // Always leave room for the minimal growing step to avoid back-to-back
+      // GCs when the process is over budget.
+      const size_t budget_limit = std::max(
+          ProcessHeapBudget::AllocationLimit(FLAG_process_heap_budget * MB,
+                                             old_gen_size, throughput),
+          old_gen_size +
+              MemoryController<V8HeapTrait>::MinimumAllocationLimitGrowingStep(
+                  mode));
+      if (FLAG_trace_gc_verbose && budget_limit < new_old_generation_limit) {
+        isolate()->PrintWithTimestamp(
+            "[ProcessHeapBudget] Limit: %zu KB instead of %zu KB (process "
+            "live: %zu KB)\n",
+            budget_limit / KB, new_old_generation_limit / KB,
+            ProcessHeapBudget::total_live_bytes() / KB);
+      }
+      new_old_generation_limit =
+          std::min(new_old_generation_limit, budget_limit);
+    }
+    set_old_generation_allocation_limit(new_old_generation_limit);
     if (UseGlobalMemoryScheduling()) {
       DCHECK_GT(global_growing_factor, 0);
       global_allocation_limit_ =
@@ -2497,6 +2546,24 @@ void Heap::MinorMarkCompact() {
 #endif  // ENABLE_MINOR_MC
 }
 
+class MigrateDeprecatedInstancesTask : public CancelableTask {
+ public:
+  explicit MigrateDeprecatedInstancesTask(Heap* heap)
+      : CancelableTask(heap->isolate()), heap_(heap) {}
+
+  ~MigrateDeprecatedInstancesTask() override = default;
+  MigrateDeprecatedInstancesTask(const MigrateDeprecatedInstancesTask&) =
+      delete;
+  MigrateDeprecatedInstancesTask& operator=(
+      const MigrateDeprecatedInstancesTask&) = delete;
+
+ private:
+  // v8::internal::CancelableTask overrides.
+  void RunInternal() override { heap_->MigrateDeprecatedInstances(); }
+
+  Heap* heap_;
+};
+
 void Heap::MarkCompactEpilogue() {
   TRACE_GC(tracer(), GCTracer::Scope::MC_EPILOGUE);
   SetGCState(NOT_IN_GC);
@@ -2506,6 +2573,18 @@ void Heap::MarkCompactEpilogue() {
   incremental_marking()->Epilogue();
 
   DCHECK(incremental_marking()->IsStopped());
+
+  if (FLAG_migrate_deprecated_instances &&
+      maps_deprecated_since_migration_ > 0 &&
+      !migrate_deprecated_instances_task_pending_) {
+    migrate_deprecated_instances_task_pending_ = true;
+    auto taskrunner = V8::GetCurrentPlatform()->GetForegroundTaskRunner(
+        reinterpret_cast<v8::Isolate*>(isolate()));
+    taskrunner->PostTask(
+        std::make_unique<MigrateDeprecatedInstancesTask>(this));
+  }
+
+  string_deduplication_job_->ScheduleTaskIfNeeded(this);
 }
 
 void Heap::MarkCompactPrologue() {
@@ -2887,10 +2966,12 @@ void Heap::ProcessAllWeakReferences(WeakObjectRetainer* retainer) {
   ProcessNativeContexts(retainer);
   ProcessAllocationSites(retainer);
   ProcessDirtyJSFinalizationRegistries(retainer);
+  ProcessSampledObjects(retainer, false);
 }
 
 void Heap::ProcessYoungWeakReferences(WeakObjectRetainer* retainer) {
   ProcessNativeContexts(retainer);
+  ProcessSampledObjects(retainer, true);
 }
 
 void Heap::ProcessNativeContexts(WeakObjectRetainer* retainer) {
@@ -2916,6 +2997,16 @@ void Heap::ProcessDirtyJSFinalizationRegistries(WeakObjectRetainer* retainer) {
   }
 }
 
+void Heap::ProcessSampledObjects(WeakObjectRetainer* retainer,
+                                 bool young_only) {
+  HeapProfiler* heap_profiler = isolate()->heap_profiler();
+  if (heap_profiler == nullptr || !heap_profiler->is_sampling_allocations()) {
+    return;
+  }
+  heap_profiler->sampling_heap_profiler()->ProcessSamples(retainer,
+                                                          young_only);
+}
+
 void Heap::ProcessWeakListRoots(WeakObjectRetainer* retainer) {
   set_native_contexts_list(retainer->RetainAs(native_contexts_list()));
   set_allocation_sites_list(retainer->RetainAs(allocation_sites_list()));
@@ -2923,6 +3014,7 @@ void Heap::ProcessWeakListRoots(WeakObjectRetainer* retainer) {
       retainer->RetainAs(dirty_js_finalization_registries_list()));
   set_dirty_js_finalization_registries_list_tail(
       retainer->RetainAs(dirty_js_finalization_registries_list_tail()));
+  ProcessSampledObjects(retainer, false);
 }
 
 void Heap::ForeachAllocationSite(
@@ -3664,6 +3756,28 @@ void Heap::ActivateMemoryReducerIfNeeded() {
   }
 }
 
+ContextAllocationTracker* Heap::EnsureContextAllocationTracker() {
+  if (!context_allocation_tracker_) {
+    context_allocation_tracker_ =
+        std::make_unique<ContextAllocationTracker>(this);
+    AddAllocationObserversToAllSpaces(context_allocation_tracker_.get(),
+                                      context_allocation_tracker_.get());
+  }
+  return context_allocation_tracker_.get();
+}
+
+void Heap::NotifyEmbedderIdle() {
+  if (!incremental_marking()->IsStopped()) {
+    incremental_marking()->incremental_marking_job()->ScheduleTask(this);
+  }
+  if (memory_reducer_ != nullptr) {
+    MemoryReducer::Event event;
+    event.type = MemoryReducer::kPossibleGarbage;
+    event.time_ms = MonotonicallyIncreasingTimeInMs();
+    memory_reducer_->NotifyPossibleGarbage(event);
+  }
+}
+
 void Heap::ReduceNewSpaceSize() {
   static const size_t kLowAllocationThroughput = 1000;
   const double allocation_throughput =
@@ -4005,10 +4119,43 @@ class MemoryPressureInterruptTask : public CancelableTask {
   Heap* heap_;
 };
 
+int Heap::MigrateDeprecatedInstances() {
+  TRACE_EVENT0("v8", "V8.MigrateDeprecatedInstances");
+  migrate_deprecated_instances_task_pending_ = false;
+  maps_deprecated_since_migration_ = 0;
+
+  // Collect the objects first, as migrating them allocates.
+  HandleScope scope(isolate());
+  std::vector<Handle<JSObject>> instances;
+  {
+    HeapObjectIterator iterator(this);
+    for (HeapObject object = iterator.Next(); !object.is_null();
+         object = iterator.Next()) {
+      if (!object.IsJSObject() || !object.map().is_deprecated()) continue;
+      instances.push_back(handle(JSObject::cast(object), isolate()));
+    }
+  }
+
+  int migrated = 0;
+  for (Handle<JSObject> instance : instances) {
+    // Migrating an object can also migrate others, e.g. its prototype.
+    if (!instance->map().is_deprecated()) continue;
+    JSObject::MigrateInstance(isolate(), instance);
+    migrated++;
+  }
+  if (FLAG_trace_gc_verbose) {
+    isolate()->PrintWithTimestamp(
+        "Migrated %d objects off deprecated maps, %zu maps remain\n", migrated,
+        NumberOfMaps());
+  }
+  return migrated;
+}
+
 void Heap::CheckMemoryPressure() {
   if (HighMemoryPressure()) {
     // The optimizing compiler may be unnecessarily holding on to memory.
     isolate()->AbortConcurrentOptimization(BlockingBehavior::kDontBlock);
+    AccountingAllocator::ReleasePooledSegments();
   }
   // Reset the memory pressure level to avoid recursive GCs triggered by
   // CheckMemoryPressure from AdjustAmountOfExternalMemory called by
@@ -4993,8 +5140,21 @@ void Heap::ConfigureHeap(const v8::ResourceConstraints& constraints) {
                                     ? max_heap_size - young_generation_size
                                     : 0;
     }
+    if (FLAG_process_heap_budget > 0) {
+      max_old_generation_size =
+          std::min(max_old_generation_size, FLAG_process_heap_budget * MB);
+    }
     max_old_generation_size =
         std::max(max_old_generation_size, MinOldGenerationSize());
+    if (FLAG_trace_gc &&
+        max_old_generation_size > AllocatorLimitOnMaxOldGenerationSize()) {
+      // With pointer compression the heap has to fit into its cage.
+      PrintIsolate(isolate_,
+                   "Requested old generation size of %zu MB exceeds the "
+                   "allocator limit, using %zu MB\n",
+                   max_old_generation_size / MB,
+                   AllocatorLimitOnMaxOldGenerationSize() / MB);
+    }
     max_old_generation_size = std::min(max_old_generation_size,
                                        AllocatorLimitOnMaxOldGenerationSize());
     max_old_generation_size =
@@ -5278,6 +5438,21 @@ bool Heap::IsMainThreadParked(LocalHeap* local_heap) {
   return local_heap->main_thread_parked_;
 }
 
+bool Heap::TryUseLargeObjectSlackBackground(LocalHeap* local_heap,
+                                            size_t size) {
+  const size_t slack = FLAG_background_large_object_slack * KB;
+  if (!local_heap || local_heap->is_main_thread() || slack == 0) return false;
+  // The slack is replenished by every GC. Reading gc_count_ is safe as GCs
+  // only happen while this thread is in a safepoint.
+  if (local_heap->large_object_slack_gc_count_ != gc_count_) {
+    local_heap->large_object_slack_gc_count_ = gc_count_;
+    local_heap->large_object_slack_used_ = 0;
+  }
+  if (local_heap->large_object_slack_used_ + size > slack) return false;
+  local_heap->large_object_slack_used_ += size;
+  return true;
+}
+
 Heap::HeapGrowingMode Heap::CurrentHeapGrowingMode() {
   if (ShouldReduceMemory() || FLAG_stress_compaction) {
     return Heap::HeapGrowingMode::kMinimal;
@@ -5669,6 +5844,7 @@ void Heap::SetUpSpaces() {
   array_buffer_sweeper_.reset(new ArrayBufferSweeper(this));
   gc_idle_time_handler_.reset(new GCIdleTimeHandler());
   memory_measurement_.reset(new MemoryMeasurement(isolate()));
+  bytecode_flushing_policy_.reset(new BytecodeFlushingPolicy());
   memory_reducer_.reset(new MemoryReducer(this));
   if (V8_UNLIKELY(TracingFlags::is_gc_stats_enabled())) {
     live_object_stats_.reset(new ObjectStats(this));
@@ -5695,6 +5871,8 @@ void Heap::SetUpSpaces() {
     new_space()->AddAllocationObserver(scavenge_task_observer_.get());
   }
 
+  string_deduplication_job_.reset(new StringDeduplicationJob());
+
   SetGetExternallyAllocatedMemoryInBytesCallback(
       DefaultGetExternallyAllocatedMemoryInBytesCallback);
 
@@ -5921,6 +6099,11 @@ void Heap::TearDown() {
 
   UpdateMaximumCommitted();
 
+  ProcessHeapBudget::UpdateContribution(process_budget_live_bytes_,
+                                        process_budget_throughput_, 0, 0);
+  process_budget_live_bytes_ = 0;
+  process_budget_throughput_ = 0;
+
   if (FLAG_verify_predictable || FLAG_fuzzer_gc_analysis) {
     PrintAllocationsHash();
   }
@@ -5940,6 +6123,7 @@ void Heap::TearDown() {
 
   scavenge_task_observer_.reset();
   scavenge_job_.reset();
+  string_deduplication_job_.reset();
 
   if (need_to_remove_stress_concurrent_allocation_observer_) {
     RemoveAllocationObserversFromAllSpaces(
@@ -5948,6 +6132,12 @@ void Heap::TearDown() {
   }
   stress_concurrent_allocation_observer_.reset();
 
+  if (context_allocation_tracker_) {
+    RemoveAllocationObserversFromAllSpaces(context_allocation_tracker_.get(),
+                                           context_allocation_tracker_.get());
+    context_allocation_tracker_.reset();
+  }
+
   if (FLAG_stress_marking > 0) {
     RemoveAllocationObserversFromAllSpaces(stress_marking_observer_,
                                            stress_marking_observer_);
@@ -5981,6 +6171,7 @@ void Heap::TearDown() {
   gc_idle_time_handler_.reset();
 
   memory_measurement_.reset();
+  bytecode_flushing_policy_.reset();
 
   if (memory_reducer_ != nullptr) {
     memory_reducer_->TearDown();
@@ -6829,6 +7020,11 @@ size_t Heap::NumberOfNativeContexts() {
   return result;
 }
 
+size_t Heap::NumberOfMaps() {
+  // All maps outside of read-only space have the same size.
+  return map_space()->SizeOfObjects() / Map::kSize;
+}
+
 std::vector<Handle<NativeContext>> Heap::FindAllNativeContexts() {
   std::vector<Handle<NativeContext>> result;
   Object context = native_contexts_list();
@@ -7146,6 +7342,12 @@ void Heap::WriteBarrierForRangeImpl(MemoryChunk* source_page, HeapObject object,
   MarkingBarrier* marking_barrier = WriteBarrier::CurrentMarkingBarrier(this);
   MarkCompactCollector* collector = this->mark_compact_collector();
 
+  // Old-to-new slots are collected per slot set cell and inserted together,
+  // which keeps copies of arrays full of young objects cheap.
+  constexpr Address kCellSize = SlotSet::kBitsPerCell * kTaggedSize;
+  Address cell_start = kNullAddress;
+  uint32_t cell_mask = 0;
+
   for (TSlot slot = start_slot; slot < end_slot; ++slot) {
     typename TSlot::TObject value = *slot;
     HeapObject value_heap_object;
@@ -7153,8 +7355,16 @@ void Heap::WriteBarrierForRangeImpl(MemoryChunk* source_page, HeapObject object,
 
     if ((kModeMask & kDoGenerational) &&
         Heap::InYoungGeneration(value_heap_object)) {
-      RememberedSet<OLD_TO_NEW>::Insert<AccessMode::NON_ATOMIC>(source_page,
-                                                                slot.address());
+      Address cell = RoundDown(slot.address(), kCellSize);
+      if (cell != cell_start) {
+        if (cell_mask != 0) {
+          RememberedSet<OLD_TO_NEW>::InsertCell<AccessMode::NON_ATOMIC>(
+              source_page, cell_start, cell_mask);
+        }
+        cell_start = cell;
+        cell_mask = 0;
+      }
+      cell_mask |= 1u << ((slot.address() - cell) >> kTaggedSizeLog2);
     }
 
     if ((kModeMask & kDoMarking) &&
@@ -7165,6 +7375,11 @@ void Heap::WriteBarrierForRangeImpl(MemoryChunk* source_page, HeapObject object,
       }
     }
   }
+
+  if (cell_mask != 0) {
+    RememberedSet<OLD_TO_NEW>::InsertCell<AccessMode::NON_ATOMIC>(
+        source_page, cell_start, cell_mask);
+  }
 }
 
 // Instantiate Heap::WriteBarrierForRange() for ObjectSlot and MaybeObjectSlot.
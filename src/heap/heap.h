@@ -68,12 +68,14 @@ using v8::MemoryPressureLevel;
 
 class ArrayBufferCollector;
 class ArrayBufferSweeper;
+class BytecodeFlushingPolicy;
 class BasicMemoryChunk;
 class CodeLargeObjectSpace;
 class CodeRange;
 class CollectionBarrier;
 class ConcurrentAllocator;
 class ConcurrentMarking;
+class ContextAllocationTracker;
 class CppHeap;
 class GCIdleTimeHandler;
 class GCIdleTimeHeapState;
@@ -107,6 +109,7 @@ class ScavengerCollector;
 class SharedReadOnlySpace;
 class Space;
 class StressScavengeObserver;
+class StringDeduplicationJob;
 class TimedHistogram;
 class WeakObjectRetainer;
 
@@ -723,6 +726,12 @@ class Heap {
                                                     bool is_isolate_locked);
   void CheckMemoryPressure();
 
+  // Migrates all objects that still use deprecated maps to their up-to-date
+  // maps, so that the next full GC can free the deprecated maps and prune
+  // their transitions. Returns the number of migrated objects.
+  V8_EXPORT_PRIVATE int MigrateDeprecatedInstances();
+  void NotifyMapDeprecated() { maps_deprecated_since_migration_++; }
+
   V8_EXPORT_PRIVATE void AddNearHeapLimitCallback(v8::NearHeapLimitCallback,
                                                   void* data);
   V8_EXPORT_PRIVATE void RemoveNearHeapLimitCallback(
@@ -814,6 +823,9 @@ class Heap {
 
   void ActivateMemoryReducerIfNeeded();
 
+  // Called when the embedder switches to PERFORMANCE_IDLE RAIL mode.
+  void NotifyEmbedderIdle();
+
   V8_EXPORT_PRIVATE bool ShouldOptimizeForMemoryUsage();
 
   bool HighMemoryPressure() {
@@ -1313,6 +1325,9 @@ class Heap {
   // The total number of native contexts that were detached but were not
   // garbage collected yet.
   size_t NumberOfDetachedContexts();
+  // The number of maps in the map space, including dead ones that were not
+  // swept yet.
+  size_t NumberOfMaps();
 
   // ===========================================================================
   // Code statistics. ==========================================================
@@ -1979,6 +1994,7 @@ class Heap {
   void ProcessNativeContexts(WeakObjectRetainer* retainer);
   void ProcessAllocationSites(WeakObjectRetainer* retainer);
   void ProcessDirtyJSFinalizationRegistries(WeakObjectRetainer* retainer);
+  void ProcessSampledObjects(WeakObjectRetainer* retainer, bool young_only);
   void ProcessWeakListRoots(WeakObjectRetainer* retainer);
 
   // ===========================================================================
@@ -2051,6 +2067,9 @@ class Heap {
       LocalHeap* local_heap = nullptr);
   bool IsRetryOfFailedAllocation(LocalHeap* local_heap);
   bool IsMainThreadParked(LocalHeap* local_heap);
+  // Returns true if the background thread may allocate a large object of the
+  // given size beyond the old generation limit without waiting for a GC.
+  bool TryUseLargeObjectSlackBackground(LocalHeap* local_heap, size_t size);
 
   HeapGrowingMode CurrentHeapGrowingMode();
 
@@ -2178,6 +2197,15 @@ class Heap {
   std::vector<WeakArrayList> FindAllRetainedMaps();
   MemoryMeasurement* memory_measurement() { return memory_measurement_.get(); }
 
+  BytecodeFlushingPolicy* bytecode_flushing_policy() {
+    return bytecode_flushing_policy_.get();
+  }
+
+  ContextAllocationTracker* context_allocation_tracker() {
+    return context_allocation_tracker_.get();
+  }
+  ContextAllocationTracker* EnsureContextAllocationTracker();
+
   AllocationType allocation_type_for_in_place_internalizable_strings() const {
     return allocation_type_for_in_place_internalizable_strings_;
   }
@@ -2206,6 +2234,10 @@ class Heap {
 
   size_t initial_max_old_generation_size_ = 0;
   size_t initial_max_old_generation_size_threshold_ = 0;
+
+  // The live size and throughput last reported to ProcessHeapBudget.
+  size_t process_budget_live_bytes_ = 0;
+  size_t process_budget_throughput_ = 0;
   size_t initial_old_generation_size_ = 0;
   bool old_generation_size_configured_ = false;
   size_t maximum_committed_ = 0;
@@ -2231,6 +2263,11 @@ class Heap {
   // and reset by a mark-compact garbage collection.
   std::atomic<MemoryPressureLevel> memory_pressure_level_;
 
+  // The number of maps that were deprecated since MigrateDeprecatedInstances
+  // last ran, and whether a task to run it is already posted.
+  size_t maps_deprecated_since_migration_ = 0;
+  bool migrate_deprecated_instances_task_pending_ = false;
+
   std::vector<std::pair<v8::NearHeapLimitCallback, void*>>
       near_heap_limit_callbacks_;
 
@@ -2380,11 +2417,14 @@ class Heap {
   std::unique_ptr<ConcurrentMarking> concurrent_marking_;
   std::unique_ptr<GCIdleTimeHandler> gc_idle_time_handler_;
   std::unique_ptr<MemoryMeasurement> memory_measurement_;
+  std::unique_ptr<BytecodeFlushingPolicy> bytecode_flushing_policy_;
+  std::unique_ptr<ContextAllocationTracker> context_allocation_tracker_;
   std::unique_ptr<MemoryReducer> memory_reducer_;
   std::unique_ptr<ObjectStats> live_object_stats_;
   std::unique_ptr<ObjectStats> dead_object_stats_;
   std::unique_ptr<ScavengeJob> scavenge_job_;
   std::unique_ptr<AllocationObserver> scavenge_task_observer_;
+  std::unique_ptr<StringDeduplicationJob> string_deduplication_job_;
   std::unique_ptr<AllocationObserver> stress_concurrent_allocation_observer_;
   std::unique_ptr<LocalEmbedderHeapTracer> local_embedder_heap_tracer_;
   std::unique_ptr<MarkingBarrier> marking_barrier_;
@@ -121,6 +121,16 @@ void IncrementalMarkingJob::Task::RunInternal() {
     job_->SetTaskPending(task_type_, false);
   }
 
+  if (!incremental_marking->IsStopped() &&
+      FLAG_rail_response_defers_marking_tasks &&
+      isolate()->rail_mode() == PERFORMANCE_RESPONSE &&
+      !incremental_marking->finalize_marking_completed()) {
+    // A latency critical phase is in progress. Marking still advances on
+    // allocation; task-based steps resume when the RAIL mode changes.
+    job_->ScheduleTask(heap, TaskType::kDelayed);
+    return;
+  }
+
   if (!incremental_marking->IsStopped()) {
     // All objects are initialized at that point.
     heap->new_space()->MarkLabStartInitialized();
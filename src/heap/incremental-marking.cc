@@ -529,6 +529,7 @@ StepResult IncrementalMarking::EmbedderStep(double expected_duration_ms,
   const double start = heap_->MonotonicallyIncreasingTimeInMs();
   const double deadline = start + expected_duration_ms;
   bool empty_worklist;
+  size_t wrappers = 0;
   {
     LocalEmbedderHeapTracer::ProcessingScope scope(local_tracer);
     HeapObject object;
@@ -536,6 +537,7 @@ StepResult IncrementalMarking::EmbedderStep(double expected_duration_ms,
     empty_worklist = true;
     while (local_marking_worklists()->PopEmbedder(&object)) {
       scope.TracePossibleWrapper(JSObject::cast(object));
+      wrappers++;
       if (++cnt == kObjectsToProcessBeforeDeadlineCheck) {
         if (deadline <= heap_->MonotonicallyIncreasingTimeInMs()) {
           empty_worklist = false;
@@ -552,6 +554,11 @@ StepResult IncrementalMarking::EmbedderStep(double expected_duration_ms,
       local_tracer->Trace(deadline - heap_->MonotonicallyIncreasingTimeInMs());
   double current = heap_->MonotonicallyIncreasingTimeInMs();
   local_tracer->SetEmbedderWorklistEmpty(empty_worklist);
+  // The global worklist only tracks segments, so the number of wrappers left
+  // behind is approximated by the capacity of the published segments.
+  heap_->tracer()->AddIncrementalEmbedderTracingStep(
+      wrappers, collector_->marking_worklists()->embedder()->Size() *
+                    EmbedderTracingWorklist::kSegmentSize);
   *duration_ms = current - start;
   return (empty_worklist && remote_tracing_done)
              ? StepResult::kNoImmediateWork
@@ -875,6 +882,18 @@ size_t IncrementalMarking::ComputeStepSizeInBytes(StepOrigin step_origin) {
   return scheduled_bytes_to_mark_ - bytes_marked_ - kScheduleMarginInBytes;
 }
 
+bool IncrementalMarking::ShouldLeaveStepToConcurrentMarking(
+    StepOrigin step_origin) {
+  if (!FLAG_concurrent_marking || !FLAG_skip_marking_steps_when_ahead ||
+      step_origin != StepOrigin::kV8) {
+    return false;
+  }
+  // Embedder tracing is not concurrent, and with empty worklists the step
+  // has to run to finalize marking.
+  return !heap_->local_embedder_heap_tracer()->InUse() &&
+         !local_marking_worklists()->IsEmpty();
+}
+
 void IncrementalMarking::AdvanceOnAllocation() {
   // Code using an AlwaysAllocateScope assumes that the GC state does not
   // change; that implies that no marking steps must be performed.
@@ -929,6 +948,19 @@ StepResult IncrementalMarking::Step(double max_step_size_in_ms,
         max_step_size_in_ms, marking_speed);
     bytes_to_process =
         std::min(ComputeStepSizeInBytes(step_origin), max_step_size);
+    if (bytes_to_process == 0 &&
+        ShouldLeaveStepToConcurrentMarking(step_origin)) {
+      // The concurrent markers keep up with the schedule. Leave the remaining
+      // work to them and finalize once a later step finds it done.
+      local_marking_worklists()->ShareWork();
+      heap_->concurrent_marking()->RescheduleJobIfNeeded();
+      if (FLAG_trace_incremental_marking) {
+        heap_->isolate()->PrintWithTimestamp(
+            "[IncrementalMarking] Step in v8 skipped, concurrent marking is "
+            "ahead of schedule\n");
+      }
+      return StepResult::kMoreWorkRemaining;
+    }
     bytes_to_process = std::max({bytes_to_process, kMinStepSizeInBytes});
 
     // Perform a single V8 and a single embedder step. In case both have been
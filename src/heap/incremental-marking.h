@@ -272,6 +272,9 @@ class V8_EXPORT_PRIVATE IncrementalMarking final {
   // Returns the bytes to mark in the current step based on the scheduled
   // bytes and already marked bytes.
   size_t ComputeStepSizeInBytes(StepOrigin step_origin);
+  // Returns true if a step that is ahead of schedule may skip marking on the
+  // main thread altogether.
+  bool ShouldLeaveStepToConcurrentMarking(StepOrigin step_origin);
 
   void AdvanceOnAllocation();
 
@@ -169,8 +169,14 @@ AllocationResult OldLargeObjectSpace::AllocateRawBackground(
   DCHECK(!FLAG_enable_third_party_heap);
   // Check if we want to force a GC before growing the old space further.
   // If so, fail the allocation.
-  if (!heap()->CanExpandOldGenerationBackground(local_heap, object_size) ||
-      !heap()->ShouldExpandOldGenerationOnSlowAllocation(local_heap)) {
+  if (!heap()->CanExpandOldGenerationBackground(local_heap, object_size)) {
+    return AllocationResult::Retry(identity());
+  }
+  // Failing here makes the background thread wait for a GC on the main
+  // thread. A bounded amount of large objects can go beyond the limit instead;
+  // GC is still triggered through incremental marking below.
+  if (!heap()->ShouldExpandOldGenerationOnSlowAllocation(local_heap) &&
+      !heap()->TryUseLargeObjectSlackBackground(local_heap, object_size)) {
     return AllocationResult::Retry(identity());
   }
 
@@ -294,6 +294,11 @@ class V8_EXPORT_PRIVATE LocalHeap {
   bool allocation_failed_;
   bool main_thread_parked_;
 
+  // Large object bytes allocated beyond the old generation limit since the GC
+  // with the given count, see Heap::TryUseLargeObjectSlackBackground.
+  size_t large_object_slack_used_ = 0;
+  unsigned int large_object_slack_gc_count_ = 0;
+
   LocalHeap* prev_;
   LocalHeap* next_;
 
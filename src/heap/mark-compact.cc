@@ -18,6 +18,7 @@
 #include "src/execution/vm-state-inl.h"
 #include "src/handles/global-handles.h"
 #include "src/heap/array-buffer-sweeper.h"
+#include "src/heap/bytecode-flushing-policy.h"
 #include "src/heap/code-object-registry.h"
 #include "src/heap/gc-tracer.h"
 #include "src/heap/incremental-marking-inl.h"
@@ -558,6 +559,7 @@ void MarkCompactCollector::StartMarking() {
     }
   }
   code_flush_mode_ = Heap::GetCodeFlushMode(isolate());
+  heap()->bytecode_flushing_policy()->StartMarking();
   marking_worklists()->CreateContextWorklists(contexts);
   local_marking_worklists_ =
       std::make_unique<MarkingWorklists::Local>(marking_worklists());
@@ -587,6 +589,7 @@ void MarkCompactCollector::CollectGarbage() {
   VerifyMarking();
   heap()->memory_measurement()->FinishProcessing(native_context_stats_);
   RecordObjectStats();
+  if (V8_UNLIKELY(FLAG_trace_long_lived_pages)) TraceLongLivedPages();
 
   StartSweepSpaces();
   Evacuate();
@@ -719,6 +722,15 @@ void MarkCompactCollector::ComputeEvacuationHeuristics(
       *target_fragmentation_percent = kTargetFragmentationPercent;
     }
     *max_evacuated_bytes = kMaxEvacuatedBytes;
+    if (FLAG_compaction_pause_budget_ms > 0 &&
+        estimated_compaction_speed != 0) {
+      // Evacuation happens in the atomic pause. Bound the evacuated bytes by
+      // what the traced compaction speed allows within the pause budget.
+      // Parallel evacuation only makes this estimate more conservative.
+      const size_t budget_bytes = static_cast<size_t>(
+          FLAG_compaction_pause_budget_ms * estimated_compaction_speed);
+      *max_evacuated_bytes = std::min(*max_evacuated_bytes, budget_bytes);
+    }
   }
 }
 
@@ -2023,6 +2035,13 @@ void MarkCompactCollector::ProcessEphemeronMarking() {
   if (!ProcessEphemeronsUntilFixpoint()) {
     // Fixpoint iteration needed too many iterations and was cancelled. Use the
     // guaranteed linear algorithm.
+    isolate()->counters()->gc_ephemeron_linear_fallback()->Increment();
+    if (FLAG_trace_gc_verbose) {
+      isolate()->PrintWithTimestamp(
+          "Ephemeron fixpoint not reached after %d iterations, switching to "
+          "linear algorithm\n",
+          FLAG_ephemeron_fixpoint_iterations);
+    }
     ProcessEphemeronsLinear();
   }
 
@@ -2057,6 +2076,30 @@ void MarkCompactCollector::ProcessTopOptimizedFrame(ObjectVisitor* visitor,
   }
 }
 
+void MarkCompactCollector::TraceLongLivedPages() {
+  size_t pages = 0;
+  size_t long_lived_pages = 0;
+  size_t live_bytes = 0;
+  size_t long_lived_live_bytes = 0;
+  for (Page* p : *heap()->old_space()) {
+    const size_t page_live_bytes =
+        static_cast<size_t>(non_atomic_marking_state()->live_bytes(p));
+    pages++;
+    live_bytes += page_live_bytes;
+    if (p->full_gc_survivals() >= FLAG_long_lived_page_min_survivals) {
+      long_lived_pages++;
+      long_lived_live_bytes += page_live_bytes;
+    }
+  }
+  PrintIsolate(isolate(),
+               "long-lived-pages: pages=%zu long_lived_pages=%zu "
+               "live_kb=%zu long_lived_live_kb=%zu long_lived_percent=%.1f\n",
+               pages, long_lived_pages, live_bytes / KB,
+               long_lived_live_bytes / KB,
+               live_bytes == 0 ? 0.0
+                               : 100.0 * long_lived_live_bytes / live_bytes);
+}
+
 void MarkCompactCollector::RecordObjectStats() {
   if (V8_UNLIKELY(TracingFlags::is_gc_stats_enabled())) {
     heap()->CreateObjectStats();
@@ -2235,6 +2278,7 @@ void MarkCompactCollector::ClearNonLiveReferences() {
     // code object on the JSFunction.
     ProcessOldCodeCandidates();
     ProcessFlushedBaselineCandidates();
+    heap()->bytecode_flushing_policy()->UpdateAfterMarking(isolate());
   }
 
   {
@@ -2333,6 +2377,9 @@ void MarkCompactCollector::FlushBytecodeFromSFI(
   int start_position = shared_info.StartPosition();
   int end_position = shared_info.EndPosition();
 
+  shared_info.set_has_flushed_bytecode(true);
+  heap()->bytecode_flushing_policy()->NotifyBytecodeFlushed();
+
   shared_info.DiscardCompiledMetadata(
       isolate(), [](HeapObject object, ObjectSlot slot, HeapObject target) {
         RecordSlot(object, slot, target);
@@ -3226,6 +3273,9 @@ class Evacuator : public Malloced {
   virtual GCTracer::Scope::ScopeId GetBackgroundTracingScope() = 0;
   virtual GCTracer::Scope::ScopeId GetTracingScope() = 0;
 
+  // Live bytes of the pages this evacuator has processed so far.
+  intptr_t bytes_compacted() const { return bytes_compacted_; }
+
  protected:
   static const int kInitialLocalPretenuringFeedbackCapacity = 256;
 
@@ -3412,9 +3462,13 @@ class PageEvacuationJob : public v8::JobTask {
       TRACE_GC(tracer_, evacuator->GetTracingScope());
       ProcessItems(delegate, evacuator);
     } else {
-      TRACE_GC_EPOCH(tracer_, evacuator->GetBackgroundTracingScope(),
-                     ThreadKind::kBackground);
+      size_t evacuated_bytes = 0;
+      TRACE_GC_EPOCH_WITH_BYTES(tracer_, evacuator->GetBackgroundTracingScope(),
+                                ThreadKind::kBackground, evacuated_bytes);
+      intptr_t bytes_before = evacuator->bytes_compacted();
       ProcessItems(delegate, evacuator);
+      evacuated_bytes =
+          static_cast<size_t>(evacuator->bytes_compacted() - bytes_before);
     }
   }
 
@@ -5033,7 +5087,28 @@ void MinorMarkCompactCollector::ClearNonLiveReferences() {
   }
 }
 
+void MinorMarkCompactCollector::StartSweepingPromotedPages() {
+  if (promoted_pages_for_sweeping_.empty()) return;
+  TRACE_GC(heap()->tracer(), GCTracer::Scope::MINOR_MC_SWEEPING);
+  Sweeper* sweeper = heap()->mark_compact_collector()->sweeper();
+  // Sweeper tasks are (re-)started when the scope is left, which also covers
+  // the case where sweeping is only started below.
+  Sweeper::PauseOrCompleteScope pause_scope(sweeper);
+  for (Page* p : promoted_pages_for_sweeping_) {
+    sweeper->AddPage(OLD_SPACE, p, Sweeper::REGULAR);
+  }
+  promoted_pages_for_sweeping_.clear();
+  if (!sweeper->sweeping_in_progress()) {
+    sweeper->StartSweeping();
+  }
+}
+
 void MinorMarkCompactCollector::EvacuatePrologue() {
+  // The full collector's mark bits of young pages are only unused while no
+  // incremental marking cycle is in progress.
+  sweep_promoted_pages_ = FLAG_minor_mc_concurrent_sweeping &&
+                          !heap()->incremental_marking()->IsMarking();
+
   NewSpace* new_space = heap()->new_space();
   // Append the list of new space pages to be processed.
   for (Page* p :
@@ -5439,8 +5514,17 @@ void MinorMarkCompactCollector::Evacuate() {
   {
     TRACE_GC(heap()->tracer(), GCTracer::Scope::MINOR_MC_EVACUATE_CLEAN_UP);
     for (Page* p : new_space_evacuation_pages_) {
-      if (p->IsFlagSet(Page::PAGE_NEW_NEW_PROMOTION) ||
-          p->IsFlagSet(Page::PAGE_NEW_OLD_PROMOTION)) {
+      if (sweep_promoted_pages_ && p->IsFlagSet(Page::PAGE_NEW_OLD_PROMOTION)) {
+        // Live objects on this page were also marked black in the full
+        // collector's bitmap during evacuation, so the young generation mark
+        // bits can be discarded and the page swept like any other old space
+        // page.
+        p->ClearFlag(Page::PAGE_NEW_OLD_PROMOTION);
+        DCHECK_EQ(OLD_SPACE, p->owner_identity());
+        non_atomic_marking_state()->ClearLiveness(p);
+        promoted_pages_for_sweeping_.push_back(p);
+      } else if (p->IsFlagSet(Page::PAGE_NEW_NEW_PROMOTION) ||
+                 p->IsFlagSet(Page::PAGE_NEW_OLD_PROMOTION)) {
         p->ClearFlag(Page::PAGE_NEW_NEW_PROMOTION);
         p->ClearFlag(Page::PAGE_NEW_OLD_PROMOTION);
         p->SetFlag(Page::SWEEP_TO_ITERATE);
@@ -5450,6 +5534,8 @@ void MinorMarkCompactCollector::Evacuate() {
     new_space_evacuation_pages_.clear();
   }
 
+  StartSweepingPromotedPages();
+
   {
     TRACE_GC(heap()->tracer(), GCTracer::Scope::MINOR_MC_EVACUATE_EPILOGUE);
     EvacuateEpilogue();
@@ -5479,11 +5565,26 @@ class YoungGenerationEvacuator : public Evacuator {
  protected:
   void RawEvacuatePage(MemoryChunk* chunk, intptr_t* live_bytes) override;
 
+  // Transfers the young generation marking of a page promoted as a whole into
+  // the full collector's marking bitmap.
+  void MarkLiveObjectsForFullSweeper(MemoryChunk* chunk);
+
   YoungGenerationRecordMigratedSlotVisitor record_visitor_;
   EvacuationAllocator local_allocator_;
   MinorMarkCompactCollector* collector_;
 };
 
+void YoungGenerationEvacuator::MarkLiveObjectsForFullSweeper(
+    MemoryChunk* chunk) {
+  MajorNonAtomicMarkingState* full_marking_state =
+      heap()->mark_compact_collector()->non_atomic_marking_state();
+  DCHECK_EQ(0, full_marking_state->live_bytes(chunk));
+  for (auto object_and_size : LiveObjectRange<kGreyObjects>(
+           chunk, collector_->non_atomic_marking_state()->bitmap(chunk))) {
+    full_marking_state->WhiteToBlack(object_and_size.first);
+  }
+}
+
 void YoungGenerationEvacuator::RawEvacuatePage(MemoryChunk* chunk,
                                                intptr_t* live_bytes) {
   TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.gc"),
@@ -5504,6 +5605,9 @@ void YoungGenerationEvacuator::RawEvacuatePage(MemoryChunk* chunk,
       new_to_old_page_visitor_.account_moved_bytes(
           marking_state->live_bytes(chunk));
       if (!chunk->IsLargePage()) {
+        if (collector_->sweep_promoted_pages()) {
+          MarkLiveObjectsForFullSweeper(chunk);
+        }
         if (heap()->ShouldZapGarbage()) {
           collector_->MakeIterable(static_cast<Page*>(chunk),
                                    MarkingTreatmentMode::KEEP, ZAP_FREE_SPACE);
@@ -595,6 +595,10 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
                                    size_t* max_evacuated_bytes);
 
   void RecordObjectStats();
+  // Reports the share of live bytes that resides on old space pages which
+  // survived at least --long-lived-page-min-survivals full GCs. This is the
+  // amount of marking work a generational (sticky mark bits) mode could skip.
+  void TraceLongLivedPages();
 
   // Finishes GC, performs heap verification if enabled.
   void Finish();
@@ -836,6 +840,11 @@ class MinorMarkCompactCollector final : public MarkCompactCollectorBase {
                     FreeSpaceTreatmentMode free_space_mode);
   void CleanupSweepToIteratePages();
 
+  // Whether live objects on pages promoted from new to old space are also
+  // marked black in the full collector's marking bitmap, so that the pages can
+  // be swept concurrently right after the pause.
+  bool sweep_promoted_pages() const { return sweep_promoted_pages_; }
+
  private:
   using MarkingWorklist = Worklist<HeapObject, 64 /* segment size */>;
   class RootMarkingVisitor;
@@ -870,12 +879,18 @@ class MinorMarkCompactCollector final : public MarkCompactCollectorBase {
 
   void SweepArrayBufferExtensions();
 
+  // Hands pages that were promoted as a whole to old space over to the
+  // sweeper of the full collector.
+  void StartSweepingPromotedPages();
+
   MarkingWorklist* worklist_;
 
   YoungGenerationMarkingVisitor* main_marking_visitor_;
   base::Semaphore page_parallel_job_semaphore_;
   std::vector<Page*> new_space_evacuation_pages_;
   std::vector<Page*> sweep_to_iterate_pages_;
+  std::vector<Page*> promoted_pages_for_sweeping_;
+  bool sweep_promoted_pages_ = false;
 
   MarkingState marking_state_;
   NonAtomicMarkingState non_atomic_marking_state_;
@@ -5,6 +5,7 @@
 #ifndef V8_HEAP_MARKING_VISITOR_INL_H_
 #define V8_HEAP_MARKING_VISITOR_INL_H_
 
+#include "src/heap/bytecode-flushing-policy.h"
 #include "src/heap/marking-visitor.h"
 #include "src/heap/objects-visiting-inl.h"
 #include "src/heap/objects-visiting.h"
@@ -143,9 +144,13 @@ int MarkingVisitorBase<ConcreteVisitor, MarkingState>::VisitBytecodeArray(
   int size = BytecodeArray::BodyDescriptor::SizeOf(map, object);
   this->VisitMapPointer(object);
   BytecodeArray::BodyDescriptor::IterateBody(map, object, size, this);
-  if (!should_keep_ages_unchanged_) {
+  BytecodeFlushingPolicy* flushing_policy = heap_->bytecode_flushing_policy();
+  if (!should_keep_ages_unchanged_ && !flushing_policy->ShouldPauseAging()) {
     object.MakeOlder();
   }
+  if (V8_UNLIKELY(FLAG_bytecode_flush_budget > 0)) {
+    flushing_policy->RecordLiveBytecode(object.bytecode_age(), size);
+  }
   return size;
 }
 
@@ -10,6 +10,7 @@
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
 #include "src/flags/flags.h"
+#include "src/heap/code-range.h"
 #include "src/heap/gc-tracer.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/memory-chunk.h"
@@ -185,6 +186,11 @@ size_t MemoryAllocator::Unmapper::NumberOfCommittedChunks() {
   return chunks_[kRegular].size() + chunks_[kNonRegular].size();
 }
 
+size_t MemoryAllocator::Unmapper::NumberOfPooledChunks() {
+  base::MutexGuard guard(&mutex_);
+  return chunks_[kPooled].size();
+}
+
 int MemoryAllocator::Unmapper::NumberOfChunks() {
   base::MutexGuard guard(&mutex_);
   size_t result = 0;
@@ -323,10 +329,19 @@ V8_EXPORT_PRIVATE BasicMemoryChunk* MemoryAllocator::AllocateBasicChunk(
     size_t commit_size = ::RoundUp(
         MemoryChunkLayout::CodePageGuardStartOffset() + commit_area_size,
         GetCommitPageSize());
+    CodeRange* code_range = heap->code_range();
+    if (FLAG_pack_code_pages && code_range != nullptr) {
+      address_hint = reinterpret_cast<void*>(
+          code_range->GetPackedPageHint(chunk_size, MemoryChunk::kAlignment));
+    }
     base =
         AllocateAlignedMemory(chunk_size, commit_size, MemoryChunk::kAlignment,
                               executable, address_hint, &reservation);
     if (base == kNullAddress) return nullptr;
+    if (FLAG_pack_code_pages && code_range != nullptr) {
+      code_range->NotifyPackedPageAllocated(
+          reinterpret_cast<Address>(address_hint), base);
+    }
     // Update executable memory size.
     size_executable_ += reservation.size();
 
@@ -568,6 +583,9 @@ template EXPORT_TEMPLATE_DEFINE(V8_EXPORT_PRIVATE)
 template EXPORT_TEMPLATE_DEFINE(V8_EXPORT_PRIVATE)
     Page* MemoryAllocator::AllocatePage<MemoryAllocator::kPooled, SemiSpace>(
         size_t size, SemiSpace* owner, Executability executable);
+template EXPORT_TEMPLATE_DEFINE(V8_EXPORT_PRIVATE)
+    Page* MemoryAllocator::AllocatePage<MemoryAllocator::kPooled, PagedSpace>(
+        size_t size, PagedSpace* owner, Executability executable);
 
 ReadOnlyPage* MemoryAllocator::AllocateReadOnlyPage(size_t size,
                                                     ReadOnlySpace* owner) {
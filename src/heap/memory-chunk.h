@@ -204,6 +204,11 @@ class MemoryChunk : public BasicMemoryChunk {
     return &possibly_empty_buckets_;
   }
 
+  // Number of full GCs after which this page still contained live objects.
+  // Only updated by the sweeper, which owns the page while sweeping it.
+  uintptr_t full_gc_survivals() const { return full_gc_survivals_; }
+  void IncrementFullGCSurvivals() { full_gc_survivals_++; }
+
   // Release memory allocated by the chunk, except that which is needed by
   // read-only space chunks.
   void ReleaseAllocatedMemoryNeededForWritableChunk();
@@ -286,6 +291,8 @@ class MemoryChunk : public BasicMemoryChunk {
 
   PossiblyEmptyBuckets possibly_empty_buckets_;
 
+  uintptr_t full_gc_survivals_;
+
 #ifdef V8_ENABLE_CONSERVATIVE_STACK_SCANNING
   ObjectStartBitmap object_start_bitmap_;
 #endif
@@ -319,6 +319,11 @@ void PagedSpace::ShrinkImmortalImmovablePages() {
 }
 
 Page* PagedSpace::AllocatePage() {
+  if (executable() == NOT_EXECUTABLE && FLAG_max_pooled_paged_space_pages > 0) {
+    // Reuse pages released by any space before mapping new memory.
+    return heap()->memory_allocator()->AllocatePage<MemoryAllocator::kPooled>(
+        AreaSize(), this, executable());
+  }
   return heap()->memory_allocator()->AllocatePage(AreaSize(), this,
                                                   executable());
 }
@@ -427,6 +432,11 @@ size_t PagedSpace::Available() {
   return free_list_->Available();
 }
 
+size_t PagedSpace::LargestFreeBlock() {
+  ConcurrentAllocationMutex guard(this);
+  return free_list_->LargestFreeBlock();
+}
+
 namespace {
 
 UnprotectMemoryOrigin GetUnprotectMemoryOrigin(bool is_compaction_space) {
@@ -490,7 +500,18 @@ void PagedSpace::ReleasePage(Page* page) {
 
   AccountUncommitted(page->size());
   accounting_stats_.DecreaseCapacity(page->area_size());
-  heap()->memory_allocator()->Free<MemoryAllocator::kPreFreeAndQueue>(page);
+  MemoryAllocator* memory_allocator = heap()->memory_allocator();
+  if (page->executable() == NOT_EXECUTABLE &&
+      page->size() == static_cast<size_t>(MemoryChunk::kPageSize) &&
+      !heap()->ShouldReduceMemory() &&
+      memory_allocator->unmapper()->NumberOfPooledChunks() <
+          FLAG_max_pooled_paged_space_pages) {
+    // Keep the reservation and only uncommit the page such that a later
+    // expansion of any space does not need to map memory again.
+    memory_allocator->Free<MemoryAllocator::kPooledAndQueue>(page);
+  } else {
+    memory_allocator->Free<MemoryAllocator::kPreFreeAndQueue>(page);
+  }
 }
 
 void PagedSpace::SetReadable() {
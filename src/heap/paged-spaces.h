@@ -124,6 +124,10 @@ class V8_EXPORT_PRIVATE PagedSpace
   // immediately added to the free list so they show up here.
   size_t Available() override;
 
+  // Size of the largest block on the free list. Together with Available() it
+  // tells how fragmented the free memory of this space is.
+  size_t LargestFreeBlock();
+
   // Allocated bytes in this space.  Garbage bytes that were not found due to
   // concurrent sweeping are counted as being allocated!  The bytes in the
   // current linear allocation area (between top and limit) are also counted
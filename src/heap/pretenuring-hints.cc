@@ -0,0 +1,112 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/pretenuring-hints.h"
+
+#include <unordered_set>
+
+#include "src/base/functional.h"
+#include "src/base/lazy-instance.h"
+#include "src/base/platform/mutex.h"
+#include "src/execution/isolate.h"
+#include "src/heap/heap-inl.h"
+#include "src/objects/allocation-site-inl.h"
+#include "src/objects/feedback-vector-inl.h"
+#include "src/objects/name-inl.h"
+#include "src/objects/objects-inl.h"
+#include "src/objects/script-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+struct HintTable {
+  base::Mutex mutex;
+  std::unordered_set<uint64_t> keys;
+};
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(HintTable, GetHintTable)
+
+}  // namespace
+
+// static
+uint64_t PretenuringHints::ComputeKey(SharedFunctionInfo shared,
+                                      FeedbackSlot slot) {
+  if (!shared.script().IsScript()) return 0;
+  Object source = Script::cast(shared.script()).source();
+  if (!source.IsString()) return 0;
+  String source_string = String::cast(source);
+  const uint64_t key = base::hash_combine(
+      source_string.EnsureHash(), source_string.length(),
+      shared.StartPosition(), slot.ToInt());
+  // Reserve 0 for "no key".
+  return key == 0 ? 1 : key;
+}
+
+// static
+void PretenuringHints::RecordTenuredSites(Isolate* isolate) {
+  std::vector<uint64_t> keys;
+  {
+    HeapObjectIterator iterator(isolate->heap());
+    for (HeapObject obj = iterator.Next(); !obj.is_null();
+         obj = iterator.Next()) {
+      if (!obj.IsFeedbackVector()) continue;
+      FeedbackVector vector = FeedbackVector::cast(obj);
+      FeedbackMetadataIterator slots(vector.metadata());
+      while (slots.HasNext()) {
+        FeedbackSlot slot = slots.Next();
+        if (slots.kind() != FeedbackSlotKind::kLiteral) continue;
+        HeapObject site;
+        if (!vector.Get(slot)->GetHeapObjectIfStrong(&site) ||
+            !site.IsAllocationSite()) {
+          continue;
+        }
+        if (AllocationSite::cast(site).pretenure_decision() !=
+            AllocationSite::kTenure) {
+          continue;
+        }
+        const uint64_t key = ComputeKey(vector.shared_function_info(), slot);
+        if (key != 0) keys.push_back(key);
+      }
+    }
+  }
+  if (keys.empty()) return;
+  HintTable* table = GetHintTable();
+  base::MutexGuard guard(&table->mutex);
+  table->keys.insert(keys.begin(), keys.end());
+  if (FLAG_trace_pretenuring) {
+    PrintIsolate(isolate,
+                 "pretenuring hints: recorded %zu tenured sites (%zu total)\n",
+                 keys.size(), table->keys.size());
+  }
+}
+
+// static
+bool PretenuringHints::ShouldPretenure(FeedbackVector vector,
+                                       FeedbackSlot slot) {
+  HintTable* table = GetHintTable();
+  base::MutexGuard guard(&table->mutex);
+  if (table->keys.empty()) return false;
+  const uint64_t key = ComputeKey(vector.shared_function_info(), slot);
+  return key != 0 && table->keys.count(key) > 0;
+}
+
+// static
+size_t PretenuringHints::NumberOfHints() {
+  HintTable* table = GetHintTable();
+  base::MutexGuard guard(&table->mutex);
+  return table->keys.size();
+}
+
+// static
+void PretenuringHints::ClearForTesting() {
+  HintTable* table = GetHintTable();
+  base::MutexGuard guard(&table->mutex);
+  table->keys.clear();
+}
+
+}  // namespace internal
+}  // namespace v8
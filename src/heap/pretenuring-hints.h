@@ -0,0 +1,47 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_PRETENURING_HINTS_H_
+#define V8_HEAP_PRETENURING_HINTS_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "src/common/globals.h"
+#include "src/objects/feedback-vector.h"
+
+namespace v8 {
+namespace internal {
+
+class Isolate;
+class SharedFunctionInfo;
+
+// Process-wide record of literal allocation sites that were found to be
+// long-lived (--share-pretenuring-decisions). A site is identified by the
+// source of its script, the start position of its function and its literal
+// slot, which are the same for all isolates running the same code.
+// Isolates record their tenured sites when they are torn down and later
+// isolates pretenure matching sites when they create them.
+class V8_EXPORT_PRIVATE PretenuringHints final : public AllStatic {
+ public:
+  // Records all literal sites of |isolate| that are currently pretenured.
+  // Iterates the heap.
+  static void RecordTenuredSites(Isolate* isolate);
+
+  // Returns true if the literal site in |slot| of |vector| was pretenured by
+  // an earlier isolate.
+  static bool ShouldPretenure(FeedbackVector vector, FeedbackSlot slot);
+
+  static size_t NumberOfHints();
+  static void ClearForTesting();
+
+ private:
+  // Returns 0 if the function has no script source.
+  static uint64_t ComputeKey(SharedFunctionInfo shared, FeedbackSlot slot);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_PRETENURING_HINTS_H_
@@ -35,6 +35,13 @@ base::LazyMutex read_only_heap_creation_mutex_ = LAZY_MUTEX_INITIALIZER;
 base::LazyInstance<std::weak_ptr<ReadOnlyArtifacts>>::type
     read_only_artifacts_ = LAZY_INSTANCE_INITIALIZER;
 
+// Strong reference that keeps ReadOnlyArtifacts alive once no Isolates remain
+// when --retain-read-only-heap is set. It is intentionally never released: in
+// a pre-fork model the parent process deserializes the read-only heap once and
+// child processes share its pages copy-on-write without touching them.
+base::LazyInstance<std::shared_ptr<ReadOnlyArtifacts>>::type
+    retained_read_only_artifacts_ = LAZY_INSTANCE_INITIALIZER;
+
 std::shared_ptr<ReadOnlyArtifacts> InitializeSharedReadOnlyArtifacts() {
   std::shared_ptr<ReadOnlyArtifacts> artifacts;
   if (COMPRESS_POINTERS_IN_ISOLATE_CAGE_BOOL) {
@@ -79,6 +86,9 @@ void ReadOnlyHeap::SetUp(Isolate* isolate,
         ro_heap->DeseralizeIntoIsolate(isolate, read_only_snapshot_data,
                                        can_rehash);
         read_only_heap_created = true;
+        if (FLAG_retain_read_only_heap) {
+          *retained_read_only_artifacts_.Pointer() = artifacts;
+        }
       } else {
         // With pointer compression, there is one ReadOnlyHeap per Isolate.
         // Without PC, there is only one shared between all Isolates.
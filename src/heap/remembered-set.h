@@ -99,6 +99,20 @@ class RememberedSet : public AllStatic {
     RememberedSetOperations::Insert<access_mode>(slot_set, chunk, slot_addr);
   }
 
+  // Adds the slots in |mask| of the slot set cell starting at |cell_addr|,
+  // see SlotSet::InsertCell().
+  template <AccessMode access_mode>
+  static void InsertCell(MemoryChunk* chunk, Address cell_addr,
+                         uint32_t mask) {
+    DCHECK(chunk->Contains(cell_addr));
+    DCHECK_NE(0, mask);
+    SlotSet* slot_set = chunk->slot_set<type, access_mode>();
+    if (slot_set == nullptr) {
+      slot_set = chunk->AllocateSlotSet<type>();
+    }
+    slot_set->InsertCell<access_mode>(cell_addr - chunk->address(), mask);
+  }
+
   // Given a page and a slot in that page, this function returns true if
   // the remembered set contains the slot.
   static bool Contains(MemoryChunk* chunk, Address slot_addr) {
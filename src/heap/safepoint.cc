@@ -27,12 +27,27 @@ void IsolateSafepoint::EnterSafepointScope(StopMainThread stop_main_thread) {
   DCHECK_EQ(ThreadId::Current(), heap_->isolate()->thread_id());
   DCHECK_NULL(LocalHeap::Current());
 
-  if (++active_safepoint_scopes_ > 1) return;
+  if (active_safepoint_scopes_ > 0) {
+    active_safepoint_scopes_++;
+    return;
+  }
 
   TimedHistogramScope timer(
       heap_->isolate()->counters()->gc_time_to_safepoint());
   TRACE_GC(heap_->tracer(), GCTracer::Scope::TIME_TO_SAFEPOINT);
 
+  int running = InitiateSafepointScope(stop_main_thread);
+  WaitUntilRunningThreadsInSafepoint(running);
+}
+
+int IsolateSafepoint::InitiateSafepointScope(StopMainThread stop_main_thread) {
+  // Client isolates are stopped by the isolate that initiates a shared GC.
+  DCHECK_IMPLIES(heap_->isolate()->shared_isolate() == nullptr,
+                 ThreadId::Current() == heap_->isolate()->thread_id());
+
+  // A nested scope waits for nothing, the outer one stopped all threads.
+  if (++active_safepoint_scopes_ > 1) return 0;
+
   local_heaps_mutex_.Lock();
 
   barrier_.Arm();
@@ -58,12 +73,18 @@ void IsolateSafepoint::EnterSafepointScope(StopMainThread stop_main_thread) {
     CHECK(!old_state.IsSafepointRequested());
   }
 
+  return running;
+}
+
+void IsolateSafepoint::WaitUntilRunningThreadsInSafepoint(int running) {
   barrier_.WaitUntilRunningThreadsInSafepoint(running);
 }
 
 void IsolateSafepoint::LeaveSafepointScope(StopMainThread stop_main_thread) {
-  // Safepoints need to be initiated on the main thread.
-  DCHECK_EQ(ThreadId::Current(), heap_->isolate()->thread_id());
+  // Safepoints need to be initiated on the main thread, or for client isolates
+  // by the isolate that initiates a shared GC.
+  DCHECK_IMPLIES(heap_->isolate()->shared_isolate() == nullptr,
+                 ThreadId::Current() == heap_->isolate()->thread_id());
   DCHECK_NULL(LocalHeap::Current());
 
   DCHECK_GT(active_safepoint_scopes_, 0);
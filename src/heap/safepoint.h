@@ -79,6 +79,13 @@ class IsolateSafepoint final {
   void EnterSafepointScope(StopMainThread stop_main_thread);
   void LeaveSafepointScope(StopMainThread stop_main_thread);
 
+  // The two halves of EnterSafepointScope(). A shared GC first requests the
+  // safepoints of all client isolates and then waits for all of them, so that
+  // their threads stop concurrently. InitiateSafepointScope() returns the
+  // number of running threads to wait for.
+  int InitiateSafepointScope(StopMainThread stop_main_thread);
+  void WaitUntilRunningThreadsInSafepoint(int running);
+
   template <typename Callback>
   void AddLocalHeap(LocalHeap* local_heap, Callback callback) {
     // Safepoint holds this lock in order to stop threads from starting or
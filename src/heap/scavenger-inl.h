@@ -325,6 +325,88 @@ SlotCallbackResult Scavenger::EvacuateThinString(Map map, THeapObjectSlot slot,
                                ObjectFields::kMaybePointers);
 }
 
+template <typename THeapObjectSlot>
+SlotCallbackResult Scavenger::EvacuateSlicedString(Map map,
+                                                   THeapObjectSlot slot,
+                                                   SlicedString object,
+                                                   int object_size) {
+  static_assert(std::is_same<THeapObjectSlot, FullHeapObjectSlot>::value ||
+                    std::is_same<THeapObjectSlot, HeapObjectSlot>::value,
+                "Only FullHeapObjectSlot and HeapObjectSlot are expected here");
+  DCHECK_EQ(ObjectFields::kMaybePointers,
+            Map::ObjectFieldsFrom(map.visitor_id()));
+  if (!FLAG_scavenge_copy_small_slices || is_incremental_marking_ ||
+      is_logging_) {
+    return EvacuateObjectDefault(map, slot, object, object_size,
+                                 ObjectFields::kMaybePointers);
+  }
+
+  // The parent may have been evacuated by now, which leaves its characters in
+  // place but replaces its map by a forwarding address.
+  HeapObject parent = HeapObject::cast(
+      TaggedField<Object, SlicedString::kParentOffset>::load(object));
+  MapWord parent_map_word = parent.map_word(kAcquireLoad);
+  Map parent_map = parent_map_word.IsForwardingAddress()
+                       ? parent_map_word.ToForwardingAddress().map()
+                       : parent_map_word.ToMap();
+  StringShape parent_shape(parent_map);
+  int length = object.length();
+  // Only copy from sequential parents of the same encoding. The parent of a
+  // one-byte slice may have been externalized as a two-byte string.
+  if (!parent_shape.IsSequential() ||
+      parent_shape.encoding_tag() != StringShape(map).encoding_tag() ||
+      length > SlicedString::kMaxCopiedLength ||
+      String::unchecked_cast(parent).length() / length <
+          SlicedString::kMinParentToSliceRatio) {
+    return EvacuateObjectDefault(map, slot, object, object_size,
+                                 ObjectFields::kMaybePointers);
+  }
+
+  bool one_byte = parent_shape.encoding_tag() == kOneByteStringTag;
+  int size = one_byte ? SeqOneByteString::SizeFor(length)
+                      : SeqTwoByteString::SizeFor(length);
+  AllocationResult allocation =
+      allocator_.Allocate(NEW_SPACE, size, AllocationOrigin::kGC, kWordAligned);
+  HeapObject target;
+  if (!allocation.To(&target)) {
+    return EvacuateObjectDefault(map, slot, object, object_size,
+                                 ObjectFields::kMaybePointers);
+  }
+
+  ReadOnlyRoots roots(heap());
+  target.set_map_word(MapWord::FromMap(one_byte ? roots.one_byte_string_map()
+                                                : roots.string_map()),
+                      kRelaxedStore);
+  String copy = String::unchecked_cast(target);
+  copy.set_length(length);
+  copy.set_raw_hash_field(object.raw_hash_field());
+  int char_size = one_byte ? kOneByteSize : base::kUC16Size;
+  MemCopy(reinterpret_cast<void*>(target.address() + SeqString::kHeaderSize),
+          reinterpret_cast<const void*>(parent.address() +
+                                        SeqString::kHeaderSize +
+                                        object.offset() * char_size),
+          length * char_size);
+  if (one_byte) {
+    SeqOneByteString::unchecked_cast(target).clear_padding();
+  } else {
+    SeqTwoByteString::unchecked_cast(target).clear_padding();
+  }
+
+  // This release CAS is paired with the load acquire in ScavengeObject.
+  if (!object.release_compare_and_swap_map_word(
+          MapWord::FromMap(map), MapWord::FromForwardingAddress(target))) {
+    // Another task evacuated the slice.
+    allocator_.FreeLast(NEW_SPACE, target, size);
+    MapWord map_word = object.map_word(kAcquireLoad);
+    HeapObjectReference::Update(slot, map_word.ToForwardingAddress());
+    DCHECK(!Heap::InFromPage(*slot));
+    return Heap::InToPage(*slot) ? KEEP_SLOT : REMOVE_SLOT;
+  }
+  HeapObjectReference::Update(slot, target);
+  copied_size_ += size;
+  return KEEP_SLOT;
+}
+
 template <typename THeapObjectSlot>
 SlotCallbackResult Scavenger::EvacuateShortcutCandidate(Map map,
                                                         THeapObjectSlot slot,
@@ -399,6 +481,9 @@ SlotCallbackResult Scavenger::EvacuateObject(THeapObjectSlot slot, Map map,
       DCHECK(!(*slot)->IsWeak());
       return EvacuateThinString(map, slot, ThinString::unchecked_cast(source),
                                 size);
+    case kVisitSlicedString:
+      return EvacuateSlicedString(map, slot,
+                                  SlicedString::unchecked_cast(source), size);
     case kVisitShortcutCandidate:
       DCHECK(!(*slot)->IsWeak());
       // At the moment we don't allow weak pointers to cons strings.
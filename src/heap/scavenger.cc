@@ -198,10 +198,16 @@ void ScavengerCollector::JobTask::Run(JobDelegate* delegate) {
              GCTracer::Scope::SCAVENGER_SCAVENGE_PARALLEL);
     ProcessItems(delegate, scavenger);
   } else {
-    TRACE_GC_EPOCH(outer_->heap_->tracer(),
-                   GCTracer::Scope::SCAVENGER_BACKGROUND_SCAVENGE_PARALLEL,
-                   ThreadKind::kBackground);
+    size_t scavenged_bytes = 0;
+    TRACE_GC_EPOCH_WITH_BYTES(
+        outer_->heap_->tracer(),
+        GCTracer::Scope::SCAVENGER_BACKGROUND_SCAVENGE_PARALLEL,
+        ThreadKind::kBackground, scavenged_bytes);
+    size_t bytes_before =
+        scavenger->bytes_copied() + scavenger->bytes_promoted();
     ProcessItems(delegate, scavenger);
+    scavenged_bytes =
+        scavenger->bytes_copied() + scavenger->bytes_promoted() - bytes_before;
   }
 }
 
@@ -415,7 +421,7 @@ void ScavengerCollector::CollectGarbage() {
     }
   }
 
-  ProcessWeakReferences(&ephemeron_table_list);
+  ProcessWeakReferences(&ephemeron_table_list, num_scavenge_tasks);
 
   // Set age mark.
   heap_->new_space_->set_age_mark(heap_->new_space()->top());
@@ -666,31 +672,87 @@ void Scavenger::Process(JobDelegate* delegate) {
 }
 
 void ScavengerCollector::ProcessWeakReferences(
-    EphemeronTableList* ephemeron_table_list) {
+    EphemeronTableList* ephemeron_table_list, int num_tasks) {
+  TRACE_GC(heap_->tracer(), GCTracer::Scope::SCAVENGER_SCAVENGE_WEAK);
   ScavengeWeakObjectRetainer weak_object_retainer;
   heap_->ProcessYoungWeakReferences(&weak_object_retainer);
-  ClearYoungEphemerons(ephemeron_table_list);
+  ClearYoungEphemerons(ephemeron_table_list, num_tasks);
   ClearOldEphemerons();
 }
 
+ScavengerCollector::ClearYoungEphemeronsJobTask::ClearYoungEphemeronsJobTask(
+    ScavengerCollector* outer, EphemeronTableList* ephemeron_table_list,
+    int num_tasks)
+    : outer_(outer),
+      ephemeron_table_list_(ephemeron_table_list),
+      num_tasks_(num_tasks) {}
+
+void ScavengerCollector::ClearYoungEphemeronsJobTask::Run(
+    JobDelegate* delegate) {
+  DCHECK_LT(delegate->GetTaskId(), num_tasks_);
+  if (delegate->IsJoiningThread()) {
+    TRACE_GC(outer_->heap_->tracer(),
+             GCTracer::Scope::SCAVENGER_SCAVENGE_WEAK_EPHEMERONS);
+    ProcessItems(delegate->GetTaskId());
+  } else {
+    TRACE_GC_EPOCH(outer_->heap_->tracer(),
+                   GCTracer::Scope::SCAVENGER_BACKGROUND_SCAVENGE_WEAK_EPHEMERONS,
+                   ThreadKind::kBackground);
+    ProcessItems(delegate->GetTaskId());
+  }
+}
+
+size_t ScavengerCollector::ClearYoungEphemeronsJobTask::GetMaxConcurrency(
+    size_t worker_count) const {
+  // Each worker holds at most one private segment, so the remaining work is
+  // bounded by the global pool plus the segments already taken by workers.
+  return std::min<size_t>(
+      num_tasks_, worker_count + ephemeron_table_list_->GlobalPoolSize());
+}
+
+void ScavengerCollector::ClearYoungEphemeronsJobTask::ProcessItems(
+    int task_id) {
+  EphemeronHashTable table;
+  while (ephemeron_table_list_->Pop(task_id, &table)) {
+    ClearYoungEphemeronTable(outer_->heap_, table);
+  }
+}
+
+// static
+void ScavengerCollector::ClearYoungEphemeronTable(Heap* heap,
+                                                  EphemeronHashTable table) {
+  for (InternalIndex i : table.IterateEntries()) {
+    // Keys in EphemeronHashTables must be heap objects.
+    HeapObjectSlot key_slot(
+        table.RawFieldOfElementAt(EphemeronHashTable::EntryToIndex(i)));
+    HeapObject key = key_slot.ToHeapObject();
+    if (IsUnscavengedHeapObject(heap, key)) {
+      table.RemoveEntry(i);
+    } else {
+      HeapObject forwarded = ForwardingAddress(key);
+      key_slot.StoreHeapObject(forwarded);
+    }
+  }
+}
+
 // Clear ephemeron entries from EphemeronHashTables in new-space whenever the
 // entry has a dead new-space key.
 void ScavengerCollector::ClearYoungEphemerons(
-    EphemeronTableList* ephemeron_table_list) {
-  ephemeron_table_list->Iterate([this](EphemeronHashTable table) {
-    for (InternalIndex i : table.IterateEntries()) {
-      // Keys in EphemeronHashTables must be heap objects.
-      HeapObjectSlot key_slot(
-          table.RawFieldOfElementAt(EphemeronHashTable::EntryToIndex(i)));
-      HeapObject key = key_slot.ToHeapObject();
-      if (IsUnscavengedHeapObject(heap_, key)) {
-        table.RemoveEntry(i);
-      } else {
-        HeapObject forwarded = ForwardingAddress(key);
-        key_slot.StoreHeapObject(forwarded);
-      }
-    }
-  });
+    EphemeronTableList* ephemeron_table_list, int num_tasks) {
+  if (FLAG_parallel_scavenge_weak_processing && num_tasks > 1 &&
+      !ephemeron_table_list->IsGlobalPoolEmpty()) {
+    V8::GetCurrentPlatform()
+        ->PostJob(v8::TaskPriority::kUserBlocking,
+                  std::make_unique<ClearYoungEphemeronsJobTask>(
+                      this, ephemeron_table_list, num_tasks))
+        ->Join();
+  } else {
+    TRACE_GC(heap_->tracer(),
+             GCTracer::Scope::SCAVENGER_SCAVENGE_WEAK_EPHEMERONS);
+    ephemeron_table_list->Iterate([this](EphemeronHashTable table) {
+      ClearYoungEphemeronTable(heap_, table);
+    });
+  }
   ephemeron_table_list->Clear();
 }
 
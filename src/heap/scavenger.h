@@ -182,6 +182,11 @@ class Scavenger {
                                                ThinString object,
                                                int object_size);
 
+  template <typename THeapObjectSlot>
+  inline SlotCallbackResult EvacuateSlicedString(Map map, THeapObjectSlot slot,
+                                                 SlicedString object,
+                                                 int object_size);
+
   template <typename THeapObjectSlot>
   inline SlotCallbackResult EvacuateShortcutCandidate(Map map,
                                                       THeapObjectSlot slot,
@@ -300,13 +305,36 @@ class ScavengerCollector {
     Scavenger::PromotionList* promotion_list_;
   };
 
+  // Clears dead young keys from the ephemeron tables collected by all
+  // scavenger tasks. Tables are independent of each other, so segments of the
+  // list are distributed among the job's workers.
+  class ClearYoungEphemeronsJobTask : public v8::JobTask {
+   public:
+    ClearYoungEphemeronsJobTask(ScavengerCollector* outer,
+                                EphemeronTableList* ephemeron_table_list,
+                                int num_tasks);
+
+    void Run(JobDelegate* delegate) override;
+    size_t GetMaxConcurrency(size_t worker_count) const override;
+
+   private:
+    void ProcessItems(int task_id);
+
+    ScavengerCollector* outer_;
+    EphemeronTableList* ephemeron_table_list_;
+    const int num_tasks_;
+  };
+
   void MergeSurvivingNewLargeObjects(
       const SurvivingNewLargeObjectsMap& objects);
 
   int NumberOfScavengeTasks();
 
-  void ProcessWeakReferences(EphemeronTableList* ephemeron_table_list);
-  void ClearYoungEphemerons(EphemeronTableList* ephemeron_table_list);
+  void ProcessWeakReferences(EphemeronTableList* ephemeron_table_list,
+                             int num_tasks);
+  void ClearYoungEphemerons(EphemeronTableList* ephemeron_table_list,
+                            int num_tasks);
+  static void ClearYoungEphemeronTable(Heap* heap, EphemeronHashTable table);
   void ClearOldEphemerons();
   void HandleSurvivingNewLargeObjects();
 
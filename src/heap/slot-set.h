@@ -223,6 +223,28 @@ class SlotSet {
     }
   }
 
+  // Inserts several slots of one cell at once. The slot offset specifies the
+  // first slot of the cell, bit i of |mask| the slot i * kTaggedSize after it.
+  template <AccessMode access_mode>
+  void InsertCell(size_t slot_offset, uint32_t mask) {
+    size_t bucket_index;
+    int cell_index, bit_index;
+    SlotToIndices(slot_offset, &bucket_index, &cell_index, &bit_index);
+    DCHECK_EQ(0, bit_index);
+    Bucket* bucket = LoadBucket<access_mode>(bucket_index);
+    if (bucket == nullptr) {
+      bucket = new Bucket;
+      if (!SwapInNewBucket<access_mode>(bucket_index, bucket)) {
+        delete bucket;
+        bucket = LoadBucket<access_mode>(bucket_index);
+      }
+    }
+    DCHECK(bucket != nullptr);
+    if ((bucket->LoadCell<access_mode>(cell_index) & mask) != mask) {
+      bucket->SetCellBits<access_mode>(cell_index, mask);
+    }
+  }
+
   // The slot offset specifies a slot at address page_start_ + slot_offset.
   // Returns true if the set contains the slot.
   bool Contains(size_t slot_offset) {
@@ -0,0 +1,134 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/string-deduplication-job.h"
+
+#include <unordered_map>
+
+#include "src/execution/isolate.h"
+#include "src/execution/vm-state-inl.h"
+#include "src/heap/gc-tracer.h"
+#include "src/heap/heap-inl.h"
+#include "src/heap/incremental-marking.h"
+#include "src/heap/paged-spaces.h"
+#include "src/init/v8.h"
+#include "src/objects/string-inl.h"
+#include "src/objects/string-table.h"
+
+namespace v8 {
+namespace internal {
+
+class StringDeduplicationJob::Task : public CancelableTask {
+ public:
+  Task(Isolate* isolate, StringDeduplicationJob* job)
+      : CancelableTask(isolate), isolate_(isolate), job_(job) {}
+
+  // CancelableTask overrides.
+  void RunInternal() override;
+
+  Isolate* isolate() const { return isolate_; }
+
+ private:
+  Isolate* const isolate_;
+  StringDeduplicationJob* const job_;
+};
+
+namespace {
+
+// Sequential strings are internalized in place without allocating, and making
+// them thin frees their characters. Short strings do not pay for the lookup.
+bool IsDeduplicationCandidate(HeapObject object) {
+  InstanceType type = object.map().instance_type();
+  if (type != STRING_TYPE && type != ONE_BYTE_STRING_TYPE) return false;
+  return String::cast(object).length() >=
+         FLAG_string_deduplication_min_length;
+}
+
+}  // namespace
+
+void StringDeduplicationJob::ScheduleTaskIfNeeded(Heap* heap) {
+  // The shared string table copies strings on internalization, which would
+  // allocate while iterating the heap.
+  if (FLAG_string_deduplication && !FLAG_shared_string_table &&
+      !task_pending_ && !heap->IsTearingDown()) {
+    v8::Isolate* isolate = reinterpret_cast<v8::Isolate*>(heap->isolate());
+    auto taskrunner =
+        V8::GetCurrentPlatform()->GetForegroundTaskRunner(isolate);
+    taskrunner->PostTask(std::make_unique<Task>(heap->isolate(), this));
+    task_pending_ = true;
+  }
+}
+
+// static
+size_t StringDeduplicationJob::DeduplicateStrings(Heap* heap) {
+  DCHECK(!FLAG_shared_string_table);
+  Isolate* isolate = heap->isolate();
+  double start = heap->MonotonicallyIncreasingTimeInMs();
+  heap->MakeHeapIterable();
+
+  size_t strings = 0;
+  size_t freed_bytes = 0;
+  {
+    DisallowGarbageCollection no_gc;
+    // The first string seen with each content, by hash. Neither internalizing
+    // old-space strings in place nor making them thin allocates on the heap,
+    // so the strings can be kept unhandlified.
+    std::unordered_multimap<uint32_t, String> canonical_strings;
+    PagedSpaceObjectIterator it(heap, heap->old_space());
+    for (HeapObject object = it.Next(); !object.is_null();
+         object = it.Next()) {
+      if (!IsDeduplicationCandidate(object)) continue;
+      String string = String::cast(object);
+      uint32_t hash = string.EnsureHash();
+      auto range = canonical_strings.equal_range(hash);
+      auto entry = range.first;
+      while (entry != range.second && !entry->second.SlowEquals(string)) {
+        ++entry;
+      }
+      if (entry == range.second) {
+        canonical_strings.emplace(hash, string);
+        continue;
+      }
+
+      // Internalize the first string on its first duplicate only, to keep
+      // unique strings out of the string table.
+      if (!entry->second.IsInternalizedString()) {
+        HandleScope scope(isolate);
+        String canonical = entry->second;
+        int canonical_size = canonical.Size();
+        entry->second = *isolate->string_table()->LookupString(
+            isolate, handle(canonical, isolate));
+        // An equal string may have been internalized before.
+        if (canonical.IsThinString()) {
+          strings++;
+          freed_bytes += canonical_size - ThinString::kSize;
+        }
+      }
+      strings++;
+      freed_bytes += string.Size() - ThinString::kSize;
+      string.MakeThin(isolate, entry->second);
+    }
+  }
+
+  heap->tracer()->AddStringDeduplication(
+      heap->MonotonicallyIncreasingTimeInMs() - start, strings, freed_bytes);
+  return freed_bytes;
+}
+
+void StringDeduplicationJob::Task::RunInternal() {
+  VMState<GC> state(isolate());
+  TRACE_EVENT_CALL_STATS_SCOPED(isolate(), "v8", "V8.Task");
+
+  // Leave the heap alone while incremental marking runs; the next full GC
+  // schedules the task again.
+  Heap* heap = isolate()->heap();
+  if (heap->incremental_marking()->IsStopped()) {
+    StringDeduplicationJob::DeduplicateStrings(heap);
+  }
+
+  job_->set_task_pending(false);
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,42 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_STRING_DEDUPLICATION_JOB_H_
+#define V8_HEAP_STRING_DEDUPLICATION_JOB_H_
+
+#include "src/common/globals.h"
+#include "src/tasks/cancelable-task.h"
+
+namespace v8 {
+namespace internal {
+
+class Heap;
+
+// The string deduplication job uses a foreground task after full garbage
+// collections to make equal sequential strings in old space share their
+// characters. The first string of a set of duplicates is internalized in
+// place and the others become ThinStrings pointing to it; the space of their
+// characters is freed.
+class StringDeduplicationJob {
+ public:
+  StringDeduplicationJob() V8_NOEXCEPT = default;
+
+  void ScheduleTaskIfNeeded(Heap* heap);
+
+  // Deduplicates the strings in old space, reports the result to the
+  // GCTracer and returns the number of bytes freed.
+  V8_EXPORT_PRIVATE static size_t DeduplicateStrings(Heap* heap);
+
+ private:
+  class Task;
+
+  void set_task_pending(bool value) { task_pending_ = value; }
+
+  bool task_pending_ = false;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_STRING_DEDUPLICATION_JOB_H_
@@ -87,11 +87,13 @@ class Sweeper::SweeperJob final : public JobTask {
   void Run(JobDelegate* delegate) final {
     if (delegate->IsJoiningThread()) {
       TRACE_GC(tracer_, GCTracer::Scope::MC_SWEEP);
-      RunImpl(delegate);
+      RunImpl(delegate, nullptr);
     } else {
-      TRACE_GC_EPOCH(tracer_, GCTracer::Scope::MC_BACKGROUND_SWEEPING,
-                     ThreadKind::kBackground);
-      RunImpl(delegate);
+      size_t swept_bytes = 0;
+      TRACE_GC_EPOCH_WITH_BYTES(tracer_,
+                                GCTracer::Scope::MC_BACKGROUND_SWEEPING,
+                                ThreadKind::kBackground, swept_bytes);
+      RunImpl(delegate, &swept_bytes);
     }
   }
 
@@ -105,7 +107,7 @@ class Sweeper::SweeperJob final : public JobTask {
   }
 
  private:
-  void RunImpl(JobDelegate* delegate) {
+  void RunImpl(JobDelegate* delegate, size_t* swept_bytes) {
     const int offset = delegate->GetTaskId();
     for (int i = 0; i < kNumberOfSweepingSpaces; i++) {
       const AllocationSpace space_id = static_cast<AllocationSpace>(
@@ -114,7 +116,9 @@ class Sweeper::SweeperJob final : public JobTask {
       // Do not sweep code space concurrently.
       if (space_id == CODE_SPACE) continue;
       DCHECK(IsValidSweepingSpace(space_id));
-      if (!sweeper_->ConcurrentSweepSpace(space_id, delegate)) return;
+      if (!sweeper_->ConcurrentSweepSpace(space_id, delegate, swept_bytes)) {
+        return;
+      }
     }
   }
   Sweeper* const sweeper_;
@@ -157,27 +161,22 @@ void Sweeper::StartSweeping() {
   sweeping_in_progress_ = true;
   iterability_in_progress_ = true;
   should_reduce_memory_ = heap_->ShouldReduceMemory();
-  MajorNonAtomicMarkingState* marking_state =
-      heap_->mark_compact_collector()->non_atomic_marking_state();
-  ForAllSweepingSpaces([this, marking_state](AllocationSpace space) {
-    // Sorting is done in order to make compaction more efficient: by sweeping
-    // pages with the most free bytes first, we make it more likely that when
-    // evacuating a page, already swept pages will have enough free bytes to
-    // hold the objects to move (and therefore, we won't need to wait for more
-    // pages to be swept in order to move those objects).
-    // Since maps don't move, there is no need to sort the pages from MAP_SPACE
-    // before sweeping them.
-    if (space != MAP_SPACE) {
-      int space_index = GetSweepSpaceIndex(space);
-      std::sort(
-          sweeping_list_[space_index].begin(),
-          sweeping_list_[space_index].end(), [marking_state](Page* a, Page* b) {
-            return marking_state->live_bytes(a) > marking_state->live_bytes(b);
-          });
-    }
+  ForAllSweepingSpaces([this](AllocationSpace space) {
+    // Sweeping the pages with the most free bytes first makes it more likely
+    // that when evacuating a page, already swept pages will have enough free
+    // bytes to hold the objects to move, and that an allocation which sweeps
+    // a page on its own finds enough memory after sweeping a single one.
+    int space_index = GetSweepSpaceIndex(space);
+    std::sort(sweeping_list_[space_index].begin(),
+              sweeping_list_[space_index].end(),
+              [this](Page* a, Page* b) { return SweepsBefore(a, b); });
   });
 }
 
+bool Sweeper::SweepsBefore(Page* a, Page* b) const {
+  return marking_state_->live_bytes(a) > marking_state_->live_bytes(b);
+}
+
 void Sweeper::StartSweeperTasks() {
   DCHECK(!job_handle_ || !job_handle_->IsValid());
   if (FLAG_concurrent_sweeping && sweeping_in_progress_ &&
@@ -409,6 +408,9 @@ int Sweeper::RawSweep(
   }
 
   // Phase 3: Post process the page.
+  if (free_list_mode == REBUILD_FREE_LIST && live_bytes > 0) {
+    p->IncrementFullGCSurvivals();
+  }
   CleanupInvalidTypedSlotsOfFreeRanges(p, free_ranges_map);
   ClearMarkBitsAndHandleLivenessStatistics(p, live_bytes, free_list_mode);
 
@@ -427,7 +429,8 @@ size_t Sweeper::ConcurrentSweepingPageCount() {
 }
 
 bool Sweeper::ConcurrentSweepSpace(AllocationSpace identity,
-                                   JobDelegate* delegate) {
+                                   JobDelegate* delegate,
+                                   size_t* swept_bytes) {
   while (!delegate->ShouldYield()) {
     Page* page = GetSweepingPageSafe(identity);
     if (page == nullptr) return true;
@@ -435,6 +438,7 @@ bool Sweeper::ConcurrentSweepSpace(AllocationSpace identity,
     // are not swept concurrently to the application to ensure W^X.
     DCHECK(!page->typed_slot_set<OLD_TO_NEW>() &&
            !page->typed_slot_set<OLD_TO_OLD>());
+    if (swept_bytes) *swept_bytes += page->area_size();
     ParallelSweepPage(page, identity);
   }
   return false;
@@ -566,7 +570,17 @@ void Sweeper::AddPage(AllocationSpace space, Page* page,
   }
   DCHECK_EQ(Page::ConcurrentSweepingState::kPending,
             page->concurrent_sweeping_state());
-  sweeping_list_[GetSweepSpaceIndex(space)].push_back(page);
+  SweepingList& sweeping_list = sweeping_list_[GetSweepSpaceIndex(space)];
+  if (sweeping_in_progress_) {
+    // Keep the order established in StartSweeping().
+    sweeping_list.insert(
+        std::upper_bound(
+            sweeping_list.begin(), sweeping_list.end(), page,
+            [this](Page* a, Page* b) { return SweepsBefore(a, b); }),
+        page);
+  } else {
+    sweeping_list.push_back(page);
+  }
 }
 
 void Sweeper::PrepareToBeSweptPage(AllocationSpace space, Page* page) {
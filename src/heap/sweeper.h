@@ -179,8 +179,10 @@ class Sweeper {
   size_t ConcurrentSweepingPageCount();
 
   // Concurrently sweeps many page from the given space. Returns true if there
-  // are no more pages to sweep in the given space.
-  bool ConcurrentSweepSpace(AllocationSpace identity, JobDelegate* delegate);
+  // are no more pages to sweep in the given space. Adds the area of the swept
+  // pages to |swept_bytes| if it is set.
+  bool ConcurrentSweepSpace(AllocationSpace identity, JobDelegate* delegate,
+                            size_t* swept_bytes = nullptr);
 
   // Sweeps incrementally one page from the given space. Returns true if
   // there are no more pages to sweep in the given space.
@@ -191,6 +193,11 @@ class Sweeper {
 
   void PrepareToBeSweptPage(AllocationSpace space, Page* page);
 
+  // Pages are taken from the back of a sweeping list, which is kept sorted by
+  // descending live bytes so that the pages with the most free bytes are
+  // swept first.
+  bool SweepsBefore(Page* a, Page* b) const;
+
   void MakeIterable(Page* page);
 
   bool IsValidIterabilitySpace(AllocationSpace space) {
@@ -199,7 +199,8 @@ TNode<Object> BinaryOpAssembler::Generate_AddWithFeedback(
     // Check for sentinel that signals BigIntTooBig exception.
     GotoIf(TaggedIsSmi(var_result.value()), &bigint_too_big);
 
-    var_type_feedback = SmiConstant(BinaryOperationFeedback::kBigInt);
+    var_type_feedback = BigIntOperationFeedback(CAST(lhs), CAST(rhs),
+                                                CAST(var_result.value()));
     UpdateFeedback(var_type_feedback.value(), maybe_feedback_vector(), slot_id,
                    update_feedback_mode);
     Goto(&end);
@@ -396,9 +397,6 @@ TNode<Object> BinaryOpAssembler::Generate_BinaryOperationWithFeedback(
 
   BIND(&if_both_bigint);
   {
-    var_type_feedback = SmiConstant(BinaryOperationFeedback::kBigInt);
-    UpdateFeedback(var_type_feedback.value(), maybe_feedback_vector(), slot_id,
-                   update_feedback_mode);
     if (op == Operation::kSubtract) {
       Label bigint_too_big(this);
       var_result =
@@ -406,6 +404,10 @@ TNode<Object> BinaryOpAssembler::Generate_BinaryOperationWithFeedback(
 
       // Check for sentinel that signals BigIntTooBig exception.
       GotoIf(TaggedIsSmi(var_result.value()), &bigint_too_big);
+      var_type_feedback = BigIntOperationFeedback(CAST(lhs), CAST(rhs),
+                                                  CAST(var_result.value()));
+      UpdateFeedback(var_type_feedback.value(), maybe_feedback_vector(),
+                     slot_id, update_feedback_mode);
       Goto(&end);
 
       BIND(&bigint_too_big);
@@ -416,6 +418,9 @@ TNode<Object> BinaryOpAssembler::Generate_BinaryOperationWithFeedback(
         ThrowRangeError(context(), MessageTemplate::kBigIntTooBig);
       }
     } else {
+      var_type_feedback = SmiConstant(BinaryOperationFeedback::kBigInt);
+      UpdateFeedback(var_type_feedback.value(), maybe_feedback_vector(),
+                     slot_id, update_feedback_mode);
       var_result = CallRuntime(Runtime::kBigIntBinaryOp, context(), lhs, rhs,
                                SmiConstant(op));
       Goto(&end);
@@ -674,5 +679,45 @@ TNode<Object> BinaryOpAssembler::Generate_BitwiseBinaryOpWithOptionalFeedback(
   return result.value();
 }
 
+TNode<BoolT> BinaryOpAssembler::IsBigInt64(TNode<BigInt> bigint) {
+  if (!Is64()) return Int32FalseConstant();
+
+  TVARIABLE(BoolT, var_result, Int32TrueConstant());
+  Label done(this);
+  TNode<Word32T> bitfield = LoadBigIntBitfield(bigint);
+  TNode<Uint32T> length = DecodeWord32<BigIntBase::LengthBits>(bitfield);
+  GotoIf(Word32Equal(length, Int32Constant(0)), &done);
+  var_result = Int32FalseConstant();
+  GotoIfNot(Word32Equal(length, Int32Constant(1)), &done);
+  {
+    // The magnitude of a negative value may be one larger than the maximum.
+    TNode<Uint32T> sign = DecodeWord32<BigIntBase::SignBits>(bitfield);
+    TNode<UintPtrT> max_magnitude = UintPtrAdd(
+        UintPtrConstant(std::numeric_limits<intptr_t>::max()),
+        ChangeUint32ToWord(sign));
+    var_result =
+        UintPtrLessThanOrEqual(LoadBigIntDigit(bigint, 0), max_magnitude);
+    Goto(&done);
+  }
+
+  BIND(&done);
+  return var_result.value();
+}
+
+TNode<Smi> BinaryOpAssembler::BigIntOperationFeedback(TNode<BigInt> lhs,
+                                                      TNode<BigInt> rhs,
+                                                      TNode<BigInt> result) {
+  TVARIABLE(Smi, var_feedback, SmiConstant(BinaryOperationFeedback::kBigInt));
+  Label done(this);
+  GotoIfNot(IsBigInt64(lhs), &done);
+  GotoIfNot(IsBigInt64(rhs), &done);
+  GotoIfNot(IsBigInt64(result), &done);
+  var_feedback = SmiConstant(BinaryOperationFeedback::kBigInt64);
+  Goto(&done);
+
+  BIND(&done);
+  return var_feedback.value();
+}
+
 }  // namespace internal
 }  // namespace v8
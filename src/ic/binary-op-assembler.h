@@ -156,6 +156,16 @@ class BinaryOpAssembler : public CodeStubAssembler {
   TNode<Object> Generate_BitwiseBinaryOpWithOptionalFeedback(
       Operation bitwise_op, TNode<Object> left, TNode<Object> right,
       const LazyNode<Context>& context, TVariable<Smi>* feedback);
+
+  // Returns true if {bigint} fits into a signed 64-bit integer. Always false
+  // on 32-bit platforms, which do not speculate on 64-bit BigInts.
+  TNode<BoolT> IsBigInt64(TNode<BigInt> bigint);
+
+  // Returns kBigInt64 feedback if both inputs and the result of a BigInt
+  // operation fit into a signed 64-bit integer, and kBigInt feedback
+  // otherwise.
+  TNode<Smi> BigIntOperationFeedback(TNode<BigInt> lhs, TNode<BigInt> rhs,
+                                     TNode<BigInt> result);
 };
 
 }  // namespace internal
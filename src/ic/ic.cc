@@ -1716,6 +1716,12 @@ MaybeHandle<Object> StoreGlobalIC::Store(Handle<Name> name,
     } else if (state() == NO_FEEDBACK) {
       TraceIC("StoreGlobalIC", name);
     }
+    // Stores to a lexical slot only come through here before the store site
+    // has feedback, so every reassignment of a tracked let is seen.
+    if (FLAG_const_tracking_let) {
+      isolate()->native_context()->InvalidateConstTrackingLet(
+          lookup_result.context_index, lookup_result.slot_index);
+    }
     script_context->set(lookup_result.slot_index, *value);
     return value;
   }
@@ -2810,6 +2816,10 @@ RUNTIME_FUNCTION(Runtime_StoreGlobalIC_Slow) {
                        MessageTemplate::kAccessedUninitializedVariable, name));
     }
 
+    if (FLAG_const_tracking_let) {
+      isolate->native_context()->InvalidateConstTrackingLet(
+          lookup_result.context_index, lookup_result.slot_index);
+    }
     script_context->set(lookup_result.slot_index, *value);
     return *value;
   }
@@ -4,8 +4,11 @@
 
 #include "src/ic/stub-cache.h"
 
+#include <algorithm>
+
 #include "src/ast/ast.h"
 #include "src/base/bits.h"
+#include "src/flags/flags.h"
 #include "src/heap/heap-inl.h"  // For InYoungGeneration().
 #include "src/ic/ic-inl.h"
 #include "src/logging/counters.h"
@@ -14,15 +17,36 @@
 namespace v8 {
 namespace internal {
 
-StubCache::StubCache(Isolate* isolate) : isolate_(isolate) {
+StubCache::StubCache(Isolate* isolate)
+    : StubCache(isolate, FLAG_stub_cache_primary_table_bits,
+                FLAG_stub_cache_secondary_table_bits) {}
+
+StubCache::StubCache(Isolate* isolate, int primary_table_bits,
+                     int secondary_table_bits)
+    : isolate_(isolate) {
   // Ensure the nullptr (aka Smi::zero()) which StubCache::Get() returns
   // when the entry is not found is not considered as a handler.
   DCHECK(!IC::IsHandler(MaybeObject()));
+  primary_table_bits =
+      std::min(std::max(primary_table_bits, kMinTableBits), kMaxTableBits);
+  secondary_table_bits =
+      std::min(std::max(secondary_table_bits, kMinTableBits), kMaxTableBits);
+  primary_table_size_ = 1 << primary_table_bits;
+  secondary_table_size_ = 1 << secondary_table_bits;
+  primary_mask_ = (primary_table_size_ - 1) << kCacheIndexShift;
+  secondary_mask_ = (secondary_table_size_ - 1) << kCacheIndexShift;
+  primary_ = new Entry[primary_table_size_];
+  secondary_ = new Entry[secondary_table_size_];
+}
+
+StubCache::~StubCache() {
+  delete[] primary_;
+  delete[] secondary_;
 }
 
 void StubCache::Initialize() {
-  DCHECK(base::bits::IsPowerOfTwo(kPrimaryTableSize));
-  DCHECK(base::bits::IsPowerOfTwo(kSecondaryTableSize));
+  DCHECK(base::bits::IsPowerOfTwo(primary_table_size_));
+  DCHECK(base::bits::IsPowerOfTwo(secondary_table_size_));
   Clear();
 }
 
@@ -40,7 +64,7 @@ int StubCache::PrimaryOffset(Name name, Map map) {
       static_cast<uint32_t>(map.ptr() ^ (map.ptr() >> kMapKeyShift));
   // Base the offset on a simple combination of name and map.
   uint32_t key = map_low32bits + field;
-  return key & ((kPrimaryTableSize - 1) << kCacheIndexShift);
+  return key & primary_mask_;
 }
 
 // Hash algorithm for the secondary table.  This algorithm is replicated in
@@ -52,7 +76,7 @@ int StubCache::SecondaryOffset(Name name, Map old_map) {
   uint32_t map_low32bits = static_cast<uint32_t>(old_map.ptr());
   uint32_t key = (map_low32bits + name_low32bits);
   key = key + (key >> kSecondaryKeyShift);
-  return key & ((kSecondaryTableSize - 1) << kCacheIndexShift);
+  return key & secondary_mask_;
 }
 
 int StubCache::PrimaryOffsetForTesting(Name name, Map map) {
@@ -128,12 +152,12 @@ void StubCache::Clear() {
   MaybeObject empty =
       MaybeObject::FromObject(isolate_->builtins()->code(Builtin::kIllegal));
   Name empty_string = ReadOnlyRoots(isolate()).empty_string();
-  for (int i = 0; i < kPrimaryTableSize; i++) {
+  for (int i = 0; i < primary_table_size_; i++) {
     primary_[i].key = StrongTaggedValue(empty_string);
     primary_[i].map = StrongTaggedValue(Smi::zero());
     primary_[i].value = TaggedValue(empty);
   }
-  for (int j = 0; j < kSecondaryTableSize; j++) {
+  for (int j = 0; j < secondary_table_size_; j++) {
     secondary_[j].key = StrongTaggedValue(empty_string);
     secondary_[j].map = StrongTaggedValue(Smi::zero());
     secondary_[j].value = TaggedValue(empty);
@@ -66,6 +66,13 @@ class V8_EXPORT_PRIVATE StubCache {
         reinterpret_cast<Address>(&first_entry(table)->value));
   }
 
+  // The mask that turns a hash into a scaled offset into {table}; loaded by
+  // generated code since the table sizes are only known at runtime.
+  SCTableReference mask_reference(StubCache::Table table) {
+    return SCTableReference(reinterpret_cast<Address>(
+        table == kPrimary ? &primary_mask_ : &secondary_mask_));
+  }
+
   StubCache::Entry* first_entry(StubCache::Table table) {
     switch (table) {
       case StubCache::kPrimary:
@@ -76,6 +83,10 @@ class V8_EXPORT_PRIVATE StubCache {
     UNREACHABLE();
   }
 
+  int table_size(StubCache::Table table) const {
+    return table == kPrimary ? primary_table_size_ : secondary_table_size_;
+  }
+
   Isolate* isolate() { return isolate_; }
 
   // Setting kCacheIndexShift to Name::kHashShift is convenient because it
@@ -85,21 +96,28 @@ class V8_EXPORT_PRIVATE StubCache {
   // the STATIC_ASSERT below, in {entry(...)}).
   static const int kCacheIndexShift = Name::kHashShift;
 
+  // The default table sizes, see --stub-cache-primary-table-bits and
+  // --stub-cache-secondary-table-bits.
   static const int kPrimaryTableBits = 11;
   static const int kPrimaryTableSize = (1 << kPrimaryTableBits);
   static const int kSecondaryTableBits = 9;
   static const int kSecondaryTableSize = (1 << kSecondaryTableBits);
+  static const int kMinTableBits = 4;
+  static const int kMaxTableBits = 16;
 
   // Used to introduce more entropy from the higher bits of the Map address.
   // This should fill in the masked out kCacheIndexShift-bits.
   static const int kMapKeyShift = kPrimaryTableBits + kCacheIndexShift;
   static const int kSecondaryKeyShift = kSecondaryTableBits + kCacheIndexShift;
 
-  static int PrimaryOffsetForTesting(Name name, Map map);
-  static int SecondaryOffsetForTesting(Name name, Map map);
+  int PrimaryOffsetForTesting(Name name, Map map);
+  int SecondaryOffsetForTesting(Name name, Map map);
 
-  // The constructor is made public only for the purposes of testing.
+  // The constructors are made public only for the purposes of testing.
   explicit StubCache(Isolate* isolate);
+  StubCache(Isolate* isolate, int primary_table_bits,
+            int secondary_table_bits);
+  ~StubCache();
   StubCache(const StubCache&) = delete;
   StubCache& operator=(const StubCache&) = delete;
 
@@ -114,12 +132,12 @@ class V8_EXPORT_PRIVATE StubCache {
   // Hash algorithm for the primary table.  This algorithm is replicated in
   // assembler for every architecture.  Returns an index into the table that
   // is scaled by 1 << kCacheIndexShift.
-  static int PrimaryOffset(Name name, Map map);
+  int PrimaryOffset(Name name, Map map);
 
   // Hash algorithm for the secondary table.  This algorithm is replicated in
   // assembler for every architecture.  Returns an index into the table that
   // is scaled by 1 << kCacheIndexShift.
-  static int SecondaryOffset(Name name, Map map);
+  int SecondaryOffset(Name name, Map map);
 
   // Compute the entry for a given offset in exactly the same way as
   // we do in generated code.  We generate an hash code that already
@@ -136,8 +154,12 @@ class V8_EXPORT_PRIVATE StubCache {
   }
 
  private:
-  Entry primary_[kPrimaryTableSize];
-  Entry secondary_[kSecondaryTableSize];
+  Entry* primary_;
+  Entry* secondary_;
+  int primary_table_size_;
+  int secondary_table_size_;
+  uint32_t primary_mask_;
+  uint32_t secondary_mask_;
   Isolate* isolate_;
 
   friend class Isolate;
@@ -587,6 +587,7 @@
   F(SCAVENGER_SCAVENGE_STACK_ROOTS)                  \
   F(SCAVENGER_SCAVENGE_UPDATE_REFS)                  \
   F(SCAVENGER_SCAVENGE_WEAK)                         \
+  F(SCAVENGER_SCAVENGE_WEAK_EPHEMERONS)              \
   F(SCAVENGER_SCAVENGE_FINALIZE)                     \
   F(SCAVENGER_SWEEP_ARRAY_BUFFERS)                   \
   F(TIME_TO_SAFEPOINT)                               \
@@ -595,6 +596,7 @@
 #define TRACER_BACKGROUND_SCOPES(F)               \
   F(BACKGROUND_YOUNG_ARRAY_BUFFER_SWEEP)          \
   F(BACKGROUND_FULL_ARRAY_BUFFER_SWEEP)           \
+  F(BACKGROUND_ARRAY_BUFFER_RELEASE)              \
   F(BACKGROUND_COLLECTION)                        \
   F(BACKGROUND_UNMAPPER)                          \
   F(BACKGROUND_UNPARK)                            \
@@ -606,14 +608,16 @@
   F(MINOR_MC_BACKGROUND_EVACUATE_COPY)            \
   F(MINOR_MC_BACKGROUND_EVACUATE_UPDATE_POINTERS) \
   F(MINOR_MC_BACKGROUND_MARKING)                  \
-  F(SCAVENGER_BACKGROUND_SCAVENGE_PARALLEL)
+  F(SCAVENGER_BACKGROUND_SCAVENGE_PARALLEL)       \
+  F(SCAVENGER_BACKGROUND_SCAVENGE_WEAK_EPHEMERONS)
 
-#define TRACER_YOUNG_EPOCH_SCOPES(F)        \
-  F(BACKGROUND_YOUNG_ARRAY_BUFFER_SWEEP)    \
-  F(MINOR_MARK_COMPACTOR)                   \
-  F(MINOR_MC_COMPLETE_SWEEP_ARRAY_BUFFERS)  \
-  F(SCAVENGER)                              \
-  F(SCAVENGER_BACKGROUND_SCAVENGE_PARALLEL) \
+#define TRACER_YOUNG_EPOCH_SCOPES(F)               \
+  F(BACKGROUND_YOUNG_ARRAY_BUFFER_SWEEP)           \
+  F(MINOR_MARK_COMPACTOR)                          \
+  F(MINOR_MC_COMPLETE_SWEEP_ARRAY_BUFFERS)         \
+  F(SCAVENGER)                                     \
+  F(SCAVENGER_BACKGROUND_SCAVENGE_PARALLEL)        \
+  F(SCAVENGER_BACKGROUND_SCAVENGE_WEAK_EPHEMERONS) \
   F(SCAVENGER_COMPLETE_SWEEP_ARRAY_BUFFERS)
 
 #endif  // V8_INIT_HEAP_SYMBOLS_H_
@@ -0,0 +1,121 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/init/isolate-pool.h"
+
+#include <memory>
+
+#include "include/v8-platform.h"
+#include "src/init/v8.h"
+
+namespace v8 {
+namespace internal {
+
+class IsolatePool::CreateTask final : public v8::Task {
+ public:
+  explicit CreateTask(IsolatePool* pool) : pool_(pool) {}
+
+  void Run() final {
+    {
+      base::MutexGuard guard(&pool_->mutex_);
+      if (pool_->stopping_) {
+        FinishLocked();
+        return;
+      }
+    }
+    v8::Isolate* isolate = v8::Isolate::New(pool_->params_);
+    base::MutexGuard guard(&pool_->mutex_);
+    if (pool_->stopping_) {
+      // The destructor waits for this task, so the isolate can still be
+      // disposed of here.
+      isolate->Dispose();
+    } else {
+      pool_->ready_.push_back(isolate);
+    }
+    FinishLocked();
+  }
+
+ private:
+  // The pool may be destroyed as soon as mutex_ is released after this.
+  void FinishLocked() {
+    pool_->creating_--;
+    pool_->tasks_done_.NotifyAll();
+  }
+
+  IsolatePool* const pool_;
+};
+
+class IsolatePool::DisposeTask final : public v8::Task {
+ public:
+  DisposeTask(IsolatePool* pool, v8::Isolate* isolate)
+      : pool_(pool), isolate_(isolate) {}
+
+  void Run() final {
+    isolate_->Dispose();
+    base::MutexGuard guard(&pool_->mutex_);
+    pool_->disposing_--;
+    pool_->tasks_done_.NotifyAll();
+  }
+
+ private:
+  IsolatePool* const pool_;
+  v8::Isolate* const isolate_;
+};
+
+IsolatePool::IsolatePool(const v8::Isolate::CreateParams& params, size_t size)
+    : params_(params), size_(size) {
+  base::MutexGuard guard(&mutex_);
+  RefillLocked();
+}
+
+IsolatePool::~IsolatePool() {
+  std::vector<v8::Isolate*> ready;
+  {
+    base::MutexGuard guard(&mutex_);
+    stopping_ = true;
+    while (creating_ > 0 || disposing_ > 0) tasks_done_.Wait(&mutex_);
+    ready.swap(ready_);
+  }
+  for (v8::Isolate* isolate : ready) isolate->Dispose();
+}
+
+v8::Isolate* IsolatePool::Acquire() {
+  {
+    base::MutexGuard guard(&mutex_);
+    DCHECK(!stopping_);
+    if (!ready_.empty()) {
+      v8::Isolate* isolate = ready_.back();
+      ready_.pop_back();
+      RefillLocked();
+      return isolate;
+    }
+    RefillLocked();
+  }
+  return v8::Isolate::New(params_);
+}
+
+void IsolatePool::Release(v8::Isolate* isolate) {
+  base::MutexGuard guard(&mutex_);
+  DCHECK(!stopping_);
+  disposing_++;
+  V8::GetCurrentPlatform()->CallOnWorkerThread(
+      std::make_unique<DisposeTask>(this, isolate));
+}
+
+size_t IsolatePool::ReadyCount() const {
+  base::MutexGuard guard(&mutex_);
+  return ready_.size();
+}
+
+void IsolatePool::RefillLocked() {
+  mutex_.AssertHeld();
+  while (ready_.size() + creating_ < size_) {
+    creating_++;
+    V8::GetCurrentPlatform()->CallOnWorkerThread(
+        std::make_unique<CreateTask>(this));
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,53 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_INIT_ISOLATE_POOL_H_
+#define V8_INIT_ISOLATE_POOL_H_
+
+#include <vector>
+
+#include "include/v8-isolate.h"
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
+
+namespace v8 {
+namespace internal {
+
+// Implements v8::IsolatePool. Isolates are created and disposed of by tasks
+// on the platform's worker threads, which the destructor waits for.
+class IsolatePool final {
+ public:
+  IsolatePool(const v8::Isolate::CreateParams& params, size_t size);
+  ~IsolatePool();
+
+  IsolatePool(const IsolatePool&) = delete;
+  IsolatePool& operator=(const IsolatePool&) = delete;
+
+  v8::Isolate* Acquire();
+  void Release(v8::Isolate* isolate);
+  size_t ReadyCount() const;
+
+ private:
+  class CreateTask;
+  class DisposeTask;
+
+  // Posts a CreateTask for every isolate that is neither ready nor being
+  // created. Requires mutex_.
+  void RefillLocked();
+
+  const v8::Isolate::CreateParams params_;
+  const size_t size_;
+
+  mutable base::Mutex mutex_;
+  base::ConditionVariable tasks_done_;
+  std::vector<v8::Isolate*> ready_;
+  size_t creating_ = 0;
+  size_t disposing_ = 0;
+  bool stopping_ = false;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_INIT_ISOLATE_POOL_H_
@@ -4,6 +4,7 @@
 
 #include "src/inspector/v8-profiler-agent-impl.h"
 
+#include <algorithm>
 #include <vector>
 
 #include "include/v8-profiler.h"
@@ -143,6 +144,68 @@ std::unique_ptr<protocol::Profiler::Profile> createCPUProfile(
       .build();
 }
 
+// Sends the nodes and then the samples of |v8profile| in chunks of at most
+// these sizes. Each chunk is flushed right away, so that neither a protocol
+// object nor a message ever holds the whole profile.
+constexpr size_t kMaxNodesPerChunk = 1000;
+constexpr int kMaxSamplesPerChunk = 10000;
+
+void streamCPUProfile(V8InspectorImpl* inspector, v8::CpuProfile* v8profile,
+                      protocol::Profiler::Frontend* frontend) {
+  auto nodes =
+      std::make_unique<protocol::Array<protocol::Profiler::ProfileNode>>();
+  // Visits the nodes in the same pre-order as flattenNodesTree().
+  std::vector<const v8::CpuProfileNode*> worklist = {
+      v8profile->GetTopDownRoot()};
+  while (!worklist.empty()) {
+    const v8::CpuProfileNode* node = worklist.back();
+    worklist.pop_back();
+    nodes->emplace_back(buildInspectorObjectFor(inspector, node));
+    for (int i = node->GetChildrenCount(); i > 0; i--) {
+      worklist.push_back(node->GetChild(i - 1));
+    }
+    if (nodes->size() == kMaxNodesPerChunk || worklist.empty()) {
+      frontend->profileChunk(std::move(nodes),
+                             std::make_unique<protocol::Array<int>>(),
+                             std::make_unique<protocol::Array<int>>());
+      frontend->flush();
+      nodes =
+          std::make_unique<protocol::Array<protocol::Profiler::ProfileNode>>();
+    }
+  }
+
+  int count = v8profile->GetSamplesCount();
+  uint64_t lastTime = v8profile->GetStartTime();
+  for (int start = 0; start < count; start += kMaxSamplesPerChunk) {
+    int end = std::min(count, start + kMaxSamplesPerChunk);
+    auto samples = std::make_unique<protocol::Array<int>>();
+    auto timeDeltas = std::make_unique<protocol::Array<int>>();
+    samples->reserve(end - start);
+    timeDeltas->reserve(end - start);
+    for (int i = start; i < end; i++) {
+      samples->emplace_back(v8profile->GetSample(i)->GetNodeId());
+      uint64_t ts = v8profile->GetSampleTimestamp(i);
+      timeDeltas->emplace_back(static_cast<int>(ts - lastTime));
+      lastTime = ts;
+    }
+    frontend->profileChunk(
+        std::make_unique<protocol::Array<protocol::Profiler::ProfileNode>>(),
+        std::move(samples), std::move(timeDeltas));
+    frontend->flush();
+  }
+}
+
+// The profile whose nodes and samples were sent by streamCPUProfile().
+std::unique_ptr<protocol::Profiler::Profile> createStreamedCPUProfile(
+    v8::CpuProfile* v8profile) {
+  return protocol::Profiler::Profile::create()
+      .setNodes(
+          std::make_unique<protocol::Array<protocol::Profiler::ProfileNode>>())
+      .setStartTime(static_cast<double>(v8profile->GetStartTime()))
+      .setEndTime(static_cast<double>(v8profile->GetEndTime()))
+      .build();
+}
+
 std::unique_ptr<protocol::Debugger::Location> currentDebugLocation(
     V8InspectorImpl* inspector) {
   std::unique_ptr<V8StackTraceImpl> callStack =
@@ -211,7 +274,7 @@ void V8ProfilerAgentImpl::consoleProfileEnd(const String16& title) {
     if (id.isEmpty()) return;
   }
   std::unique_ptr<protocol::Profiler::Profile> profile =
-      stopProfiling(id, true);
+      stopProfiling(id, true, false);
   if (!profile) return;
   std::unique_ptr<protocol::Debugger::Location> location =
       currentDebugLocation(m_session->inspector());
@@ -231,9 +294,9 @@ Response V8ProfilerAgentImpl::enable() {
 Response V8ProfilerAgentImpl::disable() {
   if (m_enabled) {
     for (size_t i = m_startedProfiles.size(); i > 0; --i)
-      stopProfiling(m_startedProfiles[i - 1].m_id, false);
+      stopProfiling(m_startedProfiles[i - 1].m_id, false, false);
     m_startedProfiles.clear();
-    stop(nullptr);
+    stop(Maybe<bool>(), nullptr);
     stopPreciseCoverage();
     DCHECK(!m_profiler);
     m_enabled = false;
@@ -287,13 +350,15 @@ Response V8ProfilerAgentImpl::start() {
 }
 
 Response V8ProfilerAgentImpl::stop(
+    Maybe<bool> streamChunks,
     std::unique_ptr<protocol::Profiler::Profile>* profile) {
   if (!m_recordingCPUProfile) {
     return Response::ServerError("No recording profiles found");
   }
   m_recordingCPUProfile = false;
   std::unique_ptr<protocol::Profiler::Profile> cpuProfile =
-      stopProfiling(m_frontendInitiatedProfileId, !!profile);
+      stopProfiling(m_frontendInitiatedProfileId, !!profile,
+                    streamChunks.fromMaybe(false));
   if (profile) {
     *profile = std::move(cpuProfile);
     if (!profile->get()) return Response::ServerError("Profile is not found");
@@ -548,13 +613,18 @@ void V8ProfilerAgentImpl::startProfiling(const String16& title) {
 }
 
 std::unique_ptr<protocol::Profiler::Profile> V8ProfilerAgentImpl::stopProfiling(
-    const String16& title, bool serialize) {
+    const String16& title, bool serialize, bool stream) {
   v8::HandleScope handleScope(m_isolate);
   v8::CpuProfile* profile =
       m_profiler->StopProfiling(toV8String(m_isolate, title));
   std::unique_ptr<protocol::Profiler::Profile> result;
   if (profile) {
-    if (serialize) result = createCPUProfile(m_session->inspector(), profile);
+    if (serialize && stream) {
+      streamCPUProfile(m_session->inspector(), profile, &m_frontend);
+      result = createStreamedCPUProfile(profile);
+    } else if (serialize) {
+      result = createCPUProfile(m_session->inspector(), profile);
+    }
     profile->Delete();
   }
   --m_startedProfilesCount;
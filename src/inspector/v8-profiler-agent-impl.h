@@ -39,7 +39,8 @@ class V8ProfilerAgentImpl : public protocol::Profiler::Backend {
   Response disable() override;
   Response setSamplingInterval(int) override;
   Response start() override;
-  Response stop(std::unique_ptr<protocol::Profiler::Profile>*) override;
+  Response stop(Maybe<bool> streamChunks,
+                std::unique_ptr<protocol::Profiler::Profile>*) override;
 
   Response startPreciseCoverage(Maybe<bool> binary, Maybe<bool> detailed,
                                 Maybe<bool> allow_triggered_updates,
@@ -68,8 +69,10 @@ class V8ProfilerAgentImpl : public protocol::Profiler::Backend {
   String16 nextProfileId();
 
   void startProfiling(const String16& title);
+  // If |stream| is set, the nodes and samples are sent as profileChunk events
+  // and left out of the returned profile.
   std::unique_ptr<protocol::Profiler::Profile> stopProfiling(
-      const String16& title, bool serialize);
+      const String16& title, bool serialize, bool stream);
 
   V8InspectorSessionImpl* m_session;
   v8::Isolate* m_isolate;
@@ -1009,6 +1009,18 @@ BytecodeArrayBuilder& BytecodeArrayBuilder::CreateArguments(
   return *this;
 }
 
+BytecodeArrayBuilder& BytecodeArrayBuilder::LoadArgumentsLength(
+    CreateArgumentsType type) {
+  OutputLdaArgumentsLength(static_cast<uint8_t>(type));
+  return *this;
+}
+
+BytecodeArrayBuilder& BytecodeArrayBuilder::LoadKeyedArgument(
+    CreateArgumentsType type, int feedback_slot) {
+  OutputLdaKeyedArgument(static_cast<uint8_t>(type), feedback_slot);
+  return *this;
+}
+
 BytecodeArrayBuilder& BytecodeArrayBuilder::CreateRegExpLiteral(
     const AstRawString* pattern, int literal_index, int flags) {
   size_t pattern_entry = GetConstantPoolEntry(pattern);
@@ -252,6 +252,15 @@ class V8_EXPORT_PRIVATE BytecodeArrayBuilder final {
   // Create a new arguments object in the accumulator.
   BytecodeArrayBuilder& CreateArguments(CreateArgumentsType type);
 
+  // Load the length of the arguments object or rest parameter of the given
+  // |type| without allocating it.
+  BytecodeArrayBuilder& LoadArgumentsLength(CreateArgumentsType type);
+
+  // Keyed load from the arguments object or rest parameter of the given
+  // |type| without allocating it. The key should be in the accumulator.
+  BytecodeArrayBuilder& LoadKeyedArgument(CreateArgumentsType type,
+                                          int feedback_slot);
+
   // Literals creation.  Constant elements should be in the accumulator.
   BytecodeArrayBuilder& CreateRegExpLiteral(const AstRawString* pattern,
                                             int literal_index, int flags);
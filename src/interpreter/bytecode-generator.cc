@@ -11,6 +11,7 @@
 #include "include/v8-extension.h"
 #include "src/api/api-inl.h"
 #include "src/ast/ast-source-ranges.h"
+#include "src/ast/ast-traversal-visitor.h"
 #include "src/ast/ast.h"
 #include "src/ast/scopes.h"
 #include "src/builtins/builtins-constructor.h"
@@ -1070,6 +1071,143 @@ class V8_NODISCARD BytecodeGenerator::LoopScope final {
   LoopBuilder* const loop_builder_;
 };
 
+// Finds out whether an arguments object or rest parameter is only loaded from,
+// with `arguments.length` and `arguments[key]` in value position, such that
+// the interpreter can read its length and elements from the frame instead of
+// allocating it. Any other reference to the object makes it escape.
+class BytecodeGenerator::ElidedArgumentsFinder final
+    : public AstTraversalVisitor<ElidedArgumentsFinder> {
+ public:
+  ElidedArgumentsFinder(uintptr_t stack_limit,
+                        const AstRawString* length_string)
+      : AstTraversalVisitor(stack_limit), length_string_(length_string) {}
+
+  // Returns whether the |arguments| variable is only loaded from.
+  bool FindArgumentsLoads(FunctionLiteral* literal, Variable* arguments) {
+    variable_ = arguments;
+    VisitStatements(literal->body());
+    return !escapes_ && !HasStackOverflow();
+  }
+
+  // Returns the variable that the |rest| parameter is bound to by the
+  // parameter initialization, if it is only loaded from.
+  Variable* FindRestParameterLoads(FunctionLiteral* literal, Variable* rest) {
+    rest_parameter_ = rest;
+    VisitStatements(literal->body());
+    if (escapes_ || HasStackOverflow()) return nullptr;
+    // The parameter initializers to its left see the variable uninitialized.
+    for (Variable* var : early_references_) {
+      if (var == variable_) return nullptr;
+    }
+    return variable_;
+  }
+
+  bool has_keyed_loads() const { return has_keyed_loads_; }
+  Assignment* rest_initialization() const { return rest_initialization_; }
+
+  // Inner functions can only reference the variable if it is context
+  // allocated.
+  void VisitFunctionLiteral(FunctionLiteral* expr) {}
+
+  void VisitVariableProxy(VariableProxy* proxy) {
+    Variable* var = proxy->var();
+    if (var == variable_ || var == rest_parameter_) escapes_ = true;
+    if (rest_parameter_ != nullptr && rest_initialization_ == nullptr &&
+        var->is_parameter()) {
+      early_references_.push_back(var);
+    }
+  }
+
+  void VisitProperty(Property* expr) {
+    VariableProxy* proxy = expr->obj()->AsVariableProxy();
+    if (target_depth_ > 0 || proxy == nullptr || variable_ == nullptr ||
+        proxy->var() != variable_ || expr->is_optional_chain_link()) {
+      AstTraversalVisitor::VisitProperty(expr);
+      return;
+    }
+    switch (Property::GetAssignType(expr)) {
+      case NAMED_PROPERTY:
+        if (expr->key()->AsLiteral()->AsRawPropertyName() != length_string_) {
+          escapes_ = true;
+        }
+        break;
+      case KEYED_PROPERTY:
+        has_keyed_loads_ = true;
+        Visit(expr->key());
+        break;
+      default:
+        escapes_ = true;
+        break;
+    }
+  }
+
+  void VisitAssignment(Assignment* expr) {
+    VariableProxy* target = expr->target()->AsVariableProxy();
+    VariableProxy* value = expr->value()->AsVariableProxy();
+    if (rest_parameter_ != nullptr && rest_initialization_ == nullptr &&
+        expr->op() == Token::INIT && target != nullptr && value != nullptr &&
+        value->var() == rest_parameter_ && target->var()->is_parameter() &&
+        target->var()->IsStackLocal()) {
+      variable_ = target->var();
+      rest_initialization_ = expr;
+      return;
+    }
+    VisitTarget(expr->target());
+    Visit(expr->value());
+  }
+
+  void VisitCompoundAssignment(CompoundAssignment* expr) {
+    VisitAssignment(expr);
+  }
+
+  void VisitCountOperation(CountOperation* expr) {
+    VisitTarget(expr->expression());
+  }
+
+  void VisitUnaryOperation(UnaryOperation* expr) {
+    if (expr->op() == Token::DELETE) {
+      VisitTarget(expr->expression());
+    } else {
+      AstTraversalVisitor::VisitUnaryOperation(expr);
+    }
+  }
+
+  void VisitCall(Call* expr) {
+    // The callee's object is the receiver of the call.
+    VisitTarget(expr->expression());
+    for (Expression* arg : *expr->arguments()) Visit(arg);
+  }
+
+  void VisitForInStatement(ForInStatement* stmt) {
+    VisitTarget(stmt->each());
+    Visit(stmt->subject());
+    Visit(stmt->body());
+  }
+
+  void VisitForOfStatement(ForOfStatement* stmt) {
+    VisitTarget(stmt->each());
+    Visit(stmt->subject());
+    Visit(stmt->body());
+  }
+
+ private:
+  // Loads in |expr| are conservatively considered to escape.
+  void VisitTarget(Expression* expr) {
+    target_depth_++;
+    Visit(expr);
+    target_depth_--;
+  }
+
+  const AstRawString* const length_string_;
+  Variable* variable_ = nullptr;
+  Variable* rest_parameter_ = nullptr;
+  Assignment* rest_initialization_ = nullptr;
+  std::vector<Variable*> early_references_;
+  int target_depth_ = 0;
+  bool has_keyed_loads_ = false;
+  bool escapes_ = false;
+};
+
 namespace {
 
 template <typename PropertyT>
@@ -1161,6 +1299,9 @@ BytecodeGenerator::BytecodeGenerator(
       suspend_count_(0),
       loop_depth_(0),
       current_loop_scope_(nullptr),
+      elided_arguments_(nullptr),
+      elided_rest_parameter_(nullptr),
+      elided_rest_initialization_(nullptr),
       catch_prediction_(HandlerTable::UNCAUGHT) {
   DCHECK_EQ(closure_scope(), closure_scope()->GetClosureScope());
   if (info->has_source_range_map()) {
@@ -1397,6 +1538,7 @@ void BytecodeGenerator::GenerateBytecode(uintptr_t stack_limit) {
 
 void BytecodeGenerator::GenerateBytecodeBody() {
   // Build the arguments object if it is used.
+  FindElidedArguments();
   VisitArgumentsObject(closure_scope()->arguments());
 
   // Build rest arguments array if it is used.
@@ -2864,13 +3006,16 @@ void BytecodeGenerator::BuildInstanceMemberInitialization(Register constructor,
   FeedbackSlot slot = feedback_spec()->AddLoadICSlot();
   BytecodeLabel done;
 
+  builder()->LoadClassFieldsInitializer(constructor, feedback_index(slot));
+  // A class constructor that requires the initializer is only callable once
+  // the class definition has installed it. Arrow functions and eval calling
+  // super() don't know whether the class has fields, so they check.
+  if (!IsClassConstructor(function_kind()) ||
+      !info()->literal()->requires_instance_members_initializer()) {
+    builder()->JumpIfUndefined(&done);
+  }
   builder()
-      ->LoadClassFieldsInitializer(constructor, feedback_index(slot))
-      // TODO(gsathya): This jump can be elided for the base
-      // constructor and derived constructor. This is only required
-      // when called from an arrow function.
-      .JumpIfUndefined(&done)
-      .StoreAccumulatorInRegister(initializer)
+      ->StoreAccumulatorInRegister(initializer)
       .MoveRegister(instance, args[0])
       .CallProperty(initializer, args,
                     feedback_index(feedback_spec()->AddCallICSlot()))
@@ -3429,9 +3574,24 @@ void BytecodeGenerator::VisitVariableProxy(VariableProxy* proxy) {
   BuildVariableLoad(proxy->var(), proxy->hole_check_mode());
 }
 
+namespace {
+
+// With --const-tracking-let, script-scope let bindings are accessed through
+// the script context table, like REPL-mode globals, so that every
+// reassignment goes through the StoreGlobalIC and optimized code can treat
+// the binding as a constant until then.
+bool IsConstTrackingLet(Variable* variable) {
+  return FLAG_const_tracking_let && variable->mode() == VariableMode::kLet &&
+         variable->scope()->is_script_scope();
+}
+
+}  // namespace
+
 void BytecodeGenerator::BuildVariableLoad(Variable* variable,
                                           HoleCheckMode hole_check_mode,
                                           TypeofMode typeof_mode) {
+  DCHECK_NE(variable, elided_arguments_);
+  DCHECK_NE(variable, elided_rest_parameter_);
   switch (variable->location()) {
     case VariableLocation::LOCAL: {
       Register source(builder()->Local(variable->index()));
@@ -3474,6 +3634,13 @@ void BytecodeGenerator::BuildVariableLoad(Variable* variable,
       break;
     }
     case VariableLocation::CONTEXT: {
+      if (IsConstTrackingLet(variable)) {
+        // The LoadGlobalIC throws on the hole, so no hole check is needed.
+        FeedbackSlot slot = GetCachedLoadGlobalICSlot(typeof_mode, variable);
+        builder()->LoadGlobal(variable->raw_name(), feedback_index(slot),
+                              typeof_mode);
+        break;
+      }
       int depth = execution_context()->ContextChainDepth(variable->scope());
       ContextScope* context = execution_context()->Previous(depth);
       Register context_reg;
@@ -3660,6 +3827,11 @@ void BytecodeGenerator::BuildVariableAssignment(
       break;
     }
     case VariableLocation::CONTEXT: {
+      if (op != Token::INIT && IsConstTrackingLet(variable)) {
+        // The StoreGlobalIC throws on the hole, so no hole check is needed.
+        BuildStoreGlobal(variable);
+        break;
+      }
       int depth = execution_context()->ContextChainDepth(variable->scope());
       ContextScope* context = execution_context()->Previous(depth);
       Register context_reg;
@@ -4014,6 +4186,80 @@ Expression* BytecodeGenerator::GetDestructuringDefaultValue(
   return default_value;
 }
 
+// Returns true if the elements of a fast array can be assigned to |pattern|
+// without the iteration protocol. When the array iterator protector holds,
+// iterating a fast JSArray is unobservable, and skipping the IteratorClose
+// step is too. That leaves the targets: they must not run user code or
+// throw, so that the element reads can't be reordered with observable
+// effects. Hence only elisions and variables that need neither hole checks
+// nor const checks are allowed, with at most a literal as default value.
+bool BytecodeGenerator::CanUseFastDestructuringArrayAssignment(
+    ArrayLiteral* pattern, Token::Value op) {
+  if (!FLAG_fast_array_destructuring) return false;
+  if (pattern->values()->length() > kMaxFastDestructuringArrayLength) {
+    return false;
+  }
+  for (Expression* target : *pattern->values()) {
+    Expression* default_value = GetDestructuringDefaultValue(&target);
+    if (default_value != nullptr && !default_value->IsLiteral()) return false;
+    if (target->IsTheHoleLiteral()) continue;
+    // This also rules out spreads, nested patterns and property targets.
+    VariableProxy* proxy = target->AsVariableProxy();
+    if (proxy == nullptr) return false;
+    Variable* variable = proxy->var();
+    switch (variable->location()) {
+      case VariableLocation::PARAMETER:
+      case VariableLocation::LOCAL:
+      case VariableLocation::CONTEXT:
+        break;
+      default:
+        return false;
+    }
+    if (proxy->hole_check_mode() == HoleCheckMode::kRequired) return false;
+    if (op != Token::INIT && variable->mode() == VariableMode::kConst) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Fast path of BuildDestructuringArrayAssignment for fast arrays, see
+// CanUseFastDestructuringArrayAssignment.
+//
+// [a, , b = 1] = value
+//
+//   becomes
+//
+// a = value[0]
+// b = value[2]
+// if (b === undefined) b = 1
+void BytecodeGenerator::BuildFastDestructuringArrayAssignment(
+    ArrayLiteral* pattern, Register value, Token::Value op,
+    LookupHoistingMode lookup_hoisting_mode) {
+  // Holes and out-of-bounds reads produce undefined, as the no-elements
+  // protector holds for fast arrays.
+  FeedbackSlot element_load_slot = feedback_spec()->AddKeyedLoadICSlot();
+  int index = 0;
+  for (Expression* target : *pattern->values()) {
+    Expression* default_value = GetDestructuringDefaultValue(&target);
+    if (!target->IsTheHoleLiteral()) {
+      builder()->SetExpressionAsStatementPosition(target);
+      AssignmentLhsData lhs_data = PrepareAssignmentLhs(target);
+      builder()
+          ->LoadLiteral(Smi::FromInt(index))
+          .LoadKeyedProperty(value, feedback_index(element_load_slot));
+      if (default_value) {
+        BytecodeLabel do_assignment;
+        builder()->JumpIfNotUndefined(&do_assignment);
+        VisitForAccumulatorValue(default_value);
+        builder()->Bind(&do_assignment);
+      }
+      BuildAssignment(lhs_data, op, lookup_hoisting_mode);
+    }
+    index++;
+  }
+}
+
 // Convert a destructuring assignment to an array literal into a sequence of
 // iterator accesses into the value being assigned (in the accumulator).
 //
@@ -4052,6 +4298,8 @@ Expression* BytecodeGenerator::GetDestructuringDefaultValue(
 // } finally {
 //   %FinalizeIteration(iterator, done, iteration_continuation)
 // }
+//
+// Fast arrays skip the iterator, see BuildFastDestructuringArrayAssignment.
 void BytecodeGenerator::BuildDestructuringArrayAssignment(
     ArrayLiteral* pattern, Token::Value op,
     LookupHoistingMode lookup_hoisting_mode) {
@@ -4060,6 +4308,19 @@ void BytecodeGenerator::BuildDestructuringArrayAssignment(
   Register value = register_allocator()->NewRegister();
   builder()->StoreAccumulatorInRegister(value);
 
+  BytecodeLabel fast_path_done;
+  bool use_fast_path = CanUseFastDestructuringArrayAssignment(pattern, op);
+  if (use_fast_path) {
+    BytecodeLabel slow_path;
+    builder()
+        ->CallRuntime(Runtime::kInlineIsFastJSArrayForDestructuring, value)
+        .JumpIfFalse(ToBooleanMode::kAlreadyBoolean, &slow_path);
+    BuildFastDestructuringArrayAssignment(pattern, value, op,
+                                          lookup_hoisting_mode);
+    builder()->Jump(&fast_path_done);
+    builder()->Bind(&slow_path);
+  }
+
   // Store the iterator in a dedicated register so that it can be closed on
   // exit, and the 'done' value in a dedicated register so that it can be
   // changed and accessed independently of the iteration result.
@@ -4203,6 +4464,7 @@ void BytecodeGenerator::BuildDestructuringArrayAssignment(
       },
       HandlerTable::UNCAUGHT);
 
+  if (use_fast_path) builder()->Bind(&fast_path_done);
   if (!execution_result()->IsEffect()) {
     builder()->LoadAccumulatorWithRegister(value);
   }
@@ -4448,6 +4710,10 @@ void BytecodeGenerator::BuildAssignment(
 }
 
 void BytecodeGenerator::VisitAssignment(Assignment* expr) {
+  if (expr == elided_rest_initialization_) {
+    DCHECK(execution_result()->IsEffect());
+    return;
+  }
   AssignmentLhsData lhs_data = PrepareAssignmentLhs(expr->target());
 
   VisitForAccumulatorValue(expr->value());
@@ -5261,6 +5527,7 @@ void BytecodeGenerator::VisitOptionalChain(OptionalChain* expr) {
 }
 
 void BytecodeGenerator::VisitProperty(Property* expr) {
+  if (IsElidedArgumentsLoad(expr)) return VisitElidedArgumentsLoad(expr);
   AssignType property_kind = Property::GetAssignType(expr);
   if (property_kind != NAMED_SUPER_PROPERTY &&
       property_kind != KEYED_SUPER_PROPERTY) {
@@ -6805,8 +7072,76 @@ void BytecodeGenerator::VisitLiteralAccessor(LiteralProperty* property,
   }
 }
 
+void BytecodeGenerator::FindElidedArguments() {
+  if (!FLAG_ignition_elide_arguments) return;
+  // Resuming generators don't restore the actual arguments.
+  if (IsResumableFunction(function_kind())) return;
+  if (closure_scope()->inner_scope_calls_eval()) return;
+  FunctionLiteral* literal = info()->literal();
+
+  Variable* arguments = closure_scope()->arguments();
+  if (arguments != nullptr && arguments->IsStackLocal()) {
+    ElidedArgumentsFinder finder(stack_limit(),
+                                 ast_string_constants()->length_string());
+    if (finder.FindArgumentsLoads(literal, arguments)) {
+      bool elide = true;
+      if (finder.has_keyed_loads()) {
+        // The elements are read from the frame, not from the parameters.
+        for (int i = 0; i < closure_scope()->num_parameters(); i++) {
+          if (closure_scope()->parameter(i)->maybe_assigned() ==
+              kMaybeAssigned) {
+            elide = false;
+          }
+        }
+        // Optimized code can't read mapped elements from the frame, so it
+        // would allocate the object for every load rather than once.
+        if (closure_scope()->GetArgumentsType() ==
+                CreateArgumentsType::kMappedArguments &&
+            closure_scope()->num_parameters() > 0) {
+          elide = false;
+        }
+      }
+      if (elide) elided_arguments_ = arguments;
+    }
+  }
+
+  Variable* rest = closure_scope()->rest_parameter();
+  if (rest != nullptr && rest->IsStackLocal()) {
+    ElidedArgumentsFinder finder(stack_limit(),
+                                 ast_string_constants()->length_string());
+    elided_rest_parameter_ = finder.FindRestParameterLoads(literal, rest);
+    elided_rest_initialization_ = finder.rest_initialization();
+  }
+}
+
+bool BytecodeGenerator::IsElidedArgumentsLoad(Property* expr) const {
+  VariableProxy* proxy = expr->obj()->AsVariableProxy();
+  if (proxy == nullptr) return false;
+  Variable* var = proxy->var();
+  return var != nullptr &&
+         (var == elided_arguments_ || var == elided_rest_parameter_);
+}
+
+void BytecodeGenerator::VisitElidedArgumentsLoad(Property* expr) {
+  CreateArgumentsType type =
+      expr->obj()->AsVariableProxy()->var() == elided_rest_parameter_
+          ? CreateArgumentsType::kRestParameter
+          : closure_scope()->GetArgumentsType();
+  if (Property::GetAssignType(expr) == NAMED_PROPERTY) {
+    builder()->SetExpressionPosition(expr);
+    builder()->LoadArgumentsLength(type);
+  } else {
+    DCHECK_EQ(KEYED_PROPERTY, Property::GetAssignType(expr));
+    VisitForAccumulatorValue(expr->key());
+    builder()->SetExpressionPosition(expr);
+    builder()->LoadKeyedArgument(
+        type, feedback_index(feedback_spec()->AddKeyedLoadICSlot()));
+  }
+}
+
 void BytecodeGenerator::VisitArgumentsObject(Variable* variable) {
   if (variable == nullptr) return;
+  if (variable == elided_arguments_) return;
 
   DCHECK(variable->IsContextSlot() || variable->IsStackAllocated());
 
@@ -6818,6 +7153,7 @@ void BytecodeGenerator::VisitArgumentsObject(Variable* variable) {
 
 void BytecodeGenerator::VisitRestArgumentsArray(Variable* rest) {
   if (rest == nullptr) return;
+  if (elided_rest_parameter_ != nullptr) return;
 
   // Allocate and initialize a new rest parameter and assign to the {rest}
   // variable.
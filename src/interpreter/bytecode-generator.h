@@ -68,6 +68,7 @@ class BytecodeGenerator final : public AstVisitor<BytecodeGenerator> {
   class ControlScopeForTryFinally;
   class CurrentScope;
   class EffectResultScope;
+  class ElidedArgumentsFinder;
   class ExpressionResultScope;
   class FeedbackSlotCache;
   class IteratorRecord;
@@ -219,6 +220,12 @@ class BytecodeGenerator final : public AstVisitor<BytecodeGenerator> {
   void VisitPropertyLoadForRegister(Register obj, Property* expr,
                                     Register destination);
 
+  // Loads from the arguments object or rest parameter if it is only loaded
+  // from, in which case it isn't allocated.
+  void FindElidedArguments();
+  bool IsElidedArgumentsLoad(Property* expr) const;
+  void VisitElidedArgumentsLoad(Property* expr);
+
   AssignmentLhsData PrepareAssignmentLhs(
       Expression* lhs, AccumulatorPreservingMode accumulator_preserving_mode =
                            AccumulatorPreservingMode::kNone);
@@ -230,6 +237,14 @@ class BytecodeGenerator final : public AstVisitor<BytecodeGenerator> {
   void BuildDeclareCall(Runtime::FunctionId id);
 
   Expression* GetDestructuringDefaultValue(Expression** target);
+  // Longer array patterns only get the iterator path, so that the duplicated
+  // bytecode stays small.
+  static const int kMaxFastDestructuringArrayLength = 8;
+  bool CanUseFastDestructuringArrayAssignment(ArrayLiteral* pattern,
+                                              Token::Value op);
+  void BuildFastDestructuringArrayAssignment(
+      ArrayLiteral* pattern, Register value, Token::Value op,
+      LookupHoistingMode lookup_hoisting_mode);
   void BuildDestructuringArrayAssignment(
       ArrayLiteral* pattern, Token::Value op,
       LookupHoistingMode lookup_hoisting_mode);
@@ -533,6 +548,12 @@ class BytecodeGenerator final : public AstVisitor<BytecodeGenerator> {
 
   LoopScope* current_loop_scope_;
 
+  // The arguments object and the variable of the rest parameter if they are
+  // elided, and the rest parameter's initialization.
+  Variable* elided_arguments_;
+  Variable* elided_rest_parameter_;
+  Assignment* elided_rest_initialization_;
+
   HandlerTable::CatchPrediction catch_prediction_;
 };
 
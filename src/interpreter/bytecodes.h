@@ -138,6 +138,12 @@ namespace interpreter {
   V(LdaKeyedProperty, ImplicitRegisterUse::kReadWriteAccumulator,              \
     OperandType::kReg, OperandType::kIdx)                                      \
                                                                                \
+  /* Loads from elided arguments objects and rest parameters */                \
+  V(LdaArgumentsLength, ImplicitRegisterUse::kWriteAccumulator,                \
+    OperandType::kFlag8)                                                       \
+  V(LdaKeyedArgument, ImplicitRegisterUse::kReadWriteAccumulator,              \
+    OperandType::kFlag8, OperandType::kIdx)                                    \
+                                                                               \
   /* Operations on module variables */                                         \
   V(LdaModuleVariable, ImplicitRegisterUse::kWriteAccumulator,                 \
     OperandType::kImm, OperandType::kUImm)                                     \
@@ -935,6 +941,15 @@ class V8_EXPORT_PRIVATE Bytecodes final : public AllStatic {
   // dispatch to a Star bytecode.
   static bool IsStarLookahead(Bytecode bytecode, OperandScale operand_scale);
 
+  // Returns true if the handler for |bytecode| should look ahead and inline a
+  // dispatch to a JumpIfTrue or JumpIfFalse bytecode.
+  static bool IsJumpIfBooleanLookahead(Bytecode bytecode,
+                                       OperandScale operand_scale);
+
+  // Returns true if the handler for |bytecode| should look ahead and inline a
+  // dispatch to an Ldar bytecode.
+  static bool IsLdarLookahead(Bytecode bytecode, OperandScale operand_scale);
+
   // Returns the number of registers represented by a register operand. For
   // instance, a RegPair represents two registers. Should not be called for
   // kRegList which has a variable number of registers based on the following
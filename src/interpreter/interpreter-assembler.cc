@@ -1181,6 +1181,95 @@ void InterpreterAssembler::InlineShortStar(TNode<WordT> target_bytecode) {
   implicit_register_use_ = previous_acc_use;
 }
 
+void InterpreterAssembler::JumpIfBooleanDispatchLookahead(
+    TNode<WordT> target_bytecode) {
+  Label do_inline_jump_if_true(this), do_inline_jump_if_false(this),
+      done(this);
+
+  TNode<Int32T> target = TruncateWordToInt32(target_bytecode);
+  GotoIf(Word32Equal(target, Int32Constant(
+                                 static_cast<int>(Bytecode::kJumpIfTrue))),
+         &do_inline_jump_if_true);
+  Branch(Word32Equal(target, Int32Constant(
+                                 static_cast<int>(Bytecode::kJumpIfFalse))),
+         &do_inline_jump_if_false, &done);
+
+  BIND(&do_inline_jump_if_true);
+  InlineJumpIfBoolean(Bytecode::kJumpIfTrue, TrueConstant());
+
+  BIND(&do_inline_jump_if_false);
+  InlineJumpIfBoolean(Bytecode::kJumpIfFalse, FalseConstant());
+
+  BIND(&done);
+}
+
+void InterpreterAssembler::InlineJumpIfBoolean(Bytecode jump_bytecode,
+                                               TNode<Oddball> condition) {
+  // Keep the dispatch counters accurate, so that the fused pair still shows
+  // up in --trace-ignition-dispatches profiles.
+  if (V8_IGNITION_DISPATCH_COUNTING_BOOL) {
+    TraceBytecodeDispatch(IntPtrConstant(static_cast<int>(jump_bytecode)));
+  }
+
+  Bytecode previous_bytecode = bytecode_;
+  ImplicitRegisterUse previous_acc_use = implicit_register_use_;
+  bytecode_ = jump_bytecode;
+  implicit_register_use_ = ImplicitRegisterUse::kNone;
+
+#ifdef V8_TRACE_UNOPTIMIZED
+  TraceBytecode(Runtime::kTraceUnoptimizedBytecodeEntry);
+#endif
+
+  // Both the taken and the fall-through path end in their own dispatch.
+  TNode<Object> accumulator = GetAccumulator();
+  TNode<IntPtrT> relative_jump = Signed(BytecodeOperandUImmWord(0));
+  CSA_DCHECK(this, IsBoolean(CAST(accumulator)));
+  JumpIfTaggedEqual(accumulator, condition, relative_jump);
+
+  DCHECK_EQ(implicit_register_use_,
+            Bytecodes::GetImplicitRegisterUse(bytecode_));
+  bytecode_ = previous_bytecode;
+  implicit_register_use_ = previous_acc_use;
+}
+
+void InterpreterAssembler::LdarDispatchLookahead(TNode<WordT> target_bytecode) {
+  Label do_inline_ldar(this), done(this);
+
+  Branch(Word32Equal(TruncateWordToInt32(target_bytecode),
+                     Int32Constant(static_cast<int>(Bytecode::kLdar))),
+         &do_inline_ldar, &done);
+
+  BIND(&do_inline_ldar);
+  {
+    if (V8_IGNITION_DISPATCH_COUNTING_BOOL) {
+      TraceBytecodeDispatch(target_bytecode);
+    }
+
+    Bytecode previous_bytecode = bytecode_;
+    ImplicitRegisterUse previous_acc_use = implicit_register_use_;
+    bytecode_ = Bytecode::kLdar;
+    implicit_register_use_ = ImplicitRegisterUse::kNone;
+
+#ifdef V8_TRACE_UNOPTIMIZED
+    TraceBytecode(Runtime::kTraceUnoptimizedBytecodeEntry);
+#endif
+
+    SetAccumulator(LoadRegisterAtOperandIndex(0));
+
+    DCHECK_EQ(implicit_register_use_,
+              Bytecodes::GetImplicitRegisterUse(bytecode_));
+
+    // As for the short Star lookahead, dispatch separately from the
+    // non-fused path for better branch prediction.
+    TNode<IntPtrT> target_offset = Advance();
+    DispatchToBytecode(LoadBytecode(target_offset), target_offset);
+
+    bytecode_ = previous_bytecode;
+    implicit_register_use_ = previous_acc_use;
+  }
+  BIND(&done);
+}
+
 void InterpreterAssembler::Dispatch() {
   Comment("========= Dispatch");
   DCHECK_IMPLIES(Bytecodes::MakesCallAlongCriticalPath(bytecode_), made_call_);
@@ -1193,6 +1282,10 @@ void InterpreterAssembler::DispatchToBytecodeWithOptionalStarLookahead(
     TNode<WordT> target_bytecode) {
   if (Bytecodes::IsStarLookahead(bytecode_, operand_scale_)) {
     StarDispatchLookahead(target_bytecode);
+  } else if (Bytecodes::IsJumpIfBooleanLookahead(bytecode_, operand_scale_)) {
+    JumpIfBooleanDispatchLookahead(target_bytecode);
+  } else if (Bytecodes::IsLdarLookahead(bytecode_, operand_scale_)) {
+    LdarDispatchLookahead(target_bytecode);
   }
   DispatchToBytecode(target_bytecode, BytecodeOffset());
 }
@@ -368,6 +368,20 @@ class V8_EXPORT_PRIVATE InterpreterAssembler : public CodeStubAssembler {
   // the next dispatch offset.
   void InlineShortStar(TNode<WordT> target_bytecode);
 
+  // Look ahead for JumpIfTrue and JumpIfFalse and inline them in a branch,
+  // including the subsequent dispatch. Anything after this point can assume
+  // that the following instruction was not one of these jumps.
+  void JumpIfBooleanDispatchLookahead(TNode<WordT> target_bytecode);
+
+  // Build code for |jump_bytecode|, which jumps if the accumulator is
+  // |condition|, at the current BytecodeOffset() and dispatch from it.
+  void InlineJumpIfBoolean(Bytecode jump_bytecode, TNode<Oddball> condition);
+
+  // Look ahead for Ldar and inline it in a branch, including the subsequent
+  // dispatch. This fuses the common Star -> Ldar sequence of storing the
+  // accumulator and loading the next operand into a single dispatch.
+  void LdarDispatchLookahead(TNode<WordT> target_bytecode);
+
   // Dispatch to the bytecode handler with code entry point |handler_entry|.
   void DispatchToBytecodeHandlerEntry(TNode<RawPtrT> handler_entry,
                                       TNode<IntPtrT> bytecode_offset);
@@ -2634,6 +2634,88 @@ IGNITION_HANDLER(CreateRestParameter, InterpreterAssembler) {
   Dispatch();
 }
 
+// LdaArgumentsLength <type>
+//
+// Loads the length of the arguments object or rest parameter of the
+// CreateArgumentsType <type> into the accumulator, without allocating it.
+IGNITION_HANDLER(LdaArgumentsLength, InterpreterAssembler) {
+  TNode<Context> context = GetContext();
+  TNode<BoolT> is_rest_parameter = Word32Equal(
+      BytecodeOperandFlag(0),
+      Int32Constant(static_cast<int>(CreateArgumentsType::kRestParameter)));
+  TorqueGeneratedExportedMacrosAssembler builtins_assembler(state());
+  SetAccumulator(
+      builtins_assembler.EmitLoadArgumentsLength(context, is_rest_parameter));
+  Dispatch();
+}
+
+// LdaKeyedArgument <type> <slot>
+//
+// Loads the element with the key in the accumulator of the arguments object or
+// rest parameter of the CreateArgumentsType <type>. The element of an actual
+// argument is read from the frame. Otherwise, and to collect the initial
+// feedback in <slot>, the object is materialized and loaded from by the
+// KeyedLoadIC.
+IGNITION_HANDLER(LdaKeyedArgument, InterpreterAssembler) {
+  TNode<Object> key = GetAccumulator();
+  TNode<Uint32T> type = BytecodeOperandFlag(0);
+  TNode<Context> context = GetContext();
+  TNode<HeapObject> maybe_feedback_vector = LoadFeedbackVector();
+
+  Label fast_path(this), slow_path(this, Label::kDeferred);
+  GotoIf(IsUndefined(maybe_feedback_vector), &fast_path);
+  TNode<MaybeObject> feedback = LoadFeedbackVectorSlot(
+      CAST(maybe_feedback_vector), BytecodeOperandIdx(1));
+  Branch(TaggedEqual(feedback, UninitializedSymbolConstant()), &slow_path,
+         &fast_path);
+
+  BIND(&fast_path);
+  {
+    TNode<BoolT> is_rest_parameter = Word32Equal(
+        type,
+        Int32Constant(static_cast<int>(CreateArgumentsType::kRestParameter)));
+    TorqueGeneratedExportedMacrosAssembler builtins_assembler(state());
+    TNode<Object> result = builtins_assembler.EmitTryLoadKeyedArgument(
+        context, key, is_rest_parameter);
+    GotoIf(IsTheHole(result), &slow_path);
+    SetAccumulator(result);
+    Dispatch();
+  }
+
+  BIND(&slow_path);
+  {
+    TNode<JSFunction> closure =
+        CAST(LoadRegister(Register::function_closure()));
+    TVARIABLE(Object, var_object);
+    Label if_mapped(this), if_unmapped(this), if_rest(this), load(this);
+    GotoIf(Word32Equal(type, Int32Constant(static_cast<int>(
+                                 CreateArgumentsType::kMappedArguments))),
+           &if_mapped);
+    Branch(Word32Equal(type, Int32Constant(static_cast<int>(
+                                 CreateArgumentsType::kRestParameter))),
+           &if_rest, &if_unmapped);
+
+    BIND(&if_mapped);
+    var_object = CallRuntime(Runtime::kNewSloppyArguments, context, closure);
+    Goto(&load);
+
+    BIND(&if_unmapped);
+    var_object = CallRuntime(Runtime::kNewStrictArguments, context, closure);
+    Goto(&load);
+
+    BIND(&if_rest);
+    var_object = CallRuntime(Runtime::kNewRestParameter, context, closure);
+    Goto(&load);
+
+    BIND(&load);
+    TNode<Object> result =
+        CallBuiltin(Builtin::kKeyedLoadIC, context, var_object.value(), key,
+                    BytecodeOperandIdxTaggedIndex(1), maybe_feedback_vector);
+    SetAccumulator(result);
+    Dispatch();
+  }
+}
+
 // SetPendingMessage
 //
 // Sets the pending message to the value in the accumulator, and returns the
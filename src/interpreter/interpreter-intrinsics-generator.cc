@@ -153,6 +153,14 @@ TNode<Object> IntrinsicsGenerator::CreateAsyncFromSyncIterator(
   return __ CreateAsyncFromSyncIterator(context, sync_iterator);
 }
 
+TNode<Object> IntrinsicsGenerator::IsFastJSArrayForDestructuring(
+    const InterpreterAssembler::RegListNodePair& args, TNode<Context> context,
+    int arg_count) {
+  return IntrinsicAsBuiltinCall(args, context,
+                                Builtin::kIsFastJSArrayForDestructuring,
+                                arg_count);
+}
+
 TNode<Object> IntrinsicsGenerator::CreateJSGeneratorObject(
     const InterpreterAssembler::RegListNodePair& args, TNode<Context> context,
     int arg_count) {
@@ -4,6 +4,7 @@
 
 #include "src/json/json-parser.h"
 
+#include "src/base/memory.h"
 #include "src/base/strings.h"
 #include "src/common/globals.h"
 #include "src/common/message-template.h"
@@ -118,6 +119,30 @@ static const constexpr uint8_t character_json_scan_flags[256] = {
 #undef CALL_GET_SCAN_FLAGS
 };
 
+// Skips whole words of one-byte characters that cannot terminate a JSON
+// string, i.e. words without a quote, a backslash or a control character.
+// Returns a pointer to the first word that may contain one, or to the last
+// partial word before {end}.
+const uint8_t* SkipNonTerminatingWords(const uint8_t* cursor,
+                                       const uint8_t* end) {
+  const uintptr_t kOnes = kUintptrAllBitsSet / 0xFF;
+  const uintptr_t kHighBits = kOnes * 0x80;
+  while (static_cast<size_t>(end - cursor) >= sizeof(uintptr_t)) {
+    uintptr_t word =
+        base::ReadUnalignedValue<uintptr_t>(reinterpret_cast<Address>(cursor));
+    uintptr_t quotes = word ^ (kOnes * '"');
+    uintptr_t backslashes = word ^ (kOnes * '\\');
+    // (x - kOnes * n) & ~x & kHighBits is non-zero iff some byte of x is less
+    // than n, for n <= 0x80.
+    uintptr_t may_terminate = ((word - kOnes * 0x20) & ~word) |
+                              ((quotes - kOnes) & ~quotes) |
+                              ((backslashes - kOnes) & ~backslashes);
+    if (may_terminate & kHighBits) break;
+    cursor += sizeof(uintptr_t);
+  }
+  return cursor;
+}
+
 }  // namespace
 
 MaybeHandle<Object> JsonParseInternalizer::Internalize(Isolate* isolate,
@@ -702,6 +727,16 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonValue() {
 
   cont_stack.reserve(16);
 
+  // The maps of the most recently built objects, indexed by their number of
+  // named properties modulo kShapeCacheSize. Objects that aren't array
+  // elements following an object use them as feedback, which speeds up
+  // documents that repeat the same nested layouts.
+  Handle<FixedArray> shape_cache;
+  SkipWhitespace();
+  if (peek() == JsonToken::LBRACE || peek() == JsonToken::LBRACK) {
+    shape_cache = factory()->NewFixedArray(kShapeCacheSize);
+  }
+
   JsonContinuation cont(isolate_, JsonContinuation::kReturn, 0);
 
   Handle<Object> value;
@@ -841,7 +876,25 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonValue() {
               }
             }
           }
+          const int shape_index =
+              static_cast<int>(property_stack.size() - cont.index -
+                               cont.elements) %
+              kShapeCacheSize;
+          if (feedback.is_null() && !shape_cache.is_null() &&
+              shape_cache->get(shape_index).IsMap()) {
+            Map maybe_feedback = Map::cast(shape_cache->get(shape_index));
+            if (!maybe_feedback.IsDetached(isolate_)) {
+              feedback = handle(maybe_feedback, isolate_);
+              if (feedback->is_deprecated()) {
+                feedback = Map::Update(isolate_, feedback);
+              }
+            }
+          }
           value = BuildJsonObject(cont, property_stack, feedback);
+          if (!shape_cache.is_null() &&
+              !JSObject::cast(*value).map().is_dictionary_map()) {
+            shape_cache->set(shape_index, JSObject::cast(*value).map());
+          }
           property_stack.resize_no_init(cont.index);
           Expect(JsonToken::RBRACE);
 
@@ -925,21 +978,27 @@ Handle<Object> JsonParser<Char>::ParseJsonNumber() {
         return handle(Smi::FromInt(0), isolate_);
       }
       c = CurrentCharacter();
-      STATIC_ASSERT(Smi::IsValid(-999999999));
-      STATIC_ASSERT(Smi::IsValid(999999999));
-      const int kMaxSmiLength = 9;
-      if ((cursor_ - smi_start) <= kMaxSmiLength &&
+      // Integers with up to 15 digits are exactly representable as doubles,
+      // so they don't need to go through StringToDouble.
+      STATIC_ASSERT(999999999999999.0 <= kMaxSafeInteger);
+      const int kMaxExactIntegerLength = 15;
+      if ((cursor_ - smi_start) <= kMaxExactIntegerLength &&
           (!base::IsInRange(c, 0,
                             static_cast<int32_t>(unibrow::Latin1::kMaxChar)) ||
            !IsNumberPart(character_json_scan_flags[c]))) {
-        // Smi.
-        int32_t i = 0;
+        int64_t i = 0;
         for (; smi_start != cursor_; smi_start++) {
           DCHECK(IsDecimalDigit(*smi_start));
           i = (i * 10) + ((*smi_start) - '0');
         }
-        // TODO(verwaest): Cache?
-        return handle(Smi::FromInt(i * sign), isolate_);
+        i *= sign;
+        if (base::IsInRange(i, int64_t{Smi::kMinValue},
+                            int64_t{Smi::kMaxValue})) {
+          // TODO(verwaest): Cache?
+          return handle(Smi::FromInt(static_cast<int>(i)), isolate_);
+        }
+        AllowGarbageCollection allow_before_allocation;
+        return factory()->NewHeapNumber(static_cast<double>(i));
       }
     }
 
@@ -1114,6 +1173,11 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
   base::uc32 bits = 0;
 
   while (true) {
+    if (sizeof(Char) == 1) {
+      cursor_ = reinterpret_cast<const Char*>(
+          SkipNonTerminatingWords(reinterpret_cast<const uint8_t*>(cursor_),
+                                  reinterpret_cast<const uint8_t*>(end_)));
+    }
     cursor_ = std::find_if(cursor_, end_, [&bits](Char c) {
       if (sizeof(Char) == 2 && V8_UNLIKELY(c > unibrow::Latin1::kMaxChar)) {
         bits |= c;
@@ -291,6 +291,8 @@ class JsonParser final {
   // one of "true", "false", or "null", or an object or array literal.
   MaybeHandle<Object> ParseJsonValue();
 
+  static constexpr int kShapeCacheSize = 16;
+
   Handle<Object> BuildJsonObject(
       const JsonContinuation& cont,
       const SmallVector<JsonProperty>& property_stack, Handle<Map> feedback);
@@ -88,7 +88,9 @@ class JsonStringifier {
   Result SerializeArrayLikeSlow(Handle<JSReceiver> object, uint32_t start,
                                 uint32_t length);
 
-  void SerializeString(Handle<String> object);
+  // If {known_plain} is set, the string must consist of one-byte characters
+  // that don't need to be escaped.
+  void SerializeString(Handle<String> object, bool known_plain = false);
 
   template <typename SrcChar, typename DestChar>
   V8_INLINE static void SerializeStringUnchecked_(
@@ -96,7 +98,12 @@ class JsonStringifier {
       IncrementalStringBuilder::NoExtend<DestChar>* dest);
 
   template <typename SrcChar, typename DestChar>
-  V8_INLINE void SerializeString_(Handle<String> string);
+  V8_INLINE void SerializeString_(Handle<String> string, bool known_plain);
+
+  // Returns whether {key} is known to need no escaping, and remembers it if it
+  // doesn't. Objects of the same shape serialize the same keys over and over,
+  // so this saves checking every character of every key again.
+  bool IsKnownPlainKey(Handle<String> key);
 
   template <typename Char>
   V8_INLINE static bool DoNotEscape(Char c);
@@ -134,6 +141,10 @@ class JsonStringifier {
   using KeyObject = std::pair<Handle<Object>, Handle<Object>>;
   std::vector<KeyObject> stack_;
 
+  // Internalized keys that need no escaping, indexed by their hash.
+  static const int kKeyCacheSize = 64;
+  Handle<FixedArray> key_cache_;
+
   static const int kJsonEscapeTableEntrySize = 8;
   static const char* const JsonEscapeTable;
 };
@@ -228,6 +239,9 @@ MaybeHandle<Object> JsonStringifier::Stringify(Handle<Object> object,
   if (!gap->IsUndefined(isolate_) && !InitializeGap(gap)) {
     return MaybeHandle<Object>();
   }
+  if (object->IsJSReceiver()) {
+    key_cache_ = factory()->NewFixedArray(kKeyCacheSize);
+  }
   Result result = SerializeObject(object);
   if (result == UNCHANGED) return factory()->undefined_value();
   if (result == SUCCESS) return builder_.Finish();
@@ -933,12 +947,20 @@ void JsonStringifier::SerializeStringUnchecked_(
 }
 
 template <typename SrcChar, typename DestChar>
-void JsonStringifier::SerializeString_(Handle<String> string) {
+void JsonStringifier::SerializeString_(Handle<String> string,
+                                       bool known_plain) {
   int length = string->length();
   builder_.Append<uint8_t, DestChar>('"');
   // We might be able to fit the whole escaped string in the current string
   // part, or we might need to allocate.
-  if (int worst_case_length = builder_.EscapedLengthIfCurrentPartFits(length)) {
+  if (known_plain && builder_.CurrentPartCanFit(length)) {
+    DisallowGarbageCollection no_gc;
+    base::Vector<const SrcChar> vector = string->GetCharVector<SrcChar>(no_gc);
+    IncrementalStringBuilder::NoExtendBuilder<DestChar> no_extend(
+        &builder_, length, no_gc);
+    no_extend.AppendChars(vector.begin(), length);
+  } else if (int worst_case_length =
+                 builder_.EscapedLengthIfCurrentPartFits(length)) {
     DisallowGarbageCollection no_gc;
     base::Vector<const SrcChar> vector = string->GetCharVector<SrcChar>(no_gc);
     IncrementalStringBuilder::NoExtendBuilder<DestChar> no_extend(
@@ -1023,25 +1045,42 @@ void JsonStringifier::Separator(bool first) {
 void JsonStringifier::SerializeDeferredKey(bool deferred_comma,
                                            Handle<Object> deferred_key) {
   Separator(!deferred_comma);
-  SerializeString(Handle<String>::cast(deferred_key));
+  Handle<String> key = Handle<String>::cast(deferred_key);
+  SerializeString(key, IsKnownPlainKey(key));
   builder_.AppendCharacter(':');
   if (gap_ != nullptr) builder_.AppendCharacter(' ');
 }
 
-void JsonStringifier::SerializeString(Handle<String> object) {
+bool JsonStringifier::IsKnownPlainKey(Handle<String> key) {
+  if (key_cache_.is_null() || !key->IsInternalizedString()) return false;
+  int index = key->hash() & (kKeyCacheSize - 1);
+  if (key_cache_->get(index) == *key) return true;
+  if (!String::IsOneByteRepresentationUnderneath(*key)) return false;
+  {
+    DisallowGarbageCollection no_gc;
+    for (uint8_t c : key->GetCharVector<uint8_t>(no_gc)) {
+      if (!DoNotEscape(c)) return false;
+    }
+  }
+  key_cache_->set(index, *key);
+  return true;
+}
+
+void JsonStringifier::SerializeString(Handle<String> object,
+                                      bool known_plain) {
   object = String::Flatten(isolate_, object);
   if (builder_.CurrentEncoding() == String::ONE_BYTE_ENCODING) {
     if (String::IsOneByteRepresentationUnderneath(*object)) {
-      SerializeString_<uint8_t, uint8_t>(object);
+      SerializeString_<uint8_t, uint8_t>(object, known_plain);
     } else {
       builder_.ChangeEncoding();
       SerializeString(object);
     }
   } else {
     if (String::IsOneByteRepresentationUnderneath(*object)) {
-      SerializeString_<uint8_t, base::uc16>(object);
+      SerializeString_<uint8_t, base::uc16>(object, known_plain);
     } else {
-      SerializeString_<base::uc16, base::uc16>(object);
+      SerializeString_<base::uc16, base::uc16>(object, false);
     }
   }
 }
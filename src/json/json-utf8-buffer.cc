@@ -0,0 +1,139 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/json/json-utf8-buffer.h"
+
+#include "include/v8-primitive.h"
+#include "src/execution/isolate.h"
+#include "src/heap/factory.h"
+#include "src/json/json-parser.h"
+#include "src/objects/objects-inl.h"
+#include "src/strings/unicode-inl.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// External string resources that own the decoded text.
+class OneByteResource final
+    : public v8::String::ExternalOneByteStringResource {
+ public:
+  explicit OneByteResource(std::vector<uint8_t> chars)
+      : chars_(std::move(chars)) {}
+
+  const char* data() const override {
+    return reinterpret_cast<const char*>(chars_.data());
+  }
+  size_t length() const override { return chars_.size(); }
+
+ private:
+  std::vector<uint8_t> chars_;
+};
+
+class TwoByteResource final : public v8::String::ExternalStringResource {
+ public:
+  explicit TwoByteResource(std::vector<base::uc16> chars)
+      : chars_(std::move(chars)) {}
+
+  const uint16_t* data() const override { return chars_.data(); }
+  size_t length() const override { return chars_.size(); }
+
+ private:
+  std::vector<base::uc16> chars_;
+};
+
+}  // namespace
+
+void JsonUtf8Buffer::Append(const uint8_t* data, size_t length) {
+  const uint8_t* cursor = data;
+  const uint8_t* end = data + length;
+  while (cursor < end) {
+    // Fast path for ASCII sequences.
+    if (state_ == unibrow::Utf8::State::kAccept) {
+      const uint8_t* ascii_end = cursor;
+      while (ascii_end < end && *ascii_end <= unibrow::Utf8::kMaxOneByteChar) {
+        ascii_end++;
+      }
+      if (is_one_byte_) {
+        one_byte_chars_.insert(one_byte_chars_.end(), cursor, ascii_end);
+      } else {
+        two_byte_chars_.insert(two_byte_chars_.end(), cursor, ascii_end);
+      }
+      cursor = ascii_end;
+      if (cursor == end) break;
+    }
+    unibrow::uchar c =
+        unibrow::Utf8::ValueOfIncremental(&cursor, &state_, &incomplete_char_);
+    if (c != unibrow::Utf8::kIncomplete) AddCharacter(c);
+  }
+}
+
+void JsonUtf8Buffer::AddCharacter(unibrow::uchar c) {
+  if (is_one_byte_ && c <= unibrow::Latin1::kMaxChar) {
+    one_byte_chars_.push_back(static_cast<uint8_t>(c));
+    return;
+  }
+  if (c <= unibrow::Utf16::kMaxNonSurrogateCharCode) {
+    AddTwoByteCharacter(static_cast<base::uc16>(c));
+  } else {
+    AddTwoByteCharacter(unibrow::Utf16::LeadSurrogate(c));
+    AddTwoByteCharacter(unibrow::Utf16::TrailSurrogate(c));
+  }
+}
+
+void JsonUtf8Buffer::AddTwoByteCharacter(base::uc16 c) {
+  if (is_one_byte_) {
+    // Switch to two-byte characters for the rest of the text.
+    two_byte_chars_.reserve(one_byte_chars_.size() * 2);
+    two_byte_chars_.assign(one_byte_chars_.begin(), one_byte_chars_.end());
+    std::vector<uint8_t>().swap(one_byte_chars_);
+    is_one_byte_ = false;
+  }
+  two_byte_chars_.push_back(c);
+}
+
+MaybeHandle<String> JsonUtf8Buffer::TakeString(Isolate* isolate) {
+  Factory* factory = isolate->factory();
+  if (length() == 0) return factory->empty_string();
+  if (is_one_byte_) {
+    auto resource =
+        std::make_unique<OneByteResource>(std::move(one_byte_chars_));
+    one_byte_chars_.clear();
+    Handle<String> string;
+    ASSIGN_RETURN_ON_EXCEPTION(
+        isolate, string, factory->NewExternalStringFromOneByte(resource.get()),
+        String);
+    // The string owns the resource now.
+    resource.release();
+    return string;
+  }
+  auto resource = std::make_unique<TwoByteResource>(std::move(two_byte_chars_));
+  two_byte_chars_.clear();
+  is_one_byte_ = true;
+  Handle<String> string;
+  ASSIGN_RETURN_ON_EXCEPTION(
+      isolate, string, factory->NewExternalStringFromTwoByte(resource.get()),
+      String);
+  resource.release();
+  return string;
+}
+
+MaybeHandle<Object> JsonUtf8Buffer::Parse(Isolate* isolate) {
+  unibrow::uchar c = unibrow::Utf8::ValueOfIncrementalFinish(&state_);
+  if (c != unibrow::Utf8::kBufferEmpty) AddCharacter(c);
+  incomplete_char_ = 0;
+
+  const bool is_one_byte = is_one_byte_;
+  Handle<String> source;
+  ASSIGN_RETURN_ON_EXCEPTION(isolate, source, TakeString(isolate), Object);
+  Handle<Object> undefined = isolate->factory()->undefined_value();
+  if (is_one_byte) {
+    return JsonParser<uint8_t>::Parse(isolate, source, undefined);
+  }
+  return JsonParser<uint16_t>::Parse(isolate, source, undefined);
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,53 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_JSON_JSON_UTF8_BUFFER_H_
+#define V8_JSON_JSON_UTF8_BUFFER_H_
+
+#include <vector>
+
+#include "src/base/strings.h"
+#include "src/common/globals.h"
+#include "src/handles/maybe-handles.h"
+#include "src/strings/unicode.h"
+
+namespace v8 {
+namespace internal {
+
+// Decodes UTF-8 encoded JSON text that arrives in chunks into an off-heap
+// buffer. The buffer stays one-byte until a character outside of Latin-1 shows
+// up. Parsing wraps the buffer in an external string, so the text is never
+// copied onto the heap.
+class V8_EXPORT_PRIVATE JsonUtf8Buffer {
+ public:
+  JsonUtf8Buffer() = default;
+  JsonUtf8Buffer(const JsonUtf8Buffer&) = delete;
+  JsonUtf8Buffer& operator=(const JsonUtf8Buffer&) = delete;
+
+  void Append(const uint8_t* data, size_t length);
+
+  // Parses the text appended so far and resets the buffer.
+  MaybeHandle<Object> Parse(Isolate* isolate);
+
+  bool is_one_byte() const { return is_one_byte_; }
+  size_t length() const {
+    return is_one_byte_ ? one_byte_chars_.size() : two_byte_chars_.size();
+  }
+
+ private:
+  void AddCharacter(unibrow::uchar c);
+  void AddTwoByteCharacter(base::uc16 c);
+  MaybeHandle<String> TakeString(Isolate* isolate);
+
+  unibrow::Utf8::State state_ = unibrow::Utf8::State::kAccept;
+  unibrow::Utf8::Utf8IncrementalBuffer incomplete_char_ = 0;
+  bool is_one_byte_ = true;
+  std::vector<uint8_t> one_byte_chars_;
+  std::vector<base::uc16> two_byte_chars_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_JSON_JSON_UTF8_BUFFER_H_
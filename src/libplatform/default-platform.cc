@@ -36,7 +36,7 @@ constexpr int kMaxThreadPoolSize = 16;
 int GetActualThreadPoolSize(int thread_pool_size) {
   DCHECK_GE(thread_pool_size, 0);
   if (thread_pool_size < 1) {
-    thread_pool_size = base::SysInfo::NumberOfProcessors() - 1;
+    thread_pool_size = base::SysInfo::NumberOfAvailableProcessors() - 1;
   }
   return std::max(std::min(thread_pool_size, kMaxThreadPoolSize), 1);
 }
@@ -46,13 +46,15 @@ int GetActualThreadPoolSize(int thread_pool_size) {
 std::unique_ptr<v8::Platform> NewDefaultPlatform(
     int thread_pool_size, IdleTaskSupport idle_task_support,
     InProcessStackDumping in_process_stack_dumping,
-    std::unique_ptr<v8::TracingController> tracing_controller) {
+    std::unique_ptr<v8::TracingController> tracing_controller,
+    PriorityMode priority_mode) {
   if (in_process_stack_dumping == InProcessStackDumping::kEnabled) {
     v8::base::debug::EnableInProcessStackDumping();
   }
   thread_pool_size = GetActualThreadPoolSize(thread_pool_size);
   auto platform = std::make_unique<DefaultPlatform>(
-      thread_pool_size, idle_task_support, std::move(tracing_controller));
+      thread_pool_size, idle_task_support, std::move(tracing_controller),
+      priority_mode);
   return platform;
 }
 
@@ -100,9 +102,11 @@ void NotifyIsolateShutdown(v8::Platform* platform, Isolate* isolate) {
 
 DefaultPlatform::DefaultPlatform(
     int thread_pool_size, IdleTaskSupport idle_task_support,
-    std::unique_ptr<v8::TracingController> tracing_controller)
+    std::unique_ptr<v8::TracingController> tracing_controller,
+    PriorityMode priority_mode)
     : thread_pool_size_(thread_pool_size),
       idle_task_support_(idle_task_support),
+      priority_mode_(priority_mode),
       tracing_controller_(std::move(tracing_controller)),
       page_allocator_(std::make_unique<v8::base::PageAllocator>()) {
   if (!tracing_controller_) {
@@ -138,9 +142,10 @@ void DefaultPlatform::EnsureBackgroundTaskRunnerInitialized() {
   DCHECK_NULL(worker_threads_task_runner_);
   worker_threads_task_runner_ =
       std::make_shared<DefaultWorkerThreadsTaskRunner>(
-          thread_pool_size_, time_function_for_testing_
-                                 ? time_function_for_testing_
-                                 : DefaultTimeFunction);
+          thread_pool_size_,
+          time_function_for_testing_ ? time_function_for_testing_
+                                     : DefaultTimeFunction,
+          priority_mode_ == PriorityMode::kApply);
   DCHECK_NOT_NULL(worker_threads_task_runner_);
 }
 
@@ -218,6 +223,20 @@ void DefaultPlatform::CallOnWorkerThread(std::unique_ptr<Task> task) {
   worker_threads_task_runner_->PostTask(std::move(task));
 }
 
+void DefaultPlatform::CallBlockingTaskOnWorkerThread(
+    std::unique_ptr<Task> task) {
+  DCHECK_NOT_NULL(worker_threads_task_runner_);
+  worker_threads_task_runner_->PostTask(std::move(task),
+                                        TaskPriority::kUserBlocking);
+}
+
+void DefaultPlatform::CallLowPriorityTaskOnWorkerThread(
+    std::unique_ptr<Task> task) {
+  DCHECK_NOT_NULL(worker_threads_task_runner_);
+  worker_threads_task_runner_->PostTask(std::move(task),
+                                        TaskPriority::kBestEffort);
+}
+
 void DefaultPlatform::CallDelayedOnWorkerThread(std::unique_ptr<Task> task,
                                                 double delay_in_seconds) {
   // If this DCHECK fires, then this means that either
@@ -4,44 +4,96 @@
 
 #include "src/libplatform/default-worker-threads-task-runner.h"
 
-#include "src/libplatform/delayed-task-queue.h"
+#include <limits>
+
+#include "src/base/logging.h"
+#include "src/base/platform/time.h"
 
 namespace v8 {
 namespace platform {
 
+namespace {
+
+constexpr double kNoDelayedTask = std::numeric_limits<double>::infinity();
+
+base::Thread::Priority ToThreadPriority(TaskPriority priority) {
+  switch (priority) {
+    case TaskPriority::kBestEffort:
+      return base::Thread::Priority::kBestEffort;
+    case TaskPriority::kUserVisible:
+      return base::Thread::Priority::kUserVisible;
+    case TaskPriority::kUserBlocking:
+      return base::Thread::Priority::kUserBlocking;
+  }
+  UNREACHABLE();
+}
+
+}  // namespace
+
 DefaultWorkerThreadsTaskRunner::DefaultWorkerThreadsTaskRunner(
-    uint32_t thread_pool_size, TimeFunction time_function)
-    : queue_(time_function), time_function_(time_function) {
+    uint32_t thread_pool_size, TimeFunction time_function, bool apply_priority)
+    : apply_priority_(apply_priority),
+      time_function_(time_function),
+      next_delayed_task_deadline_(kNoDelayedTask) {
+  for (std::atomic<int64_t>& count : queued_tasks_) count.store(0);
+  // All threads are created before any of them starts, since they steal from
+  // each other.
   for (uint32_t i = 0; i < thread_pool_size; ++i) {
-    thread_pool_.push_back(std::make_unique<WorkerThread>(this));
+    thread_pool_.push_back(std::make_unique<WorkerThread>(this, i));
   }
+  for (auto& thread : thread_pool_) CHECK(thread->Start());
 }
 
-DefaultWorkerThreadsTaskRunner::~DefaultWorkerThreadsTaskRunner() = default;
+DefaultWorkerThreadsTaskRunner::~DefaultWorkerThreadsTaskRunner() {
+  if (!terminated_.load()) Terminate();
+}
 
 double DefaultWorkerThreadsTaskRunner::MonotonicallyIncreasingTime() {
   return time_function_();
 }
 
 void DefaultWorkerThreadsTaskRunner::Terminate() {
-  base::MutexGuard guard(&lock_);
-  terminated_ = true;
-  queue_.Terminate();
-  // Clearing the thread pool lets all worker threads join.
+  {
+    base::MutexGuard guard(&lock_);
+    terminated_.store(true);
+    delayed_task_queue_.clear();
+    next_delayed_task_deadline_.store(kNoDelayedTask);
+    work_available_.NotifyAll();
+  }
+  // The workers finish the queued immediate tasks and return. Join all of
+  // them before destroying any, since they may still steal from each other.
+  for (auto& thread : thread_pool_) thread->Join();
   thread_pool_.clear();
 }
 
+void DefaultWorkerThreadsTaskRunner::PostTask(std::unique_ptr<Task> task,
+                                              TaskPriority priority) {
+  if (terminated_.load(std::memory_order_relaxed)) return;
+  int index = static_cast<int>(priority);
+  if (WorkerThread* worker = CurrentWorkerThread()) {
+    base::MutexGuard guard(&worker->local_lock_);
+    worker->local_queues_[index].push_back(std::move(task));
+  } else {
+    base::MutexGuard guard(&shared_queues_lock_);
+    shared_queues_[index].push_back(std::move(task));
+  }
+  NotifyTaskQueued(index);
+}
+
 void DefaultWorkerThreadsTaskRunner::PostTask(std::unique_ptr<Task> task) {
-  base::MutexGuard guard(&lock_);
-  if (terminated_) return;
-  queue_.Append(std::move(task));
+  PostTask(std::move(task), TaskPriority::kUserVisible);
 }
 
 void DefaultWorkerThreadsTaskRunner::PostDelayedTask(std::unique_ptr<Task> task,
                                                      double delay_in_seconds) {
+  DCHECK_GE(delay_in_seconds, 0.0);
+  double deadline = MonotonicallyIncreasingTime() + delay_in_seconds;
   base::MutexGuard guard(&lock_);
-  if (terminated_) return;
-  queue_.AppendDelayed(std::move(task), delay_in_seconds);
+  if (terminated_.load(std::memory_order_relaxed)) return;
+  delayed_task_queue_.emplace(deadline, std::move(task));
+  next_delayed_task_deadline_.store(delayed_task_queue_.begin()->first);
+  // Waiting workers need to adjust their timeout to the new deadline.
+  work_available_.NotifyOne();
 }
 
 void DefaultWorkerThreadsTaskRunner::PostIdleTask(
@@ -55,23 +107,164 @@ bool DefaultWorkerThreadsTaskRunner::IdleTasksEnabled() {
   return false;
 }
 
-std::unique_ptr<Task> DefaultWorkerThreadsTaskRunner::GetNext() {
-  return queue_.GetNext();
+// static
+DefaultWorkerThreadsTaskRunner::WorkerThread*&
+DefaultWorkerThreadsTaskRunner::CurrentWorkerThreadSlot() {
+  static thread_local WorkerThread* current = nullptr;
+  return current;
 }
 
-DefaultWorkerThreadsTaskRunner::WorkerThread::WorkerThread(
-    DefaultWorkerThreadsTaskRunner* runner)
-    : Thread(Options("V8 DefaultWorkerThreadsTaskRunner WorkerThread")),
-      runner_(runner) {
-  CHECK(Start());
+DefaultWorkerThreadsTaskRunner::WorkerThread*
+DefaultWorkerThreadsTaskRunner::CurrentWorkerThread() {
+  WorkerThread* current = CurrentWorkerThreadSlot();
+  return current != nullptr && current->runner_ == this ? current : nullptr;
+}
+
+void DefaultWorkerThreadsTaskRunner::NotifyTaskQueued(int priority) {
+  // Pairs with the increment of |idle_workers_| in GetNext(): either the
+  // worker going to sleep sees the new task, or this thread sees the worker.
+  queued_tasks_[priority].fetch_add(1);
+  if (idle_workers_.load() == 0) return;
+  base::MutexGuard guard(&lock_);
+  work_available_.NotifyOne();
+}
+
+bool DefaultWorkerThreadsTaskRunner::HasQueuedTasks() const {
+  for (const std::atomic<int64_t>& count : queued_tasks_) {
+    if (count.load() > 0) return true;
+  }
+  return false;
 }
 
-DefaultWorkerThreadsTaskRunner::WorkerThread::~WorkerThread() { Join(); }
+std::unique_ptr<Task> DefaultWorkerThreadsTaskRunner::GetNext(
+    WorkerThread* worker, TaskPriority* priority) {
+  for (;;) {
+    PromoteDueDelayedTasks();
+    if (std::unique_ptr<Task> task = TryGetImmediateTask(worker, priority)) {
+      return task;
+    }
+
+    base::MutexGuard guard(&lock_);
+    idle_workers_.fetch_add(1);
+    if (!HasQueuedTasks()) {
+      if (terminated_.load(std::memory_order_relaxed)) {
+        idle_workers_.fetch_sub(1);
+        return nullptr;
+      }
+      if (delayed_task_queue_.empty()) {
+        work_available_.Wait(&lock_);
+      } else {
+        double now = MonotonicallyIncreasingTime();
+        PromoteDueDelayedTasksLocked(now);
+        if (!HasQueuedTasks() && !delayed_task_queue_.empty()) {
+          // Wait for the next delayed task or a newly posted task. WaitFor()
+          // uses the real clock, not |time_function_|.
+          double wait_in_seconds = delayed_task_queue_.begin()->first - now;
+          bool notified = work_available_.WaitFor(
+              &lock_, base::TimeDelta::FromMicroseconds(
+                          base::TimeConstants::kMicrosecondsPerSecond *
+                          wait_in_seconds));
+          USE(notified);
+        }
+      }
+    }
+    idle_workers_.fetch_sub(1);
+  }
+}
+
+std::unique_ptr<Task> DefaultWorkerThreadsTaskRunner::TryGetImmediateTask(
+    WorkerThread* worker, TaskPriority* priority_out) {
+  for (int priority = kNumberOfPriorities - 1; priority >= 0; --priority) {
+    if (queued_tasks_[priority].load(std::memory_order_relaxed) <= 0) continue;
+    std::unique_ptr<Task> task;
+    {
+      base::MutexGuard guard(&worker->local_lock_);
+      TaskDeque& queue = worker->local_queues_[priority];
+      if (!queue.empty()) {
+        task = std::move(queue.front());
+        queue.pop_front();
+      }
+    }
+    if (!task) {
+      base::MutexGuard guard(&shared_queues_lock_);
+      TaskDeque& queue = shared_queues_[priority];
+      if (!queue.empty()) {
+        task = std::move(queue.front());
+        queue.pop_front();
+      }
+    }
+    if (!task) task = TrySteal(worker, priority);
+    if (task) {
+      queued_tasks_[priority].fetch_sub(1);
+      *priority_out = static_cast<TaskPriority>(priority);
+      return task;
+    }
+  }
+  return nullptr;
+}
+
+std::unique_ptr<Task> DefaultWorkerThreadsTaskRunner::TrySteal(
+    WorkerThread* thief, int priority) {
+  size_t size = thread_pool_.size();
+  for (size_t i = 1; i < size; ++i) {
+    WorkerThread* victim = thread_pool_[(thief->index_ + i) % size].get();
+    base::MutexGuard guard(&victim->local_lock_);
+    TaskDeque& queue = victim->local_queues_[priority];
+    if (queue.empty()) continue;
+    std::unique_ptr<Task> task = std::move(queue.back());
+    queue.pop_back();
+    return task;
+  }
+  return nullptr;
+}
+
+void DefaultWorkerThreadsTaskRunner::PromoteDueDelayedTasks() {
+  double deadline =
+      next_delayed_task_deadline_.load(std::memory_order_relaxed);
+  if (deadline == kNoDelayedTask) return;
+  double now = MonotonicallyIncreasingTime();
+  if (now < deadline) return;
+  base::MutexGuard guard(&lock_);
+  PromoteDueDelayedTasksLocked(now);
+}
+
+void DefaultWorkerThreadsTaskRunner::PromoteDueDelayedTasksLocked(double now) {
+  int index = static_cast<int>(TaskPriority::kUserVisible);
+  while (!delayed_task_queue_.empty() &&
+         delayed_task_queue_.begin()->first <= now) {
+    auto it = delayed_task_queue_.begin();
+    {
+      base::MutexGuard guard(&shared_queues_lock_);
+      shared_queues_[index].push_back(std::move(it->second));
+    }
+    delayed_task_queue_.erase(it);
+    queued_tasks_[index].fetch_add(1);
+    // |lock_| is held, so wake another worker directly.
+    if (idle_workers_.load() > 0) work_available_.NotifyOne();
+  }
+  next_delayed_task_deadline_.store(delayed_task_queue_.empty()
+                                        ? kNoDelayedTask
+                                        : delayed_task_queue_.begin()->first);
+}
+
+DefaultWorkerThreadsTaskRunner::WorkerThread::WorkerThread(
+    DefaultWorkerThreadsTaskRunner* runner, size_t index)
+    : Thread(Options("V8 DefaultWorkerThreadsTaskRunner WorkerThread")),
+      runner_(runner),
+      index_(index) {}
 
 void DefaultWorkerThreadsTaskRunner::WorkerThread::Run() {
-  while (std::unique_ptr<Task> task = runner_->GetNext()) {
+  CurrentWorkerThreadSlot() = this;
+  TaskPriority priority;
+  while (std::unique_ptr<Task> task = runner_->GetNext(this, &priority)) {
+    if (runner_->apply_priority_ &&
+        applied_priority_ != ToThreadPriority(priority)) {
+      applied_priority_ = ToThreadPriority(priority);
+      base::Thread::SetCurrentThreadPriority(applied_priority_);
+    }
     task->Run();
   }
+  CurrentWorkerThreadSlot() = nullptr;
 }
 
 }  // namespace platform
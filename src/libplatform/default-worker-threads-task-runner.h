@@ -5,25 +5,37 @@
 #ifndef V8_LIBPLATFORM_DEFAULT_WORKER_THREADS_TASK_RUNNER_H_
 #define V8_LIBPLATFORM_DEFAULT_WORKER_THREADS_TASK_RUNNER_H_
 
+#include <atomic>
+#include <deque>
+#include <map>
 #include <memory>
 #include <vector>
 
 #include "include/libplatform/libplatform-export.h"
 #include "include/v8-platform.h"
+#include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
 #include "src/base/platform/platform.h"
-#include "src/libplatform/delayed-task-queue.h"
 
 namespace v8 {
 namespace platform {
 
+// A pool of worker threads that schedules tasks by TaskPriority. Tasks posted
+// from outside the pool go to a shared queue per priority. Tasks posted from
+// one of the pool's threads, e.g. additional workers of a job, go to that
+// thread's own queues, which it drains first and from which idle threads
+// steal. A higher priority task always runs before a lower priority one that
+// is queued at the same time. If |apply_priority| is set, a worker applies the
+// priority of each task to its thread before running it, see
+// base::Thread::SetCurrentThreadPriority().
 class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
     : public NON_EXPORTED_BASE(TaskRunner) {
  public:
   using TimeFunction = double (*)();
 
   DefaultWorkerThreadsTaskRunner(uint32_t thread_pool_size,
-                                 TimeFunction time_function);
+                                 TimeFunction time_function,
+                                 bool apply_priority = false);
 
   ~DefaultWorkerThreadsTaskRunner() override;
 
@@ -31,7 +43,10 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
 
   double MonotonicallyIncreasingTime();
 
-  // v8::TaskRunner implementation.
+  // Posts an immediate task with the given |priority|. Thread-safe.
+  void PostTask(std::unique_ptr<Task> task, TaskPriority priority);
+
+  // v8::TaskRunner implementation. These tasks have TaskPriority::kUserVisible.
   void PostTask(std::unique_ptr<Task> task) override;
 
   void PostDelayedTask(std::unique_ptr<Task> task,
@@ -42,10 +57,15 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
   bool IdleTasksEnabled() override;
 
  private:
+  static constexpr int kNumberOfPriorities =
+      static_cast<int>(TaskPriority::kUserBlocking) + 1;
+
+  using TaskDeque = std::deque<std::unique_ptr<Task>>;
+
   class WorkerThread : public base::Thread {
    public:
-    explicit WorkerThread(DefaultWorkerThreadsTaskRunner* runner);
-    ~WorkerThread() override;
+    WorkerThread(DefaultWorkerThreadsTaskRunner* runner, size_t index);
+    ~WorkerThread() override = default;
 
     WorkerThread(const WorkerThread&) = delete;
     WorkerThread& operator=(const WorkerThread&) = delete;
@@ -54,18 +74,64 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
     void Run() override;
 
    private:
+    friend class DefaultWorkerThreadsTaskRunner;
+
     DefaultWorkerThreadsTaskRunner* runner_;
+    const size_t index_;
+    // The priority last applied to the thread, if the runner applies them.
+    base::Thread::Priority applied_priority_ = base::Thread::Priority::kDefault;
+    // Tasks posted from this thread. The thread itself takes them from the
+    // front, other threads steal from the back.
+    base::Mutex local_lock_;
+    TaskDeque local_queues_[kNumberOfPriorities];
   };
 
-  // Called by the WorkerThread. Gets the next take (delayed or immediate) to be
-  // executed. Blocks if no task is available.
-  std::unique_ptr<Task> GetNext();
-
-  bool terminated_ = false;
-  base::Mutex lock_;
-  DelayedTaskQueue queue_;
+  // The worker thread that is calling, of any runner. Thread-local storage
+  // is kept in a function so that no thread_local data is exported.
+  static WorkerThread*& CurrentWorkerThreadSlot();
+  // Returns the worker thread of this runner that is calling, if any.
+  WorkerThread* CurrentWorkerThread();
+
+  // Called by the WorkerThread. Gets the next task (delayed or immediate) to be
+  // executed and stores its priority in |priority|. Blocks if no task is
+  // available. Returns nullptr once the runner is terminated and no immediate
+  // tasks are left.
+  std::unique_ptr<Task> GetNext(WorkerThread* worker, TaskPriority* priority);
+
+  // Takes the highest priority task from |worker|'s own queues, the shared
+  // queues or another worker's queues, in this order for each priority.
+  std::unique_ptr<Task> TryGetImmediateTask(WorkerThread* worker,
+                                            TaskPriority* priority);
+  std::unique_ptr<Task> TrySteal(WorkerThread* thief, int priority);
+
+  // Moves delayed tasks whose deadline has passed to the shared queues.
+  void PromoteDueDelayedTasks();
+  void PromoteDueDelayedTasksLocked(double now);
+
+  // Counts a task that was just queued and wakes an idle worker.
+  void NotifyTaskQueued(int priority);
+  bool HasQueuedTasks() const;
+
+  std::atomic_bool terminated_{false};
+  const bool apply_priority_;
   std::vector<std::unique_ptr<WorkerThread>> thread_pool_;
   TimeFunction time_function_;
+
+  // The number of queued immediate tasks per priority. The counts may briefly
+  // be off by the tasks being queued or taken right now.
+  std::atomic<int64_t> queued_tasks_[kNumberOfPriorities];
+  std::atomic<int> idle_workers_{0};
+
+  // Guards the shared queues of immediate tasks.
+  base::Mutex shared_queues_lock_;
+  TaskDeque shared_queues_[kNumberOfPriorities];
+
+  // Guards the delayed tasks and the waiting of idle workers.
+  base::Mutex lock_;
+  base::ConditionVariable work_available_;
+  std::multimap<double, std::unique_ptr<Task>> delayed_task_queue_;
+  // The deadline of the first delayed task, or infinity.
+  std::atomic<double> next_delayed_task_deadline_;
 };
 
 }  // namespace platform
@@ -29,6 +29,15 @@
 
 #include <unistd.h>
 
+#if V8_OS_LINUX && defined(SIGEV_THREAD_ID)
+#include <time.h>
+#define USE_CPU_TIME_TIMER
+// Older C libraries do not name the thread id of a SIGEV_THREAD_ID event.
+#ifndef sigev_notify_thread_id
+#define sigev_notify_thread_id _sigev_un._tid
+#endif
+#endif  // V8_OS_LINUX && defined(SIGEV_THREAD_ID)
+
 #elif V8_OS_WIN || V8_OS_CYGWIN
 
 #include <windows.h>
@@ -192,11 +201,46 @@ bool AtomicGuard::is_success() const { return is_success_; }
 
 class Sampler::PlatformData {
  public:
-  PlatformData() : vm_tid_(pthread_self()) {}
+  PlatformData() : vm_tid_(pthread_self()) {
+#if defined(USE_CPU_TIME_TIMER)
+    vm_kernel_tid_ = static_cast<pid_t>(syscall(SYS_gettid));
+#endif
+  }
   pthread_t vm_tid() const { return vm_tid_; }
 
+#if defined(USE_CPU_TIME_TIMER)
+  pid_t vm_kernel_tid() const { return vm_kernel_tid_; }
+  bool has_cpu_time_timer() const { return has_cpu_time_timer_; }
+  timer_t cpu_time_timer() const { return cpu_time_timer_; }
+
+  // Creates a timer on the CPU time of the sampled thread that signals the
+  // thread with SIGPROF.
+  bool CreateCpuTimeTimer() {
+    DCHECK(!has_cpu_time_timer_);
+    clockid_t clock;
+    if (pthread_getcpuclockid(vm_tid_, &clock) != 0) return false;
+    struct sigevent event = {};
+    event.sigev_notify = SIGEV_THREAD_ID;
+    event.sigev_signo = SIGPROF;
+    event.sigev_notify_thread_id = vm_kernel_tid_;
+    has_cpu_time_timer_ = timer_create(clock, &event, &cpu_time_timer_) == 0;
+    return has_cpu_time_timer_;
+  }
+
+  void DeleteCpuTimeTimer() {
+    DCHECK(has_cpu_time_timer_);
+    timer_delete(cpu_time_timer_);
+    has_cpu_time_timer_ = false;
+  }
+#endif  // USE_CPU_TIME_TIMER
+
  private:
   pthread_t vm_tid_;
+#if defined(USE_CPU_TIME_TIMER)
+  pid_t vm_kernel_tid_;
+  bool has_cpu_time_timer_ = false;
+  timer_t cpu_time_timer_;
+#endif
 };
 
 void SamplerManager::AddSampler(Sampler* sampler) {
@@ -557,6 +601,7 @@ void Sampler::Start() {
 }
 
 void Sampler::Stop() {
+  StopCpuTimeSampling();
 #if defined(USE_SIGNALS)
   SamplerManager::instance()->RemoveSampler(this);
   SignalHandler::DecreaseSamplerCount();
@@ -570,6 +615,7 @@ void Sampler::Stop() {
 void Sampler::DoSample() {
   if (!SignalHandler::Installed()) return;
   DCHECK(IsActive());
+  if (IsCpuTimeSampling()) return;
   SetShouldRecordSample();
   pthread_kill(platform_data()->vm_tid(), SIGPROF);
 }
@@ -657,5 +703,44 @@ void Sampler::DoSample() {
 
 #endif  // USE_SIGNALS
 
+#if defined(USE_CPU_TIME_TIMER)
+
+bool Sampler::StartCpuTimeSampling(base::TimeDelta interval) {
+  DCHECK(IsActive());
+  PlatformData* data = platform_data();
+  if (!data->has_cpu_time_timer() && !data->CreateCpuTimeTimer()) {
+    return false;
+  }
+  struct itimerspec spec;
+  spec.it_interval = std::max(interval, base::TimeDelta::FromMicroseconds(1))
+                         .ToTimespec();
+  spec.it_value = spec.it_interval;
+  if (timer_settime(data->cpu_time_timer(), 0, &spec, nullptr) != 0) {
+    StopCpuTimeSampling();
+    return false;
+  }
+  cpu_time_sampling_.store(true, std::memory_order_relaxed);
+  return true;
+}
+
+void Sampler::StopCpuTimeSampling() {
+  // A signal of the timer that is still pending finds the bit cleared and
+  // takes no sample.
+  cpu_time_sampling_.store(false, std::memory_order_relaxed);
+  PlatformData* data = platform_data();
+  if (data->has_cpu_time_timer()) data->DeleteCpuTimeTimer();
+}
+
+#else
+
+bool Sampler::StartCpuTimeSampling(base::TimeDelta interval) {
+  DCHECK(IsActive());
+  return false;
+}
+
+void Sampler::StopCpuTimeSampling() {}
+
+#endif  // USE_CPU_TIME_TIMER
+
 }  // namespace sampler
 }  // namespace v8
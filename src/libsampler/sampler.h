@@ -12,6 +12,7 @@
 
 #include "src/base/lazy-instance.h"
 #include "src/base/macros.h"
+#include "src/base/platform/time.h"
 
 #if V8_OS_POSIX && !V8_OS_CYGWIN && !V8_OS_FUCHSIA
 #define USE_SIGNALS
@@ -55,13 +56,28 @@ class V8_EXPORT_PRIVATE Sampler {
   bool IsActive() const { return active_.load(std::memory_order_relaxed); }
 
   // Returns true and consumes the pending sample bit if a sample should be
-  // dispatched to this sampler.
+  // dispatched to this sampler. Every signal of the CPU time timer is.
   bool ShouldRecordSample() {
-    return record_sample_.exchange(false, std::memory_order_relaxed);
+    return record_sample_.exchange(false, std::memory_order_relaxed) ||
+           IsCpuTimeSampling();
   }
 
+  // Signals the sampled thread to take a sample. Does nothing while the CPU
+  // time timer samples the thread.
   void DoSample();
 
+  // Samples the thread that created the sampler each time it has run for
+  // |interval| of CPU time, from a timer whose signals go to that thread
+  // itself. Samples are then taken in proportion to the thread's on-CPU time,
+  // without a thread that signals it. Calling it again changes the interval.
+  // Only supported on Linux; returns false if the timer is not available, in
+  // which case DoSample() still has to be called. Requires an active sampler.
+  bool StartCpuTimeSampling(base::TimeDelta interval);
+  void StopCpuTimeSampling();
+  bool IsCpuTimeSampling() const {
+    return cpu_time_sampling_.load(std::memory_order_relaxed);
+  }
+
   // Used in tests to make sure that stack sampling is performed.
   unsigned js_sample_count() const { return js_sample_count_; }
   unsigned external_sample_count() const { return external_sample_count_; }
@@ -91,6 +107,7 @@ class V8_EXPORT_PRIVATE Sampler {
   Isolate* isolate_;
   std::atomic_bool active_{false};
   std::atomic_bool record_sample_{false};
+  std::atomic_bool cpu_time_sampling_{false};
   std::unique_ptr<PlatformData> data_;  // Platform specific data.
   DISALLOW_IMPLICIT_CONSTRUCTORS(Sampler);
 };
@@ -100,6 +100,9 @@ namespace internal {
   HR(wasm_catch_count, V8.WasmCatchCount, 0, 100000, 30)                       \
   /* Ticks observed in a single Turbofan compilation, in 1K */                 \
   HR(turbofan_ticks, V8.TurboFan1KTicks, 0, 100000, 200)                       \
+  /* Jobs waiting in the concurrent recompilation queue on enqueue */          \
+  HR(turbofan_optimize_queue_length, V8.TurboFanOptimizeQueueLength, 0, 100,   \
+     101)                                                                      \
   /* Backtracks observed in a single regexp interpreter execution */           \
   /* The maximum of 100M backtracks takes roughly 2 seconds on my machine. */  \
   HR(regexp_backtracks, V8.RegExpBacktracks, 1, 100000000, 50)                 \
@@ -178,6 +181,8 @@ namespace internal {
      V8.TurboFanOptimizeNonConcurrentTotalTime, 10000000, MICROSECOND)         \
   HT(turbofan_optimize_concurrent_total_time,                                  \
      V8.TurboFanOptimizeConcurrentTotalTime, 10000000, MICROSECOND)            \
+  HT(turbofan_optimize_queue_wait_time, V8.TurboFanOptimizeQueueWaitTime,      \
+     10000000, MICROSECOND)                                                    \
   HT(turbofan_osr_prepare, V8.TurboFanOptimizeForOnStackReplacementPrepare,    \
      1000000, MICROSECOND)                                                     \
   HT(turbofan_osr_execute, V8.TurboFanOptimizeForOnStackReplacementExecute,    \
@@ -186,6 +191,11 @@ namespace internal {
      1000000, MICROSECOND)                                                     \
   HT(turbofan_osr_total_time,                                                  \
      V8.TurboFanOptimizeForOnStackReplacementTotalTime, 10000000, MICROSECOND) \
+  /* Deoptimization timers. */                                                 \
+  HT(deoptimize_compute_output_frames,                                         \
+     V8.DeoptimizeComputeOutputFramesMicroSeconds, 1000000, MICROSECOND)       \
+  HT(deoptimize_materialize_objects,                                           \
+     V8.DeoptimizeMaterializeObjectsMicroSeconds, 1000000, MICROSECOND)        \
   /* Wasm timers. */                                                           \
   HT(wasm_compile_asm_module_time, V8.WasmCompileModuleMicroSeconds.asm,       \
      10000000, MICROSECOND)                                                    \
@@ -217,6 +227,13 @@ namespace internal {
      MILLISECOND)                                                              \
   HT(wasm_time_between_catch, V8.WasmTimeBetweenCatchMilliseconds, 1000,       \
      MILLISECOND)                                                              \
+  /* RegExp timers. */                                                         \
+  HT(regexp_compile_bytecode_time, V8.RegExpCompileBytecodeMicroSeconds,       \
+     1000000, MICROSECOND)                                                     \
+  HT(regexp_compile_native_time, V8.RegExpCompileNativeMicroSeconds, 1000000,  \
+     MICROSECOND)                                                              \
+  HT(regexp_execute_runtime_time, V8.RegExpExecuteRuntimeMicroSeconds,         \
+     10000000, MICROSECOND)                                                    \
   /* Total compilation time incl. caching/parsing for various cache states. */ \
   HT(compile_script_with_produce_cache,                                        \
      V8.CompileScriptMicroSeconds.ProduceCache, 1000000, MICROSECOND)          \
@@ -283,6 +300,11 @@ namespace internal {
   SC(inlined_copied_elements, V8.InlinedCopiedElements)            \
   SC(compilation_cache_hits, V8.CompilationCacheHits)              \
   SC(compilation_cache_misses, V8.CompilationCacheMisses)          \
+  /* Background compiles of lazy functions that finished before the\
+     first call, did not, or were thrown away. */                 \
+  SC(lazy_dispatcher_hits, V8.LazyCompileDispatcherHits)          \
+  SC(lazy_dispatcher_misses, V8.LazyCompileDispatcherMisses)      \
+  SC(lazy_dispatcher_wasted, V8.LazyCompileDispatcherWasted)      \
   /* Amount of evaled source code. */                              \
   SC(total_eval_size, V8.TotalEvalSize)                            \
   /* Amount of loaded source code. */                              \
@@ -312,6 +334,7 @@ namespace internal {
      V8.GCCompactorCausedByOldspaceExhaustion)                                 \
   SC(gc_last_resort_from_js, V8.GCLastResortFromJS)                            \
   SC(gc_last_resort_from_handles, V8.GCLastResortFromHandles)                  \
+  SC(gc_ephemeron_linear_fallback, V8.GCEphemeronLinearFallback)               \
   SC(cow_arrays_converted, V8.COWArraysConverted)                              \
   SC(constructed_objects_runtime, V8.ConstructedObjectsRuntime)                \
   SC(megamorphic_stub_cache_updates, V8.MegamorphicStubCacheUpdates)           \
@@ -343,10 +366,13 @@ namespace internal {
   /* Total count of functions compiled using the baseline compiler. */         \
   SC(total_baseline_compile_count, V8.TotalBaselineCompileCount)
 
-#define STATS_COUNTER_TS_LIST(SC)                         \
-  SC(wasm_generated_code_size, V8.WasmGeneratedCodeBytes) \
-  SC(wasm_reloc_size, V8.WasmRelocBytes)                  \
-  SC(wasm_lazily_compiled_functions, V8.WasmLazilyCompiledFunctions)
+#define STATS_COUNTER_TS_LIST(SC)                                    \
+  SC(wasm_generated_code_size, V8.WasmGeneratedCodeBytes)            \
+  SC(wasm_reloc_size, V8.WasmRelocBytes)                             \
+  SC(wasm_lazily_compiled_functions, V8.WasmLazilyCompiledFunctions) \
+  /* Allocations removed from TurboFan graphs by escape analysis. */ \
+  SC(turbofan_escape_analysis_eliminated_allocations,                \
+     V8.TurboFanEscapeAnalysisEliminatedAllocations)
 
 // List of counters that can be incremented from generated code. We need them in
 // a separate list to be able to relocate them.
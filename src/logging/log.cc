@@ -19,6 +19,7 @@
 #include "src/codegen/macro-assembler.h"
 #include "src/codegen/source-position-table.h"
 #include "src/deoptimizer/deoptimizer.h"
+#include "src/diagnostics/perf-file-writer.h"
 #include "src/diagnostics/perf-jit.h"
 #include "src/execution/isolate.h"
 #include "src/execution/runtime-profiler.h"
@@ -307,6 +308,7 @@ class PerfBasicLogger : public CodeEventLogger {
   static const int kFilenameBufferPadding;
 
   FILE* perf_output_handle_;
+  std::unique_ptr<PerfFileWriter> perf_output_writer_;
 };
 
 const char PerfBasicLogger::kFilenameFormatString[] = "/tmp/perf-%d.map";
@@ -324,10 +326,16 @@ PerfBasicLogger::PerfBasicLogger(Isolate* isolate)
   perf_output_handle_ =
       base::OS::FOpen(perf_dump_name.begin(), base::OS::LogFileOpenMode);
   CHECK_NOT_NULL(perf_output_handle_);
-  setvbuf(perf_output_handle_, nullptr, _IOLBF, 0);
+  // The background writer flushes every batch it writes.
+  if (!FLAG_perf_prof_async_writer) {
+    setvbuf(perf_output_handle_, nullptr, _IOLBF, 0);
+  }
+  perf_output_writer_ = std::make_unique<PerfFileWriter>(
+      perf_output_handle_, FLAG_perf_prof_async_writer);
 }
 
 PerfBasicLogger::~PerfBasicLogger() {
+  perf_output_writer_.reset();
   base::Fclose(perf_output_handle_);
   perf_output_handle_ = nullptr;
 }
@@ -341,8 +349,12 @@ void PerfBasicLogger::WriteLogRecordedBuffer(uintptr_t address, int size,
   //
   // Instead, we use V8PRIxPTR format string and cast pointer to uintpr_t,
   // so that we have control over the exact output format.
-  base::OS::FPrint(perf_output_handle_, "%" V8PRIxPTR " %x %.*s\n", address,
-                   size, name_length, name);
+  base::EmbeddedVector<char, 64> prefix;
+  int prefix_length = SNPrintF(prefix, "%" V8PRIxPTR " %x ", address, size);
+  CHECK_GT(prefix_length, 0);
+  perf_output_writer_->Write(prefix.begin(), prefix_length);
+  perf_output_writer_->Write(name, name_length);
+  perf_output_writer_->Write("\n", 1);
 }
 
 void PerfBasicLogger::LogRecordedBuffer(Handle<AbstractCode> code,
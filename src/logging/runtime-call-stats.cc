@@ -6,8 +6,10 @@
 
 #include "src/logging/runtime-call-stats.h"
 
+#include <algorithm>
 #include <iomanip>
 
+#include "include/v8-metrics.h"
 #include "src/tracing/tracing-category-observer.h"
 #include "src/utils/ostreams.h"
 
@@ -130,7 +132,10 @@ void RuntimeCallTimer::Snapshot() {
 }
 
 RuntimeCallStats::RuntimeCallStats(ThreadType thread_type)
-    : in_use_(false), thread_type_(thread_type) {
+    : in_use_(false),
+      sampling_rate_(std::max(1, FLAG_rcs_sampling_rate)),
+      sampling_countdown_(sampling_rate_),
+      thread_type_(thread_type) {
   static const char* const kNames[] = {
 #define CALL_BUILTIN_COUNTER(name) "GC_" #name,
       FOR_EACH_GC_COUNTER(CALL_BUILTIN_COUNTER)  //
@@ -199,15 +204,29 @@ bool RuntimeCallStats::IsBackgroundThreadSpecificVariant(
 void RuntimeCallStats::Enter(RuntimeCallTimer* timer,
                              RuntimeCallCounterId counter_id) {
   DCHECK(IsCalledOnTheSameThread());
+  if (V8_UNLIKELY(sampling_rate_ > 1) && current_timer() == nullptr) {
+    // Sampling decides on whole trees of nested timers, so that every timer
+    // is sampled at the same rate and the own time of a sampled timer never
+    // includes the time of skipped children.
+    if (unsampled_depth_ > 0 || --sampling_countdown_ > 0) {
+      unsampled_depth_++;
+      return;
+    }
+    sampling_countdown_ = sampling_rate_;
+  }
   RuntimeCallCounter* counter = GetCounter(counter_id);
   DCHECK_NOT_NULL(counter->name());
-  timer->Start(counter, current_timer());
+  timer->Start(counter, current_timer(), sampling_rate_);
   current_timer_.SetValue(timer);
   current_counter_.SetValue(counter);
 }
 
 void RuntimeCallStats::Leave(RuntimeCallTimer* timer) {
   DCHECK(IsCalledOnTheSameThread());
+  if (V8_UNLIKELY(unsampled_depth_ > 0)) {
+    unsampled_depth_--;
+    return;
+  }
   RuntimeCallTimer* stack_top = current_timer();
   if (stack_top == nullptr) return;  // Missing timer is a result of Reset().
   CHECK(stack_top == timer);
@@ -285,6 +304,19 @@ void RuntimeCallStats::Dump(v8::tracing::TracedValue* value) {
   in_use_ = false;
 }
 
+void RuntimeCallStats::GetEntries(
+    std::vector<v8::metrics::RuntimeCallStatsEntry>* entries) {
+  if (current_timer_.Value() != nullptr) {
+    current_timer_.Value()->Snapshot();
+  }
+  for (int i = 0; i < kNumberOfCounters; i++) {
+    RuntimeCallCounter* counter = GetCounter(i);
+    if (counter->count() == 0) continue;
+    entries->push_back({counter->name(), counter->count(),
+                        counter->time().InMicroseconds()});
+  }
+}
+
 WorkerThreadRuntimeCallStats::WorkerThreadRuntimeCallStats()
     : isolate_thread_id_(ThreadId::Current()) {}
 
@@ -23,6 +23,11 @@
 #endif  // V8_RUNTIME_CALL_STATS
 
 namespace v8 {
+
+namespace metrics {
+struct RuntimeCallStatsEntry;
+}  // namespace metrics
+
 namespace internal {
 
 #ifdef V8_RUNTIME_CALL_STATS
@@ -41,7 +46,7 @@ class RuntimeCallCounter final {
   base::TimeDelta time() const {
     return base::TimeDelta::FromMicroseconds(time_);
   }
-  void Increment() { count_++; }
+  void Increment(int64_t count = 1) { count_ += count; }
   void Add(base::TimeDelta delta) { time_ += delta.InMicroseconds(); }
 
  private:
@@ -65,10 +70,14 @@ class RuntimeCallTimer final {
 
   inline bool IsStarted() const { return start_ticks_ != base::TimeTicks(); }
 
-  inline void Start(RuntimeCallCounter* counter, RuntimeCallTimer* parent) {
+  // The counter's count and time are incremented |weight| times, which is
+  // the sampling rate for sampled timers.
+  inline void Start(RuntimeCallCounter* counter, RuntimeCallTimer* parent,
+                    int weight = 1) {
     DCHECK(!IsStarted());
     counter_ = counter;
     parent_.SetValue(parent);
+    weight_ = weight;
     if (TracingFlags::runtime_stats.load(std::memory_order_relaxed) ==
         v8::tracing::TracingCategoryObserver::ENABLED_BY_SAMPLING) {
       return;
@@ -85,7 +94,7 @@ class RuntimeCallTimer final {
     if (!IsStarted()) return parent();
     base::TimeTicks now = RuntimeCallTimer::Now();
     Pause(now);
-    counter_->Increment();
+    counter_->Increment(weight_);
     CommitTimeToCounter();
 
     RuntimeCallTimer* parent_timer = parent();
@@ -114,7 +123,7 @@ class RuntimeCallTimer final {
   }
 
   inline void CommitTimeToCounter() {
-    counter_->Add(elapsed_);
+    counter_->Add(elapsed_ * weight_);
     elapsed_ = base::TimeDelta();
   }
 
@@ -122,6 +131,7 @@ class RuntimeCallTimer final {
   base::AtomicValue<RuntimeCallTimer*> parent_;
   base::TimeTicks start_ticks_;
   base::TimeDelta elapsed_;
+  int weight_ = 1;
 };
 
 #define FOR_EACH_GC_COUNTER(V) \
@@ -196,6 +206,7 @@ class RuntimeCallTimer final {
   V(Object_DeleteProperty)                                 \
   V(Object_ForceSet)                                       \
   V(Object_Get)                                            \
+  V(Object_GetMultiple)                                    \
   V(Object_GetOwnPropertyDescriptor)                       \
   V(Object_GetOwnPropertyNames)                            \
   V(Object_GetPropertyAttributes)                          \
@@ -215,10 +226,12 @@ class RuntimeCallTimer final {
   V(Object_Set)                                            \
   V(Object_SetAccessor)                                    \
   V(Object_SetIntegrityLevel)                              \
+  V(Object_SetMultiple)                                    \
   V(Object_SetPrivate)                                     \
   V(Object_SetPrototype)                                   \
   V(ObjectTemplate_New)                                    \
   V(ObjectTemplate_NewInstance)                            \
+  V(ObjectTemplate_NewInstanceWithInternalFields)          \
   V(Object_ToArrayIndex)                                   \
   V(Object_ToBigInt)                                       \
   V(Object_ToDetailString)                                 \
@@ -346,8 +359,10 @@ class RuntimeCallTimer final {
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, LateOptimization)                \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, LoadElimination)                 \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, LocateSpillSlots)                \
+  ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, LoopCheckHoisting)               \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, LoopExitElimination)             \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, LoopPeeling)                     \
+  ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, LoopVectorizationAnalysis)       \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, MachineOperatorOptimization)     \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, MeetRegisterConstraints)         \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, MemoryOptimization)              \
@@ -480,6 +495,7 @@ class RuntimeCallTimer final {
   V(WebSnapshotDeserialize_Exports)            \
   V(WebSnapshotDeserialize_Functions)          \
   V(WebSnapshotDeserialize_Classes)            \
+  V(WebSnapshotDeserialize_Collections)        \
   V(WebSnapshotDeserialize_Maps)               \
   V(WebSnapshotDeserialize_Objects)            \
   V(WebSnapshotDeserialize_Strings)
@@ -598,6 +614,13 @@ class RuntimeCallStats final {
   V8_EXPORT_PRIVATE void Print(std::ostream& os);
   V8_EXPORT_PRIVATE void Print();
   V8_NOINLINE void Dump(v8::tracing::TracedValue* value);
+  // Appends an entry for each counter that was entered to |entries|.
+  V8_EXPORT_PRIVATE void GetEntries(
+      std::vector<v8::metrics::RuntimeCallStatsEntry>* entries);
+
+  // With --rcs-sampling-rate, only every sampling_rate() outermost timer is
+  // started, including all timers nested in it.
+  int sampling_rate() const { return sampling_rate_; }
 
   ThreadId thread_id() const { return thread_id_; }
   RuntimeCallTimer* current_timer() { return current_timer_.Value(); }
@@ -647,6 +670,11 @@ class RuntimeCallStats final {
   base::AtomicValue<RuntimeCallCounter*> current_counter_;
   // Used to track nested tracing scopes.
   bool in_use_;
+  const int sampling_rate_;
+  // Number of outermost timers until the next one is sampled.
+  int sampling_countdown_;
+  // Depth of the skipped timers, if the outermost timer was not sampled.
+  int unsampled_depth_ = 0;
   ThreadType thread_type_;
   ThreadId thread_id_;
   RuntimeCallCounter counters_[kNumberOfCounters];
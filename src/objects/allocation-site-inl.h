@@ -113,6 +113,22 @@ void AllocationSite::SetDoNotInlineCall() {
   set_transition_info(DoNotInlineBit::update(transition_info(), true));
 }
 
+int AllocationSite::GetCapacityHint() const {
+  return CapacityHintBits::decode(transition_info());
+}
+
+void AllocationSite::DigestCapacityFeedback(uint32_t capacity) {
+  if (PointsToLiteral()) return;
+  int hint = static_cast<int>(
+      std::min(capacity, static_cast<uint32_t>(kMaximumCapacityHint)));
+  if (hint <= GetCapacityHint()) return;
+  if (FLAG_trace_track_allocation_sites) {
+    PrintF("AllocationSite: JSArray %p capacity hint %d->%d\n",
+           reinterpret_cast<void*>(ptr()), GetCapacityHint(), hint);
+  }
+  set_transition_info(CapacityHintBits::update(transition_info(), hint));
+}
+
 bool AllocationSite::PointsToLiteral() const {
   Object raw_value = transition_info_or_boilerplate(kAcquireLoad);
   DCHECK_EQ(!raw_value.IsSmi(),
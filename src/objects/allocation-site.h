@@ -72,7 +72,12 @@ class AllocationSite : public Struct {
   // transition_info bitfields, for constructed array transition info.
   using ElementsKindBits = base::BitField<ElementsKind, 0, 6>;
   using DoNotInlineBit = base::BitField<bool, 6, 1>;
-  // Unused bits 7-30.
+  using CapacityHintBits = base::BitField<int, 7, 11>;
+  // Unused bits 18-30.
+
+  // Upper bound for the backing store capacity remembered for arrays created
+  // from this site.
+  static const int kMaximumCapacityHint = CapacityHintBits::kMax;
 
   // Bitfields for pretenure_data
   using MementoFoundCountBits = base::BitField<int, 0, 26>;
@@ -127,6 +132,11 @@ class AllocationSite : public Struct {
   inline bool CanInlineCall() const;
   inline void SetDoNotInlineCall();
 
+  // The largest capacity that an array created from this site has grown its
+  // elements to, used to preallocate the elements of later arrays.
+  inline int GetCapacityHint() const;
+  inline void DigestCapacityFeedback(uint32_t capacity);
+
   inline bool PointsToLiteral() const;
 
   template <AllocationSiteUpdateMode update_or_check =
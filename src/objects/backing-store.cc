@@ -507,6 +507,8 @@ std::unique_ptr<BackingStore> BackingStore::TryAllocateAndPartiallyCommitMemory(
       result, result->buffer_start(), byte_length, byte_capacity,
       reservation_size);
 
+  result->committed_byte_length_.store(committed_byte_length,
+                                       std::memory_order_relaxed);
   return std::unique_ptr<BackingStore>(result);
 }
 
@@ -692,10 +694,18 @@ BackingStore::ResizeOrGrowResult BackingStore::ResizeInPlace(
     return kSuccess;
   }
 
-  // Try to adjust the permissions on the memory.
-  if (!i::SetPermissions(GetPlatformPageAllocator(), buffer_start_,
-                         new_committed_length, PageAllocator::kReadWrite)) {
-    return kFailure;
+  // Pages stay committed when the buffer shrinks, so growing it back within
+  // the committed length needs no permission change.
+  size_t committed_byte_length =
+      committed_byte_length_.load(std::memory_order_relaxed);
+  if (new_committed_length > committed_byte_length) {
+    // Try to adjust the permissions on the memory.
+    if (!i::SetPermissions(GetPlatformPageAllocator(), buffer_start_,
+                           new_committed_length, PageAllocator::kReadWrite)) {
+      return kFailure;
+    }
+    committed_byte_length_.store(new_committed_length,
+                                 std::memory_order_relaxed);
   }
 
   // Do per-isolate accounting for non-shared backing stores.
@@ -732,10 +742,23 @@ BackingStore::ResizeOrGrowResult BackingStore::GrowInPlace(
       return kSuccess;
     }
 
-    // Try to adjust the permissions on the memory.
-    if (!i::SetPermissions(GetPlatformPageAllocator(), buffer_start_,
-                           new_committed_length, PageAllocator::kReadWrite)) {
-      return kFailure;
+    // Only commit the pages if no other grow did so already. A racing grow
+    // may still commit an overlapping range, which is harmless.
+    size_t committed_byte_length =
+        committed_byte_length_.load(std::memory_order_seq_cst);
+    if (new_committed_length > committed_byte_length) {
+      // Try to adjust the permissions on the memory.
+      if (!i::SetPermissions(GetPlatformPageAllocator(), buffer_start_,
+                             new_committed_length,
+                             PageAllocator::kReadWrite)) {
+        return kFailure;
+      }
+      // compare_exchange_weak updates committed_byte_length.
+      while (committed_byte_length < new_committed_length &&
+             !committed_byte_length_.compare_exchange_weak(
+                 committed_byte_length, new_committed_length,
+                 std::memory_order_seq_cst)) {
+      }
     }
 
     // compare_exchange_weak updates old_byte_length.
@@ -172,6 +172,9 @@ class V8_EXPORT_PRIVATE BackingStore : public BackingStoreBase {
 
   void* buffer_start_ = nullptr;
   std::atomic<size_t> byte_length_;
+  // For resizable backing stores, the length of the prefix of the reservation
+  // that is read-write. Pages are never decommitted, so it only grows.
+  std::atomic<size_t> committed_byte_length_{0};
   // Max byte length of the corresponding JSArrayBuffer(s).
   size_t max_byte_length_;
   // Amount of the memory allocated
@@ -9,6 +9,7 @@
 #include "src/execution/isolate-inl.h"
 #include "src/init/bootstrapper.h"
 #include "src/objects/module-inl.h"
+#include "src/objects/property-cell.h"
 #include "src/objects/string-set-inl.h"
 
 namespace v8 {
@@ -498,6 +499,72 @@ bool Context::IsBootstrappingOrValidParentContext(Object object,
 
 #endif
 
+// static
+void NativeContext::AddConstTrackingLetCells(
+    Isolate* isolate, Handle<NativeContext> native_context, int context_index,
+    Handle<Context> script_context) {
+  DCHECK(FLAG_const_tracking_let);
+  DCHECK(script_context->IsScriptContext());
+  Handle<ScopeInfo> scope_info(script_context->scope_info(), isolate);
+  // REPL mode lets can be redeclared and are initialized through the script
+  // context table, so they are never tracked.
+  if (scope_info->IsReplModeScope()) return;
+  int header = scope_info->ContextHeaderLength();
+  Handle<FixedArray> cells;
+  for (int var = 0; var < scope_info->ContextLocalCount(); var++) {
+    if (scope_info->ContextLocalMode(var) != VariableMode::kLet) continue;
+    if (cells.is_null()) {
+      cells = isolate->factory()->NewFixedArray(script_context->length());
+      for (int i = 0; i < cells->length(); i++) cells->set(i, Smi::zero());
+    }
+    cells->set(header + var, *isolate->factory()->NewProtector());
+  }
+  if (cells.is_null()) return;
+
+  Handle<FixedArray> table(native_context->const_tracking_let_cells(),
+                           isolate);
+  if (table->length() <= context_index) {
+    int old_length = table->length();
+    table = isolate->factory()->CopyFixedArrayAndGrow(
+        table, context_index + 1 - old_length);
+    for (int i = old_length; i < table->length(); i++) {
+      table->set(i, Smi::zero());
+    }
+  }
+  table->set(context_index, *cells);
+  native_context->set_const_tracking_let_cells(*table);
+}
+
+Object NativeContext::ConstTrackingLetCell(int context_index,
+                                           int slot_index) const {
+  FixedArray table =
+      FixedArray::cast(get(CONST_TRACKING_LET_CELLS_INDEX, kAcquireLoad));
+  if (context_index >= table.length()) return Smi::zero();
+  Object cells = table.get(context_index);
+  if (cells.IsSmi()) return Smi::zero();
+  if (slot_index >= FixedArray::cast(cells).length()) return Smi::zero();
+  return FixedArray::cast(cells).get(slot_index);
+}
+
+void NativeContext::InvalidateConstTrackingLet(int context_index,
+                                               int slot_index) {
+  Object cell = ConstTrackingLetCell(context_index, slot_index);
+  if (cell.IsSmi()) return;
+  PropertyCell::cast(cell).InvalidateProtector();
+}
+
+void NativeContext::InvalidateConstTrackingLet(Context script_context,
+                                               int slot_index) {
+  DCHECK(script_context.IsScriptContext());
+  ScriptContextTable table = script_context_table();
+  for (int i = 0; i < table.used(kAcquireLoad); i++) {
+    if (table.get_context(i) == script_context) {
+      InvalidateConstTrackingLet(i, slot_index);
+      return;
+    }
+  }
+}
+
 void NativeContext::ResetErrorsThrown() { set_errors_thrown(Smi::FromInt(0)); }
 
 void NativeContext::IncrementErrorsThrown() {
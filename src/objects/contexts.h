@@ -108,6 +108,7 @@ enum ContextLookupFlags {
   V(CALL_ASYNC_MODULE_FULFILLED, JSFunction, call_async_module_fulfilled)      \
   V(CALL_ASYNC_MODULE_REJECTED, JSFunction, call_async_module_rejected)        \
   V(CALLSITE_FUNCTION_INDEX, JSFunction, callsite_function)                    \
+  V(CONST_TRACKING_LET_CELLS_INDEX, FixedArray, const_tracking_let_cells)      \
   V(CONTEXT_EXTENSION_FUNCTION_INDEX, JSFunction, context_extension_function)  \
   V(DATA_PROPERTY_DESCRIPTOR_MAP_INDEX, Map, data_property_descriptor_map)     \
   V(DATA_VIEW_FUN_INDEX, JSFunction, data_view_fun)                            \
@@ -341,6 +342,7 @@ enum ContextLookupFlags {
   V(RANGE_ERROR_FUNCTION_INDEX, JSFunction, range_error_function)              \
   V(REFERENCE_ERROR_FUNCTION_INDEX, JSFunction, reference_error_function)      \
   V(SET_ADD_INDEX, JSFunction, set_add)                                        \
+  V(SHARED_FEEDBACK_CELLS_INDEX, HeapObject, shared_feedback_cells)            \
   V(SET_DELETE_INDEX, JSFunction, set_delete)                                  \
   V(SET_HAS_INDEX, JSFunction, set_has)                                        \
   V(SYNTAX_ERROR_FUNCTION_INDEX, JSFunction, syntax_error_function)            \
@@ -712,6 +714,23 @@ class NativeContext : public Context {
       ScriptContextTable script_context_table);
   inline ScriptContextTable synchronized_script_context_table() const;
 
+  // With --const-tracking-let, every script-scope let binding has a
+  // protector-like cell that stays valid until the binding is assigned after
+  // its initialization. The cells are kept per index in the script context
+  // table, as a FixedArray indexed by context slot that holds Smi zero for
+  // untracked slots.
+  static void AddConstTrackingLetCells(Isolate* isolate,
+                                       Handle<NativeContext> native_context,
+                                       int context_index,
+                                       Handle<Context> script_context);
+  // Returns the cell for the given slot, or Smi zero if it is not tracked.
+  // Safe to call from background threads.
+  Object ConstTrackingLetCell(int context_index, int slot_index) const;
+  // Invalidates the cell for the given slot, deoptimizing code that folded
+  // the binding. Must be called before the new value is stored.
+  void InvalidateConstTrackingLet(int context_index, int slot_index);
+  void InvalidateConstTrackingLet(Context script_context, int slot_index);
+
   // Caution, hack: this getter ignores the AcquireLoadTag. The global_object
   // slot is safe to read concurrently since it is immutable after
   // initialization.  This function should *not* be used from anywhere other
@@ -922,6 +922,7 @@ class ElementsAccessorBase : public InternalElementsAccessor {
 
     // Transition through the allocation site as well if present.
     JSObject::UpdateAllocationSite(object, to_kind);
+    JSObject::UpdateAllocationSiteCapacity(object, capacity);
 
     if (FLAG_trace_elements_transitions) {
       JSObject::PrintElementsTransition(stdout, object, from_kind, old_elements,
@@ -965,6 +966,7 @@ class ElementsAccessorBase : public InternalElementsAccessor {
     }
 
     object->set_elements(*elements);
+    JSObject::UpdateAllocationSiteCapacity(object, new_capacity);
     return Just(true);
   }
 
@@ -10,6 +10,7 @@
 #include "src/ic/ic.h"
 #include "src/init/bootstrapper.h"
 #include "src/objects/feedback-cell-inl.h"
+#include "src/objects/hash-table-inl.h"
 #include "src/strings/string-builder-inl.h"
 
 // Has to be the last include (doesn't have include guards):
@@ -327,6 +328,52 @@ void JSFunction::EnsureFeedbackVector(Handle<JSFunction> function,
   function->SetInterruptBudget();
 }
 
+namespace {
+
+// With --share-feedback-cells, the first closure of a SharedFunctionInfo that
+// gets a feedback cell array registers its FeedbackCell in a weak table on the
+// native context. Later closures of the same function, even if created from a
+// different parent feedback vector, adopt that cell instead of allocating
+// their own closure feedback cell array and feedback vector. Returns true if
+// the {function} now uses the shared cell.
+bool AdoptSharedFeedbackCell(Isolate* isolate, Handle<JSFunction> function) {
+  Object table = function->native_context().shared_feedback_cells();
+  if (table.IsUndefined(isolate)) return false;
+  Handle<SharedFunctionInfo> shared(function->shared(), isolate);
+  Object cached = EphemeronHashTable::cast(table).Lookup(shared);
+  if (!cached.IsFeedbackCell()) return false;
+  FeedbackCell cell = FeedbackCell::cast(cached);
+  if (cell == function->raw_feedback_cell()) return false;
+  // The shared cell loses its value when the bytecode is flushed; the next
+  // closure to be initialized registers its own cell instead.
+  if (!cell.value().IsFeedbackVector() &&
+      !cell.value().IsClosureFeedbackCellArray()) {
+    return false;
+  }
+  cell.IncrementClosureCount(isolate);
+  function->set_raw_feedback_cell(cell, kReleaseStore);
+  return true;
+}
+
+void RecordSharedFeedbackCell(Isolate* isolate, Handle<JSFunction> function) {
+  if (function->raw_feedback_cell() == isolate->heap()->many_closures_cell()) {
+    return;
+  }
+  Handle<NativeContext> native_context(function->native_context(), isolate);
+  Handle<EphemeronHashTable> table =
+      native_context->shared_feedback_cells().IsUndefined(isolate)
+          ? EphemeronHashTable::New(isolate, 0)
+          : handle(EphemeronHashTable::cast(
+                       native_context->shared_feedback_cells()),
+                   isolate);
+  Handle<SharedFunctionInfo> shared(function->shared(), isolate);
+  Handle<FeedbackCell> cell(function->raw_feedback_cell(), isolate);
+  table = EphemeronHashTable::Put(table, shared, cell);
+  native_context->set_shared_feedback_cells(*table);
+}
+
+}  // namespace
+
 // static
 void JSFunction::InitializeFeedbackCell(
     Handle<JSFunction> function, IsCompiledScope* is_compiled_scope,
@@ -360,12 +407,25 @@ void JSFunction::InitializeFeedbackCell(
       FLAG_log_function_events || !isolate->is_best_effort_code_coverage() ||
       isolate->is_collecting_type_profile();
 
+  const bool share_feedback_cell =
+      FLAG_share_feedback_cells && !function->has_closure_feedback_cell_array();
+  if (share_feedback_cell && AdoptSharedFeedbackCell(isolate, function)) {
+    // The interrupt budget lives on the shared cell and accumulates over all
+    // its closures, so it must not be reset here.
+    if (needs_feedback_vector) {
+      EnsureFeedbackVector(function, is_compiled_scope);
+    }
+    return;
+  }
+
   if (needs_feedback_vector) {
     EnsureFeedbackVector(function, is_compiled_scope);
   } else {
     EnsureClosureFeedbackCellArray(function,
                                    reset_budget_for_feedback_allocation);
   }
+
+  if (share_feedback_cell) RecordSharedFeedbackCell(isolate, function);
 }
 
 namespace {
@@ -11,6 +11,7 @@
 #include "src/execution/arguments.h"
 #include "src/execution/frames.h"
 #include "src/execution/isolate.h"
+#include "src/execution/protectors-inl.h"
 #include "src/handles/handles-inl.h"
 #include "src/handles/maybe-handles.h"
 #include "src/heap/factory-inl.h"
@@ -4869,6 +4870,12 @@ Maybe<bool> JSObject::SetPrototype(Handle<JSObject> object,
   // Set the new prototype of the object.
 
   isolate->UpdateNoElementsProtectorOnSetPrototype(real_receiver);
+  // A new prototype could provide a "return" method to array iterators.
+  if ((real_receiver->IsJSArrayIteratorPrototype() ||
+       real_receiver->IsJSIteratorPrototype()) &&
+      Protectors::IsArrayIteratorLookupChainIntact(isolate)) {
+    Protectors::InvalidateArrayIteratorLookupChain(isolate);
+  }
 
   Handle<Map> new_map =
       Map::TransitionToPrototype(isolate, map, Handle<HeapObject>::cast(value));
@@ -5058,6 +5065,21 @@ JSObject::UpdateAllocationSite<AllocationSiteUpdateMode::kCheckOnly>(
 template bool JSObject::UpdateAllocationSite<AllocationSiteUpdateMode::kUpdate>(
     Handle<JSObject> object, ElementsKind to_kind);
 
+void JSObject::UpdateAllocationSiteCapacity(Handle<JSObject> object,
+                                            uint32_t capacity) {
+  if (!FLAG_allocation_site_capacity_hints) return;
+  if (!object->IsJSArray()) return;
+  if (!Heap::InYoungGeneration(*object)) return;
+  if (Heap::IsLargeObject(*object)) return;
+
+  DisallowGarbageCollection no_gc;
+  Heap* heap = object->GetHeap();
+  AllocationMemento memento =
+      heap->FindAllocationMemento<Heap::kForRuntime>(object->map(), *object);
+  if (memento.is_null()) return;
+  memento.GetAllocationSite().DigestCapacityFeedback(capacity);
+}
+
 void JSObject::TransitionElementsKind(Handle<JSObject> object,
                                       ElementsKind to_kind) {
   ElementsKind from_kind = object->GetElementsKind();
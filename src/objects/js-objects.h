@@ -565,6 +565,9 @@ class JSObject : public TorqueGeneratedJSObject<JSObject, JSReceiver> {
                 AllocationSiteUpdateMode::kUpdate>
   static bool UpdateAllocationSite(Handle<JSObject> object,
                                    ElementsKind to_kind);
+  // Records the new elements capacity of an array on its allocation site.
+  static void UpdateAllocationSiteCapacity(Handle<JSObject> object,
+                                           uint32_t capacity);
 
   // Lookup interceptors are used for handling properties controlled by host
   // objects.
@@ -214,15 +214,21 @@ void JSRegExp::ResetLastTierUpTick() {
                                Smi::FromInt(tier_up_ticks));
 }
 
-void JSRegExp::TierUpTick() {
+void JSRegExp::TierUpTick(int subject_length) {
   DCHECK(FLAG_regexp_tier_up);
   DCHECK_EQ(type_tag(), JSRegExp::IRREGEXP);
   int tier_up_ticks = Smi::ToInt(DataAt(kIrregexpTicksUntilTierUpIndex));
   if (tier_up_ticks == 0) {
     return;
   }
-  FixedArray::cast(data()).set(JSRegExp::kIrregexpTicksUntilTierUpIndex,
-                               Smi::FromInt(tier_up_ticks - 1));
+  // Interpreting longer subjects is more work, so they tier up sooner.
+  int ticks = 1;
+  if (FLAG_regexp_tier_up_chars_per_tick > 0) {
+    ticks += subject_length / FLAG_regexp_tier_up_chars_per_tick;
+  }
+  FixedArray::cast(data()).set(
+      JSRegExp::kIrregexpTicksUntilTierUpIndex,
+      Smi::FromInt(std::max(0, tier_up_ticks - ticks)));
 }
 
 void JSRegExp::MarkTierUpForNextExec() {
@@ -123,7 +123,8 @@ class JSRegExp : public TorqueGeneratedJSRegExp<JSRegExp, JSObject> {
   bool CanTierUp();
   bool MarkedForTierUp();
   void ResetLastTierUpTick();
-  void TierUpTick();
+  // Counts an interpreted execution on a subject of the given length.
+  void TierUpTick(int subject_length);
   void MarkTierUpForNextExec();
 
   bool ShouldProduceBytecode();
@@ -39,6 +39,14 @@ inline JSSegmenter::Granularity JSSegmentIterator::granularity() const {
   return GranularityBits::decode(flags());
 }
 
+inline void JSSegmentIterator::set_scans_one_byte_graphemes(bool value) {
+  set_flags(ScansOneByteGraphemesBit::update(flags(), value));
+}
+
+inline bool JSSegmentIterator::scans_one_byte_graphemes() const {
+  return ScansOneByteGraphemesBit::decode(flags());
+}
+
 }  // namespace internal
 }  // namespace v8
 
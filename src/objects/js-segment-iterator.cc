@@ -30,8 +30,8 @@ Handle<String> JSSegmentIterator::GranularityAsString(Isolate* isolate) const {
 
 // ecma402 #sec-createsegmentiterator
 MaybeHandle<JSSegmentIterator> JSSegmentIterator::Create(
-    Isolate* isolate, icu::BreakIterator* break_iterator,
-    JSSegmenter::Granularity granularity) {
+    Isolate* isolate, Handle<String> input_string,
+    icu::BreakIterator* break_iterator, JSSegmenter::Granularity granularity) {
   // Clone a copy for both the ownership and not sharing with containing and
   // other calls to the iterator because icu::BreakIterator keep the iteration
   // position internally and cannot be shared across multiple calls to
@@ -61,12 +61,36 @@ MaybeHandle<JSSegmentIterator> JSSegmentIterator::Create(
 
   segment_iterator->set_flags(0);
   segment_iterator->set_granularity(granularity);
+  segment_iterator->set_scans_one_byte_graphemes(
+      granularity == JSSegmenter::Granularity::GRAPHEME &&
+      input_string->IsOneByteRepresentation());
   segment_iterator->set_icu_break_iterator(*managed_break_iterator);
   segment_iterator->set_unicode_string(*unicode_string);
+  segment_iterator->set_raw_string(*input_string);
+  segment_iterator->set_next_segment_index(Smi::zero());
 
   return segment_iterator;
 }
 
+namespace {
+
+// Returns the end of the grapheme cluster that starts at |start_index| of the
+// one-byte |string|, which is every character but CR LF on its own. Latin-1
+// has no extending, prepended or joining characters (UAX #29).
+int32_t FindOneByteGraphemeEnd(String string, int32_t start_index) {
+  DisallowGarbageCollection no_gc;
+  int32_t length = string.length();
+  DCHECK_LT(start_index, length);
+  int32_t end_index = start_index + 1;
+  if (end_index < length && string.Get(start_index) == '\r' &&
+      string.Get(end_index) == '\n') {
+    end_index++;
+  }
+  return end_index;
+}
+
+}  // namespace
+
 // ecma402 #sec-%segmentiteratorprototype%.next
 MaybeHandle<JSReceiver> JSSegmentIterator::Next(
     Isolate* isolate, Handle<JSSegmentIterator> segment_iterator) {
@@ -74,9 +98,22 @@ MaybeHandle<JSReceiver> JSSegmentIterator::Next(
   icu::BreakIterator* icu_break_iterator =
       segment_iterator->icu_break_iterator().raw();
   // 5. Let startIndex be iterator.[[IteratedStringNextSegmentCodeUnitIndex]].
-  int32_t start_index = icu_break_iterator->current();
   // 6. Let endIndex be ! FindBoundary(segmenter, string, startIndex, after).
-  int32_t end_index = icu_break_iterator->next();
+  int32_t start_index;
+  int32_t end_index;
+  if (segment_iterator->scans_one_byte_graphemes()) {
+    start_index = segment_iterator->next_segment_index().value();
+    if (start_index < segment_iterator->raw_string().length()) {
+      end_index =
+          FindOneByteGraphemeEnd(segment_iterator->raw_string(), start_index);
+      segment_iterator->set_next_segment_index(Smi::FromInt(end_index));
+    } else {
+      end_index = icu::BreakIterator::DONE;
+    }
+  } else {
+    start_index = icu_break_iterator->current();
+    end_index = icu_break_iterator->next();
+  }
 
   // 7. If endIndex is not finite, then
   if (end_index == icu::BreakIterator::DONE) {
@@ -90,15 +127,13 @@ MaybeHandle<JSReceiver> JSSegmentIterator::Next(
   // 9. Let segmentData be ! CreateSegmentDataObject(segmenter, string,
   // startIndex, endIndex).
 
-  icu::UnicodeString string;
-  icu_break_iterator->getText().getText(string);
-
   Handle<Object> segment_data;
   ASSIGN_RETURN_ON_EXCEPTION(
       isolate, segment_data,
       JSSegments::CreateSegmentDataObject(
-          isolate, segment_iterator->granularity(), icu_break_iterator, string,
-          start_index, end_index),
+          isolate, segment_iterator->granularity(), icu_break_iterator,
+          handle(segment_iterator->raw_string(), isolate), start_index,
+          end_index),
       JSReceiver);
 
   // 10. Return ! CreateIterResultObject(segmentData, false).
@@ -34,7 +34,8 @@ class JSSegmentIterator
  public:
   // ecma402 #sec-CreateSegmentIterator
   V8_WARN_UNUSED_RESULT static MaybeHandle<JSSegmentIterator> Create(
-      Isolate* isolate, icu::BreakIterator* icu_break_iterator,
+      Isolate* isolate, Handle<String> input_string,
+      icu::BreakIterator* icu_break_iterator,
       JSSegmenter::Granularity granularity);
 
   // ecma402 #sec-segment-iterator-prototype-next
@@ -52,6 +53,11 @@ class JSSegmentIterator
   inline void set_granularity(JSSegmenter::Granularity granularity);
   inline JSSegmenter::Granularity granularity() const;
 
+  // Whether the grapheme boundaries of a one-byte string are found without
+  // ICU. Only CR LF forms a cluster of more than one Latin-1 character.
+  inline void set_scans_one_byte_graphemes(bool value);
+  inline bool scans_one_byte_graphemes() const;
+
   // Bit positions in |flags|.
   DEFINE_TORQUE_GENERATED_JS_SEGMENT_ITERATOR_FLAGS()
 
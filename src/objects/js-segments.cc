@@ -33,6 +33,8 @@ MaybeHandle<JSSegments> JSSegments::Create(Isolate* isolate,
       segmenter->icu_break_iterator().raw()->clone();
   DCHECK_NOT_NULL(break_iterator);
 
+  string = String::Flatten(isolate, string);
+
   Handle<Managed<icu::UnicodeString>> unicode_string =
       Intl::SetTextToBreakIterator(isolate, string, break_iterator);
   Handle<Managed<icu::BreakIterator>> managed_break_iterator =
@@ -51,6 +53,7 @@ MaybeHandle<JSSegments> JSSegments::Create(Isolate* isolate,
   segments->set_granularity(segmenter->granularity());
 
   // 4. Set segments.[[SegmentsString]] to string.
+  segments->set_raw_string(*string);
   segments->set_unicode_string(*unicode_string);
 
   // 5. Return segments.
@@ -85,7 +88,7 @@ MaybeHandle<Object> JSSegments::Containing(Isolate* isolate,
   // endIndex).
   return CreateSegmentDataObject(
       isolate, segments->granularity(), break_iterator,
-      *(segments->unicode_string().raw()), start_index, end_index);
+      handle(segments->raw_string(), isolate), start_index, end_index);
 }
 
 namespace {
@@ -106,7 +109,7 @@ bool CurrentSegmentIsWordLike(icu::BreakIterator* break_iterator) {
 // ecma402 #sec-createsegmentdataobject
 MaybeHandle<Object> JSSegments::CreateSegmentDataObject(
     Isolate* isolate, JSSegmenter::Granularity granularity,
-    icu::BreakIterator* break_iterator, const icu::UnicodeString& string,
+    icu::BreakIterator* break_iterator, Handle<String> input_string,
     int32_t start_index, int32_t end_index) {
   Factory* factory = isolate->factory();
 
@@ -114,7 +117,7 @@ MaybeHandle<Object> JSSegments::CreateSegmentDataObject(
   // 2. Assert: startIndex ≥ 0.
   DCHECK_GE(start_index, 0);
   // 3. Assert: endIndex ≤ len.
-  DCHECK_LE(end_index, string.length());
+  DCHECK_LE(end_index, input_string->length());
   // 4. Assert: startIndex < endIndex.
   DCHECK_LT(start_index, end_index);
 
@@ -124,10 +127,8 @@ MaybeHandle<Object> JSSegments::CreateSegmentDataObject(
   // 6. Let segment be the String value equal to the substring of string
   // consisting of the code units at indices startIndex (inclusive) through
   // endIndex (exclusive).
-  Handle<String> segment;
-  ASSIGN_RETURN_ON_EXCEPTION(
-      isolate, segment, Intl::ToString(isolate, string, start_index, end_index),
-      JSObject);
+  Handle<String> segment =
+      factory->NewSubString(input_string, start_index, end_index);
 
   // 7. Perform ! CreateDataPropertyOrThrow(result, "segment", segment).
   Maybe<bool> maybe_create_segment = JSReceiver::CreateDataProperty(
@@ -143,9 +144,6 @@ MaybeHandle<Object> JSSegments::CreateSegmentDataObject(
   USE(maybe_create_index);
 
   // 9. Perform ! CreateDataPropertyOrThrow(result, "input", string).
-  Handle<String> input_string;
-  ASSIGN_RETURN_ON_EXCEPTION(isolate, input_string,
-                             Intl::ToString(isolate, string), JSObject);
   Maybe<bool> maybe_create_input = JSReceiver::CreateDataProperty(
       isolate, result, factory->input_string(), input_string, Just(kDontThrow));
   DCHECK(maybe_create_input.FromJust());
@@ -42,7 +42,7 @@ class JSSegments : public TorqueGeneratedJSSegments<JSSegments, JSObject> {
   // ecma402 #sec-createsegmentdataobject
   V8_WARN_UNUSED_RESULT static MaybeHandle<Object> CreateSegmentDataObject(
       Isolate* isolate, JSSegmenter::Granularity granularity,
-      icu::BreakIterator* break_iterator, const icu::UnicodeString& string,
+      icu::BreakIterator* break_iterator, Handle<String> input_string,
       int32_t start_index, int32_t end_index);
 
   Handle<String> GranularityAsString(Isolate* isolate) const;
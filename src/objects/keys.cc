@@ -394,11 +394,40 @@ Handle<FixedArray> GetFastEnumPropertyKeys(Isolate* isolate,
       Handle<DescriptorArray>(map->instance_descriptors(isolate), isolate);
   isolate->counters()->enum_cache_misses()->Increment();
 
+  // The {map} may share its DescriptorArray with the maps further down its
+  // transition chain, whose descriptors extend the {map}'s own ones. Cover
+  // all of them, so that every map on the chain finds its keys as a prefix
+  // of the same cache, unless that would cost the {map} its enum indices.
+  int cache_descriptors = map->NumberOfOwnDescriptors();
+  int cache_length = enum_length;
+  {
+    DisallowGarbageCollection no_gc;
+    bool own_fields_only = true;
+    bool fields_only = true;
+    int length = 0;
+    for (InternalIndex i :
+         InternalIndex::Range(descriptors->number_of_descriptors())) {
+      PropertyDetails details = descriptors->GetDetails(i);
+      if (details.IsDontEnum()) continue;
+      if (descriptors->GetKey(i).IsSymbol()) continue;
+      if (details.location() != PropertyLocation::kField) {
+        fields_only = false;
+        if (i.as_int() < cache_descriptors) own_fields_only = false;
+      }
+      length++;
+    }
+    if (fields_only || !own_fields_only) {
+      cache_descriptors = descriptors->number_of_descriptors();
+      cache_length = length;
+    }
+  }
+  DCHECK_LE(enum_length, cache_length);
+
   // Create the keys array.
   int index = 0;
   bool fields_only = true;
-  keys = isolate->factory()->NewFixedArray(enum_length);
-  for (InternalIndex i : map->IterateOwnDescriptors()) {
+  keys = isolate->factory()->NewFixedArray(cache_length);
+  for (InternalIndex i : InternalIndex::Range(cache_descriptors)) {
     DisallowGarbageCollection no_gc;
     PropertyDetails details = descriptors->GetDetails(i);
     if (details.IsDontEnum()) continue;
@@ -413,9 +442,9 @@ Handle<FixedArray> GetFastEnumPropertyKeys(Isolate* isolate,
   // Optionally also create the indices array.
   Handle<FixedArray> indices = isolate->factory()->empty_fixed_array();
   if (fields_only) {
-    indices = isolate->factory()->NewFixedArray(enum_length);
+    indices = isolate->factory()->NewFixedArray(cache_length);
     index = 0;
-    for (InternalIndex i : map->IterateOwnDescriptors()) {
+    for (InternalIndex i : InternalIndex::Range(cache_descriptors)) {
       DisallowGarbageCollection no_gc;
       PropertyDetails details = descriptors->GetDetails(i);
       if (details.IsDontEnum()) continue;
@@ -434,7 +463,7 @@ Handle<FixedArray> GetFastEnumPropertyKeys(Isolate* isolate,
                                                indices);
   if (map->OnlyHasSimpleProperties()) map->SetEnumLength(enum_length);
 
-  return keys;
+  return ReduceFixedArrayTo(isolate, keys, enum_length);
 }
 
 template <bool fast_properties>
@@ -230,7 +230,8 @@ void LookupIterator::UpdateProtector(Isolate* isolate, Handle<Object> receiver,
   if (*name == roots.is_concat_spreadable_symbol() ||
       *name == roots.constructor_string() || *name == roots.next_string() ||
       *name == roots.species_symbol() || *name == roots.iterator_symbol() ||
-      *name == roots.resolve_string() || *name == roots.then_string()) {
+      *name == roots.resolve_string() || *name == roots.then_string() ||
+      *name == roots.return_string()) {
     InternalUpdateProtector(isolate, receiver, name);
   }
 }
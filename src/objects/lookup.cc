@@ -325,6 +325,16 @@ void LookupIterator::InternalUpdateProtector(Isolate* isolate,
         receiver->IsJSPromisePrototype()) {
       Protectors::InvalidatePromiseThenLookupChain(isolate);
     }
+  } else if (*name == roots.return_string()) {
+    if (!Protectors::IsArrayIteratorLookupChainIntact(isolate)) return;
+    // Array destructuring skips the IteratorClose step for fast arrays, so
+    // setting the "return" property anywhere on the prototype chain of array
+    // iterators invalidates the array iterator protector.
+    if (receiver->IsJSArrayIterator() ||
+        receiver->IsJSArrayIteratorPrototype() ||
+        receiver->IsJSIteratorPrototype() || receiver->IsJSObjectPrototype()) {
+      Protectors::InvalidateArrayIteratorLookupChain(isolate);
+    }
   }
 }
 
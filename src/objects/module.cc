@@ -193,7 +193,9 @@ bool Module::Instantiate(
   Zone zone(isolate->allocator(), ZONE_NAME);
   ZoneForwardList<Handle<SourceTextModule>> stack(&zone);
   unsigned dfs_index = 0;
-  if (!FinishInstantiate(isolate, module, &stack, &dfs_index, &zone)) {
+  UnresolvableExports unresolvable_exports(&zone);
+  if (!FinishInstantiate(isolate, module, &stack, &dfs_index, &zone,
+                         &unresolvable_exports)) {
     ResetGraph(isolate, module);
     DCHECK_EQ(module->status(), kUnlinked);
     return false;
@@ -226,7 +228,8 @@ bool Module::PrepareInstantiate(
 
 bool Module::FinishInstantiate(Isolate* isolate, Handle<Module> module,
                                ZoneForwardList<Handle<SourceTextModule>>* stack,
-                               unsigned* dfs_index, Zone* zone) {
+                               unsigned* dfs_index, Zone* zone,
+                               UnresolvableExports* unresolvable_exports) {
   DCHECK_NE(module->status(), kEvaluating);
   if (module->status() >= kLinking) return true;
   DCHECK_EQ(module->status(), kPreLinking);
@@ -235,7 +238,7 @@ bool Module::FinishInstantiate(Isolate* isolate, Handle<Module> module,
   if (module->IsSourceTextModule()) {
     return SourceTextModule::FinishInstantiate(
         isolate, Handle<SourceTextModule>::cast(module), stack, dfs_index,
-        zone);
+        zone, unresolvable_exports);
   } else {
     return SyntheticModule::FinishInstantiate(
         isolate, Handle<SyntheticModule>::cast(module));
@@ -111,10 +111,13 @@ class Module : public TorqueGeneratedModule<Module, HeapObject> {
       Isolate* isolate, Handle<Module> module, v8::Local<v8::Context> context,
       v8::Module::ResolveModuleCallback callback,
       DeprecatedResolveCallback callback_without_import_assertions);
+  // The export names that star exports were found not to provide, shared by
+  // all resolutions of one instantiation.
+  class UnresolvableExports;
   static V8_WARN_UNUSED_RESULT bool FinishInstantiate(
       Isolate* isolate, Handle<Module> module,
       ZoneForwardList<Handle<SourceTextModule>>* stack, unsigned* dfs_index,
-      Zone* zone);
+      Zone* zone, UnresolvableExports* unresolvable_exports);
 
   static V8_WARN_UNUSED_RESULT MaybeHandle<Object> EvaluateMaybeAsync(
       Isolate* isolate, Handle<Module> module);
@@ -276,6 +276,27 @@ BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2,
                     has_static_private_methods_or_accessors,
                     SharedFunctionInfo::HasStaticPrivateMethodsOrAccessorsBit)
 
+BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, has_flushed_bytecode,
+                    SharedFunctionInfo::HasFlushedBytecodeBit)
+
+BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, has_baseline_code_hint,
+                    SharedFunctionInfo::HasBaselineCodeHintBit)
+
+int SharedFunctionInfo::deopt_count() const {
+  return DeoptCountBits::decode(flags2());
+}
+
+void SharedFunctionInfo::set_deopt_count(int count) {
+  DCHECK_LE(0, count);
+  DCHECK_LE(count, kMaxDeoptCount);
+  set_flags2(DeoptCountBits::update(flags2(), count));
+}
+
+void SharedFunctionInfo::increment_deopt_count() {
+  int count = deopt_count();
+  if (count < kMaxDeoptCount) set_deopt_count(count + 1);
+}
+
 BIT_FIELD_ACCESSORS(SharedFunctionInfo, relaxed_flags, syntax_kind,
                     SharedFunctionInfo::FunctionSyntaxKindBits)
 
@@ -308,6 +329,10 @@ BIT_FIELD_ACCESSORS(SharedFunctionInfo, relaxed_flags, properties_are_final,
 BIT_FIELD_ACCESSORS(SharedFunctionInfo, relaxed_flags,
                     private_name_lookup_skips_outer_class,
                     SharedFunctionInfo::PrivateNameLookupSkipsOuterClassBit)
+BIT_FIELD_ACCESSORS(SharedFunctionInfo, relaxed_flags, has_optimization_hint,
+                    SharedFunctionInfo::HasOptimizationHintBit)
+BIT_FIELD_ACCESSORS(SharedFunctionInfo, relaxed_flags, has_inlining_hint,
+                    SharedFunctionInfo::HasInliningHintBit)
 
 bool SharedFunctionInfo::optimization_disabled() const {
   return disable_optimization_reason() != BailoutReason::kNoReason;
@@ -415,6 +415,21 @@ class SharedFunctionInfo
   DECL_BOOLEAN_ACCESSORS(class_scope_has_private_brand)
   DECL_BOOLEAN_ACCESSORS(has_static_private_methods_or_accessors)
 
+  // True if the bytecode of this function was flushed at least once and the
+  // function has not been compiled again since.
+  DECL_BOOLEAN_ACCESSORS(has_flushed_bytecode)
+
+  // True if this function had baseline code when it was put into the code
+  // cache (see --sparkplug-code-cache-hints).
+  DECL_BOOLEAN_ACCESSORS(has_baseline_code_hint)
+
+  // [deopt_count]: The number of eager and soft deoptimizations of this
+  // function's optimized code. Saturates at kMaxDeoptCount.
+  inline int deopt_count() const;
+  inline void set_deopt_count(int count);
+  inline void increment_deopt_count();
+  static const int kMaxDeoptCount = DeoptCountBits::kMax;
+
   // Is this function a top-level function (scripts, evals).
   DECL_BOOLEAN_ACCESSORS(is_toplevel)
 
@@ -664,6 +679,17 @@ class SharedFunctionInfo
   // class constructors to handle lazily parsed properties.
   DECL_BOOLEAN_ACCESSORS(properties_are_final)
 
+  // [has_optimization_hint]: Set once TurboFan code for this function has been
+  // installed and cleared when that code deoptimizes eagerly. The bit is part
+  // of the serialized SharedFunctionInfo, so a function that was hot when the
+  // code cache was produced can be tiered up early after deserialization.
+  DECL_BOOLEAN_ACCESSORS(has_optimization_hint)
+
+  // [has_inlining_hint]: Set once this function has been inlined into TurboFan
+  // code. Like has_optimization_hint, it persists through the code cache and
+  // lets the inlining heuristic prefer call sites that were hot before.
+  DECL_BOOLEAN_ACCESSORS(has_inlining_hint)
+
   inline void set_kind(FunctionKind kind);
 
   inline uint16_t get_property_estimate_from_literal(FunctionLiteral* literal);
@@ -0,0 +1,114 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/objects/simd.h"
+
+#include <cmath>
+#include <type_traits>
+
+#include "src/base/logging.h"
+#include "src/common/globals.h"
+#include "src/objects/objects-inl.h"
+
+#if V8_HOST_ARCH_X64
+#include <emmintrin.h>
+#define V8_ARRAY_SEARCH_SIMD 1
+#elif V8_HOST_ARCH_ARM64
+#include <arm_neon.h>
+#define V8_ARRAY_SEARCH_SIMD 1
+#endif
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+#ifdef V8_ARRAY_SEARCH_SIMD
+// Both SSE2 and NEON operate on 128-bit vectors.
+constexpr size_t kVectorSize = 16;
+
+#if V8_HOST_ARCH_X64
+bool VectorContains(const uint32_t* values, uint32_t search_element) {
+  __m128i needle = _mm_set1_epi32(static_cast<int>(search_element));
+  __m128i vector = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values));
+  return _mm_movemask_epi8(_mm_cmpeq_epi32(vector, needle)) != 0;
+}
+
+bool VectorContains(const uint64_t* values, uint64_t search_element) {
+  // SSE2 has no 64-bit equality, so both halves of a lane have to match.
+  __m128i needle = _mm_set1_epi64x(static_cast<int64_t>(search_element));
+  __m128i vector = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values));
+  __m128i equal = _mm_cmpeq_epi32(vector, needle);
+  equal =
+      _mm_and_si128(equal, _mm_shuffle_epi32(equal, _MM_SHUFFLE(2, 3, 0, 1)));
+  return _mm_movemask_epi8(equal) != 0;
+}
+
+bool VectorContains(const double* values, double search_element) {
+  __m128d needle = _mm_set1_pd(search_element);
+  __m128d vector = _mm_loadu_pd(values);
+  return _mm_movemask_pd(_mm_cmpeq_pd(vector, needle)) != 0;
+}
+#elif V8_HOST_ARCH_ARM64
+bool VectorContains(const uint32_t* values, uint32_t search_element) {
+  uint32x4_t equal = vceqq_u32(vld1q_u32(values), vdupq_n_u32(search_element));
+  return vmaxvq_u32(equal) != 0;
+}
+
+bool VectorContains(const uint64_t* values, uint64_t search_element) {
+  uint64x2_t equal = vceqq_u64(vld1q_u64(values), vdupq_n_u64(search_element));
+  return vmaxvq_u32(vreinterpretq_u32_u64(equal)) != 0;
+}
+
+bool VectorContains(const double* values, double search_element) {
+  uint64x2_t equal = vceqq_f64(vld1q_f64(values), vdupq_n_f64(search_element));
+  return vmaxvq_u32(vreinterpretq_u32_u64(equal)) != 0;
+}
+#endif
+#endif  // V8_ARRAY_SEARCH_SIMD
+
+// Skips whole vectors that do not contain |search_element| and finds the
+// exact index with a scalar loop, which also handles the remainder.
+template <typename T>
+uintptr_t Search(const T* array, uintptr_t array_len, uintptr_t index,
+                 T search_element) {
+#ifdef V8_ARRAY_SEARCH_SIMD
+  constexpr uintptr_t kLanes = kVectorSize / sizeof(T);
+  for (; index + kLanes <= array_len; index += kLanes) {
+    if (VectorContains(array + index, search_element)) break;
+  }
+#endif
+  for (; index < array_len; index++) {
+    if (array[index] == search_element) return index;
+  }
+  return static_cast<uintptr_t>(-1);
+}
+
+}  // namespace
+
+uintptr_t ArrayIndexOfIncludesSmiOrObject(Address array_start,
+                                          uintptr_t array_len,
+                                          uintptr_t from_index,
+                                          Address search_element) {
+  // Compare the raw tagged words, so that compressed elements are matched
+  // against the compressed search element.
+  using TaggedWord =
+      std::conditional<kTaggedSize == 4, uint32_t, uint64_t>::type;
+  return Search(reinterpret_cast<const TaggedWord*>(array_start), array_len,
+                from_index, static_cast<TaggedWord>(search_element));
+}
+
+uintptr_t ArrayIndexOfIncludesDouble(Address array_start, uintptr_t array_len,
+                                     uintptr_t from_index,
+                                     Address search_element) {
+  double search_num = Object(search_element).Number();
+  DCHECK(!std::isnan(search_num));
+  return Search(reinterpret_cast<const double*>(array_start), array_len,
+                from_index, search_num);
+}
+
+}  // namespace internal
+}  // namespace v8
+
+#undef V8_ARRAY_SEARCH_SIMD
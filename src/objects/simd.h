@@ -0,0 +1,36 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_OBJECTS_SIMD_H_
+#define V8_OBJECTS_SIMD_H_
+
+#include <cstdint>
+
+#include "include/v8-internal.h"
+
+namespace v8 {
+namespace internal {
+
+// Searches the tagged elements |array_start[from_index..array_len)| for a
+// value that is identical to |search_element| and returns the index of the
+// first match, or -1 if there is none. Only valid when identity implies
+// equality, i.e. for Smis in Smi arrays and for objects that are not numbers,
+// strings or BigInts.
+uintptr_t ArrayIndexOfIncludesSmiOrObject(Address array_start,
+                                          uintptr_t array_len,
+                                          uintptr_t from_index,
+                                          Address search_element);
+
+// Searches the unboxed doubles |array_start[from_index..array_len)| for the
+// value of |search_element|, a Smi or a HeapNumber that is not NaN, and
+// returns the index of the first match, or -1 if there is none. The hole is
+// a NaN, so it never matches.
+uintptr_t ArrayIndexOfIncludesDouble(Address array_start, uintptr_t array_len,
+                                     uintptr_t from_index,
+                                     Address search_element);
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_OBJECTS_SIMD_H_
@@ -17,30 +17,6 @@
 namespace v8 {
 namespace internal {
 
-struct StringHandleHash {
-  V8_INLINE size_t operator()(Handle<String> string) const {
-    return string->EnsureHash();
-  }
-};
-
-struct StringHandleEqual {
-  V8_INLINE bool operator()(Handle<String> lhs, Handle<String> rhs) const {
-    return lhs->Equals(*rhs);
-  }
-};
-
-class UnorderedStringSet
-    : public std::unordered_set<Handle<String>, StringHandleHash,
-                                StringHandleEqual,
-                                ZoneAllocator<Handle<String>>> {
- public:
-  explicit UnorderedStringSet(Zone* zone)
-      : std::unordered_set<Handle<String>, StringHandleHash, StringHandleEqual,
-                           ZoneAllocator<Handle<String>>>(
-            2 /* bucket count */, StringHandleHash(), StringHandleEqual(),
-            ZoneAllocator<Handle<String>>(zone)) {}
-};
-
 class UnorderedStringMap
     : public std::unordered_map<
           Handle<String>, Handle<Object>, StringHandleHash, StringHandleEqual,
@@ -61,7 +37,7 @@ class Module::ResolveSet
           ModuleHandleEqual,
           ZoneAllocator<std::pair<const Handle<Module>, UnorderedStringSet*>>> {
  public:
-  explicit ResolveSet(Zone* zone)
+  ResolveSet(Zone* zone, UnresolvableExports* unresolvable_exports)
       : std::unordered_map<Handle<Module>, UnorderedStringSet*,
                            ModuleHandleHash, ModuleHandleEqual,
                            ZoneAllocator<std::pair<const Handle<Module>,
@@ -69,12 +45,23 @@ class Module::ResolveSet
             2 /* bucket count */, ModuleHandleHash(), ModuleHandleEqual(),
             ZoneAllocator<std::pair<const Handle<Module>, UnorderedStringSet*>>(
                 zone)),
-        zone_(zone) {}
+        zone_(zone),
+        unresolvable_exports_(unresolvable_exports) {}
 
   Zone* zone() const { return zone_; }
+  UnresolvableExports* unresolvable_exports() const {
+    return unresolvable_exports_;
+  }
+
+  // The number of cycles detected so far. A name that could not be resolved
+  // without running into a cycle may resolve from another starting point.
+  int cycles() const { return cycles_; }
+  void RecordCycle() { cycles_++; }
 
  private:
   Zone* zone_;
+  UnresolvableExports* unresolvable_exports_;
+  int cycles_ = 0;
 };
 
 struct SourceTextModule::AsyncEvaluatingOrdinalCompare {
@@ -199,6 +186,7 @@ MaybeHandle<Cell> SourceTextModule::ResolveExport(
       name_set = zone->New<UnorderedStringSet>(zone);
     } else if (name_set->count(export_name)) {
       // Cycle detected.
+      resolve_set->RecordCycle();
       if (must_resolve) {
         return isolate->ThrowAt<Cell>(
             isolate->factory()->NewSyntaxError(
@@ -267,9 +255,13 @@ MaybeHandle<Cell> SourceTextModule::ResolveExportUsingStarExports(
     Isolate* isolate, Handle<SourceTextModule> module,
     Handle<String> module_specifier, Handle<String> export_name,
     MessageLocation loc, bool must_resolve, Module::ResolveSet* resolve_set) {
-  if (!export_name->Equals(ReadOnlyRoots(isolate).default_string())) {
+  UnresolvableExports* unresolvable_exports =
+      resolve_set->unresolvable_exports();
+  if (!export_name->Equals(ReadOnlyRoots(isolate).default_string()) &&
+      !unresolvable_exports->Contains(module, export_name)) {
     // Go through all star exports looking for the given name.  If multiple star
     // exports provide the name, make sure they all map it to the same cell.
+    int cycles = resolve_set->cycles();
     Handle<Cell> unique_cell;
     Handle<FixedArray> special_exports(module->info().special_exports(),
                                        isolate);
@@ -307,6 +299,12 @@ MaybeHandle<Cell> SourceTextModule::ResolveExportUsingStarExports(
       module->set_exports(*exports);
       return unique_cell;
     }
+
+    // The graph below |module| doesn't change during the instantiation, so
+    // remember that the name isn't there unless a cycle cut the search short.
+    if (resolve_set->cycles() == cycles) {
+      unresolvable_exports->Add(module, export_name);
+    }
   }
 
   // Unresolvable.
@@ -453,7 +451,7 @@ bool SourceTextModule::MaybeTransitionComponent(
 bool SourceTextModule::FinishInstantiate(
     Isolate* isolate, Handle<SourceTextModule> module,
     ZoneForwardList<Handle<SourceTextModule>>* stack, unsigned* dfs_index,
-    Zone* zone) {
+    Zone* zone, UnresolvableExports* unresolvable_exports) {
   // Instantiate SharedFunctionInfo and mark module as instantiating for
   // the recursion.
   Handle<SharedFunctionInfo> shared(SharedFunctionInfo::cast(module->code()),
@@ -474,7 +472,7 @@ bool SourceTextModule::FinishInstantiate(
     Handle<Module> requested_module(Module::cast(requested_modules->get(i)),
                                     isolate);
     if (!Module::FinishInstantiate(isolate, requested_module, stack, dfs_index,
-                                   zone)) {
+                                   zone, unresolvable_exports)) {
       return false;
     }
 
@@ -506,7 +504,7 @@ bool SourceTextModule::FinishInstantiate(
         SourceTextModuleInfoEntry::cast(regular_imports->get(i)), isolate);
     Handle<String> name(String::cast(entry->import_name()), isolate);
     MessageLocation loc(script, entry->beg_pos(), entry->end_pos());
-    ResolveSet resolve_set(zone);
+    ResolveSet resolve_set(zone, unresolvable_exports);
     Handle<Cell> cell;
     if (!ResolveImport(isolate, module, name, entry->module_request(), loc,
                        true, &resolve_set)
@@ -524,7 +522,7 @@ bool SourceTextModule::FinishInstantiate(
     Handle<Object> name(entry->export_name(), isolate);
     if (name->IsUndefined(isolate)) continue;  // Star export.
     MessageLocation loc(script, entry->beg_pos(), entry->end_pos());
-    ResolveSet resolve_set(zone);
+    ResolveSet resolve_set(zone, unresolvable_exports);
     if (ResolveExport(isolate, module, Handle<String>(),
                       Handle<String>::cast(name), loc, true, &resolve_set)
             .is_null()) {
@@ -165,7 +165,7 @@ class SourceTextModule
   static V8_WARN_UNUSED_RESULT bool FinishInstantiate(
       Isolate* isolate, Handle<SourceTextModule> module,
       ZoneForwardList<Handle<SourceTextModule>>* stack, unsigned* dfs_index,
-      Zone* zone);
+      Zone* zone, UnresolvableExports* unresolvable_exports);
   static V8_WARN_UNUSED_RESULT bool RunInitializationCode(
       Isolate* isolate, Handle<SourceTextModule> module);
 
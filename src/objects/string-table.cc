@@ -389,16 +389,17 @@ class InternalizedStringKey final : public StringTableKey {
     }
 
     // External strings get special treatment, to avoid copying their
-    // contents as long as they are not uncached.
+    // contents as long as they are not uncached. External resources are owned
+    // by a single isolate, so the shared string table copies their contents
+    // into a sequential string in the shared heap instead.
     StringShape shape(*string_);
-    if (shape.IsExternalOneByte() && !shape.IsUncachedExternal()) {
-      // TODO(syg): External strings not yet supported.
-      DCHECK(!FLAG_shared_string_table);
+    if (FLAG_shared_string_table) {
+      return isolate->factory()->NewInternalizedStringImpl(
+          string_, string_->length(), string_->raw_hash_field());
+    } else if (shape.IsExternalOneByte() && !shape.IsUncachedExternal()) {
       return isolate->factory()
           ->InternalizeExternalString<ExternalOneByteString>(string_);
     } else if (shape.IsExternalTwoByte() && !shape.IsUncachedExternal()) {
-      // TODO(syg): External strings not yet supported.
-      DCHECK(!FLAG_shared_string_table);
       return isolate->factory()
           ->InternalizeExternalString<ExternalTwoByteString>(string_);
     } else {
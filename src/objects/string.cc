@@ -4,6 +4,7 @@
 
 #include "src/objects/string.h"
 
+#include "src/base/memory.h"
 #include "src/common/assert-scope.h"
 #include "src/common/globals.h"
 #include "src/execution/isolate-utils.h"
@@ -789,12 +790,41 @@ void String::WriteToFlat(String source, sinkchar* sink, int start, int length,
   UNREACHABLE();
 }
 
+// Returns the index of the first character at or after |index| that may start
+// a line terminator sequence, or an index at the end of |src|.
+template <typename SourceChar>
+static int SkipToLineTerminator(base::Vector<const SourceChar> src,
+                                int index) {
+  return index;
+}
+
+// The only line terminators in one-byte strings are '\n' and '\r'. Skip whole
+// words without any character up to '\r'.
+template <>
+int SkipToLineTerminator(base::Vector<const uint8_t> src, int index) {
+  constexpr uintptr_t kOnes = ~uintptr_t{0} / 0xFF;
+  constexpr uintptr_t kHighBits = kOnes << 7;
+  constexpr uintptr_t kFirstNonTerminator = kOnes * ('\r' + 1);
+  constexpr int kWordSize = static_cast<int>(sizeof(uintptr_t));
+  const int length = src.length();
+  while (index + kWordSize <= length) {
+    uintptr_t word = base::ReadUnalignedValue<uintptr_t>(
+        reinterpret_cast<Address>(src.begin() + index));
+    // Non-zero iff some character of the word is below kFirstNonTerminator.
+    if ((word - kFirstNonTerminator) & ~word & kHighBits) break;
+    index += kWordSize;
+  }
+  while (index < length && src[index] > '\r') index++;
+  return index;
+}
+
 template <typename SourceChar>
 static void CalculateLineEndsImpl(std::vector<int>* line_ends,
                                   base::Vector<const SourceChar> src,
                                   bool include_ending_line) {
   const int src_len = src.length();
-  for (int i = 0; i < src_len - 1; i++) {
+  for (int i = SkipToLineTerminator(src, 0); i < src_len - 1;
+       i = SkipToLineTerminator(src, i + 1)) {
     SourceChar current = src[i];
     SourceChar next = src[i + 1];
     if (IsLineTerminatorSequence(current, next)) line_ends->push_back(i);
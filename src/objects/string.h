@@ -784,6 +784,12 @@ class ConsString : public TorqueGeneratedConsString<ConsString, String> {
   // Minimum length for a cons string.
   static const int kMinLength = 13;
 
+  // Appending a short string to a cons string whose second part is a short
+  // sequential string copies both into a new second part, as long as it does
+  // not exceed this length. Strings built by repeated appends then form chains
+  // of chunks rather than one cons string per append.
+  static const int kMaxChunkLength = 64;
+
   class BodyDescriptor;
 
   DECL_VERIFIER(ConsString)
@@ -821,8 +827,8 @@ class ThinString : public TorqueGeneratedThinString<ThinString, String> {
 // adding the offset to the start address.  A substring of a Sliced String
 // are not nested since the double indirection is simplified when creating
 // such a substring.
-// Currently missing features are:
-//  - truncating sliced string to enable otherwise unneeded parent to be GC'ed.
+// Scavenges replace short slices of much longer parents with sequential copies
+// (see kMaxCopiedLength), so that they do not keep their parent alive.
 class SlicedString : public TorqueGeneratedSlicedString<SlicedString, String> {
  public:
   inline void set_parent(String parent,
@@ -835,6 +841,12 @@ class SlicedString : public TorqueGeneratedSlicedString<SlicedString, String> {
   // Minimum length for a sliced string.
   static const int kMinLength = 13;
 
+  // The scavenger copies the characters of slices of at most kMaxCopiedLength
+  // characters into a sequential string if the parent is at least
+  // kMinParentToSliceRatio times as long.
+  static const int kMaxCopiedLength = 256;
+  static const int kMinParentToSliceRatio = 16;
+
   class BodyDescriptor;
 
   DECL_VERIFIER(SlicedString)
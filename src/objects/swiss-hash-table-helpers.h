@@ -31,15 +31,6 @@
 #define SWISS_TABLE_HAVE_SSE2 1
 #else
 #define SWISS_TABLE_HAVE_SSE2 0
-#if defined(V8_TARGET_ARCH_IA32) || defined(V8_TARGET_ARCH_X64)
-// TODO(v8:11388) Currently, building on a non-SSE platform for a SSE target
-// means that we cannot use the (more performant) SSE implementations of Swiss
-// Tables, even if the target would support it, just because the host doesn't.
-// This is due to the difference in group sizes (see comment at the beginning of
-// the file). We can solve this by implementating a new non-SSE Group that
-// behaves like GroupSse2Impl (and uses group size 16) in the future.
-#warning "You should avoid building on a non-SSE platform for a SSE target!"
-#endif
 #endif
 #endif
 
@@ -348,6 +339,76 @@ struct GroupPortableImpl {
   uint64_t ctrl;
 };
 
+// Behaves exactly like GroupSse2Impl (same group width, same bitmasks), but
+// only uses 64 bit integer operations, as two halves of GroupPortableImpl.
+// This lets targets whose generated code probes 16 control bytes at a time
+// with SIMD instructions share the table layout with C++ code that can't use
+// SSE2, e.g. arm64, or an SSE2 target built on a non-SSE host.
+struct GroupSse2Polyfill {
+  static constexpr size_t kWidth = 16;  // the number of slots per group
+
+  explicit GroupSse2Polyfill(const ctrl_t* pos) {
+    uintptr_t address = reinterpret_cast<uintptr_t>(const_cast<ctrl_t*>(pos));
+    ctrl[0] = base::ReadLittleEndianValue<uint64_t>(address);
+    ctrl[1] = base::ReadLittleEndianValue<uint64_t>(address + 8);
+  }
+
+  // Returns a bitmask representing the positions of slots that match |hash|.
+  BitMask<uint32_t, kWidth> Match(h2_t hash) const {
+    return BitMask<uint32_t, kWidth>(
+        ToBits(MatchZeroBytes(ctrl[0] ^ (kLsbs * hash))) |
+        ToBits(MatchZeroBytes(ctrl[1] ^ (kLsbs * hash))) << 8);
+  }
+
+  // Returns a bitmask representing the positions of empty slots.
+  BitMask<uint32_t, kWidth> MatchEmpty() const {
+    return Match(static_cast<h2_t>(kEmpty));
+  }
+
+  // Returns a bitmask representing the positions of empty or deleted slots.
+  BitMask<uint32_t, kWidth> MatchEmptyOrDeleted() const {
+    return BitMask<uint32_t, kWidth>(EmptyOrDeletedBits());
+  }
+
+  // Returns the number of trailing empty or deleted elements in the group.
+  uint32_t CountLeadingEmptyOrDeleted() const {
+    return base::bits::CountTrailingZerosNonZero(EmptyOrDeletedBits() + 1);
+  }
+
+  void ConvertSpecialToEmptyAndFullToDeleted(ctrl_t* dst) const {
+    for (int i = 0; i < 2; i++) {
+      auto x = ctrl[i] & kMsbs;
+      auto res = (~x + (x >> 7)) & ~kLsbs;
+      base::WriteLittleEndianValue(reinterpret_cast<uint64_t*>(dst + 8 * i),
+                                   res);
+    }
+  }
+
+  uint64_t ctrl[2];
+
+ private:
+  static constexpr uint64_t kMsbs = GroupPortableImpl::kMsbs;
+  static constexpr uint64_t kLsbs = GroupPortableImpl::kLsbs;
+
+  // Returns a byte mask with the MSB set in exactly the bytes of |x| that are
+  // zero. Unlike GroupPortableImpl::Match, this has no false positives, which
+  // keeps the results identical to GroupSse2Impl.
+  static uint64_t MatchZeroBytes(uint64_t x) {
+    return ~(((x & ~kMsbs) + ~kMsbs) | x | ~kMsbs);
+  }
+
+  // Turns a byte mask (only MSBs set) into a bitmask with one bit per byte.
+  static uint32_t ToBits(uint64_t byte_mask) {
+    return static_cast<uint32_t>(((byte_mask >> 7) * 0x0102040810204080ULL) >>
+                                 56);
+  }
+
+  uint32_t EmptyOrDeletedBits() const {
+    return ToBits(ctrl[0] & (~ctrl[0] << 7) & kMsbs) |
+           ToBits(ctrl[1] & (~ctrl[1] << 7) & kMsbs) << 8;
+  }
+};
+
 // Determine which Group implementation SwissNameDictionary uses.
 #if defined(V8_ENABLE_SWISS_NAME_DICTIONARY) && DEBUG
 // TODO(v8:11388) If v8_enable_swiss_name_dictionary is enabled, we are supposed
@@ -363,11 +424,21 @@ struct GroupPortableImpl {
 // to the non-SSE implementation. Given that V8 requires SSE2, there should be a
 // solution that doesn't require the workaround present here. Instead, the
 // backend should only use SSE2 when compiling the SIMD version of
-// SwissNameDictionary into the builtin.
+// SwissNameDictionary into the builtin. Targets whose SIMD baseline covers
+// the generated code, like arm64 with NEON, are not affected.
+#if defined(V8_TARGET_ARCH_ARM64)
+using Group = GroupSse2Polyfill;
+#else
 using Group = GroupPortableImpl;
+#endif
 #else
 #if SWISS_TABLE_HAVE_SSE2
 using Group = GroupSse2Impl;
+#elif defined(V8_TARGET_ARCH_IA32) || defined(V8_TARGET_ARCH_X64) || \
+    defined(V8_TARGET_ARCH_ARM64)
+// The generated code probes groups of 16 using SIMD instructions, so the C++
+// side needs the same group width, even without SSE2 on the host.
+using Group = GroupSse2Polyfill;
 #else
 using Group = GroupPortableImpl;
 #endif
@@ -13,6 +13,7 @@
 #include "src/api/api-inl.h"
 #include "src/base/logging.h"
 #include "src/base/platform/wrappers.h"
+#include "src/base/v8-fallthrough.h"
 #include "src/execution/isolate.h"
 #include "src/flags/flags.h"
 #include "src/handles/global-handles-inl.h"
@@ -49,6 +50,9 @@ namespace internal {
 // Version 12: regexp and string objects share normal string encoding
 // Version 13: host objects have an explicit tag (rather than handling all
 //             unknown tags)
+// Version 14: repeated string property keys are written as references to
+//             their first occurrence, and external strings can be passed by
+//             reference through the delegate
 //
 // WARNING: Increasing this value is a change which cannot safely be rolled
 // back without breaking compatibility with data stored on disk. It is
@@ -57,7 +61,7 @@ namespace internal {
 //
 // Recent changes are routinely reverted in preparation for branch, and this
 // has been the cause of at least one bug in the past.
-static const uint32_t kLatestVersion = 13;
+static const uint32_t kLatestVersion = 14;
 static_assert(kLatestVersion == v8::CurrentValueSerializerFormatVersion(),
               "Exported format version must match latest version.");
 
@@ -101,8 +105,15 @@ enum class SerializationTag : uint8_t {
   kUtf8String = 'S',
   kOneByteString = '"',
   kTwoByteString = 'c',
+  // External string passed by reference (since v14), see
+  // ValueSerializer::Delegate::GetExternalStringId. stringID:uint32_t
+  kExternalStringReference = 'E',
   // Reference to a serialized object. objectID:uint32_t
   kObjectReference = '^',
+  // Reference to a string property key written earlier in the same message
+  // (since v14). Keys are numbered in the order of their first occurrence.
+  // keyID:uint32_t
+  kObjectKeyReference = 'q',
   // Beginning of a JS object.
   kBeginJSObject = 'o',
   // End of a JS object. numProperties:uint32_t
@@ -247,7 +258,8 @@ ValueSerializer::ValueSerializer(Isolate* isolate,
       zone_(isolate->allocator(), ZONE_NAME),
       id_map_(isolate->heap(), ZoneAllocationPolicy(&zone_)),
       array_buffer_transfer_map_(isolate->heap(),
-                                 ZoneAllocationPolicy(&zone_)) {}
+                                 ZoneAllocationPolicy(&zone_)),
+      key_map_(isolate->heap(), ZoneAllocationPolicy(&zone_)) {}
 
 ValueSerializer::~ValueSerializer() {
   if (buffer_) {
@@ -442,7 +454,11 @@ Maybe<bool> ValueSerializer::WriteObject(Handle<Object> object) {
     }
     default:
       if (object->IsString()) {
-        WriteString(Handle<String>::cast(object));
+        Handle<String> string = Handle<String>::cast(object);
+        if (delegate_ && string->IsExternalString()) {
+          return WriteExternalString(string);
+        }
+        WriteString(string);
         return ThrowIfOutOfMemory();
       } else if (object->IsJSReceiver()) {
         return WriteJSReceiver(Handle<JSReceiver>::cast(object));
@@ -512,6 +528,39 @@ void ValueSerializer::WriteString(Handle<String> string) {
   }
 }
 
+Maybe<bool> ValueSerializer::WriteExternalString(Handle<String> string) {
+  DCHECK_NOT_NULL(delegate_);
+  v8::Isolate* v8_isolate = reinterpret_cast<v8::Isolate*>(isolate_);
+  uint32_t id;
+  Maybe<bool> by_reference =
+      delegate_->GetExternalStringId(v8_isolate, Utils::ToLocal(string), &id);
+  RETURN_VALUE_IF_SCHEDULED_EXCEPTION(isolate_, Nothing<bool>());
+
+  if (by_reference.FromMaybe(false)) {
+    WriteTag(SerializationTag::kExternalStringReference);
+    WriteVarint(id);
+  } else {
+    WriteString(string);
+  }
+  return ThrowIfOutOfMemory();
+}
+
+Maybe<bool> ValueSerializer::WriteObjectKey(Handle<Object> key) {
+  if (!key->IsString()) return WriteObject(key);
+
+  // If the key has already been written, just write its ID. Objects of the
+  // same shape then share the bytes of their keys.
+  auto find_result = key_map_.FindOrInsert(key);
+  if (find_result.already_exists) {
+    WriteTag(SerializationTag::kObjectKeyReference);
+    WriteVarint(*find_result.entry - 1);
+    return ThrowIfOutOfMemory();
+  }
+  *find_result.entry = ++next_key_id_;
+  WriteString(Handle<String>::cast(key));
+  return ThrowIfOutOfMemory();
+}
+
 Maybe<bool> ValueSerializer::WriteJSReceiver(Handle<JSReceiver> receiver) {
   // If the object has already been serialized, just write its ID.
   auto find_result = id_map_.FindOrInsert(receiver);
@@ -636,7 +685,7 @@ Maybe<bool> ValueSerializer::WriteJSObject(Handle<JSObject> object) {
       if (!Object::GetProperty(&it).ToHandle(&value)) return Nothing<bool>();
     }
 
-    if (!WriteObject(key).FromMaybe(false) ||
+    if (!WriteObjectKey(key).FromMaybe(false) ||
         !WriteObject(value).FromMaybe(false)) {
       return Nothing<bool>();
     }
@@ -1078,7 +1127,7 @@ Maybe<uint32_t> ValueSerializer::WriteJSObjectPropertiesSlow(
     // This could happen if a getter deleted the property.
     if (!it.IsFound()) continue;
 
-    if (!WriteObject(key).FromMaybe(false) ||
+    if (!WriteObjectKey(key).FromMaybe(false) ||
         !WriteObject(value).FromMaybe(false)) {
       return Nothing<uint32_t>();
     }
@@ -1123,6 +1172,8 @@ ValueDeserializer::ValueDeserializer(Isolate* isolate,
       position_(data.begin()),
       end_(data.end()),
       id_map_(isolate->global_handles()->Create(
+          ReadOnlyRoots(isolate_).empty_fixed_array())),
+      key_map_(isolate->global_handles()->Create(
           ReadOnlyRoots(isolate_).empty_fixed_array())) {}
 
 ValueDeserializer::ValueDeserializer(Isolate* isolate, const uint8_t* data,
@@ -1132,10 +1183,13 @@ ValueDeserializer::ValueDeserializer(Isolate* isolate, const uint8_t* data,
       position_(data),
       end_(data + size),
       id_map_(isolate->global_handles()->Create(
+          ReadOnlyRoots(isolate_).empty_fixed_array())),
+      key_map_(isolate->global_handles()->Create(
           ReadOnlyRoots(isolate_).empty_fixed_array())) {}
 
 ValueDeserializer::~ValueDeserializer() {
   GlobalHandles::Destroy(id_map_.location());
+  GlobalHandles::Destroy(key_map_.location());
 
   Handle<Object> transfer_map_handle;
   if (array_buffer_transfer_map_.ToHandle(&transfer_map_handle)) {
@@ -1389,6 +1443,9 @@ MaybeHandle<Object> ValueDeserializer::ReadObjectInternal() {
 #endif  // V8_ENABLE_WEBASSEMBLY
     case SerializationTag::kHostObject:
       return ReadHostObject();
+    case SerializationTag::kExternalStringReference:
+      if (version_ >= 14) return ReadExternalString();
+      V8_FALLTHROUGH;
     default:
       // Before there was an explicit tag for host objects, all unknown tags
       // were delegated to the host.
@@ -1473,6 +1530,20 @@ MaybeHandle<String> ValueDeserializer::ReadTwoByteString() {
   return string;
 }
 
+MaybeHandle<String> ValueDeserializer::ReadExternalString() {
+  uint32_t id;
+  Local<String> string;
+  if (!ReadVarint<uint32_t>().To(&id) || delegate_ == nullptr ||
+      !delegate_
+           ->GetExternalStringFromId(reinterpret_cast<v8::Isolate*>(isolate_),
+                                     id)
+           .ToLocal(&string)) {
+    RETURN_EXCEPTION_IF_SCHEDULED_EXCEPTION(isolate_, String);
+    return MaybeHandle<String>();
+  }
+  return Utils::OpenHandle(*string);
+}
+
 bool ValueDeserializer::ReadExpectedString(Handle<String> expected) {
   DisallowGarbageCollection no_gc;
   // In the case of failure, the position in the stream is reset.
@@ -1519,6 +1590,50 @@ bool ValueDeserializer::ReadExpectedString(Handle<String> expected) {
   return false;
 }
 
+bool ValueDeserializer::ReadExpectedObjectKey(Handle<String> expected) {
+  DCHECK(expected->IsInternalizedString());
+  SerializationTag tag;
+  if (version_ >= 14 && PeekTag().To(&tag) &&
+      tag == SerializationTag::kObjectKeyReference) {
+    // In the case of failure, the position in the stream is reset.
+    const uint8_t* original_position = position_;
+    ConsumeTag(tag);
+    uint32_t key_id;
+    if (ReadVarint<uint32_t>().To(&key_id) && key_id < next_key_id_ &&
+        key_map_->get(key_id) == *expected) {
+      return true;
+    }
+    position_ = original_position;
+    return false;
+  }
+  if (!ReadExpectedString(expected)) return false;
+  if (version_ >= 14) AddObjectKey(expected);
+  return true;
+}
+
+MaybeHandle<Object> ValueDeserializer::ReadObjectKey() {
+  SerializationTag tag;
+  if (version_ >= 14 && PeekTag().To(&tag) &&
+      tag == SerializationTag::kObjectKeyReference) {
+    ConsumeTag(tag);
+    uint32_t key_id;
+    if (!ReadVarint<uint32_t>().To(&key_id) || key_id >= next_key_id_) {
+      return MaybeHandle<Object>();
+    }
+    return handle(key_map_->get(key_id), isolate_);
+  }
+
+  Handle<Object> key;
+  if (!ReadObject().ToHandle(&key)) return MaybeHandle<Object>();
+  if (key->IsString()) {
+    Handle<String> string =
+        isolate_->factory()->InternalizeString(Handle<String>::cast(key));
+    if (version_ >= 14) AddObjectKey(string);
+    return string;
+  }
+  return key;
+}
+
 MaybeHandle<JSObject> ValueDeserializer::ReadJSObject() {
   // If we are at the end of the stack, abort. This function may recurse.
   STACK_CHECK(isolate_, MaybeHandle<JSObject>());
@@ -2101,16 +2216,14 @@ Maybe<uint32_t> ValueDeserializer::ReadJSObjectProperties(
       Handle<Map> target;
       TransitionsAccessor transitions(isolate_, map);
       Handle<String> expected_key = transitions.ExpectedTransitionKey();
-      if (!expected_key.is_null() && ReadExpectedString(expected_key)) {
+      if (!expected_key.is_null() && ReadExpectedObjectKey(expected_key)) {
         key = expected_key;
         target = transitions.ExpectedTransitionTarget();
       } else {
-        if (!ReadObject().ToHandle(&key) || !IsValidObjectKey(key)) {
+        if (!ReadObjectKey().ToHandle(&key) || !IsValidObjectKey(key)) {
           return Nothing<uint32_t>();
         }
         if (key->IsString()) {
-          key =
-              isolate_->factory()->InternalizeString(Handle<String>::cast(key));
           // Don't reuse |transitions| because it could be stale.
           transitioning = TransitionsAccessor(isolate_, map)
                               .FindTransitionToField(Handle<String>::cast(key))
@@ -2189,7 +2302,7 @@ Maybe<uint32_t> ValueDeserializer::ReadJSObjectProperties(
     }
 
     Handle<Object> key;
-    if (!ReadObject().ToHandle(&key) || !IsValidObjectKey(key)) {
+    if (!ReadObjectKey().ToHandle(&key) || !IsValidObjectKey(key)) {
       return Nothing<uint32_t>();
     }
     Handle<Object> value;
@@ -2221,6 +2334,18 @@ MaybeHandle<JSReceiver> ValueDeserializer::GetObjectWithID(uint32_t id) {
   return Handle<JSReceiver>(JSReceiver::cast(value), isolate_);
 }
 
+void ValueDeserializer::AddObjectKey(Handle<String> key) {
+  DCHECK(key->IsInternalizedString());
+  Handle<FixedArray> new_array =
+      FixedArray::SetAndGrow(isolate_, key_map_, next_key_id_++, key);
+
+  // If the list was reallocated, update the global handle.
+  if (!new_array.is_identical_to(key_map_)) {
+    GlobalHandles::Destroy(key_map_.location());
+    key_map_ = isolate_->global_handles()->Create(*new_array);
+  }
+}
+
 void ValueDeserializer::AddObjectWithID(uint32_t id,
                                         Handle<JSReceiver> object) {
   DCHECK(!HasObjectWithID(id));
@@ -117,6 +117,8 @@ class ValueSerializer {
   void WriteHeapNumber(HeapNumber number);
   void WriteBigInt(BigInt bigint);
   void WriteString(Handle<String> string);
+  Maybe<bool> WriteExternalString(Handle<String> string) V8_WARN_UNUSED_RESULT;
+  Maybe<bool> WriteObjectKey(Handle<Object> key) V8_WARN_UNUSED_RESULT;
   Maybe<bool> WriteJSReceiver(Handle<JSReceiver> receiver)
       V8_WARN_UNUSED_RESULT;
   Maybe<bool> WriteJSObject(Handle<JSObject> object) V8_WARN_UNUSED_RESULT;
@@ -175,6 +177,11 @@ class ValueSerializer {
 
   // A similar map, for transferred array buffers.
   IdentityMap<uint32_t, ZoneAllocationPolicy> array_buffer_transfer_map_;
+
+  // A similar map, for string property keys. Records with the same shape then
+  // only write their keys once.
+  IdentityMap<uint32_t, ZoneAllocationPolicy> key_map_;
+  uint32_t next_key_id_ = 0;
 };
 
 /*
@@ -252,6 +259,9 @@ class ValueDeserializer {
   // Returns true if this was the case. Otherwise, nothing is consumed.
   bool ReadExpectedString(Handle<String> expected) V8_WARN_UNUSED_RESULT;
 
+  // Like ReadExpectedString, but also accepts a reference to an earlier key.
+  bool ReadExpectedObjectKey(Handle<String> expected) V8_WARN_UNUSED_RESULT;
+
   // Like ReadObject, but skips logic for special cases in simulating the
   // "stack machine".
   MaybeHandle<Object> ReadObjectInternal() V8_WARN_UNUSED_RESULT;
@@ -261,12 +271,17 @@ class ValueDeserializer {
   // permissible for a string (with the relevant tag).
   MaybeHandle<String> ReadString() V8_WARN_UNUSED_RESULT;
 
+  // Reads a property key, which may be a reference to an earlier string key
+  // (since v14). String keys are returned internalized.
+  MaybeHandle<Object> ReadObjectKey() V8_WARN_UNUSED_RESULT;
+
   // Reading V8 objects of specific kinds.
   // The tag is assumed to have already been read.
   MaybeHandle<BigInt> ReadBigInt() V8_WARN_UNUSED_RESULT;
   MaybeHandle<String> ReadUtf8String() V8_WARN_UNUSED_RESULT;
   MaybeHandle<String> ReadOneByteString() V8_WARN_UNUSED_RESULT;
   MaybeHandle<String> ReadTwoByteString() V8_WARN_UNUSED_RESULT;
+  MaybeHandle<String> ReadExternalString() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSObject> ReadJSObject() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArray> ReadSparseJSArray() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArray> ReadDenseJSArray() V8_WARN_UNUSED_RESULT;
@@ -302,15 +317,20 @@ class ValueDeserializer {
   MaybeHandle<JSReceiver> GetObjectWithID(uint32_t id);
   void AddObjectWithID(uint32_t id, Handle<JSReceiver> object);
 
+  // Manipulating the list of string keys that can be referenced.
+  void AddObjectKey(Handle<String> key);
+
   Isolate* const isolate_;
   v8::ValueDeserializer::Delegate* const delegate_;
   const uint8_t* position_;
   const uint8_t* const end_;
   uint32_t version_ = 0;
   uint32_t next_id_ = 0;
+  uint32_t next_key_id_ = 0;
 
   // Always global handles.
   Handle<FixedArray> id_map_;
+  Handle<FixedArray> key_map_;
   MaybeHandle<SimpleNumberDictionary> array_buffer_transfer_map_;
 };
 
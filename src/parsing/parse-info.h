@@ -9,6 +9,7 @@
 #include <memory>
 #include <vector>
 
+#include "include/v8-script.h"
 #include "src/base/bit-field.h"
 #include "src/base/export-template.h"
 #include "src/base/logging.h"
@@ -315,6 +316,18 @@ class V8_EXPORT_PRIVATE ParseInfo {
     max_function_literal_id_ = max_function_literal_id;
   }
 
+  // Whether the embedder hinted that the lazy function at |position| will
+  // likely be called, see v8::ScriptCompiler::CompileHintCallback.
+  bool HasCompileHint(int position) const {
+    return compile_hint_callback_ != nullptr &&
+           compile_hint_callback_(position, compile_hint_callback_data_);
+  }
+  void set_compile_hint_callback(
+      v8::ScriptCompiler::CompileHintCallback callback, void* data) {
+    compile_hint_callback_ = callback;
+    compile_hint_callback_data_ = data;
+  }
+
   void AllocateSourceRangeMap();
   SourceRangeMap* source_range_map() const { return source_range_map_; }
   void set_source_range_map(SourceRangeMap* source_range_map) {
@@ -340,6 +353,8 @@ class V8_EXPORT_PRIVATE ParseInfo {
   uintptr_t stack_limit_;
   int parameters_end_pos_;
   int max_function_literal_id_;
+  v8::ScriptCompiler::CompileHintCallback compile_hint_callback_ = nullptr;
+  void* compile_hint_callback_data_ = nullptr;
 
   //----------- Inputs+Outputs of parsing and scope analysis -----------------
   std::unique_ptr<Utf16CharacterStream> character_stream_;
@@ -2592,11 +2592,14 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
 
   // If parallel compile tasks are enabled, and the function is an eager
   // top level function, then we can pre-parse the function and parse / compile
-  // in a parallel task on a worker thread.
-  bool should_post_parallel_task =
-      parse_lazily() && is_eager_top_level_function &&
-      FLAG_parallel_compile_tasks && info()->parallel_tasks() &&
+  // in a parallel task on a worker thread. Large lazy top level functions can
+  // optionally be posted too (see --parallel-compile-lazy-function-size).
+  const bool can_post_parallel_task =
+      parse_lazily() && FLAG_parallel_compile_tasks &&
+      info()->parallel_tasks() &&
       scanner()->stream()->can_be_cloned_for_parallel_access();
+  bool should_post_parallel_task =
+      can_post_parallel_task && is_eager_top_level_function;
 
   // This may be modified later to reflect preparsing decision taken
   bool should_preparse = (parse_lazily() && is_lazy_top_level_function) ||
@@ -2644,6 +2647,16 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
                   &num_parameters, &function_length, &has_duplicate_parameters,
                   &expected_property_count, &suspend_count,
                   arguments_for_wrapped_function);
+  } else if (can_post_parallel_task && is_lazy_top_level_function &&
+             ((FLAG_parallel_compile_lazy_function_size > 0 &&
+               scope->end_position() - scope->start_position() >=
+                   FLAG_parallel_compile_lazy_function_size) ||
+              info()->HasCompileHint(scope->start_position()))) {
+    // The preparser found the boundaries of a large lazy top level function,
+    // or one the embedder expects to be called, which would otherwise be parsed
+    // and compiled again on the main thread on its first call. Do that in a
+    // parallel task instead.
+    should_post_parallel_task = true;
   }
 
   if (V8_UNLIKELY(FLAG_log_function_events)) {
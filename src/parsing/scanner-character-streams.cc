@@ -155,40 +155,43 @@ class ChunkedStream {
   explicit ChunkedStream(ScriptCompiler::ExternalSourceStream* source)
       : source_(source) {}
 
-  ChunkedStream(const ChunkedStream&) V8_NOEXCEPT {
-    // TODO(rmcilroy): Implement cloning for chunked streams.
-    UNREACHABLE();
-  }
+  // A clone shares the chunks that have arrived so far, but does not fetch any
+  // more; it behaves as if the source ended after them. This is enough to
+  // parse a function whose closing brace has already been seen.
+  ChunkedStream(const ChunkedStream& other) V8_NOEXCEPT
+      : source_(nullptr),
+        chunks_(other.chunks_) {}
 
   // The no_gc argument is only here because of the templated way this class
   // is used along with other implementations that require V8 heap access.
   Range<Char> GetDataAt(size_t pos, RuntimeCallStats* stats,
                         DisallowGarbageCollection* no_gc = nullptr) {
-    Chunk chunk = FindChunk(pos, stats);
+    const Chunk& chunk = FindChunk(pos, stats);
     size_t buffer_end = chunk.length;
     size_t buffer_pos = std::min(buffer_end, pos - chunk.position);
-    return {&chunk.data[buffer_pos], &chunk.data[buffer_end]};
-  }
-
-  ~ChunkedStream() {
-    for (Chunk& chunk : chunks_) delete[] chunk.data;
+    return {&chunk.data()[buffer_pos], &chunk.data()[buffer_end]};
   }
 
-  static const bool kCanBeCloned = false;
+  static const bool kCanBeCloned = true;
   static const bool kCanAccessHeap = false;
 
  private:
   struct Chunk {
     Chunk(const Char* const data, size_t position, size_t length)
-        : data(data), position(position), length(length) {}
-    const Char* const data;
+        : owned_data(data, [](const Char* data) { delete[] data; }),
+          position(position),
+          length(length) {}
+    // Chunks are shared with clones of the stream, which may be used on other
+    // threads, so they are reference counted.
+    std::shared_ptr<const Char> owned_data;
     // The logical position of data.
-    const size_t position;
-    const size_t length;
+    size_t position;
+    size_t length;
+    const Char* data() const { return owned_data.get(); }
     size_t end_position() const { return position + length; }
   };
 
-  Chunk FindChunk(size_t position, RuntimeCallStats* stats) {
+  const Chunk& FindChunk(size_t position, RuntimeCallStats* stats) {
     while (V8_UNLIKELY(chunks_.empty())) FetchChunk(size_t{0}, stats);
 
     // Walk forwards while the position is in front of the current chunk.
@@ -216,8 +219,8 @@ class ChunkedStream {
 
   void FetchChunk(size_t position, RuntimeCallStats* stats) {
     const uint8_t* data = nullptr;
-    size_t length;
-    {
+    size_t length = 0;
+    if (source_ != nullptr) {
       RCS_SCOPE(stats, RuntimeCallCounterId::kGetMoreDataCallback);
       length = source_->GetMoreData(&data);
     }
@@ -11,6 +11,7 @@
 #include <cmath>
 
 #include "src/ast/ast-value-factory.h"
+#include "src/base/bits.h"
 #include "src/base/platform/wrappers.h"
 #include "src/base/strings.h"
 #include "src/numbers/conversions-inl.h"
@@ -19,6 +20,15 @@
 #include "src/parsing/scanner-inl.h"
 #include "src/zone/zone.h"
 
+#if defined(__SSE2__) || \
+    (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86)))
+#include <emmintrin.h>
+#define V8_SCANNER_USE_SSE2 1
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define V8_SCANNER_USE_NEON 1
+#endif
+
 namespace v8 {
 namespace internal {
 
@@ -205,13 +215,71 @@ Token::Value Scanner::SkipSingleHTMLComment() {
   return SkipSingleLineComment();
 }
 
+// static
+template <bool stop_at_line_terminator>
+const uint16_t* Utf16CharacterStream::FindCharOrLineTerminator(
+    const uint16_t* start, const uint16_t* end, uint16_t c) {
+  // Line terminators are LF, CR, and U+2028 / U+2029, which only differ in
+  // their lowest bit.
+  constexpr uint16_t kLineSeparatorMask = 0xFFFE;
+  STATIC_ASSERT((0x2028 & kLineSeparatorMask) == (0x2029 & kLineSeparatorMask));
+  constexpr int kLanes = 8;
+#if V8_SCANNER_USE_SSE2
+  const __m128i target = _mm_set1_epi16(static_cast<int16_t>(c));
+  const __m128i lf = _mm_set1_epi16('\n');
+  const __m128i cr = _mm_set1_epi16('\r');
+  const __m128i ls_mask =
+      _mm_set1_epi16(static_cast<int16_t>(kLineSeparatorMask));
+  const __m128i ls = _mm_set1_epi16(0x2028);
+  for (; end - start >= kLanes; start += kLanes) {
+    __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(start));
+    __m128i match = _mm_cmpeq_epi16(units, target);
+    if (stop_at_line_terminator) {
+      match = _mm_or_si128(match, _mm_cmpeq_epi16(units, lf));
+      match = _mm_or_si128(match, _mm_cmpeq_epi16(units, cr));
+      match = _mm_or_si128(
+          match, _mm_cmpeq_epi16(_mm_and_si128(units, ls_mask), ls));
+    }
+    int mask = _mm_movemask_epi8(match);
+    if (mask != 0) {
+      // Each 16-bit lane contributes two bits to the byte mask.
+      return start + base::bits::CountTrailingZeros(mask) / 2;
+    }
+  }
+#elif V8_SCANNER_USE_NEON
+  const uint16x8_t target = vdupq_n_u16(c);
+  const uint16x8_t lf = vdupq_n_u16('\n');
+  const uint16x8_t cr = vdupq_n_u16('\r');
+  const uint16x8_t ls_mask = vdupq_n_u16(kLineSeparatorMask);
+  const uint16x8_t ls = vdupq_n_u16(0x2028);
+  for (; end - start >= kLanes; start += kLanes) {
+    uint16x8_t units = vld1q_u16(start);
+    uint16x8_t match = vceqq_u16(units, target);
+    if (stop_at_line_terminator) {
+      match = vorrq_u16(match, vceqq_u16(units, lf));
+      match = vorrq_u16(match, vceqq_u16(units, cr));
+      match = vorrq_u16(match, vceqq_u16(vandq_u16(units, ls_mask), ls));
+    }
+    // Find the exact position in the scalar loop below.
+    if (vmaxvq_u16(match) != 0) break;
+  }
+#endif
+  for (; start < end; ++start) {
+    if (*start == c) return start;
+    if (stop_at_line_terminator && unibrow::IsLineTerminator(*start)) {
+      return start;
+    }
+  }
+  return end;
+}
+
 Token::Value Scanner::SkipSingleLineComment() {
   // The line terminator at the end of the line is not considered
   // to be part of the single-line comment; it is recognized
   // separately by the lexical grammar and becomes part of the
   // stream of input elements for the syntactic grammar (see
   // ECMA-262, section 7.4).
-  AdvanceUntil([](base::uc32 c0_) { return unibrow::IsLineTerminator(c0_); });
+  AdvanceUntilCharOrLineTerminator<true>('\n');
 
   return Token::WHITESPACE;
 }
@@ -278,13 +346,7 @@ Token::Value Scanner::SkipMultiLineComment() {
   // Until we see the first newline, check for * and newline characters.
   if (!next().after_line_terminator) {
     do {
-      AdvanceUntil([](base::uc32 c0) {
-        if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
-          return unibrow::IsLineTerminator(c0);
-        }
-        uint8_t char_flags = character_scan_flags[c0];
-        return MultilineCommentCharacterNeedsSlowPath(char_flags);
-      });
+      AdvanceUntilCharOrLineTerminator<true>('*');
 
       while (c0_ == '*') {
         Advance();
@@ -303,7 +365,7 @@ Token::Value Scanner::SkipMultiLineComment() {
 
   // After we've seen newline, simply try to find '*/'.
   while (c0_ != kEndOfInput) {
-    AdvanceUntil([](base::uc32 c0) { return c0 == '*'; });
+    AdvanceUntilCharOrLineTerminator<false>('*');
 
     while (c0_ == '*') {
       Advance();
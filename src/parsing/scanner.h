@@ -94,6 +94,29 @@ class Utf16CharacterStream {
     }
   }
 
+  // Like AdvanceUntil, but stops at the next code unit that is {c} or, if
+  // {stop_at_line_terminator} is set, a line terminator. This is the common
+  // case when skipping comments, and is checked for several code units at a
+  // time where SIMD instructions are available.
+  template <bool stop_at_line_terminator>
+  V8_INLINE base::uc32 AdvanceUntilCharOrLineTerminator(uint16_t c) {
+    while (true) {
+      const uint16_t* next_cursor_pos =
+          FindCharOrLineTerminator<stop_at_line_terminator>(buffer_cursor_,
+                                                            buffer_end_, c);
+      if (next_cursor_pos == buffer_end_) {
+        buffer_cursor_ = buffer_end_;
+        if (!ReadBlockChecked(pos())) {
+          buffer_cursor_++;
+          return kEndOfInput;
+        }
+      } else {
+        buffer_cursor_ = next_cursor_pos + 1;
+        return static_cast<base::uc32>(*next_cursor_pos);
+      }
+    }
+  }
+
   // Go back one by one character in the input stream.
   // This undoes the most recent Advance().
   inline void Back() {
@@ -142,6 +165,13 @@ class Utf16CharacterStream {
   }
 
  protected:
+  // Returns the first code unit in [start, end) that is {c} or, if requested,
+  // a line terminator, or {end} if there is none.
+  template <bool stop_at_line_terminator>
+  static const uint16_t* FindCharOrLineTerminator(const uint16_t* start,
+                                                  const uint16_t* end,
+                                                  uint16_t c);
+
   Utf16CharacterStream(const uint16_t* buffer_start,
                        const uint16_t* buffer_cursor,
                        const uint16_t* buffer_end, size_t buffer_pos)
@@ -535,6 +565,11 @@ class V8_EXPORT_PRIVATE Scanner {
     c0_ = source_->AdvanceUntil(check);
   }
 
+  template <bool stop_at_line_terminator>
+  V8_INLINE void AdvanceUntilCharOrLineTerminator(uint16_t c) {
+    c0_ = source_->AdvanceUntilCharOrLineTerminator<stop_at_line_terminator>(c);
+  }
+
   bool CombineSurrogatePair() {
     DCHECK(!unibrow::Utf16::IsLeadSurrogate(kEndOfInput));
     if (unibrow::Utf16::IsLeadSurrogate(c0_)) {
@@ -4,8 +4,10 @@
 
 #include "src/profiler/cpu-profiler.h"
 
+#include <algorithm>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "include/v8-locker.h"
 #include "src/base/lazy-instance.h"
@@ -19,8 +21,9 @@
 #include "src/logging/log.h"
 #include "src/profiler/cpu-profiler-inl.h"
 #include "src/profiler/profiler-stats.h"
+#include "src/profiler/stack-sample-aggregator.h"
 #include "src/profiler/symbolizer.h"
-#include "src/utils/locked-queue-inl.h"
+#include "src/utils/mpsc-queue-inl.h"
 
 #if V8_ENABLE_WEBASSEMBLY
 #include "src/wasm/wasm-engine.h"
@@ -52,6 +55,7 @@ class CpuSampler : public sampler::Sampler {
     if (sample == nullptr) {
       ProfilerStats::Instance()->AddReason(
           ProfilerStats::Reason::kTickBufferFull);
+      processor_->AddDroppedSample();
       return;
     }
     // Every bailout up until here resulted in a dropped sample. From now on,
@@ -71,6 +75,81 @@ class CpuSampler : public sampler::Sampler {
   Isolate::PerIsolateThreadData* perThreadData_;
 };
 
+namespace {
+
+// With --cpu-profiler-shared-sampler, triggers the samples of all
+// SamplingEventsProcessors in the process, so that profiling many isolates
+// costs one timer thread rather than one per profiler. The processor threads
+// then only process the samples, in larger batches.
+class SharedSamplerThread : public base::Thread {
+ public:
+  SharedSamplerThread()
+      : Thread(Thread::Options("v8:ProfSampler", kProfilerStackSize)) {}
+
+  void AddProcessor(SamplingEventsProcessor* processor) {
+    base::MutexGuard guard(&mutex_);
+    if (!started_) {
+      CHECK(Start());
+      started_ = true;
+    }
+    processors_.push_back(
+        {processor,
+         base::TimeTicks::HighResolutionNow() + processor->period()});
+    cond_.NotifyOne();
+  }
+
+  // Once this returns, the processor's sampler is no longer used.
+  void RemoveProcessor(SamplingEventsProcessor* processor) {
+    base::MutexGuard guard(&mutex_);
+    auto it = std::find_if(
+        processors_.begin(), processors_.end(),
+        [=](const Client& client) { return client.processor == processor; });
+    DCHECK(it != processors_.end());
+    processors_.erase(it);
+  }
+
+  void Run() override {
+    base::MutexGuard guard(&mutex_);
+    while (true) {
+      if (processors_.empty()) {
+        cond_.Wait(&mutex_);
+        continue;
+      }
+      base::TimeTicks now = base::TimeTicks::HighResolutionNow();
+      base::TimeTicks next_sample_time = base::TimeTicks::Max();
+      for (Client& client : processors_) {
+        if (client.next_sample_time <= now) {
+          client.processor->sampler()->DoSample();
+          client.next_sample_time = now + client.processor->period();
+        }
+        next_sample_time = std::min(next_sample_time, client.next_sample_time);
+      }
+      if (next_sample_time > now) {
+        cond_.WaitFor(&mutex_, next_sample_time - now);
+      }
+    }
+  }
+
+ private:
+  struct Client {
+    SamplingEventsProcessor* processor;
+    base::TimeTicks next_sample_time;
+  };
+
+  base::Mutex mutex_;
+  base::ConditionVariable cond_;
+  std::vector<Client> processors_;
+  bool started_ = false;
+};
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(SharedSamplerThread, GetSharedSamplerThread)
+
+// The number of sampling periods a processor waits between processing rounds
+// when it does not trigger the samples itself.
+const int kSharedSamplerProcessingPeriods = 8;
+
+}  // namespace
+
 ProfilingScope::ProfilingScope(Isolate* isolate, ProfilerListener* listener)
     : isolate_(isolate), listener_(listener) {
   size_t profiler_count = isolate_->num_cpu_profilers();
@@ -106,11 +185,13 @@ ProfilingScope::~ProfilingScope() {
 
 ProfilerEventsProcessor::ProfilerEventsProcessor(
     Isolate* isolate, Symbolizer* symbolizer,
-    ProfilerCodeObserver* code_observer, CpuProfilesCollection* profiles)
+    ProfilerCodeObserver* code_observer, CpuProfilesCollection* profiles,
+    StackSampleAggregator* aggregator)
     : Thread(Thread::Options("v8:ProfEvntProc", kProfilerStackSize)),
       symbolizer_(symbolizer),
       code_observer_(code_observer),
       profiles_(profiles),
+      aggregator_(aggregator),
       last_code_event_id_(0),
       last_processed_code_event_id_(0),
       isolate_(isolate) {
@@ -121,12 +202,17 @@ ProfilerEventsProcessor::ProfilerEventsProcessor(
 SamplingEventsProcessor::SamplingEventsProcessor(
     Isolate* isolate, Symbolizer* symbolizer,
     ProfilerCodeObserver* code_observer, CpuProfilesCollection* profiles,
-    base::TimeDelta period, bool use_precise_sampling)
-    : ProfilerEventsProcessor(isolate, symbolizer, code_observer, profiles),
+    base::TimeDelta period, bool use_precise_sampling,
+    StackSampleAggregator* aggregator)
+    : ProfilerEventsProcessor(isolate, symbolizer, code_observer, profiles,
+                              aggregator),
       sampler_(new CpuSampler(isolate, this)),
       period_(period),
       use_precise_sampling_(use_precise_sampling) {
   sampler_->Start();
+  if (FLAG_cpu_profiler_cpu_time_sampling) {
+    sampler_->StartCpuTimeSampling(period_);
+  }
 }
 
 SamplingEventsProcessor::~SamplingEventsProcessor() { sampler_->Stop(); }
@@ -190,6 +276,8 @@ void ProfilerEventsProcessor::StopSynchronously() {
 bool ProfilerEventsProcessor::ProcessCodeEvent() {
   CodeEventsContainer record;
   if (events_buffer_.Dequeue(&record)) {
+    // The pending streamed stacks were sampled against the current code map.
+    if (aggregator_) aggregator_->Flush(symbolizer_);
     if (record.generic.type == CodeEventRecord::NATIVE_CONTEXT_MOVE) {
       NativeContextMoveEventRecord& nc_record =
           record.NativeContextMoveEventRecord_;
@@ -230,6 +318,12 @@ void ProfilerEventsProcessor::CodeEventHandler(
 
 void SamplingEventsProcessor::SymbolizeAndAddToProfiles(
     const TickSampleEventRecord* record) {
+  if (aggregator_ && aggregator_->is_enabled()) {
+    if (record->sample.update_stats) aggregator_->AddSample(record->sample);
+    // Without regular profiles, symbolization is left to the aggregator's
+    // batches.
+    if (!profiles_->HasCurrentProfiles()) return;
+  }
   Symbolizer::SymbolizedSample symbolized =
       symbolizer_->SymbolizeTickSample(record->sample);
   profiles_->AddPathToCurrentProfiles(
@@ -262,11 +356,26 @@ SamplingEventsProcessor::ProcessOneSample() {
   return OneSampleProcessed;
 }
 
+void SamplingEventsProcessor::ReportDroppedSamples() {
+  unsigned dropped = dropped_samples_.exchange(0, std::memory_order_relaxed);
+  if (dropped > 0) profiles_->AddDroppedSamplesToCurrentProfiles(dropped);
+}
+
 void SamplingEventsProcessor::Run() {
+  // The CPU time timer triggers the samples itself. Like with the shared
+  // sampler thread, this thread then only processes them, in larger batches.
+  const bool cpu_time_sampling = sampler_->IsCpuTimeSampling();
+  const bool shared_sampler =
+      FLAG_cpu_profiler_shared_sampler && !cpu_time_sampling;
+  if (shared_sampler) GetSharedSamplerThread()->AddProcessor(this);
+  const base::TimeDelta processing_period =
+      shared_sampler || cpu_time_sampling
+          ? period_ * kSharedSamplerProcessingPeriods
+          : period_;
   base::MutexGuard guard(&running_mutex_);
   while (running_.load(std::memory_order_relaxed)) {
     base::TimeTicks nextSampleTime =
-        base::TimeTicks::HighResolutionNow() + period_;
+        base::TimeTicks::HighResolutionNow() + processing_period;
     base::TimeTicks now;
     SampleProcessingResult result;
     // Keep processing existing events until we need to do next sample
@@ -280,10 +389,12 @@ void SamplingEventsProcessor::Run() {
       }
       now = base::TimeTicks::HighResolutionNow();
     } while (result != NoSamplesInQueue && now < nextSampleTime);
+    ReportDroppedSamples();
+    if (aggregator_) aggregator_->MaybeFlush(symbolizer_, now);
 
     if (nextSampleTime > now) {
 #if V8_OS_WIN
-      if (use_precise_sampling_ &&
+      if (use_precise_sampling_ && !shared_sampler &&
           nextSampleTime - now < base::TimeDelta::FromMilliseconds(100)) {
         // Do not use Sleep on Windows as it is very imprecise, with up to 16ms
         // jitter, which is unacceptable for short profile intervals.
@@ -310,8 +421,9 @@ void SamplingEventsProcessor::Run() {
     }
 
     // Schedule next sample.
-    sampler_->DoSample();
+    if (!shared_sampler) sampler_->DoSample();
   }
+  if (shared_sampler) GetSharedSamplerThread()->RemoveProcessor(this);
 
   // Process remaining tick events.
   do {
@@ -320,6 +432,8 @@ void SamplingEventsProcessor::Run() {
       result = ProcessOneSample();
     } while (result == OneSampleProcessed);
   } while (ProcessCodeEvent());
+  ReportDroppedSamples();
+  if (aggregator_) aggregator_->Flush(symbolizer_);
 }
 
 void SamplingEventsProcessor::SetSamplingInterval(base::TimeDelta period) {
@@ -327,6 +441,7 @@ void SamplingEventsProcessor::SetSamplingInterval(base::TimeDelta period) {
   StopSynchronously();
 
   period_ = period;
+  if (sampler_->IsCpuTimeSampling()) sampler_->StartCpuTimeSampling(period_);
   running_.store(true, std::memory_order_relaxed);
 
   StartSynchronously();
@@ -432,6 +547,8 @@ CpuProfile* CpuProfiler::GetProfile(int index) {
 void CpuProfiler::DeleteAllProfiles() {
   if (is_profiling_) StopProcessor();
   ResetProfiles();
+  // A streaming session outlives the regular profiles.
+  if (is_streaming()) StartProcessorIfNotStarted();
 }
 
 
@@ -500,6 +617,7 @@ CpuProfiler::CpuProfiler(Isolate* isolate, CpuProfilingNamingMode naming_mode,
       code_observer_(test_code_observer),
       profiles_(test_profiles),
       symbolizer_(test_symbolizer),
+      stack_aggregator_(new StackSampleAggregator()),
       processor_(test_processor),
       is_profiling_(false) {
   profiles_->set_cpu_profiler(this);
@@ -509,6 +627,7 @@ CpuProfiler::CpuProfiler(Isolate* isolate, CpuProfilingNamingMode naming_mode,
 }
 
 CpuProfiler::~CpuProfiler() {
+  StopStreaming();
   DCHECK(!is_profiling_);
   GetProfilersManager()->RemoveProfiler(isolate_, this);
 
@@ -557,6 +676,9 @@ void CpuProfiler::DisableLogging() {
 }
 
 base::TimeDelta CpuProfiler::ComputeSamplingInterval() const {
+  // Profile intervals are multiples of the base interval, so streaming at the
+  // base interval keeps serving them.
+  if (is_streaming()) return base_sampling_interval_;
   return profiles_->GetCommonSamplingInterval();
 }
 
@@ -621,7 +743,7 @@ void CpuProfiler::StartProcessorIfNotStarted() {
   base::TimeDelta sampling_interval = ComputeSamplingInterval();
   processor_.reset(new SamplingEventsProcessor(
       isolate_, symbolizer_.get(), code_observer_.get(), profiles_.get(),
-      sampling_interval, use_precise_sampling_));
+      sampling_interval, use_precise_sampling_, stack_aggregator_.get()));
   is_profiling_ = true;
 
   // Enable stack sampling.
@@ -631,7 +753,9 @@ void CpuProfiler::StartProcessorIfNotStarted() {
 
 CpuProfile* CpuProfiler::StopProfiling(const char* title) {
   if (!is_profiling_) return nullptr;
-  const bool last_profile = profiles_->IsLastProfile(title);
+  // A streaming session keeps the processor running.
+  const bool last_profile =
+      profiles_->IsLastProfile(title) && !is_streaming();
   if (last_profile) StopProcessor();
   CpuProfile* result = profiles_->StopProfiling(title);
 
@@ -649,6 +773,35 @@ CpuProfile* CpuProfiler::StopProfiling(String title) {
   return StopProfiling(profiles_->GetName(title));
 }
 
+CpuProfilingStatus CpuProfiler::StartStreaming() {
+  if (is_streaming()) return CpuProfilingStatus::kAlreadyStarted;
+  TRACE_EVENT0("v8", "CpuProfiler::StartStreaming");
+  stack_aggregator_->Start();
+  AdjustSamplingInterval();
+  StartProcessorIfNotStarted();
+  return CpuProfilingStatus::kStarted;
+}
+
+void CpuProfiler::StopStreaming() {
+  if (!is_streaming()) return;
+  if (!profiles_->HasCurrentProfiles()) {
+    StopProcessor();
+    if (logging_mode_ == kLazyLogging) DisableLogging();
+  }
+  stack_aggregator_->Stop();
+  AdjustSamplingInterval();
+}
+
+void CpuProfiler::DrainStreamedSamples(
+    std::vector<CpuProfileStreamFunction>* functions,
+    std::vector<CpuProfileStreamStack>* stacks) {
+  stack_aggregator_->Drain(functions, stacks);
+}
+
+bool CpuProfiler::is_streaming() const {
+  return stack_aggregator_->is_enabled();
+}
+
 void CpuProfiler::StopProcessor() {
   is_profiling_ = false;
   processor_->StopSynchronously();
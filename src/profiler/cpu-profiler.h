@@ -14,7 +14,7 @@
 #include "src/profiler/circular-queue.h"
 #include "src/profiler/profiler-listener.h"
 #include "src/profiler/tick-sample.h"
-#include "src/utils/locked-queue.h"
+#include "src/utils/mpsc-queue.h"
 
 namespace v8 {
 namespace sampler {
@@ -27,6 +27,7 @@ class CodeEntry;
 class CodeMap;
 class CpuProfilesCollection;
 class Isolate;
+class StackSampleAggregator;
 class Symbolizer;
 
 #define CODE_EVENTS_TYPE_LIST(V)                 \
@@ -186,7 +187,8 @@ class V8_EXPORT_PRIVATE ProfilerEventsProcessor : public base::Thread,
  protected:
   ProfilerEventsProcessor(Isolate* isolate, Symbolizer* symbolizer,
                           ProfilerCodeObserver* code_observer,
-                          CpuProfilesCollection* profiles);
+                          CpuProfilesCollection* profiles,
+                          StackSampleAggregator* aggregator);
 
   // Called from events processing thread (Run() method.)
   bool ProcessCodeEvent();
@@ -201,11 +203,13 @@ class V8_EXPORT_PRIVATE ProfilerEventsProcessor : public base::Thread,
   Symbolizer* symbolizer_;
   ProfilerCodeObserver* code_observer_;
   CpuProfilesCollection* profiles_;
+  // Receives the samples while the profiler is streaming.
+  StackSampleAggregator* aggregator_;
   std::atomic_bool running_{true};
   base::ConditionVariable running_cond_;
   base::Mutex running_mutex_;
-  LockedQueue<CodeEventsContainer> events_buffer_;
-  LockedQueue<TickSampleEventRecord> ticks_from_vm_buffer_;
+  MpscQueue<CodeEventsContainer> events_buffer_;
+  MpscQueue<TickSampleEventRecord> ticks_from_vm_buffer_;
   std::atomic<unsigned> last_code_event_id_;
   unsigned last_processed_code_event_id_;
   Isolate* isolate_;
@@ -217,7 +221,8 @@ class V8_EXPORT_PRIVATE SamplingEventsProcessor
   SamplingEventsProcessor(Isolate* isolate, Symbolizer* symbolizer,
                           ProfilerCodeObserver* code_observer,
                           CpuProfilesCollection* profiles,
-                          base::TimeDelta period, bool use_precise_sampling);
+                          base::TimeDelta period, bool use_precise_sampling,
+                          StackSampleAggregator* aggregator = nullptr);
   ~SamplingEventsProcessor() override;
 
   // SamplingCircularQueue has stricter alignment requirements than a normal new
@@ -238,12 +243,19 @@ class V8_EXPORT_PRIVATE SamplingEventsProcessor
   inline TickSample* StartTickSample();
   inline void FinishTickSample();
 
+  // Counts a sample the sampler could not record because the tick buffer was
+  // full. Signal safe.
+  void AddDroppedSample() {
+    dropped_samples_.fetch_add(1, std::memory_order_relaxed);
+  }
+
   sampler::Sampler* sampler() { return sampler_.get(); }
   base::TimeDelta period() const { return period_; }
 
  private:
   SampleProcessingResult ProcessOneSample() override;
   void SymbolizeAndAddToProfiles(const TickSampleEventRecord* record);
+  void ReportDroppedSamples();
 
   static const size_t kTickSampleBufferSize = 512 * KB;
   static const size_t kTickSampleQueueLength =
@@ -254,6 +266,7 @@ class V8_EXPORT_PRIVATE SamplingEventsProcessor
   base::TimeDelta period_;           // Samples & code events processing period.
   const bool use_precise_sampling_;  // Whether or not busy-waiting is used for
                                      // low sampling intervals on Windows.
+  std::atomic<unsigned> dropped_samples_{0};
 };
 
 // Builds and maintains a CodeMap tracking code objects on the VM heap. While
@@ -352,6 +365,14 @@ class V8_EXPORT_PRIVATE CpuProfiler {
 
   CpuProfile* StopProfiling(const char* title);
   CpuProfile* StopProfiling(String title);
+
+  // Streaming mode, see v8::CpuProfiler::StartStreaming().
+  StartProfilingStatus StartStreaming();
+  void StopStreaming();
+  void DrainStreamedSamples(std::vector<CpuProfileStreamFunction>* functions,
+                            std::vector<CpuProfileStreamStack>* stacks);
+  bool is_streaming() const;
+
   int GetProfilesCount();
   CpuProfile* GetProfile(int index);
   void DeleteAllProfiles();
@@ -398,6 +419,7 @@ class V8_EXPORT_PRIVATE CpuProfiler {
   std::unique_ptr<ProfilerCodeObserver> code_observer_;
   std::unique_ptr<CpuProfilesCollection> profiles_;
   std::unique_ptr<Symbolizer> symbolizer_;
+  std::unique_ptr<StackSampleAggregator> stack_aggregator_;
   std::unique_ptr<ProfilerEventsProcessor> processor_;
   std::unique_ptr<ProfilerListener> profiler_listener_;
   std::unique_ptr<ProfilingScope> profiling_scope_;
@@ -712,7 +712,10 @@ const char* V8HeapExplorer::GetSystemEntryName(HeapObject object) {
 }
 
 int V8HeapExplorer::EstimateObjectsCount() {
-  CombinedHeapObjectIterator it(heap_, HeapObjectIterator::kFilterUnreachable);
+  // Filtering unreachable objects requires marking the whole heap. The
+  // snapshot is taken right after a full GC, so counting all objects is a
+  // close upper bound of the objects that are extracted.
+  CombinedHeapObjectIterator it(heap_, HeapObjectIterator::kNoFiltering);
   int objects_count = 0;
   while (!it.Next().is_null()) ++objects_count;
   return objects_count;
@@ -2274,13 +2277,16 @@ bool HeapSnapshotGenerator::ProgressReport(bool force) {
 }
 
 void HeapSnapshotGenerator::InitProgressCounter() {
+  const int objects_count = v8_heap_explorer_.EstimateObjectsCount();
+  // Avoid rehashing the entries map while extracting references.
+  entries_map_.reserve(objects_count);
   if (control_ == nullptr) return;
   // The +1 ensures that intermediate ProgressReport calls will never signal
   // that the work is finished (i.e. progress_counter_ == progress_total_).
   // Only the forced ProgressReport() at the end of GenerateSnapshot()
   // should signal that the work is finished because signalling finished twice
   // breaks the DevTools frontend.
-  progress_total_ = v8_heap_explorer_.EstimateObjectsCount() + 1;
+  progress_total_ = objects_count + 1;
   progress_counter_ = 0;
 }
 
@@ -2529,8 +2535,8 @@ void HeapSnapshotJSONSerializer::SerializeEdge(HeapGraphEdge* edge,
   buffer[buffer_pos++] = ',';
   buffer_pos = utoa(to_node_index(edge->to()), buffer, buffer_pos);
   buffer[buffer_pos++] = '\n';
-  buffer[buffer_pos++] = '\0';
-  writer_->AddString(buffer.begin());
+  buffer[buffer_pos] = '\0';
+  writer_->AddSubstring(buffer.begin(), buffer_pos);
 }
 
 void HeapSnapshotJSONSerializer::SerializeEdges() {
@@ -2569,8 +2575,8 @@ void HeapSnapshotJSONSerializer::SerializeNode(const HeapEntry* entry) {
   buffer[buffer_pos++] = ',';
   buffer_pos = utoa(entry->detachedness(), buffer, buffer_pos);
   buffer[buffer_pos++] = '\n';
-  buffer[buffer_pos++] = '\0';
-  writer_->AddString(buffer.begin());
+  buffer[buffer_pos] = '\0';
+  writer_->AddSubstring(buffer.begin(), buffer_pos);
 }
 
 void HeapSnapshotJSONSerializer::SerializeNodes() {
@@ -2876,8 +2882,8 @@ void HeapSnapshotJSONSerializer::SerializeLocation(
   buffer[buffer_pos++] = ',';
   buffer_pos = utoa(location.col, buffer, buffer_pos);
   buffer[buffer_pos++] = '\n';
-  buffer[buffer_pos++] = '\0';
-  writer_->AddString(buffer.begin());
+  buffer[buffer_pos] = '\0';
+  writer_->AddSubstring(buffer.begin(), buffer_pos);
 }
 
 void HeapSnapshotJSONSerializer::SerializeLocations() {
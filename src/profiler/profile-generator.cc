@@ -946,6 +946,13 @@ bool CpuProfilesCollection::IsLastProfile(const char* title) {
 }
 
 
+bool CpuProfilesCollection::HasCurrentProfiles() {
+  current_profiles_semaphore_.Wait();
+  bool result = !current_profiles_.empty();
+  current_profiles_semaphore_.Signal();
+  return result;
+}
+
 void CpuProfilesCollection::RemoveProfile(CpuProfile* profile) {
   // Called from VM thread for a completed profile.
   auto pos =
@@ -1015,5 +1022,14 @@ void CpuProfilesCollection::UpdateNativeContextAddressForCurrentProfiles(
   current_profiles_semaphore_.Signal();
 }
 
+void CpuProfilesCollection::AddDroppedSamplesToCurrentProfiles(
+    unsigned count) {
+  current_profiles_semaphore_.Wait();
+  for (const std::unique_ptr<CpuProfile>& profile : current_profiles_) {
+    profile->AddDroppedSamples(count);
+  }
+  current_profiles_semaphore_.Signal();
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -428,6 +428,10 @@ class CpuProfile {
   int samples_count() const { return static_cast<int>(samples_.size()); }
   const SampleInfo& sample(int index) const { return samples_[index]; }
 
+  // Samples the sampler lost while this profile was recording.
+  unsigned dropped_samples_count() const { return dropped_samples_count_; }
+  void AddDroppedSamples(unsigned count) { dropped_samples_count_ += count; }
+
   int64_t sampling_interval_us() const {
     return options_.sampling_interval_us();
   }
@@ -454,6 +458,7 @@ class CpuProfile {
   ProfileTree top_down_;
   CpuProfiler* const profiler_;
   size_t streaming_next_sample_;
+  unsigned dropped_samples_count_ = 0;
   uint32_t id_;
   // Number of microseconds worth of profiler ticks that should elapse before
   // the next sample is recorded.
@@ -546,6 +551,8 @@ class V8_EXPORT_PRIVATE CpuProfilesCollection {
   }
   const char* GetName(Name name) { return resource_names_.GetName(name); }
   bool IsLastProfile(const char* title);
+  // Called from both the VM and the profile generator thread.
+  bool HasCurrentProfiles();
   void RemoveProfile(CpuProfile* profile);
 
   // Finds a common sampling interval dividing each CpuProfile's interval,
@@ -563,6 +570,9 @@ class V8_EXPORT_PRIVATE CpuProfilesCollection {
   // Called from profile generator thread.
   void UpdateNativeContextAddressForCurrentProfiles(Address from, Address to);
 
+  // Called from profile generator thread.
+  void AddDroppedSamplesToCurrentProfiles(unsigned count);
+
   // Limits the number of profiles that can be simultaneously collected.
   static const int kMaxSimultaneousProfiles = 100;
 
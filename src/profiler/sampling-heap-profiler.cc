@@ -9,6 +9,7 @@
 
 #include "src/api/api-inl.h"
 #include "src/base/ieee754.h"
+#include "src/base/small-vector.h"
 #include "src/base/utils/random-number-generator.h"
 #include "src/execution/frames-inl.h"
 #include "src/execution/isolate.h"
@@ -77,29 +78,23 @@ void SamplingHeapProfiler::SampleObject(Address soon_object, size_t size) {
   // Check if the area is iterable by confirming that it starts with a map.
   DCHECK(HeapObject::FromAddress(soon_object).map().IsMap());
 
-  HandleScope scope(isolate_);
   HeapObject heap_object = HeapObject::FromAddress(soon_object);
-  Handle<Object> obj(heap_object, isolate_);
-
-  Local<v8::Value> loc = v8::Utils::ToLocal(obj);
-
   AllocationNode* node = AddStack();
   node->allocations_[size]++;
-  auto sample =
-      std::make_unique<Sample>(size, node, loc, this, next_sample_id());
-  sample->global.SetWeak(sample.get(), OnWeakCallback,
-                         WeakCallbackType::kParameter);
-  samples_.emplace(sample.get(), std::move(sample));
+  Sample sample{size, node, heap_object, next_sample_id()};
+  if (Heap::InYoungGeneration(heap_object)) {
+    young_samples_.push_back(sample);
+  } else {
+    old_samples_.push_back(sample);
+  }
 }
 
-void SamplingHeapProfiler::OnWeakCallback(
-    const WeakCallbackInfo<Sample>& data) {
-  Sample* sample = data.GetParameter();
-  AllocationNode* node = sample->owner;
-  DCHECK_GT(node->allocations_[sample->size], 0);
-  node->allocations_[sample->size]--;
-  if (node->allocations_[sample->size] == 0) {
-    node->allocations_.erase(sample->size);
+void SamplingHeapProfiler::RemoveAllocation(AllocationNode* node,
+                                            size_t size) {
+  DCHECK_GT(node->allocations_[size], 0);
+  node->allocations_[size]--;
+  if (node->allocations_[size] == 0) {
+    node->allocations_.erase(size);
     while (node->allocations_.empty() && node->children_.empty() &&
            node->parent_ && !node->parent_->pinned_) {
       AllocationNode* parent = node->parent_;
@@ -109,8 +104,40 @@ void SamplingHeapProfiler::OnWeakCallback(
       node = parent;
     }
   }
-  sample->profiler->samples_.erase(sample);
-  // sample is deleted because its unique ptr was erased from samples_.
+}
+
+bool SamplingHeapProfiler::RetainSample(Sample* sample,
+                                        WeakObjectRetainer* retainer) {
+  Object retained = retainer->RetainAs(sample->object);
+  if (retained.is_null()) {
+    RemoveAllocation(sample->owner, sample->size);
+    return false;
+  }
+  sample->object = retained;
+  return true;
+}
+
+void SamplingHeapProfiler::ProcessSamples(WeakObjectRetainer* retainer,
+                                          bool young_only) {
+  // Surviving young samples are kept in place or moved to the old samples if
+  // their object was promoted.
+  size_t young_count = 0;
+  for (Sample& sample : young_samples_) {
+    if (!RetainSample(&sample, retainer)) continue;
+    if (Heap::InYoungGeneration(sample.object)) {
+      young_samples_[young_count++] = sample;
+    } else {
+      old_samples_.push_back(sample);
+    }
+  }
+  young_samples_.resize(young_count);
+  if (young_only) return;
+
+  size_t old_count = 0;
+  for (Sample& sample : old_samples_) {
+    if (RetainSample(&sample, retainer)) old_samples_[old_count++] = sample;
+  }
+  old_samples_.resize(old_count);
 }
 
 SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::FindOrAddChildNode(
@@ -128,10 +155,25 @@ SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::FindOrAddChildNode(
   return parent->AddChildNode(id, std::move(new_child));
 }
 
+SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::FindOrAddChildNode(
+    AllocationNode* parent, SharedFunctionInfo shared) {
+  int script_id = v8::UnboundScript::kNoScriptId;
+  if (shared.script().IsScript()) {
+    script_id = Script::cast(shared.script()).id();
+    // Functions with a script are identified by their position, so the name
+    // is only needed for new nodes.
+    AllocationNode* child = parent->FindChildNode(AllocationNode::function_id(
+        script_id, shared.StartPosition(), nullptr));
+    if (child) return child;
+  }
+  const char* name = names()->GetCopy(shared.DebugNameCStr().get());
+  return FindOrAddChildNode(parent, name, script_id, shared.StartPosition());
+}
+
 SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::AddStack() {
   AllocationNode* node = &profile_root_;
 
-  std::vector<SharedFunctionInfo> stack;
+  base::SmallVector<SharedFunctionInfo, 32> stack;
   JavaScriptFrameIterator it(isolate_);
   int frames_captured = 0;
   bool found_arguments_marker_frames = false;
@@ -144,7 +186,7 @@ SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::AddStack() {
     // sensitive moment belong to the formerly optimized frame anyway.
     if (frame->unchecked_function().IsJSFunction()) {
       SharedFunctionInfo shared = frame->function().shared();
-      stack.push_back(shared);
+      stack.emplace_back(shared);
       frames_captured++;
     } else {
       found_arguments_marker_frames = true;
@@ -188,15 +230,8 @@ SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::AddStack() {
 
   // We need to process the stack in reverse order as the top of the stack is
   // the first element in the list.
-  for (auto it = stack.rbegin(); it != stack.rend(); ++it) {
-    SharedFunctionInfo shared = *it;
-    const char* name = this->names()->GetCopy(shared.DebugNameCStr().get());
-    int script_id = v8::UnboundScript::kNoScriptId;
-    if (shared.script().IsScript()) {
-      Script script = Script::cast(shared.script());
-      script_id = script.id();
-    }
-    node = FindOrAddChildNode(node, name, script_id, shared.StartPosition());
+  for (size_t i = stack.size(); i > 0; --i) {
+    node = FindOrAddChildNode(node, stack[i - 1]);
   }
 
   if (found_arguments_marker_frames) {
@@ -279,12 +314,13 @@ v8::AllocationProfile* SamplingHeapProfiler::GetAllocationProfile() {
 const std::vector<v8::AllocationProfile::Sample>
 SamplingHeapProfiler::BuildSamples() const {
   std::vector<v8::AllocationProfile::Sample> samples;
-  samples.reserve(samples_.size());
-  for (const auto& it : samples_) {
-    const Sample* sample = it.second.get();
-    samples.emplace_back(v8::AllocationProfile::Sample{
-        sample->owner->id_, sample->size, ScaleSample(sample->size, 1).count,
-        sample->sample_id});
+  samples.reserve(young_samples_.size() + old_samples_.size());
+  for (const std::vector<Sample>* list : {&old_samples_, &young_samples_}) {
+    for (const Sample& sample : *list) {
+      samples.emplace_back(v8::AllocationProfile::Sample{
+          sample.owner->id_, sample.size, ScaleSample(sample.size, 1).count,
+          sample.sample_id});
+    }
   }
   return samples;
 }
@@ -8,7 +8,7 @@
 #include <deque>
 #include <map>
 #include <memory>
-#include <unordered_map>
+#include <vector>
 
 #include "include/v8-profiler.h"
 #include "src/heap/heap.h"
@@ -22,6 +22,8 @@ class RandomNumberGenerator;
 
 namespace internal {
 
+class SharedFunctionInfo;
+
 class AllocationProfile : public v8::AllocationProfile {
  public:
   AllocationProfile() = default;
@@ -99,21 +101,13 @@ class SamplingHeapProfiler {
     friend class SamplingHeapProfiler;
   };
 
+  // A sampled object. The object is held weakly: the GC updates or drops it
+  // while processing its weak lists, see ProcessSamples().
   struct Sample {
-    Sample(size_t size_, AllocationNode* owner_, Local<Value> local_,
-           SamplingHeapProfiler* profiler_, uint64_t sample_id)
-        : size(size_),
-          owner(owner_),
-          global(reinterpret_cast<v8::Isolate*>(profiler_->isolate_), local_),
-          profiler(profiler_),
-          sample_id(sample_id) {}
-    Sample(const Sample&) = delete;
-    Sample& operator=(const Sample&) = delete;
-    const size_t size;
-    AllocationNode* const owner;
-    Global<Value> global;
-    SamplingHeapProfiler* const profiler;
-    const uint64_t sample_id;
+    size_t size;
+    AllocationNode* owner;
+    Object object;
+    uint64_t sample_id;
   };
 
   SamplingHeapProfiler(Heap* heap, StringsStorage* names, uint64_t rate,
@@ -125,6 +119,10 @@ class SamplingHeapProfiler {
   v8::AllocationProfile* GetAllocationProfile();
   StringsStorage* names() const { return names_; }
 
+  // Called by the GC with the retainer of its weak lists. Samples whose object
+  // is not retained are discounted from their allocation nodes.
+  void ProcessSamples(WeakObjectRetainer* retainer, bool young_only);
+
  private:
   class Observer : public AllocationObserver {
    public:
@@ -164,7 +162,11 @@ class SamplingHeapProfiler {
 
   AllocationNode* FindOrAddChildNode(AllocationNode* parent, const char* name,
                                      int script_id, int start_position);
-  static void OnWeakCallback(const WeakCallbackInfo<Sample>& data);
+  AllocationNode* FindOrAddChildNode(AllocationNode* parent,
+                                     SharedFunctionInfo shared);
+  void RemoveAllocation(AllocationNode* node, size_t size);
+  // Returns whether the sample's object survived.
+  bool RetainSample(Sample* sample, WeakObjectRetainer* retainer);
 
   uint32_t next_node_id() { return ++last_node_id_; }
   uint64_t next_sample_id() { return ++last_sample_id_; }
@@ -190,7 +192,10 @@ class SamplingHeapProfiler {
   Observer allocation_observer_;
   StringsStorage* const names_;
   AllocationNode profile_root_;
-  std::unordered_map<Sample*, std::unique_ptr<Sample>> samples_;
+  // Samples of objects in the young and in the old generation, so that
+  // scavenges only process the former.
+  std::vector<Sample> young_samples_;
+  std::vector<Sample> old_samples_;
   const int stack_depth_;
   const uint64_t rate_;
   v8::HeapProfiler::SamplingFlags flags_;
@@ -0,0 +1,151 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/profiler/stack-sample-aggregator.h"
+
+#include <utility>
+
+#include "src/profiler/profile-generator.h"
+#include "src/profiler/symbolizer.h"
+#include "src/profiler/tick-sample.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// Layout of a raw stack key: the fields below, followed by the frames.
+enum RawStackField {
+  kStateField,
+  kPcField,
+  kTosField,
+  kHasExternalCallbackField,
+  kFirstFrameField
+};
+
+}  // namespace
+
+void StackSampleAggregator::Start() {
+  base::MutexGuard guard(&mutex_);
+  counts_.clear();
+  enabled_.store(true, std::memory_order_relaxed);
+}
+
+void StackSampleAggregator::Stop() {
+  enabled_.store(false, std::memory_order_relaxed);
+  base::MutexGuard guard(&mutex_);
+  counts_.clear();
+}
+
+void StackSampleAggregator::AddSample(const TickSample& sample) {
+  scratch_key_.resize(kFirstFrameField + sample.frames_count);
+  scratch_key_[kStateField] = static_cast<Address>(sample.state);
+  scratch_key_[kPcField] = reinterpret_cast<Address>(sample.pc);
+  scratch_key_[kTosField] = reinterpret_cast<Address>(sample.tos);
+  scratch_key_[kHasExternalCallbackField] = sample.has_external_callback;
+  for (unsigned i = 0; i < sample.frames_count; ++i) {
+    scratch_key_[kFirstFrameField + i] =
+        reinterpret_cast<Address>(sample.stack[i]);
+  }
+  auto it = pending_.find(scratch_key_);
+  if (it != pending_.end()) {
+    it->second++;
+  } else {
+    pending_.emplace(scratch_key_, 1);
+  }
+}
+
+void StackSampleAggregator::MaybeFlush(Symbolizer* symbolizer,
+                                       base::TimeTicks now) {
+  if (last_flush_.IsNull()) last_flush_ = now;
+  if (pending_.size() < kMaxPendingStacks &&
+      now - last_flush_ <
+          base::TimeDelta::FromMilliseconds(kFlushIntervalMs)) {
+    return;
+  }
+  Flush(symbolizer);
+  last_flush_ = now;
+}
+
+void StackSampleAggregator::Flush(Symbolizer* symbolizer) {
+  if (pending_.empty()) return;
+  if (!is_enabled()) {
+    pending_.clear();
+    return;
+  }
+
+  std::vector<std::pair<std::vector<int>, uint32_t>> batch;
+  batch.reserve(pending_.size());
+  {
+    // New functions are published to the draining thread as they are found.
+    base::MutexGuard guard(&mutex_);
+    TickSample sample;
+    for (const auto& pending : pending_) {
+      const std::vector<Address>& key = pending.first;
+      sample.state = static_cast<StateTag>(key[kStateField]);
+      sample.pc = reinterpret_cast<void*>(key[kPcField]);
+      sample.tos = reinterpret_cast<void*>(key[kTosField]);
+      sample.has_external_callback = key[kHasExternalCallbackField] != 0;
+      sample.frames_count =
+          static_cast<unsigned>(key.size() - kFirstFrameField);
+      for (unsigned i = 0; i < sample.frames_count; ++i) {
+        sample.stack[i] = reinterpret_cast<void*>(key[kFirstFrameField + i]);
+      }
+      ProfileStackTrace stack_trace =
+          symbolizer->SymbolizeTickSample(sample).stack_trace;
+      std::vector<int> frames;
+      frames.reserve(stack_trace.size());
+      for (const CodeEntryAndLineNumber& frame : stack_trace) {
+        if (frame.code_entry == nullptr) continue;
+        frames.push_back(GetFunctionId(frame.code_entry));
+      }
+      batch.emplace_back(std::move(frames), pending.second);
+    }
+    for (auto& stack : batch) counts_[std::move(stack.first)] += stack.second;
+  }
+  pending_.clear();
+  // CodeEntry objects may be deleted or reused by the next code event.
+  batch_function_ids_.clear();
+}
+
+int StackSampleAggregator::GetFunctionId(CodeEntry* entry) {
+  auto cached = batch_function_ids_.find(entry);
+  if (cached != batch_function_ids_.end()) return cached->second;
+
+  std::string key = std::string(entry->name()) + '\n' +
+                    entry->resource_name() + '\n' +
+                    std::to_string(entry->script_id()) + ':' +
+                    std::to_string(entry->line_number()) + ':' +
+                    std::to_string(entry->column_number());
+  int id;
+  auto known = function_ids_.find(key);
+  if (known != function_ids_.end()) {
+    id = known->second;
+  } else {
+    id = static_cast<int>(functions_.size());
+    functions_.push_back({entry->name(), entry->resource_name(),
+                          entry->script_id(), entry->line_number(),
+                          entry->column_number()});
+    function_ids_.emplace(std::move(key), id);
+  }
+  batch_function_ids_.emplace(entry, id);
+  return id;
+}
+
+void StackSampleAggregator::Drain(
+    std::vector<CpuProfileStreamFunction>* functions,
+    std::vector<CpuProfileStreamStack>* stacks) {
+  base::MutexGuard guard(&mutex_);
+  functions->insert(functions->end(), functions_.begin() + drained_functions_,
+                    functions_.end());
+  drained_functions_ = functions_.size();
+  stacks->reserve(stacks->size() + counts_.size());
+  for (auto& stack : counts_) {
+    stacks->push_back({stack.first, stack.second});
+  }
+  counts_.clear();
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,89 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_PROFILER_STACK_SAMPLE_AGGREGATOR_H_
+#define V8_PROFILER_STACK_SAMPLE_AGGREGATOR_H_
+
+#include <atomic>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "include/v8-profiler.h"
+#include "src/base/functional.h"
+#include "src/base/platform/mutex.h"
+#include "src/base/platform/time.h"
+#include "src/common/globals.h"
+
+namespace v8 {
+namespace internal {
+
+class CodeEntry;
+class Symbolizer;
+struct TickSample;
+
+// Aggregates tick samples for the streaming mode of the CpuProfiler. Rather
+// than symbolizing every tick into a ProfileTree, the processor thread
+// deduplicates the raw stacks by their addresses and symbolizes each distinct
+// stack once per batch. A batch is flushed before the next code event changes
+// the CodeMap, and otherwise when it grows large or old. Symbolized stacks
+// are counted over an append-only function table, which the embedder drains
+// from any thread.
+class V8_EXPORT_PRIVATE StackSampleAggregator {
+ public:
+  // Limits on the distinct raw stacks and the time a batch may collect before
+  // it is symbolized. They bound the latency of Drain().
+  static const size_t kMaxPendingStacks = 1024;
+  static constexpr int kFlushIntervalMs = 100;
+
+  StackSampleAggregator() = default;
+  StackSampleAggregator(const StackSampleAggregator&) = delete;
+  StackSampleAggregator& operator=(const StackSampleAggregator&) = delete;
+
+  // Called from the VM thread.
+  void Start();
+  void Stop();
+  bool is_enabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+  // Called from the profile generator thread.
+  void AddSample(const TickSample& sample);
+  void MaybeFlush(Symbolizer* symbolizer, base::TimeTicks now);
+  void Flush(Symbolizer* symbolizer);
+
+  // Moves the stacks counted since the last call into |stacks| and appends
+  // the functions they reference for the first time to |functions|.
+  void Drain(std::vector<CpuProfileStreamFunction>* functions,
+             std::vector<CpuProfileStreamStack>* stacks);
+
+ private:
+  struct VectorHash {
+    template <typename T>
+    size_t operator()(const std::vector<T>& v) const {
+      return base::hash_range(v.begin(), v.end());
+    }
+  };
+
+  int GetFunctionId(CodeEntry* entry);
+
+  std::atomic_bool enabled_{false};
+
+  // Profile generator thread only. A raw stack is keyed by its pc, top of
+  // stack, VM state and frame addresses.
+  std::unordered_map<std::vector<Address>, uint32_t, VectorHash> pending_;
+  std::vector<Address> scratch_key_;
+  base::TimeTicks last_flush_;
+  std::unordered_map<std::string, int> function_ids_;
+  std::unordered_map<CodeEntry*, int> batch_function_ids_;
+
+  // Guarded by mutex_, shared with the draining thread.
+  base::Mutex mutex_;
+  std::vector<CpuProfileStreamFunction> functions_;
+  size_t drained_functions_ = 0;
+  std::unordered_map<std::vector<int>, uint32_t, VectorHash> counts_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_PROFILER_STACK_SAMPLE_AGGREGATOR_H_
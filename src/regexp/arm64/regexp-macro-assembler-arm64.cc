@@ -626,6 +626,38 @@ bool RegExpMacroAssemblerARM64::CheckCharacterNotInRangeArray(
   return true;
 }
 
+bool RegExpMacroAssemblerARM64::SkipUntilCharacter(int cp_offset,
+                                                   unsigned c) {
+  if (mode_ != LATIN1 || !FLAG_regexp_skip_with_memchr) return false;
+  static const int kNumArguments = 3;
+  PushCachedRegisters();
+
+  // Parameters are
+  //   x0: Address start - Address of the character at cp_offset.
+  //   x1: Address end - End of input.
+  //   w2: uint32_t c - The character to look for.
+  __ Add(x0, input_end(), Operand(current_input_offset(), SXTW));
+  __ Add(x0, x0, cp_offset);
+  __ Mov(x1, input_end());
+  __ Mov(w2, c);
+
+  {
+    // We have a frame (set up in GetCode), but the assembler doesn't know.
+    FrameScope scope(masm_.get(), StackFrame::MANUAL);
+    __ CallCFunction(ExternalReference::re_skip_until_one_byte_character(),
+                     kNumArguments);
+  }
+
+  // The returned address is that of the character at cp_offset. x0 is one of
+  // the registers used as a cache so it must be used before the cache is
+  // restored.
+  __ Sub(x0, x0, input_end());
+  __ Sub(current_input_offset(), w0, cp_offset);
+  PopCachedRegisters();
+  __ Mov(code_pointer(), Operand(masm_->CodeObject()));
+  return true;
+}
+
 void RegExpMacroAssemblerARM64::CheckBitInTable(
     Handle<ByteArray> table,
     Label* on_bit_set) {
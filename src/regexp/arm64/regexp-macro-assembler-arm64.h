@@ -63,6 +63,7 @@ class V8_EXPORT_PRIVATE RegExpMacroAssemblerARM64
   void CheckPosition(int cp_offset, Label* on_outside_input) override;
   bool CheckSpecialCharacterClass(StandardCharacterSet type,
                                   Label* on_no_match) override;
+  bool SkipUntilCharacter(int cp_offset, unsigned c) override;
   void BindJumpTarget(Label* label = nullptr) override;
   void Fail() override;
   Handle<HeapObject> GetCode(Handle<String> source) override;
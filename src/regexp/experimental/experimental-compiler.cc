@@ -96,13 +96,20 @@ class CanBeHandledVisitor final : private RegExpVisitor {
     // have to be replicated in the generated bytecode, and we don't allow this
     // to exceed some small value.
     static constexpr int kMaxReplicationFactor = 16;
+    // A body matching a single character compiles to a single instruction (or
+    // a short fork for character classes), so it can be replicated more often
+    // without blowing up the bytecode, e.g. for `[0-9]{1,64}`.
+    static constexpr int kMaxSingleCharacterReplicationFactor = 256;
+    const int max_replication_factor =
+        IsSingleCharacter(node->body()) ? kMaxSingleCharacterReplicationFactor
+                                        : kMaxReplicationFactor;
 
     // First we rule out values for min and max that are too big even before
     // taking into account the ambient replication_factor_.  This also guards
     // against overflows in `local_replication` or `replication_factor_`.
-    if (node->min() > kMaxReplicationFactor ||
+    if (node->min() > max_replication_factor ||
         (node->max() != RegExpTree::kInfinity &&
-         node->max() > kMaxReplicationFactor)) {
+         node->max() > max_replication_factor)) {
       result_ = false;
       return nullptr;
     }
@@ -119,7 +126,7 @@ class CanBeHandledVisitor final : private RegExpVisitor {
     }
 
     replication_factor_ *= local_replication;
-    if (replication_factor_ > kMaxReplicationFactor) {
+    if (replication_factor_ > max_replication_factor) {
       result_ = false;
       return nullptr;
     }
@@ -140,6 +147,11 @@ class CanBeHandledVisitor final : private RegExpVisitor {
     return nullptr;
   }
 
+  static bool IsSingleCharacter(RegExpTree* node) {
+    if (node->IsCharacterClass()) return true;
+    return node->IsAtom() && node->AsAtom()->length() == 1;
+  }
+
   void* VisitCapture(RegExpCapture* node, void*) override {
     node->body()->Accept(this, nullptr);
     return nullptr;
@@ -0,0 +1,117 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/regexp-bytecode-cache.h"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "src/base/functional.h"
+#include "src/base/lazy-instance.h"
+#include "src/base/platform/mutex.h"
+#include "src/execution/isolate.h"
+#include "src/heap/factory.h"
+#include "src/objects/objects-inl.h"
+#include "src/objects/string-inl.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+struct Key {
+  std::u16string pattern;
+  RegExpFlags flags;
+  bool is_one_byte;
+  uint32_t backtrack_limit;
+
+  bool operator==(const Key& other) const {
+    return pattern == other.pattern && flags == other.flags &&
+           is_one_byte == other.is_one_byte &&
+           backtrack_limit == other.backtrack_limit;
+  }
+};
+
+struct KeyHash {
+  size_t operator()(const Key& key) const {
+    return base::hash_combine(std::hash<std::u16string>()(key.pattern),
+                              static_cast<int>(key.flags), key.is_one_byte,
+                              key.backtrack_limit);
+  }
+};
+
+struct Entry {
+  std::vector<byte> bytecode;
+  int register_count;
+};
+
+using BytecodeCacheMap = std::unordered_map<Key, Entry, KeyHash>;
+
+// To avoid upsetting the static initializer count, we lazy initialize this.
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(BytecodeCacheMap, GetBytecodeCacheMap)
+base::LazyMutex g_bytecode_cache_mutex = LAZY_MUTEX_INITIALIZER;
+
+Key MakeKey(Handle<String> pattern, RegExpFlags flags, bool is_one_byte,
+            uint32_t backtrack_limit) {
+  DCHECK(pattern->IsFlat());
+  Key key{std::u16string(), flags, is_one_byte, backtrack_limit};
+  DisallowGarbageCollection no_gc;
+  String::FlatContent content = pattern->GetFlatContent(no_gc);
+  if (content.IsOneByte()) {
+    base::Vector<const uint8_t> chars = content.ToOneByteVector();
+    key.pattern.assign(chars.begin(), chars.end());
+  } else {
+    base::Vector<const base::uc16> chars = content.ToUC16Vector();
+    key.pattern.assign(chars.begin(), chars.end());
+  }
+  return key;
+}
+
+}  // namespace
+
+// static
+MaybeHandle<ByteArray> RegExpBytecodeCache::Lookup(
+    Isolate* isolate, Handle<String> pattern, RegExpFlags flags,
+    bool is_one_byte, uint32_t backtrack_limit, int* register_count) {
+  Key key = MakeKey(pattern, flags, is_one_byte, backtrack_limit);
+  base::MutexGuard guard(g_bytecode_cache_mutex.Pointer());
+  BytecodeCacheMap* map = GetBytecodeCacheMap();
+  auto it = map->find(key);
+  if (it == map->end()) return {};
+  const Entry& entry = it->second;
+  Handle<ByteArray> bytecode = isolate->factory()->NewByteArray(
+      static_cast<int>(entry.bytecode.size()));
+  bytecode->copy_in(0, entry.bytecode.data(),
+                    static_cast<int>(entry.bytecode.size()));
+  *register_count = entry.register_count;
+  return bytecode;
+}
+
+// static
+void RegExpBytecodeCache::Insert(Handle<String> pattern, RegExpFlags flags,
+                                 bool is_one_byte, uint32_t backtrack_limit,
+                                 Handle<ByteArray> bytecode,
+                                 int register_count) {
+  Key key = MakeKey(pattern, flags, is_one_byte, backtrack_limit);
+  Entry entry{std::vector<byte>(bytecode->GetDataStartAddress(),
+                                bytecode->GetDataEndAddress()),
+              register_count};
+  base::MutexGuard guard(g_bytecode_cache_mutex.Pointer());
+  BytecodeCacheMap* map = GetBytecodeCacheMap();
+  if (map->size() >=
+      static_cast<size_t>(FLAG_regexp_shared_bytecode_cache_size)) {
+    return;
+  }
+  map->emplace(std::move(key), std::move(entry));
+}
+
+// static
+void RegExpBytecodeCache::Clear() {
+  base::MutexGuard guard(g_bytecode_cache_mutex.Pointer());
+  GetBytecodeCacheMap()->clear();
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,46 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_REGEXP_BYTECODE_CACHE_H_
+#define V8_REGEXP_REGEXP_BYTECODE_CACHE_H_
+
+#include "src/common/globals.h"
+#include "src/handles/maybe-handles.h"
+#include "src/regexp/regexp-flags.h"
+
+namespace v8 {
+namespace internal {
+
+class ByteArray;
+class String;
+
+// A process-wide cache of irregexp bytecode, shared by all isolates. Unlike
+// native code, bytecode contains no isolate-specific data, so isolates that
+// compile the same pattern can copy the cached bytecode instead of running the
+// RegExpCompiler again. Enabled by --regexp-shared-bytecode-cache.
+class V8_EXPORT_PRIVATE RegExpBytecodeCache : public AllStatic {
+ public:
+  // Returns a copy of the cached bytecode for {pattern}, which must be flat,
+  // allocated on the heap of {isolate}, and sets {register_count} to the
+  // number of registers it uses. Returns an empty handle on a miss.
+  static MaybeHandle<ByteArray> Lookup(Isolate* isolate,
+                                       Handle<String> pattern,
+                                       RegExpFlags flags, bool is_one_byte,
+                                       uint32_t backtrack_limit,
+                                       int* register_count);
+
+  // Adds {bytecode} for {pattern}, which must be flat, to the cache. Does
+  // nothing if the cache is full.
+  static void Insert(Handle<String> pattern, RegExpFlags flags,
+                     bool is_one_byte, uint32_t backtrack_limit,
+                     Handle<ByteArray> bytecode, int register_count);
+
+  // Removes all entries, for testing.
+  static void Clear();
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_REGEXP_BYTECODE_CACHE_H_
@@ -2935,6 +2935,18 @@ void BoyerMooreLookahead::EmitSkipInstructions(RegExpMacroAssembler* masm) {
     return;
   }
 
+  // If some position can only hold a single character, the native code may
+  // be able to jump straight to its next occurrence, which is much faster
+  // than the loops below on long subjects.
+  for (int i = max_lookahead; i >= min_lookahead; i--) {
+    BoyerMoorePositionInfo* map = bitmaps_->at(i);
+    if (map->map_count() != 1) continue;
+    if (masm->SkipUntilCharacter(i, BitsetFirstSetBit(map->raw_bitset()))) {
+      return;
+    }
+    break;
+  }
+
   if (found_single_character) {
     Label cont, again;
     masm->Bind(&again);
@@ -402,6 +402,14 @@ bool RegExpMacroAssemblerTracer::CheckSpecialCharacterClass(
   return supported;
 }
 
+bool RegExpMacroAssemblerTracer::SkipUntilCharacter(int cp_offset,
+                                                    unsigned c) {
+  bool supported = assembler_->SkipUntilCharacter(cp_offset, c);
+  PrintF(" SkipUntilCharacter(cp_offset=%d, c=0x%04x): %s;\n", cp_offset, c,
+         supported ? "true" : "false");
+  return supported;
+}
+
 void RegExpMacroAssemblerTracer::IfRegisterLT(int register_index,
                                               int comparand, Label* if_lt) {
   PrintF(" IfRegisterLT(register=%d, number=%d, label[%08x]);\n",
@@ -56,6 +56,7 @@ class RegExpMacroAssemblerTracer: public RegExpMacroAssembler {
   void CheckPosition(int cp_offset, Label* on_outside_input) override;
   bool CheckSpecialCharacterClass(StandardCharacterSet type,
                                   Label* on_no_match) override;
+  bool SkipUntilCharacter(int cp_offset, unsigned c) override;
   void Fail() override;
   Handle<HeapObject> GetCode(Handle<String> source) override;
   void GoTo(Label* label) override;
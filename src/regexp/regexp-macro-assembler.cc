@@ -4,6 +4,8 @@
 
 #include "src/regexp/regexp-macro-assembler.h"
 
+#include <cstring>
+
 #include "src/codegen/assembler.h"
 #include "src/codegen/label.h"
 #include "src/execution/isolate-inl.h"
@@ -219,6 +221,25 @@ uint32_t RegExpMacroAssembler::IsCharacterInRangeArray(uint32_t current_char,
   return (current_range_start_index % 2) == 0 ? kTrue : kFalse;
 }
 
+// static
+Address RegExpMacroAssembler::SkipUntilOneByteCharacter(Address start,
+                                                        Address end,
+                                                        uint32_t c) {
+  DCHECK_LT(c, kTableSize);
+  if (start >= end) return start;
+  // memchr is vectorized by the C library, which beats a character-by-character
+  // loop in generated code on long subjects.
+  const byte* from = reinterpret_cast<const byte*>(start);
+  size_t length = end - start;
+  const void* found = memchr(from, c, length);
+  if (found != nullptr) length = static_cast<const byte*>(found) - from;
+  // Look for the only other one-byte character that is equal modulus the
+  // kTableSize, but only before the first match.
+  const void* found_high = memchr(from, c | kTableSize, length);
+  if (found_high != nullptr) found = found_high;
+  return found == nullptr ? end : reinterpret_cast<Address>(found);
+}
+
 void RegExpMacroAssembler::CheckNotInSurrogatePair(int cp_offset,
                                                    Label* on_failure) {
   Label ok;
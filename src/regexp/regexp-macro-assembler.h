@@ -116,6 +116,12 @@ class RegExpMacroAssembler {
                                           Label* on_no_match) {
     return false;
   }
+  // Advance the current position to the first position at which the character
+  // at {cp_offset}, modulus the kTableSize, equals {c}, or to the end of the
+  // input if there is none. Returns false, without emitting any code, if this
+  // is not supported.
+  // May clobber the current loaded character.
+  virtual bool SkipUntilCharacter(int cp_offset, unsigned c) { return false; }
 
   // Control-flow integrity:
   // Define a jump target and bind a label.
@@ -215,6 +221,14 @@ class RegExpMacroAssembler {
                                           Address raw_byte_array,
                                           Isolate* isolate);
 
+  // Returns the address of the first one-byte character in [start, end[ that
+  // equals {c} modulus the kTableSize, or {end} if there is none. Returns
+  // {start} if it is not before {end}.
+  //
+  // Called from generated code.
+  static Address SkipUntilOneByteCharacter(Address start, Address end,
+                                           uint32_t c);
+
   // Controls the generation of large inlined constants in the code.
   void set_slow_safe(bool ssc) { slow_safe_compiler_ = ssc; }
   bool slow_safe() const { return slow_safe_compiler_; }
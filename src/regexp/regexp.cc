@@ -9,8 +9,10 @@
 #include "src/diagnostics/code-tracer.h"
 #include "src/execution/interrupts-scope.h"
 #include "src/heap/heap-inl.h"
+#include "src/logging/counters-scopes.h"
 #include "src/objects/js-regexp-inl.h"
 #include "src/regexp/experimental/experimental.h"
+#include "src/regexp/regexp-bytecode-cache.h"
 #include "src/regexp/regexp-bytecode-generator.h"
 #include "src/regexp/regexp-bytecodes.h"
 #include "src/regexp/regexp-compiler.h"
@@ -557,9 +559,31 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
                                         ? RegExpCompilationTarget::kBytecode
                                         : RegExpCompilationTarget::kNative;
   uint32_t backtrack_limit = re->backtrack_limit();
-  const bool compilation_succeeded =
-      Compile(isolate, &zone, &compile_data, flags, pattern, sample_subject,
-              is_one_byte, backtrack_limit);
+  const bool use_shared_bytecode_cache =
+      FLAG_regexp_shared_bytecode_cache &&
+      compile_data.compilation_target == RegExpCompilationTarget::kBytecode;
+  Handle<ByteArray> cached_bytecode;
+  bool compilation_succeeded;
+  if (use_shared_bytecode_cache &&
+      RegExpBytecodeCache::Lookup(isolate, pattern, flags, is_one_byte,
+                                  backtrack_limit, &compile_data.register_count)
+          .ToHandle(&cached_bytecode)) {
+    compile_data.code = cached_bytecode;
+    compilation_succeeded = true;
+  } else {
+    TimedHistogramScope compile_timer(
+        compile_data.compilation_target == RegExpCompilationTarget::kNative
+            ? isolate->counters()->regexp_compile_native_time()
+            : isolate->counters()->regexp_compile_bytecode_time());
+    compilation_succeeded =
+        Compile(isolate, &zone, &compile_data, flags, pattern, sample_subject,
+                is_one_byte, backtrack_limit);
+    if (compilation_succeeded && use_shared_bytecode_cache) {
+      RegExpBytecodeCache::Insert(pattern, flags, is_one_byte, backtrack_limit,
+                                  Handle<ByteArray>::cast(compile_data.code),
+                                  compile_data.register_count);
+    }
+  }
   if (!compilation_succeeded) {
     DCHECK(compile_data.error != RegExpError::kNone);
     RegExp::ThrowRegExpException(isolate, re, compile_data.error);
@@ -663,6 +687,8 @@ int RegExpImpl::IrregexpExecRaw(Isolate* isolate, Handle<JSRegExp> regexp,
   DCHECK(subject->IsFlat());
   DCHECK_GE(output_size,
             JSRegExp::RegistersForCaptureCount(regexp->capture_count()));
+  TimedHistogramScope execute_timer(
+      isolate->counters()->regexp_execute_runtime_time());
 
   bool is_one_byte = String::IsOneByteRepresentationUnderneath(*subject);
 
@@ -1075,8 +1101,7 @@ RegExpGlobalCache::RegExpGlobalCache(Handle<JSRegExp> regexp,
         register_array_size_ = registers_per_match_;
         max_matches_ = 1;
       } else {
-        register_array_size_ = std::max(
-            {registers_per_match_, Isolate::kJSRegexpStaticOffsetsVectorSize});
+        register_array_size_ = BatchRegisterArraySize();
       }
       break;
     }
@@ -1089,8 +1114,7 @@ RegExpGlobalCache::RegExpGlobalCache(Handle<JSRegExp> regexp,
       }
       registers_per_match_ =
           JSRegExp::RegistersForCaptureCount(regexp->capture_count());
-      register_array_size_ = std::max(
-          {registers_per_match_, Isolate::kJSRegexpStaticOffsetsVectorSize});
+      register_array_size_ = BatchRegisterArraySize();
       break;
     }
   }
@@ -1123,6 +1147,16 @@ RegExpGlobalCache::~RegExpGlobalCache() {
   }
 }
 
+int RegExpGlobalCache::BatchRegisterArraySize() const {
+  int size = std::max(
+      {registers_per_match_, Isolate::kJSRegexpStaticOffsetsVectorSize});
+  if (subject_->length() >= kMinLengthForLargeBatches &&
+      registers_per_match_ <= kMaxInt / kMinMatchesPerBatch) {
+    size = std::max(size, registers_per_match_ * kMinMatchesPerBatch);
+  }
+  return size;
+}
+
 int RegExpGlobalCache::AdvanceZeroLength(int last_index) {
   if (IsUnicode(JSRegExp::AsRegExpFlags(regexp_->flags())) &&
       last_index + 1 < subject_->length() &&
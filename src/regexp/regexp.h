@@ -187,7 +187,14 @@ class RegExpGlobalCache final {
   bool HasException() { return num_matches_ < 0; }
 
  private:
+  // Subjects at least this long are likely to contain many matches, so a
+  // register array that holds at least kMinMatchesPerBatch matches is
+  // allocated if the static offsets vector is too small for that.
+  static constexpr int kMinLengthForLargeBatches = 0x1000;
+  static constexpr int kMinMatchesPerBatch = 64;
+
   int AdvanceZeroLength(int last_index);
+  int BatchRegisterArraySize() const;
 
   int num_matches_;
   int max_matches_;
@@ -563,6 +563,38 @@ bool RegExpMacroAssemblerX64::CheckCharacterNotInRangeArray(
   return true;
 }
 
+bool RegExpMacroAssemblerX64::SkipUntilCharacter(int cp_offset, unsigned c) {
+  if (mode_ != LATIN1 || !FLAG_regexp_skip_with_memchr) return false;
+  PushCallerSavedRegisters();
+
+  static const int kNumArguments = 3;
+  __ PrepareCallCFunction(kNumArguments);
+
+  // Parameters are
+  //   Address start - Address of the character at cp_offset.
+  //   Address end - End of input.
+  //   uint32_t c - The character to look for.
+  __ leaq(rax, Operand(rsi, rdi, times_1, cp_offset));
+  __ movq(arg_reg_2, rsi);
+  __ movq(arg_reg_1, rax);
+  __ movl(arg_reg_3, Immediate(c));
+
+  {
+    // We have a frame (set up in GetCode), but the assembler doesn't know.
+    FrameScope scope(&masm_, StackFrame::MANUAL);
+    __ CallCFunction(ExternalReference::re_skip_until_one_byte_character(),
+                     kNumArguments);
+  }
+
+  PopCallerSavedRegisters();
+  __ Move(code_object_pointer(), masm_.CodeObject());
+
+  // The returned address is that of the character at cp_offset.
+  __ subq(rax, rsi);
+  __ leaq(rdi, Operand(rax, -cp_offset));
+  return true;
+}
+
 void RegExpMacroAssemblerX64::CheckBitInTable(
     Handle<ByteArray> table,
     Label* on_bit_set) {
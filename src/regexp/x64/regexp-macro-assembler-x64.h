@@ -59,6 +59,7 @@ class V8_EXPORT_PRIVATE RegExpMacroAssemblerX64
   void CheckPosition(int cp_offset, Label* on_outside_input) override;
   bool CheckSpecialCharacterClass(StandardCharacterSet type,
                                   Label* on_no_match) override;
+  bool SkipUntilCharacter(int cp_offset, unsigned c) override;
   void Fail() override;
   Handle<HeapObject> GetCode(Handle<String> source) override;
   void GoTo(Label* label) override;
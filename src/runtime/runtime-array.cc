@@ -2,6 +2,11 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
 #include "src/debug/debug.h"
 #include "src/execution/arguments-inl.h"
 #include "src/execution/isolate-inl.h"
@@ -17,7 +22,9 @@
 #include "src/objects/hash-table-inl.h"
 #include "src/objects/js-array-inl.h"
 #include "src/objects/prototype.h"
+#include "src/objects/shared-function-info-inl.h"
 #include "src/runtime/runtime-utils.h"
+#include "src/strings/char-predicates-inl.h"
 
 namespace v8 {
 namespace internal {
@@ -217,6 +224,220 @@ RUNTIME_FUNCTION(Runtime_IsArray) {
   return isolate->heap()->ToBoolean(obj.IsJSArray());
 }
 
+// The runtime version of Cast<FastJSArrayForReadWithNoCustomIteration>, see
+// BytecodeGenerator::BuildFastDestructuringArrayAssignment.
+RUNTIME_FUNCTION(Runtime_IsFastJSArrayForDestructuring) {
+  SealHandleScope shs(isolate);
+  DCHECK_EQ(1, args.length());
+  CONVERT_ARG_CHECKED(Object, obj, 0);
+  if (!obj.IsJSArray()) return ReadOnlyRoots(isolate).false_value();
+  JSArray array = JSArray::cast(obj);
+  ElementsKind kind = array.GetElementsKind();
+  return isolate->heap()->ToBoolean(
+      Protectors::IsArrayIteratorLookupChainIntact(isolate) &&
+      Protectors::IsNoElementsIntact(isolate) &&
+      (IsFastElementsKind(kind) || IsAnyNonextensibleElementsKind(kind)) &&
+      isolate->IsInAnyContext(array.map().prototype(),
+                              Context::INITIAL_ARRAY_PROTOTYPE_INDEX));
+}
+
+namespace {
+
+enum class NumericComparator { kNone, kDefault, kAscending, kDescending };
+
+// Splits the source of a comparison function into identifiers and the few
+// punctuators that can appear in `(a, b) => a - b`. Returns false for any
+// other character, which includes comments and non-ASCII identifiers.
+template <typename Char>
+bool TokenizeComparator(base::Vector<const Char> source,
+                        std::vector<std::string>* tokens) {
+  static const size_t kMaxTokens = 16;
+  size_t i = 0;
+  while (i < source.size()) {
+    base::uc32 c = source[i];
+    if (c == ' ' || c == '\t' || c == '\n' || c == '\r') {
+      i++;
+    } else if (IsAsciiIdentifier(c) && !IsDecimalDigit(c)) {
+      std::string identifier;
+      while (i < source.size() && IsAsciiIdentifier(source[i])) {
+        identifier += static_cast<char>(source[i++]);
+      }
+      tokens->push_back(identifier);
+    } else if (c == '=' && i + 1 < source.size() && source[i + 1] == '>') {
+      tokens->push_back("=>");
+      i += 2;
+    } else if (c == '(' || c == ')' || c == ',' || c == '{' || c == '}' ||
+               c == ';' || c == '-') {
+      tokens->push_back(std::string(1, static_cast<char>(c)));
+      i++;
+    } else {
+      return false;
+    }
+    if (tokens->size() > kMaxTokens) return false;
+  }
+  return true;
+}
+
+bool IsIdentifierToken(const std::string& token) {
+  return !token.empty() && IsAsciiIdentifier(token[0]) &&
+         !IsDecimalDigit(token[0]);
+}
+
+// Recognizes comparison functions that only subtract their two parameters,
+// like `(a, b) => a - b` or `function(a, b) { return b - a; }`. Calling them
+// on numbers has no side effects and orders them like {a < b} or {b < a}.
+NumericComparator ClassifyComparator(Isolate* isolate, Object comparefn) {
+  if (comparefn.IsUndefined(isolate)) return NumericComparator::kDefault;
+  if (!comparefn.IsJSFunction()) return NumericComparator::kNone;
+  Handle<SharedFunctionInfo> shared(JSFunction::cast(comparefn).shared(),
+                                    isolate);
+  FunctionKind kind = shared->kind();
+  if (!IsArrowFunction(kind) && kind != FunctionKind::kNormalFunction) {
+    return NumericComparator::kNone;
+  }
+  if (!shared->script().IsScript() ||
+      !Script::cast(shared->script()).source().IsString()) {
+    return NumericComparator::kNone;
+  }
+  static const int kMaxComparatorSourceLength = 64;
+  int start = shared->StartPosition();
+  int end = shared->EndPosition();
+  if (end - start > kMaxComparatorSourceLength) {
+    return NumericComparator::kNone;
+  }
+
+  Handle<String> source(
+      String::cast(Script::cast(shared->script()).source()), isolate);
+  source = String::Flatten(isolate, source);
+  std::vector<std::string> tokens;
+  {
+    DisallowGarbageCollection no_gc;
+    String::FlatContent content = source->GetFlatContent(no_gc);
+    bool tokenized =
+        content.IsOneByte()
+            ? TokenizeComparator(
+                  content.ToOneByteVector().SubVector(start, end), &tokens)
+            : TokenizeComparator(
+                  content.ToUC16Vector().SubVector(start, end), &tokens);
+    if (!tokenized) return NumericComparator::kNone;
+  }
+
+  // The source range starts at the parameter list for both arrow functions
+  // and function literals.
+  size_t pos = 0;
+  auto accept = [&](const char* token) {
+    if (pos < tokens.size() && tokens[pos] == token) {
+      pos++;
+      return true;
+    }
+    return false;
+  };
+  auto identifier = [&](std::string* result) {
+    if (pos < tokens.size() && IsIdentifierToken(tokens[pos])) {
+      *result = tokens[pos++];
+      return true;
+    }
+    return false;
+  };
+
+  std::string first, second, left, right;
+  if (!accept("(") || !identifier(&first) || !accept(",") ||
+      !identifier(&second) || !accept(")") || first == second) {
+    return NumericComparator::kNone;
+  }
+  bool concise = false;
+  if (IsArrowFunction(kind)) {
+    if (!accept("=>")) return NumericComparator::kNone;
+    concise = !accept("{");
+  } else if (!accept("{")) {
+    return NumericComparator::kNone;
+  }
+  if (!concise && !accept("return")) return NumericComparator::kNone;
+  if (!identifier(&left) || !accept("-") || !identifier(&right)) {
+    return NumericComparator::kNone;
+  }
+  if (!concise) {
+    accept(";");
+    if (!accept("}")) return NumericComparator::kNone;
+  }
+  if (pos != tokens.size()) return NumericComparator::kNone;
+
+  if (left == first && right == second) return NumericComparator::kAscending;
+  if (left == second && right == first) return NumericComparator::kDescending;
+  return NumericComparator::kNone;
+}
+
+}  // namespace
+
+// Sorts large packed Smi and double arrays without calling into JavaScript,
+// if the comparison function is known to order numbers. The sort is stable
+// and the comparisons are consistent, so the result is the same as the one
+// of the TimSort in array-sort.tq. Returns false if the array has to be
+// sorted generically.
+RUNTIME_FUNCTION(Runtime_ArraySortNumeric) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(2, args.length());
+  CONVERT_ARG_HANDLE_CHECKED(JSArray, array, 0);
+  CONVERT_ARG_HANDLE_CHECKED(Object, comparefn, 1);
+  ReadOnlyRoots roots(isolate);
+
+  // Breakpoints in the comparison function have to be hit.
+  if (!FLAG_native_numeric_sort || isolate->debug()->is_active()) {
+    return roots.false_value();
+  }
+  ElementsKind kind = array->GetElementsKind();
+  if (kind != PACKED_SMI_ELEMENTS && kind != PACKED_DOUBLE_ELEMENTS) {
+    return roots.false_value();
+  }
+  NumericComparator comparator = ClassifyComparator(isolate, *comparefn);
+  if (comparator == NumericComparator::kNone) return roots.false_value();
+  // The default comparison converts doubles to strings.
+  if (comparator == NumericComparator::kDefault &&
+      kind == PACKED_DOUBLE_ELEMENTS) {
+    return roots.false_value();
+  }
+  bool descending = comparator == NumericComparator::kDescending;
+  int length = Smi::ToInt(array->length());
+
+  if (kind == PACKED_SMI_ELEMENTS) {
+    JSObject::EnsureWritableFastElements(array);
+    DisallowGarbageCollection no_gc;
+    FixedArray elements = FixedArray::cast(array->elements());
+    std::vector<Smi> values(length);
+    for (int i = 0; i < length; i++) values[i] = Smi::cast(elements.get(i));
+    if (comparator == NumericComparator::kDefault) {
+      std::stable_sort(values.begin(), values.end(), [isolate](Smi x, Smi y) {
+        return Smi(Smi::LexicographicCompare(isolate, x, y)).value() < 0;
+      });
+    } else {
+      std::stable_sort(values.begin(), values.end(),
+                       [descending](Smi x, Smi y) {
+                         return descending ? y.value() < x.value()
+                                           : x.value() < y.value();
+                       });
+    }
+    for (int i = 0; i < length; i++) elements.set(i, values[i]);
+    return roots.true_value();
+  }
+
+  DisallowGarbageCollection no_gc;
+  FixedDoubleArray elements = FixedDoubleArray::cast(array->elements());
+  std::vector<double> values(length);
+  for (int i = 0; i < length; i++) {
+    values[i] = elements.get_scalar(i);
+    // Subtracting NaN makes every comparison +0, which is not consistent.
+    if (std::isnan(values[i])) return roots.false_value();
+  }
+  // {a - b} is +0 or -0 for equal values, including 0 and -0, so these
+  // keep their order.
+  std::stable_sort(values.begin(), values.end(),
+                   [descending](double x, double y) {
+                     return descending ? y < x : x < y;
+                   });
+  for (int i = 0; i < length; i++) elements.set(i, values[i]);
+  return roots.true_value();
+}
+
 RUNTIME_FUNCTION(Runtime_ArraySpeciesConstructor) {
   HandleScope scope(isolate);
   DCHECK_EQ(1, args.length());
@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include "src/api/api-inl.h"
 #include "src/asmjs/asm-js.h"
 #include "src/baseline/baseline.h"
 #include "src/codegen/compilation-cache.h"
@@ -177,6 +178,51 @@ RUNTIME_FUNCTION(Runtime_InstantiateAsmJs) {
   return Smi::zero();
 }
 
+namespace {
+
+// Counts an eager or soft deopt of {function}. With --deopt-loop-detection,
+// a function that keeps deoptimizing is no longer optimized; returns true if
+// this deopt disabled its optimization.
+bool CountDeoptimization(Handle<JSFunction> function) {
+  SharedFunctionInfo shared = function->shared();
+  shared.increment_deopt_count();
+  if (!FLAG_deopt_loop_detection || shared.optimization_disabled()) {
+    return false;
+  }
+  int max_deopt_count = std::max(
+      1, std::min(FLAG_max_deopt_count, SharedFunctionInfo::kMaxDeoptCount));
+  if (shared.deopt_count() < max_deopt_count) return false;
+  shared.DisableOptimization(BailoutReason::kDeoptimizedTooOften);
+  return true;
+}
+
+void ReportDeoptimization(Isolate* isolate, Handle<JSFunction> function,
+                          DeoptimizeKind kind, DeoptimizeReason reason,
+                          bool optimization_disabled) {
+  DeoptimizationCallback callback = isolate->deoptimization_callback();
+  if (callback == nullptr) return;
+  DisallowJavascriptExecution no_js(isolate);
+  DeoptimizationInfo info;
+  info.function = Utils::ToLocal(function);
+  info.reason = DeoptimizeReasonToString(reason);
+  switch (kind) {
+    case DeoptimizeKind::kSoft:
+      info.kind = DeoptimizationKind::kSoft;
+      break;
+    case DeoptimizeKind::kLazy:
+      info.kind = DeoptimizationKind::kLazy;
+      break;
+    default:
+      info.kind = DeoptimizationKind::kEager;
+      break;
+  }
+  info.deopt_count = function->shared().deopt_count();
+  info.optimization_disabled = optimization_disabled;
+  callback(reinterpret_cast<v8::Isolate*>(isolate), info);
+}
+
+}  // namespace
+
 RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
   HandleScope scope(isolate);
   DCHECK_EQ(0, args.length());
@@ -194,6 +240,7 @@ RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
   Handle<Code> optimized_code = deoptimizer->compiled_code();
   DeoptimizeKind type = deoptimizer->deopt_kind();
   bool should_reuse_code = deoptimizer->should_reuse_code();
+  DeoptimizeReason reason = deoptimizer->deopt_reason();
 
   // TODO(turbofan): We currently need the native context to materialize
   // the arguments object, but only to get to its map.
@@ -214,9 +261,13 @@ RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
   }
 
   // Invalidate the underlying optimized code on eager and soft deopts.
+  bool optimization_disabled = false;
   if (type == DeoptimizeKind::kEager || type == DeoptimizeKind::kSoft) {
     Deoptimizer::DeoptimizeFunction(*function, *optimized_code);
+    optimization_disabled = CountDeoptimization(function);
   }
+  ReportDeoptimization(isolate, function, type, reason,
+                       optimization_disabled);
 
   return ReadOnlyRoots(isolate).undefined_value();
 }
@@ -312,6 +363,19 @@ RUNTIME_FUNCTION(Runtime_CompileForOnStackReplacement) {
 
   MaybeHandle<Code> maybe_result;
   Handle<JSFunction> function(frame->function(), isolate);
+  const bool concurrent_osr =
+      FLAG_concurrent_osr && isolate->concurrent_recompilation_enabled();
+  if (concurrent_osr && function->IsInOptimizationQueue()) {
+    // A job for this function is pending. Keep running unoptimized code, a
+    // finished OSR job arms the back edges again.
+    if (FLAG_trace_osr) {
+      CodeTracer::Scope scope(isolate->GetCodeTracer());
+      PrintF(scope.file(), "[OSR - Pending: ");
+      function->PrintName(scope.file());
+      PrintF(scope.file(), " at OSR bytecode offset %d]\n", osr_offset.ToInt());
+    }
+    return Object();
+  }
   if (IsSuitableForOnStackReplacement(isolate, function)) {
     if (FLAG_trace_osr) {
       CodeTracer::Scope scope(isolate->GetCodeTracer());
@@ -319,8 +383,10 @@ RUNTIME_FUNCTION(Runtime_CompileForOnStackReplacement) {
       function->PrintName(scope.file());
       PrintF(scope.file(), " at OSR bytecode offset %d]\n", osr_offset.ToInt());
     }
-    maybe_result =
-        Compiler::GetOptimizedCodeForOSR(isolate, function, osr_offset, frame);
+    maybe_result = Compiler::GetOptimizedCodeForOSR(
+        isolate, function, osr_offset, frame,
+        concurrent_osr ? ConcurrencyMode::kConcurrent
+                       : ConcurrencyMode::kNotConcurrent);
   }
 
   // Check whether we ended up with usable optimized code.
@@ -376,10 +442,11 @@ RUNTIME_FUNCTION(Runtime_CompileForOnStackReplacement) {
     }
   }
 
-  // Failed.
+  // Failed, or queued for concurrent compilation.
   if (FLAG_trace_osr) {
     CodeTracer::Scope scope(isolate->GetCodeTracer());
-    PrintF(scope.file(), "[OSR - Failed: ");
+    PrintF(scope.file(), function->IsInOptimizationQueue() ? "[OSR - Queued: "
+                                                           : "[OSR - Failed: ");
     function->PrintName(scope.file());
     PrintF(scope.file(), " at OSR bytecode offset %d]\n", osr_offset.ToInt());
   }
@@ -808,6 +808,15 @@ RUNTIME_FUNCTION(Runtime_DebugToggleBlockCoverage) {
   return ReadOnlyRoots(isolate).undefined_value();
 }
 
+RUNTIME_FUNCTION(Runtime_DebugToggleSampledBlockCoverage) {
+  SealHandleScope shs(isolate);
+  CONVERT_BOOLEAN_ARG_CHECKED(enable, 0);
+  Coverage::SelectMode(isolate, enable
+                                    ? debug::CoverageMode::kSampledBlockCount
+                                    : debug::CoverageMode::kBestEffort);
+  return ReadOnlyRoots(isolate).undefined_value();
+}
+
 RUNTIME_FUNCTION(Runtime_IncBlockCounter) {
   UNREACHABLE();  // Never called. See the IncBlockCounter builtin instead.
 }
@@ -6,6 +6,7 @@
 #include "src/common/globals.h"
 #include "src/execution/arguments-inl.h"
 #include "src/execution/isolate-inl.h"
+#include "src/heap/pretenuring-hints.h"
 #include "src/logging/counters.h"
 #include "src/objects/allocation-site-scopes-inl.h"
 #include "src/objects/hash-table-inl.h"
@@ -564,6 +565,11 @@ MaybeHandle<JSObject> CreateLiteral(Isolate* isolate,
                         JSObject);
     creation_context.ExitScope(site, boilerplate);
 
+    if (FLAG_share_pretenuring_decisions &&
+        PretenuringHints::ShouldPretenure(*vector, literals_slot)) {
+      site->set_pretenure_decision(AllocationSite::kTenure);
+    }
+
     vector->SynchronizedSet(literals_slot, *site);
   }
 
@@ -1231,6 +1231,9 @@ static Object SearchRegExpMultiple(Isolate* isolate, Handle<String> subject,
   // Two smis before and after the match, for very long strings.
   static const int kMaxBuilderEntriesPerRegExpMatch = 5;
 
+  Handle<Object> maybe_capture_map(regexp->capture_name_map(), isolate);
+  const bool has_named_captures = maybe_capture_map->IsFixedArray();
+
   while (true) {
     int32_t* current_match = global_cache.FetchNext();
     if (current_match == nullptr) break;
@@ -1258,10 +1261,6 @@ static Object SearchRegExpMultiple(Isolate* isolate, Handle<String> subject,
         // Arguments array to replace function is match, captures, index and
         // subject, i.e., 3 + capture count in total. If the RegExp contains
         // named captures, they are also passed as the last argument.
-
-        Handle<Object> maybe_capture_map(regexp->capture_name_map(), isolate);
-        const bool has_named_captures = maybe_capture_map->IsFixedArray();
-
         const int argc =
             has_named_captures ? 4 + capture_count : 3 + capture_count;
 
@@ -790,6 +790,11 @@ MaybeHandle<Object> StoreLookupSlot(
                       Object);
     }
     if ((attributes & READ_ONLY) == 0) {
+      if (FLAG_const_tracking_let && holder->IsScriptContext()) {
+        Context script_context = Context::cast(*holder);
+        script_context.native_context().InvalidateConstTrackingLet(
+            script_context, index);
+      }
       Handle<Context>::cast(holder)->set(index, *value);
     } else if (!is_sloppy_function_name || is_strict(language_mode)) {
       THROW_NEW_ERROR(
@@ -2,6 +2,10 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
 #include "src/base/atomicops.h"
 #include "src/common/message-template.h"
 #include "src/execution/arguments-inl.h"
@@ -84,6 +88,64 @@ bool CompareNum(T x, T y) {
   return false;
 }
 
+// Integer arrays at least this long are sorted with RadixSort.
+constexpr size_t kMinRadixSortLength = 256;
+
+// LSD radix sort on bytes for integers of up to 32 bits. Passes in which all
+// elements have the same digit are skipped, so 8-bit arrays and arrays of
+// small values need a single counting pass.
+template <typename T>
+void RadixSort(T* data, size_t length) {
+  using U = typename std::make_unsigned<T>::type;
+  STATIC_ASSERT(sizeof(T) <= sizeof(uint32_t));
+  // Flipping the sign bit orders signed values like unsigned ones.
+  const U sign_flip =
+      std::is_signed<T>::value ? static_cast<U>(U{1} << (8 * sizeof(T) - 1))
+                               : U{0};
+  std::vector<T> scratch(length);
+  T* from = data;
+  T* to = scratch.data();
+  for (size_t shift = 0; shift < 8 * sizeof(T); shift += 8) {
+    auto digit = [=](T value) {
+      return static_cast<uint8_t>((static_cast<U>(value) ^ sign_flip) >>
+                                  shift);
+    };
+    size_t offsets[256] = {0};
+    for (size_t i = 0; i < length; i++) offsets[digit(from[i])]++;
+    if (offsets[digit(from[0])] == length) continue;
+    size_t offset = 0;
+    for (size_t& count : offsets) {
+      size_t next = offset + count;
+      count = offset;
+      offset = next;
+    }
+    for (size_t i = 0; i < length; i++) to[offsets[digit(from[i])]++] = from[i];
+    std::swap(from, to);
+  }
+  if (from != data) std::copy(from, from + length, data);
+}
+
+template <typename T>
+using IsRadixSortable =
+    std::integral_constant<bool, std::is_integral<T>::value &&
+                                     sizeof(T) <= sizeof(uint32_t)>;
+
+template <typename T>
+typename std::enable_if<IsRadixSortable<T>::value>::type SortIntegers(
+    T* data, size_t length) {
+  if (length >= kMinRadixSortLength) {
+    RadixSort(data, length);
+  } else {
+    std::sort(data, data + length);
+  }
+}
+
+template <typename T>
+typename std::enable_if<!IsRadixSortable<T>::value>::type SortIntegers(
+    T* data, size_t length) {
+  std::sort(data, data + length);
+}
+
 }  // namespace
 
 RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
@@ -152,7 +214,7 @@ RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
         std::sort(UnalignedSlot<ctype>(data),                              \
                   UnalignedSlot<ctype>(data + length));                    \
       } else {                                                             \
-        std::sort(data, data + length);                                    \
+        SortIntegers(data, length);                                        \
       }                                                                    \
     }                                                                      \
     break;                                                                 \
@@ -40,16 +40,18 @@ namespace internal {
 // inline), use the F macro below. To declare the runtime version and the inline
 // version simultaneously, use the I macro below.
 
-#define FOR_EACH_INTRINSIC_ARRAY(F, I) \
-  F(ArrayIncludes_Slow, 3, 1)          \
-  F(ArrayIndexOf, 3, 1)                \
-  F(ArrayIsArray, 1, 1)                \
-  F(ArraySpeciesConstructor, 1, 1)     \
-  F(GrowArrayElements, 2, 1)           \
-  F(IsArray, 1, 1)                     \
-  F(NewArray, -1 /* >= 3 */, 1)        \
-  F(NormalizeElements, 1, 1)           \
-  F(TransitionElementsKind, 2, 1)      \
+#define FOR_EACH_INTRINSIC_ARRAY(F, I)   \
+  F(ArrayIncludes_Slow, 3, 1)            \
+  F(ArrayIndexOf, 3, 1)                  \
+  F(ArrayIsArray, 1, 1)                  \
+  F(ArraySortNumeric, 2, 1)              \
+  F(ArraySpeciesConstructor, 1, 1)       \
+  F(GrowArrayElements, 2, 1)             \
+  F(IsArray, 1, 1)                       \
+  I(IsFastJSArrayForDestructuring, 1, 1) \
+  F(NewArray, -1 /* >= 3 */, 1)          \
+  F(NormalizeElements, 1, 1)             \
+  F(TransitionElementsKind, 2, 1)        \
   F(TransitionElementsKindWithKind, 2, 1)
 
 #define FOR_EACH_INTRINSIC_ATOMICS(F, I)               \
@@ -135,6 +137,7 @@ namespace internal {
   F(DebugPushPromise, 1, 1)                     \
   F(DebugToggleBlockCoverage, 1, 1)             \
   F(DebugTogglePreciseCoverage, 1, 1)           \
+  F(DebugToggleSampledBlockCoverage, 1, 1)      \
   F(FunctionGetInferredName, 1, 1)              \
   F(GetBreakLocations, 1, 1)                    \
   F(GetGeneratorScopeCount, 1, 1)               \
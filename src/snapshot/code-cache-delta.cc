@@ -0,0 +1,215 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/snapshot/code-cache-delta.h"
+
+#include <algorithm>
+#include <unordered_set>
+
+#include "src/codegen/compiler.h"
+#include "src/execution/isolate.h"
+#include "src/objects/objects-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+#include "src/snapshot/snapshot-utils.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+/*
+
+  Format of a delta (all values are host-endian uint32s):
+
+  ------------------------------------
+  | magic number                     |
+  | format version                   |
+  | source checksum                  |
+  | number of functions              |
+  ------------------------------------
+  | function literal id              | << for each function, by ascending id
+  | start position                   |
+  | end position                     |
+  ------------------------------------
+
+ */
+
+struct CompiledFunction {
+  int function_literal_id;
+  int start_position;
+  int end_position;
+};
+
+uint32_t SourceChecksum(Isolate* isolate, Handle<String> source) {
+  source = String::Flatten(isolate, source);
+  DisallowGarbageCollection no_gc;
+  String::FlatContent content = source->GetFlatContent(no_gc);
+  if (content.IsOneByte()) {
+    return Checksum(base::Vector<const byte>::cast(content.ToOneByteVector()));
+  }
+  return Checksum(base::Vector<const byte>::cast(content.ToUC16Vector()));
+}
+
+uint32_t SourceChecksum(Isolate* isolate, Handle<Script> script) {
+  return SourceChecksum(isolate,
+                        handle(String::cast(script->source()), isolate));
+}
+
+// Returns the compiled functions of {script} other than the top level one,
+// ordered by function literal id.
+std::vector<CompiledFunction> CompiledFunctions(Isolate* isolate,
+                                                Script script) {
+  DisallowGarbageCollection no_gc;
+  std::vector<CompiledFunction> result;
+  SharedFunctionInfo::ScriptIterator iter(isolate, script);
+  for (SharedFunctionInfo shared = iter.Next(); !shared.is_null();
+       shared = iter.Next()) {
+    if (shared.is_toplevel() || !shared.is_compiled()) continue;
+    result.push_back({shared.function_literal_id(), shared.StartPosition(),
+                      shared.EndPosition()});
+  }
+  std::sort(result.begin(), result.end(),
+            [](const CompiledFunction& a, const CompiledFunction& b) {
+              return a.function_literal_id < b.function_literal_id;
+            });
+  return result;
+}
+
+// Compiles the uncompiled functions of {script} among {functions}, which are
+// ordered by function literal id. Inner functions only get a
+// SharedFunctionInfo once their outer function is compiled, and they have
+// higher ids, so compiling in this order reaches all of them.
+int CompileFunctions(Isolate* isolate, Handle<Script> script,
+                     const std::vector<CompiledFunction>& functions) {
+  int compiled = 0;
+  for (const CompiledFunction& function : functions) {
+    if (function.function_literal_id <= 0 ||
+        function.function_literal_id >= script->shared_function_info_count()) {
+      continue;
+    }
+    HandleScope scope(isolate);
+    MaybeObject maybe_shared =
+        script->shared_function_infos().Get(function.function_literal_id);
+    HeapObject heap_object;
+    if (!maybe_shared->GetHeapObject(&heap_object) ||
+        !heap_object.IsSharedFunctionInfo()) {
+      continue;
+    }
+    Handle<SharedFunctionInfo> shared(SharedFunctionInfo::cast(heap_object),
+                                      isolate);
+    // Skip functions that do not match, e.g. because the delta was produced
+    // by a V8 version that numbers the functions differently.
+    if (shared->is_compiled() ||
+        shared->StartPosition() != function.start_position ||
+        shared->EndPosition() != function.end_position) {
+      continue;
+    }
+    IsCompiledScope is_compiled_scope;
+    if (Compiler::Compile(isolate, shared, Compiler::CLEAR_EXCEPTION,
+                          &is_compiled_scope)) {
+      compiled++;
+    }
+  }
+  return compiled;
+}
+
+void WriteUint32(std::vector<byte>* data, uint32_t value) {
+  const byte* bytes = reinterpret_cast<const byte*>(&value);
+  data->insert(data->end(), bytes, bytes + sizeof(value));
+}
+
+bool ReadUint32(base::Vector<const byte> data, size_t* position,
+                uint32_t* value) {
+  if (data.length() - *position < sizeof(*value)) return false;
+  memcpy(value, data.begin() + *position, sizeof(*value));
+  *position += sizeof(*value);
+  return true;
+}
+
+bool ReadInt(base::Vector<const byte> data, size_t* position, int* value) {
+  uint32_t raw;
+  if (!ReadUint32(data, position, &raw) ||
+      raw > static_cast<uint32_t>(kMaxInt)) {
+    return false;
+  }
+  *value = static_cast<int>(raw);
+  return true;
+}
+
+}  // namespace
+
+// static
+std::vector<byte> CodeCacheDelta::Serialize(Isolate* isolate,
+                                            Handle<Script> script,
+                                            MaybeHandle<Script> base) {
+  std::vector<CompiledFunction> functions = CompiledFunctions(isolate, *script);
+  Handle<Script> base_script;
+  if (base.ToHandle(&base_script)) {
+    std::unordered_set<int> base_ids;
+    for (const CompiledFunction& function :
+         CompiledFunctions(isolate, *base_script)) {
+      base_ids.insert(function.function_literal_id);
+    }
+    functions.erase(
+        std::remove_if(functions.begin(), functions.end(),
+                       [&](const CompiledFunction& function) {
+                         return base_ids.count(function.function_literal_id);
+                       }),
+        functions.end());
+  }
+
+  std::vector<byte> result;
+  WriteUint32(&result, kMagicNumber);
+  WriteUint32(&result, kFormatVersion);
+  WriteUint32(&result, SourceChecksum(isolate, script));
+  WriteUint32(&result, static_cast<uint32_t>(functions.size()));
+  for (const CompiledFunction& function : functions) {
+    WriteUint32(&result, function.function_literal_id);
+    WriteUint32(&result, function.start_position);
+    WriteUint32(&result, function.end_position);
+  }
+  return result;
+}
+
+// static
+int CodeCacheDelta::Apply(Isolate* isolate, Handle<Script> script,
+                          base::Vector<const byte> data) {
+  size_t position = 0;
+  uint32_t magic_number, format_version, checksum;
+  int count;
+  if (!ReadUint32(data, &position, &magic_number) ||
+      magic_number != kMagicNumber ||
+      !ReadUint32(data, &position, &format_version) ||
+      format_version != kFormatVersion ||
+      !ReadUint32(data, &position, &checksum) ||
+      checksum != SourceChecksum(isolate, script) ||
+      !ReadInt(data, &position, &count) ||
+      data.length() - position !=
+          static_cast<size_t>(count) * 3 * sizeof(uint32_t)) {
+    return -1;
+  }
+
+  std::vector<CompiledFunction> functions(count);
+  for (CompiledFunction& function : functions) {
+    if (!ReadInt(data, &position, &function.function_literal_id) ||
+        !ReadInt(data, &position, &function.start_position) ||
+        !ReadInt(data, &position, &function.end_position)) {
+      return -1;
+    }
+  }
+  std::sort(functions.begin(), functions.end(),
+            [](const CompiledFunction& a, const CompiledFunction& b) {
+              return a.function_literal_id < b.function_literal_id;
+            });
+  return CompileFunctions(isolate, script, functions);
+}
+
+// static
+int CodeCacheDelta::Merge(Isolate* isolate, Handle<Script> script,
+                          Handle<Script> other) {
+  return CompileFunctions(isolate, script, CompiledFunctions(isolate, *other));
+}
+
+}  // namespace internal
+}  // namespace v8
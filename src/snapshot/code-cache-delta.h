@@ -0,0 +1,55 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_SNAPSHOT_CODE_CACHE_DELTA_H_
+#define V8_SNAPSHOT_CODE_CACHE_DELTA_H_
+
+#include <vector>
+
+#include "src/base/vector.h"
+#include "src/common/globals.h"
+#include "src/handles/handles.h"
+
+namespace v8 {
+namespace internal {
+
+class Script;
+
+// A compact record of which functions of a script are compiled, used to grow
+// a code cache over several runs. Rather than bytecode, a delta contains the
+// function literal id and source range of each compiled function, so it is
+// small and, like the PreparseDataCache, only checked against its own format
+// version and a checksum of the script source.
+//
+// Applying a delta (or merging a code cache) compiles the listed functions of
+// a script that are not compiled yet. A code cache created from the script
+// afterwards covers the union of the compiled functions.
+class V8_EXPORT_PRIVATE CodeCacheDelta : public AllStatic {
+ public:
+  // Serializes the compiled functions of {script} that are not compiled in
+  // {base}, if given. {base} has to be a script with the same source, usually
+  // the one deserialized from the code cache {script} was loaded from.
+  static std::vector<byte> Serialize(Isolate* isolate, Handle<Script> script,
+                                     MaybeHandle<Script> base);
+
+  // Compiles the functions of {script} listed in {data}. Returns the number
+  // of functions that were compiled, or -1 if {data} was rejected.
+  static int Apply(Isolate* isolate, Handle<Script> script,
+                   base::Vector<const byte> data);
+
+  // Compiles the functions of {script} that are compiled in {other}, a script
+  // with the same source. Returns the number of functions that were compiled.
+  static int Merge(Isolate* isolate, Handle<Script> script,
+                   Handle<Script> other);
+
+ private:
+  static const uint32_t kMagicNumber = 0xC0DEDE17;
+  // Bump this whenever the format changes.
+  static const uint32_t kFormatVersion = 1;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_SNAPSHOT_CODE_CACHE_DELTA_H_
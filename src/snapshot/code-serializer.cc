@@ -9,6 +9,7 @@
 #include "src/base/logging.h"
 #include "src/base/platform/elapsed-timer.h"
 #include "src/base/platform/platform.h"
+#include "src/codegen/compiler.h"
 #include "src/codegen/macro-assembler.h"
 #include "src/common/globals.h"
 #include "src/debug/debug.h"
@@ -189,8 +190,17 @@ void CodeSerializer::SerializeObjectImpl(Handle<HeapObject> obj) {
     }
     DCHECK(!sfi->HasDebugInfo());
 
+    // The baseline code itself is replaced by its bytecode when serialized
+    // (see Serializer::SerializeObject), but we remember that the function
+    // had been hot enough to be compiled with Sparkplug.
+    const bool baseline_code_hint =
+        FLAG_sparkplug_code_cache_hints && sfi->HasBaselineCode();
+    if (baseline_code_hint) sfi->set_has_baseline_code_hint(true);
+
     SerializeGeneric(obj);
 
+    if (baseline_code_hint) sfi->set_has_baseline_code_hint(false);
+
     // Restore debug info
     if (!debug_info.is_null()) {
       sfi->set_script_or_debug_info(debug_info, kReleaseStore);
@@ -305,6 +315,27 @@ class StressOffThreadDeserializeThread final : public base::Thread {
   CodeSerializer::OffThreadDeserializeData off_thread_data_;
 };
 
+// Compiles the functions that had baseline code when the code cache was
+// created with Sparkplug right away, instead of waiting for them to get hot
+// again.
+void CompileBaselineCodeHints(Isolate* isolate,
+                              Handle<SharedFunctionInfo> result) {
+  Handle<Script> script(Script::cast(result->script()), isolate);
+  CodePageCollectionMemoryModificationScope batch_allocation(isolate->heap());
+  SharedFunctionInfo::ScriptIterator iter(isolate, *script);
+  for (SharedFunctionInfo info = iter.Next(); !info.is_null();
+       info = iter.Next()) {
+    if (!info.has_baseline_code_hint()) continue;
+    info.set_has_baseline_code_hint(false);
+    if (!info.is_compiled()) continue;
+    Handle<SharedFunctionInfo> shared_info(info, isolate);
+    IsCompiledScope is_compiled_scope(shared_info->is_compiled_scope(isolate));
+    Compiler::CompileSharedWithBaseline(isolate, shared_info,
+                                        Compiler::CLEAR_EXCEPTION,
+                                        &is_compiled_scope);
+  }
+}
+
 void FinalizeDeserialization(Isolate* isolate,
                              Handle<SharedFunctionInfo> result,
                              const base::ElapsedTimer& timer) {
@@ -319,6 +350,10 @@ void FinalizeDeserialization(Isolate* isolate,
                                              log_code_creation);
 #endif  // V8_TARGET_ARCH_ARM
 
+  if (FLAG_sparkplug_code_cache_hints) {
+    CompileBaselineCodeHints(isolate, result);
+  }
+
   bool needs_source_positions = isolate->NeedsSourcePositionsForProfiling();
 
   if (log_code_creation || FLAG_log_function_events) {
@@ -461,12 +496,14 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::FinishOffThreadDeserialize(
 
   HandleScope scope(isolate);
 
-  // Check again now that we have the source.
+  // Check again now that we have the source. The rest of the data, including
+  // the payload checksum, was already checked on the background thread.
   SerializedCodeData::SanityCheckResult sanity_check_result =
       SerializedCodeData::CHECK_SUCCESS;
-  const SerializedCodeData scd = SerializedCodeData::FromCachedData(
-      cached_data, SerializedCodeData::SourceHash(source, origin_options),
-      &sanity_check_result);
+  const SerializedCodeData scd =
+      SerializedCodeData::FromPartiallySanityCheckedCachedData(
+          cached_data, SerializedCodeData::SourceHash(source, origin_options),
+          &sanity_check_result);
   if (sanity_check_result != SerializedCodeData::CHECK_SUCCESS) {
     // The only case where the deserialization result could exist despite a
     // check failure is on a source mismatch, since we can't test for this
@@ -558,6 +595,11 @@ SerializedCodeData::SanityCheckResult SerializedCodeData::SanityCheck(
     uint32_t expected_source_hash) const {
   SanityCheckResult result = SanityCheckWithoutSource();
   if (result != CHECK_SUCCESS) return result;
+  return SanityCheckJustSource(expected_source_hash);
+}
+
+SerializedCodeData::SanityCheckResult SerializedCodeData::SanityCheckJustSource(
+    uint32_t expected_source_hash) const {
   uint32_t source_hash = GetHeaderValue(kSourceHashOffset);
   if (source_hash != expected_source_hash) return SOURCE_MISMATCH;
   return CHECK_SUCCESS;
@@ -637,5 +679,26 @@ SerializedCodeData SerializedCodeData::FromCachedDataWithoutSource(
   return scd;
 }
 
+SerializedCodeData SerializedCodeData::FromPartiallySanityCheckedCachedData(
+    AlignedCachedData* cached_data, uint32_t expected_source_hash,
+    SanityCheckResult* rejection_result) {
+  DisallowGarbageCollection no_gc;
+  // The previous call to FromCachedDataWithoutSource may have already rejected
+  // the cached data, so re-run the full sanity check to get the reason.
+  if (cached_data->rejected()) {
+    SerializedCodeData scd(cached_data);
+    *rejection_result = scd.SanityCheck(expected_source_hash);
+    DCHECK_NE(*rejection_result, CHECK_SUCCESS);
+    return SerializedCodeData(nullptr, 0);
+  }
+  SerializedCodeData scd(cached_data);
+  *rejection_result = scd.SanityCheckJustSource(expected_source_hash);
+  if (*rejection_result != CHECK_SUCCESS) {
+    cached_data->Reject();
+    return SerializedCodeData(nullptr, 0);
+  }
+  return scd;
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -134,6 +134,12 @@ class SerializedCodeData : public SerializedData {
                                            SanityCheckResult* rejection_result);
   static SerializedCodeData FromCachedDataWithoutSource(
       AlignedCachedData* cached_data, SanityCheckResult* rejection_result);
+  // Only checks the source hash, for data that already passed
+  // FromCachedDataWithoutSource (e.g. on a background thread). This avoids
+  // recomputing the payload checksum.
+  static SerializedCodeData FromPartiallySanityCheckedCachedData(
+      AlignedCachedData* cached_data, uint32_t expected_source_hash,
+      SanityCheckResult* rejection_result);
 
   // Used when producing.
   SerializedCodeData(const std::vector<byte>* payload,
@@ -158,6 +164,7 @@ class SerializedCodeData : public SerializedData {
 
   SanityCheckResult SanityCheck(uint32_t expected_source_hash) const;
   SanityCheckResult SanityCheckWithoutSource() const;
+  SanityCheckResult SanityCheckJustSource(uint32_t expected_source_hash) const;
 };
 
 }  // namespace internal
@@ -4,6 +4,9 @@
 
 #include "src/snapshot/embedded/embedded-data.h"
 
+#include <algorithm>
+
+#include "src/builtins/profile-data-reader.h"
 #include "src/codegen/assembler-inl.h"
 #include "src/codegen/callable.h"
 #include "src/codegen/interface-descriptors-inl.h"
@@ -19,7 +22,7 @@ namespace {
 Builtin TryLookupCode(const EmbeddedData& d, Address address) {
   if (!d.IsInCodeRange(address)) return Builtin::kNoBuiltinId;
 
-  if (address < d.InstructionStartOfBuiltin(static_cast<Builtin>(0))) {
+  if (address < d.InstructionStartOfBuiltin(d.BuiltinInLayoutOrder(0))) {
     return Builtin::kNoBuiltinId;
   }
 
@@ -30,7 +33,7 @@ Builtin TryLookupCode(const EmbeddedData& d, Address address) {
   int l = 0, r = Builtins::kBuiltinCount;
   while (l < r) {
     const int mid = (l + r) / 2;
-    const Builtin builtin = Builtins::FromInt(mid);
+    const Builtin builtin = d.BuiltinInLayoutOrder(mid);
     Address start = d.InstructionStartOfBuiltin(builtin);
     Address end = start + d.PaddedInstructionSizeOfBuiltin(builtin);
 
@@ -203,6 +206,41 @@ bool BuiltinAliasesOffHeapTrampolineRegister(Isolate* isolate, Code code) {
   return false;
 }
 
+// Returns the order of the builtins in the code section. With
+// --reorder-builtins, the builtins that were called most often while profiling
+// come first, so that the hot ones share cache lines and pages. Bytecode
+// handlers stay at the end in id order, since the interpreter entry range is
+// checked as a single contiguous block.
+std::vector<Builtin> BuiltinLayoutOrder() {
+  std::vector<Builtin> order;
+  order.reserve(Builtins::kBuiltinCount);
+  for (Builtin builtin = Builtins::kFirst;
+       builtin < Builtin::kFirstBytecodeHandler; ++builtin) {
+    order.push_back(builtin);
+  }
+  if (FLAG_reorder_builtins) {
+    std::vector<double> counts(Builtins::kBuiltinCount, 0);
+    for (Builtin builtin : order) {
+      const ProfileDataFromFile* profile =
+          ProfileDataFromFile::TryRead(Builtins::name(builtin));
+      // Block 0 is the entry block, so its count is the number of calls.
+      if (profile != nullptr) {
+        counts[static_cast<int>(builtin)] = profile->GetCounter(0);
+      }
+    }
+    std::stable_sort(order.begin(), order.end(),
+                     [&counts](Builtin a, Builtin b) {
+                       return counts[static_cast<int>(a)] >
+                              counts[static_cast<int>(b)];
+                     });
+  }
+  for (Builtin builtin = Builtin::kFirstBytecodeHandler;
+       builtin <= Builtins::kLast; ++builtin) {
+    order.push_back(builtin);
+  }
+  return order;
+}
+
 void FinalizeEmbeddedCodeTargets(Isolate* isolate, EmbeddedData* blob) {
   static const int kRelocMask =
       RelocInfo::ModeMask(RelocInfo::CODE_TARGET) |
@@ -258,6 +296,10 @@ EmbeddedData EmbeddedData::FromIsolate(Isolate* isolate) {
 
   // Store instruction stream lengths and offsets.
   std::vector<struct LayoutDescription> layout_descriptions(kTableSize);
+  // The instruction streams are laid out in this order, the metadata sections
+  // in id order.
+  const std::vector<Builtin> layout_order = BuiltinLayoutOrder();
+  DCHECK_EQ(kTableSize, layout_order.size());
 
   bool saw_unsafe_builtin = false;
   uint32_t raw_code_size = 0;
@@ -284,17 +326,21 @@ EmbeddedData EmbeddedData::FromIsolate(Isolate* isolate) {
         static_cast<uint32_t>(code.raw_instruction_size());
     uint32_t metadata_size = static_cast<uint32_t>(code.raw_metadata_size());
 
-    DCHECK_EQ(0, raw_code_size % kCodeAlignment);
     const int builtin_index = static_cast<int>(builtin);
-    layout_descriptions[builtin_index].instruction_offset = raw_code_size;
     layout_descriptions[builtin_index].instruction_length = instruction_size;
     layout_descriptions[builtin_index].metadata_offset = raw_data_size;
     layout_descriptions[builtin_index].metadata_length = metadata_size;
 
     // Align the start of each section.
-    raw_code_size += PadAndAlignCode(instruction_size);
     raw_data_size += PadAndAlignData(metadata_size);
   }
+  for (Builtin builtin : layout_order) {
+    DCHECK_EQ(0, raw_code_size % kCodeAlignment);
+    struct LayoutDescription& desc =
+        layout_descriptions[static_cast<int>(builtin)];
+    desc.instruction_offset = raw_code_size;
+    raw_code_size += PadAndAlignCode(desc.instruction_length);
+  }
   CHECK_WITH_MSG(
       !saw_unsafe_builtin,
       "One or more builtins marked as isolate-independent either contains "
@@ -328,6 +374,19 @@ EmbeddedData EmbeddedData::FromIsolate(Isolate* isolate) {
   std::memcpy(blob_data + LayoutDescriptionTableOffset(),
               layout_descriptions.data(), LayoutDescriptionTableSize());
 
+  // Write the builtin lookup table.
+  {
+    std::vector<int32_t> lookup_table;
+    lookup_table.reserve(kTableSize);
+    for (Builtin builtin : layout_order) {
+      lookup_table.push_back(static_cast<int32_t>(builtin));
+    }
+    DCHECK_EQ(BuiltinLookupTableSize(),
+              sizeof(lookup_table[0]) * lookup_table.size());
+    std::memcpy(blob_data + BuiltinLookupTableOffset(), lookup_table.data(),
+                BuiltinLookupTableSize());
+  }
+
   // .. and the variable-size data section.
   uint8_t* const raw_metadata_start = blob_data + RawMetadataOffset();
   STATIC_ASSERT(Builtins::kAllBuiltinsAreIsolateIndependent);
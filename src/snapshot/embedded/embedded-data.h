@@ -117,6 +117,14 @@ class EmbeddedData final {
   Address MetadataStartOfBuiltin(Builtin builtin) const;
   uint32_t MetadataSizeOfBuiltin(Builtin builtin) const;
 
+  // Returns the builtin whose instructions are the |index|-th in the code
+  // section. Bytecode handlers always come last, in their id order.
+  Builtin BuiltinInLayoutOrder(int index) const {
+    DCHECK_LE(0, index);
+    DCHECK_LT(index, Builtins::kBuiltinCount);
+    return Builtins::FromInt(BuiltinLookupTable()[index]);
+  }
+
   uint32_t AddressForHashing(Address addr) {
     DCHECK(IsInCodeRange(addr));
     Address start = reinterpret_cast<Address>(code_);
@@ -176,11 +184,13 @@ class EmbeddedData final {
   // [2] hash of embedded-blob-relevant heap objects
   // [3] layout description of instruction stream 0
   // ... layout descriptions
+  // [y] id of the builtin at the start of the code section
+  // ... builtin ids in code section order
   // [x] metadata section of builtin 0
   // ... metadata sections
   //
   // code:
-  // [0] instruction section of builtin 0
+  // [0] instruction section of the first builtin in code section order
   // ... instruction sections
 
   static constexpr uint32_t kTableSize = Builtins::kBuiltinCount;
@@ -200,9 +210,15 @@ class EmbeddedData final {
   static constexpr uint32_t LayoutDescriptionTableSize() {
     return sizeof(struct LayoutDescription) * kTableSize;
   }
-  static constexpr uint32_t FixedDataSize() {
+  static constexpr uint32_t BuiltinLookupTableOffset() {
     return LayoutDescriptionTableOffset() + LayoutDescriptionTableSize();
   }
+  static constexpr uint32_t BuiltinLookupTableSize() {
+    return kInt32Size * kTableSize;
+  }
+  static constexpr uint32_t FixedDataSize() {
+    return BuiltinLookupTableOffset() + BuiltinLookupTableSize();
+  }
   // The variable-size data section starts here.
   static constexpr uint32_t RawMetadataOffset() { return FixedDataSize(); }
 
@@ -225,6 +241,9 @@ class EmbeddedData final {
     return reinterpret_cast<const struct LayoutDescription*>(
         data_ + LayoutDescriptionTableOffset());
   }
+  const int32_t* BuiltinLookupTable() const {
+    return reinterpret_cast<const int32_t*>(data_ + BuiltinLookupTableOffset());
+  }
   const uint8_t* RawMetadata() const { return data_ + RawMetadataOffset(); }
 
   static constexpr int PadAndAlignCode(int size) {
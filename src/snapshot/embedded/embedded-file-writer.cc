@@ -159,9 +159,8 @@ void EmbeddedFileWriter::WriteCodeSection(PlatformEmbeddedFileWriterBase* w,
   w->DeclareLabel(EmbeddedBlobCodeDataSymbol().c_str());
 
   STATIC_ASSERT(Builtins::kAllBuiltinsAreIsolateIndependent);
-  for (Builtin builtin = Builtins::kFirst; builtin <= Builtins::kLast;
-       ++builtin) {
-    WriteBuiltin(w, blob, builtin);
+  for (int i = 0; i < Builtins::kBuiltinCount; i++) {
+    WriteBuiltin(w, blob, blob->BuiltinInLayoutOrder(i));
   }
   w->Newline();
 }
@@ -0,0 +1,239 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/snapshot/preparse-data-cache.h"
+
+#include <unordered_map>
+
+#include "src/execution/isolate.h"
+#include "src/heap/factory.h"
+#include "src/objects/objects-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+#include "src/snapshot/snapshot-utils.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+/*
+
+  Format of the cache (all values are host-endian uint32s):
+
+  ------------------------------------
+  | magic number                     |
+  | format version                   |
+  | debug build                      | << debug builds add checks to the data
+  | source checksum                  |
+  | number of functions              |
+  ------------------------------------
+  | start position                   | << for each function
+  | end position                     |
+  | preparse data tree               |
+  ------------------------------------
+
+  A preparse data tree is the data length, the children length, the data
+  bytes, and then the trees of the children.
+
+ */
+
+// Nesting of PreparseData follows the nesting of functions in the source, which
+// is limited by the parser's stack checks. Anything deeper is malformed.
+constexpr int kMaxDepth = 1024;
+
+#ifdef DEBUG
+constexpr uint32_t kDebugBuild = 1;
+#else
+constexpr uint32_t kDebugBuild = 0;
+#endif
+
+uint32_t SourceChecksum(Isolate* isolate, Handle<String> source) {
+  source = String::Flatten(isolate, source);
+  DisallowGarbageCollection no_gc;
+  String::FlatContent content = source->GetFlatContent(no_gc);
+  if (content.IsOneByte()) {
+    return Checksum(base::Vector<const byte>::cast(content.ToOneByteVector()));
+  }
+  return Checksum(base::Vector<const byte>::cast(content.ToUC16Vector()));
+}
+
+class Writer {
+ public:
+  explicit Writer(std::vector<byte>* data) : data_(data) {}
+
+  void WriteUint32(uint32_t value) {
+    const byte* bytes = reinterpret_cast<const byte*>(&value);
+    data_->insert(data_->end(), bytes, bytes + sizeof(value));
+  }
+
+  void WritePreparseData(PreparseData data) {
+    WriteUint32(data.data_length());
+    WriteUint32(data.children_length());
+    for (int i = 0; i < data.data_length(); i++) data_->push_back(data.get(i));
+    for (int i = 0; i < data.children_length(); i++) {
+      WritePreparseData(data.get_child(i));
+    }
+  }
+
+ private:
+  std::vector<byte>* data_;
+};
+
+class Reader {
+ public:
+  explicit Reader(base::Vector<const byte> data) : data_(data) {}
+
+  bool ReadUint32(uint32_t* value) {
+    if (data_.length() - position_ < sizeof(*value)) return false;
+    memcpy(value, data_.begin() + position_, sizeof(*value));
+    position_ += sizeof(*value);
+    return true;
+  }
+
+  bool ReadInt(int* value) {
+    uint32_t raw;
+    if (!ReadUint32(&raw) || raw > static_cast<uint32_t>(kMaxInt)) return false;
+    *value = static_cast<int>(raw);
+    return true;
+  }
+
+  // Reads a preparse data tree, and allocates it on the heap if {result} is
+  // not null. Returns false if the data is malformed.
+  bool ReadPreparseData(Isolate* isolate, Handle<PreparseData>* result,
+                        int depth = 0) {
+    if (depth > kMaxDepth) return false;
+    int data_length;
+    int children_length;
+    if (!ReadInt(&data_length) || !ReadInt(&children_length)) return false;
+    if (data_.length() - position_ < static_cast<size_t>(data_length)) {
+      return false;
+    }
+    // Every child takes at least its two lengths.
+    if ((data_.length() - position_ - data_length) / (2 * sizeof(uint32_t)) <
+        static_cast<size_t>(children_length)) {
+      return false;
+    }
+    if (result != nullptr) {
+      *result =
+          isolate->factory()->NewPreparseData(data_length, children_length);
+      (*result)->copy_in(0, data_.begin() + position_, data_length);
+    }
+    position_ += data_length;
+    for (int i = 0; i < children_length; i++) {
+      if (result == nullptr) {
+        if (!ReadPreparseData(isolate, nullptr, depth + 1)) return false;
+        continue;
+      }
+      Handle<PreparseData> child;
+      if (!ReadPreparseData(isolate, &child, depth + 1)) return false;
+      (*result)->set_child(i, *child);
+    }
+    return true;
+  }
+
+  bool AtEnd() const { return position_ == data_.length(); }
+
+ private:
+  base::Vector<const byte> data_;
+  size_t position_ = 0;
+};
+
+}  // namespace
+
+// static
+std::vector<byte> PreparseDataCache::Serialize(Isolate* isolate,
+                                               Handle<Script> script) {
+  std::vector<byte> result;
+  Writer writer(&result);
+  writer.WriteUint32(kMagicNumber);
+  writer.WriteUint32(kFormatVersion);
+  writer.WriteUint32(kDebugBuild);
+  writer.WriteUint32(
+      SourceChecksum(isolate, handle(String::cast(script->source()), isolate)));
+
+  DisallowGarbageCollection no_gc;
+  std::vector<SharedFunctionInfo> functions;
+  SharedFunctionInfo::ScriptIterator iter(isolate, *script);
+  for (SharedFunctionInfo shared = iter.Next(); !shared.is_null();
+       shared = iter.Next()) {
+    if (shared.HasUncompiledDataWithPreparseData()) functions.push_back(shared);
+  }
+  writer.WriteUint32(static_cast<uint32_t>(functions.size()));
+  for (SharedFunctionInfo shared : functions) {
+    writer.WriteUint32(shared.StartPosition());
+    writer.WriteUint32(shared.EndPosition());
+    writer.WritePreparseData(shared.uncompiled_data_with_preparse_data()
+                                 .preparse_data());
+  }
+  return result;
+}
+
+// static
+int PreparseDataCache::Deserialize(Isolate* isolate, Handle<Script> script,
+                                   base::Vector<const byte> data) {
+  Reader reader(data);
+  uint32_t magic_number, format_version, debug_build, checksum;
+  int count;
+  if (!reader.ReadUint32(&magic_number) || magic_number != kMagicNumber ||
+      !reader.ReadUint32(&format_version) || format_version != kFormatVersion ||
+      !reader.ReadUint32(&debug_build) || debug_build != kDebugBuild ||
+      !reader.ReadUint32(&checksum) ||
+      checksum != SourceChecksum(isolate, handle(String::cast(script->source()),
+                                                 isolate)) ||
+      !reader.ReadInt(&count)) {
+    return -1;
+  }
+
+  // Validate all the entries before touching any function, so that a rejected
+  // cache has no effect.
+  {
+    Reader validator = reader;
+    int position;
+    for (int i = 0; i < count; i++) {
+      if (!validator.ReadInt(&position) || !validator.ReadInt(&position) ||
+          !validator.ReadPreparseData(isolate, nullptr)) {
+        return -1;
+      }
+    }
+    if (!validator.AtEnd()) return -1;
+  }
+
+  // Only functions without any preparse data are updated; the data of the
+  // others is at least as recent as the cached one.
+  std::unordered_map<int, Handle<SharedFunctionInfo>> candidates;
+  {
+    SharedFunctionInfo::ScriptIterator iter(isolate, *script);
+    for (SharedFunctionInfo shared = iter.Next(); !shared.is_null();
+         shared = iter.Next()) {
+      if (!shared.HasUncompiledDataWithoutPreparseData()) continue;
+      candidates.emplace(shared.StartPosition(), handle(shared, isolate));
+    }
+  }
+
+  int restored = 0;
+  for (int i = 0; i < count; i++) {
+    int start_position, end_position;
+    CHECK(reader.ReadInt(&start_position));
+    CHECK(reader.ReadInt(&end_position));
+    auto it = candidates.find(start_position);
+    if (it == candidates.end() || it->second->EndPosition() != end_position) {
+      CHECK(reader.ReadPreparseData(isolate, nullptr));
+      continue;
+    }
+    Handle<PreparseData> preparse_data;
+    CHECK(reader.ReadPreparseData(isolate, &preparse_data));
+    Handle<SharedFunctionInfo> shared = it->second;
+    Handle<UncompiledData> uncompiled_data =
+        isolate->factory()->NewUncompiledDataWithPreparseData(
+            handle(shared->inferred_name(), isolate), start_position,
+            end_position, preparse_data);
+    shared->set_uncompiled_data(*uncompiled_data);
+    restored++;
+  }
+  DCHECK(reader.AtEnd());
+  return restored;
+}
+
+}  // namespace internal
+}  // namespace v8
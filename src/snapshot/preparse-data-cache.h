@@ -0,0 +1,48 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_SNAPSHOT_PREPARSE_DATA_CACHE_H_
+#define V8_SNAPSHOT_PREPARSE_DATA_CACHE_H_
+
+#include <vector>
+
+#include "src/base/vector.h"
+#include "src/common/globals.h"
+#include "src/handles/handles.h"
+
+namespace v8 {
+namespace internal {
+
+class Script;
+
+// A standalone cache of the preparse data ("scope skeletons") of a script's
+// lazy functions. Unlike the code cache it contains no heap object graph, only
+// the PreparseData byte streams keyed by function position, so it does not
+// depend on the V8 version or flag values beyond its own format version. The
+// data is checked against a checksum of the script source.
+//
+// Restoring the cache attaches the preparse data to lazy functions that do not
+// have any (e.g. after their bytecode was flushed), so that their next compile
+// skips preparsing their inner functions.
+class V8_EXPORT_PRIVATE PreparseDataCache : public AllStatic {
+ public:
+  // Serializes the preparse data of all uncompiled functions of {script}.
+  static std::vector<byte> Serialize(Isolate* isolate, Handle<Script> script);
+
+  // Attaches the preparse data in {data} to the matching uncompiled functions
+  // of {script}. Returns the number of functions that received preparse data,
+  // or -1 if {data} was rejected.
+  static int Deserialize(Isolate* isolate, Handle<Script> script,
+                         base::Vector<const byte> data);
+
+ private:
+  static const uint32_t kMagicNumber = 0xC0DE5C0F;
+  // Bump this whenever the PreparseData format changes.
+  static const uint32_t kFormatVersion = 1;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_SNAPSHOT_PREPARSE_DATA_CACHE_H_
@@ -20,6 +20,15 @@ uint32_t GetUncompressedSize(const Bytef* compressed_data) {
 
 SnapshotData SnapshotCompression::Compress(
     const SnapshotData* uncompressed_data) {
+  return Compress(uncompressed_data, FLAG_snapshot_compression_level);
+}
+
+SnapshotData SnapshotCompression::Compress(
+    const SnapshotData* uncompressed_data, int level) {
+  // The level only affects compression; raw deflate streams of any level are
+  // decompressed the same way.
+  CHECK(level == Z_DEFAULT_COMPRESSION ||
+        (level >= Z_NO_COMPRESSION && level <= Z_BEST_COMPRESSION));
   SnapshotData snapshot_data;
   base::ElapsedTimer timer;
   if (FLAG_profile_deserialization) timer.Start();
@@ -45,7 +54,7 @@ SnapshotData SnapshotCompression::Compress(
                zlib_internal::ZRAW, compressed_data + sizeof(payload_length),
                &compressed_data_size,
                bit_cast<const Bytef*>(uncompressed_data->RawData().begin()),
-               input_size, Z_DEFAULT_COMPRESSION, nullptr, nullptr),
+               input_size, level, nullptr, nullptr),
            Z_OK);
 
   // Reallocating to exactly the size we need.
@@ -56,7 +65,8 @@ SnapshotData SnapshotCompression::Compress(
 
   if (FLAG_profile_deserialization) {
     double ms = timer.Elapsed().InMillisecondsF();
-    PrintF("[Compressing %d bytes took %0.3f ms]\n", payload_length, ms);
+    PrintF("[Compressing %d bytes at level %d took %0.3f ms]\n",
+           payload_length, level, ms);
   }
   return snapshot_data;
 }
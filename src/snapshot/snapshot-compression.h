@@ -13,8 +13,11 @@ namespace internal {
 
 class SnapshotCompression : public AllStatic {
  public:
+  // Compresses with the level given by --snapshot-compression-level.
   V8_EXPORT_PRIVATE static SnapshotData Compress(
       const SnapshotData* uncompressed_data);
+  V8_EXPORT_PRIVATE static SnapshotData Compress(
+      const SnapshotData* uncompressed_data, int level);
   V8_EXPORT_PRIVATE static SnapshotData Decompress(
       base::Vector<const byte> compressed_data);
 };
@@ -6,11 +6,20 @@
 
 #include "src/snapshot/snapshot.h"
 
+#include <unordered_map>
+#include <unordered_set>
+
+#include "include/v8-platform.h"
+#include "src/base/lazy-instance.h"
+#include "src/base/optional.h"
+#include "src/base/platform/mutex.h"
 #include "src/base/platform/platform.h"
+#include "src/base/platform/semaphore.h"
 #include "src/common/assert-scope.h"
 #include "src/execution/isolate-inl.h"
 #include "src/heap/safepoint.h"
 #include "src/init/bootstrapper.h"
+#include "src/init/v8.h"
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/objects/code-kind.h"
 #include "src/objects/js-regexp-inl.h"
@@ -117,16 +126,88 @@ class SnapshotImpl : public AllStatic {
   }
 };
 
+// Work done once per snapshot blob with --cache-snapshot-blobs, so that
+// creating many isolates and contexts from the same blob does not repeatedly
+// checksum and decompress it. Entries are keyed by address and never evicted;
+// blobs have to outlive the isolates created from them anyway.
+class SnapshotBlobCache {
+ public:
+  bool VerifyChecksum(const v8::StartupData* blob) {
+    {
+      base::MutexGuard guard(&mutex_);
+      if (verified_blobs_.count(blob->data)) return true;
+    }
+    if (!Snapshot::VerifyChecksum(blob)) return false;
+    base::MutexGuard guard(&mutex_);
+    verified_blobs_.insert(blob->data);
+    return true;
+  }
+
+#ifdef V8_SNAPSHOT_COMPRESSION
+  // Returns the decompressed data of the section at {compressed}.
+  base::Vector<const byte> Decompress(base::Vector<const byte> compressed) {
+    base::MutexGuard guard(&mutex_);
+    auto it = sections_.find(compressed.begin());
+    if (it == sections_.end()) {
+      it = sections_
+               .emplace(compressed.begin(),
+                        std::make_unique<SnapshotData>(
+                            SnapshotCompression::Decompress(compressed)))
+               .first;
+    }
+    return it->second->RawData();
+  }
+#endif  // V8_SNAPSHOT_COMPRESSION
+
+ private:
+  base::Mutex mutex_;
+  std::unordered_set<const char*> verified_blobs_;
+#ifdef V8_SNAPSHOT_COMPRESSION
+  std::unordered_map<const byte*, std::unique_ptr<SnapshotData>> sections_;
+#endif  // V8_SNAPSHOT_COMPRESSION
+};
+
+base::LazyInstance<SnapshotBlobCache>::type snapshot_blob_cache =
+    LAZY_INSTANCE_INITIALIZER;
+
 }  // namespace
 
 SnapshotData MaybeDecompress(const base::Vector<const byte>& snapshot_data) {
 #ifdef V8_SNAPSHOT_COMPRESSION
+  if (FLAG_cache_snapshot_blobs) {
+    return SnapshotData(
+        snapshot_blob_cache.Pointer()->Decompress(snapshot_data));
+  }
   return SnapshotCompression::Decompress(snapshot_data);
 #else
   return SnapshotData(snapshot_data);
 #endif
 }
 
+namespace {
+
+// Decompresses a snapshot section on a worker thread. The caller waits for
+// {done} before it uses {result}.
+class DecompressSectionTask : public v8::Task {
+ public:
+  DecompressSectionTask(base::Vector<const byte> data,
+                        base::Optional<SnapshotData>* result,
+                        base::Semaphore* done)
+      : data_(data), result_(result), done_(done) {}
+
+  void Run() override {
+    result_->emplace(MaybeDecompress(data_));
+    done_->Signal();
+  }
+
+ private:
+  base::Vector<const byte> data_;
+  base::Optional<SnapshotData>* result_;
+  base::Semaphore* done_;
+};
+
+}  // namespace
+
 #ifdef DEBUG
 bool Snapshot::SnapshotIsValid(const v8::StartupData* snapshot_blob) {
   return SnapshotImpl::ExtractNumContexts(snapshot_blob) > 0;
@@ -164,7 +245,9 @@ bool Snapshot::Initialize(Isolate* isolate) {
   const v8::StartupData* blob = isolate->snapshot_blob();
   SnapshotImpl::CheckVersion(blob);
   if (!FLAG_skip_snapshot_checksum) {
-    CHECK(VerifyChecksum(blob));
+    CHECK(FLAG_cache_snapshot_blobs
+              ? snapshot_blob_cache.Pointer()->VerifyChecksum(blob)
+              : VerifyChecksum(blob));
   }
   base::Vector<const byte> startup_data =
       SnapshotImpl::ExtractStartupData(blob);
@@ -173,12 +256,29 @@ bool Snapshot::Initialize(Isolate* isolate) {
   base::Vector<const byte> shared_heap_data =
       SnapshotImpl::ExtractSharedHeapData(blob);
 
-  SnapshotData startup_snapshot_data(MaybeDecompress(startup_data));
+#ifdef V8_SNAPSHOT_COMPRESSION
+  const bool decompress_in_parallel = FLAG_parallel_snapshot_decompression;
+#else
+  const bool decompress_in_parallel = false;
+#endif
+
+  // The sections are compressed independently, so the startup section, which
+  // is usually the largest one, can be decompressed alongside the others.
+  base::Optional<SnapshotData> startup_snapshot_data;
+  base::Semaphore startup_decompressed(0);
+  if (decompress_in_parallel) {
+    V8::GetCurrentPlatform()->CallOnWorkerThread(
+        std::make_unique<DecompressSectionTask>(
+            startup_data, &startup_snapshot_data, &startup_decompressed));
+  } else {
+    startup_snapshot_data.emplace(MaybeDecompress(startup_data));
+  }
   SnapshotData read_only_snapshot_data(MaybeDecompress(read_only_data));
   SnapshotData shared_heap_snapshot_data(MaybeDecompress(shared_heap_data));
+  if (decompress_in_parallel) startup_decompressed.Wait();
 
   bool success = isolate->InitWithSnapshot(
-      &startup_snapshot_data, &read_only_snapshot_data,
+      &startup_snapshot_data.value(), &read_only_snapshot_data,
       &shared_heap_snapshot_data, ExtractRehashability(blob));
   if (FLAG_profile_deserialization) {
     double ms = timer.Elapsed().InMillisecondsF();
@@ -218,12 +318,68 @@ MaybeHandle<Context> Snapshot::NewContextFromSnapshot(
   return result;
 }
 
+namespace {
+
+bool IsExtensionFunction(SharedFunctionInfo shared,
+                         PtrComprCageBase cage_base) {
+  return shared.script(cage_base).IsScript(cage_base) &&
+         Script::cast(shared.script(cage_base)).type() ==
+             Script::TYPE_EXTENSION;
+}
+
+// Discards the compiled code of functions that none of their closures has run
+// often enough to allocate a feedback vector. Most of the code in a snapshot of
+// warmed-up state is never called again, and not serializing its bytecode and
+// scope infos makes the snapshot smaller and faster to deserialize; the few
+// functions that do get called are lazily compiled from source.
+void ClearColdCodeForSerialization(Isolate* isolate) {
+  PtrComprCageBase cage_base(isolate);
+  HandleScope scope(isolate);
+  std::unordered_set<Address> warm_sfis;
+  std::vector<Handle<SharedFunctionInfo>> sfis_to_clear;
+  {
+    DisallowGarbageCollection disallow_gc;
+    HeapObjectIterator it(isolate->heap());
+    for (HeapObject o = it.Next(); !o.is_null(); o = it.Next()) {
+      if (!o.IsJSFunction(cage_base)) continue;
+      JSFunction fun = JSFunction::cast(o);
+      if (fun.has_feedback_vector()) warm_sfis.insert(fun.shared().ptr());
+    }
+    HeapObjectIterator sfi_it(isolate->heap());
+    for (HeapObject o = sfi_it.Next(); !o.is_null(); o = sfi_it.Next()) {
+      if (!o.IsSharedFunctionInfo(cage_base)) continue;
+      SharedFunctionInfo shared = SharedFunctionInfo::cast(o);
+      if (IsExtensionFunction(shared, cage_base)) continue;
+      if (!shared.CanDiscardCompiled()) continue;
+      if (warm_sfis.count(shared.ptr()) != 0) continue;
+      sfis_to_clear.emplace_back(shared, isolate);
+    }
+  }
+
+  // Must happen after heap iteration since SFI::DiscardCompiled may allocate.
+  for (Handle<SharedFunctionInfo> shared : sfis_to_clear) {
+    if (shared->CanDiscardCompiled()) {
+      SharedFunctionInfo::DiscardCompiled(isolate, shared);
+    }
+  }
+  if (FLAG_profile_deserialization) {
+    PrintF("[Discarded code of %zu cold functions for serialization]\n",
+           sfis_to_clear.size());
+  }
+}
+
+}  // namespace
+
 // static
 void Snapshot::ClearReconstructableDataForSerialization(
     Isolate* isolate, bool clear_recompilable_data) {
   // Clear SFIs and JSRegExps.
   PtrComprCageBase cage_base(isolate);
 
+  if (!clear_recompilable_data && FLAG_snapshot_keep_only_warm_code) {
+    ClearColdCodeForSerialization(isolate);
+  }
+
   if (clear_recompilable_data) {
     HandleScope scope(isolate);
     std::vector<i::Handle<i::SharedFunctionInfo>> sfis_to_clear;
@@ -234,9 +390,7 @@ void Snapshot::ClearReconstructableDataForSerialization(
       for (i::HeapObject o = it.Next(); !o.is_null(); o = it.Next()) {
         if (o.IsSharedFunctionInfo(cage_base)) {
           i::SharedFunctionInfo shared = i::SharedFunctionInfo::cast(o);
-          if (shared.script(cage_base).IsScript(cage_base) &&
-              Script::cast(shared.script(cage_base)).type() ==
-                  Script::TYPE_EXTENSION) {
+          if (IsExtensionFunction(shared, cage_base)) {
             continue;  // Don't clear extensions, they cannot be recompiled.
           }
           if (shared.CanDiscardCompiled()) {
@@ -269,9 +423,7 @@ void Snapshot::ClearReconstructableDataForSerialization(
     fun.CompleteInobjectSlackTrackingIfActive();
 
     i::SharedFunctionInfo shared = fun.shared();
-    if (shared.script(cage_base).IsScript(cage_base) &&
-        Script::cast(shared.script(cage_base)).type() ==
-            Script::TYPE_EXTENSION) {
+    if (IsExtensionFunction(shared, cage_base)) {
       continue;  // Don't clear extensions, they cannot be recompiled.
     }
 
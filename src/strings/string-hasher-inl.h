@@ -10,6 +10,7 @@
 // Comment inserted to prevent header reordering.
 #include <type_traits>
 
+#include "src/base/bits.h"
 #include "src/objects/name-inl.h"
 #include "src/objects/objects.h"
 #include "src/objects/string.h"
@@ -46,6 +47,62 @@ uint32_t StringHasher::GetTrivialHash(int length) {
   return (hash << String::kHashShift) | String::kIsNotIntegerIndexMask;
 }
 
+namespace detail {
+
+// The constants and the round function of XXH64, which takes a 64-bit input
+// per step and keeps several accumulators independent of each other.
+constexpr uint64_t kBlockHashPrime1 = 0x9E3779B185EBCA87;
+constexpr uint64_t kBlockHashPrime2 = 0xC2B2AE3D27D4EB4F;
+constexpr uint64_t kBlockHashPrime3 = 0x165667B19E3779F9;
+
+V8_INLINE uint64_t BlockHashRound(uint64_t acc, uint64_t input) {
+  acc += input * kBlockHashPrime2;
+  acc = base::bits::RotateLeft64(acc, 31);
+  return acc * kBlockHashPrime1;
+}
+
+// Packs four characters into the 16-bit lanes of a word.
+template <typename uchar>
+V8_INLINE uint64_t PackCharacters(const uchar* chars) {
+  return uint64_t{chars[0]} | (uint64_t{chars[1]} << 16) |
+         (uint64_t{chars[2]} << 32) | (uint64_t{chars[3]} << 48);
+}
+
+}  // namespace detail
+
+template <typename uchar>
+uint32_t StringHasher::HashLongString(const uchar* chars, int length,
+                                      uint64_t seed) {
+  DCHECK_GE(length, kMinBlockHashLength);
+  uint64_t acc0 = seed + detail::kBlockHashPrime1 + detail::kBlockHashPrime2;
+  uint64_t acc1 = seed + detail::kBlockHashPrime2;
+  const uchar* end = chars + length;
+  for (; end - chars >= 8; chars += 8) {
+    acc0 = detail::BlockHashRound(acc0, detail::PackCharacters(chars));
+    acc1 = detail::BlockHashRound(acc1, detail::PackCharacters(chars + 4));
+  }
+  if (end - chars >= 4) {
+    acc0 = detail::BlockHashRound(acc0, detail::PackCharacters(chars));
+    chars += 4;
+  }
+  uint64_t tail = 0;
+  for (int shift = 0; chars != end; shift += 16) {
+    tail |= uint64_t{*chars++} << shift;
+  }
+  acc1 = detail::BlockHashRound(acc1, tail);
+
+  uint64_t hash = base::bits::RotateLeft64(acc0, 1) ^
+                  base::bits::RotateLeft64(acc1, 7) ^
+                  static_cast<uint64_t>(length);
+  hash ^= hash >> 33;
+  hash *= detail::kBlockHashPrime2;
+  hash ^= hash >> 29;
+  hash *= detail::kBlockHashPrime3;
+  hash ^= hash >> 32;
+  return (GetHashCore(static_cast<uint32_t>(hash)) << String::kHashShift) |
+         String::kIsNotIntegerIndexMask;
+}
+
 template <typename char_t>
 uint32_t StringHasher::HashSequentialString(const char_t* chars_raw, int length,
                                             uint64_t seed) {
@@ -109,6 +166,9 @@ uint32_t StringHasher::HashSequentialString(const char_t* chars_raw, int length,
     if (length > String::kMaxHashCalcLength) {
       return GetTrivialHash(length);
     }
+    if (length >= kMinBlockHashLength) {
+      return HashLongString(chars, length, seed);
+    }
   }
 
   // Non-index hash.
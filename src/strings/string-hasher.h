@@ -40,6 +40,18 @@ class V8_EXPORT_PRIVATE StringHasher final {
   V8_INLINE static uint32_t GetHashCore(uint32_t running_hash);
 
   static inline uint32_t GetTrivialHash(int length);
+
+  // Strings that are not integer indices and have at least this many
+  // characters are hashed four characters at a time, in two independent
+  // lanes, rather than with AddCharacterCore.
+  static const int kMinBlockHashLength = 64;
+
+ private:
+  // The block hash only depends on the character values, so that one-byte
+  // and two-byte strings with the same contents get the same hash.
+  template <typename uchar>
+  static inline uint32_t HashLongString(const uchar* chars, int length,
+                                        uint64_t seed);
 };
 
 // Useful for std containers that require something ()'able.
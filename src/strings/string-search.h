@@ -5,6 +5,9 @@
 #ifndef V8_STRINGS_STRING_SEARCH_H_
 #define V8_STRINGS_STRING_SEARCH_H_
 
+#include "src/base/bits.h"
+#include "src/base/build_config.h"
+#include "src/base/memory.h"
 #include "src/base/strings.h"
 #include "src/base/vector.h"
 #include "src/execution/isolate.h"
@@ -263,6 +266,57 @@ inline bool CharCompare(const PatternChar* pattern, const SubjectChar* subject,
   return true;
 }
 
+#if defined(V8_TARGET_LITTLE_ENDIAN)
+// Finds the first occurrence of {pattern} at or after {index}, filtering the
+// candidate positions a word at a time by comparing both the first and the
+// last character of the pattern. Unlike searching for the first character
+// only, this stays fast when the first character is common in the subject,
+// e.g. a space.
+template <typename PatternChar, typename SubjectChar>
+inline int FindFirstAndLastCharacter(base::Vector<const PatternChar> pattern,
+                                     base::Vector<const SubjectChar> subject,
+                                     int index) {
+  constexpr int kLanes = sizeof(uint64_t) / sizeof(SubjectChar);
+  constexpr int kLaneBits = kBitsPerByte * sizeof(SubjectChar);
+  constexpr uint64_t kLowBits =
+      sizeof(SubjectChar) == 1 ? uint64_t{0x0101010101010101}
+                               : uint64_t{0x0001000100010001};
+  constexpr uint64_t kHighBits = kLowBits << (kLaneBits - 1);
+  // The pattern only contains characters that fit {SubjectChar}, otherwise
+  // the search would have failed right away.
+  const int last = pattern.length() - 1;
+  const uint64_t first_chars = kLowBits * static_cast<SubjectChar>(pattern[0]);
+  const uint64_t last_chars =
+      kLowBits * static_cast<SubjectChar>(pattern[last]);
+  const int n = subject.length() - pattern.length();
+  int i = index;
+  for (; i <= n - kLanes + 1; i += kLanes) {
+    const Address chars = reinterpret_cast<Address>(subject.begin() + i);
+    const Address last_chars_start = chars + last * sizeof(SubjectChar);
+    uint64_t mismatches =
+        (base::ReadUnalignedValue<uint64_t>(chars) ^ first_chars) |
+        (base::ReadUnalignedValue<uint64_t>(last_chars_start) ^ last_chars);
+    // Sets the high bit of every lane where both characters match (and
+    // possibly of the lanes above it, which the comparison below rejects).
+    uint64_t candidates = (mismatches - kLowBits) & ~mismatches & kHighBits;
+    while (candidates != 0) {
+      int j = base::bits::CountTrailingZeros(candidates) / kLaneBits;
+      if (CharCompare(pattern.begin(), subject.begin() + i + j,
+                      pattern.length())) {
+        return i + j;
+      }
+      candidates &= candidates - 1;
+    }
+  }
+  for (; i <= n; i++) {
+    if (CharCompare(pattern.begin(), subject.begin() + i, pattern.length())) {
+      return i;
+    }
+  }
+  return -1;
+}
+#endif  // V8_TARGET_LITTLE_ENDIAN
+
 // Simple linear search for short patterns. Never bails out.
 template <typename PatternChar, typename SubjectChar>
 int StringSearch<PatternChar, SubjectChar>::LinearSearch(
@@ -270,6 +324,9 @@ int StringSearch<PatternChar, SubjectChar>::LinearSearch(
     base::Vector<const SubjectChar> subject, int index) {
   base::Vector<const PatternChar> pattern = search->pattern_;
   DCHECK_GT(pattern.length(), 1);
+#if defined(V8_TARGET_LITTLE_ENDIAN)
+  return FindFirstAndLastCharacter(pattern, subject, index);
+#else
   int pattern_length = pattern.length();
   int i = index;
   int n = subject.length() - pattern_length;
@@ -286,6 +343,7 @@ int StringSearch<PatternChar, SubjectChar>::LinearSearch(
     }
   }
   return -1;
+#endif  // V8_TARGET_LITTLE_ENDIAN
 }
 
 //---------------------------------------------------------------------
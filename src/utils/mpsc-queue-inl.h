@@ -0,0 +1,83 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_UTILS_MPSC_QUEUE_INL_H_
+#define V8_UTILS_MPSC_QUEUE_INL_H_
+
+#include "src/utils/allocation.h"
+#include "src/utils/mpsc-queue.h"
+
+namespace v8 {
+namespace internal {
+
+template <typename Record>
+struct MpscQueue<Record>::Node : Malloced {
+  Node() : next(nullptr) {}
+  Record value;
+  std::atomic<Node*> next;
+};
+
+template <typename Record>
+inline MpscQueue<Record>::MpscQueue() : size_(0) {
+  tail_ = new Node();
+  CHECK_NOT_NULL(tail_);
+  head_.store(tail_, std::memory_order_relaxed);
+}
+
+template <typename Record>
+inline MpscQueue<Record>::~MpscQueue() {
+  // Destroy all remaining nodes. Note that we do not destroy the actual values.
+  Node* cur_node = tail_;
+  while (cur_node != nullptr) {
+    Node* old_node = cur_node;
+    cur_node = cur_node->next.load(std::memory_order_relaxed);
+    delete old_node;
+  }
+}
+
+template <typename Record>
+inline void MpscQueue<Record>::Enqueue(Record record) {
+  Node* n = new Node();
+  CHECK_NOT_NULL(n);
+  n->value = std::move(record);
+  size_.fetch_add(1, std::memory_order_relaxed);
+  Node* prev = head_.exchange(n, std::memory_order_acq_rel);
+  prev->next.store(n, std::memory_order_release);
+}
+
+template <typename Record>
+inline bool MpscQueue<Record>::Dequeue(Record* record) {
+  Node* const next_node = tail_->next.load(std::memory_order_acquire);
+  if (next_node == nullptr) return false;
+  *record = std::move(next_node->value);
+  delete tail_;
+  tail_ = next_node;
+  size_t old_size = size_.fetch_sub(1, std::memory_order_relaxed);
+  USE(old_size);
+  DCHECK_GT(old_size, 0);
+  return true;
+}
+
+template <typename Record>
+inline bool MpscQueue<Record>::IsEmpty() const {
+  return tail_->next.load(std::memory_order_acquire) == nullptr;
+}
+
+template <typename Record>
+inline bool MpscQueue<Record>::Peek(Record* record) const {
+  Node* const next_node = tail_->next.load(std::memory_order_acquire);
+  if (next_node == nullptr) return false;
+  *record = next_node->value;
+  return true;
+}
+
+template <typename Record>
+inline size_t MpscQueue<Record>::size() const {
+  return size_.load(std::memory_order_relaxed);
+}
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_UTILS_MPSC_QUEUE_INL_H_
@@ -0,0 +1,50 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_UTILS_MPSC_QUEUE_H_
+#define V8_UTILS_MPSC_QUEUE_H_
+
+#include <atomic>
+
+#include "src/base/macros.h"
+
+namespace v8 {
+namespace internal {
+
+// Lock-free unbounded size queue (multi producer; single consumer) based on
+// Dmitry Vyukov's intrusive MPSC node-based queue. Producers only swap the
+// head pointer and never wait for each other or for the consumer. Dequeue(),
+// Peek() and IsEmpty() must only be called from the single consumer thread.
+// A record becomes visible to the consumer once its producer has linked it,
+// so a producer preempted while enqueueing briefly hides the records enqueued
+// after it.
+// See:
+// https://www.1024cores.net/home/lock-free-algorithms/queues/intrusive-mpsc-node-based-queue
+template <typename Record>
+class MpscQueue final {
+ public:
+  inline MpscQueue();
+  MpscQueue(const MpscQueue&) = delete;
+  MpscQueue& operator=(const MpscQueue&) = delete;
+  inline ~MpscQueue();
+  inline void Enqueue(Record record);
+  inline bool Dequeue(Record* record);
+  inline bool IsEmpty() const;
+  inline bool Peek(Record* record) const;
+  inline size_t size() const;
+
+ private:
+  struct Node;
+
+  // The most recently enqueued node, shared by the producers.
+  std::atomic<Node*> head_;
+  // The consumer's dummy node, whose successor holds the oldest record.
+  Node* tail_;
+  std::atomic<size_t> size_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_UTILS_MPSC_QUEUE_H_
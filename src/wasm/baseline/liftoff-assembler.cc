@@ -12,6 +12,7 @@
 #include "src/codegen/macro-assembler-inl.h"
 #include "src/compiler/linkage.h"
 #include "src/compiler/wasm-compiler.h"
+#include "src/utils/bit-vector.h"
 #include "src/utils/ostreams.h"
 #include "src/wasm/baseline/liftoff-register.h"
 #include "src/wasm/function-body-decoder-impl.h"
@@ -826,6 +827,28 @@ void LiftoffAssembler::SpillLocals() {
   }
 }
 
+void LiftoffAssembler::SpillLocalsForLoop(const BitVector* assigned_in_loop) {
+  uint32_t kept_gp = 0;
+  uint32_t kept_fp = 0;
+  for (uint32_t i = 0; i < num_locals_; ++i) {
+    VarState* slot = &cache_state_.stack_state[i];
+    if (slot->is_reg() && static_cast<int>(i) < assigned_in_loop->length() &&
+        !assigned_in_loop->Contains(i) &&
+        cache_state_.get_use_count(slot->reg()) == 1) {
+      LiftoffRegister reg = slot->reg();
+      bool is_fp = reg.is_fp() || reg.is_fp_pair();
+      uint32_t& kept = is_fp ? kept_fp : kept_gp;
+      uint32_t num_regs = reg.is_pair() ? 2 : 1;
+      LiftoffRegList cache_regs = is_fp ? kFpCacheRegList : kGpCacheRegList;
+      if (2 * (kept + num_regs) <= cache_regs.GetNumRegsSet()) {
+        kept += num_regs;
+        continue;
+      }
+    }
+    Spill(slot);
+  }
+}
+
 void LiftoffAssembler::SpillAllRegisters() {
   for (uint32_t i = 0, e = cache_state_.stack_height(); i < e; ++i) {
     auto& slot = cache_state_.stack_state[i];
@@ -24,6 +24,7 @@ namespace v8 {
 namespace internal {
 
 // Forward declarations.
+class BitVector;
 namespace compiler {
 class CallDescriptor;
 }  // namespace compiler
@@ -590,6 +591,10 @@ class LiftoffAssembler : public TurboAssembler {
 
   void Spill(VarState* slot);
   void SpillLocals();
+  // Spill all locals before entering a loop, except for locals in registers
+  // that are not in {assigned_in_loop}. Those stay in their registers as long
+  // as this keeps at most half of the cache registers of each class occupied.
+  void SpillLocalsForLoop(const BitVector* assigned_in_loop);
   void SpillAllRegisters();
 
   // Clear any uses of {reg} in both the cache and in {possible_uses}.
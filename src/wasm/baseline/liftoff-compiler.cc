@@ -334,12 +334,22 @@ class LiftoffCompiler {
     LiftoffAssembler::CacheState state;
   };
 
+  struct LandingPad {
+    // Index of the entry in {handlers_} whose label this landing pad binds.
+    size_t handler_index;
+    // The cache state at the call that can throw.
+    LiftoffAssembler::CacheState state;
+  };
+
   struct TryInfo {
     TryInfo() = default;
     LiftoffAssembler::CacheState catch_state;
     Label catch_label;
     bool catch_reached = false;
     bool in_handler = false;
+    // Landing pads of throwing calls in the try block. They get emitted when
+    // the try block ends, to keep them out of the non-throwing path.
+    std::vector<LandingPad> landing_pads;
   };
 
   struct Control : public ControlBase<Value, validate> {
@@ -515,7 +525,7 @@ class LiftoffCompiler {
   int GetFeedbackVectorSlots() const {
     // The number of instructions is capped by max function size.
     STATIC_ASSERT(kV8MaxWasmFunctionSize < std::numeric_limits<int>::max());
-    return static_cast<int>(num_call_ref_instructions_) * 2;
+    return static_cast<int>(num_call_instructions_) * 2;
   }
 
   void unsupported(FullDecoder* decoder, LiftoffBailoutReason reason,
@@ -989,6 +999,7 @@ class LiftoffCompiler {
     if (!handlers_.empty()) {
       handler_table_offset_ = HandlerTable::EmitReturnTableStart(&asm_);
       for (auto& handler : handlers_) {
+        DCHECK(handler.handler.get()->is_bound());
         HandlerTable::EmitReturnEntry(&asm_, handler.pc_offset,
                                       handler.handler.get()->pos());
       }
@@ -1124,10 +1135,21 @@ class LiftoffCompiler {
   void Loop(FullDecoder* decoder, Control* loop) {
     // Before entering a loop, spill all locals to the stack, in order to free
     // the cache registers, and to avoid unnecessarily reloading stack values
-    // into registers at branches.
-    // TODO(clemensb): Come up with a better strategy here, involving
-    // pre-analysis of the function.
-    __ SpillLocals();
+    // into registers at branches. Locals which are not assigned in the loop
+    // can stay in their registers (if there is enough headroom), since
+    // back-edges will then not need to move them.
+    BitVector* assigned = nullptr;
+    if (FLAG_liftoff_loop_invariant_locals_in_registers &&
+        for_debugging_ == kNoDebugging) {
+      assigned = WasmDecoder<validate>::AnalyzeLoopAssignment(
+          decoder, decoder->pc(), decoder->num_locals(), compilation_zone_);
+      if (decoder->failed()) return;
+    }
+    if (assigned) {
+      __ SpillLocalsForLoop(assigned);
+    } else {
+      __ SpillLocals();
+    }
 
     __ PrepareLoopArgs(loop->start_merge.arity);
 
@@ -1178,6 +1200,7 @@ class LiftoffCompiler {
                       base::Vector<Value> values) {
     DCHECK(block->is_try_catch());
     __ emit_jump(block->label.get());
+    EmitDeferredLandingPads(block);
 
     // The catch block is unreachable if no possible throws in the try block
     // exist. We only build a landing pad if some node in the try block can
@@ -1236,6 +1259,7 @@ class LiftoffCompiler {
     DCHECK_EQ(block, decoder->control_at(0));
     Control* target = decoder->control_at(depth);
     DCHECK(block->is_incomplete_try());
+    EmitDeferredLandingPads(block);
     __ bind(&block->try_info->catch_label);
     if (block->try_info->catch_reached) {
       __ cache_state()->Steal(block->try_info->catch_state);
@@ -1270,6 +1294,7 @@ class LiftoffCompiler {
   void CatchAll(FullDecoder* decoder, Control* block) {
     DCHECK(block->is_try_catchall() || block->is_try_catch());
     DCHECK_EQ(decoder->control_at(0), block);
+    EmitDeferredLandingPads(block);
 
     // The catch block is unreachable if no possible throws in the try block
     // exist. We only build a landing pad if some node in the try block can
@@ -2706,13 +2731,22 @@ class LiftoffCompiler {
     }
 
     // Early return for trap handler.
-    DCHECK_IMPLIES(env_->module->is_memory64,
-                   env_->bounds_checks == kExplicitBoundsChecks);
     if (!force_check && !statically_oob &&
         env_->bounds_checks == kTrapHandler) {
       // With trap handlers we should not have a register pair as input (we
       // would only return the lower half).
       DCHECK(index.is_gp());
+      if (env_->module->is_memory64) {
+        // The guard regions only cover 32-bit indexes; anything larger is out
+        // of bounds for any memory.
+        CODE_COMMENT("bounds check memory64 index");
+        Label* trap_label = AddOutOfLineTrap(
+            decoder, WasmCode::kThrowWasmTrapMemOutOfBounds, 0);
+        pinned.set(index);
+        LiftoffRegister high_word = __ GetUnusedRegister(kGpReg, pinned);
+        __ emit_i64_shri(high_word, index, 32);
+        __ emit_cond_jump(kNotEqualZero, trap_label, kI64, high_word.gp());
+      }
       return index_ptrsize;
     }
 
@@ -3901,6 +3935,28 @@ class LiftoffCompiler {
       case wasm::kExprI32x4TruncSatF64x2UZero:
         return EmitUnOp<kS128, kS128>(
             &LiftoffAssembler::emit_i32x4_trunc_sat_f64x2_u_zero);
+      // The relaxed operations below are implemented with their deterministic
+      // counterparts, which are valid implementations of the relaxed semantics
+      // on all platforms.
+      case wasm::kExprI8x16RelaxedSwizzle:
+        return EmitBinOp<kS128, kS128>(&LiftoffAssembler::emit_i8x16_swizzle);
+      case wasm::kExprI8x16RelaxedLaneSelect:
+      case wasm::kExprI16x8RelaxedLaneSelect:
+      case wasm::kExprI32x4RelaxedLaneSelect:
+      case wasm::kExprI64x2RelaxedLaneSelect:
+        return EmitTerOp<kS128, kS128>(&LiftoffAssembler::emit_s128_select);
+      case wasm::kExprF32x4RelaxedMin:
+        return EmitBinOp<kS128, kS128, false, kF32>(
+            &LiftoffAssembler::emit_f32x4_min);
+      case wasm::kExprF32x4RelaxedMax:
+        return EmitBinOp<kS128, kS128, false, kF32>(
+            &LiftoffAssembler::emit_f32x4_max);
+      case wasm::kExprF64x2RelaxedMin:
+        return EmitBinOp<kS128, kS128, false, kF64>(
+            &LiftoffAssembler::emit_f64x2_min);
+      case wasm::kExprF64x2RelaxedMax:
+        return EmitBinOp<kS128, kS128, false, kF64>(
+            &LiftoffAssembler::emit_f64x2_max);
       default:
         unsupported(decoder, kSimd, "simd");
     }
@@ -4258,34 +4314,41 @@ class LiftoffCompiler {
 
   void EmitLandingPad(FullDecoder* decoder, int handler_offset) {
     if (decoder->current_catch() == -1) return;
-    MovableLabel handler;
-
-    // If we return from the throwing code normally, just skip over the handler.
-    Label skip_handler;
-    __ emit_jump(&skip_handler);
-
-    // Handler: merge into the catch state, and jump to the catch body.
-    CODE_COMMENT("-- landing pad --");
-    __ bind(handler.get());
-    __ ExceptionHandler();
-    __ PushException();
-    handlers_.push_back({std::move(handler), handler_offset});
+    // Only register the handler here; the landing pad itself is emitted by
+    // {EmitDeferredLandingPads} at the end of the try block, so that returning
+    // normally from the call does not need to jump over it.
     Control* current_try =
         decoder->control_at(decoder->control_depth_of_current_catch());
     DCHECK_NOT_NULL(current_try->try_info);
-    if (!current_try->try_info->catch_reached) {
-      current_try->try_info->catch_state.InitMerge(
-          *__ cache_state(), __ num_locals(), 1,
-          current_try->stack_depth + current_try->num_exceptions);
-      current_try->try_info->catch_reached = true;
-    }
-    __ MergeStackWith(current_try->try_info->catch_state, 1,
-                      LiftoffAssembler::kForwardJump);
-    __ emit_jump(&current_try->try_info->catch_label);
-
-    __ bind(&skip_handler);
-    // Drop the exception.
-    __ DropValues(1);
+    handlers_.push_back({MovableLabel{}, handler_offset});
+    std::vector<LandingPad>& landing_pads =
+        current_try->try_info->landing_pads;
+    landing_pads.emplace_back();
+    landing_pads.back().handler_index = handlers_.size() - 1;
+    landing_pads.back().state.Split(*__ cache_state());
+  }
+
+  // Emit the landing pads of all throwing calls within the try block {block}.
+  // Each of them merges into the catch state and jumps to the catch body.
+  void EmitDeferredLandingPads(Control* block) {
+    TryInfo* try_info = block->try_info.get();
+    for (LandingPad& landing_pad : try_info->landing_pads) {
+      CODE_COMMENT("-- landing pad --");
+      __ bind(handlers_[landing_pad.handler_index].handler.get());
+      __ ExceptionHandler();
+      __ cache_state()->Steal(landing_pad.state);
+      __ PushException();
+      if (!try_info->catch_reached) {
+        try_info->catch_state.InitMerge(
+            *__ cache_state(), __ num_locals(), 1,
+            block->stack_depth + block->num_exceptions);
+        try_info->catch_reached = true;
+      }
+      __ MergeStackWith(try_info->catch_state, 1,
+                        LiftoffAssembler::kForwardJump);
+      __ emit_jump(&try_info->catch_label);
+    }
+    try_info->landing_pads.clear();
   }
 
   void Throw(FullDecoder* decoder, const TagIndexImmediate<validate>& imm,
@@ -5784,6 +5847,35 @@ class LiftoffCompiler {
       if (!CheckSupportedType(decoder, ret, "return")) return;
     }
 
+    // Record which entry of table 0 is called. Other tables are rarely used
+    // for dispatch and get no feedback. This must stay in sync with
+    // {WasmGraphBuildingInterface::CallIndirect}.
+    if (FLAG_wasm_speculative_inlining && imm.table_imm.index == 0) {
+      LiftoffRegList pinned;
+      LiftoffAssembler::VarState index_var =
+          __ cache_state()->stack_state.end()[-1];
+      if (index_var.is_reg()) pinned.set(index_var.reg());
+      LiftoffRegister vector = pinned.set(__ GetUnusedRegister(kGpReg, pinned));
+      __ Fill(vector, liftoff::kFeedbackVectorOffset, kPointerKind);
+      LiftoffAssembler::VarState vector_var(kPointerKind, vector, 0);
+      LiftoffRegister slot = pinned.set(__ GetUnusedRegister(kGpReg, pinned));
+      uintptr_t vector_slot = num_call_instructions_ * 2;
+      {
+        base::MutexGuard mutex_guard(&decoder->module_->type_feedback.mutex);
+        decoder->module_->type_feedback.feedback_for_function[func_index_]
+            .positions[decoder->position()] =
+            static_cast<int>(num_call_instructions_);
+      }
+      num_call_instructions_++;
+      __ LoadConstant(slot, WasmValue::ForUintPtr(vector_slot));
+      LiftoffAssembler::VarState slot_var(kPointerKind, slot, 0);
+
+      // CallIndirectIC(vector: FixedArray, index: intptr, entryIndex: uint32)
+      CallRuntimeStub(WasmCode::kCallIndirectIC,
+                      MakeSig::Params(kPointerKind, kPointerKind, kI32),
+                      {vector_var, slot_var, index_var}, decoder->position());
+    }
+
     // Pop the index. We'll modify the register's contents later.
     Register index = __ PopToModifiableRegister().gp();
 
@@ -5944,14 +6036,14 @@ class LiftoffCompiler {
       __ Fill(vector, liftoff::kFeedbackVectorOffset, kPointerKind);
       LiftoffAssembler::VarState vector_var(kPointerKind, vector, 0);
       LiftoffRegister index = pinned.set(__ GetUnusedRegister(kGpReg, pinned));
-      uintptr_t vector_slot = num_call_ref_instructions_ * 2;
+      uintptr_t vector_slot = num_call_instructions_ * 2;
       {
         base::MutexGuard mutex_guard(&decoder->module_->type_feedback.mutex);
         decoder->module_->type_feedback.feedback_for_function[func_index_]
             .positions[decoder->position()] =
-            static_cast<int>(num_call_ref_instructions_);
+            static_cast<int>(num_call_instructions_);
       }
-      num_call_ref_instructions_++;
+      num_call_instructions_++;
       __ LoadConstant(index, WasmValue::ForUintPtr(vector_slot));
       LiftoffAssembler::VarState index_var(kIntPtrKind, index, 0);
 
@@ -6335,9 +6427,10 @@ class LiftoffCompiler {
   // Current number of exception refs on the stack.
   int num_exceptions_ = 0;
 
-  // Number of {call_ref} instructions encountered. While compiling, also
-  // index of the next {call_ref}. Used for indexing type feedback.
-  uintptr_t num_call_ref_instructions_ = 0;
+  // Number of {call_ref} and feedback-collecting {call_indirect} instructions
+  // encountered. While compiling, also index of the next such instruction.
+  // Used for indexing type feedback.
+  uintptr_t num_call_instructions_ = 0;
 
   int32_t* max_steps_;
   int32_t* nondeterminism_;
@@ -649,15 +649,94 @@ class WasmGraphBuildingInterface {
   void CallIndirect(FullDecoder* decoder, const Value& index,
                     const CallIndirectImmediate<validate>& imm,
                     const Value args[], Value returns[]) {
+    int maybe_feedback = GetCallIndirectFeedback(decoder, imm);
+    if (maybe_feedback == -1) {
+      DoCall(
+          decoder,
+          CallInfo::CallIndirect(index, imm.table_imm.index, imm.sig_imm.index),
+          imm.sig, args, returns);
+      return;
+    }
+
+    // Check that the table entry holds the function at a specific index, and
+    // if successful, just emit a direct call.
+    const uint32_t expected_function_index = maybe_feedback;
+
+    TFNode* success_control;
+    TFNode* failure_control;
+    builder_->CompareToInternalFunctionAtIndex(
+        index.node, expected_function_index, &success_control,
+        &failure_control, decoder->position());
+    TFNode* initial_effect = effect();
+
+    builder_->SetControl(success_control);
+    ssa_env_->control = success_control;
+    Value* returns_direct =
+        decoder->zone()->NewArray<Value>(imm.sig->return_count());
+    DoCall(decoder, CallInfo::CallDirect(expected_function_index), imm.sig,
+           args, returns_direct);
+    TFNode* control_direct = control();
+    TFNode* effect_direct = effect();
+
+    builder_->SetEffectControl(initial_effect, failure_control);
+    ssa_env_->effect = initial_effect;
+    ssa_env_->control = failure_control;
+    Value* returns_indirect =
+        decoder->zone()->NewArray<Value>(imm.sig->return_count());
     DoCall(
         decoder,
         CallInfo::CallIndirect(index, imm.table_imm.index, imm.sig_imm.index),
-        imm.sig, args, returns);
+        imm.sig, args, returns_indirect);
+
+    TFNode* control_indirect = control();
+    TFNode* effect_indirect = effect();
+
+    TFNode* control_args[] = {control_direct, control_indirect};
+    TFNode* control = builder_->Merge(2, control_args);
+
+    TFNode* effect_args[] = {effect_direct, effect_indirect, control};
+    TFNode* effect = builder_->EffectPhi(2, effect_args);
+
+    ssa_env_->control = control;
+    ssa_env_->effect = effect;
+    builder_->SetEffectControl(effect, control);
+
+    for (uint32_t i = 0; i < imm.sig->return_count(); i++) {
+      TFNode* phi_args[] = {returns_direct[i].node, returns_indirect[i].node,
+                            control};
+      returns[i].node = builder_->Phi(imm.sig->GetReturn(i), 2, phi_args);
+    }
   }
 
   void ReturnCallIndirect(FullDecoder* decoder, const Value& index,
                           const CallIndirectImmediate<validate>& imm,
                           const Value args[]) {
+    int maybe_feedback = GetCallIndirectFeedback(decoder, imm);
+    if (maybe_feedback == -1) {
+      DoReturnCall(
+          decoder,
+          CallInfo::CallIndirect(index, imm.table_imm.index, imm.sig_imm.index),
+          imm.sig, args);
+      return;
+    }
+
+    const uint32_t expected_function_index = maybe_feedback;
+
+    TFNode* success_control;
+    TFNode* failure_control;
+    builder_->CompareToInternalFunctionAtIndex(
+        index.node, expected_function_index, &success_control,
+        &failure_control, decoder->position());
+    TFNode* initial_effect = effect();
+
+    builder_->SetControl(success_control);
+    ssa_env_->control = success_control;
+    DoReturnCall(decoder, CallInfo::CallDirect(expected_function_index),
+                 imm.sig, args);
+
+    builder_->SetEffectControl(initial_effect, failure_control);
+    ssa_env_->effect = initial_effect;
+    ssa_env_->control = failure_control;
     DoReturnCall(
         decoder,
         CallInfo::CallIndirect(index, imm.table_imm.index, imm.sig_imm.index),
@@ -1288,7 +1367,7 @@ class WasmGraphBuildingInterface {
   std::vector<compiler::WasmLoopInfo> loop_infos_;
   InlinedStatus inlined_status_;
   // The entries in {type_feedback_} are indexed by the position of feedback-
-  // consuming instructions (currently only call_ref).
+  // consuming instructions (call_ref, and call_indirect on table 0).
   int feedback_instruction_index_ = 0;
   std::vector<CallSiteFeedback> type_feedback_;
 
@@ -1296,6 +1375,38 @@ class WasmGraphBuildingInterface {
 
   TFNode* control() { return builder_->control(); }
 
+  // Returns the function that the call_indirect at the current position is
+  // expected to call, or -1 if there is no usable feedback. Liftoff collects
+  // feedback for every call_indirect on table 0, so its entry is consumed even
+  // if it is not used.
+  int GetCallIndirectFeedback(FullDecoder* decoder,
+                              const CallIndirectImmediate<validate>& imm) {
+    if (!FLAG_wasm_speculative_inlining || type_feedback_.size() == 0 ||
+        imm.table_imm.index != 0) {
+      return -1;
+    }
+    DCHECK_LT(feedback_instruction_index_, type_feedback_.size());
+    int maybe_feedback =
+        type_feedback_[feedback_instruction_index_].function_index;
+    feedback_instruction_index_++;
+    if (maybe_feedback == -1) return -1;
+
+    // The feedback was resolved from the table after the call, so the function
+    // might not have the signature of the call site.
+    const WasmModule* module = decoder->module_;
+    uint32_t function_sig_index = module->functions[maybe_feedback].sig_index;
+    if (module->canonicalized_type_ids[function_sig_index] !=
+        module->canonicalized_type_ids[imm.sig_imm.index]) {
+      return -1;
+    }
+
+    if (FLAG_trace_wasm_speculative_inlining) {
+      PrintF("[Function #%d call #%d: graph support for inlining target #%d]\n",
+             func_index_, feedback_instruction_index_ - 1, maybe_feedback);
+    }
+    return maybe_feedback;
+  }
+
   TryInfo* current_try_info(FullDecoder* decoder) {
     DCHECK_LT(decoder->current_catch(), decoder->control_depth());
     return decoder->control_at(decoder->control_depth_of_current_catch())
@@ -1397,31 +1508,7 @@ class WasmGraphBuildingInterface {
     return node;
   }
 
-  TFNode* DefaultValue(ValueType type) {
-    DCHECK(type.is_defaultable());
-    switch (type.kind()) {
-      case kI8:
-      case kI16:
-      case kI32:
-        return builder_->Int32Constant(0);
-      case kI64:
-        return builder_->Int64Constant(0);
-      case kF32:
-        return builder_->Float32Constant(0);
-      case kF64:
-        return builder_->Float64Constant(0);
-      case kS128:
-        return builder_->S128Zero();
-      case kOptRef:
-        return builder_->RefNull();
-      case kRtt:
-      case kRttWithDepth:
-      case kVoid:
-      case kBottom:
-      case kRef:
-        UNREACHABLE();
-    }
-  }
+  TFNode* DefaultValue(ValueType type) { return builder_->DefaultValue(type); }
 
   void MergeValuesInto(FullDecoder* decoder, Control* c, Merge<Value>* merge,
                        Value* values) {
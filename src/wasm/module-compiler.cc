@@ -6,6 +6,7 @@
 
 #include <algorithm>
 #include <queue>
+#include <unordered_set>
 
 #include "src/api/api-inl.h"
 #include "src/asmjs/asm-js.h"
@@ -26,6 +27,8 @@
 #include "src/trap-handler/trap-handler.h"
 #include "src/utils/identity-map.h"
 #include "src/wasm/code-space-access.h"
+#include "src/wasm/function-body-decoder.h"
+#include "src/wasm/jump-table-assembler.h"
 #include "src/wasm/module-decoder.h"
 #include "src/wasm/streaming-decoder.h"
 #include "src/wasm/wasm-code-manager.h"
@@ -1135,6 +1138,37 @@ bool IsLazyModule(const WasmModule* module) {
          (FLAG_asm_wasm_lazy_compilation && is_asmjs_module(module));
 }
 
+// Queues background compilation of the functions that {func_index} calls
+// directly and that are not compiled yet. They are likely to run soon, and
+// compiling them off the main thread avoids one lazy compilation stall each.
+void CompileDirectCalleesInBackground(NativeModule* native_module,
+                                      int func_index) {
+  const WasmModule* module = native_module->module();
+  std::shared_ptr<WireBytesStorage> wire_bytes =
+      Impl(native_module->compilation_state())->GetWireBytesStorage();
+  base::Vector<const uint8_t> code =
+      wire_bytes->GetCode(module->functions[func_index].code);
+
+  Zone zone(GetWasmEngine()->allocator(), ZONE_NAME);
+  BodyLocalDecls locals(&zone);
+  // The function compiled successfully, so its body is valid.
+  BytecodeIterator iterator(code.begin(), code.end(), &locals);
+  CompilationUnitBuilder builder(native_module);
+  std::unordered_set<uint32_t> callees;
+  for (; iterator.has_next(); iterator.next()) {
+    WasmOpcode opcode = iterator.current();
+    if (opcode != kExprCallFunction && opcode != kExprReturnCall) continue;
+    uint32_t length;
+    uint32_t callee = iterator.read_u32v<Decoder::kNoValidation>(
+        iterator.pc() + 1, &length, "function index");
+    if (callee < module->num_imported_functions) continue;
+    if (!callees.insert(callee).second) continue;
+    if (native_module->HasCode(callee)) continue;
+    builder.AddUnits(callee);
+  }
+  builder.Commit();
+}
+
 }  // namespace
 
 bool CompileLazy(Isolate* isolate, Handle<WasmInstanceObject> instance,
@@ -1238,9 +1272,44 @@ bool CompileLazy(Isolate* isolate, Handle<WasmInstanceObject> instance,
     compilation_state->CommitTopTierCompilationUnit(tiering_unit);
   }
 
+  // A background compilation error would fail the whole module, so callees
+  // that were not validated yet are left to be compiled on their first call.
+  if (FLAG_wasm_lazy_compile_callees && !FLAG_wasm_lazy_validation) {
+    CompileDirectCalleesInBackground(native_module, func_index);
+  }
+
   return true;
 }
 
+namespace {
+
+// Resolves {entry} of table 0 to the index of the function it currently holds,
+// if that is a function defined in {instance} itself. Returns -1 otherwise.
+int GetIndirectCallTarget(WasmInstanceObject instance, int entry) {
+  if (entry < 0 ||
+      static_cast<uint32_t>(entry) >= instance.indirect_function_table_size()) {
+    return -1;
+  }
+  if (instance.indirect_function_table_refs().get(entry) != instance) {
+    return -1;
+  }
+  const WasmModule* module = instance.module();
+  Address target = instance.indirect_function_table_targets()[entry];
+  Address jump_table_start = instance.jump_table_start();
+  uint32_t jump_table_size =
+      JumpTableAssembler::JumpSlotIndexToOffset(module->num_declared_functions);
+  if (target < jump_table_start ||
+      target >= jump_table_start + jump_table_size) {
+    return -1;
+  }
+  uint32_t slot_offset = static_cast<uint32_t>(target - jump_table_start);
+  uint32_t slot_index = JumpTableAssembler::SlotOffsetToIndex(slot_offset);
+  DCHECK_EQ(slot_offset, JumpTableAssembler::JumpSlotIndexToOffset(slot_index));
+  return static_cast<int>(module->num_imported_functions + slot_index);
+}
+
+}  // namespace
+
 std::vector<CallSiteFeedback> ProcessTypeFeedback(
     Isolate* isolate, Handle<WasmInstanceObject> instance, int func_index) {
   int which_vector = declared_function_index(instance->module(), func_index);
@@ -1252,7 +1321,19 @@ std::vector<CallSiteFeedback> ProcessTypeFeedback(
       static_cast<int>(instance->module()->num_imported_functions);
   for (int i = 0; i < feedback.length(); i += 2) {
     Object value = feedback.get(i);
-    if (WasmExportedFunction::IsWasmExportedFunction(value)) {
+    if (value.IsSmi()) {
+      // Monomorphic call_indirect. Mark the function currently in the called
+      // table entry for inlining if it's defined in the same module.
+      int target = GetIndirectCallTarget(*instance, Smi::ToInt(value));
+      if (target >= 0) {
+        if (FLAG_trace_wasm_speculative_inlining) {
+          PrintF("[Function #%d call_indirect #%d inlineable (monomorphic)]\n",
+                 func_index, i / 2);
+        }
+        result[i / 2] = {target, Smi::ToInt(feedback.get(i + 1))};
+        continue;
+      }
+    } else if (WasmExportedFunction::IsWasmExportedFunction(value)) {
       // Monomorphic. Mark the target for inlining if it's defined in the
       // same module.
       WasmExportedFunction target = WasmExportedFunction::cast(value);
@@ -1326,6 +1407,23 @@ void TriggerTierUp(Isolate* isolate, NativeModule* native_module,
                                    kNoDebugging};
 
   const WasmModule* module = native_module->module();
+  uint32_t* call_array = native_module->num_liftoff_function_calls_array();
+  int offset = wasm::declared_function_index(module, func_index);
+
+  size_t priority =
+      base::Relaxed_Load(reinterpret_cast<int*>(&call_array[offset]));
+  // Liftoff code calls in here whenever its call count reaches a power of two.
+  // Cold functions are not worth the TurboFan compile time and code space, and
+  // functions with TurboFan code need no more units. The unit of a hot function
+  // is re-added with its growing call count, which raises its priority.
+  if (priority < NativeModule::kInitialLiftoffFunctionCalls +
+                     size_t{FLAG_wasm_tiering_call_threshold}) {
+    return;
+  }
+  if (native_module->HasCodeWithTier(func_index, ExecutionTier::kTurbofan)) {
+    return;
+  }
+
   if (FLAG_wasm_speculative_inlining) {
     auto feedback = ProcessTypeFeedback(isolate, instance, func_index);
     base::MutexGuard mutex_guard(&module->type_feedback.mutex);
@@ -1336,11 +1434,6 @@ void TriggerTierUp(Isolate* isolate, NativeModule* native_module,
         std::move(feedback);
   }
 
-  uint32_t* call_array = native_module->num_liftoff_function_calls_array();
-  int offset = wasm::declared_function_index(module, func_index);
-
-  size_t priority =
-      base::Relaxed_Load(reinterpret_cast<int*>(&call_array[offset]));
   compilation_state->AddTopTierPriorityCompilationUnit(tiering_unit, priority);
 }
 
@@ -1830,8 +1923,8 @@ std::shared_ptr<NativeModule> CompileToNativeModule(
   std::shared_ptr<NativeModule> native_module = engine->MaybeGetNativeModule(
       wasm_module->origin, wire_bytes_copy.as_vector(), isolate);
   if (native_module) {
-    // TODO(thibaudm): Look into sharing export wrappers.
-    CompileJsToWasmWrappers(isolate, wasm_module, export_wrappers_out);
+    GetOrCompileJsToWasmWrappers(isolate, native_module.get(),
+                                 export_wrappers_out);
     return native_module;
   }
 
@@ -1864,7 +1957,8 @@ std::shared_ptr<NativeModule> CompileToNativeModule(
   if (thrower->error()) return {};
 
   if (cache_hit) {
-    CompileJsToWasmWrappers(isolate, wasm_module, export_wrappers_out);
+    GetOrCompileJsToWasmWrappers(isolate, native_module.get(),
+                                 export_wrappers_out);
     return native_module;
   }
 
@@ -2129,8 +2223,8 @@ void AsyncCompileJob::FinishCompile(bool is_after_cache_hit) {
   if (!is_after_deserialization) {
     Handle<FixedArray> export_wrappers;
     if (is_after_cache_hit) {
-      // TODO(thibaudm): Look into sharing wrappers.
-      CompileJsToWasmWrappers(isolate_, module, &export_wrappers);
+      GetOrCompileJsToWasmWrappers(isolate_, native_module_.get(),
+                                   &export_wrappers);
     } else {
       compilation_state->FinalizeJSToWasmWrappers(isolate_, module,
                                                   &export_wrappers);
@@ -2821,6 +2915,12 @@ void AsyncStreamingProcessor::OnFinishedStream(
   DCHECK_EQ(NativeModuleCache::PrefixHash(bytes.as_vector()), prefix_hash_);
   ModuleResult result = decoder_.FinishDecoding(false);
   if (result.failed()) {
+    // The streaming decoder may have assembled the wire bytes in place, in
+    // which case running compilation units still read from {bytes}. Let the
+    // native module own them until those units are done.
+    if (job_->native_module_) {
+      job_->native_module_->SetWireBytes(std::move(bytes));
+    }
     FinishAsyncCompileJobWithError(result.error());
     return;
   }
@@ -3795,6 +3895,19 @@ void CompileJsToWasmWrappers(Isolate* isolate, const WasmModule* module,
   }
 }
 
+void GetOrCompileJsToWasmWrappers(Isolate* isolate,
+                                  NativeModule* native_module,
+                                  Handle<FixedArray>* export_wrappers_out) {
+  if (FLAG_wasm_share_export_wrappers &&
+      GetWasmEngine()
+          ->MaybeGetExportWrappers(isolate, native_module)
+          .ToHandle(export_wrappers_out)) {
+    return;
+  }
+  CompileJsToWasmWrappers(isolate, native_module->module(),
+                          export_wrappers_out);
+}
+
 WasmCode* CompileImportWrapper(
     NativeModule* native_module, Counters* counters,
     compiler::WasmImportCallKind kind, const FunctionSig* sig,
@@ -61,6 +61,13 @@ V8_EXPORT_PRIVATE
 void CompileJsToWasmWrappers(Isolate* isolate, const WasmModule* module,
                              Handle<FixedArray>* export_wrappers_out);
 
+// Reuses the export wrappers of another module object of {native_module} in
+// {isolate} if there is one, and compiles them otherwise.
+V8_EXPORT_PRIVATE
+void GetOrCompileJsToWasmWrappers(Isolate* isolate,
+                                  NativeModule* native_module,
+                                  Handle<FixedArray>* export_wrappers_out);
+
 // Compiles the wrapper for this (kind, sig) pair and sets the corresponding
 // cache entry. Assumes the key already exists in the cache but has not been
 // compiled yet.
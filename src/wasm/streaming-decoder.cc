@@ -4,6 +4,9 @@
 
 #include "src/wasm/streaming-decoder.h"
 
+#include <algorithm>
+
+#include "src/base/bounds.h"
 #include "src/base/platform/wrappers.h"
 #include "src/handles/handles.h"
 #include "src/objects/descriptor-array.h"
@@ -47,6 +50,10 @@ class V8_EXPORT_PRIVATE AsyncStreamingDecoder : public StreamingDecoder {
       const std::shared_ptr<NativeModule>& native_module) override;
 
  private:
+  // The buffer holding all module bytes if the embedder announced the module
+  // size. Section buffers pointing into it keep it alive.
+  using ModuleBuffer = base::OwnedVector<uint8_t>;
+
   // The SectionBuffer is the data object for the content of a single section.
   // It stores all bytes of the section (including section id and section
   // length), and the offset where the actual payload starts.
@@ -55,19 +62,29 @@ class V8_EXPORT_PRIVATE AsyncStreamingDecoder : public StreamingDecoder {
     // id: The section id.
     // payload_length: The length of the payload.
     // length_bytes: The section length, as it is encoded in the module bytes.
+    // module_buffer: If set, the section is stored in place in this buffer
+    //                instead of in a separate allocation.
     SectionBuffer(uint32_t module_offset, uint8_t id, size_t payload_length,
-                  base::Vector<const uint8_t> length_bytes)
+                  base::Vector<const uint8_t> length_bytes,
+                  std::shared_ptr<ModuleBuffer> module_buffer)
         :  // ID + length + payload
           module_offset_(module_offset),
-          bytes_(base::OwnedVector<uint8_t>::NewForOverwrite(
-              1 + length_bytes.length() + payload_length)),
+          module_buffer_(std::move(module_buffer)),
           payload_offset_(1 + length_bytes.length()) {
-      bytes_.start()[0] = id;
-      memcpy(bytes_.start() + 1, &length_bytes.first(), length_bytes.length());
+      size_t size = payload_offset_ + payload_length;
+      if (module_buffer_) {
+        bytes_ = module_buffer_->as_vector().SubVector(module_offset,
+                                                       module_offset + size);
+      } else {
+        owned_bytes_ = base::OwnedVector<uint8_t>::NewForOverwrite(size);
+        bytes_ = owned_bytes_.as_vector();
+      }
+      bytes_[0] = id;
+      memcpy(bytes_.begin() + 1, &length_bytes.first(), length_bytes.length());
     }
 
     SectionCode section_code() const {
-      return static_cast<SectionCode>(bytes_.start()[0]);
+      return static_cast<SectionCode>(bytes_[0]);
     }
 
     base::Vector<const uint8_t> GetCode(WireBytesRef ref) const final {
@@ -78,15 +95,21 @@ class V8_EXPORT_PRIVATE AsyncStreamingDecoder : public StreamingDecoder {
     }
 
     uint32_t module_offset() const { return module_offset_; }
-    base::Vector<uint8_t> bytes() const { return bytes_.as_vector(); }
+    base::Vector<uint8_t> bytes() const { return bytes_; }
     base::Vector<uint8_t> payload() const { return bytes() + payload_offset_; }
     size_t length() const { return bytes_.size(); }
     size_t payload_offset() const { return payload_offset_; }
+    bool is_in_place() const { return module_buffer_ != nullptr; }
 
    private:
     const uint32_t module_offset_;
-    const base::OwnedVector<uint8_t> bytes_;
+    // Keeps the module buffer alive. Once it has been handed over in
+    // {Finish}, the bytes are owned by the receiver of the wire bytes
+    // instead.
+    const std::shared_ptr<ModuleBuffer> module_buffer_;
     const size_t payload_offset_;
+    base::OwnedVector<uint8_t> owned_bytes_;
+    base::Vector<uint8_t> bytes_;
   };
 
   // The decoding of a stream of wasm module bytes is organized in states. Each
@@ -219,12 +242,20 @@ class V8_EXPORT_PRIVATE AsyncStreamingDecoder : public StreamingDecoder {
   size_t total_size_ = 0;
   bool stream_finished_ = false;
 
+  // All module bytes, if the size of the module was announced via
+  // {SetExpectedSize}. Allocated with the first section.
+  std::shared_ptr<ModuleBuffer> module_buffer_;
+
   // We need wire bytes in an array for deserializing cached modules.
   std::vector<uint8_t> wire_bytes_for_deserializing_;
 };
 
 void AsyncStreamingDecoder::OnBytesReceived(base::Vector<const uint8_t> bytes) {
   if (deserializing()) {
+    if (wire_bytes_for_deserializing_.empty() && expected_size_ > 0) {
+      wire_bytes_for_deserializing_.reserve(
+          std::min(expected_size_, max_module_size()));
+    }
     wire_bytes_for_deserializing_.insert(wire_bytes_for_deserializing_.end(),
                                          bytes.begin(), bytes.end());
     return;
@@ -283,16 +314,28 @@ void AsyncStreamingDecoder::Finish() {
     return;
   }
 
-  base::OwnedVector<uint8_t> bytes =
-      base::OwnedVector<uint8_t>::NewForOverwrite(total_size_);
-  uint8_t* cursor = bytes.start();
-  {
 #define BYTES(x) (x & 0xFF), (x >> 8) & 0xFF, (x >> 16) & 0xFF, (x >> 24) & 0xFF
-    uint8_t module_header[]{BYTES(kWasmMagic), BYTES(kWasmVersion)};
+  uint8_t module_header[]{BYTES(kWasmMagic), BYTES(kWasmVersion)};
 #undef BYTES
-    memcpy(cursor, module_header, arraysize(module_header));
-    cursor += arraysize(module_header);
+
+  // If all sections were stored in place and the module has the announced
+  // size, hand over the module buffer instead of copying the sections again.
+  if (module_buffer_ && module_buffer_->size() == total_size_ &&
+      std::all_of(section_buffers_.begin(), section_buffers_.end(),
+                  [](const std::shared_ptr<SectionBuffer>& buffer) {
+                    return buffer->is_in_place();
+                  })) {
+    TRACE_STREAMING("Handing over the module buffer\n");
+    memcpy(module_buffer_->start(), module_header, arraysize(module_header));
+    processor_->OnFinishedStream(std::move(*module_buffer_));
+    return;
   }
+
+  base::OwnedVector<uint8_t> bytes =
+      base::OwnedVector<uint8_t>::NewForOverwrite(total_size_);
+  uint8_t* cursor = bytes.start();
+  memcpy(cursor, module_header, arraysize(module_header));
+  cursor += arraysize(module_header);
   for (const auto& buffer : section_buffers_) {
     DCHECK_LE(cursor - bytes.start() + buffer->length(), total_size_);
     memcpy(cursor, buffer->bytes().begin(), buffer->length());
@@ -706,10 +749,23 @@ AsyncStreamingDecoder::AsyncStreamingDecoder(
 AsyncStreamingDecoder::SectionBuffer* AsyncStreamingDecoder::CreateNewBuffer(
     uint32_t module_offset, uint8_t section_id, size_t length,
     base::Vector<const uint8_t> length_bytes) {
+  if (!module_buffer_ && expected_size_ > 0 &&
+      expected_size_ <= max_module_size()) {
+    module_buffer_ = std::make_shared<ModuleBuffer>(
+        ModuleBuffer::NewForOverwrite(expected_size_));
+  }
+  // Sections that do not fit into the announced size get their own storage.
+  std::shared_ptr<ModuleBuffer> module_buffer;
+  size_t section_size = 1 + length_bytes.length() + length;
+  if (module_buffer_ && base::IsInBounds<size_t>(module_offset, section_size,
+                                                 module_buffer_->size())) {
+    module_buffer = module_buffer_;
+  }
   // Section buffers are allocated in the same order they appear in the module,
   // they will be processed and later on concatenated in that same order.
-  section_buffers_.emplace_back(std::make_shared<SectionBuffer>(
-      module_offset, section_id, length, length_bytes));
+  section_buffers_.emplace_back(
+      std::make_shared<SectionBuffer>(module_offset, section_id, length,
+                                      length_bytes, std::move(module_buffer)));
   return section_buffers_.back().get();
 }
 
@@ -105,6 +105,13 @@ class V8_EXPORT_PRIVATE StreamingDecoder {
   virtual void NotifyNativeModuleCreated(
       const std::shared_ptr<NativeModule>& native_module) = 0;
 
+  // Announces the total size of the module bytes. If the module has exactly
+  // that size, its bytes are assembled in place and not copied again when the
+  // stream finishes.
+  void SetExpectedSize(size_t expected_size) {
+    expected_size_ = expected_size;
+  }
+
   base::Vector<const char> url() { return base::VectorOf(url_); }
 
   void SetUrl(base::Vector<const char> url) {
@@ -125,6 +132,7 @@ class V8_EXPORT_PRIVATE StreamingDecoder {
   std::string url_;
   ModuleCompiledCallback module_compiled_callback_;
   base::Vector<const uint8_t> compiled_module_bytes_;
+  size_t expected_size_ = 0;
 };
 
 }  // namespace wasm
@@ -22,6 +22,7 @@ base::Optional<wasm::ValueKind> WasmReturnTypeFromSignature(
       case kI64:
       case kF32:
       case kF64:
+      case kOptRef:
         return {return_type.kind()};
       default:
         UNREACHABLE();
@@ -711,11 +711,61 @@ base::Vector<byte> WasmCodeAllocator::AllocateForCode(
   return AllocateForCodeInRegion(native_module, size, kUnrestrictedRegion);
 }
 
+base::Vector<byte> WasmCodeAllocator::AllocateInFreedCodeSpace(
+    size_t size, base::AddressRegion region) {
+  // Find the freed region which the allocation will be carved out of. This is
+  // the first one which has enough space within {region}, the same one that
+  // {DisjointAllocationPool::AllocateInRegion} picks.
+  base::AddressRegion containing_region;
+  for (base::AddressRegion freed : freed_code_space_.regions()) {
+    if (freed.GetOverlap(region).size() >= size) {
+      containing_region = freed;
+      break;
+    }
+  }
+  if (containing_region.is_empty()) return {};
+  base::AddressRegion code_space =
+      freed_code_space_.AllocateInRegion(size, region);
+  DCHECK(containing_region.contains(code_space));
+
+  // {FreeCode} decommitted all full pages within freed regions; commit the
+  // ones overlapping the allocation again. All other pages are still
+  // committed.
+  auto* code_manager = GetWasmCodeManager();
+  const Address commit_page_size = CommitPageSize();
+  Address commit_start =
+      std::max(RoundUp(containing_region.begin(), commit_page_size),
+               RoundDown(code_space.begin(), commit_page_size));
+  Address commit_end =
+      std::min(RoundDown(containing_region.end(), commit_page_size),
+               RoundUp(code_space.end(), commit_page_size));
+  if (commit_start < commit_end) {
+    for (base::AddressRegion split_range : SplitRangeByReservationsIfNeeded(
+             {commit_start, commit_end - commit_start}, owned_code_space_)) {
+      code_manager->Commit(split_range);
+    }
+    committed_code_space_.fetch_add(commit_end - commit_start);
+    DCHECK_LE(committed_code_space_.load(), FLAG_wasm_max_code_space * MB);
+  }
+  MakeWritable(code_space);
+  DCHECK(IsAligned(code_space.begin(), kCodeAlignment));
+  // {allocated_code_space_} already contains the reused region.
+  generated_code_size_.fetch_add(code_space.size(), std::memory_order_relaxed);
+
+  TRACE_HEAP("Code alloc for %p (reused): 0x%" PRIxPTR ",+%zu\n", this,
+             code_space.begin(), size);
+  return {reinterpret_cast<byte*>(code_space.begin()), code_space.size()};
+}
+
 base::Vector<byte> WasmCodeAllocator::AllocateForCodeInRegion(
     NativeModule* native_module, size_t size, base::AddressRegion region) {
   DCHECK_LT(0, size);
   auto* code_manager = GetWasmCodeManager();
   size = RoundUp<kCodeAlignment>(size);
+  if (FLAG_wasm_reuse_freed_code_space && !freed_code_space_.IsEmpty()) {
+    base::Vector<byte> reused = AllocateInFreedCodeSpace(size, region);
+    if (!reused.empty()) return reused;
+  }
   base::AddressRegion code_space =
       free_code_space_.AllocateInRegion(size, region);
   if (V8_UNLIKELY(code_space.is_empty())) {
@@ -963,8 +1013,11 @@ namespace {
 BoundsCheckStrategy GetBoundsChecks(const WasmModule* module) {
   if (!FLAG_wasm_bounds_checks) return kNoBoundsChecks;
   if (FLAG_wasm_enforce_bounds_checks) return kExplicitBoundsChecks;
-  // We do not have trap handler support for memory64 yet.
-  if (module->is_memory64) return kExplicitBoundsChecks;
+  // The guard regions only cover 32-bit indexes, so memory64 code still needs
+  // a check of the upper half of the index (see {BoundsCheckMem}).
+  if (module->is_memory64 && !FLAG_wasm_memory64_trap_handling) {
+    return kExplicitBoundsChecks;
+  }
   if (trap_handler::IsTrapHandlerEnabled()) return kTrapHandler;
   return kExplicitBoundsChecks;
 }
@@ -1000,10 +1053,8 @@ NativeModule::NativeModule(const WasmFeatures& enabled,
     num_liftoff_function_calls_ =
         std::make_unique<uint32_t[]>(module_->num_declared_functions);
 
-    // Start counter at 4 to avoid runtime calls for smaller numbers.
-    constexpr int kCounterStart = 4;
     std::fill_n(num_liftoff_function_calls_.get(),
-                module_->num_declared_functions, kCounterStart);
+                module_->num_declared_functions, kInitialLiftoffFunctionCalls);
   }
   // Even though there cannot be another thread using this object (since we are
   // just constructing it), we need to hold the mutex to fulfill the
@@ -86,6 +86,7 @@ struct WasmModule;
   V(WasmTraceMemory)                      \
   V(BigIntToI32Pair)                      \
   V(BigIntToI64)                          \
+  V(CallIndirectIC)                       \
   V(CallRefIC)                            \
   V(DoubleToI)                            \
   V(I32PairToBigInt)                      \
@@ -572,6 +573,11 @@ class WasmCodeAllocator {
   void InsertIntoWritableRegions(base::AddressRegion region,
                                  bool switch_to_writable);
 
+  // Allocate code space for {size} bytes within {region} from previously freed
+  // code space. Returns an empty vector if no freed region is big enough.
+  base::Vector<byte> AllocateInFreedCodeSpace(size_t size,
+                                              base::AddressRegion region);
+
   //////////////////////////////////////////////////////////////////////////////
   // These fields are protected by the mutex in {NativeModule}.
 
@@ -581,7 +587,9 @@ class WasmCodeAllocator {
   // Code space that was allocated for code (subset of {owned_code_space_}).
   DisjointAllocationPool allocated_code_space_;
   // Code space that was allocated before but is dead now. Full pages within
-  // this region are discarded. It's still a subset of {owned_code_space_}.
+  // this region are discarded. It's still a subset of {owned_code_space_}, and
+  // of {allocated_code_space_}. New code is allocated from here first (if
+  // --wasm-reuse-freed-code-space is enabled).
   DisjointAllocationPool freed_code_space_;
   std::vector<VirtualMemory> owned_code_space_;
 
@@ -839,9 +847,16 @@ class V8_EXPORT_PRIVATE NativeModule final {
   // Get or create the debug info for this NativeModule.
   DebugInfo* GetDebugInfo();
 
+  // Call counts of Liftoff functions start at this value, so that the first
+  // few calls do not trigger a runtime call with dynamic tiering.
+  static constexpr uint32_t kInitialLiftoffFunctionCalls = 4;
+
   uint32_t* num_liftoff_function_calls_array() {
     return num_liftoff_function_calls_.get();
   }
+  const uint32_t* num_liftoff_function_calls_array() const {
+    return num_liftoff_function_calls_.get();
+  }
 
  private:
   friend class WasmCode;
@@ -655,11 +655,16 @@ void WasmEngine::AsyncCompile(
     return;
   }
 
-  if (FLAG_wasm_test_streaming) {
+  if (FLAG_wasm_test_streaming || FLAG_wasm_pipelined_async_compilation) {
+    // Feed the whole module through the streaming decoder. This starts
+    // compiling functions while the rest of the module is still being decoded,
+    // instead of decoding the full module upfront.
     std::shared_ptr<StreamingDecoder> streaming_decoder =
         StartStreamingCompilation(
             isolate, enabled, handle(isolate->context(), isolate),
             api_method_name_for_errors, std::move(resolver));
+    // The size is known, so the wire bytes can be assembled in place.
+    streaming_decoder->SetExpectedSize(bytes.length());
     streaming_decoder->OnBytesReceived(bytes.module_bytes());
     streaming_decoder->Finish();
     return;
@@ -860,7 +865,7 @@ Handle<WasmModuleObject> WasmEngine::ImportNativeModule(
   Handle<Script> script =
       GetOrCreateScript(isolate, shared_native_module, source_url);
   Handle<FixedArray> export_wrappers;
-  CompileJsToWasmWrappers(isolate, native_module->module(), &export_wrappers);
+  GetOrCompileJsToWasmWrappers(isolate, native_module, &export_wrappers);
   Handle<WasmModuleObject> module_object = WasmModuleObject::New(
       isolate, std::move(shared_native_module), script, export_wrappers);
   {
@@ -1471,6 +1476,34 @@ Handle<Script> WasmEngine::GetOrCreateScript(
   }
 }
 
+MaybeHandle<FixedArray> WasmEngine::MaybeGetExportWrappers(
+    Isolate* isolate, NativeModule* native_module) {
+  Handle<Script> script;
+  {
+    base::MutexGuard guard(&mutex_);
+    DCHECK_EQ(1, isolates_.count(isolate));
+    auto& scripts = isolates_[isolate]->scripts;
+    auto it = scripts.find(native_module);
+    if (it == scripts.end()) return {};
+    Handle<Script> weak_global_handle = it->second.handle();
+    if (weak_global_handle.is_null()) return {};
+    script = Handle<Script>::New(*weak_global_handle, isolate);
+  }
+  // Module objects are not linked from the script, but all their instances
+  // are, and every instance points back to its module object.
+  WeakArrayList weak_instance_list = script->wasm_weak_instance_list();
+  for (int i = 0; i < weak_instance_list.length(); ++i) {
+    MaybeObject maybe_instance = weak_instance_list.Get(i);
+    if (maybe_instance->IsCleared()) continue;
+    WasmModuleObject module_object =
+        WasmInstanceObject::cast(maybe_instance->GetHeapObject())
+            .module_object();
+    DCHECK_EQ(native_module, module_object.native_module());
+    return handle(module_object.export_wrappers(), isolate);
+  }
+  return {};
+}
+
 std::shared_ptr<OperationsBarrier>
 WasmEngine::GetBarrierForBackgroundCompile() {
   return operations_barrier_;
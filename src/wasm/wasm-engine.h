@@ -219,6 +219,12 @@ class V8_EXPORT_PRIVATE WasmEngine {
       Isolate* isolate, std::shared_ptr<NativeModule> shared_module,
       base::Vector<const char> source_url);
 
+  // Returns the export wrappers of an existing module object of
+  // {native_module} in {isolate}, if one is still reachable through an
+  // instance. All module objects of a native module can share their wrappers.
+  MaybeHandle<FixedArray> MaybeGetExportWrappers(Isolate* isolate,
+                                                 NativeModule* native_module);
+
   AccountingAllocator* allocator() { return &allocator_; }
 
   // Compilation statistics for TurboFan compilations.
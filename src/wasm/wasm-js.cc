@@ -96,6 +96,10 @@ class WasmStreaming::WasmStreamingImpl {
 
   void SetUrl(base::Vector<const char> url) { streaming_decoder_->SetUrl(url); }
 
+  void SetExpectedSize(size_t size) {
+    streaming_decoder_->SetExpectedSize(size);
+  }
+
  private:
   Isolate* const isolate_;
   std::shared_ptr<internal::wasm::StreamingDecoder> streaming_decoder_;
@@ -141,6 +145,11 @@ void WasmStreaming::SetUrl(const char* url, size_t length) {
   impl_->SetUrl(base::VectorOf(url, length));
 }
 
+void WasmStreaming::SetExpectedSize(size_t size) {
+  TRACE_EVENT0("v8.wasm", "wasm.SetExpectedSize");
+  impl_->SetExpectedSize(size);
+}
+
 // static
 std::shared_ptr<WasmStreaming> WasmStreaming::Unpack(Isolate* isolate,
                                                      Local<Value> value) {
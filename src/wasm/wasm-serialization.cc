@@ -4,6 +4,7 @@
 
 #include "src/wasm/wasm-serialization.h"
 
+#include "src/base/atomicops.h"
 #include "src/base/platform/wrappers.h"
 #include "src/codegen/assembler-inl.h"
 #include "src/codegen/external-reference-table.h"
@@ -286,6 +287,7 @@ class V8_EXPORT_PRIVATE NativeModuleSerializer {
   size_t MeasureCode(const WasmCode*) const;
   void WriteHeader(Writer*, size_t total_code_size);
   bool WriteCode(const WasmCode*, Writer*);
+  void WriteTieringProfile(Writer*);
 
   const NativeModule* const native_module_;
   const base::Vector<WasmCode* const> code_table_;
@@ -317,6 +319,8 @@ size_t NativeModuleSerializer::Measure() const {
   for (WasmCode* code : code_table_) {
     size += MeasureCode(code);
   }
+  // The tiering profile has one call count per declared function.
+  size += code_table_.size() * sizeof(uint32_t);
   return size;
 }
 
@@ -433,6 +437,18 @@ bool NativeModuleSerializer::WriteCode(const WasmCode* code, Writer* writer) {
   return true;
 }
 
+void NativeModuleSerializer::WriteTieringProfile(Writer* writer) {
+  // Persist the Liftoff call counts that drive dynamic tiering, so that the
+  // functions that are still missing TurboFan code keep their hotness after
+  // deserialization instead of having to warm up again.
+  const uint32_t* call_array =
+      native_module_->num_liftoff_function_calls_array();
+  for (size_t i = 0; i < code_table_.size(); ++i) {
+    writer->Write(static_cast<uint32_t>(base::Relaxed_Load(
+        reinterpret_cast<const base::Atomic32*>(&call_array[i]))));
+  }
+}
+
 bool NativeModuleSerializer::Write(Writer* writer) {
   DCHECK(!write_called_);
   write_called_ = true;
@@ -453,6 +469,8 @@ bool NativeModuleSerializer::Write(Writer* writer) {
   // Make sure that the serialized total code size was correct.
   CHECK_EQ(total_written_code_, total_code_size);
 
+  WriteTieringProfile(writer);
+
   return true;
 }
 
@@ -543,6 +561,7 @@ class V8_EXPORT_PRIVATE NativeModuleDeserializer {
 
   void ReadHeader(Reader* reader);
   DeserializationUnit ReadCode(int fn_index, Reader* reader);
+  void ReadTieringProfile(Reader* reader);
   void CopyAndRelocate(const DeserializationUnit& unit);
   void Publish(std::vector<DeserializationUnit> batch);
 
@@ -675,6 +694,8 @@ bool NativeModuleDeserializer::Read(Reader* reader) {
     copy_and_reloc_handle->NotifyConcurrencyIncrease();
   }
 
+  ReadTieringProfile(reader);
+
   // Wait for all tasks to finish, while participating in their work.
   copy_and_reloc_handle->Join();
   publish_handle->Join();
@@ -686,6 +707,21 @@ void NativeModuleDeserializer::ReadHeader(Reader* reader) {
   remaining_code_size_ = reader->Read<size_t>();
 }
 
+void NativeModuleDeserializer::ReadTieringProfile(Reader* reader) {
+  uint32_t* call_array = native_module_->num_liftoff_function_calls_array();
+  uint32_t num_declared_functions =
+      native_module_->module()->num_declared_functions;
+  if (reader->current_size() < num_declared_functions * sizeof(uint32_t)) {
+    return;
+  }
+  for (uint32_t i = 0; i < num_declared_functions; ++i) {
+    uint32_t calls = std::max(reader->Read<uint32_t>(),
+                              NativeModule::kInitialLiftoffFunctionCalls);
+    base::Relaxed_Store(reinterpret_cast<base::Atomic32*>(&call_array[i]),
+                        static_cast<base::Atomic32>(calls));
+  }
+}
+
 DeserializationUnit NativeModuleDeserializer::ReadCode(int fn_index,
                                                        Reader* reader) {
   bool has_code = reader->Read<bool>();
@@ -874,8 +910,8 @@ MaybeHandle<WasmModuleObject> DeserializeNativeModule(
   }
 
   Handle<FixedArray> export_wrappers;
-  CompileJsToWasmWrappers(isolate, shared_native_module->module(),
-                          &export_wrappers);
+  GetOrCompileJsToWasmWrappers(isolate, shared_native_module.get(),
+                               &export_wrappers);
 
   Handle<Script> script =
       wasm_engine->GetOrCreateScript(isolate, shared_native_module, source_url);
@@ -16,7 +16,9 @@
 #include "src/handles/handles.h"
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/objects/contexts.h"
+#include "src/objects/js-collection-inl.h"
 #include "src/objects/js-regexp-inl.h"
+#include "src/objects/ordered-hash-table-inl.h"
 #include "src/objects/script.h"
 
 namespace v8 {
@@ -200,6 +202,7 @@ WebSnapshotSerializer::WebSnapshotSerializer(v8::Isolate* isolate)
       class_serializer_(isolate_, nullptr),
       array_serializer_(isolate_, nullptr),
       object_serializer_(isolate_, nullptr),
+      collection_serializer_(isolate_, nullptr),
       export_serializer_(isolate_, nullptr),
       string_ids_(isolate_->heap()),
       map_ids_(isolate_->heap()),
@@ -207,7 +210,8 @@ WebSnapshotSerializer::WebSnapshotSerializer(v8::Isolate* isolate)
       function_ids_(isolate_->heap()),
       class_ids_(isolate_->heap()),
       array_ids_(isolate_->heap()),
-      object_ids_(isolate_->heap()) {}
+      object_ids_(isolate_->heap()),
+      collection_ids_(isolate_->heap()) {}
 
 WebSnapshotSerializer::~WebSnapshotSerializer() {}
 
@@ -244,7 +248,8 @@ bool WebSnapshotSerializer::TakeSnapshot(v8::Local<v8::Context> context,
 }
 
 void WebSnapshotSerializer::SerializePendingItems() {
-  while (!pending_objects_.empty() || !pending_arrays_.empty()) {
+  while (!pending_objects_.empty() || !pending_arrays_.empty() ||
+         !pending_collections_.empty()) {
     while (!pending_objects_.empty()) {
       const Handle<JSObject>& object = pending_objects_.front();
       SerializePendingObject(object);
@@ -256,6 +261,12 @@ void WebSnapshotSerializer::SerializePendingItems() {
       SerializePendingArray(array);
       pending_arrays_.pop();
     }
+
+    while (!pending_collections_.empty()) {
+      const Handle<JSCollection>& collection = pending_collections_.front();
+      SerializePendingCollection(collection);
+      pending_collections_.pop();
+    }
   }
 }
 
@@ -273,9 +284,18 @@ void WebSnapshotSerializer::SerializePendingItems() {
 // - Function count
 // - For each function:
 //   - Serialized function
+// - Array count
+// - For each array:
+//   - Serialized array
 // - Object count
 // - For each object:
 //   - Serialized object
+// - Collection count
+// - For each collection:
+//   - Serialized collection
+// - Class count
+// - For each class:
+//   - Serialized class
 // - Export count
 // - For each export:
 //   - Serialized export
@@ -289,7 +309,8 @@ void WebSnapshotSerializer::WriteSnapshot(uint8_t*& buffer,
       map_serializer_.buffer_size_ + context_serializer_.buffer_size_ +
       function_serializer_.buffer_size_ + class_serializer_.buffer_size_ +
       array_serializer_.buffer_size_ + object_serializer_.buffer_size_ +
-      export_serializer_.buffer_size_ + 8 * sizeof(uint32_t);
+      collection_serializer_.buffer_size_ + export_serializer_.buffer_size_ +
+      9 * sizeof(uint32_t);
   if (total_serializer.ExpandBuffer(needed_size).IsNothing()) {
     Throw("Web snapshot: Out of memory");
     return;
@@ -313,6 +334,9 @@ void WebSnapshotSerializer::WriteSnapshot(uint8_t*& buffer,
   total_serializer.WriteUint32(static_cast<uint32_t>(object_count()));
   total_serializer.WriteRawBytes(object_serializer_.buffer_,
                                  object_serializer_.buffer_size_);
+  total_serializer.WriteUint32(static_cast<uint32_t>(collection_count()));
+  total_serializer.WriteRawBytes(collection_serializer_.buffer_,
+                                 collection_serializer_.buffer_size_);
   total_serializer.WriteUint32(static_cast<uint32_t>(class_count()));
   total_serializer.WriteRawBytes(class_serializer_.buffer_,
                                  class_serializer_.buffer_size_);
@@ -620,24 +644,110 @@ void WebSnapshotSerializer::SerializePendingObject(Handle<JSObject> object) {
   }
 }
 
+void WebSnapshotSerializer::SerializeCollection(
+    Handle<JSCollection> collection, uint32_t& id) {
+  if (InsertIntoIndexMap(collection_ids_, collection, id)) {
+    return;
+  }
+  pending_collections_.push(collection);
+}
+
 // Format (serialized array):
+// - Array type (ArrayType enum)
 // - Length
 // - For each element:
-//   - Serialized value
+//   - For holey arrays: 1 if the element is present, 0 otherwise
+//   - Serialized value, if the element is present
 void WebSnapshotSerializer::SerializePendingArray(Handle<JSArray> array) {
-  auto elements_kind = array->GetElementsKind();
-  if (elements_kind != PACKED_SMI_ELEMENTS &&
-      elements_kind != PACKED_ELEMENTS) {
+  ElementsKind elements_kind = array->GetElementsKind();
+  if (!IsFastElementsKind(elements_kind)) {
     Throw("Web Snapshot: Unsupported array");
     return;
   }
-  // TODO(v8:11525): Support sparse arrays & arrays with holes.
+  // TODO(v8:11525): Support sparse (dictionary mode) arrays.
+  bool holey = IsHoleyElementsKind(elements_kind);
   uint32_t length = static_cast<uint32_t>(array->length().ToSmi().value());
+  array_serializer_.WriteUint32(holey ? ArrayType::HOLEY_ARRAY
+                                      : ArrayType::PACKED_ARRAY);
   array_serializer_.WriteUint32(length);
+  if (IsDoubleElementsKind(elements_kind)) {
+    Handle<FixedDoubleArray> elements =
+        handle(FixedDoubleArray::cast(array->elements()), isolate_);
+    for (uint32_t i = 0; i < length; ++i) {
+      if (holey) {
+        bool is_hole = elements->is_the_hole(i);
+        array_serializer_.WriteUint32(is_hole ? 0 : 1);
+        if (is_hole) continue;
+      }
+      WriteValue(isolate_->factory()->NewNumber(elements->get_scalar(i)),
+                 array_serializer_);
+    }
+    return;
+  }
   Handle<FixedArray> elements =
       handle(FixedArray::cast(array->elements()), isolate_);
   for (uint32_t i = 0; i < length; ++i) {
-    WriteValue(handle(elements->get(i), isolate_), array_serializer_);
+    Handle<Object> value = handle(elements->get(i), isolate_);
+    if (holey) {
+      bool is_hole = value->IsTheHole(isolate_);
+      array_serializer_.WriteUint32(is_hole ? 0 : 1);
+      if (is_hole) continue;
+    }
+    WriteValue(value, array_serializer_);
+  }
+}
+
+// Format (serialized collection):
+// - Collection type (CollectionType enum)
+// - Entry count
+// - For each entry:
+//   - Serialized key
+//   - Serialized value (maps only)
+void WebSnapshotSerializer::SerializePendingCollection(
+    Handle<JSCollection> collection) {
+  // Properties of the collection itself are not supported, so it has to have
+  // the initial map.
+  bool is_map = collection->IsJSMap();
+  Map initial_map = is_map ? isolate_->native_context()->js_map_map()
+                           : isolate_->native_context()->js_set_map();
+  if (collection->map() != initial_map) {
+    Throw("Web snapshot: Unsupported collection map");
+    return;
+  }
+  collection_serializer_.WriteUint32(is_map ? CollectionType::MAP_COLLECTION
+                                            : CollectionType::SET_COLLECTION);
+  // Copy the entries first, since serializing them may allocate.
+  Handle<FixedArray> entries;
+  if (is_map) {
+    Handle<OrderedHashMap> table(
+        OrderedHashMap::cast(Handle<JSMap>::cast(collection)->table()),
+        isolate_);
+    entries = isolate_->factory()->NewFixedArray(2 * table->NumberOfElements());
+    DisallowGarbageCollection no_gc;
+    int index = 0;
+    for (InternalIndex entry : table->IterateEntries()) {
+      Object key;
+      if (!table->ToKey(ReadOnlyRoots(isolate_), entry, &key)) continue;
+      entries->set(index++, key);
+      entries->set(index++, table->ValueAt(entry));
+    }
+  } else {
+    Handle<OrderedHashSet> table(
+        OrderedHashSet::cast(Handle<JSSet>::cast(collection)->table()),
+        isolate_);
+    entries = isolate_->factory()->NewFixedArray(table->NumberOfElements());
+    DisallowGarbageCollection no_gc;
+    int index = 0;
+    for (InternalIndex entry : table->IterateEntries()) {
+      Object key;
+      if (!table->ToKey(ReadOnlyRoots(isolate_), entry, &key)) continue;
+      entries->set(index++, key);
+    }
+  }
+  int entry_count = is_map ? entries->length() / 2 : entries->length();
+  collection_serializer_.WriteUint32(static_cast<uint32_t>(entry_count));
+  for (int i = 0; i < entries->length(); ++i) {
+    WriteValue(handle(entries->get(i), isolate_), collection_serializer_);
   }
 }
 
@@ -717,6 +827,12 @@ void WebSnapshotSerializer::WriteValue(Handle<Object> object,
       serializer.WriteUint32(ValueType::ARRAY_ID);
       serializer.WriteUint32(id);
       break;
+    case JS_MAP_TYPE:
+    case JS_SET_TYPE:
+      SerializeCollection(Handle<JSCollection>::cast(object), id);
+      serializer.WriteUint32(ValueType::COLLECTION_ID);
+      serializer.WriteUint32(id);
+      break;
     case JS_REG_EXP_TYPE: {
       Handle<JSRegExp> regexp = Handle<JSRegExp>::cast(object);
       if (regexp->map() != isolate_->regexp_function()->initial_map()) {
@@ -759,6 +875,7 @@ void WebSnapshotDeserializer::Throw(const char* message) {
   class_count_ = 0;
   function_count_ = 0;
   object_count_ = 0;
+  collection_count_ = 0;
   // Make sure we don't read any more data
   deserializer_->position_ = deserializer_->end_;
 
@@ -827,11 +944,13 @@ bool WebSnapshotDeserializer::Deserialize() {
   DeserializeFunctions();
   DeserializeArrays();
   DeserializeObjects();
+  DeserializeCollections();
   // It comes in handy to deserialize objects before classes. This
   // way, we already have the function prototype for a class deserialized when
   // processing the class and it's easier to adjust it as needed.
   DeserializeClasses();
   ProcessDeferredReferences();
+  FillCollections();
   DeserializeExports();
   DCHECK_EQ(deferred_references_->Length(), 0);
   if (deserializer_->position_ != deserializer_->end_) {
@@ -1347,21 +1466,35 @@ void WebSnapshotDeserializer::DeserializeObjects() {
 void WebSnapshotDeserializer::DeserializeArrays() {
   RCS_SCOPE(isolate_, RuntimeCallCounterId::kWebSnapshotDeserialize_Arrays);
   if (!deserializer_->ReadUint32(&array_count_) ||
-      object_count_ > kMaxItemCount) {
+      array_count_ > kMaxItemCount) {
     Throw("Web snapshot: Malformed array table");
     return;
   }
   STATIC_ASSERT(kMaxItemCount <= FixedArray::kMaxLength);
   arrays_ = isolate_->factory()->NewFixedArray(array_count_);
   for (; current_array_count_ < array_count_; ++current_array_count_) {
+    uint32_t array_type;
     uint32_t length;
-    if (!deserializer_->ReadUint32(&length) || length > kMaxItemCount) {
+    if (!deserializer_->ReadUint32(&array_type) ||
+        array_type > ArrayType::HOLEY_ARRAY ||
+        !deserializer_->ReadUint32(&length) || length > kMaxItemCount) {
       Throw("Web snapshot: Malformed array");
       return;
     }
-    Handle<FixedArray> elements = isolate_->factory()->NewFixedArray(length);
+    bool holey = array_type == ArrayType::HOLEY_ARRAY;
+    Handle<FixedArray> elements =
+        holey ? isolate_->factory()->NewFixedArrayWithHoles(length)
+              : isolate_->factory()->NewFixedArray(length);
     ElementsKind elements_kind = PACKED_SMI_ELEMENTS;
     for (uint32_t i = 0; i < length; ++i) {
+      if (holey) {
+        uint32_t present;
+        if (!deserializer_->ReadUint32(&present) || present > 1) {
+          Throw("Web snapshot: Malformed array");
+          return;
+        }
+        if (present == 0) continue;
+      }
       Handle<Object> value;
       Representation wanted_representation = Representation::None();
       ReadValue(value, wanted_representation, elements, i);
@@ -1371,12 +1504,95 @@ void WebSnapshotDeserializer::DeserializeArrays() {
       DCHECK(!value.is_null());
       elements->set(static_cast<int>(i), *value);
     }
+    if (holey) elements_kind = GetHoleyElementsKind(elements_kind);
     Handle<JSArray> array = isolate_->factory()->NewJSArrayWithElements(
         elements, elements_kind, length);
     arrays_->set(static_cast<int>(current_array_count_), *array);
   }
 }
 
+void WebSnapshotDeserializer::DeserializeCollections() {
+  RCS_SCOPE(isolate_,
+            RuntimeCallCounterId::kWebSnapshotDeserialize_Collections);
+  if (!deserializer_->ReadUint32(&collection_count_) ||
+      collection_count_ > kMaxItemCount) {
+    Throw("Web snapshot: Malformed collection table");
+    return;
+  }
+  STATIC_ASSERT(kMaxItemCount <= FixedArray::kMaxLength);
+  collections_ = isolate_->factory()->NewFixedArray(collection_count_);
+  collection_entries_ = isolate_->factory()->NewFixedArray(collection_count_);
+  for (; current_collection_count_ < collection_count_;
+       ++current_collection_count_) {
+    uint32_t collection_type;
+    uint32_t entry_count;
+    if (!deserializer_->ReadUint32(&collection_type) ||
+        collection_type > CollectionType::SET_COLLECTION ||
+        !deserializer_->ReadUint32(&entry_count) ||
+        entry_count > kMaxItemCount / 2) {
+      Throw("Web snapshot: Malformed collection");
+      return;
+    }
+    bool is_map = collection_type == CollectionType::MAP_COLLECTION;
+    Handle<JSCollection> collection;
+    if (is_map) {
+      collection = isolate_->factory()->NewJSMap();
+    } else {
+      collection = isolate_->factory()->NewJSSet();
+    }
+    int length = static_cast<int>(is_map ? 2 * entry_count : entry_count);
+    // The entries may reference objects which haven't been deserialized yet,
+    // so they are only added to the collection in FillCollections().
+    Handle<FixedArray> entries = isolate_->factory()->NewFixedArray(length);
+    for (int i = 0; i < length; ++i) {
+      Handle<Object> value;
+      Representation representation;
+      ReadValue(value, representation, entries, i);
+      entries->set(i, *value);
+    }
+    collection_entries_->set(static_cast<int>(current_collection_count_),
+                             *entries);
+    collections_->set(static_cast<int>(current_collection_count_),
+                      *collection);
+  }
+}
+
+void WebSnapshotDeserializer::FillCollections() {
+  for (uint32_t i = 0; i < collection_count_; ++i) {
+    Handle<JSCollection> collection(
+        JSCollection::cast(collections_->get(static_cast<int>(i))), isolate_);
+    Handle<FixedArray> entries(
+        FixedArray::cast(collection_entries_->get(static_cast<int>(i))),
+        isolate_);
+    if (collection->IsJSMap()) {
+      Handle<OrderedHashMap> table(OrderedHashMap::cast(collection->table()),
+                                   isolate_);
+      for (int j = 0; j + 1 < entries->length(); j += 2) {
+        if (!OrderedHashMap::Add(isolate_, table,
+                                 handle(entries->get(j), isolate_),
+                                 handle(entries->get(j + 1), isolate_))
+                 .ToHandle(&table)) {
+          Throw("Web snapshot: Collection too large");
+          return;
+        }
+      }
+      collection->set_table(*table);
+    } else {
+      Handle<OrderedHashSet> table(OrderedHashSet::cast(collection->table()),
+                                   isolate_);
+      for (int j = 0; j < entries->length(); ++j) {
+        if (!OrderedHashSet::Add(isolate_, table,
+                                 handle(entries->get(j), isolate_))
+                 .ToHandle(&table)) {
+          Throw("Web snapshot: Collection too large");
+          return;
+        }
+      }
+      collection->set_table(*table);
+    }
+  }
+}
+
 void WebSnapshotDeserializer::DeserializeExports() {
   RCS_SCOPE(isolate_, RuntimeCallCounterId::kWebSnapshotDeserialize_Exports);
   uint32_t count;
@@ -1572,6 +1788,29 @@ void WebSnapshotDeserializer::ReadValue(
       representation = Representation::Tagged();
       break;
     }
+    case ValueType::COLLECTION_ID: {
+      uint32_t collection_id;
+      if (!deserializer_->ReadUint32(&collection_id) ||
+          collection_id >= kMaxItemCount) {
+        Throw("Web snapshot: Malformed variable");
+        return;
+      }
+      if (collection_id < current_collection_count_) {
+        value = handle(collections_->get(collection_id), isolate_);
+      } else {
+        // The collection hasn't been deserialized yet.
+        value = isolate_->factory()->undefined_value();
+        if (object_for_deferred_reference.is_null()) {
+          Throw("Web snapshot: Invalid collection reference");
+          return;
+        }
+        AddDeferredReference(object_for_deferred_reference,
+                             index_for_deferred_reference, COLLECTION_ID,
+                             collection_id);
+      }
+      representation = Representation::Tagged();
+      break;
+    }
     default:
       // TODO(v8:11525): Handle other value types.
       Throw("Web snapshot: Unsupported value type");
@@ -1597,6 +1836,7 @@ void WebSnapshotDeserializer::ProcessDeferredReferences() {
   FixedArray raw_classes = *classes_;
   FixedArray raw_arrays = *arrays_;
   FixedArray raw_objects = *objects_;
+  FixedArray raw_collections = *collections_;
 
   // Deferred references is a list of (object, index, target type, target index)
   // tuples.
@@ -1644,6 +1884,14 @@ void WebSnapshotDeserializer::ProcessDeferredReferences() {
         }
         target = raw_objects.get(target_index);
         break;
+      case COLLECTION_ID:
+        if (static_cast<uint32_t>(target_index) >= collection_count_) {
+          AllowGarbageCollection allow_gc;
+          Throw("Web Snapshots: Invalid collection reference");
+          return;
+        }
+        target = raw_collections.get(target_index);
+        break;
       default:
         UNREACHABLE();
     }
@@ -23,6 +23,7 @@ class Local;
 namespace internal {
 
 class Context;
+class JSCollection;
 class Map;
 class Object;
 class String;
@@ -53,7 +54,8 @@ class WebSnapshotSerializerDeserializer {
     OBJECT_ID,
     FUNCTION_ID,
     CLASS_ID,
-    REGEXP
+    REGEXP,
+    COLLECTION_ID
   };
 
   static constexpr uint8_t kMagicNumber[4] = {'+', '+', '+', ';'};
@@ -62,6 +64,10 @@ class WebSnapshotSerializerDeserializer {
 
   enum PropertyAttributesType : uint8_t { DEFAULT, CUSTOM };
 
+  enum ArrayType : uint8_t { PACKED_ARRAY, HOLEY_ARRAY };
+
+  enum CollectionType : uint8_t { MAP_COLLECTION, SET_COLLECTION };
+
   uint32_t FunctionKindToFunctionFlags(FunctionKind kind);
   FunctionKind FunctionFlagsToFunctionKind(uint32_t flags);
   bool IsFunctionOrMethod(uint32_t flags);
@@ -145,6 +151,10 @@ class V8_EXPORT WebSnapshotSerializer
     return static_cast<uint32_t>(object_ids_.size());
   }
 
+  uint32_t collection_count() const {
+    return static_cast<uint32_t>(collection_ids_.size());
+  }
+
  private:
   WebSnapshotSerializer(const WebSnapshotSerializer&) = delete;
   WebSnapshotSerializer& operator=(const WebSnapshotSerializer&) = delete;
@@ -169,6 +179,8 @@ class V8_EXPORT WebSnapshotSerializer
   void SerializePendingArray(Handle<JSArray> array);
   void SerializeObject(Handle<JSObject> object, uint32_t& id);
   void SerializePendingObject(Handle<JSObject> object);
+  void SerializeCollection(Handle<JSCollection> collection, uint32_t& id);
+  void SerializePendingCollection(Handle<JSCollection> collection);
   void SerializeExport(Handle<JSObject> object, Handle<String> export_name);
   void WriteValue(Handle<Object> object, ValueSerializer& serializer);
 
@@ -179,6 +191,7 @@ class V8_EXPORT WebSnapshotSerializer
   ValueSerializer class_serializer_;
   ValueSerializer array_serializer_;
   ValueSerializer object_serializer_;
+  ValueSerializer collection_serializer_;
   ValueSerializer export_serializer_;
 
   ObjectCacheIndexMap string_ids_;
@@ -188,10 +201,12 @@ class V8_EXPORT WebSnapshotSerializer
   ObjectCacheIndexMap class_ids_;
   ObjectCacheIndexMap array_ids_;
   ObjectCacheIndexMap object_ids_;
+  ObjectCacheIndexMap collection_ids_;
   uint32_t export_count_ = 0;
 
   std::queue<Handle<JSObject>> pending_objects_;
   std::queue<Handle<JSArray>> pending_arrays_;
+  std::queue<Handle<JSCollection>> pending_collections_;
 };
 
 class V8_EXPORT WebSnapshotDeserializer
@@ -210,6 +225,7 @@ class V8_EXPORT WebSnapshotDeserializer
   uint32_t class_count() const { return class_count_; }
   uint32_t array_count() const { return array_count_; }
   uint32_t object_count() const { return object_count_; }
+  uint32_t collection_count() const { return collection_count_; }
 
  private:
   bool Deserialize();
@@ -231,6 +247,9 @@ class V8_EXPORT WebSnapshotDeserializer
   void DeserializeClasses();
   void DeserializeArrays();
   void DeserializeObjects();
+  void DeserializeCollections();
+  // Adds the entries to the collections once all references are resolved.
+  void FillCollections();
   void DeserializeExports();
   void ReadValue(
       Handle<Object>& value, Representation& representation,
@@ -251,6 +270,9 @@ class V8_EXPORT WebSnapshotDeserializer
   Handle<FixedArray> classes_;
   Handle<FixedArray> arrays_;
   Handle<FixedArray> objects_;
+  Handle<FixedArray> collections_;
+  // The entries of each collection, keys and values interleaved for maps.
+  Handle<FixedArray> collection_entries_;
   Handle<ArrayList> deferred_references_;
 
   Handle<WeakFixedArray> shared_function_infos_;
@@ -268,6 +290,8 @@ class V8_EXPORT WebSnapshotDeserializer
   uint32_t current_array_count_ = 0;
   uint32_t object_count_ = 0;
   uint32_t current_object_count_ = 0;
+  uint32_t collection_count_ = 0;
+  uint32_t current_collection_count_ = 0;
 
   std::unique_ptr<ValueDeserializer> deserializer_;
 
@@ -4,12 +4,18 @@
 
 #include "src/zone/accounting-allocator.h"
 
+#include <algorithm>
+#include <iterator>
 #include <memory>
 
+#include "src/base/bits.h"
 #include "src/base/bounded-page-allocator.h"
+#include "src/base/lazy-instance.h"
 #include "src/base/logging.h"
 #include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
 #include "src/base/platform/wrappers.h"
+#include "src/flags/flags.h"
 #include "src/utils/allocation.h"
 #include "src/zone/zone-compression.h"
 #include "src/zone/zone-segment.h"
@@ -64,34 +70,177 @@ std::unique_ptr<v8::base::BoundedPageAllocator> CreateBoundedAllocator(
   return allocator;
 }
 
+// Pooled segments are rounded up to a power of two between the minimum zone
+// segment size and AccountingAllocator::kMaxPooledSegmentSize.
+constexpr int kMinPooledSegmentSizeLog2 = 13;
+constexpr int kMaxPooledSegmentSizeLog2 =
+    base::bits::WhichPowerOfTwo(AccountingAllocator::kMaxPooledSegmentSize);
+constexpr int kNumberOfSizeClasses =
+    kMaxPooledSegmentSizeLog2 - kMinPooledSegmentSizeLog2 + 1;
+
+// Returns the size class of a segment of |bytes|, or -1 if it is not pooled.
+int SizeClassFor(size_t bytes) {
+#if defined(V8_USE_ADDRESS_SANITIZER) || defined(V8_USE_MEMORY_SANITIZER)
+  // Reused segments would hide use-after-free bugs of zone memory.
+  return -1;
+#else
+  if (bytes > AccountingAllocator::kMaxPooledSegmentSize) return -1;
+  int size_log2 = base::bits::WhichPowerOfTwo(base::bits::RoundUpToPowerOfTwo(
+      std::max(bytes, size_t{1} << kMinPooledSegmentSizeLog2)));
+  return size_log2 - kMinPooledSegmentSizeLog2;
+#endif
+}
+
+size_t SizeOfClass(int size_class) {
+  return size_t{1} << (size_class + kMinPooledSegmentSizeLog2);
+}
+
+// A process-wide cache of free segments. The free lists are split into shards
+// and every thread keeps using the same shard, so a compilation job mostly
+// reuses the warm segments freed by the previous job on its thread and
+// concurrent jobs rarely contend on a lock.
+class SegmentPool {
+ public:
+  // Returns a free segment of |size_class| that was allocated with the malloc
+  // function matching |free_fn|, or nullptr.
+  void* Get(int size_class, ZoneBackingAllocator::FreeFn free_fn) {
+    if (free_fn != free_fn_.load(std::memory_order_relaxed)) return nullptr;
+    Shard& shard = CurrentShard();
+    FreeSegment* segment;
+    {
+      base::MutexGuard guard(&shard.mutex);
+      segment = shard.free_lists[size_class];
+      if (segment == nullptr) return nullptr;
+      shard.free_lists[size_class] = segment->next;
+    }
+    pooled_bytes_.fetch_sub(SizeOfClass(size_class),
+                            std::memory_order_relaxed);
+    return segment;
+  }
+
+  // Keeps |memory| for reuse. Returns false if the pool is full, in which case
+  // the caller frees the memory.
+  bool Put(void* memory, int size_class, ZoneBackingAllocator::FreeFn free_fn) {
+    ZoneBackingAllocator::FreeFn expected = nullptr;
+    if (!free_fn_.compare_exchange_strong(expected, free_fn,
+                                          std::memory_order_relaxed) &&
+        expected != free_fn) {
+      return false;
+    }
+    size_t size = SizeOfClass(size_class);
+    size_t pooled = pooled_bytes_.fetch_add(size, std::memory_order_relaxed);
+    if (pooled + size > FLAG_zone_segment_pool_size) {
+      pooled_bytes_.fetch_sub(size, std::memory_order_relaxed);
+      return false;
+    }
+    Shard& shard = CurrentShard();
+    FreeSegment* segment = new (memory) FreeSegment;
+    base::MutexGuard guard(&shard.mutex);
+    segment->next = shard.free_lists[size_class];
+    shard.free_lists[size_class] = segment;
+    return true;
+  }
+
+  void ReleaseAll() {
+    ZoneBackingAllocator::FreeFn free_fn =
+        free_fn_.load(std::memory_order_relaxed);
+    for (Shard& shard : shards_) {
+      FreeSegment* free_lists[kNumberOfSizeClasses];
+      {
+        base::MutexGuard guard(&shard.mutex);
+        std::copy(std::begin(shard.free_lists), std::end(shard.free_lists),
+                  free_lists);
+        std::fill(std::begin(shard.free_lists), std::end(shard.free_lists),
+                  nullptr);
+      }
+      for (int size_class = 0; size_class < kNumberOfSizeClasses;
+           ++size_class) {
+        FreeSegment* segment = free_lists[size_class];
+        while (segment != nullptr) {
+          FreeSegment* next = segment->next;
+          free_fn(segment);
+          pooled_bytes_.fetch_sub(SizeOfClass(size_class),
+                                  std::memory_order_relaxed);
+          segment = next;
+        }
+      }
+    }
+  }
+
+  size_t pooled_bytes() const {
+    return pooled_bytes_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  static constexpr int kNumberOfShards = 8;
+
+  struct FreeSegment {
+    FreeSegment* next = nullptr;
+  };
+
+  struct Shard {
+    base::Mutex mutex;
+    FreeSegment* free_lists[kNumberOfSizeClasses] = {};
+  };
+
+  Shard& CurrentShard() {
+    static thread_local int shard_index = -1;
+    if (shard_index < 0) {
+      shard_index = next_shard_.fetch_add(1, std::memory_order_relaxed) %
+                    kNumberOfShards;
+    }
+    return shards_[shard_index];
+  }
+
+  // All pooled segments are freed with the zone backing free function of the
+  // first segment put into the pool, so segments of allocators with another
+  // zone backing allocator bypass the pool.
+  std::atomic<ZoneBackingAllocator::FreeFn> free_fn_{nullptr};
+  std::atomic<size_t> pooled_bytes_{0};
+  std::atomic<int> next_shard_{0};
+  Shard shards_[kNumberOfShards];
+};
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(SegmentPool, GetSegmentPool)
+
 }  // namespace
 
 AccountingAllocator::AccountingAllocator()
     : zone_backing_malloc_(
           V8::GetCurrentPlatform()->GetZoneBackingAllocator()->GetMallocFn()),
       zone_backing_free_(
-          V8::GetCurrentPlatform()->GetZoneBackingAllocator()->GetFreeFn()) {
-  if (COMPRESS_ZONES_BOOL) {
+          V8::GetCurrentPlatform()->GetZoneBackingAllocator()->GetFreeFn()) {}
+
+AccountingAllocator::~AccountingAllocator() = default;
+
+base::BoundedPageAllocator* AccountingAllocator::GetBoundedPageAllocator() {
+  DCHECK(COMPRESS_ZONES_BOOL);
+  base::CallOnce(&reservation_once_, [this]() {
     v8::PageAllocator* platform_page_allocator = GetPlatformPageAllocator();
     VirtualMemory memory = ReserveAddressSpace(platform_page_allocator);
     reserved_area_ = std::make_unique<VirtualMemory>(std::move(memory));
     bounded_page_allocator_ = CreateBoundedAllocator(platform_page_allocator,
                                                      reserved_area_->address());
-  }
+  });
+  return bounded_page_allocator_.get();
 }
 
-AccountingAllocator::~AccountingAllocator() = default;
-
 Segment* AccountingAllocator::AllocateSegment(size_t bytes,
                                               bool supports_compression) {
   void* memory;
   if (COMPRESS_ZONES_BOOL && supports_compression) {
     bytes = RoundUp(bytes, kZonePageSize);
-    memory = AllocatePages(bounded_page_allocator_.get(), nullptr, bytes,
+    memory = AllocatePages(GetBoundedPageAllocator(), nullptr, bytes,
                            kZonePageSize, PageAllocator::kReadWrite);
 
   } else {
-    memory = AllocWithRetry(bytes, zone_backing_malloc_);
+    memory = nullptr;
+    int size_class = SizeClassFor(bytes);
+    if (size_class >= 0) {
+      bytes = SizeOfClass(size_class);
+      memory = GetSegmentPool()->Get(size_class, zone_backing_free_);
+    }
+    if (memory == nullptr) memory = AllocWithRetry(bytes, zone_backing_malloc_);
   }
   if (memory == nullptr) return nullptr;
 
@@ -115,9 +264,23 @@ void AccountingAllocator::ReturnSegment(Segment* segment,
   if (COMPRESS_ZONES_BOOL && supports_compression) {
     CHECK(FreePages(bounded_page_allocator_.get(), segment, segment_size));
   } else {
-    zone_backing_free_(segment);
+    int size_class = SizeClassFor(segment_size);
+    if (size_class < 0 || SizeOfClass(size_class) != segment_size ||
+        !GetSegmentPool()->Put(segment, size_class, zone_backing_free_)) {
+      zone_backing_free_(segment);
+    }
   }
 }
 
+// static
+void AccountingAllocator::ReleasePooledSegments() {
+  GetSegmentPool()->ReleaseAll();
+}
+
+// static
+size_t AccountingAllocator::GetPooledMemoryUsage() {
+  return GetSegmentPool()->pooled_bytes();
+}
+
 }  // namespace internal
 }  // namespace v8
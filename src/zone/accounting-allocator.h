@@ -10,6 +10,8 @@
 
 #include "include/v8-platform.h"
 #include "src/base/macros.h"
+#include "src/base/once.h"
+#include "src/common/globals.h"
 #include "src/logging/tracing-flags.h"
 
 namespace v8 {
@@ -38,6 +40,17 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
   // them if the pool is already full or memory pressure is high.
   void ReturnSegment(Segment* memory, bool supports_compression);
 
+  // The segment pool is shared by all allocators of the process. It caches
+  // malloc-backed segments of up to kMaxPooledSegmentSize bytes, rounded up to
+  // powers of two, and holds at most --zone-segment-pool-size bytes.
+  static constexpr size_t kMaxPooledSegmentSize = 256 * KB;
+
+  // Frees all pooled segments, e.g. under memory pressure.
+  static void ReleasePooledSegments();
+
+  // Returns the number of bytes held by pooled segments.
+  static size_t GetPooledMemoryUsage();
+
   size_t GetCurrentMemoryUsage() const {
     return current_memory_usage_.load(std::memory_order_relaxed);
   }
@@ -67,9 +80,14 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
   virtual void TraceAllocateSegmentImpl(Segment* segment) {}
 
  private:
+  // Reserves the address space for compressed zones on first use. Many
+  // allocators only back uncompressed zones and never need it.
+  base::BoundedPageAllocator* GetBoundedPageAllocator();
+
   std::atomic<size_t> current_memory_usage_{0};
   std::atomic<size_t> max_memory_usage_{0};
 
+  base::OnceType reservation_once_ = V8_ONCE_INIT;
   std::unique_ptr<VirtualMemory> reserved_area_;
   std::unique_ptr<base::BoundedPageAllocator> bounded_page_allocator_;
 
@@ -0,0 +1,49 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <memory>
+
+#include "include/v8-context.h"
+#include "include/v8-isolate.h"
+#include "src/base/macros.h"
+#include "test/benchmarks/cpp/runtime/utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace benchmarking {
+namespace {
+
+// Deserializes the startup snapshot into a new isolate.
+void BM_IsolateNewAndDispose(benchmark::State& state) {
+  std::unique_ptr<v8::ArrayBuffer::Allocator> allocator(
+      v8::ArrayBuffer::Allocator::NewDefaultAllocator());
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = allocator.get();
+  for (auto _ : state) {
+    USE(_);
+    v8::Isolate* isolate = v8::Isolate::New(create_params);
+    isolate->Dispose();
+  }
+}
+
+// Deserializes the context snapshot into an existing isolate.
+void BM_ContextNew(benchmark::State& state) {
+  BenchmarkIsolate isolate;
+  for (auto _ : state) {
+    USE(_);
+    v8::HandleScope scope(isolate.isolate());
+    benchmark::DoNotOptimize(v8::Context::New(isolate.isolate()));
+  }
+}
+
+}  // namespace
+}  // namespace benchmarking
+}  // namespace internal
+}  // namespace v8
+
+BENCHMARK(v8::internal::benchmarking::BM_IsolateNewAndDispose)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(v8::internal::benchmarking::BM_ContextNew)
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,81 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/base/macros.h"
+#include "src/execution/isolate.h"
+#include "src/handles/handles-inl.h"
+#include "src/heap/factory.h"
+#include "src/objects/objects-inl.h"
+#include "test/benchmarks/cpp/runtime/utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace benchmarking {
+namespace {
+
+// Handles are released in batches, as each allocation creates one.
+constexpr int kBatchSize = 1024;
+
+void BM_FactoryNewFixedArray(benchmark::State& state) {
+  BenchmarkIsolate isolate;
+  Factory* factory = isolate.i_isolate()->factory();
+  int length = static_cast<int>(state.range(0));
+  while (state.KeepRunningBatch(kBatchSize)) {
+    HandleScope scope(isolate.i_isolate());
+    for (int i = 0; i < kBatchSize; i++) {
+      benchmark::DoNotOptimize(factory->NewFixedArray(length));
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * FixedArray::SizeFor(length));
+}
+
+void BM_FactoryNewHeapNumber(benchmark::State& state) {
+  BenchmarkIsolate isolate;
+  Factory* factory = isolate.i_isolate()->factory();
+  while (state.KeepRunningBatch(kBatchSize)) {
+    HandleScope scope(isolate.i_isolate());
+    for (int i = 0; i < kBatchSize; i++) {
+      benchmark::DoNotOptimize(factory->NewHeapNumber(i + 0.5));
+    }
+  }
+}
+
+void BM_FactoryNewJSObject(benchmark::State& state) {
+  BenchmarkIsolate isolate;
+  Isolate* i_isolate = isolate.i_isolate();
+  Factory* factory = i_isolate->factory();
+  Handle<JSFunction> object_function = i_isolate->object_function();
+  while (state.KeepRunningBatch(kBatchSize)) {
+    HandleScope scope(i_isolate);
+    for (int i = 0; i < kBatchSize; i++) {
+      benchmark::DoNotOptimize(factory->NewJSObject(object_function));
+    }
+  }
+}
+
+void BM_FactoryNewString(benchmark::State& state) {
+  BenchmarkIsolate isolate;
+  Factory* factory = isolate.i_isolate()->factory();
+  while (state.KeepRunningBatch(kBatchSize)) {
+    HandleScope scope(isolate.i_isolate());
+    for (int i = 0; i < kBatchSize; i++) {
+      benchmark::DoNotOptimize(
+          factory->NewStringFromAsciiChecked("a short string"));
+    }
+  }
+}
+
+}  // namespace
+}  // namespace benchmarking
+}  // namespace internal
+}  // namespace v8
+
+BENCHMARK(v8::internal::benchmarking::BM_FactoryNewFixedArray)
+    ->Arg(0)
+    ->Arg(8)
+    ->Arg(128);
+BENCHMARK(v8::internal::benchmarking::BM_FactoryNewHeapNumber);
+BENCHMARK(v8::internal::benchmarking::BM_FactoryNewJSObject);
+BENCHMARK(v8::internal::benchmarking::BM_FactoryNewString);
@@ -0,0 +1,57 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <string>
+
+#include "include/v8-json.h"
+#include "include/v8-primitive.h"
+#include "src/base/macros.h"
+#include "test/benchmarks/cpp/runtime/utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace benchmarking {
+namespace {
+
+// About 100 KB of API-response-like JSON.
+const char kMakeJson[] =
+    "JSON.stringify(Array.from({length: 1000}, (_, i) => ({"
+    "  id: i, name: 'user' + i, active: i % 3 == 0, score: i / 7,"
+    "  tags: ['a', 'b', String(i)], address: {city: 'X', zip: 10000 + i}"
+    "})))";
+
+void BM_JsonParse(benchmark::State& state) {
+  BenchmarkIsolate isolate;
+  v8::Local<v8::String> json = isolate.Run(kMakeJson).As<v8::String>();
+  for (auto _ : state) {
+    USE(_);
+    v8::HandleScope scope(isolate.isolate());
+    benchmark::DoNotOptimize(
+        v8::JSON::Parse(isolate.context(), json).ToLocalChecked());
+  }
+  state.SetBytesProcessed(state.iterations() * json->Length());
+}
+
+void BM_JsonStringify(benchmark::State& state) {
+  BenchmarkIsolate isolate;
+  v8::Local<v8::Value> value =
+      isolate.Run(std::string("JSON.parse(") + kMakeJson + ")");
+  for (auto _ : state) {
+    USE(_);
+    v8::HandleScope scope(isolate.isolate());
+    benchmark::DoNotOptimize(
+        v8::JSON::Stringify(isolate.context(), value).ToLocalChecked());
+  }
+}
+
+}  // namespace
+}  // namespace benchmarking
+}  // namespace internal
+}  // namespace v8
+
+BENCHMARK(v8::internal::benchmarking::BM_JsonParse)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(v8::internal::benchmarking::BM_JsonStringify)
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,59 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/api/api-inl.h"
+#include "src/base/macros.h"
+#include "src/execution/isolate.h"
+#include "src/handles/handles-inl.h"
+#include "src/heap/factory.h"
+#include "src/objects/lookup-inl.h"
+#include "src/objects/objects-inl.h"
+#include "test/benchmarks/cpp/runtime/utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace benchmarking {
+namespace {
+
+enum class Holder { kOwn, kPrototype, kDictionary };
+
+const char kMakeReceivers[] =
+    "var proto = {inherited: 1};"
+    "var fast = Object.create(proto);"
+    "fast.a = 1; fast.b = 2; fast.own = 3;"
+    "var slow = {a: 1, b: 2, own: 3};"
+    "for (var i = 0; i < 200; i++) slow['p' + i] = i;"
+    "delete slow.p0;";
+
+// Looks up a data property through the generic LookupIterator path that the
+// runtime and the ICs' slow paths use.
+void BM_LookupIteratorGetProperty(benchmark::State& state) {
+  BenchmarkIsolate isolate;
+  Isolate* i_isolate = isolate.i_isolate();
+  isolate.Run(kMakeReceivers);
+  Holder holder = static_cast<Holder>(state.range(0));
+  Handle<JSReceiver> receiver = Handle<JSReceiver>::cast(
+      Utils::OpenHandle(*isolate.Run(holder == Holder::kDictionary ? "slow"
+                                                                   : "fast")));
+  CHECK_EQ(holder == Holder::kDictionary, !receiver->HasFastProperties());
+  Handle<Name> name = i_isolate->factory()->InternalizeUtf8String(
+      holder == Holder::kPrototype ? "inherited" : "own");
+  for (auto _ : state) {
+    USE(_);
+    LookupIterator it(i_isolate, receiver, name);
+    benchmark::DoNotOptimize(Object::GetProperty(&it).ToHandleChecked());
+  }
+}
+
+}  // namespace
+}  // namespace benchmarking
+}  // namespace internal
+}  // namespace v8
+
+BENCHMARK(v8::internal::benchmarking::BM_LookupIteratorGetProperty)
+    ->ArgName("holder")
+    ->Arg(0)
+    ->Arg(1)
+    ->Arg(2);
@@ -0,0 +1,43 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <cstring>
+#include <memory>
+
+#include "include/libplatform/libplatform.h"
+#include "include/v8-initialization.h"
+#include "test/benchmarks/cpp/runtime/utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+int main(int argc, char** argv) {
+  // Take --js-bundle=<file> and V8 flags out of the arguments before the
+  // benchmark library sees them.
+  static const char kJsBundleFlag[] = "--js-bundle=";
+  for (int i = 1; i < argc; i++) {
+    if (strncmp(argv[i], kJsBundleFlag, strlen(kJsBundleFlag)) == 0) {
+      v8::internal::benchmarking::SetJsBundleFile(argv[i] +
+                                                  strlen(kJsBundleFlag));
+      argv[i] = nullptr;
+    }
+  }
+  int new_argc = 0;
+  for (int i = 0; i < argc; i++) {
+    if (argv[i] != nullptr) argv[new_argc++] = argv[i];
+  }
+  argc = new_argc;
+  benchmark::Initialize(&argc, argv);
+  v8::V8::SetFlagsFromCommandLine(&argc, argv, true);
+
+  v8::V8::InitializeICUDefaultLocation(argv[0]);
+  v8::V8::InitializeExternalStartupData(argv[0]);
+  std::unique_ptr<v8::Platform> platform = v8::platform::NewDefaultPlatform();
+  v8::V8::InitializePlatform(platform.get());
+  v8::V8::Initialize();
+
+  benchmark::RunSpecifiedBenchmarks();
+
+  v8::V8::Dispose();
+  v8::V8::ShutdownPlatform();
+  return 0;
+}
@@ -0,0 +1,49 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <memory>
+
+#include "src/base/macros.h"
+#include "src/execution/isolate.h"
+#include "src/parsing/parse-info.h"
+#include "src/parsing/scanner-character-streams.h"
+#include "src/parsing/scanner-inl.h"
+#include "test/benchmarks/cpp/runtime/utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace benchmarking {
+namespace {
+
+// Tokenizes the whole bundle, see --js-bundle.
+void BM_ScanBundle(benchmark::State& state) {
+  BenchmarkIsolate isolate;
+  const std::string& bundle = JsBundle();
+  UnoptimizedCompileFlags flags =
+      UnoptimizedCompileFlags::ForTest(isolate.i_isolate());
+  for (auto _ : state) {
+    USE(_);
+    std::unique_ptr<Utf16CharacterStream> stream =
+        ScannerStream::ForTesting(bundle.data(), bundle.size());
+    Scanner scanner(stream.get(), flags);
+    scanner.Initialize();
+    int tokens = 0;
+    Token::Value token;
+    do {
+      token = scanner.Next();
+      tokens++;
+    } while (token != Token::EOS && token != Token::ILLEGAL);
+    benchmark::DoNotOptimize(tokens);
+  }
+  state.SetBytesProcessed(state.iterations() * bundle.size());
+}
+
+}  // namespace
+}  // namespace benchmarking
+}  // namespace internal
+}  // namespace v8
+
+BENCHMARK(v8::internal::benchmarking::BM_ScanBundle)
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,64 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <algorithm>
+
+#include "src/base/macros.h"
+#include "src/execution/isolate.h"
+#include "src/handles/handles-inl.h"
+#include "src/heap/factory.h"
+#include "src/heap/heap.h"
+#include "src/objects/objects-inl.h"
+#include "test/benchmarks/cpp/runtime/utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace benchmarking {
+namespace {
+
+constexpr int kObjectsPerScavenge = 16 * 1024;
+
+// Measures a scavenge of a young generation holding kObjectsPerScavenge small
+// arrays of which the given percentage survives.
+void BM_Scavenge(benchmark::State& state) {
+  BenchmarkIsolate isolate;
+  Isolate* i_isolate = isolate.i_isolate();
+  Factory* factory = i_isolate->factory();
+  Heap* heap = i_isolate->heap();
+  int survival_percent = static_cast<int>(state.range(0));
+  int survivors = kObjectsPerScavenge * survival_percent / 100;
+  for (auto _ : state) {
+    USE(_);
+    state.PauseTiming();
+    HandleScope scope(i_isolate);
+    // Start from an empty young generation.
+    heap->CollectGarbage(NEW_SPACE, GarbageCollectionReason::kTesting);
+    heap->CollectGarbage(NEW_SPACE, GarbageCollectionReason::kTesting);
+    Handle<FixedArray> holder =
+        factory->NewFixedArray(std::max(survivors, 1), AllocationType::kOld);
+    int next_survivor = 0;
+    for (int i = 0; i < kObjectsPerScavenge; i++) {
+      Handle<FixedArray> object = factory->NewFixedArray(4);
+      if (i % 100 < survival_percent && next_survivor < survivors) {
+        holder->set(next_survivor++, *object);
+      }
+    }
+    state.ResumeTiming();
+    heap->CollectGarbage(NEW_SPACE, GarbageCollectionReason::kTesting);
+  }
+  state.counters["survivors"] = survivors;
+}
+
+}  // namespace
+}  // namespace benchmarking
+}  // namespace internal
+}  // namespace v8
+
+BENCHMARK(v8::internal::benchmarking::BM_Scavenge)
+    ->Arg(0)
+    ->Arg(10)
+    ->Arg(50)
+    ->Arg(100)
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,66 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <string>
+#include <vector>
+
+#include "src/base/macros.h"
+#include "src/execution/isolate.h"
+#include "src/handles/handles-inl.h"
+#include "src/heap/factory.h"
+#include "src/objects/string-table.h"
+#include "test/benchmarks/cpp/runtime/utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace benchmarking {
+namespace {
+
+constexpr int kStringsPerIteration = 1024;
+
+// Internalizes strings that are not internalized yet, half of them found in
+// the table and half of them inserted. Each benchmark thread uses its own
+// isolate, so with ->Threads() this measures how internalization scales
+// across isolates in one process.
+void BM_StringTableInternalize(benchmark::State& state) {
+  BenchmarkIsolate isolate;
+  Isolate* i_isolate = isolate.i_isolate();
+  Factory* factory = i_isolate->factory();
+  std::vector<std::string> names;
+  for (int i = 0; i < kStringsPerIteration; i++) {
+    int index = i % (kStringsPerIteration / 2);
+    names.push_back("property_" + std::to_string(index) + "_" +
+                    std::to_string(state.thread_index()));
+  }
+  int round = 0;
+  while (state.KeepRunningBatch(kStringsPerIteration)) {
+    state.PauseTiming();
+    HandleScope scope(i_isolate);
+    std::vector<Handle<String>> strings;
+    strings.reserve(names.size());
+    std::string suffix = "#" + std::to_string(round++ % 16);
+    for (size_t i = 0; i < names.size(); i++) {
+      // Every other string is new to the table.
+      std::string name = i % 2 == 0 ? names[i] : names[i] + suffix;
+      strings.push_back(factory->NewStringFromAsciiChecked(name.c_str()));
+    }
+    state.ResumeTiming();
+    for (Handle<String> string : strings) {
+      benchmark::DoNotOptimize(factory->InternalizeString(string));
+    }
+  }
+}
+
+}  // namespace
+}  // namespace benchmarking
+}  // namespace internal
+}  // namespace v8
+
+BENCHMARK(v8::internal::benchmarking::BM_StringTableInternalize)
+    ->Threads(1)
+    ->Threads(2)
+    ->Threads(4)
+    ->Threads(8)
+    ->UseRealTime();
@@ -0,0 +1,96 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "test/benchmarks/cpp/runtime/utils.h"
+
+#include <fstream>
+#include <sstream>
+
+#include "include/v8-primitive.h"
+#include "include/v8-script.h"
+#include "src/base/logging.h"
+
+namespace v8 {
+namespace internal {
+namespace benchmarking {
+
+namespace {
+
+v8::Isolate* NewIsolate(v8::ArrayBuffer::Allocator* allocator) {
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = allocator;
+  return v8::Isolate::New(create_params);
+}
+
+const char* js_bundle_file = nullptr;
+
+// A module-like chunk of library code, repeated to the size of a bundle.
+const char kSyntheticBundleChunk[] =
+    "(function(exports) {\n"
+    "  'use strict';\n"
+    "  const cache = new Map();\n"
+    "  class Emitter {\n"
+    "    constructor() { this.listeners = Object.create(null); }\n"
+    "    on(type, f) { (this.listeners[type] ||= []).push(f); return this; }\n"
+    "    emit(type, ...args) {\n"
+    "      for (const f of this.listeners[type] ?? []) f.apply(this, args);\n"
+    "    }\n"
+    "  }\n"
+    "  function format(template, values) {\n"
+    "    return template.replace(/\\{(\\w+)\\}/g, (_, k) => `${values[k]}`);\n"
+    "  }\n"
+    "  async function load(url, { retries = 3, timeout = 1e3 } = {}) {\n"
+    "    if (cache.has(url)) return cache.get(url);\n"
+    "    for (let i = 0; i < retries; i++) {\n"
+    "      try { return await fetch(url, { timeout }); } catch (e) {}\n"
+    "    }\n"
+    "    throw new Error('failed: ' + url);\n"
+    "  }\n"
+    "  exports.Emitter = Emitter;\n"
+    "  exports.format = format;\n"
+    "  exports.load = load;\n"
+    "  exports.VERSION = [1, 2, 0x1f, 3.5e-2, 'rc'];\n"
+    "})(typeof module === 'object' ? module.exports : {});\n";
+
+}  // namespace
+
+BenchmarkIsolate::BenchmarkIsolate()
+    : allocator_(v8::ArrayBuffer::Allocator::NewDefaultAllocator()),
+      isolate_(NewIsolate(allocator_.get())),
+      isolate_scope_(isolate_.get()),
+      handle_scope_(isolate_.get()),
+      context_(v8::Context::New(isolate_.get())),
+      context_scope_(context_) {}
+
+v8::Local<v8::Value> BenchmarkIsolate::Run(const char* source) {
+  v8::Local<v8::String> source_string =
+      v8::String::NewFromUtf8(isolate(), source).ToLocalChecked();
+  return v8::Script::Compile(context_, source_string)
+      .ToLocalChecked()
+      ->Run(context_)
+      .ToLocalChecked();
+}
+
+void SetJsBundleFile(const char* path) { js_bundle_file = path; }
+
+const std::string& JsBundle() {
+  static const std::string bundle = [] {
+    if (js_bundle_file != nullptr) {
+      std::ifstream file(js_bundle_file);
+      CHECK(file.good());
+      std::stringstream contents;
+      contents << file.rdbuf();
+      return contents.str();
+    }
+    // About 1 MB.
+    std::string result;
+    while (result.size() < 1 * 1024 * 1024) result += kSyntheticBundleChunk;
+    return result;
+  }();
+  return bundle;
+}
+
+}  // namespace benchmarking
+}  // namespace internal
+}  // namespace v8
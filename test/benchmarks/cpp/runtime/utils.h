@@ -0,0 +1,66 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef TEST_BENCHMARK_CPP_RUNTIME_UTILS_H_
+#define TEST_BENCHMARK_CPP_RUNTIME_UTILS_H_
+
+#include <memory>
+#include <string>
+
+#include "include/v8-array-buffer.h"
+#include "include/v8-context.h"
+#include "include/v8-isolate.h"
+#include "include/v8-local-handle.h"
+
+namespace v8 {
+namespace internal {
+
+class Isolate;
+
+namespace benchmarking {
+
+// Creates an isolate and enters it and a new context for the lifetime of the
+// object. Benchmarks keep it on the stack, outside of their timed loops.
+class BenchmarkIsolate final {
+ public:
+  BenchmarkIsolate();
+  BenchmarkIsolate(const BenchmarkIsolate&) = delete;
+  BenchmarkIsolate& operator=(const BenchmarkIsolate&) = delete;
+
+  v8::Isolate* isolate() const { return isolate_.get(); }
+  Isolate* i_isolate() const {
+    return reinterpret_cast<Isolate*>(isolate_.get());
+  }
+  v8::Local<v8::Context> context() const { return context_; }
+
+  // Compiles and runs |source| in the context and returns its completion
+  // value.
+  v8::Local<v8::Value> Run(const char* source);
+  v8::Local<v8::Value> Run(const std::string& source) {
+    return Run(source.c_str());
+  }
+
+ private:
+  struct IsolateDeleter {
+    void operator()(v8::Isolate* isolate) const { isolate->Dispose(); }
+  };
+
+  std::unique_ptr<v8::ArrayBuffer::Allocator> allocator_;
+  std::unique_ptr<v8::Isolate, IsolateDeleter> isolate_;
+  v8::Isolate::Scope isolate_scope_;
+  v8::HandleScope handle_scope_;
+  v8::Local<v8::Context> context_;
+  v8::Context::Scope context_scope_;
+};
+
+// Returns the JavaScript source of the file passed with --js-bundle=<file>, or
+// a synthetic bundle of typical library code if there is none.
+const std::string& JsBundle();
+void SetJsBundleFile(const char* path);
+
+}  // namespace benchmarking
+}  // namespace internal
+}  // namespace v8
+
+#endif  // TEST_BENCHMARK_CPP_RUNTIME_UTILS_H_
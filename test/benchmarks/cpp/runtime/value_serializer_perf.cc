@@ -0,0 +1,53 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <cstdlib>
+#include <utility>
+
+#include "include/v8-value-serializer.h"
+#include "src/base/macros.h"
+#include "test/benchmarks/cpp/runtime/utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace benchmarking {
+namespace {
+
+const char kMakeValue[] =
+    "Array.from({length: 1000}, (_, i) => ({"
+    "  id: i, name: 'item' + i, price: i * 1.25, when: new Date(i),"
+    "  bytes: new Uint8Array(16), tags: new Set(['x', String(i % 10)])"
+    "}))";
+
+// Serializes and deserializes an object graph, as postMessage does.
+void BM_ValueSerializerRoundTrip(benchmark::State& state) {
+  BenchmarkIsolate isolate;
+  v8::Local<v8::Context> context = isolate.context();
+  v8::Local<v8::Value> value = isolate.Run(kMakeValue);
+  size_t bytes = 0;
+  for (auto _ : state) {
+    USE(_);
+    v8::HandleScope scope(isolate.isolate());
+    v8::ValueSerializer serializer(isolate.isolate());
+    serializer.WriteHeader();
+    serializer.WriteValue(context, value).Check();
+    std::pair<uint8_t*, size_t> buffer = serializer.Release();
+    bytes = buffer.second;
+    v8::ValueDeserializer deserializer(isolate.isolate(), buffer.first,
+                                       buffer.second);
+    deserializer.ReadHeader(context).Check();
+    benchmark::DoNotOptimize(deserializer.ReadValue(context).ToLocalChecked());
+    free(buffer.first);
+  }
+  state.SetBytesProcessed(state.iterations() * bytes);
+}
+
+}  // namespace
+}  // namespace benchmarking
+}  // namespace internal
+}  // namespace v8
+
+BENCHMARK(v8::internal::benchmarking::BM_ValueSerializerRoundTrip)
+    ->Unit(benchmark::kMicrosecond);
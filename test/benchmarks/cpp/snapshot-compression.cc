@@ -0,0 +1,100 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <memory>
+#include <string>
+
+#include "include/libplatform/libplatform.h"
+#include "include/v8-array-buffer.h"
+#include "include/v8-context.h"
+#include "include/v8-initialization.h"
+#include "include/v8-isolate.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-primitive.h"
+#include "include/v8-script.h"
+#include "include/v8-snapshot.h"
+#include "src/base/macros.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace {
+
+// Some application state, so that the context section is not negligible.
+const char kAppState[] =
+    "var state = [];"
+    "for (let i = 0; i < 100000; i++) {"
+    "  state.push({id: i, name: 'item' + i, tags: [i % 7, i % 13]});"
+    "}"
+    "function lookup(id) { return state[id].name; }"
+    "lookup(42);";
+
+// Creates a custom snapshot whose sections are compressed at zlib {level}.
+// Builds without snapshot compression ignore the level.
+v8::StartupData CreateSnapshot(int level) {
+  std::string flag = "--snapshot-compression-level=" + std::to_string(level);
+  v8::V8::SetFlagsFromString(flag.c_str());
+  v8::SnapshotCreator creator;
+  v8::Isolate* isolate = creator.GetIsolate();
+  {
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+    v8::Local<v8::String> source =
+        v8::String::NewFromUtf8Literal(isolate, kAppState);
+    v8::Script::Compile(context, source)
+        .ToLocalChecked()
+        ->Run(context)
+        .ToLocalChecked();
+    creator.SetDefaultContext(context);
+  }
+  return creator.CreateBlob(v8::SnapshotCreator::FunctionCodeHandling::kKeep);
+}
+
+// Measures creating an isolate and its default context from a snapshot, which
+// decompresses the startup, read-only and context sections.
+void BM_StartupFromSnapshot(benchmark::State& state) {
+  v8::StartupData blob = CreateSnapshot(static_cast<int>(state.range(0)));
+  std::unique_ptr<v8::ArrayBuffer::Allocator> allocator(
+      v8::ArrayBuffer::Allocator::NewDefaultAllocator());
+  v8::Isolate::CreateParams create_params;
+  create_params.snapshot_blob = &blob;
+  create_params.array_buffer_allocator = allocator.get();
+  for (auto _ : state) {
+    USE(_);
+    v8::Isolate* isolate = v8::Isolate::New(create_params);
+    {
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      benchmark::DoNotOptimize(context);
+    }
+    isolate->Dispose();
+  }
+  state.counters["snapshot_bytes"] = blob.raw_size;
+  delete[] blob.data;
+}
+
+}  // namespace
+
+BENCHMARK(BM_StartupFromSnapshot)
+    ->Arg(-1)
+    ->Arg(0)
+    ->Arg(1)
+    ->Arg(6)
+    ->Arg(9)
+    ->Unit(benchmark::kMillisecond);
+
+int main(int argc, char** argv) {
+  v8::V8::InitializeICUDefaultLocation(argv[0]);
+  v8::V8::InitializeExternalStartupData(argv[0]);
+  std::unique_ptr<v8::Platform> platform = v8::platform::NewDefaultPlatform();
+  v8::V8::InitializePlatform(platform.get());
+  v8::V8::Initialize();
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+
+  v8::V8::Dispose();
+  v8::V8::ShutdownPlatform();
+  return 0;
+}
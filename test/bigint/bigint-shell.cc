@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <chrono>
 #include <cmath>
 #include <memory>
 #include <string>
@@ -25,7 +26,12 @@ int PrintHelp(char** argv) {
             << "--random-seed R\n"
             << "    Initialize the random number generator with this seed.\n"
             << "--runs N\n"
-            << "    Repeat the test N times.\n";
+            << "    Repeat the test N times.\n"
+            << "--benchmark\n"
+            << "    Time the specified operation instead of testing it.\n"
+            << "    Supported for tostring and fromstring.\n"
+            << "--digits N\n"
+            << "    Size of the benchmarked BigInts, in digit_t units.\n";
   return 1;
 }
 
@@ -139,6 +145,8 @@ class Runner {
   int Run() {
     if (op_ == kList) {
       ListTests();
+    } else if (op_ == kTest && benchmark_) {
+      return RunBenchmark();
     } else if (op_ == kTest) {
       RunTest();
     } else {
@@ -228,6 +236,52 @@ class Runner {
     return 0;
   }
 
+  // Reports the fastest of {runs_} conversions of a random number with
+  // {digits_} digits, from or to a decimal string.
+  int RunBenchmark() {
+    if (test_ != kToString && test_ != kFromString) {
+      std::cerr << "No benchmark available for this test.\n";
+      return 1;
+    }
+    constexpr int kMaxDigits = 1 << 30;  // Any large-enough value will do.
+    constexpr int kRadix = 10;
+    ScratchDigits X(digits_);
+    for (int i = 0; i < X.len(); i++) {
+      X[i] = static_cast<digit_t>(rng_.NextUint64());
+    }
+    if (X.msd() == 0) X[X.len() - 1] = 1;
+    int chars_required = ToStringResultLength(X, kRadix, false);
+    std::unique_ptr<char[]> chars(new char[chars_required]);
+    int chars_len = chars_required;
+    processor()->ToString(chars.get(), &chars_len, X, kRadix, false);
+    double best_ms = std::numeric_limits<double>::infinity();
+    for (int i = 0; i < runs_; i++) {
+      std::chrono::steady_clock::time_point start =
+          std::chrono::steady_clock::now();
+      if (test_ == kToString) {
+        std::unique_ptr<char[]> result(new char[chars_required]);
+        int result_len = chars_required;
+        processor()->ToString(result.get(), &result_len, X, kRadix, false);
+        AssertEquals(X, kRadix, chars.get(), chars_len, result.get(),
+                     result_len);
+      } else {
+        FromStringAccumulator accumulator(kMaxDigits);
+        accumulator.Parse(chars.get(), chars.get() + chars_len,
+                          static_cast<digit_t>(kRadix));
+        ScratchDigits result(accumulator.ResultLength());
+        processor()->FromString(result, &accumulator);
+        AssertEquals(chars.get(), chars_len, kRadix, X, result);
+      }
+      std::chrono::duration<double, std::milli> elapsed =
+          std::chrono::steady_clock::now() - start;
+      if (error_) return 1;
+      best_ms = std::min(best_ms, elapsed.count());
+    }
+    std::cout << digits_ << " digits, " << chars_len << " chars: " << best_ms
+              << " ms\n";
+    return 0;
+  }
+
   void TestKaratsuba(int* count) {
     // Calling {MultiplyKaratsuba} directly is only valid if
     // left_size >= right_size and right_size >= kKaratsubaThreshold.
@@ -498,6 +552,12 @@ class Runner {
         runs_ = std::stoi(argv[++i]);
       } else if (strncmp(argv[i], "--runs=", 7) == 0) {
         runs_ = std::stoi(argv[i] + 7);
+      } else if (strcmp(argv[i], "--benchmark") == 0) {
+        benchmark_ = true;
+      } else if (strcmp(argv[i], "--digits") == 0) {
+        digits_ = std::stoi(argv[++i]);
+      } else if (strncmp(argv[i], "--digits=", 9) == 0) {
+        digits_ = std::stoi(argv[i] + 9);
       }
 #define TEST(kName, name)                \
   else if (strcmp(argv[i], name) == 0) { \
@@ -597,6 +657,8 @@ class Runner {
   Operation op_{kNoOp};
   Test test_;
   bool error_{false};
+  bool benchmark_{false};
+  int digits_ = 10000;
   int runs_ = 1;
   int64_t random_seed_{314159265359};
   RNG rng_;
@@ -41,6 +41,7 @@
 #include "src/deoptimizer/deoptimizer.h"
 #include "src/execution/execution.h"
 #include "src/handles/global-handles-inl.h"
+#include "src/heap/bytecode-flushing-policy.h"
 #include "src/heap/combined-heap.h"
 #include "src/heap/factory.h"
 #include "src/heap/gc-tracer.h"
@@ -51,8 +52,10 @@
 #include "src/heap/memory-chunk.h"
 #include "src/heap/memory-reducer.h"
 #include "src/heap/parked-scope.h"
+#include "src/heap/pretenuring-hints.h"
 #include "src/heap/remembered-set-inl.h"
 #include "src/heap/safepoint.h"
+#include "src/heap/string-deduplication-job.h"
 #include "src/ic/ic.h"
 #include "src/numbers/hash-seed-inl.h"
 #include "src/objects/elements.h"
@@ -1045,6 +1048,54 @@ TEST(StringAllocation) {
   }
 }
 
+TEST(StringDeduplication) {
+  if (FLAG_shared_string_table) return;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  Heap* heap = isolate->heap();
+  HandleScope scope(isolate);
+
+  const char* kDuplicate = "a string value that is stored twice";
+  Handle<String> first =
+      factory->NewStringFromAsciiChecked(kDuplicate, AllocationType::kOld);
+  Handle<String> second =
+      factory->NewStringFromAsciiChecked(kDuplicate, AllocationType::kOld);
+  Handle<String> unique = factory->NewStringFromAsciiChecked(
+      "a string value that is stored once", AllocationType::kOld);
+  Handle<String> short_first =
+      factory->NewStringFromAsciiChecked("short", AllocationType::kOld);
+  Handle<String> short_second =
+      factory->NewStringFromAsciiChecked("short", AllocationType::kOld);
+  CHECK(first->IsSeqOneByteString());
+  CHECK(second->IsSeqOneByteString());
+  int duplicate_size = first->Size();
+
+  size_t total_before = heap->tracer()->deduplicated_string_bytes();
+  size_t freed_bytes = StringDeduplicationJob::DeduplicateStrings(heap);
+  CHECK_GE(freed_bytes,
+           static_cast<size_t>(duplicate_size - ThinString::kSize));
+  CHECK_EQ(total_before + freed_bytes,
+           heap->tracer()->deduplicated_string_bytes());
+
+  // One of the duplicates is internalized in place, the other refers to it.
+  Handle<String> canonical = first->IsThinString() ? second : first;
+  Handle<String> duplicate = first->IsThinString() ? first : second;
+  CHECK(canonical->IsInternalizedString());
+  CHECK(duplicate->IsThinString());
+  CHECK_EQ(*canonical, ThinString::cast(*duplicate).actual());
+  CHECK(String::Equals(isolate, duplicate,
+                       factory->NewStringFromAsciiChecked(kDuplicate)));
+
+  // Strings without duplicates stay out of the string table.
+  CHECK(unique->IsSeqOneByteString());
+  CHECK(!unique->IsInternalizedString());
+  if (FLAG_string_deduplication_min_length > 5) {
+    CHECK(!short_first->IsThinString());
+    CHECK(!short_second->IsThinString());
+  }
+}
+
 
 static int ObjectsFoundInHeap(Heap* heap, Handle<Object> objs[], int size) {
   // Count the number of objects found in the heap.
@@ -1164,6 +1215,72 @@ TEST(TestBytecodeFlushing) {
   }
 }
 
+TEST(TestBytecodeFlushingBudget) {
+#ifndef V8_LITE_MODE
+  FLAG_opt = false;
+  FLAG_always_opt = false;
+  i::FLAG_optimize_for_size = false;
+#endif  // V8_LITE_MODE
+#if ENABLE_SPARKPLUG
+  FLAG_always_sparkplug = false;
+#endif  // ENABLE_SPARKPLUG
+  i::FLAG_flush_bytecode = true;
+  i::FLAG_bytecode_flush_budget = 64;
+
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  Isolate* i_isolate = CcTest::i_isolate();
+  Factory* factory = i_isolate->factory();
+  BytecodeFlushingPolicy* policy =
+      i_isolate->heap()->bytecode_flushing_policy();
+
+  {
+    v8::HandleScope scope(isolate);
+    v8::Context::New(isolate)->Enter();
+    const char* source =
+        "function foo() {"
+        "  var x = 42;"
+        "  var y = 42;"
+        "  var z = x + y;"
+        "};"
+        "foo()";
+    Handle<String> foo_name = factory->InternalizeUtf8String("foo");
+    {
+      v8::HandleScope new_scope(isolate);
+      CompileRun(source);
+    }
+    Handle<JSFunction> function = Handle<JSFunction>::cast(
+        Object::GetProperty(i_isolate, i_isolate->global_object(), foo_name)
+            .ToHandleChecked());
+    CHECK(function->shared().is_compiled());
+
+    // The live bytecode fits into the budget, so it stops aging and is never
+    // flushed.
+    const int kAgingThreshold = 6;
+    for (int i = 0; i < 2 * kAgingThreshold; i++) {
+      CcTest::CollectAllGarbage();
+    }
+    CHECK(policy->ShouldPauseAging());
+    CHECK_LT(0, policy->live_bytecode_size());
+    CHECK(function->shared().is_compiled());
+
+    // Without a budget, the bytecode ages and is flushed as usual, and the
+    // recompilation is counted.
+    i::FLAG_bytecode_flush_budget = 0;
+    size_t flushed = policy->flushed_count();
+    size_t recompiled = policy->recompiled_count();
+    for (int i = 0; i < kAgingThreshold + 1; i++) {
+      CcTest::CollectAllGarbage();
+    }
+    CHECK(!policy->ShouldPauseAging());
+    CHECK(!function->shared().is_compiled());
+    CHECK_LT(flushed, policy->flushed_count());
+    CompileRun("foo()");
+    CHECK(function->shared().is_compiled());
+    CHECK_EQ(recompiled + 1, policy->recompiled_count());
+  }
+}
+
 HEAP_TEST(Regress10560) {
   i::FLAG_flush_bytecode = true;
   i::FLAG_allow_natives_syntax = true;
@@ -3568,7 +3685,7 @@ void DetailedErrorStackTraceTest(const char* src,
 
   Handle<FixedArray> stack_trace(Handle<FixedArray>::cast(
       Object::GetProperty(isolate, exception, key).ToHandleChecked()));
-  test(stack_trace);
+  test(isolate->ExpandSimpleStackTrace(stack_trace));
 }
 
 FixedArray ParametersOf(Handle<FixedArray> stack_trace, int frame_index) {
@@ -3663,6 +3780,43 @@ TEST(DetailedErrorStackTraceBuiltinExit) {
   });
 }
 
+// * Test that Error objects keep their raw stack trace until it is formatted
+TEST(SimpleStackTraceExpandedLazily) {
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  Isolate* isolate = CcTest::i_isolate();
+
+  v8::Local<v8::Value> result = CompileRun(
+      "function f() { return new Error('boom'); }"
+      "function g() { return f(); }"
+      "g();");
+  Handle<Object> error = v8::Utils::OpenHandle(*result);
+  Handle<Name> key = isolate->factory()->stack_trace_symbol();
+
+  Handle<Object> raw =
+      Object::GetProperty(isolate, error, key).ToHandleChecked();
+  CHECK(raw->IsFixedArray());
+  Handle<FixedArray> raw_stack = Handle<FixedArray>::cast(raw);
+  CHECK(raw_stack->get(0).IsSmi());
+  CcTest::CollectAllGarbage();
+
+  Handle<FixedArray> frames = isolate->ExpandSimpleStackTrace(raw_stack);
+  CHECK_EQ(3, frames->length());
+  for (int i = 0; i < frames->length(); ++i) {
+    CHECK(frames->get(i).IsStackFrameInfo());
+  }
+  CHECK_EQ(*frames, *isolate->ExpandSimpleStackTrace(frames));
+  Handle<StackFrameInfo> top(StackFrameInfo::cast(frames->get(0)), isolate);
+  CHECK_EQ(1, StackFrameInfo::GetLineNumber(top));
+
+  // Reading .stack formats the stack trace and drops the raw frames.
+  CompileRun("var error = g(); error.stack;");
+  Handle<Object> formatted_error = v8::Utils::OpenHandle(*CompileRun("error"));
+  CHECK(Object::GetProperty(isolate, formatted_error, key)
+            .ToHandleChecked()
+            ->IsString());
+}
+
 TEST(Regress169928) {
   FLAG_allow_natives_syntax = true;
 #ifndef V8_LITE_MODE
@@ -7383,6 +7537,128 @@ TEST(LongTaskStatsYoung) {
       v8::metrics::LongTaskStats::Get(isolate).gc_young_wall_clock_duration_us);
 }
 
+namespace {
+
+AllocationSite LiteralSiteOf(v8::Isolate* isolate, const char* name) {
+  Handle<JSFunction> f = Handle<JSFunction>::cast(
+      v8::Utils::OpenHandle(*v8::Local<v8::Function>::Cast(
+          isolate->GetCurrentContext()
+              ->Global()
+              ->Get(isolate->GetCurrentContext(),
+                    v8::String::NewFromUtf8(isolate, name).ToLocalChecked())
+              .ToLocalChecked())));
+  FeedbackVector vector = f->feedback_vector();
+  FeedbackMetadataIterator slots(vector.metadata());
+  while (slots.HasNext()) {
+    FeedbackSlot slot = slots.Next();
+    if (slots.kind() != FeedbackSlotKind::kLiteral) continue;
+    return AllocationSite::cast(vector.Get(slot)->GetHeapObjectAssumeStrong());
+  }
+  UNREACHABLE();
+}
+
+}  // namespace
+
+UNINITIALIZED_TEST(SharePretenuringDecisions) {
+  if (FLAG_single_generation || !FLAG_allocation_site_pretenuring) return;
+  FLAG_share_pretenuring_decisions = true;
+  FLAG_lazy_feedback_allocation = false;
+  PretenuringHints::ClearForTesting();
+  static const char* source =
+      "function f() { return [{a: 1}, {b: 2}]; }"
+      "f(); f();";
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  for (int i = 0; i < 2; i++) {
+    v8::Isolate* isolate = v8::Isolate::New(create_params);
+    {
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope handle_scope(isolate);
+      v8::Context::New(isolate)->Enter();
+      CompileRun(source);
+      AllocationSite site = LiteralSiteOf(isolate, "f");
+      if (i == 0) {
+        CHECK_NE(AllocationSite::kTenure, site.pretenure_decision());
+        // Pretend that the site was found to be long-lived.
+        site.set_pretenure_decision(AllocationSite::kTenure);
+      } else {
+        // The decision of the first isolate is used from the start.
+        CHECK_EQ(AllocationSite::kTenure, site.pretenure_decision());
+      }
+    }
+    isolate->Dispose();
+    CHECK_LT(0u, PretenuringHints::NumberOfHints());
+  }
+  PretenuringHints::ClearForTesting();
+}
+
+namespace {
+
+struct ContextLimitResult {
+  int calls = 0;
+  size_t allocated_bytes = 0;
+};
+
+void OnContextAllocationLimit(v8::Isolate* isolate,
+                              v8::Local<v8::Context> context,
+                              size_t allocated_bytes, void* data) {
+  ContextLimitResult* result = static_cast<ContextLimitResult*>(data);
+  result->calls++;
+  result->allocated_bytes = allocated_bytes;
+}
+
+}  // namespace
+
+TEST(ContextAllocationLimit) {
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+  v8::Local<v8::Context> context = v8::Context::New(isolate);
+  v8::Local<v8::Context> other = v8::Context::New(isolate);
+  ContextLimitResult result;
+  const size_t kLimit = 256 * KB;
+  isolate->SetContextAllocationLimit(context, kLimit, OnContextAllocationLimit,
+                                     &result);
+  {
+    v8::Context::Scope context_scope(other);
+    CompileRun("var a = []; for (var i = 0; i < 1000; i++) a.push([i]);");
+  }
+  CHECK_EQ(0, result.calls);
+  {
+    v8::Context::Scope context_scope(context);
+    // The loop contains interrupt checks that deliver the callback.
+    CompileRun(
+        "var a = [];"
+        "for (var i = 0; i < 100000; i++) a.push({x: i});");
+  }
+  CHECK_EQ(1, result.calls);
+  CHECK_LT(kLimit, result.allocated_bytes);
+  CHECK_LE(result.allocated_bytes, isolate->GetContextAllocatedBytes(context));
+}
+
+UNINITIALIZED_TEST(RetainReadOnlyHeap) {
+  if (!ReadOnlyHeap::IsReadOnlySpaceShared()) return;
+  FLAG_retain_read_only_heap = true;
+  // The read-only heap deserialized for the first isolate is reused by the
+  // second one even though the first is gone by then.
+  for (int i = 0; i < 2; i++) {
+    v8::Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+    v8::Isolate* isolate = v8::Isolate::New(create_params);
+    {
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      CHECK_EQ(3, CompileRun("[1, 2].length + 1")
+                      ->Int32Value(context)
+                      .FromJust());
+    }
+    isolate->Dispose();
+  }
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
@@ -289,6 +289,35 @@ HEAP_TEST(ObjectStartBitmap) {
 #endif
 }
 
+TEST(DirectHandles) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  HandleScope scope(isolate);
+
+  DirectHandle<String> empty;
+  CHECK(empty.is_null());
+  CHECK(empty.ToHandle(isolate).is_null());
+
+  Handle<String> str = isolate->factory()->NewStringFromAsciiChecked("direct");
+  DirectHandle<String> direct = str;
+  DirectHandle<Object> upcast = str;
+  CHECK_EQ(*str, *direct);
+  CHECK_EQ(*str, *upcast);
+  CHECK_EQ(6, direct->length());
+  CHECK_EQ(*str, *direct.ToHandle(isolate));
+
+#ifdef V8_ENABLE_DIRECT_HANDLE
+  // Once the inner scope is closed, only the stack refers to the string.
+  {
+    HandleScope inner_scope(isolate);
+    direct = isolate->factory()->NewStringFromAsciiChecked("conservative");
+  }
+  CcTest::CollectAllGarbage();
+  CHECK(direct->IsString());
+  CHECK_EQ(12, direct->length());
+#endif  // V8_ENABLE_DIRECT_HANDLE
+}
+
 // TODO(1600): compaction of map space is temporary removed from GC.
 #if 0
 static Handle<Map> CreateMap(Isolate* isolate) {
@@ -60,6 +60,24 @@ class InvokeIntrinsicHelper {
 
 }  // namespace
 
+TEST(IsFastJSArrayForDestructuring) {
+  HandleAndZoneScope handles;
+  Isolate* isolate = handles.main_isolate();
+  InvokeIntrinsicHelper helper(isolate, handles.main_zone(),
+                               Runtime::kInlineIsFastJSArrayForDestructuring);
+
+  CHECK(helper.Invoke(helper.NewObject("[1, 2, 3]"))->IsTrue(isolate));
+  CHECK(helper.Invoke(helper.NewObject("[1.5, , {}]"))->IsTrue(isolate));
+  CHECK(helper.Invoke(helper.NewObject("Object.freeze([1])"))->IsTrue(isolate));
+  CHECK(helper.Invoke(helper.NewObject("var a = []; a[100000] = 1; a"))
+            ->IsFalse(isolate));
+  CHECK(helper.Invoke(helper.NewObject("({length: 1, 0: 1})"))
+            ->IsFalse(isolate));
+  CHECK(helper.Invoke(helper.NewObject("new Uint8Array(2)"))->IsFalse(isolate));
+  CHECK(helper.Invoke(helper.NewObject("'ab'"))->IsFalse(isolate));
+  CHECK(helper.Invoke(helper.Undefined())->IsFalse(isolate));
+}
+
 }  // namespace interpreter
 }  // namespace internal
 }  // namespace v8
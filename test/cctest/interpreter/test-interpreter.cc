@@ -387,7 +387,8 @@ TEST(InterpreterBinaryOpsHeapNumber) {
 }
 
 TEST(InterpreterBinaryOpsBigInt) {
-  // This test only checks that the recorded type feedback is kBigInt.
+  // This test only checks that the recorded type feedback is kBigInt, or
+  // kBigInt64 for additions and subtractions of small values.
   AstBigInt inputs[] = {AstBigInt("1"), AstBigInt("-42"), AstBigInt("0xFFFF")};
   for (size_t l = 0; l < arraysize(inputs); l++) {
     for (size_t r = 0; r < arraysize(inputs); r++) {
@@ -422,7 +423,13 @@ TEST(InterpreterBinaryOpsBigInt) {
         if (tester.HasFeedbackMetadata()) {
           MaybeObject feedback = callable.vector().Get(slot);
           CHECK(feedback->IsSmi());
-          CHECK_EQ(BinaryOperationFeedback::kBigInt, feedback->ToSmi().value());
+          Token::Value op = kArithmeticOperators[o];
+          bool fits_in_int64 =
+              kSystemPointerSize == 8 &&
+              (op == Token::Value::ADD || op == Token::Value::SUB);
+          CHECK_EQ(fits_in_int64 ? BinaryOperationFeedback::kBigInt64
+                                 : BinaryOperationFeedback::kBigInt,
+                   feedback->ToSmi().value());
         }
       }
     }
@@ -133,6 +133,38 @@ TEST(LibSamplerCollectSample) {
   RunSampler(env.local(), function, args, arraysize(args), 100, 100);
 }
 
+TEST(LibSamplerCpuTimeSampling) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  CompileRun(
+      "function spin(count) {\n"
+      "  var x = 0;\n"
+      "  for (var i = 0; i < count; i++) x += Math.sqrt(i);\n"
+      "  return x;\n"
+      "}\n");
+  v8::Local<v8::Function> function = GetFunction(env.local(), "spin");
+  v8::Local<v8::Value> args[] = {v8::Integer::New(isolate, 100000)};
+
+  TestSampler sampler(isolate);
+  sampler.Start();
+  if (!sampler.StartCpuTimeSampling(base::TimeDelta::FromMilliseconds(1))) {
+    // Not supported on this platform.
+    sampler.Stop();
+    return;
+  }
+  CHECK(sampler.IsCpuTimeSampling());
+  sampler.StartCountingSamples();
+  // No thread calls DoSample(), the timer alone triggers the samples.
+  do {
+    function->Call(env.local(), env->Global(), arraysize(args), args)
+        .ToLocalChecked();
+  } while (sampler.js_sample_count() < 10);
+  sampler.Stop();
+  CHECK(!sampler.IsCpuTimeSampling());
+}
+
 #ifdef USE_SIGNALS
 
 class CountingSampler : public Sampler {
@@ -892,23 +892,49 @@ TEST(CloneCharacterStreams) {
     CHECK(!two_byte_string_stream->can_be_cloned());
   }
 
-  // Chunk sources currently not cloneable.
+  // One- and two-byte chunk sources are cloneable; the clones see the chunks
+  // that arrived before they were created.
   {
-    const char* chunks[] = {"1234", "\0"};
+    const char* chunks[] = {"abc", "def", "\0"};
     ChunkSource chunk_source(chunks);
     std::unique_ptr<i::Utf16CharacterStream> one_byte_streaming_stream(
         i::ScannerStream::For(&chunk_source,
                               v8::ScriptCompiler::StreamedSource::ONE_BYTE));
-    CHECK(!one_byte_streaming_stream->can_be_cloned());
+    CHECK(one_byte_streaming_stream->can_be_cloned());
+    for (const char* c = "abc"; *c != '\0'; c++) {
+      CHECK_EQ(static_cast<v8::base::uc32>(*c),
+               one_byte_streaming_stream->Advance());
+    }
+    std::unique_ptr<i::Utf16CharacterStream> clone =
+        one_byte_streaming_stream->Clone();
+    for (const char* c = "def"; *c != '\0'; c++) {
+      CHECK_EQ(static_cast<v8::base::uc32>(*c),
+               one_byte_streaming_stream->Advance());
+    }
+    one_byte_streaming_stream.reset();
+
+    clone->Seek(0);
+    for (const char* c = "abc"; *c != '\0'; c++) {
+      CHECK_EQ(static_cast<v8::base::uc32>(*c), clone->Advance());
+    }
+    CHECK_EQ(i::Utf16CharacterStream::kEndOfInput, clone->Advance());
+  }
+  {
+    const char* chunks[] = {"1234", "\0"};
+    ChunkSource chunk_source(chunks);
+    std::unique_ptr<i::Utf16CharacterStream> two_byte_streaming_stream(
+        i::ScannerStream::For(&chunk_source,
+                              v8::ScriptCompiler::StreamedSource::TWO_BYTE));
+    CHECK(two_byte_streaming_stream->can_be_cloned());
+  }
 
+  // Utf-8 chunk sources currently not cloneable.
+  {
+    const char* chunks[] = {"1234", "\0"};
+    ChunkSource chunk_source(chunks);
     std::unique_ptr<i::Utf16CharacterStream> utf8_streaming_stream(
         i::ScannerStream::For(&chunk_source,
                               v8::ScriptCompiler::StreamedSource::UTF8));
     CHECK(!utf8_streaming_stream->can_be_cloned());
-
-    std::unique_ptr<i::Utf16CharacterStream> two_byte_streaming_stream(
-        i::ScannerStream::For(&chunk_source,
-                              v8::ScriptCompiler::StreamedSource::TWO_BYTE));
-    CHECK(!two_byte_streaming_stream->can_be_cloned());
   }
 }
@@ -105,5 +105,40 @@ TEST(AllThePushbacks) {
   }
 }
 
+TEST(CommentsOfAllLengths) {
+  // Comments are skipped several code units at a time; make sure that the
+  // end of the comment is found at every offset.
+  const uint16_t kTerminators[] = {'\n', '\r', 0x2028, 0x2029};
+  auto append = [](std::vector<uint16_t>* src, const char* chars) {
+    for (; *chars != '\0'; chars++) src->push_back(*chars);
+  };
+  auto scan = [](const std::vector<uint16_t>& src) {
+    std::unique_ptr<Utf16CharacterStream> stream =
+        ScannerStream::ForTesting(src.data(), src.size());
+    Scanner scanner(stream.get(),
+                    UnoptimizedCompileFlags::ForTest(CcTest::i_isolate()));
+    scanner.Initialize();
+    CHECK_TOK(Token::IDENTIFIER, scanner.Next());
+    CHECK_TOK(Token::IDENTIFIER, scanner.Next());
+    CHECK_TOK(Token::EOS, scanner.Next());
+  };
+  for (int length = 0; length < 40; length++) {
+    std::string body(length, 'x');
+    for (uint16_t terminator : kTerminators) {
+      std::vector<uint16_t> src;
+      append(&src, ("a //" + body).c_str());
+      src.push_back(terminator);
+      append(&src, "b");
+      scan(src);
+
+      src.clear();
+      append(&src, ("a /*" + body).c_str());
+      src.push_back(terminator);
+      append(&src, (body + "*/ b /*" + body + "*/").c_str());
+      scan(src);
+    }
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -21,7 +21,8 @@ using compiler::Node;
 
 namespace {
 
-void TestStubCacheOffsetCalculation(StubCache::Table table) {
+void TestStubCacheOffsetCalculation(StubCache::Table table,
+                                    StubCache* stub_cache) {
   Isolate* isolate(CcTest::InitIsolateOnce());
   const int kNumParams = 2;
   CodeAssemblerTester data(isolate, kNumParams + 1);  // Include receiver.
@@ -31,13 +32,13 @@ void TestStubCacheOffsetCalculation(StubCache::Table table) {
     auto name = m.Parameter<Name>(1);
     auto map = m.Parameter<Map>(2);
     TNode<IntPtrT> primary_offset =
-        m.StubCachePrimaryOffsetForTesting(name, map);
+        m.StubCachePrimaryOffsetForTesting(stub_cache, name, map);
     TNode<IntPtrT> result;
     if (table == StubCache::kPrimary) {
       result = primary_offset;
     } else {
       CHECK_EQ(StubCache::kSecondary, table);
-      result = m.StubCacheSecondaryOffsetForTesting(name, map);
+      result = m.StubCacheSecondaryOffsetForTesting(stub_cache, name, map);
     }
     m.Return(m.SmiTag(result));
   }
@@ -79,11 +80,11 @@ void TestStubCacheOffsetCalculation(StubCache::Table table) {
 
       int expected_result;
       {
-        int primary_offset = StubCache::PrimaryOffsetForTesting(*name, *map);
+        int primary_offset = stub_cache->PrimaryOffsetForTesting(*name, *map);
         if (table == StubCache::kPrimary) {
           expected_result = primary_offset;
         } else {
-          expected_result = StubCache::SecondaryOffsetForTesting(*name, *map);
+          expected_result = stub_cache->SecondaryOffsetForTesting(*name, *map);
         }
       }
       Handle<Object> result = ft.Call(name, map).ToHandleChecked();
@@ -97,11 +98,30 @@ void TestStubCacheOffsetCalculation(StubCache::Table table) {
 }  // namespace
 
 TEST(StubCachePrimaryOffset) {
-  TestStubCacheOffsetCalculation(StubCache::kPrimary);
+  Isolate* isolate(CcTest::InitIsolateOnce());
+  TestStubCacheOffsetCalculation(StubCache::kPrimary,
+                                 isolate->load_stub_cache());
 }
 
 TEST(StubCacheSecondaryOffset) {
-  TestStubCacheOffsetCalculation(StubCache::kSecondary);
+  Isolate* isolate(CcTest::InitIsolateOnce());
+  TestStubCacheOffsetCalculation(StubCache::kSecondary,
+                                 isolate->load_stub_cache());
+}
+
+TEST(StubCacheOffsetsWithCustomSizes) {
+  Isolate* isolate(CcTest::InitIsolateOnce());
+  const int kTableBits[][2] = {{StubCache::kMinTableBits, 5},
+                               {13, 11},
+                               {StubCache::kMaxTableBits, 12}};
+  for (const auto& bits : kTableBits) {
+    StubCache stub_cache(isolate, bits[0], bits[1]);
+    stub_cache.Initialize();
+    CHECK_EQ(1 << bits[0], stub_cache.table_size(StubCache::kPrimary));
+    CHECK_EQ(1 << bits[1], stub_cache.table_size(StubCache::kSecondary));
+    TestStubCacheOffsetCalculation(StubCache::kPrimary, &stub_cache);
+    TestStubCacheOffsetCalculation(StubCache::kSecondary, &stub_cache);
+  }
 }
 
 namespace {
@@ -27,6 +27,7 @@
 
 #include "test/cctest/test-api.h"
 
+#include <algorithm>
 #include <climits>
 #include <csignal>
 #include <map>
@@ -490,6 +491,77 @@ THREADED_TEST(AccessElement) {
 }
 
 
+THREADED_TEST(AccessMultiple) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  CompileRun(
+      "var log = [];"
+      "function Point(x, y) { this.x = x; this.y = y; }"
+      "Point.prototype.z = 3;"
+      "var objects = [new Point(1, 2.5), new Point('a', {}),"
+      "               {x: 1, get y() { log.push('y'); return 2; }},"
+      "               new Proxy({x: 1, y: 2}, {})];");
+  Local<v8::Name> keys[] = {
+      v8::String::NewFromUtf8Literal(isolate, "x",
+                                     v8::NewStringType::kInternalized),
+      v8_str("y"),
+      v8::String::NewFromUtf8Literal(isolate, "z",
+                                     v8::NewStringType::kInternalized),
+      v8::Symbol::New(isolate)};
+  Local<v8::Array> objects = CompileRun("objects").As<v8::Array>();
+  Local<Value> values[arraysize(keys)];
+
+  auto get = [&](uint32_t i) {
+    Local<v8::Object> obj =
+        objects->Get(env.local(), i).ToLocalChecked().As<v8::Object>();
+    CHECK(obj->GetMultiple(env.local(), keys, arraysize(keys), values)
+              .FromJust());
+  };
+  get(0);
+  CHECK_EQ(1, values[0]->Int32Value(env.local()).FromJust());
+  CHECK_EQ(2.5, values[1]->NumberValue(env.local()).FromJust());
+  CHECK_EQ(3, values[2]->Int32Value(env.local()).FromJust());
+  CHECK(values[3]->IsUndefined());
+  get(1);
+  CHECK(v8_str("a")->Equals(env.local(), values[0]).FromJust());
+  CHECK(values[1]->IsObject());
+  get(2);
+  CHECK_EQ(2, values[1]->Int32Value(env.local()).FromJust());
+  CHECK(values[2]->IsUndefined());
+  ExpectInt32("log.length", 1);
+  get(3);
+  CHECK_EQ(1, values[0]->Int32Value(env.local()).FromJust());
+  CHECK_EQ(2, values[1]->Int32Value(env.local()).FromJust());
+
+  Local<Value> new_values[] = {v8_num(4.5), v8_str("b"), v8_num(6),
+                               v8::True(isolate)};
+  for (uint32_t i = 0; i < objects->Length(); ++i) {
+    Local<v8::Object> obj =
+        objects->Get(env.local(), i).ToLocalChecked().As<v8::Object>();
+    CHECK(obj->SetMultiple(env.local(), keys, new_values, arraysize(keys))
+              .FromJust());
+  }
+  ExpectTrue("objects[0].x === 4.5 && objects[0].y === 'b'");
+  ExpectTrue("objects[0].z === 6 && Point.prototype.z === 3");
+  ExpectTrue("objects[1].x === 4.5 && objects[1].y === 'b'");
+  // Setting an accessor without a setter does not change the property.
+  ExpectTrue("objects[2].x === 4.5 && objects[2].y === 2");
+  ExpectTrue("objects[3].x === 4.5 && objects[3].y === 'b'");
+
+  // Exceptions stop the access.
+  CompileRun("objects[0].__defineGetter__('y', () => { throw 1; })");
+  Local<v8::Object> obj =
+      objects->Get(env.local(), 0).ToLocalChecked().As<v8::Object>();
+  v8::TryCatch try_catch(isolate);
+  CHECK(obj->GetMultiple(env.local(), keys, arraysize(keys), values)
+            .IsNothing());
+  CHECK(try_catch.HasCaught());
+  CHECK_EQ(4.5, values[0]->NumberValue(env.local()).FromJust());
+  CHECK(values[1]->IsUndefined());
+  CHECK(values[2]->IsUndefined());
+}
+
 THREADED_TEST(Script) {
   LocalContext env;
   v8::HandleScope scope(env->GetIsolate());
@@ -3112,6 +3184,48 @@ THREADED_TEST(SetAlignedPointerInInternalFields) {
   delete[] heap_allocated_2;
 }
 
+THREADED_TEST(NewInstanceWithInternalFields) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  int* heap_allocated_1 = new int[100];
+  int* heap_allocated_2 = new int[100];
+  void* values[] = {heap_allocated_1, heap_allocated_2};
+
+  // Templates without properties allocate every instance afresh, templates
+  // with properties copy a cached instance. Neither shares internal fields.
+  Local<v8::ObjectTemplate> empty_templ = v8::ObjectTemplate::New(isolate);
+  empty_templ->SetInternalFieldCount(3);
+  Local<v8::ObjectTemplate> templ = v8::ObjectTemplate::New(isolate);
+  templ->SetInternalFieldCount(3);
+  templ->Set(isolate, "x", v8_num(1));
+  for (Local<v8::ObjectTemplate> t : {empty_templ, templ}) {
+    Local<v8::Object> first =
+        t->NewInstanceWithInternalFields(env.local(), 2, values)
+            .ToLocalChecked();
+    Local<v8::Object> second =
+        t->NewInstanceWithInternalFields(env.local(), 1, values + 1)
+            .ToLocalChecked();
+    CcTest::CollectAllGarbage();
+    CHECK_EQ(3, first->InternalFieldCount());
+    CHECK_EQ(heap_allocated_1, first->GetAlignedPointerFromInternalField(0));
+    CHECK_EQ(heap_allocated_2, first->GetAlignedPointerFromInternalField(1));
+    CHECK_EQ(heap_allocated_2, second->GetAlignedPointerFromInternalField(0));
+    CHECK(second->GetInternalField(1)->IsUndefined());
+    CHECK(!first->Equals(env.local(), second).FromJust());
+  }
+  Local<v8::Object> obj = templ->NewInstance(env.local()).ToLocalChecked();
+  CHECK(obj->GetInternalField(0)->IsUndefined());
+  CHECK_EQ(1, obj->Get(env.local(), v8_str("x"))
+                  .ToLocalChecked()
+                  ->Int32Value(env.local())
+                  .FromJust());
+
+  delete[] heap_allocated_1;
+  delete[] heap_allocated_2;
+}
+
 static void CheckAlignedPointerInEmbedderData(LocalContext* env, int index,
                                               void* value) {
   CHECK_EQ(0, static_cast<int>(reinterpret_cast<uintptr_t>(value) & 0x1));
@@ -16880,6 +16994,8 @@ TEST(GetHeapSpaceStatistics) {
     total_used_size += space_statistics.space_used_size();
     total_available_size += space_statistics.space_available_size();
     total_physical_size += space_statistics.physical_space_size();
+    CHECK_LE(space_statistics.space_largest_free_block_size(),
+             space_statistics.space_available_size());
   }
   total_available_size += CcTest::heap()->memory_allocator()->Available();
 
@@ -16939,6 +17055,33 @@ TEST(NumberOfDetachedContexts) {
   }
 }
 
+TEST(NumberOfMapsAndDeprecatedInstances) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::HeapStatistics heap_statistics;
+  CHECK_EQ(0u, heap_statistics.number_of_maps());
+  CcTest::isolate()->GetHeapStatistics(&heap_statistics);
+  size_t maps_before = heap_statistics.number_of_maps();
+  CHECK_LT(0u, maps_before);
+
+  // Generalizing the field from Smi to Double deprecates the map of {a}.
+  CompileRun(
+      "function O() { this.x = 1; }"
+      "var a = new O();"
+      "var b = new O();"
+      "b.x = 1.5;");
+  CcTest::isolate()->GetHeapStatistics(&heap_statistics);
+  CHECK_LT(maps_before, heap_statistics.number_of_maps());
+
+  i::Handle<i::JSObject> a =
+      i::Handle<i::JSObject>::cast(v8::Utils::OpenHandle(*CompileRun("a")));
+  CHECK(a->map().is_deprecated());
+  CHECK_LE(1, CcTest::heap()->MigrateDeprecatedInstances());
+  CHECK(!a->map().is_deprecated());
+  CHECK_EQ(1, CompileRun("a.x")->Int32Value(env.local()).FromJust());
+  CHECK_EQ(0, CcTest::heap()->MigrateDeprecatedInstances());
+}
+
 class VisitorImpl : public v8::ExternalResourceVisitor {
  public:
   explicit VisitorImpl(TestResource** resource) {
@@ -18516,6 +18659,41 @@ UNINITIALIZED_TEST(DisposeIsolateWhenInUse) {
   isolate->Dispose();
 }
 
+UNINITIALIZED_TEST(IsolatePool) {
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  const size_t kPoolSize = 2;
+  std::unique_ptr<v8::IsolatePool> pool =
+      v8::IsolatePool::New(create_params, kPoolSize);
+  std::vector<v8::Isolate*> isolates;
+  // Acquire more isolates than the pool holds, so that some are created on
+  // demand.
+  for (int i = 0; i < 4; i++) {
+    v8::Isolate* isolate = pool->Acquire();
+    CHECK_NOT_NULL(isolate);
+    CHECK(!reinterpret_cast<i::Isolate*>(isolate)->IsInUse());
+    CHECK(std::find(isolates.begin(), isolates.end(), isolate) ==
+          isolates.end());
+    {
+      v8::Isolate::Scope i_scope(isolate);
+      v8::HandleScope scope(isolate);
+      LocalContext context(isolate);
+      CHECK_EQ(3, CompileRunChecked(isolate, "var x = 1; x + 2")
+                      ->Int32Value(context.local())
+                      .FromJust());
+      // Every isolate starts out fresh.
+      ExpectTrue("Object.keys(globalThis).length == 1");
+    }
+    isolates.push_back(isolate);
+  }
+  for (v8::Isolate* isolate : isolates) pool->Release(isolate);
+  // The pool refills itself in the background.
+  while (pool->ReadyCount() < kPoolSize) {
+    v8::base::OS::Sleep(v8::base::TimeDelta::FromMilliseconds(1));
+  }
+  pool.reset();
+}
+
 
 static void BreakArrayGuarantees(const char* script) {
   v8::Isolate::CreateParams create_params;
@@ -21283,6 +21461,42 @@ THREADED_TEST(JSONParseArray) {
                      i::PACKED_ELEMENTS);
 }
 
+THREADED_TEST(JSONParseUtf8Source) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  HandleScope scope(isolate);
+  Local<Object> global = context->Global();
+
+  // Feed the text one byte at a time, so that multi-byte characters are split
+  // across chunks.
+  const char* inputs[] = {
+      "{\"x\":[1,2.5,\"abc\"]}",
+      "{\"x\":\"\xC3\xA9t\xC3\xA9\"}",
+      "{\"x\":\"\xE2\x82\xAC \xF0\x9F\x98\x80\"}",
+  };
+  const char* expected[] = {
+      "{\"x\":[1,2.5,\"abc\"]}",
+      "{\"x\":\"\xC3\xA9t\xC3\xA9\"}",
+      "{\"x\":\"\xE2\x82\xAC \xF0\x9F\x98\x80\"}",
+  };
+  for (size_t i = 0; i < arraysize(inputs); i++) {
+    v8::JSON::Utf8Source source;
+    for (const char* c = inputs[i]; *c != '\0'; c++) source.Append(c, 1);
+    Local<Value> obj =
+        v8::JSON::Parse(context.local(), &source).ToLocalChecked();
+    global->Set(context.local(), v8_str("obj"), obj).FromJust();
+    ExpectString("JSON.stringify(obj)", expected[i]);
+  }
+
+  {
+    v8::JSON::Utf8Source source;
+    source.Append("[1, 2", 5);
+    v8::TryCatch try_catch(isolate);
+    CHECK(v8::JSON::Parse(context.local(), &source).IsEmpty());
+    CHECK(try_catch.HasCaught());
+  }
+}
+
 THREADED_TEST(JSONStringifyObject) {
   LocalContext context;
   HandleScope scope(context->GetIsolate());
@@ -27998,6 +28212,29 @@ struct ApiObjectChecker
   int initial_data_;
 };
 
+struct OneByteStringChecker
+    : BasicApiChecker<const v8::FastOneByteString&, OneByteStringChecker,
+                      void> {
+  static void FastCallback(v8::Local<v8::Object> receiver,
+                           const v8::FastOneByteString& argument,
+                           v8::FastApiCallbackOptions& options) {
+    OneByteStringChecker* receiver_ptr =
+        GetInternalField<OneByteStringChecker>(*receiver);
+    receiver_ptr->SetCallFast();
+    receiver_ptr->value_ = std::string(argument.data, argument.length);
+  }
+  static void SlowCallback(const v8::FunctionCallbackInfo<v8::Value>& info) {
+    v8::Object* receiver_obj = v8::Object::Cast(*info.Holder());
+    OneByteStringChecker* receiver_ptr =
+        GetInternalField<OneByteStringChecker>(receiver_obj);
+    receiver_ptr->SetCallSlow();
+    v8::String::Utf8Value value(info.GetIsolate(), info[0]);
+    receiver_ptr->value_ = *value;
+  }
+
+  std::string value_;
+};
+
 template <typename Value, typename Impl, typename Ret>
 bool SetupTest(v8::Local<v8::Value> initial_value, LocalContext* env,
                BasicApiChecker<Value, Impl, Ret>* checker,
@@ -28154,6 +28391,29 @@ void CheckApiObjectArg() {
   CHECK(!checker.DidCallSlow());
 }
 
+void CheckOneByteStringArg(const char* value_source,
+                           ApiCheckerResultFlags expected_path,
+                           const char* expected_value) {
+  LocalContext env;
+  OneByteStringChecker checker;
+  bool has_caught = SetupTest(CompileRun(value_source), &env, &checker,
+                              "function func(arg) { receiver.api_func(arg); }"
+                              "%PrepareFunctionForOptimization(func);"
+                              "func(value);");
+  checker.Reset();
+  CHECK(!has_caught);
+
+  CompileRun(
+      "%OptimizeFunctionOnNextCall(func);"
+      "func(value);");
+
+  CHECK_EQ(expected_path == ApiCheckerResult::kFastCalled,
+           checker.DidCallFast());
+  CHECK_EQ(expected_path == ApiCheckerResult::kSlowCalled,
+           checker.DidCallSlow());
+  CHECK_EQ(0, strcmp(expected_value, checker.value_.c_str()));
+}
+
 template <typename T>
 struct ReturnValueChecker : BasicApiChecker<T, ReturnValueChecker<T>, T> {
   static T FastCallback(v8::Local<v8::Object> receiver, T arg,
@@ -28864,6 +29124,18 @@ TEST(FastApiCalls) {
 
   CheckApiObjectArg();
 
+  // Sequential one-byte strings are passed to the fast callback, all other
+  // values take the slow callback.
+  CheckOneByteStringArg("'abc'", ApiCheckerResult::kFastCalled, "abc");
+  CheckOneByteStringArg("'h\\xe9llo'", ApiCheckerResult::kFastCalled,
+                        "h\xe9llo");
+  CheckOneByteStringArg("'\\u20ac'", ApiCheckerResult::kSlowCalled,
+                        "\xe2\x82\xac");
+  CheckOneByteStringArg("'abcdefghijklmn'.concat('opqrstuvwxyz')",
+                        ApiCheckerResult::kSlowCalled,
+                        "abcdefghijklmnopqrstuvwxyz");
+  CheckOneByteStringArg("42", ApiCheckerResult::kSlowCalled, "42");
+
   // TODO(mslekova): Restructure the tests so that the fast optimized calls
   // are compared against the slow optimized calls.
   // TODO(mslekova): Add tests for FTI that requires access check.
@@ -28890,6 +29162,13 @@ void FastCallback4Scalar(v8::Local<v8::Object> receiver, int arg0, float arg1) {
 
 void FastCallback5DifferentArity(v8::Local<v8::Object> receiver, int arg0,
                                  v8::Local<v8::Array> arg1, float arg2) {}
+
+void FastCallback6OneByteString(v8::Local<v8::Object> receiver, int arg0,
+                                const v8::FastOneByteString& arg1) {}
+
+void FastCallback7Int32TypedArray(v8::Local<v8::Object> receiver, int arg0,
+                                  const v8::FastApiTypedArray<int32_t>& arg1) {
+}
 }  // namespace
 #endif  // V8_LITE_MODE
 
@@ -28971,9 +29250,50 @@ TEST(FastApiOverloadResolution) {
   CHECK_EQ(v8::CFunction::OverloadResolution::kAtCompileTime,
            typed_array_callback.GetOverloadResolution(&diff_arity_callback));
 
+  v8::CFunction string_callback =
+      v8::CFunctionBuilder().Fn(FastCallback6OneByteString).Build();
+
+  // Check that a one-byte string can be resolved against sequences.
+  CHECK_EQ(v8::CFunction::OverloadResolution::kAtRuntime,
+           string_callback.GetOverloadResolution(&js_array_callback));
+  CHECK_EQ(v8::CFunction::OverloadResolution::kAtRuntime,
+           typed_array_callback.GetOverloadResolution(&string_callback));
+
+  v8::CFunction int32_typed_array_callback =
+      v8::CFunctionBuilder().Fn(FastCallback7Int32TypedArray).Build();
+
+  // Check that typed arrays of different element types are not resolved.
+  CHECK_EQ(v8::CFunction::OverloadResolution::kImpossible,
+           typed_array_callback.GetOverloadResolution(
+               &int32_typed_array_callback));
+
 #endif  // V8_LITE_MODE
 }
 
+TEST(FastApiPackedDoubleArrayView) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+
+  v8::FastApiTypedArray<double> view;
+  CHECK(v8::TryToGetPackedDoubleArrayView(
+      CompileRun("[1.5, 2.5, 3.5]").As<v8::Array>(), &view));
+  CHECK_EQ(3u, view.length());
+  CHECK_EQ(1.5, view.get(0));
+  CHECK_EQ(3.5, view.get(2));
+
+  CHECK(v8::TryToGetPackedDoubleArrayView(
+      CompileRun("let a = [1.5]; a.pop(); a").As<v8::Array>(), &view));
+  CHECK_EQ(0u, view.length());
+
+  // Other elements kinds are not viewed.
+  CHECK(!v8::TryToGetPackedDoubleArrayView(
+      CompileRun("[1, 2, 3]").As<v8::Array>(), &view));
+  CHECK(!v8::TryToGetPackedDoubleArrayView(
+      CompileRun("[1.5, , 3.5]").As<v8::Array>(), &view));
+  CHECK(!v8::TryToGetPackedDoubleArrayView(
+      CompileRun("[1.5, {}]").As<v8::Array>(), &view));
+}
+
 THREADED_TEST(Recorder_GetContext) {
   using v8::Context;
   using v8::Local;
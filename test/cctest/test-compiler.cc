@@ -28,6 +28,7 @@
 #include <stdlib.h>
 #include <wchar.h>
 
+#include <algorithm>
 #include <memory>
 
 #include "include/v8-function.h"
@@ -38,6 +39,7 @@
 #include "src/codegen/compilation-cache.h"
 #include "src/codegen/compiler.h"
 #include "src/codegen/script-details.h"
+#include "src/compiler-dispatcher/lazy-compile-dispatcher.h"
 #include "src/diagnostics/disasm.h"
 #include "src/heap/factory.h"
 #include "src/heap/spaces.h"
@@ -441,6 +443,42 @@ TEST(OptimizedCodeSharing1) {
   }
 }
 
+// Test that TurboFan hints reach the other native contexts that share a
+// function's SharedFunctionInfo, while the optimized code itself does not.
+TEST(OptimizationHintsAcrossContexts) {
+  if (!FLAG_opt || FLAG_always_opt || FLAG_turboprop) return;
+  FLAG_stress_compaction = false;
+  FLAG_allow_natives_syntax = true;
+  FLAG_cross_context_optimization_hints = true;
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  const char* source = "function f(x) { return x + 1; }; f";
+
+  Handle<JSFunction> first;
+  {
+    LocalContext env;
+    first = Handle<JSFunction>::cast(v8::Utils::OpenHandle(
+        *v8::Local<v8::Function>::Cast(CompileRun(source))));
+    CompileRun(
+        "%PrepareFunctionForOptimization(f);"
+        "f(1); f(2);"
+        "%OptimizeFunctionOnNextCall(f);"
+        "f(3);");
+  }
+  CHECK(first->HasAttachedOptimizedCode());
+  CHECK(first->shared().has_optimization_hint());
+
+  Handle<JSFunction> second;
+  {
+    LocalContext env;
+    second = Handle<JSFunction>::cast(v8::Utils::OpenHandle(
+        *v8::Local<v8::Function>::Cast(CompileRun(source))));
+  }
+  CHECK_EQ(first->shared(), second->shared());
+  CHECK(second->shared().has_optimization_hint());
+  CHECK(!second->HasAttachedOptimizedCode());
+}
+
 TEST(CompileFunctionInContext) {
   if (i::FLAG_always_opt) return;
   CcTest::InitializeVM();
@@ -1015,5 +1053,81 @@ TEST(ProfilerEnabledDuringBackgroundCompile) {
   cpu_profiler->StopProfiling(profile);
 }
 
+namespace {
+
+struct CompileHints {
+  std::vector<int> positions;
+  int queries = 0;
+};
+
+bool HasCompileHint(int position, void* data) {
+  CompileHints* hints = static_cast<CompileHints*>(data);
+  hints->queries++;
+  return std::find(hints->positions.begin(), hints->positions.end(),
+                   position) != hints->positions.end();
+}
+
+}  // namespace
+
+// Tests that the functions called by a script are reported as compile hints,
+// and that hinted lazy functions are compiled on a background thread when
+// the script is compiled again.
+TEST(CompileHintsRoundTrip) {
+  bool parallel_compile_tasks = FLAG_parallel_compile_tasks;
+  bool lazy_compile_dispatcher = FLAG_lazy_compile_dispatcher;
+  FLAG_parallel_compile_tasks = true;
+  FLAG_lazy_compile_dispatcher = true;
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+  const char* source =
+      "function called() { return 1; }\n"
+      "function uncalled() { return 2; }\n"
+      "called();";
+
+  CompileHints hints;
+  {
+    v8::ScriptCompiler::Source script_source(
+        v8_str(source), v8::ScriptOrigin(isolate, v8_str("first")));
+    v8::Local<v8::Script> script =
+        v8::ScriptCompiler::Compile(context, &script_source,
+                                    v8::ScriptCompiler::kNoCompileOptions,
+                                    v8::ScriptCompiler::kNoCacheNoReason)
+            .ToLocalChecked();
+    script->Run(context).ToLocalChecked();
+    hints.positions = script->GetProducedCompileHints();
+  }
+  CHECK_EQ(1u, hints.positions.size());
+
+  // Compile a different source so that the compilation cache is not hit.
+  std::string second_source = std::string(source) + " ";
+  v8::ScriptCompiler::Source script_source(
+      v8_str(second_source.c_str()),
+      v8::ScriptOrigin(isolate, v8_str("second")), &HasCompileHint, &hints);
+  v8::Local<v8::Script> script =
+      v8::ScriptCompiler::Compile(context, &script_source,
+                                  v8::ScriptCompiler::kNoCompileOptions,
+                                  v8::ScriptCompiler::kNoCacheNoReason)
+          .ToLocalChecked();
+  CHECK_LT(0, hints.queries);
+  script->Run(context).ToLocalChecked();
+
+  i::Isolate* i_isolate = CcTest::i_isolate();
+  i::Handle<i::JSFunction> called = i::Handle<i::JSFunction>::cast(
+      v8::Utils::OpenHandle(*CompileRun("called")));
+  i::Handle<i::JSFunction> uncalled = i::Handle<i::JSFunction>::cast(
+      v8::Utils::OpenHandle(*CompileRun("uncalled")));
+  CHECK(called->shared().is_compiled() ||
+        i_isolate->lazy_compile_dispatcher()->IsEnqueued(
+            handle(called->shared(), i_isolate)));
+  CHECK(!i_isolate->lazy_compile_dispatcher()->IsEnqueued(
+      handle(uncalled->shared(), i_isolate)));
+
+  i_isolate->lazy_compile_dispatcher()->AbortAll();
+  FLAG_parallel_compile_tasks = parallel_compile_tasks;
+  FLAG_lazy_compile_dispatcher = lazy_compile_dispatcher;
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -29,6 +29,8 @@
 
 #include <limits>
 #include <memory>
+#include <set>
+#include <string>
 
 #include "include/libplatform/v8-tracing.h"
 #include "include/v8-fast-api-calls.h"
@@ -3301,6 +3303,55 @@ TEST(MultipleIsolates) {
   thread2.Join();
 }
 
+// Checks that one thread triggers the samples of profilers on several
+// isolates.
+TEST(MultipleIsolatesSharedSampler) {
+  i::FLAG_cpu_profiler_shared_sampler = true;
+  IsolateThread thread1;
+  IsolateThread thread2;
+  CHECK(thread1.Start());
+  CHECK(thread2.Start());
+
+  {
+    LocalContext env;
+    v8::HandleScope scope(env->GetIsolate());
+    CompileRun(R"(
+      function start() {
+        let val = 1;
+        for (let i = 0; i < 10e3; i++) {
+          val = (val * 2) % 3;
+        }
+        return val;
+      }
+    )");
+    v8::Local<v8::Function> function = GetFunction(env.local(), "start");
+    ProfilerHelper helper(env.local());
+    v8::CpuProfile* profile = helper.Run(function, nullptr, 0, 100, 0);
+    CHECK_GT(profile->GetSamplesCount(), 0);
+    profile->Delete();
+  }
+
+  thread1.Join();
+  thread2.Join();
+}
+
+TEST(DroppedSamplesCount) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  ProfilerHelper helper(env.local());
+  v8::CpuProfiler* profiler = helper.profiler();
+  CpuProfiler* iprofiler = reinterpret_cast<CpuProfiler*>(profiler);
+
+  v8::Local<v8::String> title = v8_str("dropped");
+  profiler->StartProfiling(title);
+  SamplingEventsProcessor* processor =
+      reinterpret_cast<SamplingEventsProcessor*>(iprofiler->processor());
+  for (int i = 0; i < 3; i++) processor->AddDroppedSample();
+  v8::CpuProfile* profile = profiler->StopProfiling(title);
+  CHECK_EQ(3u, profile->GetDroppedSamplesCount());
+  profile->Delete();
+}
+
 // Varying called function frame sizes increases the chance of something going
 // wrong if sampling an unlocked frame. We also prevent optimization to prevent
 // inlining so each function call has its own frame.
@@ -4383,6 +4434,115 @@ TEST(SkipEstimatedSizeWhenActiveProfiling) {
   CHECK_GT(code_observer->GetEstimatedMemoryUsage(), 0);
 }
 
+namespace {
+
+// Returns the number of streamed samples whose stack contains the given
+// sequence of callees and callers.
+unsigned CountStreamedStacks(
+    const std::vector<v8::CpuProfileStreamFunction>& functions,
+    const std::vector<v8::CpuProfileStreamStack>& stacks,
+    const std::vector<std::string>& names) {
+  unsigned count = 0;
+  for (const v8::CpuProfileStreamStack& stack : stacks) {
+    for (size_t start = 0; start + names.size() <= stack.frames.size();
+         start++) {
+      bool matches = true;
+      for (size_t i = 0; i < names.size() && matches; i++) {
+        matches = functions[stack.frames[start + i]].name == names[i];
+      }
+      if (matches) {
+        count += stack.count;
+        break;
+      }
+    }
+  }
+  return count;
+}
+
+}  // namespace
+
+TEST(StreamingAggregatesStacks) {
+  i::FLAG_allow_natives_syntax = true;
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+
+  CompileRun(cpu_profiler_test_source);
+  v8::Local<v8::Function> function = GetFunction(env.local(), "start");
+  v8::Local<v8::Value> args[] = {v8::Integer::New(env->GetIsolate(), 20)};
+
+  ProfilerHelper helper(env.local());
+  v8::CpuProfiler* profiler = helper.profiler();
+  CpuProfiler* iprofiler = reinterpret_cast<CpuProfiler*>(profiler);
+  profiler->SetSamplingInterval(50);
+  CHECK_EQ(CpuProfilingStatus::kStarted, profiler->StartStreaming());
+  CHECK_EQ(CpuProfilingStatus::kAlreadyStarted, profiler->StartStreaming());
+  CHECK(iprofiler->is_profiling());
+
+  std::vector<v8::CpuProfileStreamFunction> functions;
+  std::vector<v8::CpuProfileStreamStack> stacks;
+  const std::vector<std::string> kDelayPath = {"loop", "delay", "foo",
+                                               "start"};
+  unsigned total = 0;
+  unsigned delay_samples = 0;
+  while (delay_samples < 50) {
+    function->Call(env.local(), env->Global(), arraysize(args), args)
+        .ToLocalChecked();
+    stacks.clear();
+    profiler->DrainStreamedSamples(&functions, &stacks);
+    delay_samples += CountStreamedStacks(functions, stacks, kDelayPath);
+    for (const v8::CpuProfileStreamStack& stack : stacks) {
+      // Only stacks that were hit are reported.
+      CHECK_GT(stack.count, 0);
+      total += stack.count;
+      for (int frame : stack.frames) {
+        CHECK_LT(frame, static_cast<int>(functions.size()));
+      }
+    }
+  }
+  CHECK_GE(total, delay_samples);
+
+  // Each function is reported once.
+  std::set<std::string> names;
+  for (const v8::CpuProfileStreamFunction& function : functions) {
+    CHECK(names.insert(function.name + function.resource_name +
+                       std::to_string(function.line_number))
+              .second);
+  }
+
+  profiler->StopStreaming();
+  CHECK(!iprofiler->is_profiling());
+  CHECK(!iprofiler->is_streaming());
+}
+
+TEST(StreamingAlongsideProfiles) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  ProfilerHelper helper(env.local());
+  v8::CpuProfiler* profiler = helper.profiler();
+  CpuProfiler* iprofiler = reinterpret_cast<CpuProfiler*>(profiler);
+
+  v8::Local<v8::String> title = v8_str("profile");
+  profiler->StartProfiling(title);
+  profiler->StartStreaming();
+  // The streaming session keeps the processor running without profiles.
+  profiler->StopProfiling(title)->Delete();
+  CHECK(iprofiler->is_profiling());
+  CHECK_NOT_NULL(iprofiler->processor());
+
+  profiler->StartProfiling(title);
+  profiler->StopStreaming();
+  CHECK(iprofiler->is_profiling());
+  profiler->StopProfiling(title)->Delete();
+  CHECK(!iprofiler->is_profiling());
+
+  // Stopping streaming without profiles stops the processor.
+  profiler->StartStreaming();
+  CHECK(iprofiler->is_profiling());
+  profiler->StopStreaming();
+  CHECK(!iprofiler->is_profiling());
+  CHECK_NULL(iprofiler->processor());
+}
+
 }  // namespace test_cpu_profiler
 }  // namespace internal
 }  // namespace v8
@@ -929,3 +929,67 @@ UNINITIALIZED_TEST(DeoptimizeLoadICStoreICNested) {
   isolate->Exit();
   isolate->Dispose();
 }
+
+namespace {
+
+int deopt_callback_count = 0;
+v8::DeoptimizationKind last_deopt_kind;
+int last_deopt_count = 0;
+bool last_deopt_disabled_optimization = false;
+std::string last_deopt_function_name;
+
+void DeoptimizationCallback(v8::Isolate* isolate,
+                            const v8::DeoptimizationInfo& info) {
+  deopt_callback_count++;
+  CHECK_NOT_NULL(info.reason);
+  last_deopt_kind = info.kind;
+  last_deopt_count = info.deopt_count;
+  last_deopt_disabled_optimization = info.optimization_disabled;
+  v8::String::Utf8Value name(isolate, info.function->GetName());
+  last_deopt_function_name = *name;
+}
+
+}  // namespace
+
+TEST(DeoptimizationCallbackAndLoopDetection) {
+  if (i::FLAG_always_opt || !i::FLAG_opt) return;
+  i::FLAG_allow_natives_syntax = true;
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  isolate->SetDeoptimizationCallback(DeoptimizationCallback);
+
+  CompileRun(
+      "function load(o) { return o.a; };"
+      "%PrepareFunctionForOptimization(load);"
+      "load({a: 1}); load({a: 2});"
+      "%OptimizeFunctionOnNextCall(load);"
+      "load({a: 3});"
+      "load({b: 1, a: 2});");
+  CHECK_EQ(1, deopt_callback_count);
+  CHECK(last_deopt_kind == v8::DeoptimizationKind::kEager);
+  CHECK_EQ(1, last_deopt_count);
+  CHECK(!last_deopt_disabled_optimization);
+  CHECK_EQ(0, strcmp("load", last_deopt_function_name.c_str()));
+
+  bool deopt_loop_detection = i::FLAG_deopt_loop_detection;
+  int max_deopt_count = i::FLAG_max_deopt_count;
+  i::FLAG_deopt_loop_detection = true;
+  i::FLAG_max_deopt_count = 2;
+  CompileRun(
+      "%PrepareFunctionForOptimization(load);"
+      "load({b: 1, a: 2});"
+      "%OptimizeFunctionOnNextCall(load);"
+      "load({b: 1, a: 2});"
+      "load({c: 1, a: 2});");
+  CHECK_EQ(2, deopt_callback_count);
+  CHECK_EQ(2, last_deopt_count);
+  CHECK(last_deopt_disabled_optimization);
+  Handle<JSFunction> load = GetJSFunction(env.local(), "load");
+  CHECK_EQ(i::BailoutReason::kDeoptimizedTooOften,
+           load->shared().disable_optimization_reason());
+  i::FLAG_deopt_loop_detection = deopt_loop_detection;
+  i::FLAG_max_deopt_count = max_deopt_count;
+
+  isolate->SetDeoptimizationCallback(nullptr);
+}
@@ -4090,6 +4090,55 @@ TEST(SamplingHeapProfilerSampleDuringDeopt) {
   heap_profiler->StopSamplingHeapProfiler();
 }
 
+namespace {
+
+size_t CountSamples(v8::HeapProfiler* heap_profiler) {
+  std::unique_ptr<v8::AllocationProfile> profile(
+      heap_profiler->GetAllocationProfile());
+  CHECK(profile);
+  return profile->GetSamples().size();
+}
+
+}  // namespace
+
+TEST(SamplingHeapProfilerDiscardsDeadSamples) {
+  if (i::FLAG_single_generation) return;
+  v8::HandleScope scope(CcTest::isolate());
+  LocalContext env;
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+
+  // Suppress randomness to avoid flakiness in tests.
+  v8::internal::FLAG_sampling_heap_profiler_suppress_randomness = true;
+
+  heap_profiler->StartSamplingHeapProfiler(64);
+  CompileRun(
+      "var live = [];\n"
+      "for (var i = 0; i < 1024; i++) {\n"
+      "  live.push({a: i});\n"
+      "  var dead = {b: i};\n"
+      "}\n");
+  size_t samples = CountSamples(heap_profiler);
+  CHECK_LT(0, samples);
+
+  // Samples of objects that die young are dropped by the scavenger.
+  CcTest::CollectGarbage(v8::internal::NEW_SPACE);
+  size_t young_samples = CountSamples(heap_profiler);
+  CHECK_LT(young_samples, samples);
+  CHECK_LT(0, young_samples);
+
+  // Promoted samples are tracked until a full GC finds them dead.
+  CcTest::CollectGarbage(v8::internal::NEW_SPACE);
+  CcTest::CollectAllGarbage();
+  size_t live_samples = CountSamples(heap_profiler);
+  CHECK_LE(live_samples, young_samples);
+  CHECK_LT(0, live_samples);
+  CompileRun("live = null;");
+  CcTest::CollectAllGarbage();
+  CHECK_LT(CountSamples(heap_profiler), live_samples);
+
+  heap_profiler->StopSamplingHeapProfiler();
+}
+
 TEST(WeakReference) {
   v8::Isolate* isolate = CcTest::isolate();
   i::Isolate* i_isolate = CcTest::i_isolate();
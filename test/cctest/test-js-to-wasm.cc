@@ -94,6 +94,12 @@ DECLARE_EXPORTED_FUNCTION(void_square, sigs.v_i(),
                           WASM_CODE({WASM_LOCAL_GET(0), WASM_LOCAL_GET(0),
                                      kExprI32Mul, kExprDrop}))
 
+DECLARE_EXPORTED_FUNCTION(externref_identity, sigs.e_e(),
+                          WASM_CODE({WASM_LOCAL_GET(0)}))
+
+DECLARE_EXPORTED_FUNCTION(externref_is_null, sigs.i_e(),
+                          WASM_CODE({WASM_REF_IS_NULL(WASM_LOCAL_GET(0))}))
+
 DECLARE_EXPORTED_FUNCTION(add, sigs.i_ii(),
                           WASM_CODE({WASM_LOCAL_GET(0), WASM_LOCAL_GET(1),
                                      kExprI32Add}))
@@ -344,6 +350,19 @@ class FastJSWasmCallTester {
     CHECK_EQ(result->Int64Value(), expected_result->Int64Value());
   }
 
+  // Executes a test function that returns a JS value, which must be strictly
+  // equal to {expected_result}.
+  void CallAndCheckWasmFunctionRef(
+      const std::string& exported_function_name,
+      const std::vector<v8::Local<v8::Value>>& args,
+      const v8::Local<v8::Value> expected_result) {
+    LocalContext env;
+    v8::Local<v8::Value> result_value =
+        DoCallAndCheckWasmFunction(env, exported_function_name, args);
+
+    CHECK(result_value->StrictEquals(expected_result));
+  }
+
   // Executes a test function that returns void.
   void CallAndCheckWasmFunction(const std::string& exported_function_name,
                                 const std::vector<v8::Local<v8::Value>>& args,
@@ -807,6 +826,27 @@ TEST(TestFastJSWasmCall_I64NegativeResult) {
       "i64_add", {v8_bigint(1ll), v8_bigint(-2ll)}, v8_bigint(-1ll));
 }
 
+TEST(TestFastJSWasmCall_ExternRefArg) {
+  v8::HandleScope scope(CcTest::isolate());
+  FastJSWasmCallTester tester;
+  tester.AddExportedFunction(k_externref_identity);
+  tester.CallAndCheckWasmFunctionRef("externref_identity", {v8_str("foo")},
+                                     v8_str("foo"));
+  tester.CallAndCheckWasmFunctionRef("externref_identity",
+                                     {v8::Null(CcTest::isolate())},
+                                     v8::Null(CcTest::isolate()));
+}
+
+TEST(TestFastJSWasmCall_ExternRefIsNull) {
+  v8::HandleScope scope(CcTest::isolate());
+  FastJSWasmCallTester tester;
+  tester.AddExportedFunction(k_externref_is_null);
+  tester.CallAndCheckWasmFunction<int32_t>("externref_is_null",
+                                           {v8::Null(CcTest::isolate())}, 1);
+  tester.CallAndCheckWasmFunction<int32_t>("externref_is_null", {v8_num(42)},
+                                           0);
+}
+
 TEST(TestFastJSWasmCall_MultipleArgs) {
   v8::HandleScope scope(CcTest::isolate());
   FastJSWasmCallTester tester;
@@ -163,8 +163,8 @@ TEST(EnumCache) {
     CHECK_EQ(enum_cache.indices().length(), 3);
   }
 
-  // Initializing the EnumCache for the the topmost map {a} will not create the
-  // cache for the other maps.
+  // Initializing the EnumCache for the the topmost map {a} covers the whole
+  // shared DescriptorArray, but only sets the EnumLength of {a}.
   CompileRun("var s = 0; for (let key in a) { s += a[key] };");
   {
     CHECK_EQ(a->map().EnumLength(), 1);
@@ -183,12 +183,12 @@ TEST(EnumCache) {
     CHECK_EQ(b->map().instance_descriptors().enum_cache(), enum_cache);
     CHECK_EQ(c->map().instance_descriptors().enum_cache(), enum_cache);
 
-    CHECK_EQ(enum_cache.keys().length(), 1);
-    CHECK_EQ(enum_cache.indices().length(), 1);
+    CHECK_EQ(enum_cache.keys().length(), 3);
+    CHECK_EQ(enum_cache.indices().length(), 3);
   }
 
-  // Creating the EnumCache for {c} will create a new EnumCache on the shared
-  // DescriptorArray.
+  // {c} finds its keys as a prefix of the existing EnumCache, hence we only
+  // need to set the correct EnumLength on the map.
   Handle<EnumCache> previous_enum_cache(
       a->map().instance_descriptors().enum_cache(), a->GetIsolate());
   Handle<FixedArray> previous_keys(previous_enum_cache->keys(),
@@ -204,12 +204,10 @@ TEST(EnumCache) {
 
     EnumCache enum_cache = c->map().instance_descriptors().enum_cache();
     CHECK_NE(enum_cache, *factory->empty_enum_cache());
-    // The keys and indices caches are updated.
+    // The keys and indices caches are not updated.
     CHECK_EQ(enum_cache, *previous_enum_cache);
-    CHECK_NE(enum_cache.keys(), *previous_keys);
-    CHECK_NE(enum_cache.indices(), *previous_indices);
-    CHECK_EQ(previous_keys->length(), 1);
-    CHECK_EQ(previous_indices->length(), 1);
+    CHECK_EQ(enum_cache.keys(), *previous_keys);
+    CHECK_EQ(enum_cache.indices(), *previous_indices);
     CHECK_EQ(enum_cache.keys().length(), 3);
     CHECK_EQ(enum_cache.indices().length(), 3);
 
@@ -0,0 +1,121 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/base/numbers/schubfach-dtoa.h"
+
+#include "src/base/numbers/bignum-dtoa.h"
+#include "src/base/numbers/double.h"
+#include "src/base/numbers/dtoa.h"
+#include "src/base/numbers/strtod.h"
+#include "src/base/utils/random-number-generator.h"
+#include "test/cctest/cctest.h"
+#include "test/cctest/gay-shortest.h"
+
+namespace v8 {
+namespace base {
+namespace test_schubfach_dtoa {
+
+static const int kBufferSize = kBase10MaximalLength + 1;
+
+static void CheckShortest(double v, const char* expected, int expected_point) {
+  char buffer_container[kBufferSize];
+  Vector<char> buffer(buffer_container, kBufferSize);
+  int length;
+  int point;
+  SchubfachDtoa(v, buffer, &length, &point);
+  CHECK_EQ(0, strcmp(expected, buffer.begin()));
+  CHECK_EQ(static_cast<int>(strlen(expected)), length);
+  CHECK_EQ(expected_point, point);
+}
+
+// Compares against the bignum-based implementation, which is slow but
+// exact, and checks that the digits read back as {v}.
+static void CheckAgainstBignumDtoa(double v) {
+  if (!(v > 0) || Double(v).IsSpecial()) return;
+  char buffer_container[kBufferSize];
+  Vector<char> buffer(buffer_container, kBufferSize);
+  int length;
+  int point;
+  SchubfachDtoa(v, buffer, &length, &point);
+  char expected_container[kBufferSize];
+  Vector<char> expected(expected_container, kBufferSize);
+  int expected_length;
+  int expected_point;
+  BignumDtoa(v, BIGNUM_DTOA_SHORTEST, 0, expected, &expected_length,
+             &expected_point);
+  CHECK_EQ(0, strcmp(expected.begin(), buffer.begin()));
+  CHECK_EQ(expected_length, length);
+  CHECK_EQ(expected_point, point);
+  CHECK_EQ(v, Strtod(Vector<const char>(buffer.begin(), length),
+                     point - length));
+}
+
+TEST(SchubfachDtoaVariousDoubles) {
+  CheckShortest(5e-324, "5", -323);
+  CheckShortest(1.7976931348623157e308, "17976931348623157", 309);
+  CheckShortest(4294967272.0, "4294967272", 10);
+  CheckShortest(4.1855804968213567e298, "4185580496821357", 299);
+  CheckShortest(5.5626846462680035e-309, "5562684646268003", -308);
+  CheckShortest(2147483648.0, "2147483648", 10);
+  CheckShortest(3.5844466002796428e+298, "35844466002796428", 299);
+  CheckShortest(Double(uint64_t{0x0010'0000'0000'0000}).value(),
+                "22250738585072014", -307);
+  CheckShortest(Double(uint64_t{0x000F'FFFF'FFFF'FFFF}).value(),
+                "2225073858507201", -307);
+  CheckShortest(1.0, "1", 1);
+  CheckShortest(0.1, "1", 0);
+  CheckShortest(100.0, "1", 3);
+  CheckShortest(1e23, "1", 24);
+  CheckShortest(9007199254740992.0, "9007199254740992", 16);
+  CheckShortest(0.3, "3", 0);
+  CheckShortest(0.1 + 0.2, "30000000000000004", 0);
+}
+
+TEST(SchubfachDtoaGayShortest) {
+  char buffer_container[kBufferSize];
+  Vector<char> buffer(buffer_container, kBufferSize);
+  int length;
+  int point;
+  bool needed_max_length = false;
+
+  Vector<const PrecomputedShortest> precomputed =
+      PrecomputedShortestRepresentations();
+  for (int i = 0; i < precomputed.length(); ++i) {
+    const PrecomputedShortest current_test = precomputed[i];
+    SchubfachDtoa(current_test.v, buffer, &length, &point);
+    CHECK_GE(kBase10MaximalLength, length);
+    if (length == kBase10MaximalLength) needed_max_length = true;
+    CHECK_EQ(current_test.decimal_point, point);
+    CHECK_EQ(0, strcmp(current_test.representation, buffer.begin()));
+  }
+  CHECK(needed_max_length);
+}
+
+TEST(SchubfachDtoaMatchesBignumDtoa) {
+  // Powers of two and their neighbors stress the asymmetric rounding
+  // intervals and the boundaries of each binade.
+  for (uint64_t exponent = 0; exponent < 0x7FF; exponent++) {
+    uint64_t power = exponent << Double::kPhysicalSignificandSize;
+    for (uint64_t delta = 0; delta < 4; delta++) {
+      CheckAgainstBignumDtoa(Double(power + delta).value());
+      CheckAgainstBignumDtoa(Double(power - delta).value());
+    }
+  }
+  // Small integers and decimal fractions.
+  for (int i = 1; i < 10000; i++) {
+    CheckAgainstBignumDtoa(i);
+    CheckAgainstBignumDtoa(i / 1000.0);
+    CheckAgainstBignumDtoa(Double(static_cast<uint64_t>(i)).value());
+  }
+  // Random bit patterns.
+  RandomNumberGenerator rng(123);
+  for (int i = 0; i < 100000; i++) {
+    uint64_t bits = static_cast<uint64_t>(rng.NextInt64()) & ~Double::kSignMask;
+    CheckAgainstBignumDtoa(Double(bits).value());
+  }
+}
+
+}  // namespace test_schubfach_dtoa
+}  // namespace base
+}  // namespace v8
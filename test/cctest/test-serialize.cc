@@ -459,6 +459,18 @@ UNINITIALIZED_TEST(SnapshotCompression) {
       i::SnapshotCompression::Decompress(compressed.RawData());
   CHECK_EQ(context_blob, decompressed.RawData());
 
+  // All compression levels produce data that decompresses the same way.
+  for (int level : {0, 1, 9}) {
+    SnapshotData compressed_at_level =
+        i::SnapshotCompression::Compress(&original_snapshot_data, level);
+    SnapshotData decompressed_at_level =
+        i::SnapshotCompression::Decompress(compressed_at_level.RawData());
+    CHECK_EQ(context_blob, decompressed_at_level.RawData());
+    if (level == 0) {
+      CHECK_GE(compressed_at_level.RawData().size(), context_blob.size());
+    }
+  }
+
   startup_blob.Dispose();
   read_only_blob.Dispose();
   shared_space_blob.Dispose();
@@ -2588,6 +2600,237 @@ TEST(CodeSerializerIsolates) {
   isolate2->Dispose();
 }
 
+#if ENABLE_SPARKPLUG
+TEST(CodeSerializerBaselineCodeHints) {
+  if (!FLAG_sparkplug) return;
+  FLAG_allow_natives_syntax = true;
+  FLAG_sparkplug_code_cache_hints = true;
+  const char* source =
+      "function f() { return 'abc'; }; f(); %CompileBaseline(f); f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache =
+      CompileRunAndProduceCache(source, CodeCacheType::kAfterExecute);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(source);
+    v8::ScriptOrigin origin(isolate2, v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+
+    // The inner function comes out of the cache with baseline code already.
+    Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate2);
+    Handle<SharedFunctionInfo> toplevel = v8::Utils::OpenHandle(*script);
+    SharedFunctionInfo::ScriptIterator iter(
+        i_isolate, Script::cast(toplevel->script()));
+    int baseline_functions = 0;
+    for (SharedFunctionInfo info = iter.Next(); !info.is_null();
+         info = iter.Next()) {
+      CHECK(!info.has_baseline_code_hint());
+      if (info.HasBaselineCode()) baseline_functions++;
+    }
+    CHECK_EQ(1, baseline_functions);
+  }
+  isolate2->Dispose();
+}
+#endif  // ENABLE_SPARKPLUG
+
+TEST(PreparseDataCache) {
+  LocalContext context;
+  Isolate* isolate = CcTest::i_isolate();
+  v8::HandleScope scope(CcTest::isolate());
+  const char* source =
+      "function f() { function g() { return 1; } return g() + 1; }; f";
+  v8::ScriptCompiler::Source script_source(v8_str(source));
+  v8::Local<v8::UnboundScript> script =
+      v8::ScriptCompiler::CompileUnboundScript(CcTest::isolate(),
+                                               &script_source)
+          .ToLocalChecked();
+
+  Handle<SharedFunctionInfo> toplevel = v8::Utils::OpenHandle(*script);
+  Handle<SharedFunctionInfo> f;
+  {
+    SharedFunctionInfo::ScriptIterator iter(isolate,
+                                            Script::cast(toplevel->script()));
+    for (SharedFunctionInfo info = iter.Next(); !info.is_null();
+         info = iter.Next()) {
+      if (info.HasUncompiledDataWithPreparseData()) f = handle(info, isolate);
+    }
+  }
+  CHECK(!f.is_null());
+
+  std::unique_ptr<v8::ScriptCompiler::CachedData> cache(
+      v8::ScriptCompiler::CreatePreparseDataCache(script));
+  f->ClearPreparseData();
+  CHECK(f->HasUncompiledDataWithoutPreparseData());
+
+  // A cache for a different source is rejected.
+  {
+    std::vector<uint8_t> copy(cache->data, cache->data + cache->length);
+    v8::ScriptCompiler::CachedData other(copy.data(),
+                                         static_cast<int>(copy.size()));
+    v8::ScriptCompiler::Source other_source(v8_str("function f() {}"));
+    v8::Local<v8::UnboundScript> other_script =
+        v8::ScriptCompiler::CompileUnboundScript(CcTest::isolate(),
+                                                 &other_source)
+            .ToLocalChecked();
+    CHECK(!v8::ScriptCompiler::ConsumePreparseDataCache(other_script, &other));
+    CHECK(other.rejected);
+  }
+
+  CHECK(v8::ScriptCompiler::ConsumePreparseDataCache(script, cache.get()));
+  CHECK(!cache->rejected);
+  CHECK(f->HasUncompiledDataWithPreparseData());
+
+  v8::Local<v8::Value> result = script->BindToCurrentContext()
+                                    ->Run(context.local())
+                                    .ToLocalChecked();
+  CHECK_EQ(2, CompileRun("f()")->Int32Value(context.local()).FromJust());
+  CHECK(result->IsFunction());
+}
+
+namespace {
+
+const char* kDeltaSource =
+    "function a() { return 1; }\n"
+    "function b() { return 2; }\n"
+    "function c() { function d() { return 3; } return d(); }";
+
+// Runs kDeltaSource and |call| in a new isolate and returns the code cache
+// created afterwards.
+v8::ScriptCompiler::CachedData* ProduceCacheAfterCalling(const char* call) {
+  v8::ScriptCompiler::CachedData* cache;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate1 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate1);
+    v8::HandleScope scope(isolate1);
+    v8::Local<v8::Context> context = v8::Context::New(isolate1);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptCompiler::Source source(v8_str(kDeltaSource),
+                                      v8::ScriptOrigin(isolate1, v8_str("d")));
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(isolate1, &source)
+            .ToLocalChecked();
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    CompileRun(call);
+    cache = v8::ScriptCompiler::CreateCodeCache(script);
+    CHECK(cache);
+  }
+  isolate1->Dispose();
+  return cache;
+}
+
+// Returns the names of the compiled inner functions of |script|, in source
+// order.
+std::string CompiledFunctionNames(v8::Local<v8::UnboundScript> script) {
+  Handle<SharedFunctionInfo> toplevel = v8::Utils::OpenHandle(*script);
+  Isolate* isolate = toplevel->GetIsolate();
+  std::string names;
+  SharedFunctionInfo::ScriptIterator iter(isolate,
+                                          Script::cast(toplevel->script()));
+  for (SharedFunctionInfo info = iter.Next(); !info.is_null();
+       info = iter.Next()) {
+    if (info.is_toplevel() || !info.is_compiled()) continue;
+    names += info.Name().ToCString().get();
+  }
+  return names;
+}
+
+v8::Local<v8::UnboundScript> CompileDeltaSource(
+    v8::Isolate* isolate, v8::ScriptCompiler::CachedData* cache) {
+  // The Source owns its CachedData, so give it one that does not own |cache|'s
+  // buffer.
+  v8::ScriptCompiler::Source source(
+      v8_str(kDeltaSource), v8::ScriptOrigin(isolate, v8_str("d")),
+      new v8::ScriptCompiler::CachedData(cache->data, cache->length));
+  v8::Local<v8::UnboundScript> script =
+      v8::ScriptCompiler::CompileUnboundScript(
+          isolate, &source, v8::ScriptCompiler::kConsumeCodeCache)
+          .ToLocalChecked();
+  CHECK(!source.GetCachedData()->rejected);
+  return script;
+}
+
+}  // namespace
+
+TEST(CodeCacheMergeAndDelta) {
+  std::unique_ptr<v8::ScriptCompiler::CachedData> cache_a(
+      ProduceCacheAfterCalling("a()"));
+  std::unique_ptr<v8::ScriptCompiler::CachedData> cache_c(
+      ProduceCacheAfterCalling("c()"));
+  std::unique_ptr<v8::ScriptCompiler::CachedData> delta;
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::UnboundScript> script =
+        CompileDeltaSource(isolate2, cache_a.get());
+    CHECK(CompiledFunctionNames(script) == "a");
+
+    // Merging a cache of another run adds its functions.
+    CHECK(v8::ScriptCompiler::MergeCodeCache(script, cache_c.get()));
+    CHECK(CompiledFunctionNames(script) == "acd");
+
+    // The delta to the cache the script was loaded from lists the rest.
+    delta.reset(v8::ScriptCompiler::CreateCodeCacheDelta(script,
+                                                         cache_a.get()));
+    CHECK(delta);
+
+    // A delta for a different source is rejected.
+    v8::ScriptCompiler::Source other_source(v8_str("function f() {}"));
+    v8::Local<v8::UnboundScript> other_script =
+        v8::ScriptCompiler::CompileUnboundScript(isolate2, &other_source)
+            .ToLocalChecked();
+    std::vector<uint8_t> copy(delta->data, delta->data + delta->length);
+    v8::ScriptCompiler::CachedData other(copy.data(),
+                                         static_cast<int>(copy.size()));
+    CHECK(!v8::ScriptCompiler::ConsumeCodeCacheDelta(other_script, &other));
+    CHECK(other.rejected);
+  }
+  isolate2->Dispose();
+
+  v8::Isolate* isolate3 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate3);
+    v8::HandleScope scope(isolate3);
+    v8::Local<v8::Context> context = v8::Context::New(isolate3);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::UnboundScript> script =
+        CompileDeltaSource(isolate3, cache_a.get());
+    CHECK(v8::ScriptCompiler::ConsumeCodeCacheDelta(script, delta.get()));
+    CHECK(!delta->rejected);
+    CHECK(CompiledFunctionNames(script) == "acd");
+
+    // The updated code cache covers the functions of both runs.
+    std::unique_ptr<v8::ScriptCompiler::CachedData> merged(
+        v8::ScriptCompiler::CreateCodeCache(script));
+    CHECK_GT(merged->length, cache_a->length);
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    CHECK_EQ(6, CompileRun("a() + b() + c()")->Int32Value(context).FromJust());
+  }
+  isolate3->Dispose();
+}
+
 TEST(CodeSerializerIsolatesEager) {
   const char* source =
       "function f() {"
@@ -3252,6 +3495,111 @@ UNINITIALIZED_TEST(SnapshotCreatorArrayJoinWithKeep) {
   FreeCurrentEmbeddedBlob();
 }
 
+v8::StartupData CreateCustomSnapshotWithWarmAndColdCode() {
+  v8::SnapshotCreator creator;
+  v8::Isolate* isolate = creator.GetIsolate();
+  {
+    v8::HandleScope handle_scope(isolate);
+    {
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      CompileRun(
+          "function warm() { return 'w'; }\n"
+          "var cold = (function() { return 'c'; });\n");
+      ExpectString("warm()", "w");
+      creator.SetDefaultContext(context);
+    }
+  }
+  return creator.CreateBlob(v8::SnapshotCreator::FunctionCodeHandling::kKeep);
+}
+
+UNINITIALIZED_TEST(SnapshotCreatorKeepOnlyWarmCode) {
+  DisableAlwaysOpt();
+  DisableEmbeddedBlobRefcounting();
+  FLAG_lazy_feedback_allocation = false;
+  FLAG_flush_bytecode = false;
+  FLAG_snapshot_keep_only_warm_code = true;
+  v8::StartupData blob = CreateCustomSnapshotWithWarmAndColdCode();
+
+  {
+    v8::Isolate::CreateParams params;
+    params.snapshot_blob = &blob;
+    params.array_buffer_allocator = CcTest::array_buffer_allocator();
+    // Test-appropriate equivalent of v8::Isolate::New.
+    v8::Isolate* isolate = TestSerializer::NewIsolate(params);
+    {
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      Handle<JSFunction> warm = Handle<JSFunction>::cast(
+          v8::Utils::OpenHandle(*CompileRun("warm")));
+      Handle<JSFunction> cold = Handle<JSFunction>::cast(
+          v8::Utils::OpenHandle(*CompileRun("cold")));
+      CHECK(warm->shared().is_compiled());
+      CHECK(!cold->shared().is_compiled());
+      ExpectString("warm()", "w");
+      ExpectString("cold()", "c");
+    }
+    isolate->Dispose();
+  }
+  delete[] blob.data;
+  FreeCurrentEmbeddedBlob();
+}
+
+UNINITIALIZED_TEST(SnapshotCreatorCacheSnapshotBlobs) {
+  DisableAlwaysOpt();
+  DisableEmbeddedBlobRefcounting();
+  FLAG_cache_snapshot_blobs = true;
+  v8::StartupData blob = CreateCustomSnapshotWithWarmAndColdCode();
+
+  // The second isolate reuses the checksum result and the decompressed
+  // sections of the first one.
+  for (int i = 0; i < 2; i++) {
+    v8::Isolate::CreateParams params;
+    params.snapshot_blob = &blob;
+    params.array_buffer_allocator = CcTest::array_buffer_allocator();
+    // Test-appropriate equivalent of v8::Isolate::New.
+    v8::Isolate* isolate = TestSerializer::NewIsolate(params);
+    {
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      ExpectString("warm()", "w");
+      ExpectString("cold()", "c");
+    }
+    isolate->Dispose();
+  }
+  delete[] blob.data;
+  FreeCurrentEmbeddedBlob();
+}
+
+UNINITIALIZED_TEST(SnapshotCreatorParallelSnapshotDecompression) {
+  DisableAlwaysOpt();
+  DisableEmbeddedBlobRefcounting();
+  FLAG_parallel_snapshot_decompression = true;
+  v8::StartupData blob = CreateCustomSnapshotWithWarmAndColdCode();
+
+  {
+    v8::Isolate::CreateParams params;
+    params.snapshot_blob = &blob;
+    params.array_buffer_allocator = CcTest::array_buffer_allocator();
+    // Test-appropriate equivalent of v8::Isolate::New.
+    v8::Isolate* isolate = TestSerializer::NewIsolate(params);
+    {
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      ExpectString("warm()", "w");
+    }
+    isolate->Dispose();
+  }
+  delete[] blob.data;
+  FreeCurrentEmbeddedBlob();
+}
+
 v8::StartupData CreateCustomSnapshotWithDuplicateFunctions() {
   v8::SnapshotCreator creator;
   v8::Isolate* isolate = creator.GetIsolate();
@@ -109,6 +109,58 @@ UNINITIALIZED_TEST(InPlaceInternalizableStringsAreShared) {
   CHECK(two_byte_intern->InSharedHeap());
 }
 
+class OneByteResource : public v8::String::ExternalOneByteStringResource {
+ public:
+  explicit OneByteResource(const char* data)
+      : data_(data), length_(strlen(data)) {}
+
+  ~OneByteResource() override { i::DeleteArray(data_); }
+
+  const char* data() const override { return data_; }
+
+  size_t length() const override { return length_; }
+
+ private:
+  const char* data_;
+  size_t length_;
+};
+
+UNINITIALIZED_TEST(ExternalStringsAreCopiedWhenInternalized) {
+  if (!ReadOnlyHeap::IsReadOnlySpaceShared()) return;
+  if (!COMPRESS_POINTERS_IN_SHARED_CAGE_BOOL) return;
+
+  FLAG_shared_string_table = true;
+
+  MultiClientIsolateTest test;
+  v8::Isolate* isolate1 = test.NewClientIsolate();
+  v8::Isolate* isolate2 = test.NewClientIsolate();
+  Isolate* i_isolate1 = reinterpret_cast<Isolate*>(isolate1);
+  Factory* factory1 = i_isolate1->factory();
+  Isolate* i_isolate2 = reinterpret_cast<Isolate*>(isolate2);
+  Factory* factory2 = i_isolate2->factory();
+
+  HandleScope scope1(i_isolate1);
+  HandleScope scope2(i_isolate2);
+
+  Handle<String> external1 =
+      factory1->NewExternalStringFromOneByte(new OneByteResource(StrDup("foo")))
+          .ToHandleChecked();
+  Handle<String> external2 =
+      factory2->NewExternalStringFromOneByte(new OneByteResource(StrDup("foo")))
+          .ToHandleChecked();
+  CHECK(!external1->InSharedHeap());
+  CHECK(!external2->InSharedHeap());
+
+  // External strings are owned by their isolate and are never internalized in
+  // place. The shared table holds a copy that is used by all isolates.
+  Handle<String> intern1 = factory1->InternalizeString(external1);
+  Handle<String> intern2 = factory2->InternalizeString(external2);
+  CHECK(intern1->InSharedHeap());
+  CHECK(!intern1->IsExternalString());
+  CHECK(!external1->IsInternalizedString());
+  CHECK_EQ(*intern1, *intern2);
+}
+
 UNINITIALIZED_TEST(InPlaceInternalization) {
   if (!ReadOnlyHeap::IsReadOnlySpaceShared()) return;
   if (!COMPRESS_POINTERS_IN_SHARED_CAGE_BOOL) return;
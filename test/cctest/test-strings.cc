@@ -921,6 +921,50 @@ TEST(Utf8Conversion) {
   }
 }
 
+TEST(Utf8ConversionAsciiRuns) {
+  // Runs of ASCII characters between non-ASCII ones are copied in bulk.
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope handle_scope(isolate);
+  std::string latin1;
+  std::string utf8;
+  for (int i = 0; i < 40; i++) {
+    std::string run(i, static_cast<char>('a' + i % 26));
+    latin1 += run + "\xE9";
+    utf8 += run + "\xC3\xA9";
+  }
+  v8::Local<v8::String> one_byte =
+      v8::String::NewFromOneByte(
+          isolate, reinterpret_cast<const uint8_t*>(latin1.data()),
+          v8::NewStringType::kNormal, static_cast<int>(latin1.length()))
+          .ToLocalChecked();
+  std::vector<char> buffer(utf8.length());
+  int chars_written;
+  int written = one_byte->WriteUtf8(isolate, buffer.data(),
+                                    static_cast<int>(buffer.size()),
+                                    &chars_written,
+                                    v8::String::NO_NULL_TERMINATION);
+  CHECK_EQ(utf8.length(), written);
+  CHECK_EQ(latin1.length(), chars_written);
+  CHECK_EQ(0, memcmp(utf8.data(), buffer.data(), utf8.length()));
+
+  // Decoding gives back the same string, in both encodings.
+  v8::Local<v8::String> decoded =
+      v8::String::NewFromUtf8(isolate, utf8.data(), v8::NewStringType::kNormal,
+                              static_cast<int>(utf8.length()))
+          .ToLocalChecked();
+  CHECK(decoded->IsOneByte());
+  CHECK(decoded->StrictEquals(one_byte));
+  std::string utf8_two_byte = utf8 + "\xE2\x98\x83" + utf8;
+  decoded = v8::String::NewFromUtf8(isolate, utf8_two_byte.data(),
+                                    v8::NewStringType::kNormal,
+                                    static_cast<int>(utf8_two_byte.length()))
+                .ToLocalChecked();
+  CHECK(!decoded->IsOneByte());
+  CHECK_EQ(2 * latin1.length() + 1, decoded->Length());
+  CHECK_EQ(utf8_two_byte.length(), decoded->Utf8Length(isolate));
+}
+
 TEST(Utf8ConversionPerf) {
   // Smoke test for converting strings to utf-8.
   LocalContext context;
@@ -1479,6 +1523,41 @@ TEST(SliceFromSlice) {
   CHECK_EQ(0, strcmp("cdefghijklmnopqrstuvwx", string->ToCString().get()));
 }
 
+TEST(ScavengeCopiesSmallSlices) {
+  if (!FLAG_string_slices || !FLAG_scavenge_copy_small_slices ||
+      FLAG_single_generation) {
+    return;
+  }
+#ifdef ENABLE_MINOR_MC
+  if (FLAG_minor_mc) return;
+#endif  // ENABLE_MINOR_MC
+  FLAG_stress_incremental_marking = false;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  HandleScope scope(isolate);
+
+  const int kParentLength = 16 * KB;
+  Handle<SeqOneByteString> parent =
+      factory->NewRawOneByteString(kParentLength).ToHandleChecked();
+  {
+    DisallowGarbageCollection no_gc;
+    uint8_t* chars = parent->GetChars(no_gc);
+    for (int i = 0; i < kParentLength; i++) chars[i] = 'a' + i % 26;
+  }
+  // A short slice of a long parent is copied, a long slice is kept.
+  Handle<String> short_slice = factory->NewSubString(parent, 1, 21);
+  Handle<String> long_slice =
+      factory->NewSubString(parent, 0, kParentLength / 2);
+  CHECK(short_slice->IsSlicedString());
+  CHECK(long_slice->IsSlicedString());
+
+  CcTest::CollectGarbage(NEW_SPACE);
+  CHECK(short_slice->IsSeqOneByteString());
+  CHECK_EQ(0, strcmp("bcdefghijklmnopqrstu", short_slice->ToCString().get()));
+  CHECK(long_slice->IsSlicedString());
+}
+
 UNINITIALIZED_TEST(OneByteArrayJoin) {
   v8::Isolate::CreateParams create_params;
   // Set heap limits.
@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include "src/base/utils/random-number-generator.h"
 #include "src/objects/swiss-name-dictionary-inl.h"
 #include "test/cctest/cctest.h"
 #include "test/cctest/test-swiss-name-dictionary-infra.h"
@@ -218,6 +219,65 @@ TEST(SizeFor) {
   CHECK_EQ(SwissNameDictionary::SizeFor(8), size_8);
 }
 
+TEST(GroupSse2Polyfill) {
+  using swiss_table::ctrl_t;
+  using swiss_table::GroupSse2Polyfill;
+  using swiss_table::h2_t;
+  constexpr int kWidth = GroupSse2Polyfill::kWidth;
+  const ctrl_t kSpecial[] = {swiss_table::kEmpty, swiss_table::kDeleted,
+                             swiss_table::kSentinel};
+
+  base::RandomNumberGenerator rng(42);
+  for (int iteration = 0; iteration < 1000; iteration++) {
+    ctrl_t ctrl[kWidth];
+    for (int i = 0; i < kWidth; i++) {
+      int choice = rng.NextInt(6);
+      ctrl[i] = choice < 3 ? kSpecial[choice]
+                           : static_cast<ctrl_t>(rng.NextInt(8));
+    }
+    GroupSse2Polyfill group(ctrl);
+
+    for (h2_t hash = 0; hash < 8; hash++) {
+      uint32_t expected = 0;
+      for (int i = 0; i < kWidth; i++) {
+        if (ctrl[i] == static_cast<ctrl_t>(hash)) expected |= 1u << i;
+      }
+      uint32_t actual = 0;
+      for (int i : group.Match(hash)) actual |= 1u << i;
+      CHECK_EQ(expected, actual);
+    }
+
+    uint32_t empty = 0;
+    uint32_t empty_or_deleted = 0;
+    for (int i = 0; i < kWidth; i++) {
+      if (ctrl[i] == swiss_table::kEmpty) empty |= 1u << i;
+      if (ctrl[i] < swiss_table::kSentinel) empty_or_deleted |= 1u << i;
+    }
+    uint32_t actual_empty = 0;
+    for (int i : group.MatchEmpty()) actual_empty |= 1u << i;
+    CHECK_EQ(empty, actual_empty);
+    uint32_t actual_empty_or_deleted = 0;
+    for (int i : group.MatchEmptyOrDeleted()) {
+      actual_empty_or_deleted |= 1u << i;
+    }
+    CHECK_EQ(empty_or_deleted, actual_empty_or_deleted);
+
+    int leading = 0;
+    while (leading < kWidth && ctrl[leading] < swiss_table::kSentinel) {
+      leading++;
+    }
+    CHECK_EQ(static_cast<uint32_t>(leading),
+             group.CountLeadingEmptyOrDeleted());
+
+    ctrl_t converted[kWidth];
+    group.ConvertSpecialToEmptyAndFullToDeleted(converted);
+    for (int i = 0; i < kWidth; i++) {
+      CHECK_EQ(ctrl[i] < 0 ? swiss_table::kEmpty : swiss_table::kDeleted,
+               converted[i]);
+    }
+  }
+}
+
 // Executes the tests defined in test-swiss-name-dictionary-shared-tests.h as if
 // they were defined in this file, using the RuntimeTestRunner. See comments in
 // test-swiss-name-dictionary-shared-tests.h and in
@@ -9,9 +9,11 @@
 #include "src/wasm/wasm-code-manager.h"
 #include "src/wasm/wasm-engine.h"
 #include "src/wasm/wasm-module-builder.h"
+#include "src/wasm/wasm-objects-inl.h"
 
 #include "test/cctest/cctest.h"
 
+#include "test/common/flag-utils.h"
 #include "test/common/wasm/test-signatures.h"
 #include "test/common/wasm/wasm-macro-gen.h"
 
@@ -99,6 +101,31 @@ std::shared_ptr<NativeModule> SyncCompile(base::Vector<const uint8_t> bytes) {
   return module->shared_native_module();
 }
 
+Handle<WasmModuleObject> SyncCompileModuleObject(
+    base::Vector<const uint8_t> bytes) {
+  ErrorThrower thrower(CcTest::i_isolate(), "Test");
+  auto enabled_features = WasmFeatures::FromIsolate(CcTest::i_isolate());
+  auto wire_bytes = ModuleWireBytes(bytes.begin(), bytes.end());
+  return GetWasmEngine()
+      ->SyncCompile(CcTest::i_isolate(), enabled_features, &thrower,
+                    wire_bytes)
+      .ToHandleChecked();
+}
+
+// Create a valid module with an exported function, such that it needs an
+// export wrapper.
+ZoneBuffer GetModuleBytesWithExport(Zone* zone) {
+  ZoneBuffer buffer(zone);
+  TestSignatures sigs;
+  WasmModuleBuilder builder(zone);
+  WasmFunctionBuilder* f = builder.AddFunction(sigs.i_v());
+  uint8_t code[] = {kExprI32Const, 42, kExprEnd};
+  f->EmitCode(code, arraysize(code));
+  builder.AddExport(base::CStrVector("main"), f);
+  builder.WriteTo(&buffer);
+  return buffer;
+}
+
 // Shared prefix.
 constexpr uint8_t kPrefix[] = {
     WASM_MODULE_HEADER,                // module header
@@ -233,6 +260,35 @@ TEST(TestStreamingAndSyncCache) {
   CHECK_EQ(native_module_streaming, native_module_sync);
 }
 
+TEST(TestSyncCacheSharesExportWrappers) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  HandleScope scope(isolate);
+  AccountingAllocator allocator;
+  Zone zone(&allocator, "CompilationCacheTester");
+  auto buffer = GetModuleBytesWithExport(&zone);
+  auto bytes = base::VectorOf(buffer.begin(), buffer.size());
+
+  // Without an instance, the wrappers of the first module object cannot be
+  // found and are compiled again.
+  Handle<WasmModuleObject> module1 = SyncCompileModuleObject(bytes);
+  Handle<WasmModuleObject> module2 = SyncCompileModuleObject(bytes);
+  CHECK_EQ(module1->native_module(), module2->native_module());
+  CHECK_NE(module1->export_wrappers(), module2->export_wrappers());
+
+  ErrorThrower thrower(isolate, "Test");
+  GetWasmEngine()
+      ->SyncInstantiate(isolate, &thrower, module1, {}, {})
+      .ToHandleChecked();
+  Handle<WasmModuleObject> module3 = SyncCompileModuleObject(bytes);
+  CHECK_EQ(module1->native_module(), module3->native_module());
+  CHECK_EQ(module1->export_wrappers(), module3->export_wrappers());
+
+  FlagScope<bool> no_sharing(&FLAG_wasm_share_export_wrappers, false);
+  Handle<WasmModuleObject> module4 = SyncCompileModuleObject(bytes);
+  CHECK_NE(module1->export_wrappers(), module4->export_wrappers());
+}
+
 }  // namespace wasm
 }  // namespace internal
 }  // namespace v8
@@ -1337,6 +1337,65 @@ WASM_COMPILED_EXEC_TEST(NewDefault) {
   tester.CheckResult(allocate_array, 0);
 }
 
+// Arrays with a small constant length are allocated inline by TurboFan; check
+// that they are initialized like the arrays allocated by the builtins.
+WASM_COMPILED_EXEC_TEST(SmallConstantLengthArrays) {
+  WasmGCTester tester(execution_tier);
+  const byte i8_array = tester.DefineArray(wasm::kWasmI8, true);
+  const byte f64_array = tester.DefineArray(wasm::kWasmF64, true);
+  const byte ref_array = tester.DefineArray(optref(i8_array), true);
+
+  // Only the least significant byte of the initial value is stored.
+  const byte get_i8 = tester.DefineFunction(
+      tester.sigs.i_i(), {},
+      {WASM_ARRAY_GET_U(i8_array,
+                        WASM_ARRAY_NEW_WITH_RTT(i8_array, WASM_I32V(0x1234),
+                                                WASM_I32V(5),
+                                                WASM_RTT_CANON(i8_array)),
+                        WASM_LOCAL_GET(0)),
+       kExprEnd});
+  const byte get_f64 = tester.DefineFunction(
+      tester.sigs.i_i(), {},
+      {WASM_I32_SCONVERT_F64(WASM_ARRAY_GET(
+           f64_array,
+           WASM_ARRAY_NEW_WITH_RTT(f64_array, WASM_F64(7.5), WASM_I32V(3),
+                                   WASM_RTT_CANON(f64_array)),
+           WASM_LOCAL_GET(0))),
+       kExprEnd});
+  const byte ref_is_null = tester.DefineFunction(
+      tester.sigs.i_i(), {},
+      {WASM_REF_IS_NULL(WASM_ARRAY_GET(
+           ref_array,
+           WASM_ARRAY_NEW_DEFAULT_WITH_RTT(ref_array, WASM_I32V(16),
+                                           WASM_RTT_CANON(ref_array)),
+           WASM_LOCAL_GET(0))),
+       kExprEnd});
+  // Lengths around the inline allocation limit.
+  const byte length_16 = tester.DefineFunction(
+      tester.sigs.i_v(), {},
+      {WASM_ARRAY_LEN(i8_array, WASM_ARRAY_NEW_DEFAULT_WITH_RTT(
+                                    i8_array, WASM_I32V(16),
+                                    WASM_RTT_CANON(i8_array))),
+       kExprEnd});
+  const byte length_17 = tester.DefineFunction(
+      tester.sigs.i_v(), {},
+      {WASM_ARRAY_LEN(i8_array, WASM_ARRAY_NEW_DEFAULT_WITH_RTT(
+                                    i8_array, WASM_I32V(17),
+                                    WASM_RTT_CANON(i8_array))),
+       kExprEnd});
+
+  tester.CompileModule();
+
+  tester.CheckResult(get_i8, 0x34, 0);
+  tester.CheckResult(get_i8, 0x34, 4);
+  tester.CheckHasThrown(get_i8, 5);
+  tester.CheckResult(get_f64, 7, 2);
+  tester.CheckResult(ref_is_null, 1, 15);
+  tester.CheckHasThrown(ref_is_null, 16);
+  tester.CheckResult(length_16, 16);
+  tester.CheckResult(length_17, 17);
+}
+
 WASM_COMPILED_EXEC_TEST(BasicRtt) {
   WasmGCTester tester(execution_tier);
 
@@ -24,7 +24,7 @@ class Memory64Runner : public WasmRunner<ReturnType, ParamTypes...> {
   }
 };
 
-WASM_EXEC_TEST(Load) {
+void TestLoad(TestExecutionTier execution_tier) {
   // TODO(clemensb): Implement memory64 in the interpreter.
   if (execution_tier == TestExecutionTier::kInterpreter) return;
 
@@ -54,6 +54,13 @@ WASM_EXEC_TEST(Load) {
   CHECK_TRAP(r.Call(uint64_t{1} << 32));
 }
 
+WASM_EXEC_TEST(Load) { TestLoad(execution_tier); }
+
+WASM_EXEC_TEST(LoadWithExplicitBoundsChecks) {
+  FLAG_VALUE_SCOPE(wasm_memory64_trap_handling, false);
+  TestLoad(execution_tier);
+}
+
 // TODO(clemensb): Test atomic instructions.
 
 WASM_EXEC_TEST(InitExpression) {
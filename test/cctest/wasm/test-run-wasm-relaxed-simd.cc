@@ -30,6 +30,25 @@ namespace test_run_wasm_relaxed_simd {
   }                                                             \
   void RunWasm_##name##_Impl(TestExecutionTier execution_tier)
 
+// Use this for relaxed-simd opcodes that Liftoff supports as well.
+#define WASM_RELAXED_SIMD_TEST_WITH_LIFTOFF(name)               \
+  void RunWasm_##name##_Impl(TestExecutionTier execution_tier); \
+  TEST(RunWasm_##name##_turbofan) {                             \
+    if (!CpuFeatures::SupportsWasmSimd128()) return;            \
+    EXPERIMENTAL_FLAG_SCOPE(relaxed_simd);                      \
+    RunWasm_##name##_Impl(TestExecutionTier::kTurbofan);        \
+  }                                                             \
+  TEST(RunWasm_##name##_liftoff) {                              \
+    if (!CpuFeatures::SupportsWasmSimd128()) return;            \
+    EXPERIMENTAL_FLAG_SCOPE(relaxed_simd);                      \
+    RunWasm_##name##_Impl(TestExecutionTier::kLiftoff);         \
+  }                                                             \
+  TEST(RunWasm_##name##_interpreter) {                          \
+    EXPERIMENTAL_FLAG_SCOPE(relaxed_simd);                      \
+    RunWasm_##name##_Impl(TestExecutionTier::kInterpreter);     \
+  }                                                             \
+  void RunWasm_##name##_Impl(TestExecutionTier execution_tier)
+
 #if V8_TARGET_ARCH_X64 || V8_TARGET_ARCH_ARM64 || V8_TARGET_ARCH_S390X || \
     V8_TARGET_ARCH_PPC64
 // Only used for qfma and qfms tests below.
@@ -232,7 +251,7 @@ WASM_RELAXED_SIMD_TEST(F32x4RecipSqrtApprox) {
 }
 
 #if V8_TARGET_ARCH_X64
-WASM_RELAXED_SIMD_TEST(I8x16RelaxedSwizzle) {
+WASM_RELAXED_SIMD_TEST_WITH_LIFTOFF(I8x16RelaxedSwizzle) {
   // Output is only defined for indices in the range [0,15].
   WasmRunner<int32_t> r(execution_tier);
   static const int kElems = kSimd128Size / sizeof(uint8_t);
@@ -289,7 +308,7 @@ void RelaxedLaneSelectTest(TestExecutionTier execution_tier, const T v1[kElems],
 
 }  // namespace
 
-WASM_RELAXED_SIMD_TEST(I8x16RelaxedLaneSelect) {
+WASM_RELAXED_SIMD_TEST_WITH_LIFTOFF(I8x16RelaxedLaneSelect) {
   constexpr int kElems = 16;
   constexpr uint8_t v1[kElems] = {0, 1, 2,  3,  4,  5,  6,  7,
                                   8, 9, 10, 11, 12, 13, 14, 15};
@@ -303,7 +322,7 @@ WASM_RELAXED_SIMD_TEST(I8x16RelaxedLaneSelect) {
                                          kExprI8x16RelaxedLaneSelect);
 }
 
-WASM_RELAXED_SIMD_TEST(I16x8RelaxedLaneSelect) {
+WASM_RELAXED_SIMD_TEST_WITH_LIFTOFF(I16x8RelaxedLaneSelect) {
   constexpr int kElems = 8;
   uint16_t v1[kElems] = {0, 1, 2, 3, 4, 5, 6, 7};
   uint16_t v2[kElems] = {8, 9, 10, 11, 12, 13, 14, 15};
@@ -313,7 +332,7 @@ WASM_RELAXED_SIMD_TEST(I16x8RelaxedLaneSelect) {
                                           kExprI16x8RelaxedLaneSelect);
 }
 
-WASM_RELAXED_SIMD_TEST(I32x4RelaxedLaneSelect) {
+WASM_RELAXED_SIMD_TEST_WITH_LIFTOFF(I32x4RelaxedLaneSelect) {
   constexpr int kElems = 4;
   uint32_t v1[kElems] = {0, 1, 2, 3};
   uint32_t v2[kElems] = {4, 5, 6, 7};
@@ -323,7 +342,7 @@ WASM_RELAXED_SIMD_TEST(I32x4RelaxedLaneSelect) {
                                           kExprI32x4RelaxedLaneSelect);
 }
 
-WASM_RELAXED_SIMD_TEST(I64x2RelaxedLaneSelect) {
+WASM_RELAXED_SIMD_TEST_WITH_LIFTOFF(I64x2RelaxedLaneSelect) {
   constexpr int kElems = 2;
   uint64_t v1[kElems] = {0, 1};
   uint64_t v2[kElems] = {2, 3};
@@ -333,23 +352,24 @@ WASM_RELAXED_SIMD_TEST(I64x2RelaxedLaneSelect) {
                                           kExprI64x2RelaxedLaneSelect);
 }
 
-WASM_RELAXED_SIMD_TEST(F32x4RelaxedMin) {
+WASM_RELAXED_SIMD_TEST_WITH_LIFTOFF(F32x4RelaxedMin) {
   RunF32x4BinOpTest(execution_tier, kExprF32x4RelaxedMin, Minimum);
 }
 
-WASM_RELAXED_SIMD_TEST(F32x4RelaxedMax) {
+WASM_RELAXED_SIMD_TEST_WITH_LIFTOFF(F32x4RelaxedMax) {
   RunF32x4BinOpTest(execution_tier, kExprF32x4RelaxedMax, Maximum);
 }
 
-WASM_RELAXED_SIMD_TEST(F64x2RelaxedMin) {
+WASM_RELAXED_SIMD_TEST_WITH_LIFTOFF(F64x2RelaxedMin) {
   RunF64x2BinOpTest(execution_tier, kExprF64x2RelaxedMin, Minimum);
 }
 
-WASM_RELAXED_SIMD_TEST(F64x2RelaxedMax) {
+WASM_RELAXED_SIMD_TEST_WITH_LIFTOFF(F64x2RelaxedMax) {
   RunF64x2BinOpTest(execution_tier, kExprF64x2RelaxedMax, Maximum);
 }
 #endif  // V8_TARGET_ARCH_X64
 
+#undef WASM_RELAXED_SIMD_TEST_WITH_LIFTOFF
 #undef WASM_RELAXED_SIMD_TEST
 }  // namespace test_run_wasm_relaxed_simd
 }  // namespace wasm
@@ -219,6 +219,8 @@ class StreamTester {
 
   void FinishStream() { stream_->Finish(); }
 
+  void SetExpectedSize(size_t size) { stream_->SetExpectedSize(size); }
+
   void SetCompiledModuleBytes(const uint8_t* start, size_t length) {
     stream_->SetCompiledModuleBytes(base::Vector<const uint8_t>(start, length));
   }
@@ -338,6 +340,46 @@ STREAM_TEST(TestAllBytesArriveAOTCompilerFinishesFirst) {
   CHECK(tester.IsPromiseFulfilled());
 }
 
+// Test that the wire bytes are the same if they were assembled in place
+// because the module size was announced.
+STREAM_TEST(TestExpectedSize) {
+  StreamTester tester(isolate);
+  ZoneBuffer buffer = GetValidModuleBytes(tester.zone());
+
+  tester.SetExpectedSize(buffer.size());
+  size_t half = buffer.size() / 2;
+  tester.OnBytesReceived(buffer.begin(), half);
+  tester.RunCompilerTasks();
+  tester.OnBytesReceived(buffer.begin() + half, buffer.size() - half);
+  tester.FinishStream();
+  tester.RunCompilerTasks();
+
+  CHECK(tester.IsPromiseFulfilled());
+  base::Vector<const uint8_t> wire_bytes =
+      tester.native_module()->wire_bytes();
+  CHECK_EQ(buffer.size(), wire_bytes.size());
+  CHECK_EQ(0, memcmp(buffer.begin(), wire_bytes.begin(), buffer.size()));
+}
+
+// Test that a wrong announced module size does not change the wire bytes.
+STREAM_TEST(TestWrongExpectedSize) {
+  for (int delta : {-3, 3}) {
+    StreamTester tester(isolate);
+    ZoneBuffer buffer = GetValidModuleBytes(tester.zone());
+
+    tester.SetExpectedSize(buffer.size() + delta);
+    tester.OnBytesReceived(buffer.begin(), buffer.size());
+    tester.FinishStream();
+    tester.RunCompilerTasks();
+
+    CHECK(tester.IsPromiseFulfilled());
+    base::Vector<const uint8_t> wire_bytes =
+        tester.native_module()->wire_bytes();
+    CHECK_EQ(buffer.size(), wire_bytes.size());
+    CHECK_EQ(0, memcmp(buffer.begin(), wire_bytes.begin(), buffer.size()));
+  }
+}
+
 size_t GetFunctionOffset(i::Isolate* isolate, const uint8_t* buffer,
                          size_t size, size_t index) {
   ModuleResult result = DecodeWasmModule(
@@ -1112,6 +1154,9 @@ STREAM_TEST(TestModuleWithImportedFunction) {
 STREAM_TEST(TestIncrementalCaching) {
   FLAG_VALUE_SCOPE(wasm_dynamic_tiering, true);
   FLAG_VALUE_SCOPE(wasm_tier_up, false);
+  constexpr unsigned tier_up_threshold = 4;
+  FlagScope<unsigned> tier_up_scope(&FLAG_wasm_tiering_call_threshold,
+                                    tier_up_threshold);
   constexpr int threshold = 10;
   FlagScope<int> caching_treshold(&FLAG_wasm_caching_threshold, threshold);
   StreamTester tester(isolate);
@@ -1177,9 +1222,7 @@ STREAM_TEST(TestIncrementalCaching) {
   // No TurboFan compilation happened yet, and therefore no call to the cache.
   CHECK_EQ(0, call_cache_counter);
   bool exception = false;
-  // The tier-up threshold is hard-coded right now.
-  constexpr int tier_up_threshold = 4;
-  for (int i = 0; i < tier_up_threshold; ++i) {
+  for (unsigned i = 0; i < tier_up_threshold; ++i) {
     testing::CallWasmFunctionForTesting(i_isolate, instance, "f0", 0, nullptr,
                                         &exception);
   }
@@ -1193,7 +1236,7 @@ STREAM_TEST(TestIncrementalCaching) {
     i::wasm::WasmSerializer serializer(tester.native_module().get());
     serialized_size = serializer.GetSerializedNativeModuleSize();
   }
-  for (int i = 0; i < tier_up_threshold; ++i) {
+  for (unsigned i = 0; i < tier_up_threshold; ++i) {
     testing::CallWasmFunctionForTesting(i_isolate, instance, "f1", 0, nullptr,
                                         &exception);
   }
@@ -48,6 +48,8 @@ class WasmSerializationTest {
     builder->WriteTo(buffer);
   }
 
+  static constexpr uint32_t kLiftoffCalls = 1234;
+
   void ClearSerializedData() { serialized_bytes_ = {nullptr, 0}; }
 
   void InvalidateVersion() {
@@ -142,6 +144,9 @@ class WasmSerializationTest {
       auto* native_module = module_object->native_module();
       native_module->compilation_state()->WaitForTopTierFinished();
       DCHECK(!native_module->compilation_state()->failed());
+      // Pretend the function ran a while in Liftoff, to check that the
+      // tiering profile survives serialization.
+      native_module->num_liftoff_function_calls_array()[0] = kLiftoffCalls;
 
       v8::Local<v8::Object> v8_module_obj =
           v8::Utils::ToLocal(Handle<JSObject>::cast(module_object));
@@ -309,6 +314,18 @@ UNINITIALIZED_TEST(CompiledWasmModulesTransfer) {
   from_isolate->Dispose();
 }
 
+TEST(DeserializeTieringProfile) {
+  WasmSerializationTest test;
+
+  HandleScope scope(CcTest::i_isolate());
+  Handle<WasmModuleObject> module_object;
+  CHECK(test.Deserialize().ToHandle(&module_object));
+
+  auto* native_module = module_object->native_module();
+  CHECK_EQ(WasmSerializationTest::kLiftoffCalls,
+           native_module->num_liftoff_function_calls_array()[0]);
+}
+
 TEST(TierDownAfterDeserialization) {
   WasmSerializationTest test;
 
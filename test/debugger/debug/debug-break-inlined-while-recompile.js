@@ -0,0 +1,56 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --concurrent-recompilation --no-always-opt --turbo-inlining
+
+// A break point set while a concurrent job is running only invalidates the
+// job if it inlined the function with the break point.
+
+Debug = debug.Debug;
+
+var break_count = 0;
+function listener(event, exec_state, event_data, data) {
+  if (event == Debug.DebugEvent.Break) break_count++;
+}
+
+function g(x) {
+  return x + 1;
+}
+
+function f(x) {
+  return g(x) * 2;
+}
+
+function h(x) {
+  return x * 3;
+}
+
+%PrepareFunctionForOptimization(f);
+%PrepareFunctionForOptimization(h);
+f(1);
+f(2);
+h(1);
+h(2);
+%DisableOptimizationFinalization();
+%OptimizeFunctionOnNextCall(f, "concurrent");
+%OptimizeFunctionOnNextCall(h, "concurrent");
+f(3);
+h(3);
+%WaitForBackgroundOptimization();
+
+// f inlined g, h did not.
+Debug.setListener(listener);
+Debug.setBreakPoint(g, 1, 0);
+
+%FinalizeOptimization();
+assertUnoptimized(f);
+if (!isNeverOptimize()) assertOptimized(h);
+
+assertEquals(8, f(3));
+assertEquals(1, break_count);
+assertEquals(9, h(3));
+assertEquals(1, break_count);
+
+Debug.clearAllBreakPoints();
+Debug.setListener(null);
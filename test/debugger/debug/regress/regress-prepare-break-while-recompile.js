@@ -48,8 +48,8 @@ foo();
 %OptimizeFunctionOnNextCall(foo, "concurrent");
 foo();
 
-// Set break points on an unrelated function. This clears both optimized
-// and (shared) unoptimized code on foo, and sets both to lazy-compile builtin.
+// Set break points on an unrelated function. This neither aborts nor
+// invalidates the concurrent job for foo.
 // Clear the break point immediately after to deactivate the debugger.
 // Do all of this after compile graph has been created.
 %WaitForBackgroundOptimization();
@@ -60,6 +60,5 @@ Debug.setListener(null);
 assertUnoptimized(foo);
 
 // Install optimized code when concurrent optimization finishes.
-// This needs to be able to deal with shared code being a builtin.
 %FinalizeOptimization();
-assertUnoptimized(foo);
+if (!isNeverOptimize()) assertOptimized(foo);
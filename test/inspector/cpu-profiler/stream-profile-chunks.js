@@ -0,0 +1,61 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+let {session, contextGroup, Protocol} = InspectorTest.start(
+    'Test that Profiler.stop can stream the profile in chunks.');
+
+contextGroup.addScript(`
+function spin(ms) {
+  const end = Date.now() + ms;
+  let x = 0;
+  while (Date.now() < end) x += Math.sqrt(x + 1);
+  return x;
+}`);
+
+InspectorTest.runAsyncTestSuite([
+  async function testStreamedProfile() {
+    const chunks = [];
+    Protocol.Profiler.onProfileChunk(message => chunks.push(message.params));
+    await Protocol.Profiler.enable();
+    await Protocol.Profiler.setSamplingInterval({interval: 100});
+    await Protocol.Profiler.start();
+    await Protocol.Runtime.evaluate({expression: 'spin(50)'});
+    const {result: {profile}} =
+        await Protocol.Profiler.stop({streamChunks: true});
+
+    InspectorTest.log(`Returned profile nodes: ${profile.nodes.length}`);
+    InspectorTest.log(`Returned profile samples: ${profile.samples}`);
+    InspectorTest.log(`Received chunks: ${chunks.length > 0}`);
+
+    const nodes = [].concat(...chunks.map(chunk => chunk.nodes));
+    const samples = [].concat(...chunks.map(chunk => chunk.samples));
+    const timeDeltas = [].concat(...chunks.map(chunk => chunk.timeDeltas));
+    InspectorTest.log(`First node: ${nodes[0].callFrame.functionName}`);
+    const ids = new Set(nodes.map(node => node.id));
+    InspectorTest.log(`Unique node ids: ${ids.size === nodes.length}`);
+    InspectorTest.log(
+        `Children are known: ${
+            nodes.every(node => (node.children || []).every(
+                            child => ids.has(child)))}`);
+    InspectorTest.log(`Samples are known: ${
+        samples.every(sample => ids.has(sample))}`);
+    InspectorTest.log(
+        `One time delta per sample: ${samples.length === timeDeltas.length}`);
+    InspectorTest.log(`Found spin: ${
+        nodes.some(node => node.callFrame.functionName === 'spin')}`);
+    await Protocol.Profiler.disable();
+  },
+
+  async function testUnstreamedProfileSendsNoChunks() {
+    let chunks = 0;
+    Protocol.Profiler.onProfileChunk(() => ++chunks);
+    await Protocol.Profiler.enable();
+    await Protocol.Profiler.start();
+    const {result: {profile}} = await Protocol.Profiler.stop();
+    InspectorTest.log(
+        `Returned profile has nodes: ${profile.nodes.length > 0}`);
+    InspectorTest.log(`Received chunks: ${chunks}`);
+    await Protocol.Profiler.disable();
+  }
+]);
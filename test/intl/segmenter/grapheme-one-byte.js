@@ -0,0 +1,54 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Grapheme segments of one-byte strings are single characters, except CR LF.
+const segmenter = new Intl.Segmenter([], {granularity: "grapheme"});
+
+function segmentsOf(text) {
+  const result = [];
+  let index = 0;
+  for (const s of segmenter.segment(text)) {
+    assertEquals(index, s.index);
+    assertEquals(text, s.input);
+    assertEquals(["segment", "index", "input"], Object.keys(s));
+    index += s.segment.length;
+    result.push(s.segment);
+  }
+  assertEquals(text.length, index);
+  return result;
+}
+
+assertEquals([], segmentsOf(""));
+assertEquals(["a"], segmentsOf("a"));
+assertEquals(["a", "\r\n", "b"], segmentsOf("a\r\nb"));
+assertEquals(["\r", "\r\n", "\n", "\n"], segmentsOf("\r\r\n\n\n"));
+assertEquals(["\r"], segmentsOf("\r"));
+assertEquals(["x", "\r\n"], segmentsOf("x\r\n"));
+assertEquals(["é", "©", "­", "ÿ", "\t", "\u0085"],
+             segmentsOf("é©­ÿ\t\u0085"));
+
+// A two-byte string still uses the full rules.
+assertEquals(["é", "\r\n", "é"], segmentsOf("é\r\né"));
+
+// A cons string of one-byte parts.
+const long = "ab\r".repeat(100);
+assertEquals(long + "\n", segmentsOf(long + "\n").join(""));
+assertEquals(300, segmentsOf(long + "\n").length);
+
+// Iterators of the same segments are independent.
+const segments = segmenter.segment("a\r\nb");
+const it1 = segments[Symbol.iterator]();
+const it2 = segments[Symbol.iterator]();
+assertEquals("a", it1.next().value.segment);
+assertEquals("\r\n", it1.next().value.segment);
+assertEquals("a", it2.next().value.segment);
+assertEquals("b", it1.next().value.segment);
+assertTrue(it1.next().done);
+assertTrue(it1.next().done);
+assertEquals("\r\n", it2.next().value.segment);
+
+// containing() agrees with the iterator.
+assertEquals("\r\n", segments.containing(1).segment);
+assertEquals("\r\n", segments.containing(2).segment);
+assertEquals(1, segments.containing(2).index);
@@ -0,0 +1,33 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+
+new BenchmarkSuite('NativeResolved', [1000], [
+  new Benchmark('AwaitResolved', false, false, 0, AwaitResolved,
+                SetupResolved),
+]);
+
+var resolved, awaitLoop;
+
+function SetupResolved() {
+  resolved = Promise.resolve(1);
+
+  awaitLoop = async function awaitLoop() {
+    let sum = 0;
+    for (let i = 0; i < 100; i++) {
+      sum += await resolved;
+      sum += await i;
+    }
+    return sum;
+  };
+
+  %PerformMicrotaskCheckpoint();
+}
+
+function AwaitResolved() {
+  awaitLoop();
+  awaitLoop();
+  awaitLoop();
+  %PerformMicrotaskCheckpoint();
+}
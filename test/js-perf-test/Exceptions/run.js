@@ -5,6 +5,7 @@
 
 d8.file.execute('../base.js');
 d8.file.execute('try-catch.js');
+d8.file.execute('throw-catch.js');
 
 var success = true;
 
@@ -0,0 +1,99 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite('Throw-Catch', [1000], [
+  new Benchmark('ThrowErrorCaughtLocally', false, false, 0,
+                ThrowErrorCaughtLocally, ThrowCatchSetup,
+                ThrowCatchTearDown),
+  new Benchmark('ThrowErrorFromCallee', false, false, 0,
+                ThrowErrorFromCallee, ThrowCatchSetup,
+                ThrowCatchTearDown),
+  new Benchmark('ThrowThroughFinally', false, false, 0,
+                ThrowThroughFinally, ThrowCatchSetup,
+                ThrowCatchTearDown),
+  new Benchmark('ControlFlowException', false, false, 0,
+                ControlFlowException, ThrowCatchSetup,
+                ThrowCatchTearDown)
+]);
+
+var count;
+
+function ThrowCatchSetup() {
+  count = 0;
+}
+
+function ThrowCatchTearDown() {
+  return count > 0;
+}
+
+// ----------------------------------------------------------------------------
+
+function ThrowErrorCaughtLocally() {
+  for (var i = 0; i < 100; i++) {
+    try {
+      throw new Error('Test exception');
+    } catch (e) {
+      count++;
+    }
+  }
+}
+
+// ----------------------------------------------------------------------------
+
+function Thrower(depth) {
+  if (depth === 0) throw new Error('Test exception');
+  return Thrower(depth - 1) + 1;
+}
+
+function ThrowErrorFromCallee() {
+  for (var i = 0; i < 100; i++) {
+    try {
+      Thrower(5);
+    } catch (e) {
+      count++;
+    }
+  }
+}
+
+// ----------------------------------------------------------------------------
+
+function ThrowFromFinally() {
+  try {
+    throw new TypeError('Test exception');
+  } finally {
+    count++;
+  }
+}
+
+function ThrowThroughFinally() {
+  for (var i = 0; i < 100; i++) {
+    try {
+      ThrowFromFinally();
+    } catch (e) {
+      count++;
+    }
+  }
+}
+
+// ----------------------------------------------------------------------------
+
+var kNotFound = {};
+
+function Find(array, value) {
+  array.forEach(function(element) {
+    if (element === value) throw kNotFound;
+  });
+  return -1;
+}
+
+function ControlFlowException() {
+  var array = [1, 2, 3, 4, 5, 6, 7, 8];
+  for (var i = 0; i < 100; i++) {
+    try {
+      Find(array, i & 7);
+    } catch (e) {
+      if (e === kNotFound) count++;
+    }
+  }
+}
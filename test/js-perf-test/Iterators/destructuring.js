@@ -0,0 +1,77 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite('ArrayDestructuring', [1000], [
+  new Benchmark('Swap', false, false, 0,
+                DestructuringSwap, DestructuringSwapSetup,
+                DestructuringTearDown),
+  new Benchmark('Pairs', false, false, 0,
+                DestructuringPairs, DestructuringPairsSetup,
+                DestructuringTearDown),
+  new Benchmark('Defaults', false, false, 0,
+                DestructuringDefaults, DestructuringDefaultsSetup,
+                DestructuringTearDown),
+]);
+
+
+var pairs;
+var N = 100;
+var expected, result;
+
+
+function DestructuringSetupHelper() {
+  pairs = [];
+  for (var i = 0; i < N; i++) pairs.push([i, i + 1]);
+}
+
+
+function DestructuringSwapSetup() {
+  DestructuringSetupHelper();
+  // An even number of swaps restores the original order.
+  expected = 1;
+}
+
+
+function DestructuringPairsSetup() {
+  DestructuringSetupHelper();
+  expected = N;
+}
+
+
+function DestructuringDefaultsSetup() {
+  DestructuringSetupHelper();
+  expected = N - N * (N - 1) / 2;
+}
+
+
+function DestructuringSwap() {
+  var a = 1, b = 2;
+  for (var i = 0; i < N; i++) [a, b] = [b, a];
+  result = a;
+}
+
+
+function DestructuringPairs() {
+  result = 0;
+  for (var i = 0; i < N; i++) {
+    var [x, y] = pairs[i];
+    result += y - x;
+  }
+}
+
+
+function DestructuringDefaults() {
+  result = 0;
+  for (var i = 0; i < N; i++) {
+    var [x, , z = 1] = pairs[i];
+    result += z - x;
+  }
+}
+
+
+function DestructuringTearDown() {
+  if (result !== expected) {
+    throw new Error('Unexpected result: ' + result + ' != ' + expected);
+  }
+}
@@ -5,6 +5,7 @@
 
 d8.file.execute('../base.js');
 d8.file.execute('forof.js');
+d8.file.execute('destructuring.js');
 
 
 var success = true;
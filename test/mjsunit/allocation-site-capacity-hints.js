@@ -0,0 +1,48 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --allocation-site-capacity-hints
+// Flags: --no-always-opt
+
+// Arrays from a site that earlier grew to a mixed Smi/double array start
+// with the learned elements kind and a preallocated backing store.
+
+function fill(n) {
+  const a = [];
+  for (let i = 0; i < n; i++) a.push(i % 2 ? i + 0.5 : i);
+  return a;
+}
+
+function check(a, n) {
+  assertEquals(n, a.length);
+  for (let i = 0; i < n; i++) assertEquals(i % 2 ? i + 0.5 : i, a[i]);
+  assertFalse(n in a);
+  assertEquals(undefined, a[n]);
+}
+
+for (let round = 0; round < 4; round++) {
+  check(fill(100), 100);
+}
+// The preallocated elements do not leak into shorter arrays.
+const empty = fill(0);
+assertTrue(%HasDoubleElements(empty));
+assertEquals(0, empty.length);
+assertEquals([], Object.keys(empty));
+check(fill(3), 3);
+
+function construct(n) {
+  const a = new Array();
+  for (let i = 0; i < n; i++) a[i] = i + 0.5;
+  return a;
+}
+
+for (let round = 0; round < 4; round++) {
+  const a = construct(50);
+  assertEquals(50, a.length);
+  assertEquals(49.5, a[49]);
+}
+const b = construct(0);
+assertEquals(0, b.length);
+assertEquals(undefined, b[0]);
+assertFalse(0 in b);
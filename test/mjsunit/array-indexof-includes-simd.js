@@ -0,0 +1,126 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Long searches are handed to vectorized kernels. Check every position of
+// the match relative to the vector width and the fromIndex.
+
+function check(array, value, expected_index, from) {
+  assertEquals(expected_index, array.indexOf(value, from));
+  assertEquals(expected_index >= 0, array.includes(value, from));
+}
+
+(function SmiElements() {
+  for (let length = 0; length < 40; length++) {
+    const array = [];
+    for (let i = 0; i < length; i++) array.push(i * 2);
+    assertTrue(%HasSmiElements(array));
+    for (let i = 0; i < length; i++) {
+      check(array, i * 2, i);
+      check(array, i * 2, i, i);
+      check(array, i * 2, -1, i + 1);
+      check(array, i * 2 + 1, -1);
+      check(array, i * 2 + 0.5, -1);
+    }
+    check(array, 'x', -1);
+    check(array, {}, -1);
+    check(array, NaN, -1);
+    check(array, undefined, -1);
+  }
+})();
+
+(function HoleySmiElements() {
+  const array = [];
+  array[39] = 1;
+  array[20] = 2;
+  assertTrue(%HasSmiElements(array));
+  check(array, 2, 20);
+  check(array, 1, 39, 21);
+  assertEquals(-1, array.indexOf(undefined));
+  assertTrue(array.includes(undefined));
+  assertTrue(array.includes(undefined, 21));
+})();
+
+(function ObjectElements() {
+  const objects = [];
+  for (let i = 0; i < 40; i++) objects.push({i});
+  const symbol = Symbol();
+  for (let i = 0; i < objects.length; i++) {
+    check(objects, objects[i], i);
+    check(objects, objects[i], -1, i + 1);
+  }
+  check(objects, {}, -1);
+  check(objects, symbol, -1);
+  objects[33] = symbol;
+  check(objects, symbol, 33);
+  objects[17] = null;
+  check(objects, null, 17);
+  check(objects, undefined, -1);
+  objects[25] = undefined;
+  check(objects, undefined, 25);
+})();
+
+(function DoubleElements() {
+  for (let length = 0; length < 40; length++) {
+    const array = [];
+    for (let i = 0; i < length; i++) array.push(i + 0.5);
+    if (length > 0) assertTrue(%HasDoubleElements(array));
+    for (let i = 0; i < length; i++) {
+      check(array, i + 0.5, i);
+      check(array, i + 0.5, -1, i + 1);
+    }
+    check(array, length + 0.5, -1);
+    check(array, 'x', -1);
+  }
+  const array = [];
+  for (let i = 0; i < 40; i++) array.push(i + 0.25);
+  array[3] = 0;
+  array[30] = NaN;
+  check(array, 0, 3);
+  check(array, -0, 3);
+  check(array, 0, -1, 4);
+  assertEquals(-1, array.indexOf(NaN));
+  assertTrue(array.includes(NaN));
+  assertFalse(array.includes(NaN, 31));
+})();
+
+(function HoleyDoubleElements() {
+  const array = [];
+  array[39] = 1.5;
+  array[17] = 0.5;
+  assertTrue(%HasDoubleElements(array));
+  check(array, 0.5, 17);
+  check(array, 1.5, 39, 18);
+  check(array, NaN, -1);
+  assertEquals(-1, array.indexOf(undefined));
+  assertTrue(array.includes(undefined));
+})();
+
+(function Optimized() {
+  const smis = [];
+  const doubles = [];
+  const objects = [];
+  for (let i = 0; i < 64; i++) {
+    smis.push(i);
+    doubles.push(i + 0.5);
+    objects.push({i});
+  }
+  function indexOf(array, value) { return array.indexOf(value); }
+  function includes(array, value) { return array.includes(value); }
+  for (const f of [indexOf, includes]) {
+    %PrepareFunctionForOptimization(f);
+    f(smis, 1);
+    f(doubles, 1.5);
+    f(objects, objects[1]);
+    %OptimizeFunctionOnNextCall(f);
+  }
+  assertEquals(63, indexOf(smis, 63));
+  assertEquals(50, indexOf(doubles, 50.5));
+  assertEquals(40, indexOf(objects, objects[40]));
+  assertEquals(-1, indexOf(objects, {}));
+  assertTrue(includes(smis, 33));
+  assertTrue(includes(doubles, 63.5));
+  assertFalse(includes(objects, {}));
+})();
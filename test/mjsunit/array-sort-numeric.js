@@ -0,0 +1,112 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Large packed number arrays are sorted natively for the default and for
+// subtracting comparison functions. The results must not change.
+
+function randomSmis(length) {
+  const result = [];
+  for (let i = 0; i < length; i++) {
+    result.push(((i * 7919) % 1000) - 500);
+  }
+  return result;
+}
+
+function randomDoubles(length) {
+  const result = [];
+  for (let i = 0; i < length; i++) {
+    result.push(((i * 7919) % 1000) / 8 - 60.5);
+  }
+  return result;
+}
+
+function checkSorted(array, compare) {
+  for (let i = 1; i < array.length; i++) {
+    assertTrue(compare(array[i - 1], array[i]) <= 0);
+  }
+}
+
+function checkSameAsGenericSort(input, comparefn) {
+  // The wrapper is not recognized, so it takes the generic path.
+  const generic = input.slice().sort((a, b) => {
+    return comparefn === undefined ? (String(a) < String(b) ? -1 :
+                                      String(a) > String(b) ? 1 : 0) :
+                                     comparefn(a, b);
+  });
+  const native = input.slice().sort(comparefn);
+  assertEquals(generic, native);
+}
+
+const ascending = (a, b) => a - b;
+const descending = (x, y) => y - x;
+const ascendingBlock = (a, b) => { return a - b; };
+function descendingFunction(a, b) { return b - a; }
+
+for (const length of [10, 64, 100, 1000]) {
+  const smis = randomSmis(length);
+  const doubles = randomDoubles(length);
+  for (const comparefn of [ascending, descending, ascendingBlock,
+                           descendingFunction]) {
+    checkSameAsGenericSort(smis, comparefn);
+    checkSameAsGenericSort(doubles, comparefn);
+    const sorted = smis.slice().sort(comparefn);
+    checkSorted(sorted, comparefn);
+  }
+  checkSameAsGenericSort(smis, undefined);
+}
+
+// The default sort compares Smis as strings.
+const smis = randomSmis(100);
+smis.sort();
+for (let i = 1; i < smis.length; i++) {
+  assertTrue(String(smis[i - 1]) <= String(smis[i]));
+}
+
+// Zeros compare equal and keep their order.
+const zeros = [];
+for (let i = 0; i < 100; i++) zeros.push(i % 3 ? 0 : -0, 1.5, -1.5);
+const sortedZeros = zeros.slice().sort(ascending);
+const expectedZeros = zeros.filter(x => x === 0);
+assertEquals(expectedZeros.map(x => Object.is(x, -0)),
+             sortedZeros.slice(100, 200).map(x => Object.is(x, -0)));
+
+// Arrays with NaN, holes or other elements take the generic path.
+const withNaN = randomDoubles(100);
+withNaN[50] = NaN;
+assertEquals(100, withNaN.sort(ascending).length);
+const holey = randomSmis(100);
+holey[200] = 1;
+holey.sort(ascending);
+assertEquals(201, holey.length);
+assertTrue(100 in holey);
+assertFalse(101 in holey);
+const mixed = randomSmis(100);
+mixed.push('x');
+mixed.sort(ascending);
+assertEquals(101, mixed.length);
+
+// Comparison functions that do more than subtracting are still called.
+let calls = 0;
+const counting = (a, b) => { calls++; return a - b; };
+randomSmis(100).sort(counting);
+assertTrue(calls > 0);
+calls = 0;
+randomSmis(100).sort(function(a, b) { return a - b + (calls++, 0); });
+assertTrue(calls > 0);
+const notParameters = (a, b) => a - c;
+var c = 0;
+checkSameAsGenericSort(randomSmis(100), notParameters);
+
+// Copy-on-write literals are copied before they are sorted.
+function literal() {
+  return [9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10,
+          29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 39, 38, 37, 36, 35, 34, 33,
+          32, 31, 30, 49, 48, 47, 46, 45, 44, 43, 42, 41, 40, 59, 58, 57, 56,
+          55, 54, 53, 52, 51, 50, 69, 68, 67, 66, 65, 64, 63, 62, 61, 60];
+}
+const sortedLiteral = literal().sort(ascending);
+for (let i = 0; i < sortedLiteral.length; i++) {
+  assertEquals(i, sortedLiteral[i]);
+}
+assertEquals(9, literal()[0]);
@@ -0,0 +1,31 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --perf-prof --perf-prof-delete-file --perf-prof-async-writer
+// Flags: --allow-natives-syntax --expose-gc --stress-compaction
+// Flags: --sparkplug --no-always-sparkplug --opt --no-always-opt
+
+// Baseline and optimized code keeps working while the GC moves it.
+
+function add(a, b) {
+  return a + b;
+}
+
+function sum(n) {
+  let result = 0;
+  for (let i = 0; i < n; i++) result = add(result, i);
+  return result;
+}
+
+%CompileBaseline(add);
+%PrepareFunctionForOptimization(sum);
+assertEquals(45, sum(10));
+%OptimizeFunctionOnNextCall(sum);
+assertEquals(45, sum(10));
+
+for (let i = 0; i < 3; i++) {
+  gc();
+  assertEquals(4950, sum(100));
+  assertEquals(3, add(1, 2));
+}
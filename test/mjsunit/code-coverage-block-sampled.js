@@ -0,0 +1,62 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --no-always-opt --opt
+// Flags: --no-stress-flush-code --turbo-inlining
+// Files: test/mjsunit/code-coverage-utils.js
+
+if (isNeverOptimizeLiteMode()) {
+  print("Warning: skipping test that requires optimization in Lite mode.");
+  testRunner.quit(0);
+}
+
+%DebugToggleSampledBlockCoverage(true);
+
+TestCoverage(
+"optimized and inlined functions",
+`
+function g() { if (true) nop(); }         // 0000
+function f() { g(); g(); }                // 0050
+%PrepareFunctionForOptimization(f);       // 0100
+f(); f(); %OptimizeFunctionOnNextCall(f); // 0150
+f(); f(); f(); f(); f(); f();             // 0200
+`,
+[{"start":0,"end":249,"count":1},
+ {"start":0,"end":33,"count":16},
+ {"start":50,"end":76,"count":8}]
+);
+
+// Collecting neither deoptimizes nor stops counting in optimized code.
+(function OptimizedCodeKeepsCounting() {
+  const source = `
+function h(x) { if (x) { return 1; } return 2; }
+%PrepareFunctionForOptimization(h);
+h(true); h(false);
+%OptimizeFunctionOnNextCall(h);
+h(true);
+h;
+`.trim();
+  const h = eval(source);
+  assertOptimized(h);
+
+  function functionCount() {
+    const start = source.indexOf('function h');
+    for (const script of %DebugCollectCoverage()) {
+      if (script.script !== source) continue;
+      for (const range of script) {
+        if (range.start === start) return range.count;
+      }
+    }
+    return 0;
+  }
+
+  assertEquals(3, functionCount());
+  assertOptimized(h);
+  // Counters were reset by the collection.
+  h(false); h(false);
+  assertEquals(2, functionCount());
+  assertOptimized(h);
+})();
+
+%DebugToggleSampledBlockCoverage(false);
@@ -0,0 +1,72 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --no-always-opt
+
+// BigInt additions and subtractions with 64-bit feedback are computed in
+// registers and deoptimize when an input or the result does not fit.
+
+const kMax = 2n ** 63n - 1n;
+const kMin = -(2n ** 63n);
+
+function mix(a, b, c) {
+  return (a + b) - (c - a) + 1n;
+}
+
+%PrepareFunctionForOptimization(mix);
+assertEquals(5n, mix(1n, 2n, 0n));
+assertEquals(-7n, mix(-1n, -3n, 3n));
+%OptimizeFunctionOnNextCall(mix);
+assertEquals(5n, mix(1n, 2n, 0n));
+assertEquals(0n, mix(0n, 0n, 1n));
+assertEquals(kMax, mix(kMax - 1n, 0n, kMax - 1n));
+assertEquals(kMin + 1n, mix(kMin, 0n, kMin));
+assertOptimized(mix);
+
+// An overflowing result deoptimizes and still produces the exact value.
+assertEquals(kMax + 2n, mix(kMax, 1n, kMax));
+if (%Is64Bit()) {
+  assertUnoptimized(mix);
+}
+
+// With the generalized feedback, large values no longer deoptimize.
+%PrepareFunctionForOptimization(mix);
+%OptimizeFunctionOnNextCall(mix);
+assertEquals(kMax + 2n, mix(kMax, 1n, kMax));
+assertEquals(2n ** 64n - 1n, mix(kMax, kMax, kMax));
+assertOptimized(mix);
+
+function sub(a, b) {
+  return a - b;
+}
+
+%PrepareFunctionForOptimization(sub);
+assertEquals(-1n, sub(1n, 2n));
+assertEquals(kMin, sub(kMin, 0n));
+%OptimizeFunctionOnNextCall(sub);
+assertEquals(kMax, sub(kMax, 0n));
+assertEquals(kMin, sub(-1n, kMax));
+assertOptimized(sub);
+
+// Inputs that do not fit into 64 bits deoptimize.
+assertEquals(1n, sub(2n ** 64n + 1n, 2n ** 64n));
+if (%Is64Bit()) {
+  assertUnoptimized(sub);
+}
+
+function add(a, b) {
+  return a + b;
+}
+
+%PrepareFunctionForOptimization(add);
+assertEquals(3n, add(1n, 2n));
+%OptimizeFunctionOnNextCall(add);
+assertEquals(-1n, add(kMax, kMin));
+assertOptimized(add);
+
+// Mixing BigInts with other types still throws.
+assertThrows(() => add(1n, 1), TypeError);
+if (%Is64Bit()) {
+  assertUnoptimized(add);
+}
@@ -0,0 +1,67 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --no-always-opt
+
+// Call sites that see many bound functions of the same target stay
+// optimizable and call the target directly.
+
+class Handler {
+  constructor(id) { this.id = id; }
+  handle(x, y) { return this.id + x + (y === undefined ? 0 : y); }
+}
+
+function makeHandlers(count, ...args) {
+  const result = [];
+  for (let i = 0; i < count; i++) {
+    const handler = new Handler(i);
+    result.push(handler.handle.bind(handler, ...args));
+  }
+  return result;
+}
+
+(function NoBoundArguments() {
+  const handlers = makeHandlers(10);
+  function dispatch(f, x) { return f(x); }
+  %PrepareFunctionForOptimization(dispatch);
+  for (let i = 0; i < handlers.length; i++) {
+    assertEquals(i + 1, dispatch(handlers[i], 1));
+  }
+  %OptimizeFunctionOnNextCall(dispatch);
+  assertEquals(3, dispatch(handlers[2], 1));
+  assertEquals(106, dispatch(makeHandlers(1)[0], 106));
+  assertOptimized(dispatch);
+
+  // A bound function of another target deoptimizes.
+  const other = function(x) { return -x; }.bind(null);
+  assertEquals(-1, dispatch(other, 1));
+  assertUnoptimized(dispatch);
+})();
+
+(function WithBoundArguments() {
+  const handlers = makeHandlers(10, 100);
+  function dispatch(f, y) { return f(y); }
+  %PrepareFunctionForOptimization(dispatch);
+  for (let i = 0; i < handlers.length; i++) {
+    assertEquals(i + 101, dispatch(handlers[i], 1));
+  }
+  %OptimizeFunctionOnNextCall(dispatch);
+  assertEquals(105, dispatch(handlers[4], 1));
+  assertOptimized(dispatch);
+
+  // A different number of bound arguments deoptimizes.
+  assertEquals(2, dispatch(makeHandlers(1, 1, 1)[0], 7));
+  assertUnoptimized(dispatch);
+})();
+
+(function NonFunctionTarget() {
+  const handlers = makeHandlers(4);
+  function dispatch(f) { return f(0); }
+  %PrepareFunctionForOptimization(dispatch);
+  for (const handler of handlers) dispatch(handler);
+  %OptimizeFunctionOnNextCall(dispatch);
+  assertEquals(1, dispatch(handlers[1]));
+  assertThrows(() => dispatch(1), TypeError);
+  assertThrows(() => dispatch({}), TypeError);
+})();
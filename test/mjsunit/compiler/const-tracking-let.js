@@ -0,0 +1,68 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --const-tracking-let --opt --no-always-opt
+
+// Top-level lets are folded into optimized code until they are reassigned.
+
+let config = {verbose: false};
+let limit = 10;
+let counter;
+
+function readLimit() { return limit; }
+%PrepareFunctionForOptimization(readLimit);
+assertEquals(10, readLimit());
+%OptimizeFunctionOnNextCall(readLimit);
+assertEquals(10, readLimit());
+assertOptimized(readLimit);
+
+// A reassignment from the declaring script deoptimizes the reader.
+limit = 20;
+assertUnoptimized(readLimit);
+assertEquals(20, readLimit());
+
+function readConfig() { return config.verbose; }
+%PrepareFunctionForOptimization(readConfig);
+assertFalse(readConfig());
+%OptimizeFunctionOnNextCall(readConfig);
+assertFalse(readConfig());
+assertOptimized(readConfig);
+
+// Mutating the object does not reassign the binding.
+config.verbose = true;
+assertTrue(readConfig());
+
+// A reassignment from a function deoptimizes the reader too.
+function setConfig(value) { config = value; }
+setConfig({verbose: 1});
+assertUnoptimized(readConfig);
+assertEquals(1, readConfig());
+
+// Reassigned lets keep working in optimized code.
+function increment() { counter = (counter || 0) + 1; return counter; }
+%PrepareFunctionForOptimization(increment);
+assertEquals(1, increment());
+assertEquals(2, increment());
+%OptimizeFunctionOnNextCall(increment);
+assertEquals(3, increment());
+assertEquals(3, counter);
+
+// Uninitialized lets still throw.
+assertThrows(() => late, ReferenceError);
+assertThrows(() => { late = 1; }, ReferenceError);
+assertThrows(() => typeof late, ReferenceError);
+let late = 1;
+assertEquals(1, late);
+
+// Reassignments from other scripts are tracked as well.
+let shared = 1;
+function readShared() { return shared; }
+%PrepareFunctionForOptimization(readShared);
+assertEquals(1, readShared());
+%OptimizeFunctionOnNextCall(readShared);
+assertEquals(1, readShared());
+assertOptimized(readShared);
+(0, eval)("shared = 2");
+assertUnoptimized(readShared);
+assertEquals(2, readShared());
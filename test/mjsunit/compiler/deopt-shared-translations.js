@@ -0,0 +1,31 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --no-always-opt
+// Flags: --turbo-share-translations
+
+// Deoptimization exits with the same frame state share their translation.
+// Each of them must still deoptimize to the right place.
+
+function inner(o, k) {
+  // The map checks on {o} below all deoptimize into the same frame state.
+  return o.a + o.b + o.c + k;
+}
+
+function outer(o, k) {
+  return inner(o, k) + inner(o, k + 1);
+}
+
+%PrepareFunctionForOptimization(inner);
+%PrepareFunctionForOptimization(outer);
+assertEquals(13, outer({a: 1, b: 2, c: 3}, 0));
+assertEquals(13, outer({a: 1, b: 2, c: 3}, 0));
+%OptimizeFunctionOnNextCall(outer);
+assertEquals(15, outer({a: 1, b: 2, c: 3}, 1));
+assertOptimized(outer);
+
+// Different maps deoptimize at different exits.
+assertEquals(17, outer({b: 2, a: 1, c: 3}, 2));
+assertUnoptimized(outer);
+assertEquals('xyz0xyz1', outer({a: 'x', b: 'y', c: 'z'}, 0));
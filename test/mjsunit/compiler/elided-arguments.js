@@ -0,0 +1,135 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --no-always-opt
+
+// Arguments objects and rest parameters that are only loaded from are not
+// allocated. Their loads behave like loads from the allocated objects.
+
+function test(f, check) {
+  %PrepareFunctionForOptimization(f);
+  check();
+  check();
+  %OptimizeFunctionOnNextCall(f);
+  check();
+}
+
+(function SloppyArguments() {
+  function f() {
+    let sum = 0;
+    for (let i = 0; i < arguments.length; i++) sum += arguments[i];
+    return sum;
+  }
+  test(f, () => {
+    assertEquals(0, f());
+    assertEquals(6, f(1, 2, 3));
+  });
+  assertOptimized(f);
+})();
+
+(function StrictArguments() {
+  function f(a, b) {
+    'use strict';
+    return [arguments.length, arguments[0], arguments[2], arguments[-1]];
+  }
+  test(f, () => {
+    assertEquals([0, undefined, undefined, undefined], f());
+    assertEquals([3, 1, 3, undefined], f(1, 2, 3));
+  });
+})();
+
+(function KeysOutsideTheFrame() {
+  function f(key) {
+    'use strict';
+    return arguments[key];
+  }
+  test(f, () => {
+    assertEquals(0, f(0));
+    assertEquals(undefined, f(1));
+    assertEquals(undefined, f(-1));
+    assertEquals(1, f('length'));
+    assertEquals(undefined, f(1.5));
+  });
+  assertThrows(() => f('callee'), TypeError);
+})();
+
+(function SloppyCallee() {
+  function f() { return arguments[arguments[0]]; }
+  test(f, () => {
+    assertSame(f, f('callee'));
+    assertEquals(2, f(1, 2));
+    assertEquals(undefined, f(2));
+  });
+})();
+
+(function PrototypeElements() {
+  function f() {
+    'use strict';
+    return arguments[5];
+  }
+  test(f, () => {
+    assertEquals(undefined, f(1));
+    Object.prototype[5] = 'proto';
+    assertEquals('proto', f(1));
+    assertEquals(6, f(1, 2, 3, 4, 5, 6));
+    delete Object.prototype[5];
+  });
+})();
+
+(function RestParameter() {
+  function f(a, ...rest) {
+    return [rest.length, rest[0], rest[rest.length - 1], rest[-1]];
+  }
+  test(f, () => {
+    assertEquals([0, undefined, undefined, undefined], f());
+    assertEquals([0, undefined, undefined, undefined], f(1));
+    assertEquals([2, 2, 3, undefined], f(1, 2, 3));
+  });
+  assertOptimized(f);
+})();
+
+(function RestParameterAndArguments() {
+  function f(a, ...rest) { return rest[0] + arguments[0] + arguments.length; }
+  test(f, () => {
+    assertEquals(5, f(1, 2));
+  });
+})();
+
+(function RestParameterInDefaultInitializer() {
+  function f(a = rest, ...rest) { return rest.length; }
+  assertThrows(() => f(), ReferenceError);
+  assertEquals(1, f(1, 2));
+})();
+
+(function AssignedParameters() {
+  function f(a) {
+    a = 2;
+    return arguments[0];
+  }
+  test(f, () => {
+    assertEquals(2, f(1));
+  });
+  function g(a) {
+    'use strict';
+    a = 2;
+    return arguments[0];
+  }
+  test(g, () => {
+    assertEquals(1, g(1));
+  });
+})();
+
+(function EscapingUses() {
+  function f() { return arguments; }
+  assertEquals(2, f(1, 2).length);
+  function g(...rest) {
+    rest[0] = 3;
+    return rest[0];
+  }
+  assertEquals(3, g(1));
+  function h() { return Array.prototype.slice.call(arguments, 1); }
+  assertEquals([2], h(1, 2));
+  function i() { return (() => arguments[0])(); }
+  assertEquals(1, i(1));
+})();
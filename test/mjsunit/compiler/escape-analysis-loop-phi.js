@@ -0,0 +1,25 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-escape
+
+// The loop Phi for {p} only ever sees {o}, so it must not keep {o} from being
+// scalar replaced, and {o} must be materialized correctly when deoptimizing
+// from within the loop.
+function f(x, deopt) {
+  let o = {x};
+  let p = o;
+  for (let i = 0; i < 3; i++) {
+    p = o;
+    if (deopt) %DeoptimizeNow();
+  }
+  return [p.x, p === o];
+}
+
+%PrepareFunctionForOptimization(f);
+assertEquals([1, true], f(1, false));
+assertEquals([2, true], f(2, false));
+%OptimizeFunctionOnNextCall(f);
+assertEquals([3, true], f(3, false));
+assertEquals([4, true], f(4, true));
@@ -0,0 +1,34 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --noalways-opt
+
+// Test the inlined OrderedHashMap probe for internalized string and symbol
+// keys, including entries whose keys are equal but not internalized strings.
+(function() {
+  const sym = Symbol("sym");
+  const map = new Map();
+  map.set("foo", 1);
+  map.set(sym, 2);
+  map.set(1, 3);
+  // A cons string that is not internalized, but equal to "barbaz".
+  const bar = "bar" + (map.size > 0 ? "baz" : "");
+  map.set(bar, 4);
+
+  function get(m) {
+    return [m.get("foo"), m.get(sym), m.get("barbaz"), m.get("qux"),
+            m.has("foo"), m.has("qux")];
+  }
+
+  const expected = [1, 2, 4, undefined, true, false];
+  %PrepareFunctionForOptimization(get);
+  assertEquals(expected, get(map));
+  assertEquals(expected, get(map));
+  %OptimizeFunctionOnNextCall(get);
+  assertEquals(expected, get(map));
+  assertOptimized(get);
+
+  map.delete("foo");
+  assertEquals([undefined, 2, 4, undefined, false, false], get(map));
+})();
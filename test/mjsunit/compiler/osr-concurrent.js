@@ -0,0 +1,41 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --use-osr --concurrent-osr
+// Flags: --concurrent-recompilation --no-always-opt
+
+// An OSR request queues a background job and the loop keeps running in the
+// unoptimized frame. Once the job is installed, a later back edge enters the
+// code from the OSR code cache.
+
+function sum(n) {
+  let result = 0;
+  for (let i = 0; i < n; i++) {
+    if (i == 10) %OptimizeOsr();
+    if (i == 20) %FinalizeOptimization();
+    result += i;
+  }
+  return result;
+}
+
+%PrepareFunctionForOptimization(sum);
+assertEquals(4950, sum(100));
+assertEquals(4950, sum(100));
+
+// Nested loops request OSR at different back edges.
+function nested(n) {
+  let result = 0;
+  for (let i = 0; i < n; i++) {
+    for (let j = 0; j < n; j++) {
+      if (i == 1 && j == 1) %OptimizeOsr();
+      if (i == 2 && j == 1) %FinalizeOptimization();
+      result += j;
+    }
+  }
+  return result;
+}
+
+%PrepareFunctionForOptimization(nested);
+assertEquals(450, nested(10));
+assertEquals(450, nested(10));
@@ -0,0 +1,71 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --no-always-opt
+
+// Optimized named loads from proxies call the get trap directly.
+
+(function GetTrap() {
+  const log = [];
+  const proxy = new Proxy({x: 1}, {
+    get(target, name, receiver) {
+      log.push(name);
+      return name === 'x' ? target.x + 1 : undefined;
+    }
+  });
+  function load(p) { return p.x; }
+  %PrepareFunctionForOptimization(load);
+  assertEquals(2, load(proxy));
+  assertEquals(2, load(proxy));
+  %OptimizeFunctionOnNextCall(load);
+  assertEquals(2, load(proxy));
+  assertOptimized(load);
+  assertEquals(['x', 'x', 'x'], log);
+
+  // Other receivers deoptimize.
+  assertEquals(5, load({x: 5}));
+  assertUnoptimized(load);
+})();
+
+(function NoTrap() {
+  const proxy = new Proxy({x: 3}, {});
+  function load(p) { return p.x; }
+  %PrepareFunctionForOptimization(load);
+  assertEquals(3, load(proxy));
+  %OptimizeFunctionOnNextCall(load);
+  assertEquals(3, load(proxy));
+  assertEquals(undefined, load(new Proxy({}, {})));
+  assertOptimized(load);
+})();
+
+(function ThrowingTrap() {
+  const proxy = new Proxy({}, {
+    get() { throw new Error('trap'); }
+  });
+  function load(p) {
+    try {
+      return p.x;
+    } catch (e) {
+      return e.message;
+    }
+  }
+  %PrepareFunctionForOptimization(load);
+  assertEquals('trap', load(proxy));
+  %OptimizeFunctionOnNextCall(load);
+  assertEquals('trap', load(proxy));
+  assertOptimized(load);
+})();
+
+(function Invariants() {
+  const target = {};
+  Object.defineProperty(target, 'x', {value: 1});
+  const {proxy, revoke} = Proxy.revocable(target, {get() { return 2; }});
+  function load(p) { return p.x; }
+  %PrepareFunctionForOptimization(load);
+  assertThrows(() => load(proxy), TypeError);
+  %OptimizeFunctionOnNextCall(load);
+  assertThrows(() => load(proxy), TypeError);
+  revoke();
+  assertThrows(() => load(proxy), TypeError);
+})();
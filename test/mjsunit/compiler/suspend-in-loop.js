@@ -0,0 +1,55 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Suspends inside nested loops keep the live registers and drop the dead
+// ones in optimized code.
+
+async function nested(n) {
+  let sum = 0;
+  for (let i = 0; i < n; i++) {
+    const dead = {i};
+    for (let j = 0; j < i; j++) {
+      const live = i * j;
+      sum += await live;
+      if (dead.i !== i) throw new Error('lost register');
+    }
+  }
+  return sum;
+}
+
+function* generator(n) {
+  let product = 1;
+  for (let i = 1; i <= n; i++) {
+    const unused = [i];
+    product *= yield product;
+  }
+  return product;
+}
+
+function runNested(n) {
+  let result;
+  nested(n).then(r => result = r);
+  %PerformMicrotaskCheckpoint();
+  return result;
+}
+
+function runGenerator(n) {
+  const g = generator(n);
+  let step = g.next();
+  let i = 1;
+  while (!step.done) step = g.next(++i);
+  return step.value;
+}
+
+%PrepareFunctionForOptimization(nested);
+%PrepareFunctionForOptimization(generator);
+assertEquals(35, runNested(5));
+assertEquals(720, runGenerator(5));
+%OptimizeFunctionOnNextCall(nested);
+%OptimizeFunctionOnNextCall(generator);
+assertEquals(35, runNested(5));
+assertEquals(720, runGenerator(5));
+assertEquals(870, runNested(10));
@@ -0,0 +1,46 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// String keys are found regardless of their representation, and strings
+// of the same length or with equal prefixes are told apart.
+
+const map = new Map();
+const set = new Set();
+const keys = [];
+for (let i = 0; i < 1000; i++) {
+  const key = 'key' + String(i).padStart(4, '0');
+  keys.push(key);
+  map.set(key, i);
+  set.add(key);
+}
+assertEquals(1000, map.size);
+assertEquals(1000, set.size);
+
+function flat(string) {
+  return string.split('').join('');
+}
+
+for (let i = 0; i < keys.length; i++) {
+  // Non-internalized, cons and sliced strings with the same contents.
+  const copies = [flat(keys[i]), 'key' + keys[i].substring(3),
+                  ('x' + keys[i]).substring(1)];
+  for (const copy of copies) {
+    assertEquals(i, map.get(copy));
+    assertTrue(set.has(copy));
+  }
+  assertFalse(map.has(keys[i] + '0'));
+  assertFalse(set.has(keys[i].substring(1)));
+}
+
+// Array index strings and their numbers are different keys.
+map.set('42', 'string');
+map.set(42, 'number');
+assertEquals('string', map.get(flat('42')));
+assertEquals('number', map.get(42));
+
+// Deleting by an equal string removes the entry.
+assertTrue(map.delete(flat(keys[7])));
+assertFalse(map.has(keys[7]));
+assertTrue(set.delete('key' + '0007'));
+assertFalse(set.has(keys[7]));
@@ -0,0 +1,94 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --no-stress-opt
+
+// Simple array patterns read fast arrays directly while the array iterator
+// protector is intact. The results must match the iterator protocol.
+
+function swap(a) {
+  let [x, y] = a;
+  [x, y] = [y, x];
+  return [x, y];
+}
+
+function pick(a) {
+  const [, second, , fourth = 'd'] = a;
+  return second + fourth;
+}
+
+function pairs(m) {
+  let result = '';
+  for (const [k, v] of m) result += k + '=' + v + ';';
+  return result;
+}
+
+function params([a, b = 2], [c]) { return a + b + c; }
+
+function check() {
+  assertEquals([2, 1], swap([1, 2]));
+  assertEquals([undefined, 1], swap([1]));
+  assertEquals([2, 1], swap([1, 2, 3]));
+  assertEquals([2.5, 1.5], swap([1.5, 2.5]));
+  assertEquals([undefined, undefined], swap([, , ]));
+  assertEquals([2, 1], swap(Object.freeze([1, 2])));
+  assertEquals(['b', 'a'], swap('ab'));
+  assertEquals([0, 1], swap(new Uint8Array(2).fill(1, 0, 1)));
+  assertEquals([2, 1], swap(new Set([1, 2])));
+
+  assertEquals('bd', pick(['a', 'b', 'c']));
+  assertEquals('b4', pick(['a', 'b', 'c', 4]));
+  assertEquals('undefinedd', pick([]));
+  assertEquals('bd', pick('abc'));
+
+  assertEquals('a=1;b=2;', pairs([['a', 1], ['b', 2]]));
+  assertEquals('a=1;b=2;', pairs(new Map([['a', 1], ['b', 2]])));
+
+  assertEquals(6, params([1, 2], [3]));
+  assertEquals(6, params([1], [3]));
+  assertEquals(NaN, params([], []));
+
+  assertThrows(() => swap(undefined), TypeError);
+  assertThrows(() => swap({0: 1, 1: 2, length: 2}), TypeError);
+}
+
+%PrepareFunctionForOptimization(swap);
+%PrepareFunctionForOptimization(pick);
+%PrepareFunctionForOptimization(pairs);
+%PrepareFunctionForOptimization(params);
+check();
+check();
+%OptimizeFunctionOnNextCall(swap);
+%OptimizeFunctionOnNextCall(pick);
+%OptimizeFunctionOnNextCall(pairs);
+%OptimizeFunctionOnNextCall(params);
+check();
+
+// Arrays with a changed prototype or own iterator use the iterator protocol.
+const custom = [1, 2];
+custom[Symbol.iterator] = function*() { yield 'x'; yield 'y'; };
+assertEquals(['y', 'x'], swap(custom));
+class SubArray extends Array {
+  *[Symbol.iterator]() { yield 'p'; yield 'q'; }
+}
+assertEquals(['q', 'p'], swap(SubArray.from([1, 2])));
+
+// Holes read through the prototype chain, like the iterator does.
+Array.prototype[1] = 'proto';
+assertEquals(['proto', 1], swap([1, , ]));
+delete Array.prototype[1];
+assertEquals([undefined, 1], swap([1, , ]));
+
+// A "return" method is called once it is reachable from array iterators.
+assertTrue(%ArrayIteratorProtector());
+let closed = 0;
+const arrayIteratorPrototype = Object.getPrototypeOf([][Symbol.iterator]());
+arrayIteratorPrototype.return = function() {
+  closed++;
+  return {};
+};
+assertFalse(%ArrayIteratorProtector());
+assertEquals([2, 1], swap([1, 2, 3]));
+assertEquals(2, closed);
+check();
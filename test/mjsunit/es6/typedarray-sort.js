@@ -149,3 +149,16 @@ for (let constructor of constructorsWithArrays) {
   assertArrayLikeEquals(array, constructor.array.reverse(), constructor.ctor);
   assertEquals(array.length, constructor.array.length);
 }
+
+// Long integer arrays are radix sorted; check against a comparison sort.
+for (let constructor of typedArrayConstructors) {
+  for (let length of [255, 256, 1000]) {
+    let array = new constructor(length);
+    for (let i = 0; i < length; i++) {
+      array[i] = ((i * 7919) % 2000 - 1000) * (i % 3 ? 1 : 1 << 20);
+    }
+    let expected = Array.from(array).sort((a, b) => a - b);
+    array.sort();
+    assertArrayLikeEquals(array, expected, constructor);
+  }
+}
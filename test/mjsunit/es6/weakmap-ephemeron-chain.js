@@ -0,0 +1,36 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --expose-gc --ephemeron-fixpoint-iterations=1
+
+// A long chain of ephemerons, where each value is the key of the next
+// entry, needs the linear ephemeron algorithm after the fixpoint iteration
+// gives up. All entries reachable from the live head stay alive.
+
+const kLength = 1000;
+const map = new WeakMap();
+let head = {index: 0};
+let key = head;
+// Insert the entries in reverse so later keys are visited first.
+const keys = [];
+for (let i = 1; i <= kLength; i++) {
+  keys.push(key);
+  key = {index: i};
+}
+for (let i = kLength - 1; i >= 0; i--) {
+  map.set(keys[i], i + 1 < kLength ? keys[i + 1] : {index: kLength});
+}
+keys.length = 0;
+key = null;
+
+gc();
+gc();
+
+let current = head;
+for (let i = 0; i < kLength; i++) {
+  assertEquals(i, current.index);
+  current = map.get(current);
+}
+assertEquals(kLength, current.index);
+assertEquals(undefined, map.get(current));
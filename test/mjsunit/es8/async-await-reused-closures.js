@@ -0,0 +1,61 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// An async function reuses its await closures across awaits. Resolutions
+// and rejections must still resume the right function at the right await.
+
+let log = [];
+
+async function worker(name, values) {
+  for (const value of values) {
+    try {
+      log.push(name + ':' + await value);
+    } catch (e) {
+      log.push(name + ':caught ' + e);
+    }
+  }
+  return name;
+}
+
+const rejected = Promise.reject('error');
+rejected.catch(() => {});
+
+let results = [];
+worker('a', [1, Promise.resolve(2), rejected, 4]).then(r => results.push(r));
+worker('b', [rejected, 'x', Promise.resolve('y')]).then(r => results.push(r));
+%PerformMicrotaskCheckpoint();
+
+assertEquals(['b', 'a'], results);
+assertEquals(['a:1', 'b:caught error', 'a:2', 'b:x', 'a:caught error',
+              'b:y', 'a:4'], log);
+
+// Awaiting thenables and pending promises works after earlier awaits.
+log = [];
+let resolveLater;
+const pending = new Promise(resolve => resolveLater = resolve);
+const thenable = {then(resolve) { resolve('thenable'); }};
+worker('c', [1, thenable, pending, 2]);
+%PerformMicrotaskCheckpoint();
+assertEquals(['c:1', 'c:thenable'], log);
+resolveLater('pending');
+%PerformMicrotaskCheckpoint();
+assertEquals(['c:1', 'c:thenable', 'c:pending', 'c:2'], log);
+
+// An optimized async function keeps working.
+async function sum(n) {
+  let total = 0;
+  for (let i = 0; i < n; i++) total += await i;
+  return total;
+}
+%PrepareFunctionForOptimization(sum);
+let total;
+sum(10).then(t => total = t);
+%PerformMicrotaskCheckpoint();
+assertEquals(45, total);
+%OptimizeFunctionOnNextCall(sum);
+sum(100).then(t => total = t);
+%PerformMicrotaskCheckpoint();
+assertEquals(4950, total);
@@ -0,0 +1,38 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Strings are scanned a word at a time; terminators at any position within a
+// word must be found.
+for (let length = 0; length < 40; length++) {
+  const prefix = "a".repeat(length);
+  assertEquals(prefix, JSON.parse('"' + prefix + '"'));
+  assertEquals(prefix + '"' + prefix,
+               JSON.parse('"' + prefix + '\\"' + prefix + '"'));
+  assertEquals(prefix + "\\", JSON.parse('"' + prefix + '\\\\"'));
+  assertEquals(prefix + "\xff\x7f", JSON.parse('"' + prefix + '\xff\x7f"'));
+  assertThrows(() => JSON.parse('"' + prefix + '\n"'), SyntaxError);
+  assertThrows(() => JSON.parse('"' + prefix + '\x1f"'), SyntaxError);
+  assertThrows(() => JSON.parse('"' + prefix), SyntaxError);
+}
+assertEquals({key: "value"}, JSON.parse('{"key":"value"}'));
+
+// Integers.
+assertTrue(%IsSmi(JSON.parse("123456789")));
+assertTrue(%IsSmi(JSON.parse("-123456789")));
+assertTrue(%IsSmi(JSON.parse("1073741823")));
+assertEquals(1073741824, JSON.parse("1073741824"));
+assertEquals(-1073741825, JSON.parse("-1073741825"));
+assertEquals(4294967296, JSON.parse("4294967296"));
+assertEquals(999999999999999, JSON.parse("999999999999999"));
+assertEquals(-999999999999999, JSON.parse("-999999999999999"));
+assertEquals(9007199254740993, JSON.parse("9007199254740993"));
+assertEquals(12345678901234567890, JSON.parse("12345678901234567890"));
+assertEquals(-0, JSON.parse("-0"));
+assertEquals(1234567890.5, JSON.parse("1234567890.5"));
+assertEquals(12345678901e2, JSON.parse("12345678901e2"));
+assertEquals([1, 22, 333], JSON.parse("[1,22,333]"));
+assertThrows(() => JSON.parse("01"), SyntaxError);
+assertThrows(() => JSON.parse("-"), SyntaxError);
@@ -0,0 +1,29 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Nested objects that aren't direct array elements reuse the layout of the
+// previously parsed object with the same number of properties.
+let records = JSON.parse(
+    '[{"id":1,"user":{"name":"a","mail":"x@y.z"},"tags":[{"k":1,"v":2}]},' +
+    ' {"id":2,"user":{"name":"b","mail":"u@v.w"},"tags":[{"k":3,"v":4}]}]');
+assertTrue(%HaveSameMap(records[0], records[1]));
+assertTrue(%HaveSameMap(records[0].user, records[1].user));
+assertTrue(%HaveSameMap(records[0].tags[0], records[1].tags[0]));
+assertEquals("u@v.w", records[1].user.mail);
+assertEquals(4, records[1].tags[0].v);
+
+// Mismatching layouts with the same number of properties.
+let mixed = JSON.parse(
+    '{"a":{"x":1,"y":2},"b":{"y":3,"x":4},"c":{"x":5,"z":6},' +
+    '"d":{"x":7.5,"y":"str"},"e":{"0":1,"x":2},"f":{"x":{"y":1},"y":2}}');
+assertEquals({x: 1, y: 2}, mixed.a);
+assertEquals({y: 3, x: 4}, mixed.b);
+assertEquals(["y", "x"], Object.keys(mixed.b));
+assertEquals({x: 5, z: 6}, mixed.c);
+assertEquals({x: 7.5, y: "str"}, mixed.d);
+assertEquals({0: 1, x: 2}, mixed.e);
+assertEquals({x: {y: 1}, y: 2}, mixed.f);
+assertEquals(1, mixed.a.x);
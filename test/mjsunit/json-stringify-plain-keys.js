@@ -0,0 +1,26 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Keys that need no escaping are remembered during a stringify call. Check
+// that keys that do need escaping, and two-byte output, are unaffected.
+
+let records = [];
+for (let i = 0; i < 100; i++) {
+  records.push({id: i, name: "n" + i, "a b": 1, "q\"k": 2, "ሴ": 3});
+}
+let json = JSON.stringify(records);
+assertEquals('{"id":0,"name":"n0","a b":1,"q\\"k":2,"ሴ":3}',
+             JSON.stringify(records[0]));
+assertEquals(records, JSON.parse(json));
+assertTrue(json.endsWith(
+    '{"id":99,"name":"n99","a b":1,"q\\"k":2,"ሴ":3}]'));
+
+// Switching to two-byte output in the middle of the plain keys.
+let mixed = [{key: "x"}, {key: " "}, {key: "y"}];
+assertEquals('[{"key":"x"},{"key":" "},{"key":"y"}]',
+             JSON.stringify(mixed));
+
+// With a gap.
+assertEquals('{\n  "key": 1,\n  "other": [\n    2\n  ]\n}',
+             JSON.stringify({key: 1, other: [2]}, null, 2));
@@ -0,0 +1,25 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Names that nested star exports don't provide are looked up through several
+// barrels, one of which is part of a cycle.
+
+import {a, b, c, setA} from "modules-skip-star-exports-barrel.mjs";
+import {b as innerB} from "modules-skip-star-exports-barrel-inner.mjs";
+import * as outer from "modules-skip-star-exports-barrel.mjs";
+import * as inner from "modules-skip-star-exports-barrel-inner.mjs";
+import * as cyclic from "modules-skip-star-exports-barrel-c.mjs";
+
+assertEquals(1, a);
+assertEquals(2, b);
+assertEquals(3, c);
+assertEquals(2, innerB);
+setA(4);
+assertEquals(4, a);
+assertEquals(4, outer.a);
+
+assertEquals(["a", "b", "c", "setA"], Object.keys(outer));
+assertEquals(["a", "b", "setA"], Object.keys(inner));
+assertEquals(["a", "b", "c", "setA"], Object.keys(cyclic));
+assertFalse("c" in inner);
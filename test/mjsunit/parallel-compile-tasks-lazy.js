@@ -0,0 +1,35 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --compiler-dispatcher --parallel-compile-tasks --use-external-strings
+// Flags: --parallel-compile-lazy-function-size=1
+
+var outer_var = 42;
+
+function lazy_outer() {
+  return outer_var;
+}
+
+function lazy_with_inner(a) {
+  function inner(b) {
+    return a + b;
+  }
+  return inner(1);
+}
+
+function* lazy_gen() {
+  yield 1;
+  yield 2;
+}
+
+function lazy_never_called() {
+  class foo {};
+  return new foo();
+}
+
+assertEquals(42, lazy_outer());
+assertEquals(43, lazy_with_inner(42));
+var gen = lazy_gen();
+assertEquals(1, gen.next().value);
+assertEquals(2, gen.next().value);
@@ -0,0 +1,16 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --no-stress-opt
+
+assertTrue(%SetIteratorProtector());
+assertTrue(%MapIteratorProtector());
+assertTrue(%StringIteratorProtector());
+assertTrue(%ArrayIteratorProtector());
+const arrayIteratorPrototype = Object.getPrototypeOf([][Symbol.iterator]());
+arrayIteratorPrototype.return = () => ({});
+assertTrue(%SetIteratorProtector());
+assertTrue(%MapIteratorProtector());
+assertTrue(%StringIteratorProtector());
+assertFalse(%ArrayIteratorProtector());
@@ -57,6 +57,12 @@ Test(/x{4,}/, "xxxxxxxxx", ["xxxxxxxxx"], 0);
 Test(/x{4,}?/, "xxxxxxxxx", ["xxxx"], 0);
 Test(/x{2,4}/, "xxxxxxxxx", ["xxxx"], 0);
 Test(/x{2,4}?/, "xxxxxxxxx", ["xx"], 0);
+// Single characters can be repeated more often than other bodies.
+Test(/x{20}/, "x".repeat(25), ["x".repeat(20)], 0);
+Test(/[0-9]{1,64}/, "a" + "1".repeat(70), ["1".repeat(64)], 0);
+Test(/[0-9]{3,100}?x/, "1234x", ["1234x"], 0);
+assertEquals(%RegexpTypeTag(/(?:xy){20}/), "IRREGEXP");
+assertEquals(%RegexpTypeTag(/(?:x{200}){2}/), "IRREGEXP");
 
 // Non-capturing groups and nested operators.
 Test(/(?:)/, "asdf", [""], 0);
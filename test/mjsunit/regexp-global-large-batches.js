@@ -0,0 +1,41 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Global operations on long subjects fetch matches in large batches. Check
+// that results stay correct across batch boundaries.
+
+const kCount = 1000;
+let subject = "";
+for (let i = 0; i < kCount; i++) subject += "<" + i + ":" + (i * 2) + ">";
+
+// Callback replace with captures.
+let calls = 0;
+let replaced = subject.replace(/<(\d+):(\d+)>/g, (match, a, b, offset, s) => {
+  assertEquals(calls, +a);
+  assertEquals(2 * calls, +b);
+  assertEquals(subject, s);
+  assertEquals(match, subject.substring(offset, offset + match.length));
+  calls++;
+  return "[" + b + "]";
+});
+assertEquals(kCount, calls);
+assertEquals(replaced, subject.replace(/<\d+:(\d+)>/g, "[$1]"));
+
+// Named captures.
+let groups = [];
+subject.replace(/<(?<a>\d+):(?<b>\d+)>/g, (...args) => {
+  groups.push(args[args.length - 1]);
+  return "";
+});
+assertEquals(kCount, groups.length);
+assertEquals({a: "999", b: "1998"}, {...groups[kCount - 1]});
+
+// match, matchAll and split.
+assertEquals(kCount, subject.match(/<(\d+):(\d+)>/g).length);
+let all = [...subject.matchAll(/<(\d+):(\d+)>/g)];
+assertEquals(kCount, all.length);
+assertEquals("777", all[777][1]);
+let parts = subject.split(/[<>:]/);
+assertEquals(3 * kCount + 1, parts.length);
+assertEquals("1554", parts[3 * 777 + 2]);
@@ -0,0 +1,40 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --no-regexp-tier-up
+
+// Unanchored searches for a required character skip ahead to its next
+// occurrence in native one-byte code.
+
+function Log(lines) {
+  let result = "";
+  for (let i = 0; i < lines; i++) {
+    result += (i % 100 == 42) ? "ERROR: failure" + i + "\n"
+                              : "INFO: all good here " + i + "\n";
+  }
+  return result;
+}
+
+let log = Log(1000);
+let errors = log.match(/ERROR: (\w+)/g);
+assertEquals(10, errors.length);
+assertEquals("ERROR: failure42", errors[0]);
+assertEquals("ERROR: failure942", errors[9]);
+
+// Characters that are equal modulus the table size must not be skipped.
+assertEquals(2, "\xc5\xc5xxxE".search(/.{3}E/));
+assertEquals(-1, "xxx\xc5".search(/.{3}E/));
+assertEquals(["\xc5RROR"], "xx\xc5RROR".match(/[\xc5E]RROR/));
+
+// No match, matches at the very end and at the very start.
+assertNull("x".repeat(10000).match(/ERROR: (\w+)/));
+assertEquals(9995, ("x".repeat(9995) + "ERROR").search(/ERROR/));
+assertEquals(0, ("ERROR" + "x".repeat(10000)).search(/ERROR/));
+assertEquals(-1, ("x".repeat(9995) + "ERRO").search(/ERROR/));
+
+// Matching from a non-zero last index.
+let re = /ERROR/g;
+re.lastIndex = 1;
+assertEquals(10, re.exec("ERRORxxxxxERROR").index);
+assertNull(re.exec("ERRORxxxxxERROR"));
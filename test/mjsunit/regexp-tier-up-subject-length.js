@@ -0,0 +1,33 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Interpreted executions on longer subjects count as more tier-up ticks.
+// Flags: --regexp-tier-up --regexp-tier-up-ticks=10
+// Flags: --regexp-tier-up-chars-per-tick=10
+// Flags: --allow-natives-syntax --no-force-slow-path --no-regexp-interpret-all
+// Flags: --no-enable-experimental-regexp-engine
+
+const kLatin1 = true;
+
+// Each execution on a 50 character subject counts as 6 ticks.
+const subject = 'a'.repeat(49) + 'b';
+let re = new RegExp('a+b');
+re.test(subject);
+assertTrue(%RegexpHasBytecode(re, kLatin1));
+assertFalse(%RegexpHasNativeCode(re, kLatin1));
+re.test(subject);
+re.test(subject);
+assertFalse(%RegexpHasBytecode(re, kLatin1));
+assertTrue(%RegexpHasNativeCode(re, kLatin1));
+
+// Short subjects count as a single tick each. Use a different pattern, so that
+// the compilation cache does not return the already tiered-up data.
+re = new RegExp('a+c?b');
+for (let i = 0; i < 10; i++) {
+  re.test('ab');
+  assertTrue(%RegexpHasBytecode(re, kLatin1));
+}
+re.test('ab');
+assertFalse(%RegexpHasBytecode(re, kLatin1));
+assertTrue(%RegexpHasNativeCode(re, kLatin1));
@@ -2,7 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
-// Flags: --wasm-staging --wasm-dynamic-tiering
+// Flags: --wasm-staging --wasm-dynamic-tiering --wasm-tiering-call-threshold=4
 
 d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
 
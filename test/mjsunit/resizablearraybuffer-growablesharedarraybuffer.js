@@ -407,6 +407,30 @@ const arrayBufferCtors = [[ArrayBuffer, (b) => b.resizable],
   }
 })();
 
+(function TestRABRepeatedShrinkAndGrowAcrossPages() {
+  // Growing back into pages which are still committed after a shrink must
+  // keep them writable and zeroed.
+  const maybe_page_size = 4096;
+  const rab = CreateResizableArrayBuffer(0, 4 * maybe_page_size);
+  const i8a = new Int8Array(rab);
+  for (let round = 1; round <= 4; ++round) {
+    rab.resize(round * maybe_page_size);
+    assertEquals(round * maybe_page_size, i8a.length);
+    for (let i = 0; i < i8a.length; ++i) {
+      assertEquals(0, i8a[i]);
+      i8a[i] = round;
+    }
+    rab.resize(maybe_page_size / 2);
+    for (let i = 0; i < i8a.length; ++i) {
+      i8a[i] = 0;
+    }
+  }
+  rab.resize(4 * maybe_page_size);
+  for (let i = 0; i < i8a.length; ++i) {
+    assertEquals(0, i8a[i]);
+  }
+})();
+
 (function TestGSABBasics() {
   const gsab = CreateGrowableSharedArrayBuffer(10, 20);
   assertFalse(gsab instanceof ArrayBuffer);
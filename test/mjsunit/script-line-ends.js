@@ -0,0 +1,38 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Positions in stack traces come from the line ends of the script, which
+// one-byte sources find a word at a time.
+
+function positionOfThrow(source) {
+  try {
+    eval(source);
+  } catch (e) {
+    const match = e.stack.match(/<anonymous>:(\d+):(\d+)/);
+    return [Number(match[1]), Number(match[2])];
+  }
+  assertUnreachable();
+}
+
+const kThrow = 'throw new Error();';
+
+assertEquals([1, 7], positionOfThrow(kThrow));
+assertEquals([6, 7], positionOfThrow('\n'.repeat(5) + kThrow));
+assertEquals([4, 7], positionOfThrow('a = 1;\r\nb = 2;\r\n\r\n' + kThrow));
+assertEquals([3, 7], positionOfThrow('a = 1;\rb = 2;\r' + kThrow));
+
+// Other control characters below '\r' do not end lines.
+assertEquals([2, 11], positionOfThrow('a = 1;\n\t\v\f ' + kThrow));
+
+// Terminators at every offset within and across words.
+for (let padding = 0; padding < 20; padding++) {
+  const line = 'x = "' + 'y'.repeat(padding) + '";';
+  let source = '';
+  for (let i = 0; i < 10; i++) source += line + (i % 3 == 0 ? '\r\n' : '\n');
+  assertEquals([11, 9], positionOfThrow(source + '  ' + kThrow));
+}
+
+// Two-byte sources also end lines at U+2028 and U+2029.
+assertEquals([3, 7],
+             positionOfThrow('a = "\u0101";\u2028b = 2;\u2029' + kThrow));
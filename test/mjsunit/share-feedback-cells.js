@@ -0,0 +1,32 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --share-feedback-cells --opt
+// Flags: --no-always-opt
+
+// Closures of the same function created from different parent closures end
+// up on different creation-site feedback cells; with --share-feedback-cells
+// they share a single one.
+function makeOuter() {
+  return function outer() {
+    return function add(a, b) {
+      return a + b;
+    };
+  };
+}
+
+const add1 = makeOuter()();
+const add2 = makeOuter()();
+assertNotSame(add1, add2);
+
+%PrepareFunctionForOptimization(add1);
+assertEquals(3, add1(1, 2));
+assertEquals(3, add1(1, 2));
+%OptimizeFunctionOnNextCall(add1);
+assertEquals(3, add1(1, 2));
+
+// The second closure still behaves correctly with the shared feedback.
+assertEquals(7, add2(3, 4));
+assertEquals("ab", add2("a", "b"));
+assertEquals(5, add1(2, 3));
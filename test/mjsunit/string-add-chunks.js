@@ -0,0 +1,37 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Short appends to a cons string are merged into its last chunk.
+
+function build(pieces) {
+  let s = "";
+  for (const piece of pieces) s += piece;
+  return s;
+}
+
+function check(pieces) {
+  const s = build(pieces);
+  assertEquals(pieces.join(""), s);
+  for (let i = 0, pos = 0; i < pieces.length; pos += pieces[i++].length) {
+    assertEquals(pieces[i], s.substr(pos, pieces[i].length));
+  }
+}
+
+// One-byte appends.
+check(Array.from({length: 1000}, (_, i) => "line " + i + "\n"));
+// Two-byte appends.
+check(Array.from({length: 1000}, (_, i) => "\u2603" + i));
+// Mixed encodings do not merge, but must still produce the right result.
+check(Array.from({length: 1000}, (_, i) => i % 3 ? "abc" + i : "\xe9\u2603"));
+// Appends longer than a chunk.
+check(Array.from({length: 100}, (_, i) => "x".repeat(i)));
+
+// The previous values stay intact when a chunk is extended.
+const prefix = "0123456789abcdef";
+const a = prefix + "x";
+const b = a + "y";
+const c = a + "z";
+assertEquals(prefix + "x", a);
+assertEquals(prefix + "xy", b);
+assertEquals(prefix + "xz", c);
@@ -0,0 +1,44 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Short patterns are searched by filtering on their first and last
+// characters, several positions at a time.
+
+function naiveIndexOf(subject, pattern, from) {
+  for (let i = from; i + pattern.length <= subject.length; i++) {
+    if (subject.substr(i, pattern.length) === pattern) return i;
+  }
+  return -1;
+}
+
+function check(subject, pattern) {
+  for (let from = 0; from <= subject.length; from++) {
+    assertEquals(naiveIndexOf(subject, pattern, from),
+                 subject.indexOf(pattern, from), pattern + " from " + from);
+  }
+}
+
+// Patterns whose first and last characters match in many places.
+const one_byte = "a ab abc abcd abcde aaaaab  b a  ba abcdef x".repeat(3);
+for (const pattern of ["ab", "a b", "abc", "  b", "aaab", "abcdef", "ba ",
+                       "x", "zz", "f x", "bcdef"]) {
+  check(one_byte, pattern);
+}
+
+// Two-byte subjects, with one-byte and two-byte patterns.
+const two_byte =
+    "\u2603 a\u2603 ab \u2603\u2603a ab\u2603 abc \u2603".repeat(3);
+for (const pattern of ["ab", "\u2603a", "a\u2603", "\u2603\u2603",
+                       "ab\u2603 ", "\u2603 a", "c \u2603", "\u2604\u2603"]) {
+  check(two_byte, pattern);
+}
+
+// Matches at the very end of the subject and at every alignment.
+for (let n = 0; n < 24; n++) {
+  const subject = "-".repeat(n) + "ab";
+  assertEquals(n, subject.indexOf("ab"));
+  assertTrue(subject.includes("-ab") || n == 0);
+  assertEquals(["-".repeat(n), ""], subject.split("ab"));
+  assertEquals("-".repeat(n) + "c", subject.replaceAll("ab", "c"));
+}
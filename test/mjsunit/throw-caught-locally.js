@@ -0,0 +1,80 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Exceptions that are caught by JavaScript do not create a message. Check
+// that catching, rethrowing and finally blocks still behave.
+
+function thrower(depth) {
+  if (depth === 0) throw new Error('boom');
+  return thrower(depth - 1) + 1;
+}
+
+function catchLocally() {
+  try {
+    throw new Error('local');
+  } catch (e) {
+    return e.message;
+  }
+}
+
+function catchFromCallee() {
+  try {
+    thrower(3);
+  } catch (e) {
+    return e.stack.split('\n')[0];
+  }
+}
+
+function throwThroughFinally(log) {
+  try {
+    try {
+      throw 1;
+    } finally {
+      log.push('finally');
+    }
+  } catch (e) {
+    log.push('catch ' + e);
+  }
+}
+
+function rethrow() {
+  try {
+    try {
+      thrower(1);
+    } catch (e) {
+      throw e;
+    }
+  } catch (e) {
+    return e.message;
+  }
+}
+
+function throwThroughBuiltin() {
+  try {
+    [1, 2, 3].forEach(function(x) { if (x == 2) throw x; });
+  } catch (e) {
+    return e;
+  }
+}
+
+function test() {
+  assertEquals('local', catchLocally());
+  assertEquals('Error: boom', catchFromCallee());
+  var log = [];
+  throwThroughFinally(log);
+  assertEquals(['finally', 'catch 1'], log);
+  assertEquals('boom', rethrow());
+  assertEquals(2, throwThroughBuiltin());
+}
+
+[catchLocally, catchFromCallee, throwThroughFinally, rethrow,
+ throwThroughBuiltin, thrower].forEach(
+    f => %PrepareFunctionForOptimization(f));
+test();
+test();
+[catchLocally, catchFromCallee, throwThroughFinally, rethrow,
+ throwThroughBuiltin, thrower].forEach(f => %OptimizeFunctionOnNextCall(f));
+test();
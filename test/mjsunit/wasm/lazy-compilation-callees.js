@@ -0,0 +1,39 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --wasm-lazy-compilation --liftoff
+// Flags: --wasm-lazy-compile-callees --no-wasm-tier-up
+
+// This test busy-waits for background compilation, hence it does not work in
+// predictable mode where we only have a single thread.
+// Flags: --no-predictable
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+const builder = new WasmModuleBuilder();
+const callee = builder.addFunction('callee', kSig_i_v)
+    .addBody([kExprI32Const, 7])
+    .exportFunc();
+// Only calls {callee} if its parameter is non-zero.
+builder.addFunction('caller', kSig_i_i)
+    .addBody([
+      kExprLocalGet, 0,
+      kExprIf, kWasmI32,
+        kExprCallFunction, callee.index,
+      kExprElse,
+        kExprI32Const, 0,
+      kExprEnd
+    ])
+    .exportFunc();
+const instance = builder.instantiate();
+
+assertFalse(%IsLiftoffFunction(instance.exports.callee));
+// Lazily compiling {caller} queues {callee} for background compilation, even
+// though this call does not reach it.
+assertEquals(0, instance.exports.caller(0));
+while (!%IsLiftoffFunction(instance.exports.callee)) {
+}
+%FreezeWasmLazyCompilation(instance);
+assertEquals(7, instance.exports.callee());
+assertEquals(7, instance.exports.caller(1));
@@ -0,0 +1,68 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --liftoff --no-wasm-tier-up
+// Flags: --liftoff-loop-invariant-locals-in-registers
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+// Sums up all {kNumParams} parameters {n} times. The parameters are not
+// assigned in the loop, so some of them can stay in registers.
+const kNumParams = 12;
+
+function addSumLoop(builder, name, call_in_loop) {
+  const params = new Array(kNumParams).fill(kWasmI32);
+  const sig = builder.addType(makeSig(params.concat([kWasmI32]), [kWasmI32]));
+  const kCounter = kNumParams;
+  const kSum = kNumParams + 1;
+  const body = [kExprLoop, kWasmVoid];
+  for (let i = 0; i < kNumParams; ++i) {
+    body.push(kExprLocalGet, i, kExprLocalGet, kSum, kExprI32Add,
+              kExprLocalSet, kSum);
+  }
+  if (call_in_loop) body.push(kExprCallFunction, 0);
+  body.push(
+      kExprLocalGet, kCounter, kExprI32Const, 1, kExprI32Sub,
+      kExprLocalTee, kCounter, kExprBrIf, 0, kExprEnd, kExprLocalGet, kSum);
+  builder.addFunction(name, sig)
+      .addLocals(kWasmI32, 1)
+      .addBody(body)
+      .exportFunc();
+}
+
+(function testInvariantLocals() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  builder.addFunction('nop', kSig_v_v).addBody([]);
+  addSumLoop(builder, 'sum', false);
+  addSumLoop(builder, 'sum_with_call', true);
+  const instance = builder.instantiate();
+  const args = [];
+  for (let i = 1; i <= kNumParams; ++i) args.push(i);
+  const expected = 3 * (kNumParams * (kNumParams + 1) / 2);
+  assertEquals(expected, instance.exports.sum(...args, 3));
+  assertEquals(expected, instance.exports.sum_with_call(...args, 3));
+  assertTrue(%IsLiftoffFunction(instance.exports.sum));
+})();
+
+(function testInvariantFloatLocal() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  builder.addFunction('scale', makeSig([kWasmF64, kWasmI32], [kWasmF64]))
+      .addLocals(kWasmF64, 1)
+      .addBody([
+        kExprF64Const, 0, 0, 0, 0, 0, 0, 0xf0, 0x3f,  // 1.0
+        kExprLocalSet, 2,
+        kExprLoop, kWasmVoid,
+          kExprLocalGet, 2, kExprLocalGet, 0, kExprF64Mul, kExprLocalSet, 2,
+          kExprLocalGet, 1, kExprI32Const, 1, kExprI32Sub, kExprLocalTee, 1,
+          kExprBrIf, 0,
+        kExprEnd,
+        kExprLocalGet, 2
+      ])
+      .exportFunc();
+  const instance = builder.instantiate();
+  assertEquals(1024, instance.exports.scale(2, 10));
+  assertEquals(0.125, instance.exports.scale(0.5, 3));
+})();
@@ -0,0 +1,7 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --wasm-pipelined-async-compilation --expose-wasm --allow-natives-syntax
+
+d8.file.execute("test/mjsunit/wasm/async-compile.js");
@@ -3,7 +3,7 @@
 // found in the LICENSE file.
 
 // Flags: --wasm-speculative-inlining --experimental-wasm-return-call
-// Flags: --experimental-wasm-typed-funcref
+// Flags: --experimental-wasm-typed-funcref --wasm-tiering-call-threshold=4
 
 d8.file.execute("test/mjsunit/wasm/wasm-module-builder.js");
 
@@ -71,6 +71,43 @@ d8.file.execute("test/mjsunit/wasm/wasm-module-builder.js");
   assertEquals(15, instance.exports.main(10, 0));
 })();
 
+(function CallIndirectSpecTest() {
+  print(arguments.callee.name);
+  let builder = new WasmModuleBuilder();
+  let sig_index = builder.addType(kSig_i_i);
+
+  // h(x) = x - 1
+  let callee0 = builder.addFunction("callee0", sig_index)
+    .addBody([kExprLocalGet, 0, kExprI32Const, 1, kExprI32Sub]);
+
+  // f(x) = x - 2
+  let callee1 = builder.addFunction("callee1", sig_index)
+    .addBody([kExprLocalGet, 0, kExprI32Const, 2, kExprI32Sub]);
+
+  builder.setTableBounds(2, 2);
+  builder.addActiveElementSegment(0, WasmInitExpr.I32Const(0),
+                                  [callee0.index, callee1.index]);
+
+  // g(x, i) = table[i](5) + x
+  builder.addFunction("main", kSig_i_ii)
+    .addBody([
+      kExprI32Const, 5, kExprLocalGet, 1,
+      kExprCallIndirect, sig_index, kTableZero,
+      kExprLocalGet, 0, kExprI32Add])
+    .exportAs("main");
+
+  let instance = builder.instantiate();
+  // Run main 10 times with the same table entry to trigger tier-up. This will
+  // speculatively inline a call to function {h}.
+  for (var i = 0; i < 10; i++) assertEquals(14, instance.exports.main(10, 0));
+  assertEquals(14, instance.exports.main(10, 0));
+
+  // Now, call the other entry. The correct function should still be called,
+  // i.e., "callee1".
+  assertEquals(13, instance.exports.main(10, 1));
+  assertTraps(kTrapTableOutOfBounds, () => instance.exports.main(10, 2));
+})();
+
 // TODO(manoskouk): Fix the following tests.
 (function CallReturnRefSpecSucceededTest() {
   print(arguments.callee.name);
@@ -3,7 +3,7 @@
 // found in the LICENSE file.
 
 // Flags: --allow-natives-syntax --wasm-dynamic-tiering --liftoff
-// Flags: --no-wasm-tier-up --no-stress-opt
+// Flags: --no-wasm-tier-up --no-stress-opt --wasm-tiering-call-threshold=4
 
 // This test busy-waits for tier-up to be complete, hence it does not work in
 // predictable more where we only have a single thread.
@@ -292,6 +292,79 @@ function takeAndUseWebSnapshot(createObjects, exports) {
   assertEquals(11525, foo.func()[0]);
 })();
 
+(function TestHoleyArray() {
+  function createObjects() {
+    globalThis.foo = {
+      array: [1, , 3, , {a: 5}]
+    };
+  }
+  const { foo } = takeAndUseWebSnapshot(createObjects, ['foo']);
+  assertEquals(5, foo.array.length);
+  assertEquals(1, foo.array[0]);
+  assertFalse(1 in foo.array);
+  assertEquals(3, foo.array[2]);
+  assertFalse(3 in foo.array);
+  assertEquals(5, foo.array[4].a);
+})();
+
+(function TestDoubleArray() {
+  function createObjects() {
+    globalThis.foo = {
+      packed: [1.5, -0.25, NaN],
+      holey: [1.5, , 2.5]
+    };
+  }
+  const { foo } = takeAndUseWebSnapshot(createObjects, ['foo']);
+  assertEquals([1.5, -0.25, NaN], foo.packed);
+  assertEquals(3, foo.holey.length);
+  assertFalse(1 in foo.holey);
+  assertEquals(2.5, foo.holey[2]);
+})();
+
+(function TestMap() {
+  function createObjects() {
+    const key = { k: 1 };
+    globalThis.foo = {
+      key,
+      map: new Map([['a', 1], [2, 'b'], [key, [3]], [NaN, null]])
+    };
+  }
+  const { foo } = takeAndUseWebSnapshot(createObjects, ['foo']);
+  assertTrue(foo.map instanceof Map);
+  assertEquals(4, foo.map.size);
+  assertEquals(1, foo.map.get('a'));
+  assertEquals('b', foo.map.get(2));
+  assertEquals([3], foo.map.get(foo.key));
+  assertNull(foo.map.get(NaN));
+  assertEquals(['a', 2, foo.key, NaN], [...foo.map.keys()]);
+})();
+
+(function TestSet() {
+  function createObjects() {
+    const set = new Set([1, 'two', 3.5]);
+    set.add(set);
+    globalThis.foo = { set };
+  }
+  const { foo } = takeAndUseWebSnapshot(createObjects, ['foo']);
+  assertTrue(foo.set instanceof Set);
+  assertEquals([1, 'two', 3.5, foo.set], [...foo.set]);
+})();
+
+(function TestCollectionReferences() {
+  function createObjects() {
+    const map = new Map();
+    const set = new Set([map]);
+    map.set('set', set);
+    map.set('owner', { map });
+    globalThis.foo = { list: [set, map], map };
+  }
+  const { foo } = takeAndUseWebSnapshot(createObjects, ['foo']);
+  assertSame(foo.map, foo.list[1]);
+  assertSame(foo.list[0], foo.map.get('set'));
+  assertTrue(foo.map.get('set').has(foo.map));
+  assertSame(foo.map, foo.map.get('owner').map);
+})();
+
 (function TestEmptyClass() {
   function createObjects() {
     globalThis.Foo = class Foo { };
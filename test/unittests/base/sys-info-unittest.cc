@@ -12,6 +12,18 @@ TEST(SysInfoTest, NumberOfProcessors) {
   EXPECT_LT(0, SysInfo::NumberOfProcessors());
 }
 
+TEST(SysInfoTest, NumberOfAvailableProcessors) {
+  EXPECT_LT(0, SysInfo::NumberOfAvailableProcessors());
+  EXPECT_GE(SysInfo::NumberOfProcessors(),
+            SysInfo::NumberOfAvailableProcessors());
+}
+
+TEST(SysInfoTest, CoreTypes) {
+  // Either both core types are known or neither is.
+  EXPECT_EQ(SysInfo::PerformanceProcessors().empty(),
+            SysInfo::EfficiencyProcessors().empty());
+}
+
 TEST(SysInfoTest, AmountOfPhysicalMemory) {
   EXPECT_LT(0, SysInfo::AmountOfPhysicalMemory());
 }
@@ -0,0 +1,109 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/loop-check-hoisting.h"
+
+#include "src/compiler/access-builder.h"
+#include "src/compiler/node-properties.h"
+#include "src/compiler/node.h"
+#include "src/compiler/simplified-operator.h"
+#include "test/unittests/compiler/graph-unittest.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class LoopCheckHoistingTest : public GraphTest {
+ public:
+  LoopCheckHoistingTest() : GraphTest(2), simplified_(zone()) {}
+  ~LoopCheckHoistingTest() override = default;
+
+ protected:
+  struct CheckedLoop {
+    Node* loop;
+    Node* effect_phi;
+    Node* checkpoint;
+    Node* check;
+    Node* ret;
+  };
+
+  SimplifiedOperatorBuilder* simplified() { return &simplified_; }
+
+  // Builds a loop entered right after a Checkpoint, whose header checks the
+  // maps of {object}, or of a loop phi if {object} is null. If {store_map} is
+  // set, the loop body also overwrites the map of the checked value.
+  CheckedLoop NewCheckedLoop(Node* object, bool store_map) {
+    CheckedLoop l;
+    l.checkpoint = graph()->NewNode(common()->Checkpoint(), EmptyFrameState(),
+                                    start(), start());
+    l.loop = graph()->NewNode(common()->Loop(2), start(), start());
+    l.effect_phi = graph()->NewNode(common()->EffectPhi(2), l.checkpoint,
+                                    l.checkpoint, l.loop);
+    if (object == nullptr) {
+      object =
+          graph()->NewNode(common()->Phi(MachineRepresentation::kTagged, 2),
+                           Parameter(0), Parameter(0), l.loop);
+    }
+    ZoneHandleSet<Map> maps(factory()->heap_number_map());
+    l.check =
+        graph()->NewNode(simplified()->CheckMaps(CheckMapsFlag::kNone, maps),
+                         object, l.effect_phi, l.loop);
+    Node* branch = graph()->NewNode(common()->Branch(), Parameter(1), l.loop);
+    Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+    Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+    Node* effect = l.check;
+    if (store_map) {
+      effect = graph()->NewNode(
+          simplified()->StoreField(AccessBuilder::ForMap()), object,
+          HeapConstant(factory()->heap_number_map()), effect, if_true);
+    }
+    l.loop->ReplaceInput(1, if_true);
+    l.effect_phi->ReplaceInput(1, effect);
+    l.ret = graph()->NewNode(common()->Return(), Int32Constant(0), object,
+                             l.check, if_false);
+    graph()->SetEnd(graph()->NewNode(common()->End(1), l.ret));
+    return l;
+  }
+
+  void HoistChecks() {
+    LoopTree* loop_tree =
+        LoopFinder::BuildLoopTree(graph(), tick_counter(), zone());
+    LoopCheckHoisting(loop_tree, zone()).Run();
+  }
+
+ private:
+  SimplifiedOperatorBuilder simplified_;
+};
+
+TEST_F(LoopCheckHoistingTest, HoistInvariantCheckMaps) {
+  CheckedLoop l = NewCheckedLoop(Parameter(0), false);
+  HoistChecks();
+
+  EXPECT_EQ(l.check, NodeProperties::GetEffectInput(l.effect_phi, 0));
+  EXPECT_EQ(l.checkpoint, NodeProperties::GetEffectInput(l.check));
+  EXPECT_EQ(start(), NodeProperties::GetControlInput(l.check));
+  EXPECT_EQ(l.effect_phi, NodeProperties::GetEffectInput(l.effect_phi, 1));
+  EXPECT_EQ(l.effect_phi, NodeProperties::GetEffectInput(l.ret));
+}
+
+TEST_F(LoopCheckHoistingTest, KeepCheckMapsIfLoopStoresMap) {
+  CheckedLoop l = NewCheckedLoop(Parameter(0), true);
+  HoistChecks();
+
+  EXPECT_EQ(l.checkpoint, NodeProperties::GetEffectInput(l.effect_phi, 0));
+  EXPECT_EQ(l.effect_phi, NodeProperties::GetEffectInput(l.check));
+  EXPECT_EQ(l.loop, NodeProperties::GetControlInput(l.check));
+}
+
+TEST_F(LoopCheckHoistingTest, KeepCheckMapsOnLoopVariant) {
+  CheckedLoop l = NewCheckedLoop(nullptr, false);
+  HoistChecks();
+
+  EXPECT_EQ(l.checkpoint, NodeProperties::GetEffectInput(l.effect_phi, 0));
+  EXPECT_EQ(l.effect_phi, NodeProperties::GetEffectInput(l.check));
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
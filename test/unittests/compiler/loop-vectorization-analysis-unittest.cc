@@ -0,0 +1,102 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/loop-vectorization-analysis.h"
+
+#include "src/compiler/node.h"
+#include "src/compiler/simplified-operator.h"
+#include "test/unittests/compiler/graph-unittest.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class LoopVectorizationAnalysisTest : public GraphTest {
+ public:
+  LoopVectorizationAnalysisTest() : GraphTest(5), simplified_(zone()) {}
+  ~LoopVectorizationAnalysisTest() override = default;
+
+ protected:
+  SimplifiedOperatorBuilder* simplified() { return &simplified_; }
+
+  // Builds `for (i = 0; i < n; i++) dst[i] = src[i] * src[i]` on Float64
+  // typed arrays. If {with_reduction} is set, the loop also sums up the loaded
+  // values in a second phi.
+  void BuildLoop(bool with_reduction) {
+    Node* src = Parameter(0);
+    Node* dst = Parameter(1);
+    Node* base = Parameter(2);
+    Node* external = Parameter(3);
+    Node* n = Parameter(4);
+    Node* zero = NumberConstant(0);
+
+    Node* loop = graph()->NewNode(common()->Loop(2), start(), start());
+    Node* effect_phi =
+        graph()->NewNode(common()->EffectPhi(2), start(), start(), loop);
+    Node* i = graph()->NewNode(
+        common()->Phi(MachineRepresentation::kTagged, 2), zero, zero, loop);
+    Node* cond = graph()->NewNode(simplified()->NumberLessThan(), i, n);
+    Node* branch = graph()->NewNode(common()->Branch(), cond, loop);
+    Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+    Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+
+    Node* load = graph()->NewNode(
+        simplified()->LoadTypedElement(kExternalFloat64Array), src, base,
+        external, i, effect_phi, if_true);
+    Node* value = graph()->NewNode(simplified()->NumberMultiply(), load, load);
+    Node* store = graph()->NewNode(
+        simplified()->StoreTypedElement(kExternalFloat64Array), dst, base,
+        external, i, value, load, if_true);
+    Node* result = zero;
+    if (with_reduction) {
+      Node* sum = graph()->NewNode(
+          common()->Phi(MachineRepresentation::kTagged, 2), zero, zero, loop);
+      sum->ReplaceInput(
+          1, graph()->NewNode(simplified()->NumberAdd(), sum, load));
+      result = sum;
+    }
+
+    i->ReplaceInput(1, graph()->NewNode(simplified()->NumberAdd(), i,
+                                        NumberConstant(1)));
+    loop->ReplaceInput(1, if_true);
+    effect_phi->ReplaceInput(1, store);
+    Node* ret = graph()->NewNode(common()->Return(), Int32Constant(0), result,
+                                 effect_phi, if_false);
+    graph()->SetEnd(graph()->NewNode(common()->End(1), ret));
+    induction_variable_ = i;
+  }
+
+  bool FindCandidate(LoopVectorizationAnalysis::Candidate* candidate) {
+    LoopTree* loop_tree =
+        LoopFinder::BuildLoopTree(graph(), tick_counter(), zone());
+    EXPECT_EQ(1u, loop_tree->outer_loops().size());
+    return LoopVectorizationAnalysis(loop_tree).IsCandidate(
+        loop_tree->outer_loops()[0], candidate);
+  }
+
+  Node* induction_variable() const { return induction_variable_; }
+
+ private:
+  SimplifiedOperatorBuilder simplified_;
+  Node* induction_variable_ = nullptr;
+};
+
+TEST_F(LoopVectorizationAnalysisTest, ElementwiseLoop) {
+  BuildLoop(false);
+  LoopVectorizationAnalysis::Candidate candidate;
+  ASSERT_TRUE(FindCandidate(&candidate));
+  EXPECT_EQ(induction_variable(), candidate.induction_variable);
+  EXPECT_EQ(1, candidate.loads);
+  EXPECT_EQ(1, candidate.stores);
+}
+
+TEST_F(LoopVectorizationAnalysisTest, RejectReduction) {
+  BuildLoop(true);
+  LoopVectorizationAnalysis::Candidate candidate;
+  EXPECT_FALSE(FindCandidate(&candidate));
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
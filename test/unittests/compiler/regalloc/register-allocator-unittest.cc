@@ -4,6 +4,7 @@
 
 #include "src/codegen/assembler-inl.h"
 #include "src/compiler/pipeline.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/compiler/backend/instruction-sequence-unittest.h"
 
 namespace v8 {
@@ -693,6 +694,63 @@ TEST_F(RegisterAllocatorTest, ValidMultipleDeferredBlockSpills) {
             GetParallelMoveCount(start_of_b6, Instruction::START, sequence()));
 }
 
+TEST_F(RegisterAllocatorTest, FrequencyAwareSpillingInLoop) {
+  FLAG_SCOPE(turbo_frequency_aware_spilling);
+
+  StartBlock();  // B0
+  auto cond = EmitOI(Reg(1));
+  EndBlock();
+
+  StartLoop(4);
+  StartBlock();  // B1
+  auto var = EmitOI(Reg(0));
+  EndBlock(Branch(Reg(var), 1, 2));
+
+  StartBlock();  // B2
+  EmitCall(Slot(-1));
+  EndBlock(Jump(2));
+
+  StartBlock();  // B3
+  EmitNop();
+  EndBlock(Jump(1));
+
+  StartBlock();  // B4
+  EmitI(Reg(var));
+  EndBlock(Branch(Reg(cond), -3, 1));
+  EndLoop();
+
+  StartBlock();  // B5
+  Return(Reg(cond));
+  EndBlock();
+
+  Allocate();
+
+  const InstructionBlock* b0 =
+      sequence()->InstructionBlockAt(RpoNumber::FromInt(0));
+  const InstructionBlock* b1 =
+      sequence()->InstructionBlockAt(RpoNumber::FromInt(1));
+  const InstructionBlock* b4 =
+      sequence()->InstructionBlockAt(RpoNumber::FromInt(4));
+  EXPECT_EQ(0, sequence()->GetLoopDepth(b0));
+  EXPECT_EQ(1, sequence()->GetLoopDepth(b1));
+  EXPECT_EQ(1, sequence()->GetLoopDepth(b4));
+
+  // {var} only needs to be on the stack on the path with the call, so it must
+  // not be spilled at its definition on every iteration.
+  for (int i = b1->code_start(); i < b1->code_end(); ++i) {
+    const Instruction* instr = sequence()->InstructionAt(i);
+    for (int pos = Instruction::FIRST_GAP_POSITION;
+         pos <= Instruction::LAST_GAP_POSITION; ++pos) {
+      const ParallelMove* moves = instr->parallel_moves()[pos];
+      if (moves == nullptr) continue;
+      for (auto move : *moves) {
+        if (move->IsEliminated() || move->IsRedundant()) continue;
+        EXPECT_FALSE(move->destination().IsAnyStackSlot());
+      }
+    }
+  }
+}
+
 namespace {
 
 enum class ParameterType { kFixedSlot, kSlot, kRegister, kFixedRegister };
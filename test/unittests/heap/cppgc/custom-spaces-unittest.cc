@@ -18,6 +18,7 @@ class CustomSpace1 : public CustomSpace<CustomSpace1> {
 class CustomSpace2 : public CustomSpace<CustomSpace2> {
  public:
   static constexpr size_t kSpaceIndex = 1;
+  static constexpr bool kPrioritizeSweeping = true;
 };
 
 namespace internal {
@@ -173,6 +174,24 @@ TEST_F(TestWithHeapWithCustomSpaces, SweepCustomSpace) {
   EXPECT_EQ(4u, g_destructor_callcount);
 }
 
+TEST_F(TestWithHeapWithCustomSpaces, PrioritizedSweepingCustomSpace) {
+  auto* regular =
+      MakeGarbageCollected<RegularGCed>(GetHeap()->GetAllocationHandle());
+  auto* custom1 =
+      MakeGarbageCollected<CustomGCed1>(GetHeap()->GetAllocationHandle());
+  auto* custom2 =
+      MakeGarbageCollected<CustomGCed2>(GetHeap()->GetAllocationHandle());
+  EXPECT_FALSE(
+      NormalPage::FromPayload(regular)->space().is_sweeping_prioritized());
+  EXPECT_FALSE(
+      NormalPage::FromPayload(custom1)->space().is_sweeping_prioritized());
+  EXPECT_TRUE(
+      NormalPage::FromPayload(custom2)->space().is_sweeping_prioritized());
+  EXPECT_EQ(0u, g_destructor_callcount);
+  PreciseGC();
+  EXPECT_EQ(2u, g_destructor_callcount);
+}
+
 }  // namespace internal
 
 // Test custom space compactability.
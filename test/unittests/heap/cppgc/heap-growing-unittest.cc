@@ -174,5 +174,23 @@ TEST(HeapGrowingTest, IncrementalGCFinalized) {
   FakeAllocate(&stats_collector, StatsCollector::kAllocationThresholdBytes);
 }
 
+#if defined(CPPGC_YOUNG_GENERATION)
+TEST(HeapGrowingTest, MinorGCInvoked) {
+  StatsCollector stats_collector(kNoPlatform);
+  MockGarbageCollector gc;
+  cppgc::Heap::ResourceConstraints constraints;
+  HeapGrowing growing(&gc, &stats_collector, constraints,
+                      cppgc::Heap::MarkingType::kIncrementalAndConcurrent,
+                      cppgc::Heap::SweepingType::kIncrementalAndConcurrent);
+  EXPECT_LT(growing.limit_for_minor_gc(), growing.limit_for_incremental_gc());
+  EXPECT_CALL(gc, CollectGarbage(::testing::Field(
+                      &GarbageCollector::Config::collection_type,
+                      GarbageCollector::Config::CollectionType::kMinor)));
+  EXPECT_CALL(gc, StartIncrementalGarbageCollection(::testing::_)).Times(0);
+  // Allocate past the minor GC limit but stay below the incremental limit.
+  FakeAllocate(&stats_collector, growing.limit_for_minor_gc() + 1);
+}
+#endif  // defined(CPPGC_YOUNG_GENERATION)
+
 }  // namespace internal
 }  // namespace cppgc
@@ -82,6 +82,7 @@ TEST_F(HeapStatisticsCollectorTest, NonEmptyNormalPage) {
       EXPECT_EQ(0u, space_stats.committed_size_bytes);
       EXPECT_EQ(0u, space_stats.resident_size_bytes);
       EXPECT_EQ(0u, space_stats.used_size_bytes);
+      EXPECT_EQ(0., space_stats.fragmentation);
       continue;
     }
     EXPECT_NE("LargePageSpace", space_stats.name);
@@ -94,6 +95,10 @@ TEST_F(HeapStatisticsCollectorTest, NonEmptyNormalPage) {
     EXPECT_EQ(kPageSize, space_stats.page_stats.back().committed_size_bytes);
     EXPECT_EQ(kPageSize, space_stats.page_stats.back().resident_size_bytes);
     EXPECT_EQ(used_size, space_stats.page_stats.back().used_size_bytes);
+    // The rest of the page is returned to the freelist.
+    EXPECT_LT(0., space_stats.fragmentation);
+    EXPECT_GT(1., space_stats.fragmentation);
+    EXPECT_FALSE(space_stats.is_compactable);
   }
   EXPECT_TRUE(found_non_empty_space);
 }
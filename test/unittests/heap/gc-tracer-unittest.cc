@@ -262,6 +262,25 @@ TEST_F(GCTracerTest, IncrementalMarkingDetails) {
           .duration);
 }
 
+TEST_F(GCTracerTest, IncrementalEmbedderTracingDetails) {
+  GCTracer* tracer = i_isolate()->heap()->tracer();
+  tracer->ResetForTesting();
+
+  tracer->AddIncrementalEmbedderTracingStep(100, 64);
+  tracer->AddIncrementalEmbedderTracingStep(50, 16);
+  EXPECT_EQ(150u, tracer->incremental_embedder_wrappers_);
+  EXPECT_EQ(64u, tracer->incremental_embedder_max_worklist_size_);
+  tracer->Start(GarbageCollector::MARK_COMPACTOR,
+                GarbageCollectionReason::kTesting, "collector unittest");
+  // Switch to incremental MC.
+  tracer->current_.type = GCTracer::Event::INCREMENTAL_MARK_COMPACTOR;
+  tracer->Stop(GarbageCollector::MARK_COMPACTOR);
+  EXPECT_EQ(150u, tracer->current_.incremental_embedder_wrappers);
+  EXPECT_EQ(64u, tracer->current_.incremental_embedder_max_worklist_size);
+  EXPECT_EQ(0u, tracer->incremental_embedder_wrappers_);
+  EXPECT_EQ(0u, tracer->incremental_embedder_max_worklist_size_);
+}
+
 TEST_F(GCTracerTest, IncrementalMarkingSpeed) {
   GCTracer* tracer = i_isolate()->heap()->tracer();
   tracer->ResetForTesting();
@@ -349,6 +368,29 @@ TEST_F(GCTracerTest, MutatorUtilization) {
                    tracer->AverageMarkCompactMutatorUtilization());
 }
 
+TEST_F(GCTracerTest, MainThreadMutatorUtilization) {
+  GCTracer* tracer = i_isolate()->heap()->tracer();
+  tracer->ResetForTesting();
+
+  // The first GC only starts the measurement.
+  tracer->RecordMainThreadMutatorUtilization(100, 50);
+  EXPECT_DOUBLE_EQ(1.0, tracer->CurrentMutatorUtilization());
+
+  // A scavenge ended at 200ms and took 25ms.
+  tracer->RecordMainThreadMutatorUtilization(200, 25);
+  EXPECT_DOUBLE_EQ(0.75, tracer->CurrentMutatorUtilization());
+
+  // Incremental marking steps between GCs count as GC time.
+  tracer->AddIncrementalMarkingStep(20, 1000);
+  tracer->AddIncrementalMarkingStep(5, 0);
+  tracer->RecordMainThreadMutatorUtilization(300, 25);
+  EXPECT_DOUBLE_EQ(0.5, tracer->CurrentMutatorUtilization());
+
+  // The steps were consumed by the previous GC.
+  tracer->RecordMainThreadMutatorUtilization(400, 0);
+  EXPECT_DOUBLE_EQ(1.0, tracer->CurrentMutatorUtilization());
+}
+
 TEST_F(GCTracerTest, BackgroundScavengerScope) {
   GCTracer* tracer = i_isolate()->heap()->tracer();
   tracer->ResetForTesting();
@@ -364,6 +406,21 @@ TEST_F(GCTracerTest, BackgroundScavengerScope) {
               .scopes[GCTracer::Scope::SCAVENGER_BACKGROUND_SCAVENGE_PARALLEL]);
 }
 
+TEST_F(GCTracerTest, BackgroundScavengerWeakEphemeronsScope) {
+  GCTracer* tracer = i_isolate()->heap()->tracer();
+  tracer->ResetForTesting();
+  tracer->Start(GarbageCollector::SCAVENGER, GarbageCollectionReason::kTesting,
+                "collector unittest");
+  tracer->AddScopeSampleBackground(
+      GCTracer::Scope::SCAVENGER_BACKGROUND_SCAVENGE_WEAK_EPHEMERONS, 4);
+  tracer->AddScopeSampleBackground(
+      GCTracer::Scope::SCAVENGER_BACKGROUND_SCAVENGE_WEAK_EPHEMERONS, 3);
+  tracer->Stop(GarbageCollector::SCAVENGER);
+  EXPECT_DOUBLE_EQ(
+      7, tracer->current_.scopes
+             [GCTracer::Scope::SCAVENGER_BACKGROUND_SCAVENGE_WEAK_EPHEMERONS]);
+}
+
 TEST_F(GCTracerTest, BackgroundMinorMCScope) {
   GCTracer* tracer = i_isolate()->heap()->tracer();
   tracer->ResetForTesting();
@@ -108,5 +108,23 @@ TEST_F(MemoryControllerTest, OldGenerationAllocationLimit) {
           new_space_capacity, factor, Heap::HeapGrowingMode::kMinimal));
 }
 
+TEST_F(MemoryControllerTest, ProcessHeapBudgetSplit) {
+  const size_t budget = 1024 * MB;
+  // Headroom is split by throughput.
+  EXPECT_EQ(100 * MB + 150 * MB,
+            ProcessHeapBudget::ComputeAllocationLimit(budget, 100 * MB, 30,
+                                                      424 * MB, 120));
+  // Without throughput the headroom is split by live size.
+  EXPECT_EQ(128 * MB + 128 * MB,
+            ProcessHeapBudget::ComputeAllocationLimit(budget, 128 * MB, 0,
+                                                      512 * MB, 0));
+  // A single heap gets all of the headroom.
+  EXPECT_EQ(budget, ProcessHeapBudget::ComputeAllocationLimit(
+                        budget, 100 * MB, 10, 100 * MB, 10));
+  // Over budget, no further growth is granted.
+  EXPECT_EQ(600 * MB, ProcessHeapBudget::ComputeAllocationLimit(
+                          budget, 600 * MB, 10, 1100 * MB, 20));
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -75,6 +75,19 @@ TEST(SlotSet, InsertAndLookup2) {
   SlotSet::Delete(set, SlotSet::kBucketsRegularPage);
 }
 
+TEST(SlotSet, InsertCell) {
+  SlotSet* set = SlotSet::Allocate(SlotSet::kBucketsRegularPage);
+  const int kCellSize = SlotSet::kBitsPerCell * kTaggedSize;
+  for (int i = 0; i < Page::kPageSize; i += kCellSize) {
+    set->InsertCell<AccessMode::ATOMIC>(i, 0x80000005u);
+  }
+  for (int i = 0; i < Page::kPageSize; i += kTaggedSize) {
+    int bit = (i % kCellSize) / kTaggedSize;
+    EXPECT_EQ(bit == 0 || bit == 2 || bit == 31, set->Lookup(i));
+  }
+  SlotSet::Delete(set, SlotSet::kBucketsRegularPage);
+}
+
 TEST(SlotSet, Iterate) {
   SlotSet* set = SlotSet::Allocate(SlotSet::kBucketsRegularPage);
 
@@ -153,6 +153,28 @@ TEST_F(SpacesTest, CodeRangeAddressReuse) {
   EXPECT_EQ(code_range6, code_range3);
 }
 
+TEST_F(SpacesTest, CodeRangePackedPageHint) {
+  CodeRange code_range;
+  CHECK(code_range.InitReservation(GetPlatformPageAllocator(), 16 * MB));
+  const size_t kPageSize = MemoryChunk::kPageSize;
+  Address end =
+      code_range.page_allocator()->begin() + code_range.page_allocator()->size();
+
+  // Without remapped builtins, pages are packed from the end of the range.
+  Address hint = code_range.GetPackedPageHint(kPageSize, kPageSize);
+  EXPECT_EQ(RoundDown(end - kPageSize, kPageSize), hint);
+
+  // A page that was placed elsewhere does not move the packed area.
+  code_range.NotifyPackedPageAllocated(hint,
+                                       code_range.page_allocator()->begin());
+  EXPECT_EQ(hint, code_range.GetPackedPageHint(kPageSize, kPageSize));
+
+  // A page allocated at the hint does, so the next page goes right below it.
+  code_range.NotifyPackedPageAllocated(hint, hint);
+  EXPECT_EQ(hint - kPageSize,
+            code_range.GetPackedPageHint(kPageSize, kPageSize));
+}
+
 // Tests that FreeListMany::SelectFreeListCategoryType returns what it should.
 TEST_F(SpacesTest, FreeListManySelectFreeListCategoryType) {
   FreeListMany free_list;
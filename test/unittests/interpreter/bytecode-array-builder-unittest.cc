@@ -138,6 +138,14 @@ TEST_F(BytecodeArrayBuilderTest, AllBytecodesGenerated) {
                        BytecodeArrayBuilder::kImmutableSlot)
       .StoreContextSlot(Register::current_context(), 3, 0);
 
+  // Emit loads from elided arguments objects.
+  builder.LoadArgumentsLength(CreateArgumentsType::kUnmappedArguments)
+      .LoadArgumentsLength(CreateArgumentsType::kRestParameter)
+      .LoadKeyedArgument(CreateArgumentsType::kMappedArguments,
+                         keyed_load_slot.ToInt())
+      .LoadKeyedArgument(CreateArgumentsType::kRestParameter,
+                         keyed_load_slot.ToInt());
+
   // Emit load / store property operations.
   builder.LoadNamedProperty(reg, name, load_slot.ToInt())
       .LoadNamedPropertyFromSuper(reg, name, load_slot.ToInt())
@@ -114,6 +114,62 @@ TEST(DefaultWorkerThreadsTaskRunnerUnittest, PostTaskOrderMultipleWorkers) {
   ASSERT_EQ(1, std::count(order.begin(), order.end(), 5));
 }
 
+TEST(DefaultWorkerThreadsTaskRunnerUnittest, PostTaskPriorities) {
+  DefaultWorkerThreadsTaskRunner runner(1, RealTime);
+
+  std::vector<int> order;
+  base::Semaphore blocked(0);
+  base::Semaphore done(0);
+
+  // Keep the worker busy until all tasks are queued.
+  runner.PostTask(std::make_unique<TestTask>([&] { blocked.Wait(); }));
+  runner.PostTask(std::make_unique<TestTask>([&] {
+                    order.push_back(1);
+                    done.Signal();
+                  }),
+                  TaskPriority::kBestEffort);
+  runner.PostTask(std::make_unique<TestTask>([&] { order.push_back(2); }),
+                  TaskPriority::kUserVisible);
+  runner.PostTask(std::make_unique<TestTask>([&] { order.push_back(3); }),
+                  TaskPriority::kUserBlocking);
+  runner.PostTask(std::make_unique<TestTask>([&] { order.push_back(4); }),
+                  TaskPriority::kUserBlocking);
+  blocked.Signal();
+  done.Wait();
+
+  runner.Terminate();
+  ASSERT_EQ(4UL, order.size());
+  ASSERT_EQ(3, order[0]);
+  ASSERT_EQ(4, order[1]);
+  ASSERT_EQ(2, order[2]);
+  ASSERT_EQ(1, order[3]);
+}
+
+TEST(DefaultWorkerThreadsTaskRunnerUnittest, TasksPostedFromWorkersAreStolen) {
+  DefaultWorkerThreadsTaskRunner runner(4, RealTime);
+
+  constexpr int kTasks = 16;
+  std::atomic_int started{0};
+  base::Semaphore all_started(0);
+  base::Semaphore release(0);
+
+  // A single task posts all others to its worker's own queue and then blocks,
+  // so the other workers have to steal them.
+  runner.PostTask(std::make_unique<TestTask>([&] {
+    for (int i = 0; i < kTasks; i++) {
+      runner.PostTask(std::make_unique<TestTask>([&] {
+        if (++started == kTasks) all_started.Signal();
+      }));
+    }
+    release.Wait();
+  }));
+  all_started.Wait();
+  release.Signal();
+
+  runner.Terminate();
+  ASSERT_EQ(kTasks, started.load());
+}
+
 class FakeClock {
  public:
   static double time() { return time_.load(); }
@@ -4,6 +4,7 @@
 
 #include "src/logging/runtime-call-stats.h"
 
+#include "include/v8-metrics.h"
 #include "include/v8-template.h"
 #include "src/api/api-inl.h"
 #include "src/base/atomic-utils.h"
@@ -383,6 +384,41 @@ TEST_F(RuntimeCallStatsTest, NestedScopes) {
   EXPECT_EQ(100, counter3()->time().InMicroseconds());
 }
 
+TEST_F(RuntimeCallStatsTest, SampledScopes) {
+  int old_sampling_rate = FLAG_rcs_sampling_rate;
+  FLAG_rcs_sampling_rate = 4;
+  RuntimeCallStats sampled_stats(RuntimeCallStats::kMainIsolateThread);
+  FLAG_rcs_sampling_rate = old_sampling_rate;
+  EXPECT_EQ(4, sampled_stats.sampling_rate());
+
+  for (int i = 0; i < 8; i++) {
+    RCS_SCOPE(&sampled_stats, counter_id());
+    Sleep(50);
+    {
+      RCS_SCOPE(&sampled_stats, counter_id2());
+      Sleep(10);
+    }
+    // Only the sampled scopes and the scopes nested in them are timed.
+    EXPECT_EQ(i % 4 == 3, sampled_stats.current_timer() != nullptr);
+  }
+  EXPECT_EQ(nullptr, sampled_stats.current_timer());
+
+  // Two of the eight outermost scopes were timed and are counted four times.
+  RuntimeCallCounter* sampled_counter = sampled_stats.GetCounter(counter_id());
+  EXPECT_EQ(8, sampled_counter->count());
+  EXPECT_EQ(400, sampled_counter->time().InMicroseconds());
+  RuntimeCallCounter* nested_counter = sampled_stats.GetCounter(counter_id2());
+  EXPECT_EQ(8, nested_counter->count());
+  EXPECT_EQ(80, nested_counter->time().InMicroseconds());
+
+  std::vector<v8::metrics::RuntimeCallStatsEntry> entries;
+  sampled_stats.GetEntries(&entries);
+  ASSERT_EQ(2u, entries.size());
+  EXPECT_STREQ(sampled_counter->name(), entries[0].name);
+  EXPECT_EQ(8, entries[0].count);
+  EXPECT_EQ(400, entries[0].time_in_us);
+}
+
 TEST_F(RuntimeCallStatsTest, BasicJavaScript) {
   RuntimeCallCounter* counter =
       stats()->GetCounter(RuntimeCallCounterId::kJS_Execution);
@@ -787,6 +787,42 @@ TEST_F(ValueSerializerTest, InvalidDecodeObjectWithInvalidKeyType) {
       {0xFF, 0x09, 0x6F, 0x61, 0x00, 0x40, 0x00, 0x00, 0x7B, 0x01});
 }
 
+TEST_F(ValueSerializerTest, RoundTripObjectsWithSharedKeys) {
+  // Repeated keys are written once and then referenced, whether or not the
+  // objects have the same shape.
+  Local<Value> value =
+      RoundTripTest("[{a: 1, b: 2}, {a: 3, b: 4}, {b: 5, a: 6, c: 7}]");
+  ExpectScriptTrue("result[1].a === 3 && result[1].b === 4");
+  ExpectScriptTrue(
+      "Object.getOwnPropertyNames(result[2]).toString() === 'b,a,c'");
+  ExpectScriptTrue("result[2].a === 6 && result[2].c === 7");
+
+  // Keys are shared between objects and the named properties of arrays.
+  value = RoundTripTest("var x = [1]; x.a = 2; [{a: 3}, x, {a: 4}]");
+  ExpectScriptTrue("result[1].a === 2 && result[2].a === 4");
+
+  // Records of the same shape only spend a few bytes on their keys.
+  std::vector<uint8_t> data = EncodeTest(
+      "Array.from({length: 100}, (_, i) => ({aLongPropertyName: i}))");
+  EXPECT_LT(data.size(), 100u * 16);
+}
+
+TEST_F(ValueSerializerTest, DecodeObjectKeyReference) {
+  Local<Value> value =
+      DecodeTest({0xFF, 0x0E, 0x41, 0x02, 0x6F, 0x22, 0x01, 0x61, 0x49, 0x02,
+                  0x7B, 0x01, 0x6F, 0x71, 0x00, 0x49, 0x04, 0x7B, 0x01, 0x24,
+                  0x00, 0x02});
+  ASSERT_TRUE(value->IsArray());
+  ExpectScriptTrue("result[0].a === 1 && result[1].a === 2");
+
+  // The referenced key must have been read before.
+  InvalidDecodeTest({0xFF, 0x0E, 0x6F, 0x71, 0x00, 0x49, 0x02, 0x7B, 0x01});
+  // Key references do not exist before version 14.
+  InvalidDecodeTest({0xFF, 0x0D, 0x41, 0x02, 0x6F, 0x22, 0x01, 0x61, 0x49,
+                     0x02, 0x7B, 0x01, 0x6F, 0x71, 0x00, 0x49, 0x04, 0x7B,
+                     0x01, 0x24, 0x00, 0x02});
+}
+
 TEST_F(ValueSerializerTest, RoundTripOnlyOwnEnumerableStringKeys) {
   // Only "own" properties should be serialized, not ones on the prototype.
   Local<Value> value = RoundTripTest("var x = {}; x.__proto__ = {a: 4}; x;");
@@ -2211,6 +2247,98 @@ TEST_F(ValueSerializerTest, UnsupportedHostObject) {
   InvalidEncodeTest("({ a: new ExampleHostObject() })");
 }
 
+class ValueSerializerTestWithExternalStrings : public ValueSerializerTest {
+ protected:
+  ValueSerializerTestWithExternalStrings()
+      : serializer_delegate_(this), deserializer_delegate_(this) {}
+
+  class OneByteResource : public String::ExternalOneByteStringResource {
+   public:
+    explicit OneByteResource(const char* data)
+        : data_(data), length_(strlen(data)) {}
+    const char* data() const override { return data_; }
+    size_t length() const override { return length_; }
+
+   private:
+    const char* data_;
+    size_t length_;
+  };
+
+  // Passes every external string by reference, through |strings_|.
+  class SerializerDelegate : public ValueSerializer::Delegate {
+   public:
+    explicit SerializerDelegate(ValueSerializerTestWithExternalStrings* test)
+        : test_(test) {}
+    Maybe<bool> GetExternalStringId(Isolate* isolate, Local<String> string,
+                                    uint32_t* id) override {
+      *id = static_cast<uint32_t>(test_->strings_.size());
+      test_->strings_.emplace_back(isolate, string);
+      return Just(true);
+    }
+    void ThrowDataCloneError(Local<String> message) override {
+      test_->isolate()->ThrowException(Exception::Error(message));
+    }
+
+   private:
+    ValueSerializerTestWithExternalStrings* test_;
+  };
+
+  class DeserializerDelegate : public ValueDeserializer::Delegate {
+   public:
+    explicit DeserializerDelegate(ValueSerializerTestWithExternalStrings* test)
+        : test_(test) {}
+    MaybeLocal<String> GetExternalStringFromId(Isolate* isolate,
+                                               uint32_t id) override {
+      EXPECT_LT(id, test_->strings_.size());
+      return test_->strings_[id].Get(isolate);
+    }
+
+   private:
+    ValueSerializerTestWithExternalStrings* test_;
+  };
+
+  ValueSerializer::Delegate* GetSerializerDelegate() override {
+    return &serializer_delegate_;
+  }
+
+  ValueDeserializer::Delegate* GetDeserializerDelegate() override {
+    return &deserializer_delegate_;
+  }
+
+  SerializerDelegate serializer_delegate_;
+  DeserializerDelegate deserializer_delegate_;
+  std::vector<Global<String>> strings_;
+};
+
+TEST_F(ValueSerializerTestWithExternalStrings, RoundTripExternalString) {
+  Local<String> input;
+  {
+    Context::Scope scope(serialization_context());
+    input = String::NewExternalOneByte(isolate(),
+                                       new OneByteResource("external string"))
+                .ToLocalChecked();
+  }
+  Local<Value> value = RoundTripTest(input);
+  EXPECT_EQ(input, value);
+  EXPECT_EQ(1u, strings_.size());
+  ExpectScriptTrue("result === 'external string'");
+
+  // Strings on the heap are still copied.
+  value = RoundTripTest("'heap string'");
+  ASSERT_TRUE(value->IsString());
+  EXPECT_EQ(1u, strings_.size());
+  ExpectScriptTrue("result === 'heap string'");
+}
+
+TEST_F(ValueSerializerTestWithExternalStrings, DecodeExternalStringReference) {
+  strings_.emplace_back(isolate(), StringFromUtf8("referenced"));
+  DecodeTest({0xFF, 0x0E, 0x45, 0x00});
+  ExpectScriptTrue("result === 'referenced'");
+
+  // The tag is unknown before version 14.
+  InvalidDecodeTest({0xFF, 0x0D, 0x45, 0x00});
+}
+
 class ValueSerializerTestWithHostObject : public ValueSerializerTest {
  protected:
   ValueSerializerTestWithHostObject() : serializer_delegate_(this) {}
@@ -2,7 +2,9 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include "src/heap/factory.h"
 #include "src/objects/js-regexp-inl.h"
+#include "src/regexp/regexp-bytecode-cache.h"
 #include "test/unittests/test-utils.h"
 
 namespace v8 {
@@ -35,5 +37,47 @@ TEST_F(TestWithNativeContext, ConvertRegExpFlagsToStringAllFlags) {
   EXPECT_TRUE(String::Equals(isolate(), flags, converted_flags));
 }
 
+TEST_F(TestWithIsolate, SharedBytecodeCacheRoundTrip) {
+  RegExpBytecodeCache::Clear();
+  Handle<String> pattern = factory()->NewStringFromAsciiChecked("ab+c");
+  const byte raw_bytecode[] = {1, 2, 3, 4, 5, 6, 7, 8};
+  Handle<ByteArray> bytecode = factory()->NewByteArray(sizeof(raw_bytecode));
+  bytecode->copy_in(0, raw_bytecode, sizeof(raw_bytecode));
+  int register_count = 0;
+  EXPECT_TRUE(RegExpBytecodeCache::Lookup(isolate(), pattern,
+                                          RegExpFlag::kGlobal, true, 0,
+                                          &register_count)
+                  .is_null());
+
+  RegExpBytecodeCache::Insert(pattern, RegExpFlag::kGlobal, true, 0, bytecode,
+                              4);
+  Handle<ByteArray> cached;
+  ASSERT_TRUE(RegExpBytecodeCache::Lookup(isolate(), pattern,
+                                          RegExpFlag::kGlobal, true, 0,
+                                          &register_count)
+                  .ToHandle(&cached));
+  EXPECT_NE(*bytecode, *cached);
+  EXPECT_EQ(4, register_count);
+  ASSERT_EQ(bytecode->length(), cached->length());
+  for (int i = 0; i < bytecode->length(); i++) {
+    EXPECT_EQ(bytecode->get(i), cached->get(i));
+  }
+
+  // The flags, character width and backtrack limit are part of the key.
+  EXPECT_TRUE(RegExpBytecodeCache::Lookup(isolate(), pattern,
+                                          RegExpFlag::kIgnoreCase, true, 0,
+                                          &register_count)
+                  .is_null());
+  EXPECT_TRUE(RegExpBytecodeCache::Lookup(isolate(), pattern,
+                                          RegExpFlag::kGlobal, false, 0,
+                                          &register_count)
+                  .is_null());
+  EXPECT_TRUE(RegExpBytecodeCache::Lookup(isolate(), pattern,
+                                          RegExpFlag::kGlobal, true, 10,
+                                          &register_count)
+                  .is_null());
+  RegExpBytecodeCache::Clear();
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -0,0 +1,111 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/strings/string-hasher.h"
+
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "src/base/platform/elapsed-timer.h"
+#include "src/strings/string-hasher-inl.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+const uint64_t kSeed = 0x1234567890ABCDEF;
+
+uint32_t Hash(const std::string& string, uint64_t seed = kSeed) {
+  return StringHasher::HashSequentialString(
+      string.data(), static_cast<int>(string.length()), seed);
+}
+
+uint32_t Hash(const std::u16string& string, uint64_t seed = kSeed) {
+  return StringHasher::HashSequentialString(
+      reinterpret_cast<const uint16_t*>(string.data()),
+      static_cast<int>(string.length()), seed);
+}
+
+// The character-at-a-time hash, as used for shorter strings.
+uint32_t CharacterHash(const std::string& string) {
+  uint32_t running_hash = static_cast<uint32_t>(kSeed);
+  for (char c : string) {
+    running_hash =
+        StringHasher::AddCharacterCore(running_hash, static_cast<uint8_t>(c));
+  }
+  return StringHasher::GetHashCore(running_hash) << String::kHashShift;
+}
+
+// Long keys that only differ in a few characters, like generated names.
+std::vector<std::string> LongKeys(int count) {
+  std::vector<std::string> keys;
+  for (int i = 0; i < count; i++) {
+    std::string key(StringHasher::kMinBlockHashLength, 'k');
+    key += std::to_string(i);
+    key[i % 16] = static_cast<char>('a' + i % 7);
+    keys.push_back(key);
+  }
+  return keys;
+}
+
+}  // namespace
+
+TEST(StringHasherTest, BlockHashIgnoresRepresentation) {
+  for (int length = StringHasher::kMinBlockHashLength - 2;
+       length < StringHasher::kMinBlockHashLength + 10; length++) {
+    std::string one_byte;
+    std::u16string two_byte;
+    for (int i = 0; i < length; i++) {
+      char16_t c = static_cast<char16_t>(0x20 + (i * 37) % 0xDF);
+      one_byte += static_cast<char>(c);
+      two_byte += c;
+    }
+    EXPECT_EQ(Hash(one_byte), Hash(two_byte));
+    EXPECT_NE(Hash(one_byte), Hash(one_byte, kSeed + 1));
+    // Every character, including the ones in the tail, contributes.
+    std::string changed = one_byte;
+    changed.back() = changed.back() + 1;
+    EXPECT_NE(Hash(one_byte), Hash(changed));
+  }
+}
+
+TEST(StringHasherTest, BlockHashKeepsIndexHashes) {
+  // Integer indices are short, so they never take the block hash.
+  EXPECT_EQ(StringHasher::MakeArrayIndexHash(12345, 5), Hash("12345"));
+  std::string not_an_index(StringHasher::kMinBlockHashLength, '1');
+  uint32_t hash = Hash(not_an_index);
+  EXPECT_NE(0u, hash & String::kIsNotIntegerIndexMask);
+  EXPECT_FALSE(Name::ContainsCachedArrayIndex(hash));
+}
+
+TEST(StringHasherTest, BlockHashCollisionsAndThroughput) {
+  const int kCount = 100000;
+  std::vector<std::string> keys = LongKeys(kCount);
+
+  std::unordered_set<uint32_t> block_hashes;
+  std::unordered_set<uint32_t> character_hashes;
+  base::ElapsedTimer timer;
+  timer.Start();
+  for (const std::string& key : keys) block_hashes.insert(Hash(key));
+  double block_ms = timer.Elapsed().InMillisecondsF();
+  timer.Restart();
+  for (const std::string& key : keys) {
+    character_hashes.insert(CharacterHash(key));
+  }
+  double character_ms = timer.Elapsed().InMillisecondsF();
+
+  size_t block_collisions = kCount - block_hashes.size();
+  size_t character_collisions = kCount - character_hashes.size();
+  printf("block hash: %zu collisions, %.2f ms\n", block_collisions, block_ms);
+  printf("character hash: %zu collisions, %.2f ms\n", character_collisions,
+         character_ms);
+  // With 30 hash bits, about 5 collisions are expected by chance.
+  EXPECT_LT(block_collisions, 50u);
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,95 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/utils/mpsc-queue-inl.h"
+
+#include <memory>
+#include <vector>
+
+#include "src/base/platform/platform.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace {
+
+using Record = int;
+
+}  // namespace
+
+namespace v8 {
+namespace internal {
+
+TEST(MpscQueue, ConstructorEmpty) {
+  MpscQueue<Record> queue;
+  EXPECT_TRUE(queue.IsEmpty());
+  EXPECT_EQ(0u, queue.size());
+}
+
+TEST(MpscQueue, PeekAndDequeue) {
+  MpscQueue<Record> queue;
+  Record a = -1;
+  EXPECT_FALSE(queue.Peek(&a));
+  EXPECT_FALSE(queue.Dequeue(&a));
+  queue.Enqueue(1);
+  queue.Enqueue(2);
+  EXPECT_FALSE(queue.IsEmpty());
+  EXPECT_EQ(2u, queue.size());
+  EXPECT_TRUE(queue.Peek(&a));
+  EXPECT_EQ(1, a);
+  EXPECT_TRUE(queue.Dequeue(&a));
+  EXPECT_EQ(1, a);
+  EXPECT_TRUE(queue.Dequeue(&a));
+  EXPECT_EQ(2, a);
+  EXPECT_TRUE(queue.IsEmpty());
+  EXPECT_EQ(0u, queue.size());
+}
+
+namespace {
+
+class ProducerThread final : public base::Thread {
+ public:
+  ProducerThread(MpscQueue<Record>* queue, int id, int count)
+      : Thread(Options("MpscQueueProducer")),
+        queue_(queue),
+        id_(id),
+        count_(count) {}
+
+  void Run() override {
+    for (int i = 0; i < count_; i++) queue_->Enqueue(id_ * count_ + i);
+  }
+
+ private:
+  MpscQueue<Record>* const queue_;
+  const int id_;
+  const int count_;
+};
+
+}  // namespace
+
+TEST(MpscQueue, MultipleProducers) {
+  const int kProducers = 4;
+  const int kRecordsPerProducer = 10000;
+  MpscQueue<Record> queue;
+  std::vector<std::unique_ptr<ProducerThread>> producers;
+  for (int i = 0; i < kProducers; i++) {
+    producers.emplace_back(new ProducerThread(&queue, i, kRecordsPerProducer));
+    CHECK(producers.back()->Start());
+  }
+
+  // Records of each producer arrive in order.
+  std::vector<int> next(kProducers, 0);
+  int received = 0;
+  while (received < kProducers * kRecordsPerProducer) {
+    Record record;
+    if (!queue.Dequeue(&record)) continue;
+    int producer = record / kRecordsPerProducer;
+    EXPECT_EQ(next[producer], record % kRecordsPerProducer);
+    next[producer]++;
+    received++;
+  }
+  for (auto& producer : producers) producer->Join();
+  EXPECT_TRUE(queue.IsEmpty());
+}
+
+}  // namespace internal
+}  // namespace v8
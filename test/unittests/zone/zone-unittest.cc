@@ -22,5 +22,40 @@ TEST(Zone, 8ByteAlignment) {
   }
 }
 
+#if !defined(V8_USE_ADDRESS_SANITIZER) && !defined(V8_USE_MEMORY_SANITIZER)
+TEST(Zone, SegmentsAreReused) {
+  AccountingAllocator::ReleasePooledSegments();
+  AccountingAllocator allocator;
+  Address first_segment;
+  {
+    Zone zone(&allocator, ZONE_NAME);
+    first_segment = reinterpret_cast<Address>(zone.Allocate<ZoneTest>(16));
+    EXPECT_EQ(0u, AccountingAllocator::GetPooledMemoryUsage());
+  }
+  EXPECT_EQ(0u, allocator.GetCurrentMemoryUsage());
+  EXPECT_LT(0u, AccountingAllocator::GetPooledMemoryUsage());
+  {
+    // The new zone's first segment comes from the same thread's pool.
+    Zone zone(&allocator, ZONE_NAME);
+    Address second_segment =
+        reinterpret_cast<Address>(zone.Allocate<ZoneTest>(16));
+    EXPECT_EQ(first_segment, second_segment);
+    EXPECT_EQ(0u, AccountingAllocator::GetPooledMemoryUsage());
+  }
+  AccountingAllocator::ReleasePooledSegments();
+  EXPECT_EQ(0u, AccountingAllocator::GetPooledMemoryUsage());
+}
+
+TEST(Zone, LargeSegmentsAreNotPooled) {
+  AccountingAllocator::ReleasePooledSegments();
+  AccountingAllocator allocator;
+  {
+    Zone zone(&allocator, ZONE_NAME);
+    zone.Allocate<ZoneTest>(2 * AccountingAllocator::kMaxPooledSegmentSize);
+  }
+  EXPECT_EQ(0u, AccountingAllocator::GetPooledMemoryUsage());
+}
+#endif  // !V8_USE_ADDRESS_SANITIZER && !V8_USE_MEMORY_SANITIZER
+
 }  // namespace internal
 }  // namespace v8